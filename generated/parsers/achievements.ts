@@ -0,0 +1,1378 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\achievements.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x8d3dc85c;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.name = v3;
+				break;
+			}
+			case 2: {
+				let obj4 = {};
+				let hidden5 = {};
+				state.stack.push(obj4);
+				state.hiddenstack.push(hidden5);
+				let v6 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v6 !== undefined) { obj4.textvariants = v6; }
+				let ref7 = state.stack[state.stack.length - 1].textvariants;
+				let match8 = -1;
+				if ((ref7 & 1) != 0) { match8 = 0; }
+				let v9 = null;
+				if (match8 != -1) {
+					let v10 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v9 = v10;
+				}
+				if (v9 !== undefined) { obj4.unk0 = v9; }
+				let ref11 = state.stack[state.stack.length - 1].textvariants;
+				let match12 = -1;
+				if ((ref11 & 1) != 0) { match12 = 0; }
+				let v13 = null;
+				if (match12 != -1) {
+					let v14 = ext[0].read(state);
+					v13 = v14;
+				}
+				if (v13 !== undefined) { obj4.descr = v13; }
+				let ref15 = state.stack[state.stack.length - 1].textvariants;
+				let match16 = -1;
+				if ((ref15 & 2) != 0) { match16 = 0; }
+				let v17 = null;
+				if (match16 != -1) {
+					let v18 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v17 = v18;
+				}
+				if (v17 !== undefined) { obj4.unk1 = v17; }
+				let ref19 = state.stack[state.stack.length - 1].textvariants;
+				let match20 = -1;
+				if ((ref19 & 2) != 0) { match20 = 0; }
+				let v21 = null;
+				if (match20 != -1) {
+					let v22 = ext[0].read(state);
+					v21 = v22;
+				}
+				if (v21 !== undefined) { obj4.descr_ironman = v21; }
+				let ref23 = state.stack[state.stack.length - 1].textvariants;
+				let match24 = -1;
+				if ((ref23 & 4) != 0) { match24 = 0; }
+				let v25 = null;
+				if (match24 != -1) {
+					let v26 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v25 = v26;
+				}
+				if (v25 !== undefined) { obj4.gimcount2 = v25; }
+				let ref27 = state.stack[state.stack.length - 1].textvariants;
+				let match28 = -1;
+				if ((ref27 & 4) != 0) { match28 = 0; }
+				let v29 = null;
+				if (match28 != -1) {
+					let v30 = ext[0].read(state);
+					v29 = v30;
+				}
+				if (v29 !== undefined) { obj4.descr_gim2 = v29; }
+				let ref31 = state.stack[state.stack.length - 1].textvariants;
+				let match32 = -1;
+				if ((ref31 & 4) != 0) { match32 = 0; }
+				let v33 = null;
+				if (match32 != -1) {
+					let v34 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v33 = v34;
+				}
+				if (v33 !== undefined) { obj4.gimcount3 = v33; }
+				let ref35 = state.stack[state.stack.length - 1].textvariants;
+				let match36 = -1;
+				if ((ref35 & 4) != 0) { match36 = 0; }
+				let v37 = null;
+				if (match36 != -1) {
+					let v38 = ext[0].read(state);
+					v37 = v38;
+				}
+				if (v37 !== undefined) { obj4.descr_gim3 = v37; }
+				let ref39 = state.stack[state.stack.length - 1].textvariants;
+				let match40 = -1;
+				if ((ref39 & 4) != 0) { match40 = 0; }
+				let v41 = null;
+				if (match40 != -1) {
+					let v42 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v41 = v42;
+				}
+				if (v41 !== undefined) { obj4.gimcount4 = v41; }
+				let ref43 = state.stack[state.stack.length - 1].textvariants;
+				let match44 = -1;
+				if ((ref43 & 4) != 0) { match44 = 0; }
+				let v45 = null;
+				if (match44 != -1) {
+					let v46 = ext[0].read(state);
+					v45 = v46;
+				}
+				if (v45 !== undefined) { obj4.descr_gim4 = v45; }
+				let ref47 = state.stack[state.stack.length - 1].textvariants;
+				let match48 = -1;
+				if ((ref47 & 4) != 0) { match48 = 0; }
+				let v49 = null;
+				if (match48 != -1) {
+					let v50 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v49 = v50;
+				}
+				if (v49 !== undefined) { obj4.gimcount5 = v49; }
+				let ref51 = state.stack[state.stack.length - 1].textvariants;
+				let match52 = -1;
+				if ((ref51 & 4) != 0) { match52 = 0; }
+				let v53 = null;
+				if (match52 != -1) {
+					let v54 = ext[0].read(state);
+					v53 = v54;
+				}
+				if (v53 !== undefined) { obj4.descr_gim5 = v53; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.description = obj4;
+				break;
+			}
+			case 3: {
+				let v55 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.category = v55;
+				break;
+			}
+			case 4: {
+				let v56 = ext[1].read(state);
+				obj0.spriteId = v56;
+				break;
+			}
+			case 5: {
+				let v57 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.runescore = v57;
+				break;
+			}
+			case 6: {
+				let v58 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_0x06 = v58;
+				break;
+			}
+			case 7: {
+				let v59 = ext[0].read(state);
+				obj0.rewardtext = v59;
+				break;
+			}
+			case 8: {
+				let v60 = ext[2].read(state);
+				let hidden61 = { $index: 0, $length: v60 };
+				state.hiddenstack.push(hidden61);
+				state.stack.push({});
+				let arr62 = [];
+				for (let i63 = 0; i63 < v60; i63++) {
+					hidden61.$index = i63;
+					let obj64 = {};
+					let hidden65 = {};
+					state.stack.push(obj64);
+					state.hiddenstack.push(hidden65);
+					let v66 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v66 !== undefined) { obj64.ironman = v66; }
+					let v67 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v67 !== undefined) { obj64.level = v67; }
+					let v68 = ext[0].read(state);
+					if (v68 !== undefined) { obj64.text = v68; }
+					let v69 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v69 !== undefined) { obj64.unk_0 = v69; }
+					let v70 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v70 !== undefined) { obj64.unk_1 = v70; }
+					let v71 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v71 !== undefined) { obj64.skill = v71; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr62.push(obj64);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.subach_skills = arr62;
+				break;
+			}
+			case 9: {
+				let v72 = ext[2].read(state);
+				let hidden73 = { $index: 0, $length: v72 };
+				state.hiddenstack.push(hidden73);
+				state.stack.push({});
+				let arr74 = [];
+				for (let i75 = 0; i75 < v72; i75++) {
+					hidden73.$index = i75;
+					let obj76 = {};
+					let hidden77 = {};
+					state.stack.push(obj76);
+					state.hiddenstack.push(hidden77);
+					let v78 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v78 !== undefined) { obj76.type = v78; }
+					let v79 = ext[1].read(state);
+					if (v79 !== undefined) { obj76.value = v79; }
+					let v80 = ext[0].read(state);
+					if (v80 !== undefined) { obj76.name = v80; }
+					let v81 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v81 !== undefined) { obj76.stepsize = v81; }
+					let v82 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v82 !== undefined) { obj76.varbit = v82; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr74.push(obj76);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.subach_varbits = arr74;
+				break;
+			}
+			case 10: {
+				let v83 = ext[2].read(state);
+				let hidden84 = { $index: 0, $length: v83 };
+				state.hiddenstack.push(hidden84);
+				state.stack.push({});
+				let arr85 = [];
+				for (let i86 = 0; i86 < v83; i86++) {
+					hidden84.$index = i86;
+					let obj87 = {};
+					let hidden88 = {};
+					state.stack.push(obj87);
+					state.hiddenstack.push(hidden88);
+					let v89 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v89 !== undefined) { obj87.type = v89; }
+					let v90 = ext[1].read(state);
+					if (v90 !== undefined) { obj87.value = v90; }
+					let v91 = ext[0].read(state);
+					if (v91 !== undefined) { obj87.name = v91; }
+					let v92 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v92 !== undefined) { obj87.stepsize = v92; }
+					let v93 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v93 !== undefined) { obj87.varbit = v93; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr85.push(obj87);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.varbit_partial_state = arr85;
+				break;
+			}
+			case 11: {
+				let v94 = ext[2].read(state);
+				let hidden95 = { $index: 0, $length: v94 };
+				state.hiddenstack.push(hidden95);
+				state.stack.push({});
+				let arr96 = [];
+				for (let i97 = 0; i97 < v94; i97++) {
+					hidden95.$index = i97;
+					let v98 = ext[3].read(state);
+					arr96.push(v98);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.previous_achievements = arr96;
+				break;
+			}
+			case 12: {
+				let v99 = ext[2].read(state);
+				let hidden100 = { $index: 0, $length: v99 };
+				state.hiddenstack.push(hidden100);
+				state.stack.push({});
+				let arr101 = [];
+				for (let i102 = 0; i102 < v99; i102++) {
+					hidden100.$index = i102;
+					let obj103 = {};
+					let hidden104 = {};
+					state.stack.push(obj103);
+					state.hiddenstack.push(hidden104);
+					let v105 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v105 !== undefined) { obj103.unk0 = v105; }
+					let v106 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v106 !== undefined) { obj103.level = v106; }
+					let v107 = ext[0].read(state);
+					if (v107 !== undefined) { obj103.name = v107; }
+					let v108 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v108 !== undefined) { obj103.unk1 = v108; }
+					let v109 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v109 !== undefined) { obj103.skill = v109; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr101.push(obj103);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.skill_reqs_2 = arr101;
+				break;
+			}
+			case 14: {
+				let v110 = ext[2].read(state);
+				let hidden111 = { $index: 0, $length: v110 };
+				state.hiddenstack.push(hidden111);
+				state.stack.push({});
+				let arr112 = [];
+				for (let i113 = 0; i113 < v110; i113++) {
+					hidden111.$index = i113;
+					let obj114 = {};
+					let hidden115 = {};
+					state.stack.push(obj114);
+					state.hiddenstack.push(hidden115);
+					let v116 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v116 !== undefined) { obj114.unk0 = v116; }
+					let v117 = ext[1].read(state);
+					if (v117 !== undefined) { obj114.value = v117; }
+					let v118 = ext[0].read(state);
+					if (v118 !== undefined) { obj114.name = v118; }
+					let v119 = ext[2].read(state);
+					let hidden120 = { $index: 0, $length: v119 };
+					state.hiddenstack.push(hidden120);
+					state.stack.push({});
+					let arr121 = [];
+					for (let i122 = 0; i122 < v119; i122++) {
+						hidden120.$index = i122;
+						let v123 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						arr121.push(v123);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr121 !== undefined) { obj114.varbits = arr121; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr112.push(obj114);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.progress_states = arr112;
+				break;
+			}
+			case 13: {
+				let v124 = ext[2].read(state);
+				let hidden125 = { $index: 0, $length: v124 };
+				state.hiddenstack.push(hidden125);
+				state.stack.push({});
+				let arr126 = [];
+				for (let i127 = 0; i127 < v124; i127++) {
+					hidden125.$index = i127;
+					let obj128 = {};
+					let hidden129 = {};
+					state.stack.push(obj128);
+					state.hiddenstack.push(hidden129);
+					let v130 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v130 !== undefined) { obj128.unk0 = v130; }
+					let v131 = ext[1].read(state);
+					if (v131 !== undefined) { obj128.value = v131; }
+					let v132 = ext[0].read(state);
+					if (v132 !== undefined) { obj128.name = v132; }
+					let v133 = ext[2].read(state);
+					let hidden134 = { $index: 0, $length: v133 };
+					state.hiddenstack.push(hidden134);
+					state.stack.push({});
+					let arr135 = [];
+					for (let i136 = 0; i136 < v133; i136++) {
+						hidden134.$index = i136;
+						let v137 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						arr135.push(v137);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr135 !== undefined) { obj128.varbits = arr135; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr126.push(obj128);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.subreqs = arr126;
+				break;
+			}
+			case 15: {
+				let v138 = ext[2].read(state);
+				let hidden139 = { $index: 0, $length: v138 };
+				state.hiddenstack.push(hidden139);
+				state.stack.push({});
+				let arr140 = [];
+				for (let i141 = 0; i141 < v138; i141++) {
+					hidden139.$index = i141;
+					let obj142 = {};
+					let hidden143 = {};
+					state.stack.push(obj142);
+					state.hiddenstack.push(hidden143);
+					let v144 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v144 !== undefined) { obj142.unk0 = v144; }
+					let v145 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v145 !== undefined) { obj142.achievement = v145; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr140.push(obj142);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.sub_achievements = arr140;
+				break;
+			}
+			case 16: {
+				let v146 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.subcategory = v146;
+				break;
+			}
+			case 17: {
+				obj0.removed = true;
+				break;
+			}
+			case 18: {
+				let v147 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.hidden = v147;
+				break;
+			}
+			case 19: {
+				obj0.f2p = true;
+				break;
+			}
+			case 20: {
+				let v148 = ext[2].read(state);
+				let hidden149 = { $index: 0, $length: v148 };
+				state.hiddenstack.push(hidden149);
+				state.stack.push({});
+				let arr150 = [];
+				for (let i151 = 0; i151 < v148; i151++) {
+					hidden149.$index = i151;
+					let v152 = ext[3].read(state);
+					arr150.push(v152);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.quest_req_for_miniquests = arr150;
+				break;
+			}
+			case 21: {
+				let v153 = ext[2].read(state);
+				let hidden154 = { $index: 0, $length: v153 };
+				state.hiddenstack.push(hidden154);
+				state.stack.push({});
+				let arr155 = [];
+				for (let i156 = 0; i156 < v153; i156++) {
+					hidden154.$index = i156;
+					let v157 = ext[3].read(state);
+					arr155.push(v157);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.quest_ids = arr155;
+				break;
+			}
+			case 23: {
+				let v158 = ext[2].read(state);
+				let hidden159 = { $index: 0, $length: v158 };
+				state.hiddenstack.push(hidden159);
+				state.stack.push({});
+				let arr160 = [];
+				for (let i161 = 0; i161 < v158; i161++) {
+					hidden159.$index = i161;
+					let obj162 = {};
+					let hidden163 = {};
+					state.stack.push(obj162);
+					state.hiddenstack.push(hidden163);
+					let v164 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v164 !== undefined) { obj162.type = v164; }
+					let v165 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v165 !== undefined) { obj162.varbit = v165; }
+					let v166 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v166 !== undefined) { obj162.stepsize = v166; }
+					let ref167 = state.stack[state.stack.length - 1].type;
+					let match168 = -1;
+					if (ref167 == 0) { match168 = 0; }
+					let v169 = null;
+					if (match168 != -1) {
+						let v170 = ext[0].read(state);
+						v169 = v170;
+					}
+					if (v169 !== undefined) { obj162.name = v169; }
+					let ref171 = state.stack[state.stack.length - 1].type;
+					let match172 = -1;
+					if (ref171 == 1) { match172 = 0; }
+					let v173 = null;
+					if (match172 != -1) {
+						let v174 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v173 = v174;
+					}
+					if (v173 !== undefined) { obj162.requirement = v173; }
+					let v175 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v175 !== undefined) { obj162.subbit = v175; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr160.push(obj162);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.reqs23 = arr160;
+				break;
+			}
+			case 25: {
+				let v176 = ext[2].read(state);
+				let hidden177 = { $index: 0, $length: v176 };
+				state.hiddenstack.push(hidden177);
+				state.stack.push({});
+				let arr178 = [];
+				for (let i179 = 0; i179 < v176; i179++) {
+					hidden177.$index = i179;
+					let obj180 = {};
+					let hidden181 = {};
+					state.stack.push(obj180);
+					state.hiddenstack.push(hidden181);
+					let v182 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v182 !== undefined) { obj180.type = v182; }
+					let v183 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v183 !== undefined) { obj180.varbit = v183; }
+					let v184 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v184 !== undefined) { obj180.value = v184; }
+					let ref185 = state.stack[state.stack.length - 1].type;
+					let match186 = -1;
+					if (ref185 == 0) { match186 = 0; }
+					let v187 = null;
+					if (match186 != -1) {
+						let v188 = ext[0].read(state);
+						v187 = v188;
+					}
+					if (v187 !== undefined) { obj180.name = v187; }
+					let ref189 = state.stack[state.stack.length - 1].type;
+					let match190 = -1;
+					if (ref189 == 1) { match190 = 0; }
+					let v191 = null;
+					if (match190 != -1) {
+						let v192 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v191 = v192;
+					}
+					if (v191 !== undefined) { obj180.requirement = v191; }
+					let v193 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v193 !== undefined) { obj180.subbit = v193; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr178.push(obj180);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.reqs25 = arr178;
+				break;
+			}
+			case 26: {
+				let v194 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.dbrow = v194;
+				break;
+			}
+			case 27: {
+				obj0.unknown_0x1B = true;
+				break;
+			}
+			case 28: {
+				let v195 = ext[2].read(state);
+				let hidden196 = { $index: 0, $length: v195 };
+				state.hiddenstack.push(hidden196);
+				state.stack.push({});
+				let arr197 = [];
+				for (let i198 = 0; i198 < v195; i198++) {
+					hidden196.$index = i198;
+					let v199 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr197.push(v199);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.skill_req_count = arr197;
+				break;
+			}
+			case 29: {
+				let v200 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0x1D = v200;
+				break;
+			}
+			case 30: {
+				let v201 = ext[2].read(state);
+				let hidden202 = { $index: 0, $length: v201 };
+				state.hiddenstack.push(hidden202);
+				state.stack.push({});
+				let arr203 = [];
+				for (let i204 = 0; i204 < v201; i204++) {
+					hidden202.$index = i204;
+					let v205 = ext[2].read(state);
+					arr203.push(v205);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.subreq_count = arr203;
+				break;
+			}
+			case 31: {
+				let v206 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0x1F = v206;
+				break;
+			}
+			case 32: {
+				let v207 = ext[3].read(state);
+				obj0.unknown_0x20 = v207;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key208 in value) {
+		if (key208.startsWith("$")) { continue; }
+		switch (key208) {
+			case "name": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w209 = value[key208];
+				ext[0].write(state, w209);
+				break;
+			}
+			case "description": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w210 = value[key208];
+				if (typeof w210 != "object" || !w210) { throw new Error("object expected"); }
+				let hidden211 = {};
+				state.stack.push(w210);
+				state.hiddenstack.push(hidden211);
+				let w212 = w210.textvariants;
+				if (typeof w212 != "number" || w212 > 255 || w212 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w212, state.scan);
+				state.scan += 1;
+				let w213 = w210.unk0;
+				if (w213 != null) {
+					if (typeof w213 != "number" || w213 > 255 || w213 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w213, state.scan);
+					state.scan += 1;
+				}
+				let w214 = w210.descr;
+				if (w214 != null) {
+					ext[0].write(state, w214);
+				}
+				let w215 = w210.unk1;
+				if (w215 != null) {
+					if (typeof w215 != "number" || w215 > 255 || w215 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w215, state.scan);
+					state.scan += 1;
+				}
+				let w216 = w210.descr_ironman;
+				if (w216 != null) {
+					ext[0].write(state, w216);
+				}
+				let w217 = w210.gimcount2;
+				if (w217 != null) {
+					if (typeof w217 != "number" || w217 > 255 || w217 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w217, state.scan);
+					state.scan += 1;
+				}
+				let w218 = w210.descr_gim2;
+				if (w218 != null) {
+					ext[0].write(state, w218);
+				}
+				let w219 = w210.gimcount3;
+				if (w219 != null) {
+					if (typeof w219 != "number" || w219 > 255 || w219 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w219, state.scan);
+					state.scan += 1;
+				}
+				let w220 = w210.descr_gim3;
+				if (w220 != null) {
+					ext[0].write(state, w220);
+				}
+				let w221 = w210.gimcount4;
+				if (w221 != null) {
+					if (typeof w221 != "number" || w221 > 255 || w221 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w221, state.scan);
+					state.scan += 1;
+				}
+				let w222 = w210.descr_gim4;
+				if (w222 != null) {
+					ext[0].write(state, w222);
+				}
+				let w223 = w210.gimcount5;
+				if (w223 != null) {
+					if (typeof w223 != "number" || w223 > 255 || w223 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w223, state.scan);
+					state.scan += 1;
+				}
+				let w224 = w210.descr_gim5;
+				if (w224 != null) {
+					ext[0].write(state, w224);
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "category": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w225 = value[key208];
+				if (typeof w225 != "number" || w225 > 65535 || w225 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w225, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "spriteId": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w226 = value[key208];
+				ext[1].write(state, w226);
+				break;
+			}
+			case "runescore": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w227 = value[key208];
+				if (typeof w227 != "number" || w227 > 255 || w227 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w227, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0x06": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w228 = value[key208];
+				if (typeof w228 != "number" || w228 > 65535 || w228 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w228, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "rewardtext": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w229 = value[key208];
+				ext[0].write(state, w229);
+				break;
+			}
+			case "subach_skills": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w230 = value[key208];
+				if (!Array.isArray(w230)) { throw new Error("array expected"); }
+				let w231 = w230.length;
+				ext[2].write(state, w231);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w230.length });
+				for (let i232 = 0; i232 < w230.length; i232++) {
+					let w233 = w230[i232];
+					if (typeof w233 != "object" || !w233) { throw new Error("object expected"); }
+					let hidden234 = {};
+					state.stack.push(w233);
+					state.hiddenstack.push(hidden234);
+					let w235 = w233.ironman;
+					if (typeof w235 != "number" || w235 > 255 || w235 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w235, state.scan);
+					state.scan += 1;
+					let w236 = w233.level;
+					if (typeof w236 != "number" || w236 > 255 || w236 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w236, state.scan);
+					state.scan += 1;
+					let w237 = w233.text;
+					ext[0].write(state, w237);
+					let w238 = w233.unk_0;
+					if (typeof w238 != "number" || w238 > 255 || w238 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w238, state.scan);
+					state.scan += 1;
+					let w239 = w233.unk_1;
+					if (typeof w239 != "number" || w239 > 255 || w239 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w239, state.scan);
+					state.scan += 1;
+					let w240 = w233.skill;
+					if (typeof w240 != "number" || w240 > 255 || w240 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w240, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "subach_varbits": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w241 = value[key208];
+				if (!Array.isArray(w241)) { throw new Error("array expected"); }
+				let w242 = w241.length;
+				ext[2].write(state, w242);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w241.length });
+				for (let i243 = 0; i243 < w241.length; i243++) {
+					let w244 = w241[i243];
+					if (typeof w244 != "object" || !w244) { throw new Error("object expected"); }
+					let hidden245 = {};
+					state.stack.push(w244);
+					state.hiddenstack.push(hidden245);
+					let w246 = w244.type;
+					if (typeof w246 != "number" || w246 > 255 || w246 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w246, state.scan);
+					state.scan += 1;
+					let w247 = w244.value;
+					ext[1].write(state, w247);
+					let w248 = w244.name;
+					ext[0].write(state, w248);
+					let w249 = w244.stepsize;
+					if (typeof w249 != "number" || w249 > 255 || w249 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w249, state.scan);
+					state.scan += 1;
+					let w250 = w244.varbit;
+					if (typeof w250 != "number" || w250 > 65535 || w250 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w250, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "varbit_partial_state": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w251 = value[key208];
+				if (!Array.isArray(w251)) { throw new Error("array expected"); }
+				let w252 = w251.length;
+				ext[2].write(state, w252);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w251.length });
+				for (let i253 = 0; i253 < w251.length; i253++) {
+					let w254 = w251[i253];
+					if (typeof w254 != "object" || !w254) { throw new Error("object expected"); }
+					let hidden255 = {};
+					state.stack.push(w254);
+					state.hiddenstack.push(hidden255);
+					let w256 = w254.type;
+					if (typeof w256 != "number" || w256 > 255 || w256 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w256, state.scan);
+					state.scan += 1;
+					let w257 = w254.value;
+					ext[1].write(state, w257);
+					let w258 = w254.name;
+					ext[0].write(state, w258);
+					let w259 = w254.stepsize;
+					if (typeof w259 != "number" || w259 > 255 || w259 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w259, state.scan);
+					state.scan += 1;
+					let w260 = w254.varbit;
+					if (typeof w260 != "number" || w260 > 65535 || w260 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w260, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "previous_achievements": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w261 = value[key208];
+				if (!Array.isArray(w261)) { throw new Error("array expected"); }
+				let w262 = w261.length;
+				ext[2].write(state, w262);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w261.length });
+				for (let i263 = 0; i263 < w261.length; i263++) {
+					let w264 = w261[i263];
+					ext[3].write(state, w264);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "skill_reqs_2": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w265 = value[key208];
+				if (!Array.isArray(w265)) { throw new Error("array expected"); }
+				let w266 = w265.length;
+				ext[2].write(state, w266);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w265.length });
+				for (let i267 = 0; i267 < w265.length; i267++) {
+					let w268 = w265[i267];
+					if (typeof w268 != "object" || !w268) { throw new Error("object expected"); }
+					let hidden269 = {};
+					state.stack.push(w268);
+					state.hiddenstack.push(hidden269);
+					let w270 = w268.unk0;
+					if (typeof w270 != "number" || w270 > 255 || w270 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w270, state.scan);
+					state.scan += 1;
+					let w271 = w268.level;
+					if (typeof w271 != "number" || w271 > 255 || w271 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w271, state.scan);
+					state.scan += 1;
+					let w272 = w268.name;
+					ext[0].write(state, w272);
+					let w273 = w268.unk1;
+					if (typeof w273 != "number" || w273 > 255 || w273 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w273, state.scan);
+					state.scan += 1;
+					let w274 = w268.skill;
+					if (typeof w274 != "number" || w274 > 65535 || w274 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w274, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "progress_states": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w275 = value[key208];
+				if (!Array.isArray(w275)) { throw new Error("array expected"); }
+				let w276 = w275.length;
+				ext[2].write(state, w276);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w275.length });
+				for (let i277 = 0; i277 < w275.length; i277++) {
+					let w278 = w275[i277];
+					if (typeof w278 != "object" || !w278) { throw new Error("object expected"); }
+					let hidden279 = {};
+					state.stack.push(w278);
+					state.hiddenstack.push(hidden279);
+					let w280 = w278.unk0;
+					if (typeof w280 != "number" || w280 > 255 || w280 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w280, state.scan);
+					state.scan += 1;
+					let w281 = w278.value;
+					ext[1].write(state, w281);
+					let w282 = w278.name;
+					ext[0].write(state, w282);
+					let w283 = w278.varbits;
+					if (!Array.isArray(w283)) { throw new Error("array expected"); }
+					let w284 = w283.length;
+					ext[2].write(state, w284);
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w283.length });
+					for (let i285 = 0; i285 < w283.length; i285++) {
+						let w286 = w283[i285];
+						if (typeof w286 != "number" || w286 > 65535 || w286 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w286, state.scan);
+						state.scan += 2;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "subreqs": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w287 = value[key208];
+				if (!Array.isArray(w287)) { throw new Error("array expected"); }
+				let w288 = w287.length;
+				ext[2].write(state, w288);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w287.length });
+				for (let i289 = 0; i289 < w287.length; i289++) {
+					let w290 = w287[i289];
+					if (typeof w290 != "object" || !w290) { throw new Error("object expected"); }
+					let hidden291 = {};
+					state.stack.push(w290);
+					state.hiddenstack.push(hidden291);
+					let w292 = w290.unk0;
+					if (typeof w292 != "number" || w292 > 255 || w292 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w292, state.scan);
+					state.scan += 1;
+					let w293 = w290.value;
+					ext[1].write(state, w293);
+					let w294 = w290.name;
+					ext[0].write(state, w294);
+					let w295 = w290.varbits;
+					if (!Array.isArray(w295)) { throw new Error("array expected"); }
+					let w296 = w295.length;
+					ext[2].write(state, w296);
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w295.length });
+					for (let i297 = 0; i297 < w295.length; i297++) {
+						let w298 = w295[i297];
+						if (typeof w298 != "number" || w298 > 65535 || w298 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w298, state.scan);
+						state.scan += 2;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "sub_achievements": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w299 = value[key208];
+				if (!Array.isArray(w299)) { throw new Error("array expected"); }
+				let w300 = w299.length;
+				ext[2].write(state, w300);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w299.length });
+				for (let i301 = 0; i301 < w299.length; i301++) {
+					let w302 = w299[i301];
+					if (typeof w302 != "object" || !w302) { throw new Error("object expected"); }
+					let hidden303 = {};
+					state.stack.push(w302);
+					state.hiddenstack.push(hidden303);
+					let w304 = w302.unk0;
+					if (typeof w304 != "number" || w304 > 255 || w304 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w304, state.scan);
+					state.scan += 1;
+					let w305 = w302.achievement;
+					if (typeof w305 != "number" || w305 > 65535 || w305 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w305, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "subcategory": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w306 = value[key208];
+				if (typeof w306 != "number" || w306 > 65535 || w306 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w306, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "removed": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w307 = value[key208];
+				if (w307 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "hidden": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w308 = value[key208];
+				if (typeof w308 != "number" || w308 > 255 || w308 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w308, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "f2p": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w309 = value[key208];
+				if (w309 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "quest_req_for_miniquests": {
+				if (typeof 20 != "number" || 20 > 255 || 20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(20, state.scan);
+				state.scan += 1;
+				let w310 = value[key208];
+				if (!Array.isArray(w310)) { throw new Error("array expected"); }
+				let w311 = w310.length;
+				ext[2].write(state, w311);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w310.length });
+				for (let i312 = 0; i312 < w310.length; i312++) {
+					let w313 = w310[i312];
+					ext[3].write(state, w313);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "quest_ids": {
+				if (typeof 21 != "number" || 21 > 255 || 21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(21, state.scan);
+				state.scan += 1;
+				let w314 = value[key208];
+				if (!Array.isArray(w314)) { throw new Error("array expected"); }
+				let w315 = w314.length;
+				ext[2].write(state, w315);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w314.length });
+				for (let i316 = 0; i316 < w314.length; i316++) {
+					let w317 = w314[i316];
+					ext[3].write(state, w317);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "reqs23": {
+				if (typeof 23 != "number" || 23 > 255 || 23 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(23, state.scan);
+				state.scan += 1;
+				let w318 = value[key208];
+				if (!Array.isArray(w318)) { throw new Error("array expected"); }
+				let w319 = w318.length;
+				ext[2].write(state, w319);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w318.length });
+				for (let i320 = 0; i320 < w318.length; i320++) {
+					let w321 = w318[i320];
+					if (typeof w321 != "object" || !w321) { throw new Error("object expected"); }
+					let hidden322 = {};
+					state.stack.push(w321);
+					state.hiddenstack.push(hidden322);
+					let w323 = w321.type;
+					if (typeof w323 != "number" || w323 > 255 || w323 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w323, state.scan);
+					state.scan += 1;
+					let w324 = w321.varbit;
+					if (typeof w324 != "number" || w324 > 65535 || w324 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w324, state.scan);
+					state.scan += 2;
+					let w325 = w321.stepsize;
+					if (typeof w325 != "number" || w325 > 255 || w325 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w325, state.scan);
+					state.scan += 1;
+					let w326 = w321.name;
+					if (w326 != null) {
+						ext[0].write(state, w326);
+					}
+					let w327 = w321.requirement;
+					if (w327 != null) {
+						if (typeof w327 != "number" || w327 > 65535 || w327 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w327, state.scan);
+						state.scan += 2;
+					}
+					let w328 = w321.subbit;
+					if (typeof w328 != "number" || w328 > 255 || w328 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w328, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "reqs25": {
+				if (typeof 25 != "number" || 25 > 255 || 25 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(25, state.scan);
+				state.scan += 1;
+				let w329 = value[key208];
+				if (!Array.isArray(w329)) { throw new Error("array expected"); }
+				let w330 = w329.length;
+				ext[2].write(state, w330);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w329.length });
+				for (let i331 = 0; i331 < w329.length; i331++) {
+					let w332 = w329[i331];
+					if (typeof w332 != "object" || !w332) { throw new Error("object expected"); }
+					let hidden333 = {};
+					state.stack.push(w332);
+					state.hiddenstack.push(hidden333);
+					let w334 = w332.type;
+					if (typeof w334 != "number" || w334 > 255 || w334 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w334, state.scan);
+					state.scan += 1;
+					let w335 = w332.varbit;
+					if (typeof w335 != "number" || w335 > 65535 || w335 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w335, state.scan);
+					state.scan += 2;
+					let w336 = w332.value;
+					if (typeof w336 != "number" || w336 > 255 || w336 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w336, state.scan);
+					state.scan += 1;
+					let w337 = w332.name;
+					if (w337 != null) {
+						ext[0].write(state, w337);
+					}
+					let w338 = w332.requirement;
+					if (w338 != null) {
+						if (typeof w338 != "number" || w338 > 65535 || w338 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w338, state.scan);
+						state.scan += 2;
+					}
+					let w339 = w332.subbit;
+					if (typeof w339 != "number" || w339 > 255 || w339 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w339, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "dbrow": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w340 = value[key208];
+				if (typeof w340 != "number" || w340 > 65535 || w340 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w340, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_0x1B": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w341 = value[key208];
+				if (w341 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "skill_req_count": {
+				if (typeof 28 != "number" || 28 > 255 || 28 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(28, state.scan);
+				state.scan += 1;
+				let w342 = value[key208];
+				if (!Array.isArray(w342)) { throw new Error("array expected"); }
+				let w343 = w342.length;
+				ext[2].write(state, w343);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w342.length });
+				for (let i344 = 0; i344 < w342.length; i344++) {
+					let w345 = w342[i344];
+					if (typeof w345 != "number" || w345 > 255 || w345 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w345, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0x1D": {
+				if (typeof 29 != "number" || 29 > 255 || 29 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(29, state.scan);
+				state.scan += 1;
+				let w346 = value[key208];
+				if (typeof w346 != "number" || w346 > 255 || w346 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w346, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "subreq_count": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w347 = value[key208];
+				if (!Array.isArray(w347)) { throw new Error("array expected"); }
+				let w348 = w347.length;
+				ext[2].write(state, w348);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w347.length });
+				for (let i349 = 0; i349 < w347.length; i349++) {
+					let w350 = w347[i349];
+					ext[2].write(state, w350);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0x1F": {
+				if (typeof 31 != "number" || 31 > 255 || 31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(31, state.scan);
+				state.scan += 1;
+				let w351 = value[key208];
+				if (typeof w351 != "number" || w351 > 255 || w351 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w351, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0x20": {
+				if (typeof 32 != "number" || 32 > 255 || 32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(32, state.scan);
+				state.scan += 1;
+				let w352 = value[key208];
+				ext[3].write(state, w352);
+				break;
+			}
+			default: throw new Error("unknown property " + key208);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1552 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\animgroupconfigs.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd27fb1da;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let obj3 = {};
+				let hidden4 = {};
+				state.stack.push(obj3);
+				state.hiddenstack.push(hidden4);
+				let hidden5 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden5);
+				let v6 = ext[0].read(state);
+				hidden5.$opcode = v6;
+				let ref7 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match8 = -1;
+				if (ref7 >= 670) { match8 = 0; }
+				else if (ref7 >= 0) { match8 = 1; }
+				if (match8 == -1) { throw new Error("no opcode matched"); }
+				let v9;
+				if (match8 == 0) {
+					let v10 = ext[1].read(state);
+					v9 = v10;
+				}
+				else if (match8 == 1) {
+					let v11 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v9 = v11;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v9 !== undefined) { obj3.idle = v9; }
+				let hidden12 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden12);
+				let v13 = ext[2].read(state);
+				hidden12.$opcode = v13;
+				let ref14 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match15 = -1;
+				if (ref14 >= 670) { match15 = 0; }
+				else if (ref14 >= 0) { match15 = 1; }
+				if (match15 == -1) { throw new Error("no opcode matched"); }
+				let v16;
+				if (match15 == 0) {
+					let v17 = ext[1].read(state);
+					v16 = v17;
+				}
+				else if (match15 == 1) {
+					let v18 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v16 = v18;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v16 !== undefined) { obj3.walk = v16; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.baseAnims = obj3;
+				break;
+			}
+			case 2: {
+				let hidden19 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden19);
+				let v20 = ext[3].read(state);
+				hidden19.$opcode = v20;
+				let ref21 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match22 = -1;
+				if (ref21 >= 670) { match22 = 0; }
+				else if (ref21 >= 0) { match22 = 1; }
+				if (match22 == -1) { throw new Error("no opcode matched"); }
+				let v23;
+				if (match22 == 0) {
+					let v24 = ext[1].read(state);
+					v23 = v24;
+				}
+				else if (match22 == 1) {
+					let v25 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v23 = v25;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_02 = v23;
+				break;
+			}
+			case 3: {
+				let hidden26 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden26);
+				let v27 = ext[4].read(state);
+				hidden26.$opcode = v27;
+				let ref28 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match29 = -1;
+				if (ref28 >= 670) { match29 = 0; }
+				else if (ref28 >= 0) { match29 = 1; }
+				if (match29 == -1) { throw new Error("no opcode matched"); }
+				let v30;
+				if (match29 == 0) {
+					let v31 = ext[1].read(state);
+					v30 = v31;
+				}
+				else if (match29 == 1) {
+					let v32 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v30 = v32;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_03 = v30;
+				break;
+			}
+			case 5: {
+				let hidden33 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden33);
+				let v34 = ext[5].read(state);
+				hidden33.$opcode = v34;
+				let ref35 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match36 = -1;
+				if (ref35 >= 670) { match36 = 0; }
+				else if (ref35 >= 0) { match36 = 1; }
+				if (match36 == -1) { throw new Error("no opcode matched"); }
+				let v37;
+				if (match36 == 0) {
+					let v38 = ext[1].read(state);
+					v37 = v38;
+				}
+				else if (match36 == 1) {
+					let v39 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v37 = v39;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_05 = v37;
+				break;
+			}
+			case 4: {
+				let hidden40 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden40);
+				let v41 = ext[6].read(state);
+				hidden40.$opcode = v41;
+				let ref42 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match43 = -1;
+				if (ref42 >= 670) { match43 = 0; }
+				else if (ref42 >= 0) { match43 = 1; }
+				if (match43 == -1) { throw new Error("no opcode matched"); }
+				let v44;
+				if (match43 == 0) {
+					let v45 = ext[1].read(state);
+					v44 = v45;
+				}
+				else if (match43 == 1) {
+					let v46 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v44 = v46;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_04 = v44;
+				break;
+			}
+			case 6: {
+				let hidden47 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden47);
+				let v48 = ext[7].read(state);
+				hidden47.$opcode = v48;
+				let ref49 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match50 = -1;
+				if (ref49 >= 670) { match50 = 0; }
+				else if (ref49 >= 0) { match50 = 1; }
+				if (match50 == -1) { throw new Error("no opcode matched"); }
+				let v51;
+				if (match50 == 0) {
+					let v52 = ext[1].read(state);
+					v51 = v52;
+				}
+				else if (match50 == 1) {
+					let v53 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v51 = v53;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.run = v51;
+				break;
+			}
+			case 7: {
+				let hidden54 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden54);
+				let v55 = ext[8].read(state);
+				hidden54.$opcode = v55;
+				let ref56 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match57 = -1;
+				if (ref56 >= 670) { match57 = 0; }
+				else if (ref56 >= 0) { match57 = 1; }
+				if (match57 == -1) { throw new Error("no opcode matched"); }
+				let v58;
+				if (match57 == 0) {
+					let v59 = ext[1].read(state);
+					v58 = v59;
+				}
+				else if (match57 == 1) {
+					let v60 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v58 = v60;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_07 = v58;
+				break;
+			}
+			case 8: {
+				let hidden61 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden61);
+				let v62 = ext[9].read(state);
+				hidden61.$opcode = v62;
+				let ref63 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match64 = -1;
+				if (ref63 >= 670) { match64 = 0; }
+				else if (ref63 >= 0) { match64 = 1; }
+				if (match64 == -1) { throw new Error("no opcode matched"); }
+				let v65;
+				if (match64 == 0) {
+					let v66 = ext[1].read(state);
+					v65 = v66;
+				}
+				else if (match64 == 1) {
+					let v67 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v65 = v67;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_08 = v65;
+				break;
+			}
+			case 9: {
+				let hidden68 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden68);
+				let v69 = ext[10].read(state);
+				hidden68.$opcode = v69;
+				let ref70 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match71 = -1;
+				if (ref70 >= 670) { match71 = 0; }
+				else if (ref70 >= 0) { match71 = 1; }
+				if (match71 == -1) { throw new Error("no opcode matched"); }
+				let v72;
+				if (match71 == 0) {
+					let v73 = ext[1].read(state);
+					v72 = v73;
+				}
+				else if (match71 == 1) {
+					let v74 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v72 = v74;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_09 = v72;
+				break;
+			}
+			case 26: {
+				let v75 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v76 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr77 = [v75, v76];
+				obj0.unknown_1a = arr77;
+				break;
+			}
+			case 27: {
+				let hidden78 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden78);
+				let v79 = ext[11].read(state);
+				hidden78.$opcode = v79;
+				let ref80 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match81 = -1;
+				if (ref80 >= 670) { match81 = 0; }
+				else if (ref80 >= 0) { match81 = 1; }
+				if (match81 == -1) { throw new Error("no opcode matched"); }
+				let v82;
+				if (match81 == 0) {
+					let v83 = ext[1].read(state);
+					v82 = v83;
+				}
+				else if (match81 == 1) {
+					let v84 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v82 = v84;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_1b = v82;
+				break;
+			}
+			case 38: {
+				let hidden85 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden85);
+				let v86 = ext[12].read(state);
+				hidden85.$opcode = v86;
+				let ref87 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match88 = -1;
+				if (ref87 >= 670) { match88 = 0; }
+				else if (ref87 >= 0) { match88 = 1; }
+				if (match88 == -1) { throw new Error("no opcode matched"); }
+				let v89;
+				if (match88 == 0) {
+					let v90 = ext[1].read(state);
+					v89 = v90;
+				}
+				else if (match88 == 1) {
+					let v91 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v89 = v91;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.turnonspot1 = v89;
+				break;
+			}
+			case 39: {
+				let hidden92 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden92);
+				let v93 = ext[13].read(state);
+				hidden92.$opcode = v93;
+				let ref94 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match95 = -1;
+				if (ref94 >= 670) { match95 = 0; }
+				else if (ref94 >= 0) { match95 = 1; }
+				if (match95 == -1) { throw new Error("no opcode matched"); }
+				let v96;
+				if (match95 == 0) {
+					let v97 = ext[1].read(state);
+					v96 = v97;
+				}
+				else if (match95 == 1) {
+					let v98 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v96 = v98;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.turnonspot2 = v96;
+				break;
+			}
+			case 40: {
+				let hidden99 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden99);
+				let v100 = ext[14].read(state);
+				hidden99.$opcode = v100;
+				let ref101 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match102 = -1;
+				if (ref101 >= 670) { match102 = 0; }
+				else if (ref101 >= 0) { match102 = 1; }
+				if (match102 == -1) { throw new Error("no opcode matched"); }
+				let v103;
+				if (match102 == 0) {
+					let v104 = ext[1].read(state);
+					v103 = v104;
+				}
+				else if (match102 == 1) {
+					let v105 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v103 = v105;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.walk_back = v103;
+				break;
+			}
+			case 41: {
+				let hidden106 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden106);
+				let v107 = ext[15].read(state);
+				hidden106.$opcode = v107;
+				let ref108 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match109 = -1;
+				if (ref108 >= 670) { match109 = 0; }
+				else if (ref108 >= 0) { match109 = 1; }
+				if (match109 == -1) { throw new Error("no opcode matched"); }
+				let v110;
+				if (match109 == 0) {
+					let v111 = ext[1].read(state);
+					v110 = v111;
+				}
+				else if (match109 == 1) {
+					let v112 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v110 = v112;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.walk_left = v110;
+				break;
+			}
+			case 42: {
+				let hidden113 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden113);
+				let v114 = ext[16].read(state);
+				hidden113.$opcode = v114;
+				let ref115 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match116 = -1;
+				if (ref115 >= 670) { match116 = 0; }
+				else if (ref115 >= 0) { match116 = 1; }
+				if (match116 == -1) { throw new Error("no opcode matched"); }
+				let v117;
+				if (match116 == 0) {
+					let v118 = ext[1].read(state);
+					v117 = v118;
+				}
+				else if (match116 == 1) {
+					let v119 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v117 = v119;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.walk_right = v117;
+				break;
+			}
+			case 43: {
+				let hidden120 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden120);
+				let v121 = ext[17].read(state);
+				hidden120.$opcode = v121;
+				let ref122 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match123 = -1;
+				if (ref122 >= 670) { match123 = 0; }
+				else if (ref122 >= 0) { match123 = 1; }
+				if (match123 == -1) { throw new Error("no opcode matched"); }
+				let v124;
+				if (match123 == 0) {
+					let v125 = ext[1].read(state);
+					v124 = v125;
+				}
+				else if (match123 == 1) {
+					let v126 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v124 = v126;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_2b = v124;
+				break;
+			}
+			case 44: {
+				let hidden127 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden127);
+				let v128 = ext[18].read(state);
+				hidden127.$opcode = v128;
+				let ref129 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match130 = -1;
+				if (ref129 >= 670) { match130 = 0; }
+				else if (ref129 >= 0) { match130 = 1; }
+				if (match130 == -1) { throw new Error("no opcode matched"); }
+				let v131;
+				if (match130 == 0) {
+					let v132 = ext[1].read(state);
+					v131 = v132;
+				}
+				else if (match130 == 1) {
+					let v133 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v131 = v133;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_2c = v131;
+				break;
+			}
+			case 45: {
+				let hidden134 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden134);
+				let v135 = ext[19].read(state);
+				hidden134.$opcode = v135;
+				let ref136 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match137 = -1;
+				if (ref136 >= 670) { match137 = 0; }
+				else if (ref136 >= 0) { match137 = 1; }
+				if (match137 == -1) { throw new Error("no opcode matched"); }
+				let v138;
+				if (match137 == 0) {
+					let v139 = ext[1].read(state);
+					v138 = v139;
+				}
+				else if (match137 == 1) {
+					let v140 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v138 = v140;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_2d = v138;
+				break;
+			}
+			case 46: {
+				let hidden141 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden141);
+				let v142 = ext[20].read(state);
+				hidden141.$opcode = v142;
+				let ref143 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match144 = -1;
+				if (ref143 >= 670) { match144 = 0; }
+				else if (ref143 >= 0) { match144 = 1; }
+				if (match144 == -1) { throw new Error("no opcode matched"); }
+				let v145;
+				if (match144 == 0) {
+					let v146 = ext[1].read(state);
+					v145 = v146;
+				}
+				else if (match144 == 1) {
+					let v147 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v145 = v147;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_2e = v145;
+				break;
+			}
+			case 47: {
+				let hidden148 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden148);
+				let v149 = ext[21].read(state);
+				hidden148.$opcode = v149;
+				let ref150 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match151 = -1;
+				if (ref150 >= 670) { match151 = 0; }
+				else if (ref150 >= 0) { match151 = 1; }
+				if (match151 == -1) { throw new Error("no opcode matched"); }
+				let v152;
+				if (match151 == 0) {
+					let v153 = ext[1].read(state);
+					v152 = v153;
+				}
+				else if (match151 == 1) {
+					let v154 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v152 = v154;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_2f = v152;
+				break;
+			}
+			case 48: {
+				let hidden155 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden155);
+				let v156 = ext[22].read(state);
+				hidden155.$opcode = v156;
+				let ref157 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match158 = -1;
+				if (ref157 >= 670) { match158 = 0; }
+				else if (ref157 >= 0) { match158 = 1; }
+				if (match158 == -1) { throw new Error("no opcode matched"); }
+				let v159;
+				if (match158 == 0) {
+					let v160 = ext[1].read(state);
+					v159 = v160;
+				}
+				else if (match158 == 1) {
+					let v161 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v159 = v161;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_30 = v159;
+				break;
+			}
+			case 49: {
+				let hidden162 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden162);
+				let v163 = ext[23].read(state);
+				hidden162.$opcode = v163;
+				let ref164 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match165 = -1;
+				if (ref164 >= 670) { match165 = 0; }
+				else if (ref164 >= 0) { match165 = 1; }
+				if (match165 == -1) { throw new Error("no opcode matched"); }
+				let v166;
+				if (match165 == 0) {
+					let v167 = ext[1].read(state);
+					v166 = v167;
+				}
+				else if (match165 == 1) {
+					let v168 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v166 = v168;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_31 = v166;
+				break;
+			}
+			case 50: {
+				let hidden169 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden169);
+				let v170 = ext[24].read(state);
+				hidden169.$opcode = v170;
+				let ref171 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match172 = -1;
+				if (ref171 >= 670) { match172 = 0; }
+				else if (ref171 >= 0) { match172 = 1; }
+				if (match172 == -1) { throw new Error("no opcode matched"); }
+				let v173;
+				if (match172 == 0) {
+					let v174 = ext[1].read(state);
+					v173 = v174;
+				}
+				else if (match172 == 1) {
+					let v175 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v173 = v175;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_32 = v173;
+				break;
+			}
+			case 51: {
+				let hidden176 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden176);
+				let v177 = ext[25].read(state);
+				hidden176.$opcode = v177;
+				let ref178 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match179 = -1;
+				if (ref178 >= 670) { match179 = 0; }
+				else if (ref178 >= 0) { match179 = 1; }
+				if (match179 == -1) { throw new Error("no opcode matched"); }
+				let v180;
+				if (match179 == 0) {
+					let v181 = ext[1].read(state);
+					v180 = v181;
+				}
+				else if (match179 == 1) {
+					let v182 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v180 = v182;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_33 = v180;
+				break;
+			}
+			case 52: {
+				let v183 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden184 = { $index: 0, $length: v183 };
+				state.hiddenstack.push(hidden184);
+				state.stack.push({});
+				let arr185 = [];
+				for (let i186 = 0; i186 < v183; i186++) {
+					hidden184.$index = i186;
+					let obj187 = {};
+					let hidden188 = {};
+					state.stack.push(obj187);
+					state.hiddenstack.push(hidden188);
+					let hidden189 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden189);
+					let v190 = ext[26].read(state);
+					hidden189.$opcode = v190;
+					let ref191 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match192 = -1;
+					if (ref191 >= 670) { match192 = 0; }
+					else if (ref191 >= 0) { match192 = 1; }
+					if (match192 == -1) { throw new Error("no opcode matched"); }
+					let v193;
+					if (match192 == 0) {
+						let v194 = ext[1].read(state);
+						v193 = v194;
+					}
+					else if (match192 == 1) {
+						let v195 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v193 = v195;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v193 !== undefined) { obj187.animid = v193; }
+					let v196 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v196 !== undefined) { obj187.weight = v196; }
+					let hidden197 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden197);
+					let v198 = ext[27].read(state);
+					hidden197.$opcode = v198;
+					let ref199 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match200 = -1;
+					if (ref199 >= 916) { match200 = 0; }
+					else if (true) { match200 = 1; }
+					if (match200 == -1) { throw new Error("no opcode matched"); }
+					let v201;
+					if (match200 == 0) {
+						let v202 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v201 = v202;
+					}
+					else if (match200 == 1) {
+						v201 = 0;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v201 !== undefined) { obj187.always0 = v201; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr185.push(obj187);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.idleVariations = arr185;
+				break;
+			}
+			case 53: {
+				obj0.unknown_35 = true;
+				break;
+			}
+			case 54: {
+				let v203 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v204 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr205 = [v203, v204];
+				obj0.unknown_36 = arr205;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key206 in value) {
+		if (key206.startsWith("$")) { continue; }
+		switch (key206) {
+			case "baseAnims": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w207 = value[key206];
+				if (typeof w207 != "object" || !w207) { throw new Error("object expected"); }
+				let hidden208 = {};
+				state.stack.push(w207);
+				state.hiddenstack.push(hidden208);
+				let w209 = w207.idle;
+				let hidden210 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden210);
+				hidden210.$opcode = ext[0].readConst(state);
+				let ref211 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match212 = -1;
+				if (ref211 >= 670) { match212 = 0; }
+				else if (ref211 >= 0) { match212 = 1; }
+				if (match212 == -1) { throw new Error("no opcode matched"); }
+				if (match212 == 0) {
+					ext[1].write(state, w209);
+				}
+				else if (match212 == 1) {
+					if (typeof w209 != "number" || w209 > 65535 || w209 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w209, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let w213 = w207.walk;
+				let hidden214 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden214);
+				hidden214.$opcode = ext[2].readConst(state);
+				let ref215 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match216 = -1;
+				if (ref215 >= 670) { match216 = 0; }
+				else if (ref215 >= 0) { match216 = 1; }
+				if (match216 == -1) { throw new Error("no opcode matched"); }
+				if (match216 == 0) {
+					ext[1].write(state, w213);
+				}
+				else if (match216 == 1) {
+					if (typeof w213 != "number" || w213 > 65535 || w213 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w213, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_02": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w217 = value[key206];
+				let hidden218 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden218);
+				hidden218.$opcode = ext[3].readConst(state);
+				let ref219 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match220 = -1;
+				if (ref219 >= 670) { match220 = 0; }
+				else if (ref219 >= 0) { match220 = 1; }
+				if (match220 == -1) { throw new Error("no opcode matched"); }
+				if (match220 == 0) {
+					ext[1].write(state, w217);
+				}
+				else if (match220 == 1) {
+					if (typeof w217 != "number" || w217 > 65535 || w217 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w217, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_03": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w221 = value[key206];
+				let hidden222 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden222);
+				hidden222.$opcode = ext[4].readConst(state);
+				let ref223 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match224 = -1;
+				if (ref223 >= 670) { match224 = 0; }
+				else if (ref223 >= 0) { match224 = 1; }
+				if (match224 == -1) { throw new Error("no opcode matched"); }
+				if (match224 == 0) {
+					ext[1].write(state, w221);
+				}
+				else if (match224 == 1) {
+					if (typeof w221 != "number" || w221 > 65535 || w221 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w221, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w225 = value[key206];
+				let hidden226 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden226);
+				hidden226.$opcode = ext[5].readConst(state);
+				let ref227 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match228 = -1;
+				if (ref227 >= 670) { match228 = 0; }
+				else if (ref227 >= 0) { match228 = 1; }
+				if (match228 == -1) { throw new Error("no opcode matched"); }
+				if (match228 == 0) {
+					ext[1].write(state, w225);
+				}
+				else if (match228 == 1) {
+					if (typeof w225 != "number" || w225 > 65535 || w225 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w225, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w229 = value[key206];
+				let hidden230 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden230);
+				hidden230.$opcode = ext[6].readConst(state);
+				let ref231 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match232 = -1;
+				if (ref231 >= 670) { match232 = 0; }
+				else if (ref231 >= 0) { match232 = 1; }
+				if (match232 == -1) { throw new Error("no opcode matched"); }
+				if (match232 == 0) {
+					ext[1].write(state, w229);
+				}
+				else if (match232 == 1) {
+					if (typeof w229 != "number" || w229 > 65535 || w229 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w229, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "run": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w233 = value[key206];
+				let hidden234 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden234);
+				hidden234.$opcode = ext[7].readConst(state);
+				let ref235 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match236 = -1;
+				if (ref235 >= 670) { match236 = 0; }
+				else if (ref235 >= 0) { match236 = 1; }
+				if (match236 == -1) { throw new Error("no opcode matched"); }
+				if (match236 == 0) {
+					ext[1].write(state, w233);
+				}
+				else if (match236 == 1) {
+					if (typeof w233 != "number" || w233 > 65535 || w233 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w233, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_07": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w237 = value[key206];
+				let hidden238 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden238);
+				hidden238.$opcode = ext[8].readConst(state);
+				let ref239 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match240 = -1;
+				if (ref239 >= 670) { match240 = 0; }
+				else if (ref239 >= 0) { match240 = 1; }
+				if (match240 == -1) { throw new Error("no opcode matched"); }
+				if (match240 == 0) {
+					ext[1].write(state, w237);
+				}
+				else if (match240 == 1) {
+					if (typeof w237 != "number" || w237 > 65535 || w237 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w237, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w241 = value[key206];
+				let hidden242 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden242);
+				hidden242.$opcode = ext[9].readConst(state);
+				let ref243 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match244 = -1;
+				if (ref243 >= 670) { match244 = 0; }
+				else if (ref243 >= 0) { match244 = 1; }
+				if (match244 == -1) { throw new Error("no opcode matched"); }
+				if (match244 == 0) {
+					ext[1].write(state, w241);
+				}
+				else if (match244 == 1) {
+					if (typeof w241 != "number" || w241 > 65535 || w241 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w241, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_09": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w245 = value[key206];
+				let hidden246 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden246);
+				hidden246.$opcode = ext[10].readConst(state);
+				let ref247 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match248 = -1;
+				if (ref247 >= 670) { match248 = 0; }
+				else if (ref247 >= 0) { match248 = 1; }
+				if (match248 == -1) { throw new Error("no opcode matched"); }
+				if (match248 == 0) {
+					ext[1].write(state, w245);
+				}
+				else if (match248 == 1) {
+					if (typeof w245 != "number" || w245 > 65535 || w245 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w245, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_1a": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w249 = value[key206];
+				if (!Array.isArray(w249)) { throw new Error("array expected"); }
+				let w250 = w249[0];
+				if (typeof w250 != "number" || w250 > 255 || w250 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w250, state.scan);
+				state.scan += 1;
+				let w251 = w249[1];
+				if (typeof w251 != "number" || w251 > 255 || w251 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w251, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_1b": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w252 = value[key206];
+				let hidden253 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden253);
+				hidden253.$opcode = ext[11].readConst(state);
+				let ref254 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match255 = -1;
+				if (ref254 >= 670) { match255 = 0; }
+				else if (ref254 >= 0) { match255 = 1; }
+				if (match255 == -1) { throw new Error("no opcode matched"); }
+				if (match255 == 0) {
+					ext[1].write(state, w252);
+				}
+				else if (match255 == 1) {
+					if (typeof w252 != "number" || w252 > 65535 || w252 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w252, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "turnonspot1": {
+				if (typeof 38 != "number" || 38 > 255 || 38 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(38, state.scan);
+				state.scan += 1;
+				let w256 = value[key206];
+				let hidden257 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden257);
+				hidden257.$opcode = ext[12].readConst(state);
+				let ref258 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match259 = -1;
+				if (ref258 >= 670) { match259 = 0; }
+				else if (ref258 >= 0) { match259 = 1; }
+				if (match259 == -1) { throw new Error("no opcode matched"); }
+				if (match259 == 0) {
+					ext[1].write(state, w256);
+				}
+				else if (match259 == 1) {
+					if (typeof w256 != "number" || w256 > 65535 || w256 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w256, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "turnonspot2": {
+				if (typeof 39 != "number" || 39 > 255 || 39 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(39, state.scan);
+				state.scan += 1;
+				let w260 = value[key206];
+				let hidden261 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden261);
+				hidden261.$opcode = ext[13].readConst(state);
+				let ref262 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match263 = -1;
+				if (ref262 >= 670) { match263 = 0; }
+				else if (ref262 >= 0) { match263 = 1; }
+				if (match263 == -1) { throw new Error("no opcode matched"); }
+				if (match263 == 0) {
+					ext[1].write(state, w260);
+				}
+				else if (match263 == 1) {
+					if (typeof w260 != "number" || w260 > 65535 || w260 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w260, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "walk_back": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w264 = value[key206];
+				let hidden265 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden265);
+				hidden265.$opcode = ext[14].readConst(state);
+				let ref266 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match267 = -1;
+				if (ref266 >= 670) { match267 = 0; }
+				else if (ref266 >= 0) { match267 = 1; }
+				if (match267 == -1) { throw new Error("no opcode matched"); }
+				if (match267 == 0) {
+					ext[1].write(state, w264);
+				}
+				else if (match267 == 1) {
+					if (typeof w264 != "number" || w264 > 65535 || w264 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w264, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "walk_left": {
+				if (typeof 41 != "number" || 41 > 255 || 41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(41, state.scan);
+				state.scan += 1;
+				let w268 = value[key206];
+				let hidden269 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden269);
+				hidden269.$opcode = ext[15].readConst(state);
+				let ref270 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match271 = -1;
+				if (ref270 >= 670) { match271 = 0; }
+				else if (ref270 >= 0) { match271 = 1; }
+				if (match271 == -1) { throw new Error("no opcode matched"); }
+				if (match271 == 0) {
+					ext[1].write(state, w268);
+				}
+				else if (match271 == 1) {
+					if (typeof w268 != "number" || w268 > 65535 || w268 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w268, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "walk_right": {
+				if (typeof 42 != "number" || 42 > 255 || 42 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(42, state.scan);
+				state.scan += 1;
+				let w272 = value[key206];
+				let hidden273 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden273);
+				hidden273.$opcode = ext[16].readConst(state);
+				let ref274 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match275 = -1;
+				if (ref274 >= 670) { match275 = 0; }
+				else if (ref274 >= 0) { match275 = 1; }
+				if (match275 == -1) { throw new Error("no opcode matched"); }
+				if (match275 == 0) {
+					ext[1].write(state, w272);
+				}
+				else if (match275 == 1) {
+					if (typeof w272 != "number" || w272 > 65535 || w272 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w272, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_2b": {
+				if (typeof 43 != "number" || 43 > 255 || 43 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(43, state.scan);
+				state.scan += 1;
+				let w276 = value[key206];
+				let hidden277 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden277);
+				hidden277.$opcode = ext[17].readConst(state);
+				let ref278 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match279 = -1;
+				if (ref278 >= 670) { match279 = 0; }
+				else if (ref278 >= 0) { match279 = 1; }
+				if (match279 == -1) { throw new Error("no opcode matched"); }
+				if (match279 == 0) {
+					ext[1].write(state, w276);
+				}
+				else if (match279 == 1) {
+					if (typeof w276 != "number" || w276 > 65535 || w276 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w276, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_2c": {
+				if (typeof 44 != "number" || 44 > 255 || 44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(44, state.scan);
+				state.scan += 1;
+				let w280 = value[key206];
+				let hidden281 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden281);
+				hidden281.$opcode = ext[18].readConst(state);
+				let ref282 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match283 = -1;
+				if (ref282 >= 670) { match283 = 0; }
+				else if (ref282 >= 0) { match283 = 1; }
+				if (match283 == -1) { throw new Error("no opcode matched"); }
+				if (match283 == 0) {
+					ext[1].write(state, w280);
+				}
+				else if (match283 == 1) {
+					if (typeof w280 != "number" || w280 > 65535 || w280 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w280, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_2d": {
+				if (typeof 45 != "number" || 45 > 255 || 45 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(45, state.scan);
+				state.scan += 1;
+				let w284 = value[key206];
+				let hidden285 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden285);
+				hidden285.$opcode = ext[19].readConst(state);
+				let ref286 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match287 = -1;
+				if (ref286 >= 670) { match287 = 0; }
+				else if (ref286 >= 0) { match287 = 1; }
+				if (match287 == -1) { throw new Error("no opcode matched"); }
+				if (match287 == 0) {
+					ext[1].write(state, w284);
+				}
+				else if (match287 == 1) {
+					if (typeof w284 != "number" || w284 > 65535 || w284 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w284, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_2e": {
+				if (typeof 46 != "number" || 46 > 255 || 46 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(46, state.scan);
+				state.scan += 1;
+				let w288 = value[key206];
+				let hidden289 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden289);
+				hidden289.$opcode = ext[20].readConst(state);
+				let ref290 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match291 = -1;
+				if (ref290 >= 670) { match291 = 0; }
+				else if (ref290 >= 0) { match291 = 1; }
+				if (match291 == -1) { throw new Error("no opcode matched"); }
+				if (match291 == 0) {
+					ext[1].write(state, w288);
+				}
+				else if (match291 == 1) {
+					if (typeof w288 != "number" || w288 > 65535 || w288 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w288, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_2f": {
+				if (typeof 47 != "number" || 47 > 255 || 47 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(47, state.scan);
+				state.scan += 1;
+				let w292 = value[key206];
+				let hidden293 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden293);
+				hidden293.$opcode = ext[21].readConst(state);
+				let ref294 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match295 = -1;
+				if (ref294 >= 670) { match295 = 0; }
+				else if (ref294 >= 0) { match295 = 1; }
+				if (match295 == -1) { throw new Error("no opcode matched"); }
+				if (match295 == 0) {
+					ext[1].write(state, w292);
+				}
+				else if (match295 == 1) {
+					if (typeof w292 != "number" || w292 > 65535 || w292 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w292, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_30": {
+				if (typeof 48 != "number" || 48 > 255 || 48 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(48, state.scan);
+				state.scan += 1;
+				let w296 = value[key206];
+				let hidden297 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden297);
+				hidden297.$opcode = ext[22].readConst(state);
+				let ref298 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match299 = -1;
+				if (ref298 >= 670) { match299 = 0; }
+				else if (ref298 >= 0) { match299 = 1; }
+				if (match299 == -1) { throw new Error("no opcode matched"); }
+				if (match299 == 0) {
+					ext[1].write(state, w296);
+				}
+				else if (match299 == 1) {
+					if (typeof w296 != "number" || w296 > 65535 || w296 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w296, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_31": {
+				if (typeof 49 != "number" || 49 > 255 || 49 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(49, state.scan);
+				state.scan += 1;
+				let w300 = value[key206];
+				let hidden301 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden301);
+				hidden301.$opcode = ext[23].readConst(state);
+				let ref302 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match303 = -1;
+				if (ref302 >= 670) { match303 = 0; }
+				else if (ref302 >= 0) { match303 = 1; }
+				if (match303 == -1) { throw new Error("no opcode matched"); }
+				if (match303 == 0) {
+					ext[1].write(state, w300);
+				}
+				else if (match303 == 1) {
+					if (typeof w300 != "number" || w300 > 65535 || w300 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w300, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_32": {
+				if (typeof 50 != "number" || 50 > 255 || 50 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(50, state.scan);
+				state.scan += 1;
+				let w304 = value[key206];
+				let hidden305 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden305);
+				hidden305.$opcode = ext[24].readConst(state);
+				let ref306 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match307 = -1;
+				if (ref306 >= 670) { match307 = 0; }
+				else if (ref306 >= 0) { match307 = 1; }
+				if (match307 == -1) { throw new Error("no opcode matched"); }
+				if (match307 == 0) {
+					ext[1].write(state, w304);
+				}
+				else if (match307 == 1) {
+					if (typeof w304 != "number" || w304 > 65535 || w304 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w304, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_33": {
+				if (typeof 51 != "number" || 51 > 255 || 51 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(51, state.scan);
+				state.scan += 1;
+				let w308 = value[key206];
+				let hidden309 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden309);
+				hidden309.$opcode = ext[25].readConst(state);
+				let ref310 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match311 = -1;
+				if (ref310 >= 670) { match311 = 0; }
+				else if (ref310 >= 0) { match311 = 1; }
+				if (match311 == -1) { throw new Error("no opcode matched"); }
+				if (match311 == 0) {
+					ext[1].write(state, w308);
+				}
+				else if (match311 == 1) {
+					if (typeof w308 != "number" || w308 > 65535 || w308 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w308, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "idleVariations": {
+				if (typeof 52 != "number" || 52 > 255 || 52 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(52, state.scan);
+				state.scan += 1;
+				let w312 = value[key206];
+				if (!Array.isArray(w312)) { throw new Error("array expected"); }
+				let w313 = w312.length;
+				if (typeof w313 != "number" || w313 > 255 || w313 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w313, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w312.length });
+				for (let i314 = 0; i314 < w312.length; i314++) {
+					let w315 = w312[i314];
+					if (typeof w315 != "object" || !w315) { throw new Error("object expected"); }
+					let hidden316 = {};
+					state.stack.push(w315);
+					state.hiddenstack.push(hidden316);
+					let w317 = w315.animid;
+					let hidden318 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden318);
+					hidden318.$opcode = ext[26].readConst(state);
+					let ref319 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match320 = -1;
+					if (ref319 >= 670) { match320 = 0; }
+					else if (ref319 >= 0) { match320 = 1; }
+					if (match320 == -1) { throw new Error("no opcode matched"); }
+					if (match320 == 0) {
+						ext[1].write(state, w317);
+					}
+					else if (match320 == 1) {
+						if (typeof w317 != "number" || w317 > 65535 || w317 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w317, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w321 = w315.weight;
+					if (typeof w321 != "number" || w321 > 255 || w321 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w321, state.scan);
+					state.scan += 1;
+					let w322 = w315.always0;
+					let hidden323 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden323);
+					hidden323.$opcode = ext[27].readConst(state);
+					let ref324 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match325 = -1;
+					if (ref324 >= 916) { match325 = 0; }
+					else if (true) { match325 = 1; }
+					if (match325 == -1) { throw new Error("no opcode matched"); }
+					if (match325 == 0) {
+						if (typeof w322 != "number" || w322 > 255 || w322 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w322, state.scan);
+						state.scan += 1;
+					}
+					else if (match325 == 1) {
+						if (w322 != 0) { throw new Error("expected constant 0 was not present during write"); }
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_35": {
+				if (typeof 53 != "number" || 53 > 255 || 53 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(53, state.scan);
+				state.scan += 1;
+				let w326 = value[key206];
+				if (w326 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_36": {
+				if (typeof 54 != "number" || 54 > 255 || 54 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(54, state.scan);
+				state.scan += 1;
+				let w327 = value[key206];
+				if (!Array.isArray(w327)) { throw new Error("array expected"); }
+				let w328 = w327[0];
+				if (typeof w328 != "number" || w328 > 255 || w328 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w328, state.scan);
+				state.scan += 1;
+				let w329 = w327[1];
+				if (typeof w329 != "number" || w329 > 255 || w329 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w329, state.scan);
+				state.scan += 1;
+				break;
+			}
+			default: throw new Error("unknown property " + key206);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
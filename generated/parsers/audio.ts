@@ -0,0 +1,61 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\audio.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x251a7630;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = ext[0].read(state);
+	if (v2 !== undefined) { obj0.magic = v2; }
+	let v3 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v3 !== undefined) { obj0.unk_1 = v3; }
+	let v4 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v4 !== undefined) { obj0.unk_2 = v4; }
+	let v5 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v5 !== undefined) { obj0.samplefreq = v5; }
+	let v6 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v6 !== undefined) { obj0.unk_3 = v6; }
+	let v7 = ext[1].read(state);
+	if (v7 !== undefined) { obj0.chunks = v7; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden8 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden8);
+	let w9 = value.magic;
+	ext[0].write(state, w9);
+	let w10 = value.unk_1;
+	if (typeof w10 != "number" || w10 > 4294967295 || w10 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w10, state.scan);
+	state.scan += 4;
+	let w11 = value.unk_2;
+	if (typeof w11 != "number" || w11 > 4294967295 || w11 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w11, state.scan);
+	state.scan += 4;
+	let w12 = value.samplefreq;
+	if (typeof w12 != "number" || w12 > 4294967295 || w12 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w12, state.scan);
+	state.scan += 4;
+	let w13 = value.unk_3;
+	if (typeof w13 != "number" || w13 > 4294967295 || w13 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w13, state.scan);
+	state.scan += 4;
+	let w14 = value.chunks;
+	ext[1].write(state, w14);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
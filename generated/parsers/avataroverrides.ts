@@ -0,0 +1,4482 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\avataroverrides.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xc192ba56;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v2 !== undefined) { hidden1.$flags = v2; }
+	let obj3 = {};
+	let hidden4 = {};
+	state.stack.push(obj3);
+	state.hiddenstack.push(hidden4);
+	let v5 = ext[0].read(state);
+	if (v5 !== undefined) { obj3.slot = v5; }
+	let ref6 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match7 = -1;
+	if ((ref6 & 1) != 0) { match7 = 0; }
+	let v8 = null;
+	if (match7 != -1) {
+		let obj9 = {};
+		let hidden10 = {};
+		state.stack.push(obj9);
+		state.hiddenstack.push(hidden10);
+		let v11 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v11 !== undefined) { hidden10.$type = v11; }
+		let ref12 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match13 = -1;
+		if ((ref12 & 1) != 0) { match13 = 0; }
+		let v14 = null;
+		if (match13 != -1) {
+			let v15 = ext[1].read(state);
+			let hidden16 = { $index: 0, $length: v15 };
+			state.hiddenstack.push(hidden16);
+			state.stack.push({});
+			let arr17 = [];
+			for (let i18 = 0; i18 < v15; i18++) {
+				hidden16.$index = i18;
+				let v19 = ext[2].read(state);
+				arr17.push(v19);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v14 = arr17;
+		}
+		if (v14 !== undefined) { obj9.model = v14; }
+		let ref20 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match21 = -1;
+		if ((ref20 & 2) != 0) { match21 = 0; }
+		let v22 = null;
+		if (match21 != -1) {
+			v22 = true;
+		}
+		if (v22 !== undefined) { obj9.flag2 = v22; }
+		let ref23 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match24 = -1;
+		if ((ref23 & 4) != 0) { match24 = 0; }
+		let v25 = null;
+		if (match24 != -1) {
+			let obj26 = {};
+			let hidden27 = {};
+			state.stack.push(obj26);
+			state.hiddenstack.push(hidden27);
+			let v28 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v28 !== undefined) { hidden27.$coltype = v28; }
+			let ref29 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match30 = -1;
+			if (ref29 == 12816) { match30 = 0; }
+			let v31 = null;
+			if (match30 != -1) {
+				let v32 = ext[3].read(state);
+				let hidden33 = { $index: 0, $length: v32 };
+				state.hiddenstack.push(hidden33);
+				state.stack.push({});
+				let arr34 = [];
+				for (let i35 = 0; i35 < v32; i35++) {
+					hidden33.$index = i35;
+					let v36 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr34.push(v36);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v31 = arr34;
+			}
+			if (v31 !== undefined) { obj26.col2 = v31; }
+			let ref37 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match38 = -1;
+			if (ref37 == 8719) { match38 = 0; }
+			let v39 = null;
+			if (match38 != -1) {
+				let hidden40 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden40);
+				state.stack.push({});
+				let arr41 = [];
+				for (let i42 = 0; i42 < 4; i42++) {
+					hidden40.$index = i42;
+					let v43 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v44 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr45 = [v43, v44];
+					arr41.push(arr45);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v39 = arr41;
+			}
+			if (v39 !== undefined) { obj26.col4 = v39; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v25 = obj26;
+		}
+		if (v25 !== undefined) { obj9.color = v25; }
+		let ref46 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match47 = -1;
+		if ((ref46 & 8) != 0) { match47 = 0; }
+		let v48 = null;
+		if (match47 != -1) {
+			let obj49 = {};
+			let hidden50 = {};
+			state.stack.push(obj49);
+			state.hiddenstack.push(hidden50);
+			let v51 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v51 !== undefined) { obj49.header = v51; }
+			let v52 = ext[4].read(state);
+			let hidden53 = { $index: 0, $length: v52 };
+			state.hiddenstack.push(hidden53);
+			state.stack.push({});
+			let arr54 = [];
+			for (let i55 = 0; i55 < v52; i55++) {
+				hidden53.$index = i55;
+				let v56 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr54.push(v56);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr54 !== undefined) { obj49.materials = arr54; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v48 = obj49;
+		}
+		if (v48 !== undefined) { obj9.material = v48; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v8 = obj9;
+	}
+	if (v8 !== undefined) { obj3.cust = v8; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj57 = {};
+	let hidden58 = {};
+	state.stack.push(obj57);
+	state.hiddenstack.push(hidden58);
+	let v59 = ext[5].read(state);
+	if (v59 !== undefined) { obj57.slot = v59; }
+	let ref60 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match61 = -1;
+	if ((ref60 & 2) != 0) { match61 = 0; }
+	let v62 = null;
+	if (match61 != -1) {
+		let obj63 = {};
+		let hidden64 = {};
+		state.stack.push(obj63);
+		state.hiddenstack.push(hidden64);
+		let v65 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v65 !== undefined) { hidden64.$type = v65; }
+		let ref66 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match67 = -1;
+		if ((ref66 & 1) != 0) { match67 = 0; }
+		let v68 = null;
+		if (match67 != -1) {
+			let v69 = ext[6].read(state);
+			let hidden70 = { $index: 0, $length: v69 };
+			state.hiddenstack.push(hidden70);
+			state.stack.push({});
+			let arr71 = [];
+			for (let i72 = 0; i72 < v69; i72++) {
+				hidden70.$index = i72;
+				let v73 = ext[2].read(state);
+				arr71.push(v73);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v68 = arr71;
+		}
+		if (v68 !== undefined) { obj63.model = v68; }
+		let ref74 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match75 = -1;
+		if ((ref74 & 2) != 0) { match75 = 0; }
+		let v76 = null;
+		if (match75 != -1) {
+			v76 = true;
+		}
+		if (v76 !== undefined) { obj63.flag2 = v76; }
+		let ref77 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match78 = -1;
+		if ((ref77 & 4) != 0) { match78 = 0; }
+		let v79 = null;
+		if (match78 != -1) {
+			let obj80 = {};
+			let hidden81 = {};
+			state.stack.push(obj80);
+			state.hiddenstack.push(hidden81);
+			let v82 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v82 !== undefined) { hidden81.$coltype = v82; }
+			let ref83 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match84 = -1;
+			if (ref83 == 12816) { match84 = 0; }
+			let v85 = null;
+			if (match84 != -1) {
+				let v86 = ext[7].read(state);
+				let hidden87 = { $index: 0, $length: v86 };
+				state.hiddenstack.push(hidden87);
+				state.stack.push({});
+				let arr88 = [];
+				for (let i89 = 0; i89 < v86; i89++) {
+					hidden87.$index = i89;
+					let v90 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr88.push(v90);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v85 = arr88;
+			}
+			if (v85 !== undefined) { obj80.col2 = v85; }
+			let ref91 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match92 = -1;
+			if (ref91 == 8719) { match92 = 0; }
+			let v93 = null;
+			if (match92 != -1) {
+				let hidden94 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden94);
+				state.stack.push({});
+				let arr95 = [];
+				for (let i96 = 0; i96 < 4; i96++) {
+					hidden94.$index = i96;
+					let v97 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v98 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr99 = [v97, v98];
+					arr95.push(arr99);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v93 = arr95;
+			}
+			if (v93 !== undefined) { obj80.col4 = v93; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v79 = obj80;
+		}
+		if (v79 !== undefined) { obj63.color = v79; }
+		let ref100 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match101 = -1;
+		if ((ref100 & 8) != 0) { match101 = 0; }
+		let v102 = null;
+		if (match101 != -1) {
+			let obj103 = {};
+			let hidden104 = {};
+			state.stack.push(obj103);
+			state.hiddenstack.push(hidden104);
+			let v105 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v105 !== undefined) { obj103.header = v105; }
+			let v106 = ext[8].read(state);
+			let hidden107 = { $index: 0, $length: v106 };
+			state.hiddenstack.push(hidden107);
+			state.stack.push({});
+			let arr108 = [];
+			for (let i109 = 0; i109 < v106; i109++) {
+				hidden107.$index = i109;
+				let v110 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr108.push(v110);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr108 !== undefined) { obj103.materials = arr108; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v102 = obj103;
+		}
+		if (v102 !== undefined) { obj63.material = v102; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v62 = obj63;
+	}
+	if (v62 !== undefined) { obj57.cust = v62; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj111 = {};
+	let hidden112 = {};
+	state.stack.push(obj111);
+	state.hiddenstack.push(hidden112);
+	let v113 = ext[9].read(state);
+	if (v113 !== undefined) { obj111.slot = v113; }
+	let ref114 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match115 = -1;
+	if ((ref114 & 4) != 0) { match115 = 0; }
+	let v116 = null;
+	if (match115 != -1) {
+		let obj117 = {};
+		let hidden118 = {};
+		state.stack.push(obj117);
+		state.hiddenstack.push(hidden118);
+		let v119 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v119 !== undefined) { hidden118.$type = v119; }
+		let ref120 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match121 = -1;
+		if ((ref120 & 1) != 0) { match121 = 0; }
+		let v122 = null;
+		if (match121 != -1) {
+			let v123 = ext[10].read(state);
+			let hidden124 = { $index: 0, $length: v123 };
+			state.hiddenstack.push(hidden124);
+			state.stack.push({});
+			let arr125 = [];
+			for (let i126 = 0; i126 < v123; i126++) {
+				hidden124.$index = i126;
+				let v127 = ext[2].read(state);
+				arr125.push(v127);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v122 = arr125;
+		}
+		if (v122 !== undefined) { obj117.model = v122; }
+		let ref128 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match129 = -1;
+		if ((ref128 & 2) != 0) { match129 = 0; }
+		let v130 = null;
+		if (match129 != -1) {
+			v130 = true;
+		}
+		if (v130 !== undefined) { obj117.flag2 = v130; }
+		let ref131 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match132 = -1;
+		if ((ref131 & 4) != 0) { match132 = 0; }
+		let v133 = null;
+		if (match132 != -1) {
+			let obj134 = {};
+			let hidden135 = {};
+			state.stack.push(obj134);
+			state.hiddenstack.push(hidden135);
+			let v136 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v136 !== undefined) { hidden135.$coltype = v136; }
+			let ref137 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match138 = -1;
+			if (ref137 == 12816) { match138 = 0; }
+			let v139 = null;
+			if (match138 != -1) {
+				let v140 = ext[11].read(state);
+				let hidden141 = { $index: 0, $length: v140 };
+				state.hiddenstack.push(hidden141);
+				state.stack.push({});
+				let arr142 = [];
+				for (let i143 = 0; i143 < v140; i143++) {
+					hidden141.$index = i143;
+					let v144 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr142.push(v144);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v139 = arr142;
+			}
+			if (v139 !== undefined) { obj134.col2 = v139; }
+			let ref145 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match146 = -1;
+			if (ref145 == 8719) { match146 = 0; }
+			let v147 = null;
+			if (match146 != -1) {
+				let hidden148 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden148);
+				state.stack.push({});
+				let arr149 = [];
+				for (let i150 = 0; i150 < 4; i150++) {
+					hidden148.$index = i150;
+					let v151 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v152 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr153 = [v151, v152];
+					arr149.push(arr153);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v147 = arr149;
+			}
+			if (v147 !== undefined) { obj134.col4 = v147; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v133 = obj134;
+		}
+		if (v133 !== undefined) { obj117.color = v133; }
+		let ref154 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match155 = -1;
+		if ((ref154 & 8) != 0) { match155 = 0; }
+		let v156 = null;
+		if (match155 != -1) {
+			let obj157 = {};
+			let hidden158 = {};
+			state.stack.push(obj157);
+			state.hiddenstack.push(hidden158);
+			let v159 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v159 !== undefined) { obj157.header = v159; }
+			let v160 = ext[12].read(state);
+			let hidden161 = { $index: 0, $length: v160 };
+			state.hiddenstack.push(hidden161);
+			state.stack.push({});
+			let arr162 = [];
+			for (let i163 = 0; i163 < v160; i163++) {
+				hidden161.$index = i163;
+				let v164 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr162.push(v164);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr162 !== undefined) { obj157.materials = arr162; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v156 = obj157;
+		}
+		if (v156 !== undefined) { obj117.material = v156; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v116 = obj117;
+	}
+	if (v116 !== undefined) { obj111.cust = v116; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj165 = {};
+	let hidden166 = {};
+	state.stack.push(obj165);
+	state.hiddenstack.push(hidden166);
+	let v167 = ext[13].read(state);
+	if (v167 !== undefined) { obj165.slot = v167; }
+	let ref168 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match169 = -1;
+	if ((ref168 & 8) != 0) { match169 = 0; }
+	let v170 = null;
+	if (match169 != -1) {
+		let obj171 = {};
+		let hidden172 = {};
+		state.stack.push(obj171);
+		state.hiddenstack.push(hidden172);
+		let v173 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v173 !== undefined) { hidden172.$type = v173; }
+		let ref174 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match175 = -1;
+		if ((ref174 & 1) != 0) { match175 = 0; }
+		let v176 = null;
+		if (match175 != -1) {
+			let v177 = ext[14].read(state);
+			let hidden178 = { $index: 0, $length: v177 };
+			state.hiddenstack.push(hidden178);
+			state.stack.push({});
+			let arr179 = [];
+			for (let i180 = 0; i180 < v177; i180++) {
+				hidden178.$index = i180;
+				let v181 = ext[2].read(state);
+				arr179.push(v181);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v176 = arr179;
+		}
+		if (v176 !== undefined) { obj171.model = v176; }
+		let ref182 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match183 = -1;
+		if ((ref182 & 2) != 0) { match183 = 0; }
+		let v184 = null;
+		if (match183 != -1) {
+			v184 = true;
+		}
+		if (v184 !== undefined) { obj171.flag2 = v184; }
+		let ref185 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match186 = -1;
+		if ((ref185 & 4) != 0) { match186 = 0; }
+		let v187 = null;
+		if (match186 != -1) {
+			let obj188 = {};
+			let hidden189 = {};
+			state.stack.push(obj188);
+			state.hiddenstack.push(hidden189);
+			let v190 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v190 !== undefined) { hidden189.$coltype = v190; }
+			let ref191 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match192 = -1;
+			if (ref191 == 12816) { match192 = 0; }
+			let v193 = null;
+			if (match192 != -1) {
+				let v194 = ext[15].read(state);
+				let hidden195 = { $index: 0, $length: v194 };
+				state.hiddenstack.push(hidden195);
+				state.stack.push({});
+				let arr196 = [];
+				for (let i197 = 0; i197 < v194; i197++) {
+					hidden195.$index = i197;
+					let v198 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr196.push(v198);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v193 = arr196;
+			}
+			if (v193 !== undefined) { obj188.col2 = v193; }
+			let ref199 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match200 = -1;
+			if (ref199 == 8719) { match200 = 0; }
+			let v201 = null;
+			if (match200 != -1) {
+				let hidden202 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden202);
+				state.stack.push({});
+				let arr203 = [];
+				for (let i204 = 0; i204 < 4; i204++) {
+					hidden202.$index = i204;
+					let v205 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v206 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr207 = [v205, v206];
+					arr203.push(arr207);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v201 = arr203;
+			}
+			if (v201 !== undefined) { obj188.col4 = v201; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v187 = obj188;
+		}
+		if (v187 !== undefined) { obj171.color = v187; }
+		let ref208 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match209 = -1;
+		if ((ref208 & 8) != 0) { match209 = 0; }
+		let v210 = null;
+		if (match209 != -1) {
+			let obj211 = {};
+			let hidden212 = {};
+			state.stack.push(obj211);
+			state.hiddenstack.push(hidden212);
+			let v213 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v213 !== undefined) { obj211.header = v213; }
+			let v214 = ext[16].read(state);
+			let hidden215 = { $index: 0, $length: v214 };
+			state.hiddenstack.push(hidden215);
+			state.stack.push({});
+			let arr216 = [];
+			for (let i217 = 0; i217 < v214; i217++) {
+				hidden215.$index = i217;
+				let v218 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr216.push(v218);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr216 !== undefined) { obj211.materials = arr216; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v210 = obj211;
+		}
+		if (v210 !== undefined) { obj171.material = v210; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v170 = obj171;
+	}
+	if (v170 !== undefined) { obj165.cust = v170; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj219 = {};
+	let hidden220 = {};
+	state.stack.push(obj219);
+	state.hiddenstack.push(hidden220);
+	let v221 = ext[17].read(state);
+	if (v221 !== undefined) { obj219.slot = v221; }
+	let ref222 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match223 = -1;
+	if ((ref222 & 16) != 0) { match223 = 0; }
+	let v224 = null;
+	if (match223 != -1) {
+		let obj225 = {};
+		let hidden226 = {};
+		state.stack.push(obj225);
+		state.hiddenstack.push(hidden226);
+		let v227 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v227 !== undefined) { hidden226.$type = v227; }
+		let ref228 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match229 = -1;
+		if ((ref228 & 1) != 0) { match229 = 0; }
+		let v230 = null;
+		if (match229 != -1) {
+			let v231 = ext[18].read(state);
+			let hidden232 = { $index: 0, $length: v231 };
+			state.hiddenstack.push(hidden232);
+			state.stack.push({});
+			let arr233 = [];
+			for (let i234 = 0; i234 < v231; i234++) {
+				hidden232.$index = i234;
+				let v235 = ext[2].read(state);
+				arr233.push(v235);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v230 = arr233;
+		}
+		if (v230 !== undefined) { obj225.model = v230; }
+		let ref236 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match237 = -1;
+		if ((ref236 & 2) != 0) { match237 = 0; }
+		let v238 = null;
+		if (match237 != -1) {
+			v238 = true;
+		}
+		if (v238 !== undefined) { obj225.flag2 = v238; }
+		let ref239 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match240 = -1;
+		if ((ref239 & 4) != 0) { match240 = 0; }
+		let v241 = null;
+		if (match240 != -1) {
+			let obj242 = {};
+			let hidden243 = {};
+			state.stack.push(obj242);
+			state.hiddenstack.push(hidden243);
+			let v244 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v244 !== undefined) { hidden243.$coltype = v244; }
+			let ref245 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match246 = -1;
+			if (ref245 == 12816) { match246 = 0; }
+			let v247 = null;
+			if (match246 != -1) {
+				let v248 = ext[19].read(state);
+				let hidden249 = { $index: 0, $length: v248 };
+				state.hiddenstack.push(hidden249);
+				state.stack.push({});
+				let arr250 = [];
+				for (let i251 = 0; i251 < v248; i251++) {
+					hidden249.$index = i251;
+					let v252 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr250.push(v252);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v247 = arr250;
+			}
+			if (v247 !== undefined) { obj242.col2 = v247; }
+			let ref253 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match254 = -1;
+			if (ref253 == 8719) { match254 = 0; }
+			let v255 = null;
+			if (match254 != -1) {
+				let hidden256 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden256);
+				state.stack.push({});
+				let arr257 = [];
+				for (let i258 = 0; i258 < 4; i258++) {
+					hidden256.$index = i258;
+					let v259 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v260 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr261 = [v259, v260];
+					arr257.push(arr261);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v255 = arr257;
+			}
+			if (v255 !== undefined) { obj242.col4 = v255; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v241 = obj242;
+		}
+		if (v241 !== undefined) { obj225.color = v241; }
+		let ref262 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match263 = -1;
+		if ((ref262 & 8) != 0) { match263 = 0; }
+		let v264 = null;
+		if (match263 != -1) {
+			let obj265 = {};
+			let hidden266 = {};
+			state.stack.push(obj265);
+			state.hiddenstack.push(hidden266);
+			let v267 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v267 !== undefined) { obj265.header = v267; }
+			let v268 = ext[20].read(state);
+			let hidden269 = { $index: 0, $length: v268 };
+			state.hiddenstack.push(hidden269);
+			state.stack.push({});
+			let arr270 = [];
+			for (let i271 = 0; i271 < v268; i271++) {
+				hidden269.$index = i271;
+				let v272 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr270.push(v272);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr270 !== undefined) { obj265.materials = arr270; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v264 = obj265;
+		}
+		if (v264 !== undefined) { obj225.material = v264; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v224 = obj225;
+	}
+	if (v224 !== undefined) { obj219.cust = v224; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj273 = {};
+	let hidden274 = {};
+	state.stack.push(obj273);
+	state.hiddenstack.push(hidden274);
+	let v275 = ext[21].read(state);
+	if (v275 !== undefined) { obj273.slot = v275; }
+	let ref276 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match277 = -1;
+	if ((ref276 & 32) != 0) { match277 = 0; }
+	let v278 = null;
+	if (match277 != -1) {
+		let obj279 = {};
+		let hidden280 = {};
+		state.stack.push(obj279);
+		state.hiddenstack.push(hidden280);
+		let v281 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v281 !== undefined) { hidden280.$type = v281; }
+		let ref282 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match283 = -1;
+		if ((ref282 & 1) != 0) { match283 = 0; }
+		let v284 = null;
+		if (match283 != -1) {
+			let v285 = ext[22].read(state);
+			let hidden286 = { $index: 0, $length: v285 };
+			state.hiddenstack.push(hidden286);
+			state.stack.push({});
+			let arr287 = [];
+			for (let i288 = 0; i288 < v285; i288++) {
+				hidden286.$index = i288;
+				let v289 = ext[2].read(state);
+				arr287.push(v289);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v284 = arr287;
+		}
+		if (v284 !== undefined) { obj279.model = v284; }
+		let ref290 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match291 = -1;
+		if ((ref290 & 2) != 0) { match291 = 0; }
+		let v292 = null;
+		if (match291 != -1) {
+			v292 = true;
+		}
+		if (v292 !== undefined) { obj279.flag2 = v292; }
+		let ref293 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match294 = -1;
+		if ((ref293 & 4) != 0) { match294 = 0; }
+		let v295 = null;
+		if (match294 != -1) {
+			let obj296 = {};
+			let hidden297 = {};
+			state.stack.push(obj296);
+			state.hiddenstack.push(hidden297);
+			let v298 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v298 !== undefined) { hidden297.$coltype = v298; }
+			let ref299 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match300 = -1;
+			if (ref299 == 12816) { match300 = 0; }
+			let v301 = null;
+			if (match300 != -1) {
+				let v302 = ext[23].read(state);
+				let hidden303 = { $index: 0, $length: v302 };
+				state.hiddenstack.push(hidden303);
+				state.stack.push({});
+				let arr304 = [];
+				for (let i305 = 0; i305 < v302; i305++) {
+					hidden303.$index = i305;
+					let v306 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr304.push(v306);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v301 = arr304;
+			}
+			if (v301 !== undefined) { obj296.col2 = v301; }
+			let ref307 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match308 = -1;
+			if (ref307 == 8719) { match308 = 0; }
+			let v309 = null;
+			if (match308 != -1) {
+				let hidden310 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden310);
+				state.stack.push({});
+				let arr311 = [];
+				for (let i312 = 0; i312 < 4; i312++) {
+					hidden310.$index = i312;
+					let v313 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v314 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr315 = [v313, v314];
+					arr311.push(arr315);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v309 = arr311;
+			}
+			if (v309 !== undefined) { obj296.col4 = v309; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v295 = obj296;
+		}
+		if (v295 !== undefined) { obj279.color = v295; }
+		let ref316 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match317 = -1;
+		if ((ref316 & 8) != 0) { match317 = 0; }
+		let v318 = null;
+		if (match317 != -1) {
+			let obj319 = {};
+			let hidden320 = {};
+			state.stack.push(obj319);
+			state.hiddenstack.push(hidden320);
+			let v321 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v321 !== undefined) { obj319.header = v321; }
+			let v322 = ext[24].read(state);
+			let hidden323 = { $index: 0, $length: v322 };
+			state.hiddenstack.push(hidden323);
+			state.stack.push({});
+			let arr324 = [];
+			for (let i325 = 0; i325 < v322; i325++) {
+				hidden323.$index = i325;
+				let v326 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr324.push(v326);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr324 !== undefined) { obj319.materials = arr324; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v318 = obj319;
+		}
+		if (v318 !== undefined) { obj279.material = v318; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v278 = obj279;
+	}
+	if (v278 !== undefined) { obj273.cust = v278; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj327 = {};
+	let hidden328 = {};
+	state.stack.push(obj327);
+	state.hiddenstack.push(hidden328);
+	let v329 = ext[25].read(state);
+	if (v329 !== undefined) { obj327.slot = v329; }
+	let ref330 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match331 = -1;
+	if ((ref330 & 64) != 0) { match331 = 0; }
+	let v332 = null;
+	if (match331 != -1) {
+		let obj333 = {};
+		let hidden334 = {};
+		state.stack.push(obj333);
+		state.hiddenstack.push(hidden334);
+		let v335 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v335 !== undefined) { hidden334.$type = v335; }
+		let ref336 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match337 = -1;
+		if ((ref336 & 1) != 0) { match337 = 0; }
+		let v338 = null;
+		if (match337 != -1) {
+			let v339 = ext[26].read(state);
+			let hidden340 = { $index: 0, $length: v339 };
+			state.hiddenstack.push(hidden340);
+			state.stack.push({});
+			let arr341 = [];
+			for (let i342 = 0; i342 < v339; i342++) {
+				hidden340.$index = i342;
+				let v343 = ext[2].read(state);
+				arr341.push(v343);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v338 = arr341;
+		}
+		if (v338 !== undefined) { obj333.model = v338; }
+		let ref344 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match345 = -1;
+		if ((ref344 & 2) != 0) { match345 = 0; }
+		let v346 = null;
+		if (match345 != -1) {
+			v346 = true;
+		}
+		if (v346 !== undefined) { obj333.flag2 = v346; }
+		let ref347 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match348 = -1;
+		if ((ref347 & 4) != 0) { match348 = 0; }
+		let v349 = null;
+		if (match348 != -1) {
+			let obj350 = {};
+			let hidden351 = {};
+			state.stack.push(obj350);
+			state.hiddenstack.push(hidden351);
+			let v352 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v352 !== undefined) { hidden351.$coltype = v352; }
+			let ref353 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match354 = -1;
+			if (ref353 == 12816) { match354 = 0; }
+			let v355 = null;
+			if (match354 != -1) {
+				let v356 = ext[27].read(state);
+				let hidden357 = { $index: 0, $length: v356 };
+				state.hiddenstack.push(hidden357);
+				state.stack.push({});
+				let arr358 = [];
+				for (let i359 = 0; i359 < v356; i359++) {
+					hidden357.$index = i359;
+					let v360 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr358.push(v360);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v355 = arr358;
+			}
+			if (v355 !== undefined) { obj350.col2 = v355; }
+			let ref361 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match362 = -1;
+			if (ref361 == 8719) { match362 = 0; }
+			let v363 = null;
+			if (match362 != -1) {
+				let hidden364 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden364);
+				state.stack.push({});
+				let arr365 = [];
+				for (let i366 = 0; i366 < 4; i366++) {
+					hidden364.$index = i366;
+					let v367 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v368 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr369 = [v367, v368];
+					arr365.push(arr369);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v363 = arr365;
+			}
+			if (v363 !== undefined) { obj350.col4 = v363; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v349 = obj350;
+		}
+		if (v349 !== undefined) { obj333.color = v349; }
+		let ref370 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match371 = -1;
+		if ((ref370 & 8) != 0) { match371 = 0; }
+		let v372 = null;
+		if (match371 != -1) {
+			let obj373 = {};
+			let hidden374 = {};
+			state.stack.push(obj373);
+			state.hiddenstack.push(hidden374);
+			let v375 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v375 !== undefined) { obj373.header = v375; }
+			let v376 = ext[28].read(state);
+			let hidden377 = { $index: 0, $length: v376 };
+			state.hiddenstack.push(hidden377);
+			state.stack.push({});
+			let arr378 = [];
+			for (let i379 = 0; i379 < v376; i379++) {
+				hidden377.$index = i379;
+				let v380 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr378.push(v380);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr378 !== undefined) { obj373.materials = arr378; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v372 = obj373;
+		}
+		if (v372 !== undefined) { obj333.material = v372; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v332 = obj333;
+	}
+	if (v332 !== undefined) { obj327.cust = v332; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj381 = {};
+	let hidden382 = {};
+	state.stack.push(obj381);
+	state.hiddenstack.push(hidden382);
+	let v383 = ext[29].read(state);
+	if (v383 !== undefined) { obj381.slot = v383; }
+	let ref384 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match385 = -1;
+	if ((ref384 & 128) != 0) { match385 = 0; }
+	let v386 = null;
+	if (match385 != -1) {
+		let obj387 = {};
+		let hidden388 = {};
+		state.stack.push(obj387);
+		state.hiddenstack.push(hidden388);
+		let v389 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v389 !== undefined) { hidden388.$type = v389; }
+		let ref390 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match391 = -1;
+		if ((ref390 & 1) != 0) { match391 = 0; }
+		let v392 = null;
+		if (match391 != -1) {
+			let v393 = ext[30].read(state);
+			let hidden394 = { $index: 0, $length: v393 };
+			state.hiddenstack.push(hidden394);
+			state.stack.push({});
+			let arr395 = [];
+			for (let i396 = 0; i396 < v393; i396++) {
+				hidden394.$index = i396;
+				let v397 = ext[2].read(state);
+				arr395.push(v397);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v392 = arr395;
+		}
+		if (v392 !== undefined) { obj387.model = v392; }
+		let ref398 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match399 = -1;
+		if ((ref398 & 2) != 0) { match399 = 0; }
+		let v400 = null;
+		if (match399 != -1) {
+			v400 = true;
+		}
+		if (v400 !== undefined) { obj387.flag2 = v400; }
+		let ref401 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match402 = -1;
+		if ((ref401 & 4) != 0) { match402 = 0; }
+		let v403 = null;
+		if (match402 != -1) {
+			let obj404 = {};
+			let hidden405 = {};
+			state.stack.push(obj404);
+			state.hiddenstack.push(hidden405);
+			let v406 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v406 !== undefined) { hidden405.$coltype = v406; }
+			let ref407 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match408 = -1;
+			if (ref407 == 12816) { match408 = 0; }
+			let v409 = null;
+			if (match408 != -1) {
+				let v410 = ext[31].read(state);
+				let hidden411 = { $index: 0, $length: v410 };
+				state.hiddenstack.push(hidden411);
+				state.stack.push({});
+				let arr412 = [];
+				for (let i413 = 0; i413 < v410; i413++) {
+					hidden411.$index = i413;
+					let v414 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr412.push(v414);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v409 = arr412;
+			}
+			if (v409 !== undefined) { obj404.col2 = v409; }
+			let ref415 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match416 = -1;
+			if (ref415 == 8719) { match416 = 0; }
+			let v417 = null;
+			if (match416 != -1) {
+				let hidden418 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden418);
+				state.stack.push({});
+				let arr419 = [];
+				for (let i420 = 0; i420 < 4; i420++) {
+					hidden418.$index = i420;
+					let v421 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v422 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr423 = [v421, v422];
+					arr419.push(arr423);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v417 = arr419;
+			}
+			if (v417 !== undefined) { obj404.col4 = v417; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v403 = obj404;
+		}
+		if (v403 !== undefined) { obj387.color = v403; }
+		let ref424 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match425 = -1;
+		if ((ref424 & 8) != 0) { match425 = 0; }
+		let v426 = null;
+		if (match425 != -1) {
+			let obj427 = {};
+			let hidden428 = {};
+			state.stack.push(obj427);
+			state.hiddenstack.push(hidden428);
+			let v429 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v429 !== undefined) { obj427.header = v429; }
+			let v430 = ext[32].read(state);
+			let hidden431 = { $index: 0, $length: v430 };
+			state.hiddenstack.push(hidden431);
+			state.stack.push({});
+			let arr432 = [];
+			for (let i433 = 0; i433 < v430; i433++) {
+				hidden431.$index = i433;
+				let v434 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr432.push(v434);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr432 !== undefined) { obj427.materials = arr432; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v426 = obj427;
+		}
+		if (v426 !== undefined) { obj387.material = v426; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v386 = obj387;
+	}
+	if (v386 !== undefined) { obj381.cust = v386; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj435 = {};
+	let hidden436 = {};
+	state.stack.push(obj435);
+	state.hiddenstack.push(hidden436);
+	let v437 = ext[33].read(state);
+	if (v437 !== undefined) { obj435.slot = v437; }
+	let ref438 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match439 = -1;
+	if ((ref438 & 256) != 0) { match439 = 0; }
+	let v440 = null;
+	if (match439 != -1) {
+		let obj441 = {};
+		let hidden442 = {};
+		state.stack.push(obj441);
+		state.hiddenstack.push(hidden442);
+		let v443 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v443 !== undefined) { hidden442.$type = v443; }
+		let ref444 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match445 = -1;
+		if ((ref444 & 1) != 0) { match445 = 0; }
+		let v446 = null;
+		if (match445 != -1) {
+			let v447 = ext[34].read(state);
+			let hidden448 = { $index: 0, $length: v447 };
+			state.hiddenstack.push(hidden448);
+			state.stack.push({});
+			let arr449 = [];
+			for (let i450 = 0; i450 < v447; i450++) {
+				hidden448.$index = i450;
+				let v451 = ext[2].read(state);
+				arr449.push(v451);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v446 = arr449;
+		}
+		if (v446 !== undefined) { obj441.model = v446; }
+		let ref452 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match453 = -1;
+		if ((ref452 & 2) != 0) { match453 = 0; }
+		let v454 = null;
+		if (match453 != -1) {
+			v454 = true;
+		}
+		if (v454 !== undefined) { obj441.flag2 = v454; }
+		let ref455 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match456 = -1;
+		if ((ref455 & 4) != 0) { match456 = 0; }
+		let v457 = null;
+		if (match456 != -1) {
+			let obj458 = {};
+			let hidden459 = {};
+			state.stack.push(obj458);
+			state.hiddenstack.push(hidden459);
+			let v460 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v460 !== undefined) { hidden459.$coltype = v460; }
+			let ref461 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match462 = -1;
+			if (ref461 == 12816) { match462 = 0; }
+			let v463 = null;
+			if (match462 != -1) {
+				let v464 = ext[35].read(state);
+				let hidden465 = { $index: 0, $length: v464 };
+				state.hiddenstack.push(hidden465);
+				state.stack.push({});
+				let arr466 = [];
+				for (let i467 = 0; i467 < v464; i467++) {
+					hidden465.$index = i467;
+					let v468 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr466.push(v468);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v463 = arr466;
+			}
+			if (v463 !== undefined) { obj458.col2 = v463; }
+			let ref469 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match470 = -1;
+			if (ref469 == 8719) { match470 = 0; }
+			let v471 = null;
+			if (match470 != -1) {
+				let hidden472 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden472);
+				state.stack.push({});
+				let arr473 = [];
+				for (let i474 = 0; i474 < 4; i474++) {
+					hidden472.$index = i474;
+					let v475 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v476 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr477 = [v475, v476];
+					arr473.push(arr477);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v471 = arr473;
+			}
+			if (v471 !== undefined) { obj458.col4 = v471; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v457 = obj458;
+		}
+		if (v457 !== undefined) { obj441.color = v457; }
+		let ref478 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match479 = -1;
+		if ((ref478 & 8) != 0) { match479 = 0; }
+		let v480 = null;
+		if (match479 != -1) {
+			let obj481 = {};
+			let hidden482 = {};
+			state.stack.push(obj481);
+			state.hiddenstack.push(hidden482);
+			let v483 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v483 !== undefined) { obj481.header = v483; }
+			let v484 = ext[36].read(state);
+			let hidden485 = { $index: 0, $length: v484 };
+			state.hiddenstack.push(hidden485);
+			state.stack.push({});
+			let arr486 = [];
+			for (let i487 = 0; i487 < v484; i487++) {
+				hidden485.$index = i487;
+				let v488 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr486.push(v488);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr486 !== undefined) { obj481.materials = arr486; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v480 = obj481;
+		}
+		if (v480 !== undefined) { obj441.material = v480; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v440 = obj441;
+	}
+	if (v440 !== undefined) { obj435.cust = v440; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj489 = {};
+	let hidden490 = {};
+	state.stack.push(obj489);
+	state.hiddenstack.push(hidden490);
+	let v491 = ext[37].read(state);
+	if (v491 !== undefined) { obj489.slot = v491; }
+	let ref492 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match493 = -1;
+	if ((ref492 & 512) != 0) { match493 = 0; }
+	let v494 = null;
+	if (match493 != -1) {
+		let obj495 = {};
+		let hidden496 = {};
+		state.stack.push(obj495);
+		state.hiddenstack.push(hidden496);
+		let v497 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v497 !== undefined) { hidden496.$type = v497; }
+		let ref498 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match499 = -1;
+		if ((ref498 & 1) != 0) { match499 = 0; }
+		let v500 = null;
+		if (match499 != -1) {
+			let v501 = ext[38].read(state);
+			let hidden502 = { $index: 0, $length: v501 };
+			state.hiddenstack.push(hidden502);
+			state.stack.push({});
+			let arr503 = [];
+			for (let i504 = 0; i504 < v501; i504++) {
+				hidden502.$index = i504;
+				let v505 = ext[2].read(state);
+				arr503.push(v505);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v500 = arr503;
+		}
+		if (v500 !== undefined) { obj495.model = v500; }
+		let ref506 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match507 = -1;
+		if ((ref506 & 2) != 0) { match507 = 0; }
+		let v508 = null;
+		if (match507 != -1) {
+			v508 = true;
+		}
+		if (v508 !== undefined) { obj495.flag2 = v508; }
+		let ref509 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match510 = -1;
+		if ((ref509 & 4) != 0) { match510 = 0; }
+		let v511 = null;
+		if (match510 != -1) {
+			let obj512 = {};
+			let hidden513 = {};
+			state.stack.push(obj512);
+			state.hiddenstack.push(hidden513);
+			let v514 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v514 !== undefined) { hidden513.$coltype = v514; }
+			let ref515 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match516 = -1;
+			if (ref515 == 12816) { match516 = 0; }
+			let v517 = null;
+			if (match516 != -1) {
+				let v518 = ext[39].read(state);
+				let hidden519 = { $index: 0, $length: v518 };
+				state.hiddenstack.push(hidden519);
+				state.stack.push({});
+				let arr520 = [];
+				for (let i521 = 0; i521 < v518; i521++) {
+					hidden519.$index = i521;
+					let v522 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr520.push(v522);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v517 = arr520;
+			}
+			if (v517 !== undefined) { obj512.col2 = v517; }
+			let ref523 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match524 = -1;
+			if (ref523 == 8719) { match524 = 0; }
+			let v525 = null;
+			if (match524 != -1) {
+				let hidden526 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden526);
+				state.stack.push({});
+				let arr527 = [];
+				for (let i528 = 0; i528 < 4; i528++) {
+					hidden526.$index = i528;
+					let v529 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v530 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr531 = [v529, v530];
+					arr527.push(arr531);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v525 = arr527;
+			}
+			if (v525 !== undefined) { obj512.col4 = v525; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v511 = obj512;
+		}
+		if (v511 !== undefined) { obj495.color = v511; }
+		let ref532 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match533 = -1;
+		if ((ref532 & 8) != 0) { match533 = 0; }
+		let v534 = null;
+		if (match533 != -1) {
+			let obj535 = {};
+			let hidden536 = {};
+			state.stack.push(obj535);
+			state.hiddenstack.push(hidden536);
+			let v537 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v537 !== undefined) { obj535.header = v537; }
+			let v538 = ext[40].read(state);
+			let hidden539 = { $index: 0, $length: v538 };
+			state.hiddenstack.push(hidden539);
+			state.stack.push({});
+			let arr540 = [];
+			for (let i541 = 0; i541 < v538; i541++) {
+				hidden539.$index = i541;
+				let v542 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr540.push(v542);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr540 !== undefined) { obj535.materials = arr540; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v534 = obj535;
+		}
+		if (v534 !== undefined) { obj495.material = v534; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v494 = obj495;
+	}
+	if (v494 !== undefined) { obj489.cust = v494; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj543 = {};
+	let hidden544 = {};
+	state.stack.push(obj543);
+	state.hiddenstack.push(hidden544);
+	let v545 = ext[41].read(state);
+	if (v545 !== undefined) { obj543.slot = v545; }
+	let ref546 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match547 = -1;
+	if ((ref546 & 1024) != 0) { match547 = 0; }
+	let v548 = null;
+	if (match547 != -1) {
+		let obj549 = {};
+		let hidden550 = {};
+		state.stack.push(obj549);
+		state.hiddenstack.push(hidden550);
+		let v551 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v551 !== undefined) { hidden550.$type = v551; }
+		let ref552 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match553 = -1;
+		if ((ref552 & 1) != 0) { match553 = 0; }
+		let v554 = null;
+		if (match553 != -1) {
+			let v555 = ext[42].read(state);
+			let hidden556 = { $index: 0, $length: v555 };
+			state.hiddenstack.push(hidden556);
+			state.stack.push({});
+			let arr557 = [];
+			for (let i558 = 0; i558 < v555; i558++) {
+				hidden556.$index = i558;
+				let v559 = ext[2].read(state);
+				arr557.push(v559);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v554 = arr557;
+		}
+		if (v554 !== undefined) { obj549.model = v554; }
+		let ref560 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match561 = -1;
+		if ((ref560 & 2) != 0) { match561 = 0; }
+		let v562 = null;
+		if (match561 != -1) {
+			v562 = true;
+		}
+		if (v562 !== undefined) { obj549.flag2 = v562; }
+		let ref563 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match564 = -1;
+		if ((ref563 & 4) != 0) { match564 = 0; }
+		let v565 = null;
+		if (match564 != -1) {
+			let obj566 = {};
+			let hidden567 = {};
+			state.stack.push(obj566);
+			state.hiddenstack.push(hidden567);
+			let v568 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v568 !== undefined) { hidden567.$coltype = v568; }
+			let ref569 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match570 = -1;
+			if (ref569 == 12816) { match570 = 0; }
+			let v571 = null;
+			if (match570 != -1) {
+				let v572 = ext[43].read(state);
+				let hidden573 = { $index: 0, $length: v572 };
+				state.hiddenstack.push(hidden573);
+				state.stack.push({});
+				let arr574 = [];
+				for (let i575 = 0; i575 < v572; i575++) {
+					hidden573.$index = i575;
+					let v576 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr574.push(v576);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v571 = arr574;
+			}
+			if (v571 !== undefined) { obj566.col2 = v571; }
+			let ref577 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match578 = -1;
+			if (ref577 == 8719) { match578 = 0; }
+			let v579 = null;
+			if (match578 != -1) {
+				let hidden580 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden580);
+				state.stack.push({});
+				let arr581 = [];
+				for (let i582 = 0; i582 < 4; i582++) {
+					hidden580.$index = i582;
+					let v583 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v584 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr585 = [v583, v584];
+					arr581.push(arr585);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v579 = arr581;
+			}
+			if (v579 !== undefined) { obj566.col4 = v579; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v565 = obj566;
+		}
+		if (v565 !== undefined) { obj549.color = v565; }
+		let ref586 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match587 = -1;
+		if ((ref586 & 8) != 0) { match587 = 0; }
+		let v588 = null;
+		if (match587 != -1) {
+			let obj589 = {};
+			let hidden590 = {};
+			state.stack.push(obj589);
+			state.hiddenstack.push(hidden590);
+			let v591 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v591 !== undefined) { obj589.header = v591; }
+			let v592 = ext[44].read(state);
+			let hidden593 = { $index: 0, $length: v592 };
+			state.hiddenstack.push(hidden593);
+			state.stack.push({});
+			let arr594 = [];
+			for (let i595 = 0; i595 < v592; i595++) {
+				hidden593.$index = i595;
+				let v596 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr594.push(v596);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr594 !== undefined) { obj589.materials = arr594; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v588 = obj589;
+		}
+		if (v588 !== undefined) { obj549.material = v588; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v548 = obj549;
+	}
+	if (v548 !== undefined) { obj543.cust = v548; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj597 = {};
+	let hidden598 = {};
+	state.stack.push(obj597);
+	state.hiddenstack.push(hidden598);
+	let v599 = ext[45].read(state);
+	if (v599 !== undefined) { obj597.slot = v599; }
+	let ref600 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match601 = -1;
+	if ((ref600 & 2048) != 0) { match601 = 0; }
+	let v602 = null;
+	if (match601 != -1) {
+		let obj603 = {};
+		let hidden604 = {};
+		state.stack.push(obj603);
+		state.hiddenstack.push(hidden604);
+		let v605 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v605 !== undefined) { hidden604.$type = v605; }
+		let ref606 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match607 = -1;
+		if ((ref606 & 1) != 0) { match607 = 0; }
+		let v608 = null;
+		if (match607 != -1) {
+			let v609 = ext[46].read(state);
+			let hidden610 = { $index: 0, $length: v609 };
+			state.hiddenstack.push(hidden610);
+			state.stack.push({});
+			let arr611 = [];
+			for (let i612 = 0; i612 < v609; i612++) {
+				hidden610.$index = i612;
+				let v613 = ext[2].read(state);
+				arr611.push(v613);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v608 = arr611;
+		}
+		if (v608 !== undefined) { obj603.model = v608; }
+		let ref614 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match615 = -1;
+		if ((ref614 & 2) != 0) { match615 = 0; }
+		let v616 = null;
+		if (match615 != -1) {
+			v616 = true;
+		}
+		if (v616 !== undefined) { obj603.flag2 = v616; }
+		let ref617 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match618 = -1;
+		if ((ref617 & 4) != 0) { match618 = 0; }
+		let v619 = null;
+		if (match618 != -1) {
+			let obj620 = {};
+			let hidden621 = {};
+			state.stack.push(obj620);
+			state.hiddenstack.push(hidden621);
+			let v622 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v622 !== undefined) { hidden621.$coltype = v622; }
+			let ref623 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match624 = -1;
+			if (ref623 == 12816) { match624 = 0; }
+			let v625 = null;
+			if (match624 != -1) {
+				let v626 = ext[47].read(state);
+				let hidden627 = { $index: 0, $length: v626 };
+				state.hiddenstack.push(hidden627);
+				state.stack.push({});
+				let arr628 = [];
+				for (let i629 = 0; i629 < v626; i629++) {
+					hidden627.$index = i629;
+					let v630 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr628.push(v630);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v625 = arr628;
+			}
+			if (v625 !== undefined) { obj620.col2 = v625; }
+			let ref631 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match632 = -1;
+			if (ref631 == 8719) { match632 = 0; }
+			let v633 = null;
+			if (match632 != -1) {
+				let hidden634 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden634);
+				state.stack.push({});
+				let arr635 = [];
+				for (let i636 = 0; i636 < 4; i636++) {
+					hidden634.$index = i636;
+					let v637 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v638 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr639 = [v637, v638];
+					arr635.push(arr639);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v633 = arr635;
+			}
+			if (v633 !== undefined) { obj620.col4 = v633; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v619 = obj620;
+		}
+		if (v619 !== undefined) { obj603.color = v619; }
+		let ref640 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match641 = -1;
+		if ((ref640 & 8) != 0) { match641 = 0; }
+		let v642 = null;
+		if (match641 != -1) {
+			let obj643 = {};
+			let hidden644 = {};
+			state.stack.push(obj643);
+			state.hiddenstack.push(hidden644);
+			let v645 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v645 !== undefined) { obj643.header = v645; }
+			let v646 = ext[48].read(state);
+			let hidden647 = { $index: 0, $length: v646 };
+			state.hiddenstack.push(hidden647);
+			state.stack.push({});
+			let arr648 = [];
+			for (let i649 = 0; i649 < v646; i649++) {
+				hidden647.$index = i649;
+				let v650 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr648.push(v650);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr648 !== undefined) { obj643.materials = arr648; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v642 = obj643;
+		}
+		if (v642 !== undefined) { obj603.material = v642; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v602 = obj603;
+	}
+	if (v602 !== undefined) { obj597.cust = v602; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj651 = {};
+	let hidden652 = {};
+	state.stack.push(obj651);
+	state.hiddenstack.push(hidden652);
+	let v653 = ext[49].read(state);
+	if (v653 !== undefined) { obj651.slot = v653; }
+	let ref654 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match655 = -1;
+	if ((ref654 & 4096) != 0) { match655 = 0; }
+	let v656 = null;
+	if (match655 != -1) {
+		let obj657 = {};
+		let hidden658 = {};
+		state.stack.push(obj657);
+		state.hiddenstack.push(hidden658);
+		let v659 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v659 !== undefined) { hidden658.$type = v659; }
+		let ref660 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match661 = -1;
+		if ((ref660 & 1) != 0) { match661 = 0; }
+		let v662 = null;
+		if (match661 != -1) {
+			let v663 = ext[50].read(state);
+			let hidden664 = { $index: 0, $length: v663 };
+			state.hiddenstack.push(hidden664);
+			state.stack.push({});
+			let arr665 = [];
+			for (let i666 = 0; i666 < v663; i666++) {
+				hidden664.$index = i666;
+				let v667 = ext[2].read(state);
+				arr665.push(v667);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v662 = arr665;
+		}
+		if (v662 !== undefined) { obj657.model = v662; }
+		let ref668 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match669 = -1;
+		if ((ref668 & 2) != 0) { match669 = 0; }
+		let v670 = null;
+		if (match669 != -1) {
+			v670 = true;
+		}
+		if (v670 !== undefined) { obj657.flag2 = v670; }
+		let ref671 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match672 = -1;
+		if ((ref671 & 4) != 0) { match672 = 0; }
+		let v673 = null;
+		if (match672 != -1) {
+			let obj674 = {};
+			let hidden675 = {};
+			state.stack.push(obj674);
+			state.hiddenstack.push(hidden675);
+			let v676 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v676 !== undefined) { hidden675.$coltype = v676; }
+			let ref677 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match678 = -1;
+			if (ref677 == 12816) { match678 = 0; }
+			let v679 = null;
+			if (match678 != -1) {
+				let v680 = ext[51].read(state);
+				let hidden681 = { $index: 0, $length: v680 };
+				state.hiddenstack.push(hidden681);
+				state.stack.push({});
+				let arr682 = [];
+				for (let i683 = 0; i683 < v680; i683++) {
+					hidden681.$index = i683;
+					let v684 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr682.push(v684);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v679 = arr682;
+			}
+			if (v679 !== undefined) { obj674.col2 = v679; }
+			let ref685 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match686 = -1;
+			if (ref685 == 8719) { match686 = 0; }
+			let v687 = null;
+			if (match686 != -1) {
+				let hidden688 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden688);
+				state.stack.push({});
+				let arr689 = [];
+				for (let i690 = 0; i690 < 4; i690++) {
+					hidden688.$index = i690;
+					let v691 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v692 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr693 = [v691, v692];
+					arr689.push(arr693);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v687 = arr689;
+			}
+			if (v687 !== undefined) { obj674.col4 = v687; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v673 = obj674;
+		}
+		if (v673 !== undefined) { obj657.color = v673; }
+		let ref694 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match695 = -1;
+		if ((ref694 & 8) != 0) { match695 = 0; }
+		let v696 = null;
+		if (match695 != -1) {
+			let obj697 = {};
+			let hidden698 = {};
+			state.stack.push(obj697);
+			state.hiddenstack.push(hidden698);
+			let v699 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v699 !== undefined) { obj697.header = v699; }
+			let v700 = ext[52].read(state);
+			let hidden701 = { $index: 0, $length: v700 };
+			state.hiddenstack.push(hidden701);
+			state.stack.push({});
+			let arr702 = [];
+			for (let i703 = 0; i703 < v700; i703++) {
+				hidden701.$index = i703;
+				let v704 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr702.push(v704);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr702 !== undefined) { obj697.materials = arr702; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v696 = obj697;
+		}
+		if (v696 !== undefined) { obj657.material = v696; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v656 = obj657;
+	}
+	if (v656 !== undefined) { obj651.cust = v656; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj705 = {};
+	let hidden706 = {};
+	state.stack.push(obj705);
+	state.hiddenstack.push(hidden706);
+	let v707 = ext[53].read(state);
+	if (v707 !== undefined) { obj705.slot = v707; }
+	let ref708 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match709 = -1;
+	if ((ref708 & 8192) != 0) { match709 = 0; }
+	let v710 = null;
+	if (match709 != -1) {
+		let obj711 = {};
+		let hidden712 = {};
+		state.stack.push(obj711);
+		state.hiddenstack.push(hidden712);
+		let v713 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v713 !== undefined) { hidden712.$type = v713; }
+		let ref714 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match715 = -1;
+		if ((ref714 & 1) != 0) { match715 = 0; }
+		let v716 = null;
+		if (match715 != -1) {
+			let v717 = ext[54].read(state);
+			let hidden718 = { $index: 0, $length: v717 };
+			state.hiddenstack.push(hidden718);
+			state.stack.push({});
+			let arr719 = [];
+			for (let i720 = 0; i720 < v717; i720++) {
+				hidden718.$index = i720;
+				let v721 = ext[2].read(state);
+				arr719.push(v721);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v716 = arr719;
+		}
+		if (v716 !== undefined) { obj711.model = v716; }
+		let ref722 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match723 = -1;
+		if ((ref722 & 2) != 0) { match723 = 0; }
+		let v724 = null;
+		if (match723 != -1) {
+			v724 = true;
+		}
+		if (v724 !== undefined) { obj711.flag2 = v724; }
+		let ref725 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match726 = -1;
+		if ((ref725 & 4) != 0) { match726 = 0; }
+		let v727 = null;
+		if (match726 != -1) {
+			let obj728 = {};
+			let hidden729 = {};
+			state.stack.push(obj728);
+			state.hiddenstack.push(hidden729);
+			let v730 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v730 !== undefined) { hidden729.$coltype = v730; }
+			let ref731 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match732 = -1;
+			if (ref731 == 12816) { match732 = 0; }
+			let v733 = null;
+			if (match732 != -1) {
+				let v734 = ext[55].read(state);
+				let hidden735 = { $index: 0, $length: v734 };
+				state.hiddenstack.push(hidden735);
+				state.stack.push({});
+				let arr736 = [];
+				for (let i737 = 0; i737 < v734; i737++) {
+					hidden735.$index = i737;
+					let v738 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr736.push(v738);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v733 = arr736;
+			}
+			if (v733 !== undefined) { obj728.col2 = v733; }
+			let ref739 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match740 = -1;
+			if (ref739 == 8719) { match740 = 0; }
+			let v741 = null;
+			if (match740 != -1) {
+				let hidden742 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden742);
+				state.stack.push({});
+				let arr743 = [];
+				for (let i744 = 0; i744 < 4; i744++) {
+					hidden742.$index = i744;
+					let v745 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v746 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr747 = [v745, v746];
+					arr743.push(arr747);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v741 = arr743;
+			}
+			if (v741 !== undefined) { obj728.col4 = v741; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v727 = obj728;
+		}
+		if (v727 !== undefined) { obj711.color = v727; }
+		let ref748 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match749 = -1;
+		if ((ref748 & 8) != 0) { match749 = 0; }
+		let v750 = null;
+		if (match749 != -1) {
+			let obj751 = {};
+			let hidden752 = {};
+			state.stack.push(obj751);
+			state.hiddenstack.push(hidden752);
+			let v753 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v753 !== undefined) { obj751.header = v753; }
+			let v754 = ext[56].read(state);
+			let hidden755 = { $index: 0, $length: v754 };
+			state.hiddenstack.push(hidden755);
+			state.stack.push({});
+			let arr756 = [];
+			for (let i757 = 0; i757 < v754; i757++) {
+				hidden755.$index = i757;
+				let v758 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr756.push(v758);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr756 !== undefined) { obj751.materials = arr756; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v750 = obj751;
+		}
+		if (v750 !== undefined) { obj711.material = v750; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v710 = obj711;
+	}
+	if (v710 !== undefined) { obj705.cust = v710; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj759 = {};
+	let hidden760 = {};
+	state.stack.push(obj759);
+	state.hiddenstack.push(hidden760);
+	let v761 = ext[57].read(state);
+	if (v761 !== undefined) { obj759.slot = v761; }
+	let ref762 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match763 = -1;
+	if ((ref762 & 16384) != 0) { match763 = 0; }
+	let v764 = null;
+	if (match763 != -1) {
+		let obj765 = {};
+		let hidden766 = {};
+		state.stack.push(obj765);
+		state.hiddenstack.push(hidden766);
+		let v767 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v767 !== undefined) { hidden766.$type = v767; }
+		let ref768 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match769 = -1;
+		if ((ref768 & 1) != 0) { match769 = 0; }
+		let v770 = null;
+		if (match769 != -1) {
+			let v771 = ext[58].read(state);
+			let hidden772 = { $index: 0, $length: v771 };
+			state.hiddenstack.push(hidden772);
+			state.stack.push({});
+			let arr773 = [];
+			for (let i774 = 0; i774 < v771; i774++) {
+				hidden772.$index = i774;
+				let v775 = ext[2].read(state);
+				arr773.push(v775);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v770 = arr773;
+		}
+		if (v770 !== undefined) { obj765.model = v770; }
+		let ref776 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match777 = -1;
+		if ((ref776 & 2) != 0) { match777 = 0; }
+		let v778 = null;
+		if (match777 != -1) {
+			v778 = true;
+		}
+		if (v778 !== undefined) { obj765.flag2 = v778; }
+		let ref779 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match780 = -1;
+		if ((ref779 & 4) != 0) { match780 = 0; }
+		let v781 = null;
+		if (match780 != -1) {
+			let obj782 = {};
+			let hidden783 = {};
+			state.stack.push(obj782);
+			state.hiddenstack.push(hidden783);
+			let v784 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v784 !== undefined) { hidden783.$coltype = v784; }
+			let ref785 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match786 = -1;
+			if (ref785 == 12816) { match786 = 0; }
+			let v787 = null;
+			if (match786 != -1) {
+				let v788 = ext[59].read(state);
+				let hidden789 = { $index: 0, $length: v788 };
+				state.hiddenstack.push(hidden789);
+				state.stack.push({});
+				let arr790 = [];
+				for (let i791 = 0; i791 < v788; i791++) {
+					hidden789.$index = i791;
+					let v792 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr790.push(v792);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v787 = arr790;
+			}
+			if (v787 !== undefined) { obj782.col2 = v787; }
+			let ref793 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match794 = -1;
+			if (ref793 == 8719) { match794 = 0; }
+			let v795 = null;
+			if (match794 != -1) {
+				let hidden796 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden796);
+				state.stack.push({});
+				let arr797 = [];
+				for (let i798 = 0; i798 < 4; i798++) {
+					hidden796.$index = i798;
+					let v799 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v800 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr801 = [v799, v800];
+					arr797.push(arr801);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v795 = arr797;
+			}
+			if (v795 !== undefined) { obj782.col4 = v795; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v781 = obj782;
+		}
+		if (v781 !== undefined) { obj765.color = v781; }
+		let ref802 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match803 = -1;
+		if ((ref802 & 8) != 0) { match803 = 0; }
+		let v804 = null;
+		if (match803 != -1) {
+			let obj805 = {};
+			let hidden806 = {};
+			state.stack.push(obj805);
+			state.hiddenstack.push(hidden806);
+			let v807 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v807 !== undefined) { obj805.header = v807; }
+			let v808 = ext[60].read(state);
+			let hidden809 = { $index: 0, $length: v808 };
+			state.hiddenstack.push(hidden809);
+			state.stack.push({});
+			let arr810 = [];
+			for (let i811 = 0; i811 < v808; i811++) {
+				hidden809.$index = i811;
+				let v812 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr810.push(v812);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr810 !== undefined) { obj805.materials = arr810; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v804 = obj805;
+		}
+		if (v804 !== undefined) { obj765.material = v804; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v764 = obj765;
+	}
+	if (v764 !== undefined) { obj759.cust = v764; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let obj813 = {};
+	let hidden814 = {};
+	state.stack.push(obj813);
+	state.hiddenstack.push(hidden814);
+	let v815 = ext[61].read(state);
+	if (v815 !== undefined) { obj813.slot = v815; }
+	let ref816 = state.hiddenstack[state.hiddenstack.length - 2].$flags;
+	let match817 = -1;
+	if ((ref816 & 32768) != 0) { match817 = 0; }
+	let v818 = null;
+	if (match817 != -1) {
+		let obj819 = {};
+		let hidden820 = {};
+		state.stack.push(obj819);
+		state.hiddenstack.push(hidden820);
+		let v821 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v821 !== undefined) { hidden820.$type = v821; }
+		let ref822 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match823 = -1;
+		if ((ref822 & 1) != 0) { match823 = 0; }
+		let v824 = null;
+		if (match823 != -1) {
+			let v825 = ext[62].read(state);
+			let hidden826 = { $index: 0, $length: v825 };
+			state.hiddenstack.push(hidden826);
+			state.stack.push({});
+			let arr827 = [];
+			for (let i828 = 0; i828 < v825; i828++) {
+				hidden826.$index = i828;
+				let v829 = ext[2].read(state);
+				arr827.push(v829);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v824 = arr827;
+		}
+		if (v824 !== undefined) { obj819.model = v824; }
+		let ref830 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match831 = -1;
+		if ((ref830 & 2) != 0) { match831 = 0; }
+		let v832 = null;
+		if (match831 != -1) {
+			v832 = true;
+		}
+		if (v832 !== undefined) { obj819.flag2 = v832; }
+		let ref833 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match834 = -1;
+		if ((ref833 & 4) != 0) { match834 = 0; }
+		let v835 = null;
+		if (match834 != -1) {
+			let obj836 = {};
+			let hidden837 = {};
+			state.stack.push(obj836);
+			state.hiddenstack.push(hidden837);
+			let v838 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v838 !== undefined) { hidden837.$coltype = v838; }
+			let ref839 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match840 = -1;
+			if (ref839 == 12816) { match840 = 0; }
+			let v841 = null;
+			if (match840 != -1) {
+				let v842 = ext[63].read(state);
+				let hidden843 = { $index: 0, $length: v842 };
+				state.hiddenstack.push(hidden843);
+				state.stack.push({});
+				let arr844 = [];
+				for (let i845 = 0; i845 < v842; i845++) {
+					hidden843.$index = i845;
+					let v846 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr844.push(v846);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v841 = arr844;
+			}
+			if (v841 !== undefined) { obj836.col2 = v841; }
+			let ref847 = state.hiddenstack[state.hiddenstack.length - 1].$coltype;
+			let match848 = -1;
+			if (ref847 == 8719) { match848 = 0; }
+			let v849 = null;
+			if (match848 != -1) {
+				let hidden850 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden850);
+				state.stack.push({});
+				let arr851 = [];
+				for (let i852 = 0; i852 < 4; i852++) {
+					hidden850.$index = i852;
+					let v853 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v854 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr855 = [v853, v854];
+					arr851.push(arr855);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				v849 = arr851;
+			}
+			if (v849 !== undefined) { obj836.col4 = v849; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v835 = obj836;
+		}
+		if (v835 !== undefined) { obj819.color = v835; }
+		let ref856 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+		let match857 = -1;
+		if ((ref856 & 8) != 0) { match857 = 0; }
+		let v858 = null;
+		if (match857 != -1) {
+			let obj859 = {};
+			let hidden860 = {};
+			state.stack.push(obj859);
+			state.hiddenstack.push(hidden860);
+			let v861 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v861 !== undefined) { obj859.header = v861; }
+			let v862 = ext[64].read(state);
+			let hidden863 = { $index: 0, $length: v862 };
+			state.hiddenstack.push(hidden863);
+			state.stack.push({});
+			let arr864 = [];
+			for (let i865 = 0; i865 < v862; i865++) {
+				hidden863.$index = i865;
+				let v866 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				arr864.push(v866);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr864 !== undefined) { obj859.materials = arr864; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v858 = obj859;
+		}
+		if (v858 !== undefined) { obj819.material = v858; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v818 = obj819;
+	}
+	if (v818 !== undefined) { obj813.cust = v818; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let arr867 = [obj3, obj57, obj111, obj165, obj219, obj273, obj327, obj381, obj435, obj489, obj543, obj597, obj651, obj705, obj759, obj813];
+	if (arr867 !== undefined) { obj0.slots = arr867; }
+	let v868 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v868 !== undefined) { obj0.haircol0 = v868; }
+	let v869 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v869 !== undefined) { obj0.bodycol = v869; }
+	let v870 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v870 !== undefined) { obj0.legscol = v870; }
+	let v871 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v871 !== undefined) { obj0.bootscol = v871; }
+	let v872 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v872 !== undefined) { obj0.skincol0 = v872; }
+	let v873 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v873 !== undefined) { obj0.skincol1 = v873; }
+	let v874 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v874 !== undefined) { obj0.haircol1 = v874; }
+	let v875 = ext[65].read(state);
+	if (v875 !== undefined) { obj0.unkbuf = v875; }
+	let v876 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v876 !== undefined) { obj0.stance = v876; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden877 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden877);
+	let w878 = value.$flags;
+	w878 ??= 0;
+	w878 = ext[66].resolve(value, w878);
+	w878 = ext[67].resolve(value, w878);
+	w878 = ext[68].resolve(value, w878);
+	w878 = ext[69].resolve(value, w878);
+	w878 = ext[70].resolve(value, w878);
+	w878 = ext[71].resolve(value, w878);
+	w878 = ext[72].resolve(value, w878);
+	w878 = ext[73].resolve(value, w878);
+	w878 = ext[74].resolve(value, w878);
+	w878 = ext[75].resolve(value, w878);
+	w878 = ext[76].resolve(value, w878);
+	w878 = ext[77].resolve(value, w878);
+	w878 = ext[78].resolve(value, w878);
+	w878 = ext[79].resolve(value, w878);
+	w878 = ext[80].resolve(value, w878);
+	w878 = ext[81].resolve(value, w878);
+	hidden877.$flags = w878;
+	if (typeof w878 != "number" || w878 > 65535 || w878 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w878, state.scan);
+	state.scan += 2;
+	let w879 = value.slots;
+	if (!Array.isArray(w879)) { throw new Error("array expected"); }
+	let w880 = w879[0];
+	if (typeof w880 != "object" || !w880) { throw new Error("object expected"); }
+	let hidden881 = {};
+	state.stack.push(w880);
+	state.hiddenstack.push(hidden881);
+	let w882 = w880.slot;
+	ext[0].write(state, w882);
+	let w883 = w880.cust;
+	if (w883 != null) {
+		if (typeof w883 != "object" || !w883) { throw new Error("object expected"); }
+		let hidden884 = {};
+		state.stack.push(w883);
+		state.hiddenstack.push(hidden884);
+		let w885 = w883.$type;
+		w885 ??= 0;
+		w885 = ext[82].resolve(w883, w885);
+		w885 = ext[83].resolve(w883, w885);
+		w885 = ext[84].resolve(w883, w885);
+		w885 = ext[85].resolve(w883, w885);
+		hidden884.$type = w885;
+		if (typeof w885 != "number" || w885 > 255 || w885 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w885, state.scan);
+		state.scan += 1;
+		let w886 = w883.model;
+		if (w886 != null) {
+			if (!Array.isArray(w886)) { throw new Error("array expected"); }
+			let w887 = w886.length;
+			ext[1].write(state, w887);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w886.length });
+			for (let i888 = 0; i888 < w886.length; i888++) {
+				let w889 = w886[i888];
+				ext[2].write(state, w889);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w890 = w883.flag2;
+		if (w890 != null) {
+			if (w890 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w891 = w883.color;
+		if (w891 != null) {
+			if (typeof w891 != "object" || !w891) { throw new Error("object expected"); }
+			let hidden892 = {};
+			state.stack.push(w891);
+			state.hiddenstack.push(hidden892);
+			let w893 = w891.$coltype;
+			w893 ??= 0;
+			w893 = ext[86].resolve(w891, w893);
+			w893 = ext[87].resolve(w891, w893);
+			hidden892.$coltype = w893;
+			if (typeof w893 != "number" || w893 > 65535 || w893 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w893, state.scan);
+			state.scan += 2;
+			let w894 = w891.col2;
+			if (w894 != null) {
+				if (!Array.isArray(w894)) { throw new Error("array expected"); }
+				let w895 = w894.length;
+				ext[3].write(state, w895);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w894.length });
+				for (let i896 = 0; i896 < w894.length; i896++) {
+					let w897 = w894[i896];
+					if (typeof w897 != "number" || w897 > 65535 || w897 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w897, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w898 = w891.col4;
+			if (w898 != null) {
+				if (!Array.isArray(w898)) { throw new Error("array expected"); }
+				let w899 = w898.length;
+				if (w899 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w898.length });
+				for (let i900 = 0; i900 < w898.length; i900++) {
+					let w901 = w898[i900];
+					if (!Array.isArray(w901)) { throw new Error("array expected"); }
+					let w902 = w901[0];
+					if (typeof w902 != "number" || w902 > 65535 || w902 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w902, state.scan);
+					state.scan += 2;
+					let w903 = w901[1];
+					if (typeof w903 != "number" || w903 > 65535 || w903 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w903, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w904 = w883.material;
+		if (w904 != null) {
+			if (typeof w904 != "object" || !w904) { throw new Error("object expected"); }
+			let hidden905 = {};
+			state.stack.push(w904);
+			state.hiddenstack.push(hidden905);
+			let w906 = w904.header;
+			if (typeof w906 != "number" || w906 > 255 || w906 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w906, state.scan);
+			state.scan += 1;
+			let w907 = w904.materials;
+			if (!Array.isArray(w907)) { throw new Error("array expected"); }
+			let w908 = w907.length;
+			ext[4].write(state, w908);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w907.length });
+			for (let i909 = 0; i909 < w907.length; i909++) {
+				let w910 = w907[i909];
+				if (typeof w910 != "number" || w910 > 65535 || w910 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w910, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w911 = w879[1];
+	if (typeof w911 != "object" || !w911) { throw new Error("object expected"); }
+	let hidden912 = {};
+	state.stack.push(w911);
+	state.hiddenstack.push(hidden912);
+	let w913 = w911.slot;
+	ext[5].write(state, w913);
+	let w914 = w911.cust;
+	if (w914 != null) {
+		if (typeof w914 != "object" || !w914) { throw new Error("object expected"); }
+		let hidden915 = {};
+		state.stack.push(w914);
+		state.hiddenstack.push(hidden915);
+		let w916 = w914.$type;
+		w916 ??= 0;
+		w916 = ext[88].resolve(w914, w916);
+		w916 = ext[89].resolve(w914, w916);
+		w916 = ext[90].resolve(w914, w916);
+		w916 = ext[91].resolve(w914, w916);
+		hidden915.$type = w916;
+		if (typeof w916 != "number" || w916 > 255 || w916 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w916, state.scan);
+		state.scan += 1;
+		let w917 = w914.model;
+		if (w917 != null) {
+			if (!Array.isArray(w917)) { throw new Error("array expected"); }
+			let w918 = w917.length;
+			ext[6].write(state, w918);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w917.length });
+			for (let i919 = 0; i919 < w917.length; i919++) {
+				let w920 = w917[i919];
+				ext[2].write(state, w920);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w921 = w914.flag2;
+		if (w921 != null) {
+			if (w921 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w922 = w914.color;
+		if (w922 != null) {
+			if (typeof w922 != "object" || !w922) { throw new Error("object expected"); }
+			let hidden923 = {};
+			state.stack.push(w922);
+			state.hiddenstack.push(hidden923);
+			let w924 = w922.$coltype;
+			w924 ??= 0;
+			w924 = ext[92].resolve(w922, w924);
+			w924 = ext[93].resolve(w922, w924);
+			hidden923.$coltype = w924;
+			if (typeof w924 != "number" || w924 > 65535 || w924 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w924, state.scan);
+			state.scan += 2;
+			let w925 = w922.col2;
+			if (w925 != null) {
+				if (!Array.isArray(w925)) { throw new Error("array expected"); }
+				let w926 = w925.length;
+				ext[7].write(state, w926);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w925.length });
+				for (let i927 = 0; i927 < w925.length; i927++) {
+					let w928 = w925[i927];
+					if (typeof w928 != "number" || w928 > 65535 || w928 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w928, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w929 = w922.col4;
+			if (w929 != null) {
+				if (!Array.isArray(w929)) { throw new Error("array expected"); }
+				let w930 = w929.length;
+				if (w930 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w929.length });
+				for (let i931 = 0; i931 < w929.length; i931++) {
+					let w932 = w929[i931];
+					if (!Array.isArray(w932)) { throw new Error("array expected"); }
+					let w933 = w932[0];
+					if (typeof w933 != "number" || w933 > 65535 || w933 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w933, state.scan);
+					state.scan += 2;
+					let w934 = w932[1];
+					if (typeof w934 != "number" || w934 > 65535 || w934 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w934, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w935 = w914.material;
+		if (w935 != null) {
+			if (typeof w935 != "object" || !w935) { throw new Error("object expected"); }
+			let hidden936 = {};
+			state.stack.push(w935);
+			state.hiddenstack.push(hidden936);
+			let w937 = w935.header;
+			if (typeof w937 != "number" || w937 > 255 || w937 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w937, state.scan);
+			state.scan += 1;
+			let w938 = w935.materials;
+			if (!Array.isArray(w938)) { throw new Error("array expected"); }
+			let w939 = w938.length;
+			ext[8].write(state, w939);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w938.length });
+			for (let i940 = 0; i940 < w938.length; i940++) {
+				let w941 = w938[i940];
+				if (typeof w941 != "number" || w941 > 65535 || w941 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w941, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w942 = w879[2];
+	if (typeof w942 != "object" || !w942) { throw new Error("object expected"); }
+	let hidden943 = {};
+	state.stack.push(w942);
+	state.hiddenstack.push(hidden943);
+	let w944 = w942.slot;
+	ext[9].write(state, w944);
+	let w945 = w942.cust;
+	if (w945 != null) {
+		if (typeof w945 != "object" || !w945) { throw new Error("object expected"); }
+		let hidden946 = {};
+		state.stack.push(w945);
+		state.hiddenstack.push(hidden946);
+		let w947 = w945.$type;
+		w947 ??= 0;
+		w947 = ext[94].resolve(w945, w947);
+		w947 = ext[95].resolve(w945, w947);
+		w947 = ext[96].resolve(w945, w947);
+		w947 = ext[97].resolve(w945, w947);
+		hidden946.$type = w947;
+		if (typeof w947 != "number" || w947 > 255 || w947 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w947, state.scan);
+		state.scan += 1;
+		let w948 = w945.model;
+		if (w948 != null) {
+			if (!Array.isArray(w948)) { throw new Error("array expected"); }
+			let w949 = w948.length;
+			ext[10].write(state, w949);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w948.length });
+			for (let i950 = 0; i950 < w948.length; i950++) {
+				let w951 = w948[i950];
+				ext[2].write(state, w951);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w952 = w945.flag2;
+		if (w952 != null) {
+			if (w952 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w953 = w945.color;
+		if (w953 != null) {
+			if (typeof w953 != "object" || !w953) { throw new Error("object expected"); }
+			let hidden954 = {};
+			state.stack.push(w953);
+			state.hiddenstack.push(hidden954);
+			let w955 = w953.$coltype;
+			w955 ??= 0;
+			w955 = ext[98].resolve(w953, w955);
+			w955 = ext[99].resolve(w953, w955);
+			hidden954.$coltype = w955;
+			if (typeof w955 != "number" || w955 > 65535 || w955 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w955, state.scan);
+			state.scan += 2;
+			let w956 = w953.col2;
+			if (w956 != null) {
+				if (!Array.isArray(w956)) { throw new Error("array expected"); }
+				let w957 = w956.length;
+				ext[11].write(state, w957);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w956.length });
+				for (let i958 = 0; i958 < w956.length; i958++) {
+					let w959 = w956[i958];
+					if (typeof w959 != "number" || w959 > 65535 || w959 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w959, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w960 = w953.col4;
+			if (w960 != null) {
+				if (!Array.isArray(w960)) { throw new Error("array expected"); }
+				let w961 = w960.length;
+				if (w961 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w960.length });
+				for (let i962 = 0; i962 < w960.length; i962++) {
+					let w963 = w960[i962];
+					if (!Array.isArray(w963)) { throw new Error("array expected"); }
+					let w964 = w963[0];
+					if (typeof w964 != "number" || w964 > 65535 || w964 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w964, state.scan);
+					state.scan += 2;
+					let w965 = w963[1];
+					if (typeof w965 != "number" || w965 > 65535 || w965 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w965, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w966 = w945.material;
+		if (w966 != null) {
+			if (typeof w966 != "object" || !w966) { throw new Error("object expected"); }
+			let hidden967 = {};
+			state.stack.push(w966);
+			state.hiddenstack.push(hidden967);
+			let w968 = w966.header;
+			if (typeof w968 != "number" || w968 > 255 || w968 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w968, state.scan);
+			state.scan += 1;
+			let w969 = w966.materials;
+			if (!Array.isArray(w969)) { throw new Error("array expected"); }
+			let w970 = w969.length;
+			ext[12].write(state, w970);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w969.length });
+			for (let i971 = 0; i971 < w969.length; i971++) {
+				let w972 = w969[i971];
+				if (typeof w972 != "number" || w972 > 65535 || w972 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w972, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w973 = w879[3];
+	if (typeof w973 != "object" || !w973) { throw new Error("object expected"); }
+	let hidden974 = {};
+	state.stack.push(w973);
+	state.hiddenstack.push(hidden974);
+	let w975 = w973.slot;
+	ext[13].write(state, w975);
+	let w976 = w973.cust;
+	if (w976 != null) {
+		if (typeof w976 != "object" || !w976) { throw new Error("object expected"); }
+		let hidden977 = {};
+		state.stack.push(w976);
+		state.hiddenstack.push(hidden977);
+		let w978 = w976.$type;
+		w978 ??= 0;
+		w978 = ext[100].resolve(w976, w978);
+		w978 = ext[101].resolve(w976, w978);
+		w978 = ext[102].resolve(w976, w978);
+		w978 = ext[103].resolve(w976, w978);
+		hidden977.$type = w978;
+		if (typeof w978 != "number" || w978 > 255 || w978 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w978, state.scan);
+		state.scan += 1;
+		let w979 = w976.model;
+		if (w979 != null) {
+			if (!Array.isArray(w979)) { throw new Error("array expected"); }
+			let w980 = w979.length;
+			ext[14].write(state, w980);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w979.length });
+			for (let i981 = 0; i981 < w979.length; i981++) {
+				let w982 = w979[i981];
+				ext[2].write(state, w982);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w983 = w976.flag2;
+		if (w983 != null) {
+			if (w983 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w984 = w976.color;
+		if (w984 != null) {
+			if (typeof w984 != "object" || !w984) { throw new Error("object expected"); }
+			let hidden985 = {};
+			state.stack.push(w984);
+			state.hiddenstack.push(hidden985);
+			let w986 = w984.$coltype;
+			w986 ??= 0;
+			w986 = ext[104].resolve(w984, w986);
+			w986 = ext[105].resolve(w984, w986);
+			hidden985.$coltype = w986;
+			if (typeof w986 != "number" || w986 > 65535 || w986 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w986, state.scan);
+			state.scan += 2;
+			let w987 = w984.col2;
+			if (w987 != null) {
+				if (!Array.isArray(w987)) { throw new Error("array expected"); }
+				let w988 = w987.length;
+				ext[15].write(state, w988);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w987.length });
+				for (let i989 = 0; i989 < w987.length; i989++) {
+					let w990 = w987[i989];
+					if (typeof w990 != "number" || w990 > 65535 || w990 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w990, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w991 = w984.col4;
+			if (w991 != null) {
+				if (!Array.isArray(w991)) { throw new Error("array expected"); }
+				let w992 = w991.length;
+				if (w992 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w991.length });
+				for (let i993 = 0; i993 < w991.length; i993++) {
+					let w994 = w991[i993];
+					if (!Array.isArray(w994)) { throw new Error("array expected"); }
+					let w995 = w994[0];
+					if (typeof w995 != "number" || w995 > 65535 || w995 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w995, state.scan);
+					state.scan += 2;
+					let w996 = w994[1];
+					if (typeof w996 != "number" || w996 > 65535 || w996 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w996, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w997 = w976.material;
+		if (w997 != null) {
+			if (typeof w997 != "object" || !w997) { throw new Error("object expected"); }
+			let hidden998 = {};
+			state.stack.push(w997);
+			state.hiddenstack.push(hidden998);
+			let w999 = w997.header;
+			if (typeof w999 != "number" || w999 > 255 || w999 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w999, state.scan);
+			state.scan += 1;
+			let w1000 = w997.materials;
+			if (!Array.isArray(w1000)) { throw new Error("array expected"); }
+			let w1001 = w1000.length;
+			ext[16].write(state, w1001);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1000.length });
+			for (let i1002 = 0; i1002 < w1000.length; i1002++) {
+				let w1003 = w1000[i1002];
+				if (typeof w1003 != "number" || w1003 > 65535 || w1003 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1003, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1004 = w879[4];
+	if (typeof w1004 != "object" || !w1004) { throw new Error("object expected"); }
+	let hidden1005 = {};
+	state.stack.push(w1004);
+	state.hiddenstack.push(hidden1005);
+	let w1006 = w1004.slot;
+	ext[17].write(state, w1006);
+	let w1007 = w1004.cust;
+	if (w1007 != null) {
+		if (typeof w1007 != "object" || !w1007) { throw new Error("object expected"); }
+		let hidden1008 = {};
+		state.stack.push(w1007);
+		state.hiddenstack.push(hidden1008);
+		let w1009 = w1007.$type;
+		w1009 ??= 0;
+		w1009 = ext[106].resolve(w1007, w1009);
+		w1009 = ext[107].resolve(w1007, w1009);
+		w1009 = ext[108].resolve(w1007, w1009);
+		w1009 = ext[109].resolve(w1007, w1009);
+		hidden1008.$type = w1009;
+		if (typeof w1009 != "number" || w1009 > 255 || w1009 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1009, state.scan);
+		state.scan += 1;
+		let w1010 = w1007.model;
+		if (w1010 != null) {
+			if (!Array.isArray(w1010)) { throw new Error("array expected"); }
+			let w1011 = w1010.length;
+			ext[18].write(state, w1011);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1010.length });
+			for (let i1012 = 0; i1012 < w1010.length; i1012++) {
+				let w1013 = w1010[i1012];
+				ext[2].write(state, w1013);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1014 = w1007.flag2;
+		if (w1014 != null) {
+			if (w1014 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1015 = w1007.color;
+		if (w1015 != null) {
+			if (typeof w1015 != "object" || !w1015) { throw new Error("object expected"); }
+			let hidden1016 = {};
+			state.stack.push(w1015);
+			state.hiddenstack.push(hidden1016);
+			let w1017 = w1015.$coltype;
+			w1017 ??= 0;
+			w1017 = ext[110].resolve(w1015, w1017);
+			w1017 = ext[111].resolve(w1015, w1017);
+			hidden1016.$coltype = w1017;
+			if (typeof w1017 != "number" || w1017 > 65535 || w1017 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1017, state.scan);
+			state.scan += 2;
+			let w1018 = w1015.col2;
+			if (w1018 != null) {
+				if (!Array.isArray(w1018)) { throw new Error("array expected"); }
+				let w1019 = w1018.length;
+				ext[19].write(state, w1019);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1018.length });
+				for (let i1020 = 0; i1020 < w1018.length; i1020++) {
+					let w1021 = w1018[i1020];
+					if (typeof w1021 != "number" || w1021 > 65535 || w1021 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1021, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1022 = w1015.col4;
+			if (w1022 != null) {
+				if (!Array.isArray(w1022)) { throw new Error("array expected"); }
+				let w1023 = w1022.length;
+				if (w1023 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1022.length });
+				for (let i1024 = 0; i1024 < w1022.length; i1024++) {
+					let w1025 = w1022[i1024];
+					if (!Array.isArray(w1025)) { throw new Error("array expected"); }
+					let w1026 = w1025[0];
+					if (typeof w1026 != "number" || w1026 > 65535 || w1026 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1026, state.scan);
+					state.scan += 2;
+					let w1027 = w1025[1];
+					if (typeof w1027 != "number" || w1027 > 65535 || w1027 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1027, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1028 = w1007.material;
+		if (w1028 != null) {
+			if (typeof w1028 != "object" || !w1028) { throw new Error("object expected"); }
+			let hidden1029 = {};
+			state.stack.push(w1028);
+			state.hiddenstack.push(hidden1029);
+			let w1030 = w1028.header;
+			if (typeof w1030 != "number" || w1030 > 255 || w1030 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1030, state.scan);
+			state.scan += 1;
+			let w1031 = w1028.materials;
+			if (!Array.isArray(w1031)) { throw new Error("array expected"); }
+			let w1032 = w1031.length;
+			ext[20].write(state, w1032);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1031.length });
+			for (let i1033 = 0; i1033 < w1031.length; i1033++) {
+				let w1034 = w1031[i1033];
+				if (typeof w1034 != "number" || w1034 > 65535 || w1034 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1034, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1035 = w879[5];
+	if (typeof w1035 != "object" || !w1035) { throw new Error("object expected"); }
+	let hidden1036 = {};
+	state.stack.push(w1035);
+	state.hiddenstack.push(hidden1036);
+	let w1037 = w1035.slot;
+	ext[21].write(state, w1037);
+	let w1038 = w1035.cust;
+	if (w1038 != null) {
+		if (typeof w1038 != "object" || !w1038) { throw new Error("object expected"); }
+		let hidden1039 = {};
+		state.stack.push(w1038);
+		state.hiddenstack.push(hidden1039);
+		let w1040 = w1038.$type;
+		w1040 ??= 0;
+		w1040 = ext[112].resolve(w1038, w1040);
+		w1040 = ext[113].resolve(w1038, w1040);
+		w1040 = ext[114].resolve(w1038, w1040);
+		w1040 = ext[115].resolve(w1038, w1040);
+		hidden1039.$type = w1040;
+		if (typeof w1040 != "number" || w1040 > 255 || w1040 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1040, state.scan);
+		state.scan += 1;
+		let w1041 = w1038.model;
+		if (w1041 != null) {
+			if (!Array.isArray(w1041)) { throw new Error("array expected"); }
+			let w1042 = w1041.length;
+			ext[22].write(state, w1042);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1041.length });
+			for (let i1043 = 0; i1043 < w1041.length; i1043++) {
+				let w1044 = w1041[i1043];
+				ext[2].write(state, w1044);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1045 = w1038.flag2;
+		if (w1045 != null) {
+			if (w1045 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1046 = w1038.color;
+		if (w1046 != null) {
+			if (typeof w1046 != "object" || !w1046) { throw new Error("object expected"); }
+			let hidden1047 = {};
+			state.stack.push(w1046);
+			state.hiddenstack.push(hidden1047);
+			let w1048 = w1046.$coltype;
+			w1048 ??= 0;
+			w1048 = ext[116].resolve(w1046, w1048);
+			w1048 = ext[117].resolve(w1046, w1048);
+			hidden1047.$coltype = w1048;
+			if (typeof w1048 != "number" || w1048 > 65535 || w1048 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1048, state.scan);
+			state.scan += 2;
+			let w1049 = w1046.col2;
+			if (w1049 != null) {
+				if (!Array.isArray(w1049)) { throw new Error("array expected"); }
+				let w1050 = w1049.length;
+				ext[23].write(state, w1050);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1049.length });
+				for (let i1051 = 0; i1051 < w1049.length; i1051++) {
+					let w1052 = w1049[i1051];
+					if (typeof w1052 != "number" || w1052 > 65535 || w1052 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1052, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1053 = w1046.col4;
+			if (w1053 != null) {
+				if (!Array.isArray(w1053)) { throw new Error("array expected"); }
+				let w1054 = w1053.length;
+				if (w1054 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1053.length });
+				for (let i1055 = 0; i1055 < w1053.length; i1055++) {
+					let w1056 = w1053[i1055];
+					if (!Array.isArray(w1056)) { throw new Error("array expected"); }
+					let w1057 = w1056[0];
+					if (typeof w1057 != "number" || w1057 > 65535 || w1057 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1057, state.scan);
+					state.scan += 2;
+					let w1058 = w1056[1];
+					if (typeof w1058 != "number" || w1058 > 65535 || w1058 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1058, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1059 = w1038.material;
+		if (w1059 != null) {
+			if (typeof w1059 != "object" || !w1059) { throw new Error("object expected"); }
+			let hidden1060 = {};
+			state.stack.push(w1059);
+			state.hiddenstack.push(hidden1060);
+			let w1061 = w1059.header;
+			if (typeof w1061 != "number" || w1061 > 255 || w1061 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1061, state.scan);
+			state.scan += 1;
+			let w1062 = w1059.materials;
+			if (!Array.isArray(w1062)) { throw new Error("array expected"); }
+			let w1063 = w1062.length;
+			ext[24].write(state, w1063);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1062.length });
+			for (let i1064 = 0; i1064 < w1062.length; i1064++) {
+				let w1065 = w1062[i1064];
+				if (typeof w1065 != "number" || w1065 > 65535 || w1065 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1065, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1066 = w879[6];
+	if (typeof w1066 != "object" || !w1066) { throw new Error("object expected"); }
+	let hidden1067 = {};
+	state.stack.push(w1066);
+	state.hiddenstack.push(hidden1067);
+	let w1068 = w1066.slot;
+	ext[25].write(state, w1068);
+	let w1069 = w1066.cust;
+	if (w1069 != null) {
+		if (typeof w1069 != "object" || !w1069) { throw new Error("object expected"); }
+		let hidden1070 = {};
+		state.stack.push(w1069);
+		state.hiddenstack.push(hidden1070);
+		let w1071 = w1069.$type;
+		w1071 ??= 0;
+		w1071 = ext[118].resolve(w1069, w1071);
+		w1071 = ext[119].resolve(w1069, w1071);
+		w1071 = ext[120].resolve(w1069, w1071);
+		w1071 = ext[121].resolve(w1069, w1071);
+		hidden1070.$type = w1071;
+		if (typeof w1071 != "number" || w1071 > 255 || w1071 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1071, state.scan);
+		state.scan += 1;
+		let w1072 = w1069.model;
+		if (w1072 != null) {
+			if (!Array.isArray(w1072)) { throw new Error("array expected"); }
+			let w1073 = w1072.length;
+			ext[26].write(state, w1073);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1072.length });
+			for (let i1074 = 0; i1074 < w1072.length; i1074++) {
+				let w1075 = w1072[i1074];
+				ext[2].write(state, w1075);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1076 = w1069.flag2;
+		if (w1076 != null) {
+			if (w1076 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1077 = w1069.color;
+		if (w1077 != null) {
+			if (typeof w1077 != "object" || !w1077) { throw new Error("object expected"); }
+			let hidden1078 = {};
+			state.stack.push(w1077);
+			state.hiddenstack.push(hidden1078);
+			let w1079 = w1077.$coltype;
+			w1079 ??= 0;
+			w1079 = ext[122].resolve(w1077, w1079);
+			w1079 = ext[123].resolve(w1077, w1079);
+			hidden1078.$coltype = w1079;
+			if (typeof w1079 != "number" || w1079 > 65535 || w1079 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1079, state.scan);
+			state.scan += 2;
+			let w1080 = w1077.col2;
+			if (w1080 != null) {
+				if (!Array.isArray(w1080)) { throw new Error("array expected"); }
+				let w1081 = w1080.length;
+				ext[27].write(state, w1081);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1080.length });
+				for (let i1082 = 0; i1082 < w1080.length; i1082++) {
+					let w1083 = w1080[i1082];
+					if (typeof w1083 != "number" || w1083 > 65535 || w1083 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1083, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1084 = w1077.col4;
+			if (w1084 != null) {
+				if (!Array.isArray(w1084)) { throw new Error("array expected"); }
+				let w1085 = w1084.length;
+				if (w1085 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1084.length });
+				for (let i1086 = 0; i1086 < w1084.length; i1086++) {
+					let w1087 = w1084[i1086];
+					if (!Array.isArray(w1087)) { throw new Error("array expected"); }
+					let w1088 = w1087[0];
+					if (typeof w1088 != "number" || w1088 > 65535 || w1088 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1088, state.scan);
+					state.scan += 2;
+					let w1089 = w1087[1];
+					if (typeof w1089 != "number" || w1089 > 65535 || w1089 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1089, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1090 = w1069.material;
+		if (w1090 != null) {
+			if (typeof w1090 != "object" || !w1090) { throw new Error("object expected"); }
+			let hidden1091 = {};
+			state.stack.push(w1090);
+			state.hiddenstack.push(hidden1091);
+			let w1092 = w1090.header;
+			if (typeof w1092 != "number" || w1092 > 255 || w1092 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1092, state.scan);
+			state.scan += 1;
+			let w1093 = w1090.materials;
+			if (!Array.isArray(w1093)) { throw new Error("array expected"); }
+			let w1094 = w1093.length;
+			ext[28].write(state, w1094);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1093.length });
+			for (let i1095 = 0; i1095 < w1093.length; i1095++) {
+				let w1096 = w1093[i1095];
+				if (typeof w1096 != "number" || w1096 > 65535 || w1096 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1096, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1097 = w879[7];
+	if (typeof w1097 != "object" || !w1097) { throw new Error("object expected"); }
+	let hidden1098 = {};
+	state.stack.push(w1097);
+	state.hiddenstack.push(hidden1098);
+	let w1099 = w1097.slot;
+	ext[29].write(state, w1099);
+	let w1100 = w1097.cust;
+	if (w1100 != null) {
+		if (typeof w1100 != "object" || !w1100) { throw new Error("object expected"); }
+		let hidden1101 = {};
+		state.stack.push(w1100);
+		state.hiddenstack.push(hidden1101);
+		let w1102 = w1100.$type;
+		w1102 ??= 0;
+		w1102 = ext[124].resolve(w1100, w1102);
+		w1102 = ext[125].resolve(w1100, w1102);
+		w1102 = ext[126].resolve(w1100, w1102);
+		w1102 = ext[127].resolve(w1100, w1102);
+		hidden1101.$type = w1102;
+		if (typeof w1102 != "number" || w1102 > 255 || w1102 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1102, state.scan);
+		state.scan += 1;
+		let w1103 = w1100.model;
+		if (w1103 != null) {
+			if (!Array.isArray(w1103)) { throw new Error("array expected"); }
+			let w1104 = w1103.length;
+			ext[30].write(state, w1104);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1103.length });
+			for (let i1105 = 0; i1105 < w1103.length; i1105++) {
+				let w1106 = w1103[i1105];
+				ext[2].write(state, w1106);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1107 = w1100.flag2;
+		if (w1107 != null) {
+			if (w1107 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1108 = w1100.color;
+		if (w1108 != null) {
+			if (typeof w1108 != "object" || !w1108) { throw new Error("object expected"); }
+			let hidden1109 = {};
+			state.stack.push(w1108);
+			state.hiddenstack.push(hidden1109);
+			let w1110 = w1108.$coltype;
+			w1110 ??= 0;
+			w1110 = ext[128].resolve(w1108, w1110);
+			w1110 = ext[129].resolve(w1108, w1110);
+			hidden1109.$coltype = w1110;
+			if (typeof w1110 != "number" || w1110 > 65535 || w1110 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1110, state.scan);
+			state.scan += 2;
+			let w1111 = w1108.col2;
+			if (w1111 != null) {
+				if (!Array.isArray(w1111)) { throw new Error("array expected"); }
+				let w1112 = w1111.length;
+				ext[31].write(state, w1112);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1111.length });
+				for (let i1113 = 0; i1113 < w1111.length; i1113++) {
+					let w1114 = w1111[i1113];
+					if (typeof w1114 != "number" || w1114 > 65535 || w1114 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1114, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1115 = w1108.col4;
+			if (w1115 != null) {
+				if (!Array.isArray(w1115)) { throw new Error("array expected"); }
+				let w1116 = w1115.length;
+				if (w1116 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1115.length });
+				for (let i1117 = 0; i1117 < w1115.length; i1117++) {
+					let w1118 = w1115[i1117];
+					if (!Array.isArray(w1118)) { throw new Error("array expected"); }
+					let w1119 = w1118[0];
+					if (typeof w1119 != "number" || w1119 > 65535 || w1119 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1119, state.scan);
+					state.scan += 2;
+					let w1120 = w1118[1];
+					if (typeof w1120 != "number" || w1120 > 65535 || w1120 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1120, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1121 = w1100.material;
+		if (w1121 != null) {
+			if (typeof w1121 != "object" || !w1121) { throw new Error("object expected"); }
+			let hidden1122 = {};
+			state.stack.push(w1121);
+			state.hiddenstack.push(hidden1122);
+			let w1123 = w1121.header;
+			if (typeof w1123 != "number" || w1123 > 255 || w1123 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1123, state.scan);
+			state.scan += 1;
+			let w1124 = w1121.materials;
+			if (!Array.isArray(w1124)) { throw new Error("array expected"); }
+			let w1125 = w1124.length;
+			ext[32].write(state, w1125);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1124.length });
+			for (let i1126 = 0; i1126 < w1124.length; i1126++) {
+				let w1127 = w1124[i1126];
+				if (typeof w1127 != "number" || w1127 > 65535 || w1127 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1127, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1128 = w879[8];
+	if (typeof w1128 != "object" || !w1128) { throw new Error("object expected"); }
+	let hidden1129 = {};
+	state.stack.push(w1128);
+	state.hiddenstack.push(hidden1129);
+	let w1130 = w1128.slot;
+	ext[33].write(state, w1130);
+	let w1131 = w1128.cust;
+	if (w1131 != null) {
+		if (typeof w1131 != "object" || !w1131) { throw new Error("object expected"); }
+		let hidden1132 = {};
+		state.stack.push(w1131);
+		state.hiddenstack.push(hidden1132);
+		let w1133 = w1131.$type;
+		w1133 ??= 0;
+		w1133 = ext[130].resolve(w1131, w1133);
+		w1133 = ext[131].resolve(w1131, w1133);
+		w1133 = ext[132].resolve(w1131, w1133);
+		w1133 = ext[133].resolve(w1131, w1133);
+		hidden1132.$type = w1133;
+		if (typeof w1133 != "number" || w1133 > 255 || w1133 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1133, state.scan);
+		state.scan += 1;
+		let w1134 = w1131.model;
+		if (w1134 != null) {
+			if (!Array.isArray(w1134)) { throw new Error("array expected"); }
+			let w1135 = w1134.length;
+			ext[34].write(state, w1135);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1134.length });
+			for (let i1136 = 0; i1136 < w1134.length; i1136++) {
+				let w1137 = w1134[i1136];
+				ext[2].write(state, w1137);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1138 = w1131.flag2;
+		if (w1138 != null) {
+			if (w1138 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1139 = w1131.color;
+		if (w1139 != null) {
+			if (typeof w1139 != "object" || !w1139) { throw new Error("object expected"); }
+			let hidden1140 = {};
+			state.stack.push(w1139);
+			state.hiddenstack.push(hidden1140);
+			let w1141 = w1139.$coltype;
+			w1141 ??= 0;
+			w1141 = ext[134].resolve(w1139, w1141);
+			w1141 = ext[135].resolve(w1139, w1141);
+			hidden1140.$coltype = w1141;
+			if (typeof w1141 != "number" || w1141 > 65535 || w1141 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1141, state.scan);
+			state.scan += 2;
+			let w1142 = w1139.col2;
+			if (w1142 != null) {
+				if (!Array.isArray(w1142)) { throw new Error("array expected"); }
+				let w1143 = w1142.length;
+				ext[35].write(state, w1143);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1142.length });
+				for (let i1144 = 0; i1144 < w1142.length; i1144++) {
+					let w1145 = w1142[i1144];
+					if (typeof w1145 != "number" || w1145 > 65535 || w1145 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1145, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1146 = w1139.col4;
+			if (w1146 != null) {
+				if (!Array.isArray(w1146)) { throw new Error("array expected"); }
+				let w1147 = w1146.length;
+				if (w1147 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1146.length });
+				for (let i1148 = 0; i1148 < w1146.length; i1148++) {
+					let w1149 = w1146[i1148];
+					if (!Array.isArray(w1149)) { throw new Error("array expected"); }
+					let w1150 = w1149[0];
+					if (typeof w1150 != "number" || w1150 > 65535 || w1150 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1150, state.scan);
+					state.scan += 2;
+					let w1151 = w1149[1];
+					if (typeof w1151 != "number" || w1151 > 65535 || w1151 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1151, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1152 = w1131.material;
+		if (w1152 != null) {
+			if (typeof w1152 != "object" || !w1152) { throw new Error("object expected"); }
+			let hidden1153 = {};
+			state.stack.push(w1152);
+			state.hiddenstack.push(hidden1153);
+			let w1154 = w1152.header;
+			if (typeof w1154 != "number" || w1154 > 255 || w1154 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1154, state.scan);
+			state.scan += 1;
+			let w1155 = w1152.materials;
+			if (!Array.isArray(w1155)) { throw new Error("array expected"); }
+			let w1156 = w1155.length;
+			ext[36].write(state, w1156);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1155.length });
+			for (let i1157 = 0; i1157 < w1155.length; i1157++) {
+				let w1158 = w1155[i1157];
+				if (typeof w1158 != "number" || w1158 > 65535 || w1158 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1158, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1159 = w879[9];
+	if (typeof w1159 != "object" || !w1159) { throw new Error("object expected"); }
+	let hidden1160 = {};
+	state.stack.push(w1159);
+	state.hiddenstack.push(hidden1160);
+	let w1161 = w1159.slot;
+	ext[37].write(state, w1161);
+	let w1162 = w1159.cust;
+	if (w1162 != null) {
+		if (typeof w1162 != "object" || !w1162) { throw new Error("object expected"); }
+		let hidden1163 = {};
+		state.stack.push(w1162);
+		state.hiddenstack.push(hidden1163);
+		let w1164 = w1162.$type;
+		w1164 ??= 0;
+		w1164 = ext[136].resolve(w1162, w1164);
+		w1164 = ext[137].resolve(w1162, w1164);
+		w1164 = ext[138].resolve(w1162, w1164);
+		w1164 = ext[139].resolve(w1162, w1164);
+		hidden1163.$type = w1164;
+		if (typeof w1164 != "number" || w1164 > 255 || w1164 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1164, state.scan);
+		state.scan += 1;
+		let w1165 = w1162.model;
+		if (w1165 != null) {
+			if (!Array.isArray(w1165)) { throw new Error("array expected"); }
+			let w1166 = w1165.length;
+			ext[38].write(state, w1166);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1165.length });
+			for (let i1167 = 0; i1167 < w1165.length; i1167++) {
+				let w1168 = w1165[i1167];
+				ext[2].write(state, w1168);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1169 = w1162.flag2;
+		if (w1169 != null) {
+			if (w1169 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1170 = w1162.color;
+		if (w1170 != null) {
+			if (typeof w1170 != "object" || !w1170) { throw new Error("object expected"); }
+			let hidden1171 = {};
+			state.stack.push(w1170);
+			state.hiddenstack.push(hidden1171);
+			let w1172 = w1170.$coltype;
+			w1172 ??= 0;
+			w1172 = ext[140].resolve(w1170, w1172);
+			w1172 = ext[141].resolve(w1170, w1172);
+			hidden1171.$coltype = w1172;
+			if (typeof w1172 != "number" || w1172 > 65535 || w1172 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1172, state.scan);
+			state.scan += 2;
+			let w1173 = w1170.col2;
+			if (w1173 != null) {
+				if (!Array.isArray(w1173)) { throw new Error("array expected"); }
+				let w1174 = w1173.length;
+				ext[39].write(state, w1174);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1173.length });
+				for (let i1175 = 0; i1175 < w1173.length; i1175++) {
+					let w1176 = w1173[i1175];
+					if (typeof w1176 != "number" || w1176 > 65535 || w1176 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1176, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1177 = w1170.col4;
+			if (w1177 != null) {
+				if (!Array.isArray(w1177)) { throw new Error("array expected"); }
+				let w1178 = w1177.length;
+				if (w1178 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1177.length });
+				for (let i1179 = 0; i1179 < w1177.length; i1179++) {
+					let w1180 = w1177[i1179];
+					if (!Array.isArray(w1180)) { throw new Error("array expected"); }
+					let w1181 = w1180[0];
+					if (typeof w1181 != "number" || w1181 > 65535 || w1181 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1181, state.scan);
+					state.scan += 2;
+					let w1182 = w1180[1];
+					if (typeof w1182 != "number" || w1182 > 65535 || w1182 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1182, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1183 = w1162.material;
+		if (w1183 != null) {
+			if (typeof w1183 != "object" || !w1183) { throw new Error("object expected"); }
+			let hidden1184 = {};
+			state.stack.push(w1183);
+			state.hiddenstack.push(hidden1184);
+			let w1185 = w1183.header;
+			if (typeof w1185 != "number" || w1185 > 255 || w1185 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1185, state.scan);
+			state.scan += 1;
+			let w1186 = w1183.materials;
+			if (!Array.isArray(w1186)) { throw new Error("array expected"); }
+			let w1187 = w1186.length;
+			ext[40].write(state, w1187);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1186.length });
+			for (let i1188 = 0; i1188 < w1186.length; i1188++) {
+				let w1189 = w1186[i1188];
+				if (typeof w1189 != "number" || w1189 > 65535 || w1189 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1189, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1190 = w879[10];
+	if (typeof w1190 != "object" || !w1190) { throw new Error("object expected"); }
+	let hidden1191 = {};
+	state.stack.push(w1190);
+	state.hiddenstack.push(hidden1191);
+	let w1192 = w1190.slot;
+	ext[41].write(state, w1192);
+	let w1193 = w1190.cust;
+	if (w1193 != null) {
+		if (typeof w1193 != "object" || !w1193) { throw new Error("object expected"); }
+		let hidden1194 = {};
+		state.stack.push(w1193);
+		state.hiddenstack.push(hidden1194);
+		let w1195 = w1193.$type;
+		w1195 ??= 0;
+		w1195 = ext[142].resolve(w1193, w1195);
+		w1195 = ext[143].resolve(w1193, w1195);
+		w1195 = ext[144].resolve(w1193, w1195);
+		w1195 = ext[145].resolve(w1193, w1195);
+		hidden1194.$type = w1195;
+		if (typeof w1195 != "number" || w1195 > 255 || w1195 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1195, state.scan);
+		state.scan += 1;
+		let w1196 = w1193.model;
+		if (w1196 != null) {
+			if (!Array.isArray(w1196)) { throw new Error("array expected"); }
+			let w1197 = w1196.length;
+			ext[42].write(state, w1197);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1196.length });
+			for (let i1198 = 0; i1198 < w1196.length; i1198++) {
+				let w1199 = w1196[i1198];
+				ext[2].write(state, w1199);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1200 = w1193.flag2;
+		if (w1200 != null) {
+			if (w1200 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1201 = w1193.color;
+		if (w1201 != null) {
+			if (typeof w1201 != "object" || !w1201) { throw new Error("object expected"); }
+			let hidden1202 = {};
+			state.stack.push(w1201);
+			state.hiddenstack.push(hidden1202);
+			let w1203 = w1201.$coltype;
+			w1203 ??= 0;
+			w1203 = ext[146].resolve(w1201, w1203);
+			w1203 = ext[147].resolve(w1201, w1203);
+			hidden1202.$coltype = w1203;
+			if (typeof w1203 != "number" || w1203 > 65535 || w1203 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1203, state.scan);
+			state.scan += 2;
+			let w1204 = w1201.col2;
+			if (w1204 != null) {
+				if (!Array.isArray(w1204)) { throw new Error("array expected"); }
+				let w1205 = w1204.length;
+				ext[43].write(state, w1205);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1204.length });
+				for (let i1206 = 0; i1206 < w1204.length; i1206++) {
+					let w1207 = w1204[i1206];
+					if (typeof w1207 != "number" || w1207 > 65535 || w1207 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1207, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1208 = w1201.col4;
+			if (w1208 != null) {
+				if (!Array.isArray(w1208)) { throw new Error("array expected"); }
+				let w1209 = w1208.length;
+				if (w1209 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1208.length });
+				for (let i1210 = 0; i1210 < w1208.length; i1210++) {
+					let w1211 = w1208[i1210];
+					if (!Array.isArray(w1211)) { throw new Error("array expected"); }
+					let w1212 = w1211[0];
+					if (typeof w1212 != "number" || w1212 > 65535 || w1212 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1212, state.scan);
+					state.scan += 2;
+					let w1213 = w1211[1];
+					if (typeof w1213 != "number" || w1213 > 65535 || w1213 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1213, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1214 = w1193.material;
+		if (w1214 != null) {
+			if (typeof w1214 != "object" || !w1214) { throw new Error("object expected"); }
+			let hidden1215 = {};
+			state.stack.push(w1214);
+			state.hiddenstack.push(hidden1215);
+			let w1216 = w1214.header;
+			if (typeof w1216 != "number" || w1216 > 255 || w1216 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1216, state.scan);
+			state.scan += 1;
+			let w1217 = w1214.materials;
+			if (!Array.isArray(w1217)) { throw new Error("array expected"); }
+			let w1218 = w1217.length;
+			ext[44].write(state, w1218);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1217.length });
+			for (let i1219 = 0; i1219 < w1217.length; i1219++) {
+				let w1220 = w1217[i1219];
+				if (typeof w1220 != "number" || w1220 > 65535 || w1220 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1220, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1221 = w879[11];
+	if (typeof w1221 != "object" || !w1221) { throw new Error("object expected"); }
+	let hidden1222 = {};
+	state.stack.push(w1221);
+	state.hiddenstack.push(hidden1222);
+	let w1223 = w1221.slot;
+	ext[45].write(state, w1223);
+	let w1224 = w1221.cust;
+	if (w1224 != null) {
+		if (typeof w1224 != "object" || !w1224) { throw new Error("object expected"); }
+		let hidden1225 = {};
+		state.stack.push(w1224);
+		state.hiddenstack.push(hidden1225);
+		let w1226 = w1224.$type;
+		w1226 ??= 0;
+		w1226 = ext[148].resolve(w1224, w1226);
+		w1226 = ext[149].resolve(w1224, w1226);
+		w1226 = ext[150].resolve(w1224, w1226);
+		w1226 = ext[151].resolve(w1224, w1226);
+		hidden1225.$type = w1226;
+		if (typeof w1226 != "number" || w1226 > 255 || w1226 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1226, state.scan);
+		state.scan += 1;
+		let w1227 = w1224.model;
+		if (w1227 != null) {
+			if (!Array.isArray(w1227)) { throw new Error("array expected"); }
+			let w1228 = w1227.length;
+			ext[46].write(state, w1228);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1227.length });
+			for (let i1229 = 0; i1229 < w1227.length; i1229++) {
+				let w1230 = w1227[i1229];
+				ext[2].write(state, w1230);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1231 = w1224.flag2;
+		if (w1231 != null) {
+			if (w1231 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1232 = w1224.color;
+		if (w1232 != null) {
+			if (typeof w1232 != "object" || !w1232) { throw new Error("object expected"); }
+			let hidden1233 = {};
+			state.stack.push(w1232);
+			state.hiddenstack.push(hidden1233);
+			let w1234 = w1232.$coltype;
+			w1234 ??= 0;
+			w1234 = ext[152].resolve(w1232, w1234);
+			w1234 = ext[153].resolve(w1232, w1234);
+			hidden1233.$coltype = w1234;
+			if (typeof w1234 != "number" || w1234 > 65535 || w1234 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1234, state.scan);
+			state.scan += 2;
+			let w1235 = w1232.col2;
+			if (w1235 != null) {
+				if (!Array.isArray(w1235)) { throw new Error("array expected"); }
+				let w1236 = w1235.length;
+				ext[47].write(state, w1236);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1235.length });
+				for (let i1237 = 0; i1237 < w1235.length; i1237++) {
+					let w1238 = w1235[i1237];
+					if (typeof w1238 != "number" || w1238 > 65535 || w1238 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1238, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1239 = w1232.col4;
+			if (w1239 != null) {
+				if (!Array.isArray(w1239)) { throw new Error("array expected"); }
+				let w1240 = w1239.length;
+				if (w1240 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1239.length });
+				for (let i1241 = 0; i1241 < w1239.length; i1241++) {
+					let w1242 = w1239[i1241];
+					if (!Array.isArray(w1242)) { throw new Error("array expected"); }
+					let w1243 = w1242[0];
+					if (typeof w1243 != "number" || w1243 > 65535 || w1243 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1243, state.scan);
+					state.scan += 2;
+					let w1244 = w1242[1];
+					if (typeof w1244 != "number" || w1244 > 65535 || w1244 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1244, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1245 = w1224.material;
+		if (w1245 != null) {
+			if (typeof w1245 != "object" || !w1245) { throw new Error("object expected"); }
+			let hidden1246 = {};
+			state.stack.push(w1245);
+			state.hiddenstack.push(hidden1246);
+			let w1247 = w1245.header;
+			if (typeof w1247 != "number" || w1247 > 255 || w1247 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1247, state.scan);
+			state.scan += 1;
+			let w1248 = w1245.materials;
+			if (!Array.isArray(w1248)) { throw new Error("array expected"); }
+			let w1249 = w1248.length;
+			ext[48].write(state, w1249);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1248.length });
+			for (let i1250 = 0; i1250 < w1248.length; i1250++) {
+				let w1251 = w1248[i1250];
+				if (typeof w1251 != "number" || w1251 > 65535 || w1251 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1251, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1252 = w879[12];
+	if (typeof w1252 != "object" || !w1252) { throw new Error("object expected"); }
+	let hidden1253 = {};
+	state.stack.push(w1252);
+	state.hiddenstack.push(hidden1253);
+	let w1254 = w1252.slot;
+	ext[49].write(state, w1254);
+	let w1255 = w1252.cust;
+	if (w1255 != null) {
+		if (typeof w1255 != "object" || !w1255) { throw new Error("object expected"); }
+		let hidden1256 = {};
+		state.stack.push(w1255);
+		state.hiddenstack.push(hidden1256);
+		let w1257 = w1255.$type;
+		w1257 ??= 0;
+		w1257 = ext[154].resolve(w1255, w1257);
+		w1257 = ext[155].resolve(w1255, w1257);
+		w1257 = ext[156].resolve(w1255, w1257);
+		w1257 = ext[157].resolve(w1255, w1257);
+		hidden1256.$type = w1257;
+		if (typeof w1257 != "number" || w1257 > 255 || w1257 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1257, state.scan);
+		state.scan += 1;
+		let w1258 = w1255.model;
+		if (w1258 != null) {
+			if (!Array.isArray(w1258)) { throw new Error("array expected"); }
+			let w1259 = w1258.length;
+			ext[50].write(state, w1259);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1258.length });
+			for (let i1260 = 0; i1260 < w1258.length; i1260++) {
+				let w1261 = w1258[i1260];
+				ext[2].write(state, w1261);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1262 = w1255.flag2;
+		if (w1262 != null) {
+			if (w1262 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1263 = w1255.color;
+		if (w1263 != null) {
+			if (typeof w1263 != "object" || !w1263) { throw new Error("object expected"); }
+			let hidden1264 = {};
+			state.stack.push(w1263);
+			state.hiddenstack.push(hidden1264);
+			let w1265 = w1263.$coltype;
+			w1265 ??= 0;
+			w1265 = ext[158].resolve(w1263, w1265);
+			w1265 = ext[159].resolve(w1263, w1265);
+			hidden1264.$coltype = w1265;
+			if (typeof w1265 != "number" || w1265 > 65535 || w1265 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1265, state.scan);
+			state.scan += 2;
+			let w1266 = w1263.col2;
+			if (w1266 != null) {
+				if (!Array.isArray(w1266)) { throw new Error("array expected"); }
+				let w1267 = w1266.length;
+				ext[51].write(state, w1267);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1266.length });
+				for (let i1268 = 0; i1268 < w1266.length; i1268++) {
+					let w1269 = w1266[i1268];
+					if (typeof w1269 != "number" || w1269 > 65535 || w1269 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1269, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1270 = w1263.col4;
+			if (w1270 != null) {
+				if (!Array.isArray(w1270)) { throw new Error("array expected"); }
+				let w1271 = w1270.length;
+				if (w1271 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1270.length });
+				for (let i1272 = 0; i1272 < w1270.length; i1272++) {
+					let w1273 = w1270[i1272];
+					if (!Array.isArray(w1273)) { throw new Error("array expected"); }
+					let w1274 = w1273[0];
+					if (typeof w1274 != "number" || w1274 > 65535 || w1274 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1274, state.scan);
+					state.scan += 2;
+					let w1275 = w1273[1];
+					if (typeof w1275 != "number" || w1275 > 65535 || w1275 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1275, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1276 = w1255.material;
+		if (w1276 != null) {
+			if (typeof w1276 != "object" || !w1276) { throw new Error("object expected"); }
+			let hidden1277 = {};
+			state.stack.push(w1276);
+			state.hiddenstack.push(hidden1277);
+			let w1278 = w1276.header;
+			if (typeof w1278 != "number" || w1278 > 255 || w1278 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1278, state.scan);
+			state.scan += 1;
+			let w1279 = w1276.materials;
+			if (!Array.isArray(w1279)) { throw new Error("array expected"); }
+			let w1280 = w1279.length;
+			ext[52].write(state, w1280);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1279.length });
+			for (let i1281 = 0; i1281 < w1279.length; i1281++) {
+				let w1282 = w1279[i1281];
+				if (typeof w1282 != "number" || w1282 > 65535 || w1282 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1282, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1283 = w879[13];
+	if (typeof w1283 != "object" || !w1283) { throw new Error("object expected"); }
+	let hidden1284 = {};
+	state.stack.push(w1283);
+	state.hiddenstack.push(hidden1284);
+	let w1285 = w1283.slot;
+	ext[53].write(state, w1285);
+	let w1286 = w1283.cust;
+	if (w1286 != null) {
+		if (typeof w1286 != "object" || !w1286) { throw new Error("object expected"); }
+		let hidden1287 = {};
+		state.stack.push(w1286);
+		state.hiddenstack.push(hidden1287);
+		let w1288 = w1286.$type;
+		w1288 ??= 0;
+		w1288 = ext[160].resolve(w1286, w1288);
+		w1288 = ext[161].resolve(w1286, w1288);
+		w1288 = ext[162].resolve(w1286, w1288);
+		w1288 = ext[163].resolve(w1286, w1288);
+		hidden1287.$type = w1288;
+		if (typeof w1288 != "number" || w1288 > 255 || w1288 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1288, state.scan);
+		state.scan += 1;
+		let w1289 = w1286.model;
+		if (w1289 != null) {
+			if (!Array.isArray(w1289)) { throw new Error("array expected"); }
+			let w1290 = w1289.length;
+			ext[54].write(state, w1290);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1289.length });
+			for (let i1291 = 0; i1291 < w1289.length; i1291++) {
+				let w1292 = w1289[i1291];
+				ext[2].write(state, w1292);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1293 = w1286.flag2;
+		if (w1293 != null) {
+			if (w1293 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1294 = w1286.color;
+		if (w1294 != null) {
+			if (typeof w1294 != "object" || !w1294) { throw new Error("object expected"); }
+			let hidden1295 = {};
+			state.stack.push(w1294);
+			state.hiddenstack.push(hidden1295);
+			let w1296 = w1294.$coltype;
+			w1296 ??= 0;
+			w1296 = ext[164].resolve(w1294, w1296);
+			w1296 = ext[165].resolve(w1294, w1296);
+			hidden1295.$coltype = w1296;
+			if (typeof w1296 != "number" || w1296 > 65535 || w1296 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1296, state.scan);
+			state.scan += 2;
+			let w1297 = w1294.col2;
+			if (w1297 != null) {
+				if (!Array.isArray(w1297)) { throw new Error("array expected"); }
+				let w1298 = w1297.length;
+				ext[55].write(state, w1298);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1297.length });
+				for (let i1299 = 0; i1299 < w1297.length; i1299++) {
+					let w1300 = w1297[i1299];
+					if (typeof w1300 != "number" || w1300 > 65535 || w1300 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1300, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1301 = w1294.col4;
+			if (w1301 != null) {
+				if (!Array.isArray(w1301)) { throw new Error("array expected"); }
+				let w1302 = w1301.length;
+				if (w1302 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1301.length });
+				for (let i1303 = 0; i1303 < w1301.length; i1303++) {
+					let w1304 = w1301[i1303];
+					if (!Array.isArray(w1304)) { throw new Error("array expected"); }
+					let w1305 = w1304[0];
+					if (typeof w1305 != "number" || w1305 > 65535 || w1305 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1305, state.scan);
+					state.scan += 2;
+					let w1306 = w1304[1];
+					if (typeof w1306 != "number" || w1306 > 65535 || w1306 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1306, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1307 = w1286.material;
+		if (w1307 != null) {
+			if (typeof w1307 != "object" || !w1307) { throw new Error("object expected"); }
+			let hidden1308 = {};
+			state.stack.push(w1307);
+			state.hiddenstack.push(hidden1308);
+			let w1309 = w1307.header;
+			if (typeof w1309 != "number" || w1309 > 255 || w1309 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1309, state.scan);
+			state.scan += 1;
+			let w1310 = w1307.materials;
+			if (!Array.isArray(w1310)) { throw new Error("array expected"); }
+			let w1311 = w1310.length;
+			ext[56].write(state, w1311);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1310.length });
+			for (let i1312 = 0; i1312 < w1310.length; i1312++) {
+				let w1313 = w1310[i1312];
+				if (typeof w1313 != "number" || w1313 > 65535 || w1313 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1313, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1314 = w879[14];
+	if (typeof w1314 != "object" || !w1314) { throw new Error("object expected"); }
+	let hidden1315 = {};
+	state.stack.push(w1314);
+	state.hiddenstack.push(hidden1315);
+	let w1316 = w1314.slot;
+	ext[57].write(state, w1316);
+	let w1317 = w1314.cust;
+	if (w1317 != null) {
+		if (typeof w1317 != "object" || !w1317) { throw new Error("object expected"); }
+		let hidden1318 = {};
+		state.stack.push(w1317);
+		state.hiddenstack.push(hidden1318);
+		let w1319 = w1317.$type;
+		w1319 ??= 0;
+		w1319 = ext[166].resolve(w1317, w1319);
+		w1319 = ext[167].resolve(w1317, w1319);
+		w1319 = ext[168].resolve(w1317, w1319);
+		w1319 = ext[169].resolve(w1317, w1319);
+		hidden1318.$type = w1319;
+		if (typeof w1319 != "number" || w1319 > 255 || w1319 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1319, state.scan);
+		state.scan += 1;
+		let w1320 = w1317.model;
+		if (w1320 != null) {
+			if (!Array.isArray(w1320)) { throw new Error("array expected"); }
+			let w1321 = w1320.length;
+			ext[58].write(state, w1321);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1320.length });
+			for (let i1322 = 0; i1322 < w1320.length; i1322++) {
+				let w1323 = w1320[i1322];
+				ext[2].write(state, w1323);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1324 = w1317.flag2;
+		if (w1324 != null) {
+			if (w1324 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1325 = w1317.color;
+		if (w1325 != null) {
+			if (typeof w1325 != "object" || !w1325) { throw new Error("object expected"); }
+			let hidden1326 = {};
+			state.stack.push(w1325);
+			state.hiddenstack.push(hidden1326);
+			let w1327 = w1325.$coltype;
+			w1327 ??= 0;
+			w1327 = ext[170].resolve(w1325, w1327);
+			w1327 = ext[171].resolve(w1325, w1327);
+			hidden1326.$coltype = w1327;
+			if (typeof w1327 != "number" || w1327 > 65535 || w1327 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1327, state.scan);
+			state.scan += 2;
+			let w1328 = w1325.col2;
+			if (w1328 != null) {
+				if (!Array.isArray(w1328)) { throw new Error("array expected"); }
+				let w1329 = w1328.length;
+				ext[59].write(state, w1329);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1328.length });
+				for (let i1330 = 0; i1330 < w1328.length; i1330++) {
+					let w1331 = w1328[i1330];
+					if (typeof w1331 != "number" || w1331 > 65535 || w1331 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1331, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1332 = w1325.col4;
+			if (w1332 != null) {
+				if (!Array.isArray(w1332)) { throw new Error("array expected"); }
+				let w1333 = w1332.length;
+				if (w1333 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1332.length });
+				for (let i1334 = 0; i1334 < w1332.length; i1334++) {
+					let w1335 = w1332[i1334];
+					if (!Array.isArray(w1335)) { throw new Error("array expected"); }
+					let w1336 = w1335[0];
+					if (typeof w1336 != "number" || w1336 > 65535 || w1336 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1336, state.scan);
+					state.scan += 2;
+					let w1337 = w1335[1];
+					if (typeof w1337 != "number" || w1337 > 65535 || w1337 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1337, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1338 = w1317.material;
+		if (w1338 != null) {
+			if (typeof w1338 != "object" || !w1338) { throw new Error("object expected"); }
+			let hidden1339 = {};
+			state.stack.push(w1338);
+			state.hiddenstack.push(hidden1339);
+			let w1340 = w1338.header;
+			if (typeof w1340 != "number" || w1340 > 255 || w1340 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1340, state.scan);
+			state.scan += 1;
+			let w1341 = w1338.materials;
+			if (!Array.isArray(w1341)) { throw new Error("array expected"); }
+			let w1342 = w1341.length;
+			ext[60].write(state, w1342);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1341.length });
+			for (let i1343 = 0; i1343 < w1341.length; i1343++) {
+				let w1344 = w1341[i1343];
+				if (typeof w1344 != "number" || w1344 > 65535 || w1344 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1344, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1345 = w879[15];
+	if (typeof w1345 != "object" || !w1345) { throw new Error("object expected"); }
+	let hidden1346 = {};
+	state.stack.push(w1345);
+	state.hiddenstack.push(hidden1346);
+	let w1347 = w1345.slot;
+	ext[61].write(state, w1347);
+	let w1348 = w1345.cust;
+	if (w1348 != null) {
+		if (typeof w1348 != "object" || !w1348) { throw new Error("object expected"); }
+		let hidden1349 = {};
+		state.stack.push(w1348);
+		state.hiddenstack.push(hidden1349);
+		let w1350 = w1348.$type;
+		w1350 ??= 0;
+		w1350 = ext[172].resolve(w1348, w1350);
+		w1350 = ext[173].resolve(w1348, w1350);
+		w1350 = ext[174].resolve(w1348, w1350);
+		w1350 = ext[175].resolve(w1348, w1350);
+		hidden1349.$type = w1350;
+		if (typeof w1350 != "number" || w1350 > 255 || w1350 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w1350, state.scan);
+		state.scan += 1;
+		let w1351 = w1348.model;
+		if (w1351 != null) {
+			if (!Array.isArray(w1351)) { throw new Error("array expected"); }
+			let w1352 = w1351.length;
+			ext[62].write(state, w1352);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1351.length });
+			for (let i1353 = 0; i1353 < w1351.length; i1353++) {
+				let w1354 = w1351[i1353];
+				ext[2].write(state, w1354);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w1355 = w1348.flag2;
+		if (w1355 != null) {
+			if (w1355 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		let w1356 = w1348.color;
+		if (w1356 != null) {
+			if (typeof w1356 != "object" || !w1356) { throw new Error("object expected"); }
+			let hidden1357 = {};
+			state.stack.push(w1356);
+			state.hiddenstack.push(hidden1357);
+			let w1358 = w1356.$coltype;
+			w1358 ??= 0;
+			w1358 = ext[176].resolve(w1356, w1358);
+			w1358 = ext[177].resolve(w1356, w1358);
+			hidden1357.$coltype = w1358;
+			if (typeof w1358 != "number" || w1358 > 65535 || w1358 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w1358, state.scan);
+			state.scan += 2;
+			let w1359 = w1356.col2;
+			if (w1359 != null) {
+				if (!Array.isArray(w1359)) { throw new Error("array expected"); }
+				let w1360 = w1359.length;
+				ext[63].write(state, w1360);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1359.length });
+				for (let i1361 = 0; i1361 < w1359.length; i1361++) {
+					let w1362 = w1359[i1361];
+					if (typeof w1362 != "number" || w1362 > 65535 || w1362 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1362, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			let w1363 = w1356.col4;
+			if (w1363 != null) {
+				if (!Array.isArray(w1363)) { throw new Error("array expected"); }
+				let w1364 = w1363.length;
+				if (w1364 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w1363.length });
+				for (let i1365 = 0; i1365 < w1363.length; i1365++) {
+					let w1366 = w1363[i1365];
+					if (!Array.isArray(w1366)) { throw new Error("array expected"); }
+					let w1367 = w1366[0];
+					if (typeof w1367 != "number" || w1367 > 65535 || w1367 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1367, state.scan);
+					state.scan += 2;
+					let w1368 = w1366[1];
+					if (typeof w1368 != "number" || w1368 > 65535 || w1368 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w1368, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w1369 = w1348.material;
+		if (w1369 != null) {
+			if (typeof w1369 != "object" || !w1369) { throw new Error("object expected"); }
+			let hidden1370 = {};
+			state.stack.push(w1369);
+			state.hiddenstack.push(hidden1370);
+			let w1371 = w1369.header;
+			if (typeof w1371 != "number" || w1371 > 255 || w1371 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w1371, state.scan);
+			state.scan += 1;
+			let w1372 = w1369.materials;
+			if (!Array.isArray(w1372)) { throw new Error("array expected"); }
+			let w1373 = w1372.length;
+			ext[64].write(state, w1373);
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w1372.length });
+			for (let i1374 = 0; i1374 < w1372.length; i1374++) {
+				let w1375 = w1372[i1374];
+				if (typeof w1375 != "number" || w1375 > 65535 || w1375 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w1375, state.scan);
+				state.scan += 2;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w1376 = value.haircol0;
+	if (typeof w1376 != "number" || w1376 > 255 || w1376 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1376, state.scan);
+	state.scan += 1;
+	let w1377 = value.bodycol;
+	if (typeof w1377 != "number" || w1377 > 255 || w1377 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1377, state.scan);
+	state.scan += 1;
+	let w1378 = value.legscol;
+	if (typeof w1378 != "number" || w1378 > 255 || w1378 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1378, state.scan);
+	state.scan += 1;
+	let w1379 = value.bootscol;
+	if (typeof w1379 != "number" || w1379 > 255 || w1379 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1379, state.scan);
+	state.scan += 1;
+	let w1380 = value.skincol0;
+	if (typeof w1380 != "number" || w1380 > 255 || w1380 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1380, state.scan);
+	state.scan += 1;
+	let w1381 = value.skincol1;
+	if (typeof w1381 != "number" || w1381 > 255 || w1381 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1381, state.scan);
+	state.scan += 1;
+	let w1382 = value.haircol1;
+	if (typeof w1382 != "number" || w1382 > 255 || w1382 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w1382, state.scan);
+	state.scan += 1;
+	let w1383 = value.unkbuf;
+	ext[65].write(state, w1383);
+	let w1384 = value.stance;
+	if (typeof w1384 != "number" || w1384 > 65535 || w1384 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w1384, state.scan);
+	state.scan += 2;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,161 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\avatars.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x8546d48f;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.gender = v2; }
+	let v3 = ext[0].read(state);
+	if (v3 !== undefined) { hidden1.$avatype = v3; }
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$avatype;
+	let match5 = -1;
+	if (ref4 != -1) { match5 = 0; }
+	let v6 = null;
+	if (match5 != -1) {
+		let obj7 = {};
+		let hidden8 = {};
+		state.stack.push(obj7);
+		state.hiddenstack.push(hidden8);
+		let ref9 = state.hiddenstack[state.hiddenstack.length - 2].$avatype;
+		ref9 = ref9 + 0;
+		let v10 = ext[1].read(state);
+		let v11 = ext[2].read(state);
+		let v12 = ext[3].read(state);
+		let v13 = ext[4].read(state);
+		let v14 = ext[5].read(state);
+		let v15 = ext[6].read(state);
+		let v16 = ext[7].read(state);
+		let v17 = ext[8].read(state);
+		let v18 = ext[9].read(state);
+		let v19 = ext[10].read(state);
+		let v20 = ext[11].read(state);
+		let v21 = ext[12].read(state);
+		let v22 = ext[13].read(state);
+		let v23 = ext[14].read(state);
+		let v24 = ext[15].read(state);
+		let arr25 = [ref9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24];
+		if (arr25 !== undefined) { obj7.slots = arr25; }
+		let v26 = ext[16].read(state);
+		if (v26 !== undefined) { obj7.rest = v26; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v6 = obj7;
+	}
+	if (v6 !== undefined) { obj0.player = v6; }
+	let ref27 = state.hiddenstack[state.hiddenstack.length - 1].$avatype;
+	let match28 = -1;
+	if (ref27 == -1) { match28 = 0; }
+	let v29 = null;
+	if (match28 != -1) {
+		let obj30 = {};
+		let hidden31 = {};
+		state.stack.push(obj30);
+		state.hiddenstack.push(hidden31);
+		let v32 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v32 !== undefined) { obj30.id = v32; }
+		let v33 = ext[17].read(state);
+		if (v33 !== undefined) { obj30.buf = v33; }
+		let v34 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v34 !== undefined) { obj30.unkff = v34; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v29 = obj30;
+	}
+	if (v29 !== undefined) { obj0.npc = v29; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden35 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden35);
+	let w36 = value.gender;
+	if (typeof w36 != "number" || w36 > 255 || w36 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w36, state.scan);
+	state.scan += 1;
+	let w37 = value.$avatype;
+	w37 ??= 0;
+	w37 = ext[18].resolve(value, w37);
+	w37 = ext[19].resolve(value, w37);
+	w37 = ext[20].resolve(value, w37);
+	hidden35.$avatype = w37;
+	ext[0].write(state, w37);
+	let w38 = value.player;
+	if (w38 != null) {
+		if (typeof w38 != "object" || !w38) { throw new Error("object expected"); }
+		let hidden39 = {};
+		state.stack.push(w38);
+		state.hiddenstack.push(hidden39);
+		let w40 = w38.slots;
+		if (!Array.isArray(w40)) { throw new Error("array expected"); }
+		let w41 = w40[0];
+		let w42 = w40[1];
+		ext[1].write(state, w42);
+		let w43 = w40[2];
+		ext[2].write(state, w43);
+		let w44 = w40[3];
+		ext[3].write(state, w44);
+		let w45 = w40[4];
+		ext[4].write(state, w45);
+		let w46 = w40[5];
+		ext[5].write(state, w46);
+		let w47 = w40[6];
+		ext[6].write(state, w47);
+		let w48 = w40[7];
+		ext[7].write(state, w48);
+		let w49 = w40[8];
+		ext[8].write(state, w49);
+		let w50 = w40[9];
+		ext[9].write(state, w50);
+		let w51 = w40[10];
+		ext[10].write(state, w51);
+		let w52 = w40[11];
+		ext[11].write(state, w52);
+		let w53 = w40[12];
+		ext[12].write(state, w53);
+		let w54 = w40[13];
+		ext[13].write(state, w54);
+		let w55 = w40[14];
+		ext[14].write(state, w55);
+		let w56 = w40[15];
+		ext[15].write(state, w56);
+		let w57 = w38.rest;
+		ext[16].write(state, w57);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w58 = value.npc;
+	if (w58 != null) {
+		if (typeof w58 != "object" || !w58) { throw new Error("object expected"); }
+		let hidden59 = {};
+		state.stack.push(w58);
+		state.hiddenstack.push(hidden59);
+		let w60 = w58.id;
+		if (typeof w60 != "number" || w60 > 65535 || w60 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w60, state.scan);
+		state.scan += 2;
+		let w61 = w58.buf;
+		ext[17].write(state, w61);
+		let w62 = w58.unkff;
+		if (typeof w62 != "number" || w62 > 65535 || w62 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w62, state.scan);
+		state.scan += 2;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
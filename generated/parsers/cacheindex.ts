@@ -0,0 +1,91 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\cacheindex.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xe4f682b4;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.format = v2; }
+	let hidden3 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden3);
+	let ref4 = state.stack[state.stack.length - 2].format;
+	ref4 = ref4 + 0;
+	hidden3.$opcode = ref4;
+	let ref5 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match6 = -1;
+	if (ref5 >= 6) { match6 = 0; }
+	else if (true) { match6 = 1; }
+	if (match6 == -1) { throw new Error("no opcode matched"); }
+	let v7;
+	if (match6 == 0) {
+		let v8 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		v7 = v8;
+	}
+	else if (match6 == 1) {
+		v7 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v7 !== undefined) { obj0.timestamp = v7; }
+	let v9 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v9 !== undefined) { obj0.flags = v9; }
+	if (0 !== undefined) { hidden1.$minorindex = 0; }
+	let v10 = ext[0].read(state);
+	if (v10 !== undefined) { obj0.indices = v10; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden11 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden11);
+	let w12 = value.format;
+	if (typeof w12 != "number" || w12 > 255 || w12 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w12, state.scan);
+	state.scan += 1;
+	let w13 = value.timestamp;
+	let hidden14 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden14);
+	hidden14.$opcode = ext[1].readConst(state);
+	let ref15 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match16 = -1;
+	if (ref15 >= 6) { match16 = 0; }
+	else if (true) { match16 = 1; }
+	if (match16 == -1) { throw new Error("no opcode matched"); }
+	if (match16 == 0) {
+		if (typeof w13 != "number" || w13 > 4294967295 || w13 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w13, state.scan);
+		state.scan += 4;
+	}
+	else if (match16 == 1) {
+		if (w13 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w17 = value.flags;
+	if (typeof w17 != "number" || w17 > 255 || w17 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w17, state.scan);
+	state.scan += 1;
+	let w18 = value.$minorindex;
+	w18 = ext[2].readConst(state);
+	hidden11.$minorindex = w18;
+	if (w18 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	let w19 = value.indices;
+	ext[0].write(state, w19);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,127 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\classicmodels.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x2f018f29;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v2 !== undefined) { obj0.vertexcount = v2; }
+	let v3 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v3 !== undefined) { obj0.facecount = v3; }
+	let ref4 = state.stack[state.stack.length - 1].vertexcount;
+	ref4 = ref4 + 0;
+	let hidden5 = { $index: 0, $length: ref4 };
+	state.hiddenstack.push(hidden5);
+	state.stack.push({});
+	let arr6 = [];
+	for (let i7 = 0; i7 < ref4; i7++) {
+		hidden5.$index = i7;
+		let v8 = state.view.getInt16(state.scan);
+		state.scan += 2;
+		arr6.push(v8);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr6 !== undefined) { obj0.xpos = arr6; }
+	let ref9 = state.stack[state.stack.length - 1].vertexcount;
+	ref9 = ref9 + 0;
+	let hidden10 = { $index: 0, $length: ref9 };
+	state.hiddenstack.push(hidden10);
+	state.stack.push({});
+	let arr11 = [];
+	for (let i12 = 0; i12 < ref9; i12++) {
+		hidden10.$index = i12;
+		let v13 = state.view.getInt16(state.scan);
+		state.scan += 2;
+		arr11.push(v13);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr11 !== undefined) { obj0.ypos = arr11; }
+	let ref14 = state.stack[state.stack.length - 1].vertexcount;
+	ref14 = ref14 + 0;
+	let hidden15 = { $index: 0, $length: ref14 };
+	state.hiddenstack.push(hidden15);
+	state.stack.push({});
+	let arr16 = [];
+	for (let i17 = 0; i17 < ref14; i17++) {
+		hidden15.$index = i17;
+		let v18 = state.view.getInt16(state.scan);
+		state.scan += 2;
+		arr16.push(v18);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr16 !== undefined) { obj0.zpos = arr16; }
+	let v19 = ext[0].read(state);
+	if (v19 !== undefined) { obj0.faces = v19; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden20 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden20);
+	let w21 = value.vertexcount;
+	if (typeof w21 != "number" || w21 > 65535 || w21 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w21, state.scan);
+	state.scan += 2;
+	let w22 = value.facecount;
+	if (typeof w22 != "number" || w22 > 65535 || w22 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w22, state.scan);
+	state.scan += 2;
+	let w23 = value.xpos;
+	if (!Array.isArray(w23)) { throw new Error("array expected"); }
+	let w24 = w23.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w23.length });
+	for (let i25 = 0; i25 < w23.length; i25++) {
+		let w26 = w23[i25];
+		if (typeof w26 != "number" || w26 > 32767 || w26 < -32768) { throw new Error(); }
+		state.buffer.writeInt16BE(w26, state.scan);
+		state.scan += 2;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w27 = value.ypos;
+	if (!Array.isArray(w27)) { throw new Error("array expected"); }
+	let w28 = w27.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w27.length });
+	for (let i29 = 0; i29 < w27.length; i29++) {
+		let w30 = w27[i29];
+		if (typeof w30 != "number" || w30 > 32767 || w30 < -32768) { throw new Error(); }
+		state.buffer.writeInt16BE(w30, state.scan);
+		state.scan += 2;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w31 = value.zpos;
+	if (!Array.isArray(w31)) { throw new Error("array expected"); }
+	let w32 = w31.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w31.length });
+	for (let i33 = 0; i33 < w31.length; i33++) {
+		let w34 = w31[i33];
+		if (typeof w34 != "number" || w34 > 32767 || w34 < -32768) { throw new Error(); }
+		state.buffer.writeInt16BE(w34, state.scan);
+		state.scan += 2;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w35 = value.faces;
+	ext[0].write(state, w35);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,904 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\client_cutscenes.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x8cbd16e1;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = ext[0].read(state);
+	if (v2 !== undefined) { obj0.head = v2; }
+	let v3 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden4 = { $index: 0, $length: v3 };
+	state.hiddenstack.push(hidden4);
+	state.stack.push({});
+	let arr5 = [];
+	for (let i6 = 0; i6 < v3; i6++) {
+		hidden4.$index = i6;
+		let obj7 = {};
+		let hidden8 = {};
+		state.stack.push(obj7);
+		state.hiddenstack.push(hidden8);
+		let v9 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v9 !== undefined) { obj7.src_chunk = v9; }
+		let ref10 = state.stack[state.stack.length - 1].src_chunk;
+		ref10 = (ref10 >> 28) & 7;
+		ref10 = ref10 + 0;
+		if (ref10 !== undefined) { obj7.src_level = ref10; }
+		let ref11 = state.stack[state.stack.length - 1].src_chunk;
+		ref11 = (ref11 >> 20) & 255;
+		ref11 = ref11 + 0;
+		if (ref11 !== undefined) { obj7.src_chunkx = ref11; }
+		let ref12 = state.stack[state.stack.length - 1].src_chunk;
+		ref12 = (ref12 >> 6) & 255;
+		ref12 = ref12 + 0;
+		if (ref12 !== undefined) { obj7.src_chunkz = ref12; }
+		let v13 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v13 !== undefined) { obj7.sizex = v13; }
+		let v14 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v14 !== undefined) { obj7.sizez = v14; }
+		let v15 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v15 !== undefined) { obj7.dst_plane = v15; }
+		let v16 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v16 !== undefined) { obj7.dst_x = v16; }
+		let v17 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v17 !== undefined) { obj7.dst_z = v17; }
+		let v18 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v18 !== undefined) { obj7.unk0 = v18; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr5.push(obj7);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr5 !== undefined) { obj0.mapsquares = arr5; }
+	let v19 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden20 = { $index: 0, $length: v19 };
+	state.hiddenstack.push(hidden20);
+	state.stack.push({});
+	let arr21 = [];
+	for (let i22 = 0; i22 < v19; i22++) {
+		hidden20.$index = i22;
+		let v23 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden24 = { $index: 0, $length: v23 };
+		state.hiddenstack.push(hidden24);
+		state.stack.push({});
+		let arr25 = [];
+		for (let i26 = 0; i26 < v23; i26++) {
+			hidden24.$index = i26;
+			let obj27 = {};
+			let hidden28 = {};
+			state.stack.push(obj27);
+			state.hiddenstack.push(hidden28);
+			let v29 = ext[1].read(state);
+			if (v29 !== undefined) { obj27.v = v29; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr25.push(obj27);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		arr21.push(arr25);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr21 !== undefined) { obj0.arr2 = arr21; }
+	let v30 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden31 = { $index: 0, $length: v30 };
+	state.hiddenstack.push(hidden31);
+	state.stack.push({});
+	let arr32 = [];
+	for (let i33 = 0; i33 < v30; i33++) {
+		hidden31.$index = i33;
+		let obj34 = {};
+		let hidden35 = {};
+		state.stack.push(obj34);
+		state.hiddenstack.push(hidden35);
+		let v36 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v36 !== undefined) { obj34.type = v36; }
+		let ref37 = state.stack[state.stack.length - 1].type;
+		let match38 = -1;
+		if (ref37 == 0) { match38 = 0; }
+		let v39 = null;
+		if (match38 != -1) {
+			let v40 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v39 = v40;
+		}
+		if (v39 !== undefined) { obj34.npcid = v39; }
+		let v41 = ext[2].read(state);
+		if (v41 !== undefined) { obj34.name = v41; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr32.push(obj34);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr32 !== undefined) { obj0.npcs = arr32; }
+	let v42 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden43 = { $index: 0, $length: v42 };
+	state.hiddenstack.push(hidden43);
+	state.stack.push({});
+	let arr44 = [];
+	for (let i45 = 0; i45 < v42; i45++) {
+		hidden43.$index = i45;
+		let v46 = ext[3].read(state);
+		let v47 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let arr48 = [v46, v47];
+		arr44.push(arr48);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr44 !== undefined) { obj0.locs = arr44; }
+	let v49 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden50 = { $index: 0, $length: v49 };
+	state.hiddenstack.push(hidden50);
+	state.stack.push({});
+	let arr51 = [];
+	for (let i52 = 0; i52 < v49; i52++) {
+		hidden50.$index = i52;
+		let v53 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden54 = { $index: 0, $length: v53 };
+		state.hiddenstack.push(hidden54);
+		state.stack.push({});
+		let arr55 = [];
+		for (let i56 = 0; i56 < v53; i56++) {
+			hidden54.$index = i56;
+			let obj57 = {};
+			let hidden58 = {};
+			state.stack.push(obj57);
+			state.hiddenstack.push(hidden58);
+			let v59 = ext[4].read(state);
+			if (v59 !== undefined) { obj57.v = v59; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr55.push(obj57);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		arr51.push(arr55);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr51 !== undefined) { obj0.arr5 = arr51; }
+	let v60 = ext[5].read(state);
+	let hidden61 = { $index: 0, $length: v60 };
+	state.hiddenstack.push(hidden61);
+	state.stack.push({});
+	let arr62 = [];
+	for (let i63 = 0; i63 < v60; i63++) {
+		hidden61.$index = i63;
+		let obj64 = {};
+		let hidden65 = {};
+		state.stack.push(obj64);
+		state.hiddenstack.push(hidden65);
+		let v66 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v66 !== undefined) { obj64.op = v66; }
+		let v67 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v67 !== undefined) { obj64.time = v67; }
+		let hidden68 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden68);
+		let ref69 = state.stack[state.stack.length - 2].op;
+		ref69 = ref69 + 0;
+		hidden68.$opcode = ref69;
+		let ref70 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match71 = -1;
+		if (ref70 == 1) { match71 = 0; }
+		else if (ref70 == 10) { match71 = 1; }
+		else if (ref70 == 11) { match71 = 2; }
+		else if (ref70 == 12) { match71 = 3; }
+		else if (ref70 == 14) { match71 = 4; }
+		else if (ref70 == 17) { match71 = 5; }
+		else if (ref70 == 20) { match71 = 6; }
+		else if (ref70 == 21) { match71 = 7; }
+		else if (ref70 == 22) { match71 = 8; }
+		else if (ref70 == 30) { match71 = 9; }
+		else if (ref70 == 33) { match71 = 10; }
+		else if (ref70 == 40) { match71 = 11; }
+		else if (ref70 == 70) { match71 = 12; }
+		else if (ref70 == 255) { match71 = 13; }
+		if (match71 == -1) { throw new Error("no opcode matched"); }
+		let v72;
+		if (match71 == 0) {
+			let obj73 = {};
+			let hidden74 = {};
+			state.stack.push(obj73);
+			state.hiddenstack.push(hidden74);
+			let v75 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v75 !== undefined) { obj73.arr2_index = v75; }
+			let v76 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v76 !== undefined) { obj73.arr2_index2 = v76; }
+			let v77 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v77 !== undefined) { obj73.sub1 = v77; }
+			let v78 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v78 !== undefined) { obj73.sub2 = v78; }
+			let v79 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v79 !== undefined) { obj73.unk1 = v79; }
+			let v80 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v80 !== undefined) { obj73.unk2 = v80; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj73;
+		}
+		else if (match71 == 1) {
+			let obj81 = {};
+			let hidden82 = {};
+			state.stack.push(obj81);
+			state.hiddenstack.push(hidden82);
+			let v83 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v83 !== undefined) { obj81.npcindex = v83; }
+			let v84 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v84 !== undefined) { obj81.x = v84; }
+			let v85 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v85 !== undefined) { obj81.z = v85; }
+			let v86 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v86 !== undefined) { obj81.unkbyte = v86; }
+			let v87 = ext[5].read(state);
+			if (v87 !== undefined) { obj81.end = v87; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj81;
+		}
+		else if (match71 == 2) {
+			let obj88 = {};
+			let hidden89 = {};
+			state.stack.push(obj88);
+			state.hiddenstack.push(hidden89);
+			let v90 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v90 !== undefined) { obj88.npcindex = v90; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj88;
+		}
+		else if (match71 == 3) {
+			let obj91 = {};
+			let hidden92 = {};
+			state.stack.push(obj91);
+			state.hiddenstack.push(hidden92);
+			let v93 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v93 !== undefined) { obj91.npcindex = v93; }
+			let v94 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v94 !== undefined) { obj91.arr2_5_index = v94; }
+			let v95 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v95 !== undefined) { obj91.subindex2 = v95; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj91;
+		}
+		else if (match71 == 4) {
+			let obj96 = {};
+			let hidden97 = {};
+			state.stack.push(obj96);
+			state.hiddenstack.push(hidden97);
+			let v98 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v98 !== undefined) { obj96.npcindex = v98; }
+			let v99 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v99 !== undefined) { obj96.seq = v99; }
+			let v100 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v100 !== undefined) { obj96.always0 = v100; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj96;
+		}
+		else if (match71 == 5) {
+			let v101 = ext[6].read(state);
+			v72 = v101;
+		}
+		else if (match71 == 6) {
+			let obj102 = {};
+			let hidden103 = {};
+			state.stack.push(obj102);
+			state.hiddenstack.push(hidden103);
+			let v104 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v104 !== undefined) { obj102.locindex = v104; }
+			let v105 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v105 !== undefined) { obj102.x = v105; }
+			let v106 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v106 !== undefined) { obj102.z = v106; }
+			let v107 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v107 !== undefined) { obj102.plane = v107; }
+			let v108 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v108 !== undefined) { obj102.rotation = v108; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj102;
+		}
+		else if (match71 == 7) {
+			let obj109 = {};
+			let hidden110 = {};
+			state.stack.push(obj109);
+			state.hiddenstack.push(hidden110);
+			let v111 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v111 !== undefined) { obj109.locindex = v111; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj109;
+		}
+		else if (match71 == 8) {
+			let obj112 = {};
+			let hidden113 = {};
+			state.stack.push(obj112);
+			state.hiddenstack.push(hidden113);
+			let v114 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v114 !== undefined) { obj112.npcindex = v114; }
+			let v115 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v115 !== undefined) { obj112.end = v115; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj112;
+		}
+		else if (match71 == 9) {
+			let obj116 = {};
+			let hidden117 = {};
+			state.stack.push(obj116);
+			state.hiddenstack.push(hidden117);
+			let v118 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v118 !== undefined) { obj116.unk0 = v118; }
+			let v119 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v119 !== undefined) { obj116.alwaysff = v119; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj116;
+		}
+		else if (match71 == 10) {
+			let obj120 = {};
+			let hidden121 = {};
+			state.stack.push(obj120);
+			state.hiddenstack.push(hidden121);
+			let v122 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v122 !== undefined) { obj120.sound = v122; }
+			let v123 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v123 !== undefined) { obj120.unk0 = v123; }
+			let v124 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v124 !== undefined) { obj120.unk1 = v124; }
+			let v125 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v125 !== undefined) { obj120.always1 = v125; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj120;
+		}
+		else if (match71 == 11) {
+			let v126 = ext[7].read(state);
+			v72 = v126;
+		}
+		else if (match71 == 12) {
+			let obj127 = {};
+			let hidden128 = {};
+			state.stack.push(obj127);
+			state.hiddenstack.push(hidden128);
+			let v129 = ext[2].read(state);
+			if (v129 !== undefined) { obj127.text = v129; }
+			let v130 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v130 !== undefined) { obj127.unk1 = v130; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v72 = obj127;
+		}
+		else if (match71 == 13) {
+			v72 = true;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v72 !== undefined) { obj64.v = v72; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr62.push(obj64);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr62 !== undefined) { obj0.keyframes = arr62; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden131 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden131);
+	let w132 = value.head;
+	ext[0].write(state, w132);
+	let w133 = value.mapsquares;
+	if (!Array.isArray(w133)) { throw new Error("array expected"); }
+	let w134 = w133.length;
+	if (typeof w134 != "number" || w134 > 255 || w134 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w134, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w133.length });
+	for (let i135 = 0; i135 < w133.length; i135++) {
+		let w136 = w133[i135];
+		if (typeof w136 != "object" || !w136) { throw new Error("object expected"); }
+		let hidden137 = {};
+		state.stack.push(w136);
+		state.hiddenstack.push(hidden137);
+		let w138 = w136.src_chunk;
+		if (typeof w138 != "number" || w138 > 4294967295 || w138 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w138, state.scan);
+		state.scan += 4;
+		let w139 = w136.src_level;
+		let w140 = w136.src_chunkx;
+		let w141 = w136.src_chunkz;
+		let w142 = w136.sizex;
+		if (typeof w142 != "number" || w142 > 255 || w142 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w142, state.scan);
+		state.scan += 1;
+		let w143 = w136.sizez;
+		if (typeof w143 != "number" || w143 > 255 || w143 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w143, state.scan);
+		state.scan += 1;
+		let w144 = w136.dst_plane;
+		if (typeof w144 != "number" || w144 > 255 || w144 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w144, state.scan);
+		state.scan += 1;
+		let w145 = w136.dst_x;
+		if (typeof w145 != "number" || w145 > 255 || w145 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w145, state.scan);
+		state.scan += 1;
+		let w146 = w136.dst_z;
+		if (typeof w146 != "number" || w146 > 255 || w146 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w146, state.scan);
+		state.scan += 1;
+		let w147 = w136.unk0;
+		if (typeof w147 != "number" || w147 > 255 || w147 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w147, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w148 = value.arr2;
+	if (!Array.isArray(w148)) { throw new Error("array expected"); }
+	let w149 = w148.length;
+	if (typeof w149 != "number" || w149 > 255 || w149 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w149, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w148.length });
+	for (let i150 = 0; i150 < w148.length; i150++) {
+		let w151 = w148[i150];
+		if (!Array.isArray(w151)) { throw new Error("array expected"); }
+		let w152 = w151.length;
+		if (typeof w152 != "number" || w152 > 255 || w152 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w152, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w151.length });
+		for (let i153 = 0; i153 < w151.length; i153++) {
+			let w154 = w151[i153];
+			if (typeof w154 != "object" || !w154) { throw new Error("object expected"); }
+			let hidden155 = {};
+			state.stack.push(w154);
+			state.hiddenstack.push(hidden155);
+			let w156 = w154.v;
+			ext[1].write(state, w156);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w157 = value.npcs;
+	if (!Array.isArray(w157)) { throw new Error("array expected"); }
+	let w158 = w157.length;
+	if (typeof w158 != "number" || w158 > 255 || w158 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w158, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w157.length });
+	for (let i159 = 0; i159 < w157.length; i159++) {
+		let w160 = w157[i159];
+		if (typeof w160 != "object" || !w160) { throw new Error("object expected"); }
+		let hidden161 = {};
+		state.stack.push(w160);
+		state.hiddenstack.push(hidden161);
+		let w162 = w160.type;
+		if (typeof w162 != "number" || w162 > 255 || w162 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w162, state.scan);
+		state.scan += 1;
+		let w163 = w160.npcid;
+		if (w163 != null) {
+			if (typeof w163 != "number" || w163 > 65535 || w163 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w163, state.scan);
+			state.scan += 2;
+		}
+		let w164 = w160.name;
+		ext[2].write(state, w164);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w165 = value.locs;
+	if (!Array.isArray(w165)) { throw new Error("array expected"); }
+	let w166 = w165.length;
+	if (typeof w166 != "number" || w166 > 255 || w166 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w166, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w165.length });
+	for (let i167 = 0; i167 < w165.length; i167++) {
+		let w168 = w165[i167];
+		if (!Array.isArray(w168)) { throw new Error("array expected"); }
+		let w169 = w168[0];
+		ext[3].write(state, w169);
+		let w170 = w168[1];
+		if (typeof w170 != "number" || w170 > 255 || w170 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w170, state.scan);
+		state.scan += 1;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w171 = value.arr5;
+	if (!Array.isArray(w171)) { throw new Error("array expected"); }
+	let w172 = w171.length;
+	if (typeof w172 != "number" || w172 > 255 || w172 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w172, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w171.length });
+	for (let i173 = 0; i173 < w171.length; i173++) {
+		let w174 = w171[i173];
+		if (!Array.isArray(w174)) { throw new Error("array expected"); }
+		let w175 = w174.length;
+		if (typeof w175 != "number" || w175 > 255 || w175 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w175, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w174.length });
+		for (let i176 = 0; i176 < w174.length; i176++) {
+			let w177 = w174[i176];
+			if (typeof w177 != "object" || !w177) { throw new Error("object expected"); }
+			let hidden178 = {};
+			state.stack.push(w177);
+			state.hiddenstack.push(hidden178);
+			let w179 = w177.v;
+			ext[4].write(state, w179);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w180 = value.keyframes;
+	if (!Array.isArray(w180)) { throw new Error("array expected"); }
+	let w181 = w180.length;
+	ext[5].write(state, w181);
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w180.length });
+	for (let i182 = 0; i182 < w180.length; i182++) {
+		let w183 = w180[i182];
+		if (typeof w183 != "object" || !w183) { throw new Error("object expected"); }
+		let hidden184 = {};
+		state.stack.push(w183);
+		state.hiddenstack.push(hidden184);
+		let w185 = w183.op;
+		if (typeof w185 != "number" || w185 > 255 || w185 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w185, state.scan);
+		state.scan += 1;
+		let w186 = w183.time;
+		if (typeof w186 != "number" || w186 > 65535 || w186 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w186, state.scan);
+		state.scan += 2;
+		let w187 = w183.v;
+		let hidden188 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden188);
+		hidden188.$opcode = ext[8].readConst(state);
+		let ref189 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match190 = -1;
+		if (ref189 == 1) { match190 = 0; }
+		else if (ref189 == 10) { match190 = 1; }
+		else if (ref189 == 11) { match190 = 2; }
+		else if (ref189 == 12) { match190 = 3; }
+		else if (ref189 == 14) { match190 = 4; }
+		else if (ref189 == 17) { match190 = 5; }
+		else if (ref189 == 20) { match190 = 6; }
+		else if (ref189 == 21) { match190 = 7; }
+		else if (ref189 == 22) { match190 = 8; }
+		else if (ref189 == 30) { match190 = 9; }
+		else if (ref189 == 33) { match190 = 10; }
+		else if (ref189 == 40) { match190 = 11; }
+		else if (ref189 == 70) { match190 = 12; }
+		else if (ref189 == 255) { match190 = 13; }
+		if (match190 == -1) { throw new Error("no opcode matched"); }
+		if (match190 == 0) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden191 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden191);
+			let w192 = w187.arr2_index;
+			if (typeof w192 != "number" || w192 > 65535 || w192 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w192, state.scan);
+			state.scan += 2;
+			let w193 = w187.arr2_index2;
+			if (typeof w193 != "number" || w193 > 65535 || w193 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w193, state.scan);
+			state.scan += 2;
+			let w194 = w187.sub1;
+			if (typeof w194 != "number" || w194 > 65535 || w194 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w194, state.scan);
+			state.scan += 2;
+			let w195 = w187.sub2;
+			if (typeof w195 != "number" || w195 > 65535 || w195 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w195, state.scan);
+			state.scan += 2;
+			let w196 = w187.unk1;
+			if (typeof w196 != "number" || w196 > 65535 || w196 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w196, state.scan);
+			state.scan += 2;
+			let w197 = w187.unk2;
+			if (typeof w197 != "number" || w197 > 65535 || w197 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w197, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 1) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden198 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden198);
+			let w199 = w187.npcindex;
+			if (typeof w199 != "number" || w199 > 65535 || w199 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w199, state.scan);
+			state.scan += 2;
+			let w200 = w187.x;
+			if (typeof w200 != "number" || w200 > 65535 || w200 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w200, state.scan);
+			state.scan += 2;
+			let w201 = w187.z;
+			if (typeof w201 != "number" || w201 > 65535 || w201 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w201, state.scan);
+			state.scan += 2;
+			let w202 = w187.unkbyte;
+			if (typeof w202 != "number" || w202 > 255 || w202 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w202, state.scan);
+			state.scan += 1;
+			let w203 = w187.end;
+			ext[5].write(state, w203);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 2) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden204 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden204);
+			let w205 = w187.npcindex;
+			if (typeof w205 != "number" || w205 > 65535 || w205 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w205, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 3) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden206 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden206);
+			let w207 = w187.npcindex;
+			if (typeof w207 != "number" || w207 > 65535 || w207 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w207, state.scan);
+			state.scan += 2;
+			let w208 = w187.arr2_5_index;
+			if (typeof w208 != "number" || w208 > 65535 || w208 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w208, state.scan);
+			state.scan += 2;
+			let w209 = w187.subindex2;
+			if (typeof w209 != "number" || w209 > 255 || w209 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w209, state.scan);
+			state.scan += 1;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 4) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden210 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden210);
+			let w211 = w187.npcindex;
+			if (typeof w211 != "number" || w211 > 65535 || w211 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w211, state.scan);
+			state.scan += 2;
+			let w212 = w187.seq;
+			if (typeof w212 != "number" || w212 > 65535 || w212 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w212, state.scan);
+			state.scan += 2;
+			let w213 = w187.always0;
+			if (typeof w213 != "number" || w213 > 4294967295 || w213 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w213, state.scan);
+			state.scan += 4;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 5) {
+			ext[6].write(state, w187);
+		}
+		else if (match190 == 6) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden214 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden214);
+			let w215 = w187.locindex;
+			if (typeof w215 != "number" || w215 > 65535 || w215 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w215, state.scan);
+			state.scan += 2;
+			let w216 = w187.x;
+			if (typeof w216 != "number" || w216 > 65535 || w216 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w216, state.scan);
+			state.scan += 2;
+			let w217 = w187.z;
+			if (typeof w217 != "number" || w217 > 65535 || w217 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w217, state.scan);
+			state.scan += 2;
+			let w218 = w187.plane;
+			if (typeof w218 != "number" || w218 > 255 || w218 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w218, state.scan);
+			state.scan += 1;
+			let w219 = w187.rotation;
+			if (typeof w219 != "number" || w219 > 255 || w219 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w219, state.scan);
+			state.scan += 1;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 7) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden220 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden220);
+			let w221 = w187.locindex;
+			if (typeof w221 != "number" || w221 > 65535 || w221 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w221, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 8) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden222 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden222);
+			let w223 = w187.npcindex;
+			if (typeof w223 != "number" || w223 > 65535 || w223 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w223, state.scan);
+			state.scan += 2;
+			let w224 = w187.end;
+			if (typeof w224 != "number" || w224 > 65535 || w224 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w224, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 9) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden225 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden225);
+			let w226 = w187.unk0;
+			if (typeof w226 != "number" || w226 > 65535 || w226 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w226, state.scan);
+			state.scan += 2;
+			let w227 = w187.alwaysff;
+			if (typeof w227 != "number" || w227 > 255 || w227 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w227, state.scan);
+			state.scan += 1;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 10) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden228 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden228);
+			let w229 = w187.sound;
+			if (typeof w229 != "number" || w229 > 65535 || w229 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w229, state.scan);
+			state.scan += 2;
+			let w230 = w187.unk0;
+			if (typeof w230 != "number" || w230 > 255 || w230 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w230, state.scan);
+			state.scan += 1;
+			let w231 = w187.unk1;
+			if (typeof w231 != "number" || w231 > 255 || w231 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w231, state.scan);
+			state.scan += 1;
+			let w232 = w187.always1;
+			if (typeof w232 != "number" || w232 > 255 || w232 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w232, state.scan);
+			state.scan += 1;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 11) {
+			ext[7].write(state, w187);
+		}
+		else if (match190 == 12) {
+			if (typeof w187 != "object" || !w187) { throw new Error("object expected"); }
+			let hidden233 = {};
+			state.stack.push(w187);
+			state.hiddenstack.push(hidden233);
+			let w234 = w187.text;
+			ext[2].write(state, w234);
+			let w235 = w187.unk1;
+			if (typeof w235 != "number" || w235 > 65535 || w235 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w235, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match190 == 13) {
+			if (w187 != true) { throw new Error("expected constant true was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
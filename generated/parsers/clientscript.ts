@@ -0,0 +1,93 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\clientscript.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x2abe84a3;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.byte0 = v2; }
+	let v3 = ext[0].read(state);
+	if (v3 !== undefined) { obj0.switchsize = v3; }
+	let v4 = ext[1].read(state);
+	if (v4 !== undefined) { obj0.switches = v4; }
+	let v5 = ext[2].read(state);
+	if (v5 !== undefined) { obj0.longargcount = v5; }
+	let v6 = ext[3].read(state);
+	if (v6 !== undefined) { obj0.stringargcount = v6; }
+	let v7 = ext[4].read(state);
+	if (v7 !== undefined) { obj0.intargcount = v7; }
+	let v8 = ext[5].read(state);
+	if (v8 !== undefined) { obj0.locallongcount = v8; }
+	let v9 = ext[6].read(state);
+	if (v9 !== undefined) { obj0.localstringcount = v9; }
+	let v10 = ext[7].read(state);
+	if (v10 !== undefined) { obj0.localintcount = v10; }
+	let v11 = ext[8].read(state);
+	if (v11 !== undefined) { obj0.instructioncount = v11; }
+	let ref12 = state.stack[state.stack.length - 1].instructioncount;
+	ref12 = ref12 + 0;
+	let hidden13 = { $index: 0, $length: ref12 };
+	state.hiddenstack.push(hidden13);
+	state.stack.push({});
+	let arr14 = [];
+	for (let i15 = 0; i15 < ref12; i15++) {
+		hidden13.$index = i15;
+		let v16 = ext[9].read(state);
+		arr14.push(v16);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr14 !== undefined) { obj0.opcodedata = arr14; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden17 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden17);
+	let w18 = value.byte0;
+	if (typeof w18 != "number" || w18 > 255 || w18 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w18, state.scan);
+	state.scan += 1;
+	let w19 = value.switchsize;
+	ext[0].write(state, w19);
+	let w20 = value.switches;
+	ext[1].write(state, w20);
+	let w21 = value.longargcount;
+	ext[2].write(state, w21);
+	let w22 = value.stringargcount;
+	ext[3].write(state, w22);
+	let w23 = value.intargcount;
+	ext[4].write(state, w23);
+	let w24 = value.locallongcount;
+	ext[5].write(state, w24);
+	let w25 = value.localstringcount;
+	ext[6].write(state, w25);
+	let w26 = value.localintcount;
+	ext[7].write(state, w26);
+	let w27 = value.instructioncount;
+	ext[8].write(state, w27);
+	let w28 = value.opcodedata;
+	if (!Array.isArray(w28)) { throw new Error("array expected"); }
+	let w29 = w28.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w28.length });
+	for (let i30 = 0; i30 < w28.length; i30++) {
+		let w31 = w28[i30];
+		ext[9].write(state, w31);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,212 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\clientscriptdata.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x0fe9770a;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 > 458) { match5 = 0; }
+	else if (true) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v6 = v7;
+	}
+	else if (match5 == 1) {
+		v6 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.byte0 = v6; }
+	let hidden8 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden8);
+	let v9 = ext[1].read(state);
+	hidden8.$opcode = v9;
+	let ref10 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match11 = -1;
+	if (ref10 >= 495) { match11 = 0; }
+	else if (true) { match11 = 1; }
+	if (match11 == -1) { throw new Error("no opcode matched"); }
+	let v12;
+	if (match11 == 0) {
+		let v13 = ext[2].read(state);
+		v12 = v13;
+	}
+	else if (match11 == 1) {
+		v12 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v12 !== undefined) { obj0.switchsize = v12; }
+	let v14 = ext[3].read(state);
+	if (v14 !== undefined) { obj0.switches = v14; }
+	let hidden15 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden15);
+	let v16 = ext[4].read(state);
+	hidden15.$opcode = v16;
+	let ref17 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match18 = -1;
+	if (ref17 > 641) { match18 = 0; }
+	else if (true) { match18 = 1; }
+	if (match18 == -1) { throw new Error("no opcode matched"); }
+	let v19;
+	if (match18 == 0) {
+		let v20 = ext[5].read(state);
+		v19 = v20;
+	}
+	else if (match18 == 1) {
+		v19 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v19 !== undefined) { obj0.longargcount = v19; }
+	let v21 = ext[6].read(state);
+	if (v21 !== undefined) { obj0.stringargcount = v21; }
+	let v22 = ext[7].read(state);
+	if (v22 !== undefined) { obj0.intargcount = v22; }
+	let hidden23 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden23);
+	let v24 = ext[8].read(state);
+	hidden23.$opcode = v24;
+	let ref25 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match26 = -1;
+	if (ref25 > 641) { match26 = 0; }
+	else if (true) { match26 = 1; }
+	if (match26 == -1) { throw new Error("no opcode matched"); }
+	let v27;
+	if (match26 == 0) {
+		let v28 = ext[9].read(state);
+		v27 = v28;
+	}
+	else if (match26 == 1) {
+		v27 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v27 !== undefined) { obj0.locallongcount = v27; }
+	let v29 = ext[10].read(state);
+	if (v29 !== undefined) { obj0.localstringcount = v29; }
+	let v30 = ext[11].read(state);
+	if (v30 !== undefined) { obj0.localintcount = v30; }
+	let v31 = ext[12].read(state);
+	if (v31 !== undefined) { obj0.instructioncount = v31; }
+	let v32 = ext[13].read(state);
+	if (v32 !== undefined) { obj0.opcodedata = v32; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden33 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden33);
+	let w34 = value.byte0;
+	let hidden35 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden35);
+	hidden35.$opcode = ext[0].readConst(state);
+	let ref36 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match37 = -1;
+	if (ref36 > 458) { match37 = 0; }
+	else if (true) { match37 = 1; }
+	if (match37 == -1) { throw new Error("no opcode matched"); }
+	if (match37 == 0) {
+		if (typeof w34 != "number" || w34 > 255 || w34 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w34, state.scan);
+		state.scan += 1;
+	}
+	else if (match37 == 1) {
+		if (w34 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w38 = value.switchsize;
+	let hidden39 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden39);
+	hidden39.$opcode = ext[1].readConst(state);
+	let ref40 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match41 = -1;
+	if (ref40 >= 495) { match41 = 0; }
+	else if (true) { match41 = 1; }
+	if (match41 == -1) { throw new Error("no opcode matched"); }
+	if (match41 == 0) {
+		ext[2].write(state, w38);
+	}
+	else if (match41 == 1) {
+		if (w38 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w42 = value.switches;
+	ext[3].write(state, w42);
+	let w43 = value.longargcount;
+	let hidden44 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden44);
+	hidden44.$opcode = ext[4].readConst(state);
+	let ref45 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match46 = -1;
+	if (ref45 > 641) { match46 = 0; }
+	else if (true) { match46 = 1; }
+	if (match46 == -1) { throw new Error("no opcode matched"); }
+	if (match46 == 0) {
+		ext[5].write(state, w43);
+	}
+	else if (match46 == 1) {
+		if (w43 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w47 = value.stringargcount;
+	ext[6].write(state, w47);
+	let w48 = value.intargcount;
+	ext[7].write(state, w48);
+	let w49 = value.locallongcount;
+	let hidden50 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden50);
+	hidden50.$opcode = ext[8].readConst(state);
+	let ref51 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match52 = -1;
+	if (ref51 > 641) { match52 = 0; }
+	else if (true) { match52 = 1; }
+	if (match52 == -1) { throw new Error("no opcode matched"); }
+	if (match52 == 0) {
+		ext[9].write(state, w49);
+	}
+	else if (match52 == 1) {
+		if (w49 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w53 = value.localstringcount;
+	ext[10].write(state, w53);
+	let w54 = value.localintcount;
+	ext[11].write(state, w54);
+	let w55 = value.instructioncount;
+	ext[12].write(state, w55);
+	let w56 = value.opcodedata;
+	ext[13].write(state, w56);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
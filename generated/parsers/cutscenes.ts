@@ -0,0 +1,511 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\cutscenes.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xb3d4cdf3;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.version = v2; }
+	let v3 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v3 !== undefined) { obj0.width = v3; }
+	let v4 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v4 !== undefined) { obj0.height = v4; }
+	let v5 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v5 !== undefined) { obj0.unkhead = v5; }
+	let v6 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden7 = { $index: 0, $length: v6 };
+	state.hiddenstack.push(hidden7);
+	state.stack.push({});
+	let arr8 = [];
+	for (let i9 = 0; i9 < v6; i9++) {
+		hidden7.$index = i9;
+		let obj10 = {};
+		let hidden11 = {};
+		state.stack.push(obj10);
+		state.hiddenstack.push(hidden11);
+		let v12 = ext[0].read(state);
+		if (v12 !== undefined) { obj10.name = v12; }
+		let v13 = state.view.getFloat32(state.scan);
+		state.scan += 4;
+		if (v13 !== undefined) { obj10.start = v13; }
+		let v14 = state.view.getFloat32(state.scan);
+		state.scan += 4;
+		if (v14 !== undefined) { obj10.end = v14; }
+		let v15 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v15 !== undefined) { obj10.numgraphics = v15; }
+		let ref16 = state.stack[state.stack.length - 1].numgraphics;
+		ref16 = ref16 + 0;
+		let hidden17 = { $index: 0, $length: ref16 };
+		state.hiddenstack.push(hidden17);
+		state.stack.push({});
+		let arr18 = [];
+		for (let i19 = 0; i19 < ref16; i19++) {
+			hidden17.$index = i19;
+			let obj20 = {};
+			let hidden21 = {};
+			state.stack.push(obj20);
+			state.hiddenstack.push(hidden21);
+			let v22 = ext[0].read(state);
+			if (v22 !== undefined) { obj20.spritename = v22; }
+			let v23 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v23 !== undefined) { obj20.height = v23; }
+			let v24 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v24 !== undefined) { obj20.width = v24; }
+			let v25 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v25 !== undefined) { obj20.unk = v25; }
+			let v26 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v26 !== undefined) { obj20.spriteid = v26; }
+			let v27 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden28 = { $index: 0, $length: v27 };
+			state.hiddenstack.push(hidden28);
+			state.stack.push({});
+			let arr29 = [];
+			for (let i30 = 0; i30 < v27; i30++) {
+				hidden28.$index = i30;
+				let v31 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v32 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let arr33 = [v31, v32];
+				arr29.push(arr33);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr29 !== undefined) { obj20.opacityframes = arr29; }
+			let v34 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden35 = { $index: 0, $length: v34 };
+			state.hiddenstack.push(hidden35);
+			state.stack.push({});
+			let arr36 = [];
+			for (let i37 = 0; i37 < v34; i37++) {
+				hidden35.$index = i37;
+				let v38 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v39 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let arr40 = [v38, v39];
+				arr36.push(arr40);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr36 !== undefined) { obj20.rotateframes = arr36; }
+			let v41 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden42 = { $index: 0, $length: v41 };
+			state.hiddenstack.push(hidden42);
+			state.stack.push({});
+			let arr43 = [];
+			for (let i44 = 0; i44 < v41; i44++) {
+				hidden42.$index = i44;
+				let v45 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v46 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v47 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let arr48 = [v45, v46, v47];
+				arr43.push(arr48);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr43 !== undefined) { obj20.translateframes = arr43; }
+			let v49 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden50 = { $index: 0, $length: v49 };
+			state.hiddenstack.push(hidden50);
+			state.stack.push({});
+			let arr51 = [];
+			for (let i52 = 0; i52 < v49; i52++) {
+				hidden50.$index = i52;
+				let v53 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v54 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let v55 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let arr56 = [v53, v54, v55];
+				arr51.push(arr56);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr51 !== undefined) { obj20.scaleframes = arr51; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr18.push(obj20);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		if (arr18 !== undefined) { obj10.graphics = arr18; }
+		let v57 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v57 !== undefined) { obj10.flag1 = v57; }
+		let ref58 = state.stack[state.stack.length - 1].flag1;
+		let match59 = -1;
+		if (ref58 != 0) { match59 = 0; }
+		let v60 = null;
+		if (match59 != -1) {
+			let v61 = ext[0].read(state);
+			v60 = v61;
+		}
+		if (v60 !== undefined) { obj10.sound = v60; }
+		let v62 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v62 !== undefined) { obj10.hassubtitle = v62; }
+		let ref63 = state.stack[state.stack.length - 1].hassubtitle;
+		let match64 = -1;
+		if (ref63 != 0) { match64 = 0; }
+		let v65 = null;
+		if (match64 != -1) {
+			let v66 = ext[0].read(state);
+			v65 = v66;
+		}
+		if (v65 !== undefined) { obj10.subtitle = v65; }
+		let ref67 = state.stack[state.stack.length - 1].numgraphics;
+		let match68 = -1;
+		if (ref67 == 0) { match68 = 0; }
+		let v69 = null;
+		if (match68 != -1) {
+			let v70 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v69 = v70;
+		}
+		if (v69 !== undefined) { obj10.unkbyte = v69; }
+		let ref71 = state.stack[state.stack.length - 1].numgraphics;
+		let match72 = -1;
+		if (ref71 == 0) { match72 = 0; }
+		let v73 = null;
+		if (match72 != -1) {
+			let v74 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v73 = v74;
+		}
+		if (v73 !== undefined) { obj10.soundid = v73; }
+		let hidden75 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden75);
+		let ref76 = state.stack[state.stack.length - 2].numgraphics;
+		ref76 = ref76 + 0;
+		hidden75.$opcode = ref76;
+		let ref77 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match78 = -1;
+		if (ref77 == 0) { match78 = 0; }
+		else if (true) { match78 = 1; }
+		if (match78 == -1) { throw new Error("no opcode matched"); }
+		let v79;
+		if (match78 == 0) {
+			let v80 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v79 = v80;
+		}
+		else if (match78 == 1) {
+			v79 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v79 !== undefined) { obj10.subtitleid = v79; }
+		let ref81 = state.stack[state.stack.length - 1].subtitleid;
+		let match82 = -1;
+		if (ref81 != 0) { match82 = 0; }
+		let v83 = null;
+		if (match82 != -1) {
+			let obj84 = {};
+			let hidden85 = {};
+			state.stack.push(obj84);
+			state.hiddenstack.push(hidden85);
+			let v86 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			if (v86 !== undefined) { obj84.start = v86; }
+			let v87 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			if (v87 !== undefined) { obj84.end = v87; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v83 = obj84;
+		}
+		if (v83 !== undefined) { obj10.subtitletimes = v83; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr8.push(obj10);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr8 !== undefined) { obj0.elements = arr8; }
+	let v88 = ext[1].read(state);
+	if (v88 !== undefined) { obj0.paddingbytes = v88; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden89 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden89);
+	let w90 = value.version;
+	if (typeof w90 != "number" || w90 > 255 || w90 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w90, state.scan);
+	state.scan += 1;
+	let w91 = value.width;
+	if (typeof w91 != "number" || w91 > 65535 || w91 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w91, state.scan);
+	state.scan += 2;
+	let w92 = value.height;
+	if (typeof w92 != "number" || w92 > 65535 || w92 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w92, state.scan);
+	state.scan += 2;
+	let w93 = value.unkhead;
+	if (typeof w93 != "number" || w93 > 65535 || w93 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w93, state.scan);
+	state.scan += 2;
+	let w94 = value.elements;
+	if (!Array.isArray(w94)) { throw new Error("array expected"); }
+	let w95 = w94.length;
+	if (typeof w95 != "number" || w95 > 255 || w95 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w95, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w94.length });
+	for (let i96 = 0; i96 < w94.length; i96++) {
+		let w97 = w94[i96];
+		if (typeof w97 != "object" || !w97) { throw new Error("object expected"); }
+		let hidden98 = {};
+		state.stack.push(w97);
+		state.hiddenstack.push(hidden98);
+		let w99 = w97.name;
+		ext[0].write(state, w99);
+		let w100 = w97.start;
+		if (typeof w100 != "number" || w100 > 1.7976931348623157e+308 || w100 < 5e-324) { throw new Error(); }
+		state.buffer.writeFloatBE(w100, state.scan);
+		state.scan += 4;
+		let w101 = w97.end;
+		if (typeof w101 != "number" || w101 > 1.7976931348623157e+308 || w101 < 5e-324) { throw new Error(); }
+		state.buffer.writeFloatBE(w101, state.scan);
+		state.scan += 4;
+		let w102 = w97.numgraphics;
+		if (typeof w102 != "number" || w102 > 255 || w102 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w102, state.scan);
+		state.scan += 1;
+		let w103 = w97.graphics;
+		if (!Array.isArray(w103)) { throw new Error("array expected"); }
+		let w104 = w103.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w103.length });
+		for (let i105 = 0; i105 < w103.length; i105++) {
+			let w106 = w103[i105];
+			if (typeof w106 != "object" || !w106) { throw new Error("object expected"); }
+			let hidden107 = {};
+			state.stack.push(w106);
+			state.hiddenstack.push(hidden107);
+			let w108 = w106.spritename;
+			ext[0].write(state, w108);
+			let w109 = w106.height;
+			if (typeof w109 != "number" || w109 > 65535 || w109 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w109, state.scan);
+			state.scan += 2;
+			let w110 = w106.width;
+			if (typeof w110 != "number" || w110 > 65535 || w110 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w110, state.scan);
+			state.scan += 2;
+			let w111 = w106.unk;
+			if (typeof w111 != "number" || w111 > 65535 || w111 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w111, state.scan);
+			state.scan += 2;
+			let w112 = w106.spriteid;
+			if (typeof w112 != "number" || w112 > 65535 || w112 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w112, state.scan);
+			state.scan += 2;
+			let w113 = w106.opacityframes;
+			if (!Array.isArray(w113)) { throw new Error("array expected"); }
+			let w114 = w113.length;
+			if (typeof w114 != "number" || w114 > 255 || w114 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w114, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w113.length });
+			for (let i115 = 0; i115 < w113.length; i115++) {
+				let w116 = w113[i115];
+				if (!Array.isArray(w116)) { throw new Error("array expected"); }
+				let w117 = w116[0];
+				if (typeof w117 != "number" || w117 > 1.7976931348623157e+308 || w117 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w117, state.scan);
+				state.scan += 4;
+				let w118 = w116[1];
+				if (typeof w118 != "number" || w118 > 1.7976931348623157e+308 || w118 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w118, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			let w119 = w106.rotateframes;
+			if (!Array.isArray(w119)) { throw new Error("array expected"); }
+			let w120 = w119.length;
+			if (typeof w120 != "number" || w120 > 255 || w120 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w120, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w119.length });
+			for (let i121 = 0; i121 < w119.length; i121++) {
+				let w122 = w119[i121];
+				if (!Array.isArray(w122)) { throw new Error("array expected"); }
+				let w123 = w122[0];
+				if (typeof w123 != "number" || w123 > 1.7976931348623157e+308 || w123 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w123, state.scan);
+				state.scan += 4;
+				let w124 = w122[1];
+				if (typeof w124 != "number" || w124 > 1.7976931348623157e+308 || w124 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w124, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			let w125 = w106.translateframes;
+			if (!Array.isArray(w125)) { throw new Error("array expected"); }
+			let w126 = w125.length;
+			if (typeof w126 != "number" || w126 > 255 || w126 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w126, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w125.length });
+			for (let i127 = 0; i127 < w125.length; i127++) {
+				let w128 = w125[i127];
+				if (!Array.isArray(w128)) { throw new Error("array expected"); }
+				let w129 = w128[0];
+				if (typeof w129 != "number" || w129 > 1.7976931348623157e+308 || w129 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w129, state.scan);
+				state.scan += 4;
+				let w130 = w128[1];
+				if (typeof w130 != "number" || w130 > 1.7976931348623157e+308 || w130 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w130, state.scan);
+				state.scan += 4;
+				let w131 = w128[2];
+				if (typeof w131 != "number" || w131 > 1.7976931348623157e+308 || w131 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w131, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			let w132 = w106.scaleframes;
+			if (!Array.isArray(w132)) { throw new Error("array expected"); }
+			let w133 = w132.length;
+			if (typeof w133 != "number" || w133 > 255 || w133 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w133, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w132.length });
+			for (let i134 = 0; i134 < w132.length; i134++) {
+				let w135 = w132[i134];
+				if (!Array.isArray(w135)) { throw new Error("array expected"); }
+				let w136 = w135[0];
+				if (typeof w136 != "number" || w136 > 1.7976931348623157e+308 || w136 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w136, state.scan);
+				state.scan += 4;
+				let w137 = w135[1];
+				if (typeof w137 != "number" || w137 > 1.7976931348623157e+308 || w137 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w137, state.scan);
+				state.scan += 4;
+				let w138 = w135[2];
+				if (typeof w138 != "number" || w138 > 1.7976931348623157e+308 || w138 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w138, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		let w139 = w97.flag1;
+		if (typeof w139 != "number" || w139 > 255 || w139 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w139, state.scan);
+		state.scan += 1;
+		let w140 = w97.sound;
+		if (w140 != null) {
+			ext[0].write(state, w140);
+		}
+		let w141 = w97.hassubtitle;
+		if (typeof w141 != "number" || w141 > 255 || w141 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w141, state.scan);
+		state.scan += 1;
+		let w142 = w97.subtitle;
+		if (w142 != null) {
+			ext[0].write(state, w142);
+		}
+		let w143 = w97.unkbyte;
+		if (w143 != null) {
+			if (typeof w143 != "number" || w143 > 255 || w143 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w143, state.scan);
+			state.scan += 1;
+		}
+		let w144 = w97.soundid;
+		if (w144 != null) {
+			if (typeof w144 != "number" || w144 > 65535 || w144 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w144, state.scan);
+			state.scan += 2;
+		}
+		let w145 = w97.subtitleid;
+		let hidden146 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden146);
+		hidden146.$opcode = ext[2].readConst(state);
+		let ref147 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match148 = -1;
+		if (ref147 == 0) { match148 = 0; }
+		else if (true) { match148 = 1; }
+		if (match148 == -1) { throw new Error("no opcode matched"); }
+		if (match148 == 0) {
+			if (typeof w145 != "number" || w145 > 255 || w145 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w145, state.scan);
+			state.scan += 1;
+		}
+		else if (match148 == 1) {
+			if (w145 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w149 = w97.subtitletimes;
+		if (w149 != null) {
+			if (typeof w149 != "object" || !w149) { throw new Error("object expected"); }
+			let hidden150 = {};
+			state.stack.push(w149);
+			state.hiddenstack.push(hidden150);
+			let w151 = w149.start;
+			if (typeof w151 != "number" || w151 > 1.7976931348623157e+308 || w151 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w151, state.scan);
+			state.scan += 4;
+			let w152 = w149.end;
+			if (typeof w152 != "number" || w152 > 1.7976931348623157e+308 || w152 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w152, state.scan);
+			state.scan += 4;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w153 = value.paddingbytes;
+	ext[1].write(state, w153);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,93 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\dbrows.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd91ab318;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 3: {
+				let obj3 = {};
+				let hidden4 = {};
+				state.stack.push(obj3);
+				state.hiddenstack.push(hidden4);
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v5 !== undefined) { obj3.columncount = v5; }
+				let v6 = ext[0].read(state);
+				if (v6 !== undefined) { obj3.columndata = v6; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.rows = obj3;
+				break;
+			}
+			case 4: {
+				let v7 = ext[1].read(state);
+				obj0.table = v7;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key8 in value) {
+		if (key8.startsWith("$")) { continue; }
+		switch (key8) {
+			case "rows": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w9 = value[key8];
+				if (typeof w9 != "object" || !w9) { throw new Error("object expected"); }
+				let hidden10 = {};
+				state.stack.push(w9);
+				state.hiddenstack.push(hidden10);
+				let w11 = w9.columncount;
+				if (typeof w11 != "number" || w11 > 255 || w11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w11, state.scan);
+				state.scan += 1;
+				let w12 = w9.columndata;
+				ext[0].write(state, w12);
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "table": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w13 = value[key8];
+				ext[1].write(state, w13);
+				break;
+			}
+			default: throw new Error("unknown property " + key8);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,93 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\dbtables.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xa2a075e8;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.version = v2; }
+	let ref3 = state.stack[state.stack.length - 1].version;
+	let match4 = -1;
+	if (ref3 >= 2) { match4 = 0; }
+	let v5 = null;
+	if (match4 != -1) {
+		let v6 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		v5 = v6;
+	}
+	if (v5 !== undefined) { obj0.unkint = v5; }
+	let ref7 = state.stack[state.stack.length - 1].version;
+	let match8 = -1;
+	if (ref7 != 0) { match8 = 0; }
+	let v9 = null;
+	if (match8 != -1) {
+		let v10 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v9 = v10;
+	}
+	if (v9 !== undefined) { obj0.cols = v9; }
+	let ref11 = state.stack[state.stack.length - 1].version;
+	let match12 = -1;
+	if (ref11 != 0) { match12 = 0; }
+	let v13 = null;
+	if (match12 != -1) {
+		let v14 = ext[0].read(state);
+		v13 = v14;
+	}
+	if (v13 !== undefined) { obj0.columndata = v13; }
+	let ref15 = state.stack[state.stack.length - 1].version;
+	let match16 = -1;
+	if (ref15 != 0) { match16 = 0; }
+	let v17 = null;
+	if (match16 != -1) {
+		let v18 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v17 = v18;
+	}
+	if (v17 !== undefined) { obj0.nullbyte = v17; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden19 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden19);
+	let w20 = value.version;
+	if (typeof w20 != "number" || w20 > 255 || w20 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w20, state.scan);
+	state.scan += 1;
+	let w21 = value.unkint;
+	if (w21 != null) {
+		if (typeof w21 != "number" || w21 > 4294967295 || w21 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w21, state.scan);
+		state.scan += 4;
+	}
+	let w22 = value.cols;
+	if (w22 != null) {
+		if (typeof w22 != "number" || w22 > 255 || w22 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w22, state.scan);
+		state.scan += 1;
+	}
+	let w23 = value.columndata;
+	if (w23 != null) {
+		ext[0].write(state, w23);
+	}
+	let w24 = value.nullbyte;
+	if (w24 != null) {
+		if (typeof w24 != "number" || w24 > 255 || w24 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w24, state.scan);
+		state.scan += 1;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,395 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\enums.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xbb13ea0d;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.key_type1 = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.value_type1 = v4;
+				break;
+			}
+			case 101: {
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.key_type2 = v5;
+				break;
+			}
+			case 102: {
+				let v6 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.value_type2 = v6;
+				break;
+			}
+			case 3: {
+				let v7 = ext[0].read(state);
+				obj0.stringValue = v7;
+				break;
+			}
+			case 4: {
+				let v8 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.intValue = v8;
+				break;
+			}
+			case 5: {
+				let v9 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let hidden10 = { $index: 0, $length: v9 };
+				state.hiddenstack.push(hidden10);
+				state.stack.push({});
+				let arr11 = [];
+				for (let i12 = 0; i12 < v9; i12++) {
+					hidden10.$index = i12;
+					let v13 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					let v14 = ext[0].read(state);
+					let arr15 = [v13, v14];
+					arr11.push(arr15);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.stringArrayValue1 = arr11;
+				break;
+			}
+			case 6: {
+				let v16 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let hidden17 = { $index: 0, $length: v16 };
+				state.hiddenstack.push(hidden17);
+				state.stack.push({});
+				let arr18 = [];
+				for (let i19 = 0; i19 < v16; i19++) {
+					hidden17.$index = i19;
+					let v20 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					let v21 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					let arr22 = [v20, v21];
+					arr18.push(arr22);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.intArrayValue1 = arr18;
+				break;
+			}
+			case 7: {
+				let obj23 = {};
+				let hidden24 = {};
+				state.stack.push(obj23);
+				state.hiddenstack.push(hidden24);
+				let v25 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v25 !== undefined) { obj23.max = v25; }
+				let v26 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let hidden27 = { $index: 0, $length: v26 };
+				state.hiddenstack.push(hidden27);
+				state.stack.push({});
+				let arr28 = [];
+				for (let i29 = 0; i29 < v26; i29++) {
+					hidden27.$index = i29;
+					let v30 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v31 = ext[0].read(state);
+					let arr32 = [v30, v31];
+					arr28.push(arr32);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr28 !== undefined) { obj23.values = arr28; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stringArrayValue2 = obj23;
+				break;
+			}
+			case 8: {
+				let obj33 = {};
+				let hidden34 = {};
+				state.stack.push(obj33);
+				state.hiddenstack.push(hidden34);
+				let v35 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v35 !== undefined) { obj33.max = v35; }
+				let v36 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let hidden37 = { $index: 0, $length: v36 };
+				state.hiddenstack.push(hidden37);
+				state.stack.push({});
+				let arr38 = [];
+				for (let i39 = 0; i39 < v36; i39++) {
+					hidden37.$index = i39;
+					let v40 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v41 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					let arr42 = [v40, v41];
+					arr38.push(arr42);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr38 !== undefined) { obj33.values = arr38; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.intArrayValue2 = obj33;
+				break;
+			}
+			case 131: {
+				obj0.unknown_83 = true;
+				break;
+			}
+			case 209: {
+				obj0.unknown_d1 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key43 in value) {
+		if (key43.startsWith("$")) { continue; }
+		switch (key43) {
+			case "key_type1": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w44 = value[key43];
+				if (typeof w44 != "number" || w44 > 255 || w44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w44, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "value_type1": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w45 = value[key43];
+				if (typeof w45 != "number" || w45 > 255 || w45 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w45, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "key_type2": {
+				if (typeof 101 != "number" || 101 > 255 || 101 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(101, state.scan);
+				state.scan += 1;
+				let w46 = value[key43];
+				if (typeof w46 != "number" || w46 > 255 || w46 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w46, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "value_type2": {
+				if (typeof 102 != "number" || 102 > 255 || 102 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(102, state.scan);
+				state.scan += 1;
+				let w47 = value[key43];
+				if (typeof w47 != "number" || w47 > 255 || w47 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w47, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "stringValue": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w48 = value[key43];
+				ext[0].write(state, w48);
+				break;
+			}
+			case "intValue": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w49 = value[key43];
+				if (typeof w49 != "number" || w49 > 2147483647 || w49 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w49, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "stringArrayValue1": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w50 = value[key43];
+				if (!Array.isArray(w50)) { throw new Error("array expected"); }
+				let w51 = w50.length;
+				if (typeof w51 != "number" || w51 > 65535 || w51 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w51, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w50.length });
+				for (let i52 = 0; i52 < w50.length; i52++) {
+					let w53 = w50[i52];
+					if (!Array.isArray(w53)) { throw new Error("array expected"); }
+					let w54 = w53[0];
+					if (typeof w54 != "number" || w54 > 2147483647 || w54 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w54, state.scan);
+					state.scan += 4;
+					let w55 = w53[1];
+					ext[0].write(state, w55);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "intArrayValue1": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w56 = value[key43];
+				if (!Array.isArray(w56)) { throw new Error("array expected"); }
+				let w57 = w56.length;
+				if (typeof w57 != "number" || w57 > 65535 || w57 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w57, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w56.length });
+				for (let i58 = 0; i58 < w56.length; i58++) {
+					let w59 = w56[i58];
+					if (!Array.isArray(w59)) { throw new Error("array expected"); }
+					let w60 = w59[0];
+					if (typeof w60 != "number" || w60 > 2147483647 || w60 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w60, state.scan);
+					state.scan += 4;
+					let w61 = w59[1];
+					if (typeof w61 != "number" || w61 > 2147483647 || w61 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w61, state.scan);
+					state.scan += 4;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "stringArrayValue2": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w62 = value[key43];
+				if (typeof w62 != "object" || !w62) { throw new Error("object expected"); }
+				let hidden63 = {};
+				state.stack.push(w62);
+				state.hiddenstack.push(hidden63);
+				let w64 = w62.max;
+				if (typeof w64 != "number" || w64 > 65535 || w64 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w64, state.scan);
+				state.scan += 2;
+				let w65 = w62.values;
+				if (!Array.isArray(w65)) { throw new Error("array expected"); }
+				let w66 = w65.length;
+				if (typeof w66 != "number" || w66 > 65535 || w66 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w66, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w65.length });
+				for (let i67 = 0; i67 < w65.length; i67++) {
+					let w68 = w65[i67];
+					if (!Array.isArray(w68)) { throw new Error("array expected"); }
+					let w69 = w68[0];
+					if (typeof w69 != "number" || w69 > 65535 || w69 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w69, state.scan);
+					state.scan += 2;
+					let w70 = w68[1];
+					ext[0].write(state, w70);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "intArrayValue2": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w71 = value[key43];
+				if (typeof w71 != "object" || !w71) { throw new Error("object expected"); }
+				let hidden72 = {};
+				state.stack.push(w71);
+				state.hiddenstack.push(hidden72);
+				let w73 = w71.max;
+				if (typeof w73 != "number" || w73 > 65535 || w73 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w73, state.scan);
+				state.scan += 2;
+				let w74 = w71.values;
+				if (!Array.isArray(w74)) { throw new Error("array expected"); }
+				let w75 = w74.length;
+				if (typeof w75 != "number" || w75 > 65535 || w75 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w75, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w74.length });
+				for (let i76 = 0; i76 < w74.length; i76++) {
+					let w77 = w74[i76];
+					if (!Array.isArray(w77)) { throw new Error("array expected"); }
+					let w78 = w77[0];
+					if (typeof w78 != "number" || w78 > 65535 || w78 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w78, state.scan);
+					state.scan += 2;
+					let w79 = w77[1];
+					if (typeof w79 != "number" || w79 > 2147483647 || w79 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w79, state.scan);
+					state.scan += 4;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_83": {
+				if (typeof 131 != "number" || 131 > 255 || 131 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(131, state.scan);
+				state.scan += 1;
+				let w80 = value[key43];
+				if (w80 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_d1": {
+				if (typeof 209 != "number" || 209 > 255 || 209 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(209, state.scan);
+				state.scan += 1;
+				let w81 = value[key43];
+				if (w81 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key43);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,242 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\fontmetrics.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd00be433;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.type = v2; }
+	let ref3 = state.stack[state.stack.length - 1].type;
+	let match4 = -1;
+	if (ref3 != 2) { match4 = 0; }
+	let v5 = null;
+	if (match4 != -1) {
+		let obj6 = {};
+		let hidden7 = {};
+		state.stack.push(obj6);
+		state.hiddenstack.push(hidden7);
+		let v8 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v8 !== undefined) { obj6.complexkerning = v8; }
+		let hidden9 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden9);
+		let ref10 = state.stack[state.stack.length - 3].type;
+		ref10 = ref10 + 0;
+		hidden9.$opcode = ref10;
+		let ref11 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match12 = -1;
+		if (ref11 == 1) { match12 = 0; }
+		else if (true) { match12 = 1; }
+		if (match12 == -1) { throw new Error("no opcode matched"); }
+		let v13;
+		if (match12 == 0) {
+			let v14 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v13 = v14;
+		}
+		else if (match12 == 1) {
+			v13 = -1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v13 !== undefined) { obj6.sourceid = v13; }
+		let v15 = ext[0].read(state);
+		if (v15 !== undefined) { obj6.chars = v15; }
+		let v16 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v16 !== undefined) { obj6.sheetwidth = v16; }
+		let v17 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v17 !== undefined) { obj6.sheetheight = v17; }
+		let v18 = ext[1].read(state);
+		if (v18 !== undefined) { obj6.positions = v18; }
+		let hidden19 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden19);
+		let ref20 = state.stack[state.stack.length - 2].complexkerning;
+		ref20 = ref20 + 0;
+		hidden19.$opcode = ref20;
+		let ref21 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match22 = -1;
+		if (ref21 == 1) { match22 = 0; }
+		else if (true) { match22 = 1; }
+		if (match22 == -1) { throw new Error("no opcode matched"); }
+		let v23;
+		if (match22 == 0) {
+			v23 = 0;
+		}
+		else if (match22 == 1) {
+			let v24 = state.view.getInt8(state.scan);
+			state.scan += 1;
+			v23 = v24;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v23 !== undefined) { obj6.baseline = v23; }
+		let v25 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v25 !== undefined) { obj6.uppercaseascent = v25; }
+		let v26 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v26 !== undefined) { obj6.median = v26; }
+		let v27 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v27 !== undefined) { obj6.maxascent = v27; }
+		let v28 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v28 !== undefined) { obj6.maxdescent = v28; }
+		let v29 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v29 !== undefined) { obj6.scale = v29; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v5 = obj6;
+	}
+	if (v5 !== undefined) { obj0.sprite = v5; }
+	let ref30 = state.stack[state.stack.length - 1].type;
+	let match31 = -1;
+	if (ref30 == 2) { match31 = 0; }
+	let v32 = null;
+	if (match31 != -1) {
+		let obj33 = {};
+		let hidden34 = {};
+		state.stack.push(obj33);
+		state.hiddenstack.push(hidden34);
+		let v35 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v35 !== undefined) { obj33.sourceid = v35; }
+		let v36 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v36 !== undefined) { obj33.size = v36; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v32 = obj33;
+	}
+	if (v32 !== undefined) { obj0.vector = v32; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden37 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden37);
+	let w38 = value.type;
+	if (typeof w38 != "number" || w38 > 255 || w38 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w38, state.scan);
+	state.scan += 1;
+	let w39 = value.sprite;
+	if (w39 != null) {
+		if (typeof w39 != "object" || !w39) { throw new Error("object expected"); }
+		let hidden40 = {};
+		state.stack.push(w39);
+		state.hiddenstack.push(hidden40);
+		let w41 = w39.complexkerning;
+		if (typeof w41 != "number" || w41 > 255 || w41 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w41, state.scan);
+		state.scan += 1;
+		let w42 = w39.sourceid;
+		let hidden43 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden43);
+		hidden43.$opcode = ext[2].readConst(state);
+		let ref44 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match45 = -1;
+		if (ref44 == 1) { match45 = 0; }
+		else if (true) { match45 = 1; }
+		if (match45 == -1) { throw new Error("no opcode matched"); }
+		if (match45 == 0) {
+			if (typeof w42 != "number" || w42 > 2147483647 || w42 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w42, state.scan);
+			state.scan += 4;
+		}
+		else if (match45 == 1) {
+			if (w42 != -1) { throw new Error("expected constant -1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w46 = w39.chars;
+		ext[0].write(state, w46);
+		let w47 = w39.sheetwidth;
+		if (typeof w47 != "number" || w47 > 65535 || w47 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w47, state.scan);
+		state.scan += 2;
+		let w48 = w39.sheetheight;
+		if (typeof w48 != "number" || w48 > 65535 || w48 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w48, state.scan);
+		state.scan += 2;
+		let w49 = w39.positions;
+		ext[1].write(state, w49);
+		let w50 = w39.baseline;
+		let hidden51 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden51);
+		hidden51.$opcode = ext[3].readConst(state);
+		let ref52 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match53 = -1;
+		if (ref52 == 1) { match53 = 0; }
+		else if (true) { match53 = 1; }
+		if (match53 == -1) { throw new Error("no opcode matched"); }
+		if (match53 == 0) {
+			if (w50 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		else if (match53 == 1) {
+			if (typeof w50 != "number" || w50 > 127 || w50 < -128) { throw new Error(); }
+			state.buffer.writeInt8(w50, state.scan);
+			state.scan += 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w54 = w39.uppercaseascent;
+		if (typeof w54 != "number" || w54 > 255 || w54 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w54, state.scan);
+		state.scan += 1;
+		let w55 = w39.median;
+		if (typeof w55 != "number" || w55 > 255 || w55 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w55, state.scan);
+		state.scan += 1;
+		let w56 = w39.maxascent;
+		if (typeof w56 != "number" || w56 > 255 || w56 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w56, state.scan);
+		state.scan += 1;
+		let w57 = w39.maxdescent;
+		if (typeof w57 != "number" || w57 > 255 || w57 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w57, state.scan);
+		state.scan += 1;
+		let w58 = w39.scale;
+		if (typeof w58 != "number" || w58 > 255 || w58 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w58, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w59 = value.vector;
+	if (w59 != null) {
+		if (typeof w59 != "object" || !w59) { throw new Error("object expected"); }
+		let hidden60 = {};
+		state.stack.push(w59);
+		state.hiddenstack.push(hidden60);
+		let w61 = w59.sourceid;
+		if (typeof w61 != "number" || w61 > 4294967295 || w61 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w61, state.scan);
+		state.scan += 4;
+		let w62 = w59.size;
+		if (typeof w62 != "number" || w62 > 255 || w62 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w62, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,84 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\framemaps.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xb46e9e5c;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v2 !== undefined) { obj0.datalen = v2; }
+	let hidden3 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden3);
+	hidden3.$opcode = 0;
+	let ref4 = state.stack[state.stack.length - 2].datalen;
+	let match5 = -1;
+	if (ref4 == 65535) { match5 = 0; }
+	else if (true) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v6 = v7;
+	}
+	else if (match5 == 1) {
+		v6 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.unkheader = v6; }
+	let v8 = ext[0].read(state);
+	if (v8 !== undefined) { obj0.data = v8; }
+	let v9 = ext[1].read(state);
+	if (v9 !== undefined) { obj0.skeleton = v9; }
+	let v10 = ext[2].read(state);
+	if (v10 !== undefined) { obj0.activebones = v10; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden11 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden11);
+	let w12 = value.datalen;
+	if (typeof w12 != "number" || w12 > 65535 || w12 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w12, state.scan);
+	state.scan += 2;
+	let w13 = value.unkheader;
+	let hidden14 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden14);
+	let ref15 = state.stack[state.stack.length - 2].datalen;
+	let match16 = -1;
+	if (ref15 == 65535) { match16 = 0; }
+	else if (true) { match16 = 1; }
+	if (match16 == -1) { throw new Error("no opcode matched"); }
+	if (match16 == 0) {
+		if (typeof w13 != "number" || w13 > 255 || w13 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w13, state.scan);
+		state.scan += 1;
+	}
+	else if (match16 == 1) {
+		if (w13 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w17 = value.data;
+	ext[0].write(state, w17);
+	let w18 = value.skeleton;
+	ext[1].write(state, w18);
+	let w19 = value.activebones;
+	ext[2].write(state, w19);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
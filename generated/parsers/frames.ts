@@ -0,0 +1,74 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\frames.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x4ac6478e;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.header_always_2 = v2; }
+	let v3 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v3 !== undefined) { obj0.framemap_id = v3; }
+	let v4 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	let hidden5 = { $index: 0, $length: v4 };
+	state.hiddenstack.push(hidden5);
+	state.stack.push({});
+	let arr6 = [];
+	for (let i7 = 0; i7 < v4; i7++) {
+		hidden5.$index = i7;
+		let v8 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		arr6.push(v8);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr6 !== undefined) { obj0.flags = arr6; }
+	let v9 = ext[0].read(state);
+	if (v9 !== undefined) { obj0.animdata = v9; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden10 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden10);
+	let w11 = value.header_always_2;
+	if (typeof w11 != "number" || w11 > 255 || w11 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w11, state.scan);
+	state.scan += 1;
+	let w12 = value.framemap_id;
+	if (typeof w12 != "number" || w12 > 65535 || w12 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w12, state.scan);
+	state.scan += 2;
+	let w13 = value.flags;
+	if (!Array.isArray(w13)) { throw new Error("array expected"); }
+	let w14 = w13.length;
+	if (typeof w14 != "number" || w14 > 65535 || w14 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w14, state.scan);
+	state.scan += 2;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w13.length });
+	for (let i15 = 0; i15 < w13.length; i15++) {
+		let w16 = w13[i15];
+		if (typeof w16 != "number" || w16 > 255 || w16 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w16, state.scan);
+		state.scan += 1;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w17 = value.animdata;
+	ext[0].write(state, w17);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
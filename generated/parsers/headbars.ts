@@ -0,0 +1,231 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\headbars.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x245e6537;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 2: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr6 = [v3, v4, v5];
+				obj0.unk02 = arr6;
+				break;
+			}
+			case 4: {
+				obj0.unk04 = true;
+				break;
+			}
+			case 5: {
+				let v7 = ext[0].read(state);
+				obj0.unk05 = v7;
+				break;
+			}
+			case 7: {
+				let v8 = ext[0].read(state);
+				obj0.full = v8;
+				break;
+			}
+			case 8: {
+				let v9 = ext[0].read(state);
+				obj0.empty = v9;
+				break;
+			}
+			case 9: {
+				let v10 = ext[0].read(state);
+				obj0.full_group = v10;
+				break;
+			}
+			case 10: {
+				let v11 = ext[0].read(state);
+				obj0.empty_group = v11;
+				break;
+			}
+			case 11: {
+				let v12 = ext[0].read(state);
+				obj0.unk0b = v12;
+				break;
+			}
+			case 12: {
+				let v13 = ext[0].read(state);
+				obj0.full_team = v13;
+				break;
+			}
+			case 13: {
+				let v14 = ext[0].read(state);
+				obj0.empty_team = v14;
+				break;
+			}
+			case 14: {
+				let v15 = ext[0].read(state);
+				obj0.unk0e = v15;
+				break;
+			}
+			case 15: {
+				let v16 = ext[0].read(state);
+				obj0.unk0f = v16;
+				break;
+			}
+			case 16: {
+				obj0.unk10 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key17 in value) {
+		if (key17.startsWith("$")) { continue; }
+		switch (key17) {
+			case "unk02": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w18 = value[key17];
+				if (!Array.isArray(w18)) { throw new Error("array expected"); }
+				let w19 = w18[0];
+				if (typeof w19 != "number" || w19 > 255 || w19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w19, state.scan);
+				state.scan += 1;
+				let w20 = w18[1];
+				if (typeof w20 != "number" || w20 > 255 || w20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w20, state.scan);
+				state.scan += 1;
+				let w21 = w18[2];
+				if (typeof w21 != "number" || w21 > 255 || w21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w21, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w22 = value[key17];
+				if (w22 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w23 = value[key17];
+				ext[0].write(state, w23);
+				break;
+			}
+			case "full": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w24 = value[key17];
+				ext[0].write(state, w24);
+				break;
+			}
+			case "empty": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w25 = value[key17];
+				ext[0].write(state, w25);
+				break;
+			}
+			case "full_group": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w26 = value[key17];
+				ext[0].write(state, w26);
+				break;
+			}
+			case "empty_group": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w27 = value[key17];
+				ext[0].write(state, w27);
+				break;
+			}
+			case "unk0b": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w28 = value[key17];
+				ext[0].write(state, w28);
+				break;
+			}
+			case "full_team": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w29 = value[key17];
+				ext[0].write(state, w29);
+				break;
+			}
+			case "empty_team": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w30 = value[key17];
+				ext[0].write(state, w30);
+				break;
+			}
+			case "unk0e": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w31 = value[key17];
+				ext[0].write(state, w31);
+				break;
+			}
+			case "unk0f": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w32 = value[key17];
+				ext[0].write(state, w32);
+				break;
+			}
+			case "unk10": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w33 = value[key17];
+				if (w33 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key17);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
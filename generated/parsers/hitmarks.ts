@@ -0,0 +1,514 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\hitmarks.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x5094a560;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.font = v3;
+				break;
+			}
+			case 3: {
+				let v4 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.icon = v4;
+				break;
+			}
+			case 4: {
+				let v5 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.bgleft = v5;
+				break;
+			}
+			case 5: {
+				let v6 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.bgmid = v6;
+				break;
+			}
+			case 6: {
+				let v7 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.bgright = v7;
+				break;
+			}
+			case 7: {
+				let v8 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk07 = v8;
+				break;
+			}
+			case 8: {
+				let v9 = ext[0].read(state);
+				obj0.text = v9;
+				break;
+			}
+			case 9: {
+				let v10 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk09 = v10;
+				break;
+			}
+			case 10: {
+				let obj11 = {};
+				let hidden12 = {};
+				state.stack.push(obj11);
+				state.hiddenstack.push(hidden12);
+				let v13 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				let hidden14 = { $index: 0, $length: v13 };
+				state.hiddenstack.push(hidden14);
+				state.stack.push({});
+				let arr15 = [];
+				for (let i16 = 0; i16 < v13; i16++) {
+					hidden14.$index = i16;
+					let v17 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v18 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr19 = [v17, v18];
+					arr15.push(arr19);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr15 !== undefined) { obj11.arr = arr15; }
+				let v20 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v20 !== undefined) { obj11.unk0 = v20; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unk0a = obj11;
+				break;
+			}
+			case 12: {
+				let v21 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk0c = v21;
+				break;
+			}
+			case 13: {
+				let v22 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk0d = v22;
+				break;
+			}
+			case 14: {
+				let v23 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk0e = v23;
+				break;
+			}
+			case 16: {
+				let hidden24 = { $index: 0, $length: 2 };
+				state.hiddenstack.push(hidden24);
+				state.stack.push({});
+				let arr25 = [];
+				for (let i26 = 0; i26 < 2; i26++) {
+					hidden24.$index = i26;
+					let v27 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					arr25.push(v27);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk10 = arr25;
+				break;
+			}
+			case 17: {
+				let obj28 = {};
+				let hidden29 = {};
+				state.stack.push(obj28);
+				state.hiddenstack.push(hidden29);
+				let v30 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v30 !== undefined) { obj28.varbit = v30; }
+				let v31 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v31 !== undefined) { obj28.varp = v31; }
+				let v32 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden33 = { $index: 0, $length: v32 };
+				state.hiddenstack.push(hidden33);
+				state.stack.push({});
+				let arr34 = [];
+				for (let i35 = 0; i35 < v32; i35++) {
+					hidden33.$index = i35;
+					let v36 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr34.push(v36);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr34 !== undefined) { obj28.values = arr34; }
+				let v37 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v37 !== undefined) { obj28.default = v37; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morph_11 = obj28;
+				break;
+			}
+			case 18: {
+				let obj38 = {};
+				let hidden39 = {};
+				state.stack.push(obj38);
+				state.hiddenstack.push(hidden39);
+				let v40 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v40 !== undefined) { obj38.varbit = v40; }
+				let v41 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v41 !== undefined) { obj38.varp = v41; }
+				let v42 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v42 !== undefined) { obj38.default = v42; }
+				let v43 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden44 = { $index: 0, $length: v43 };
+				state.hiddenstack.push(hidden44);
+				state.stack.push({});
+				let arr45 = [];
+				for (let i46 = 0; i46 < v43; i46++) {
+					hidden44.$index = i46;
+					let v47 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr45.push(v47);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr45 !== undefined) { obj38.values = arr45; }
+				let v48 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v48 !== undefined) { obj38.unk1 = v48; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morph_12 = obj38;
+				break;
+			}
+			case 19: {
+				let v49 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk13 = v49;
+				break;
+			}
+			case 20: {
+				let v50 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk14 = v50;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key51 in value) {
+		if (key51.startsWith("$")) { continue; }
+		switch (key51) {
+			case "font": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w52 = value[key51];
+				if (typeof w52 != "number" || w52 > 65535 || w52 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w52, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "icon": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w53 = value[key51];
+				if (typeof w53 != "number" || w53 > 65535 || w53 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w53, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "bgleft": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w54 = value[key51];
+				if (typeof w54 != "number" || w54 > 65535 || w54 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w54, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "bgmid": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w55 = value[key51];
+				if (typeof w55 != "number" || w55 > 65535 || w55 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w55, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "bgright": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w56 = value[key51];
+				if (typeof w56 != "number" || w56 > 65535 || w56 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w56, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk07": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w57 = value[key51];
+				if (typeof w57 != "number" || w57 > 65535 || w57 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w57, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "text": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w58 = value[key51];
+				ext[0].write(state, w58);
+				break;
+			}
+			case "unk09": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w59 = value[key51];
+				if (typeof w59 != "number" || w59 > 65535 || w59 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w59, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk0a": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w60 = value[key51];
+				if (typeof w60 != "object" || !w60) { throw new Error("object expected"); }
+				let hidden61 = {};
+				state.stack.push(w60);
+				state.hiddenstack.push(hidden61);
+				let w62 = w60.arr;
+				if (!Array.isArray(w62)) { throw new Error("array expected"); }
+				let w63 = w62.length;
+				if (typeof w63 != "number" || w63 > 127 || w63 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w63, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w62.length });
+				for (let i64 = 0; i64 < w62.length; i64++) {
+					let w65 = w62[i64];
+					if (!Array.isArray(w65)) { throw new Error("array expected"); }
+					let w66 = w65[0];
+					if (typeof w66 != "number" || w66 > 65535 || w66 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w66, state.scan);
+					state.scan += 2;
+					let w67 = w65[1];
+					if (typeof w67 != "number" || w67 > 65535 || w67 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w67, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w68 = w60.unk0;
+				if (typeof w68 != "number" || w68 > 255 || w68 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w68, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk0c": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w69 = value[key51];
+				if (typeof w69 != "number" || w69 > 255 || w69 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w69, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk0d": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w70 = value[key51];
+				if (typeof w70 != "number" || w70 > 65535 || w70 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w70, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk0e": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w71 = value[key51];
+				if (typeof w71 != "number" || w71 > 65535 || w71 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w71, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk10": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w72 = value[key51];
+				if (!Array.isArray(w72)) { throw new Error("array expected"); }
+				let w73 = w72.length;
+				if (w73 != 2) { throw new Error("expected constant 2 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w72.length });
+				for (let i74 = 0; i74 < w72.length; i74++) {
+					let w75 = w72[i74];
+					if (typeof w75 != "number" || w75 > 32767 || w75 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w75, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "morph_11": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w76 = value[key51];
+				if (typeof w76 != "object" || !w76) { throw new Error("object expected"); }
+				let hidden77 = {};
+				state.stack.push(w76);
+				state.hiddenstack.push(hidden77);
+				let w78 = w76.varbit;
+				if (typeof w78 != "number" || w78 > 65535 || w78 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w78, state.scan);
+				state.scan += 2;
+				let w79 = w76.varp;
+				if (typeof w79 != "number" || w79 > 65535 || w79 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w79, state.scan);
+				state.scan += 2;
+				let w80 = w76.values;
+				if (!Array.isArray(w80)) { throw new Error("array expected"); }
+				let w81 = w80.length;
+				if (typeof w81 != "number" || w81 > 255 || w81 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w81, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w80.length });
+				for (let i82 = 0; i82 < w80.length; i82++) {
+					let w83 = w80[i82];
+					if (typeof w83 != "number" || w83 > 65535 || w83 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w83, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w84 = w76.default;
+				if (typeof w84 != "number" || w84 > 65535 || w84 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w84, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "morph_12": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w85 = value[key51];
+				if (typeof w85 != "object" || !w85) { throw new Error("object expected"); }
+				let hidden86 = {};
+				state.stack.push(w85);
+				state.hiddenstack.push(hidden86);
+				let w87 = w85.varbit;
+				if (typeof w87 != "number" || w87 > 65535 || w87 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w87, state.scan);
+				state.scan += 2;
+				let w88 = w85.varp;
+				if (typeof w88 != "number" || w88 > 65535 || w88 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w88, state.scan);
+				state.scan += 2;
+				let w89 = w85.default;
+				if (typeof w89 != "number" || w89 > 65535 || w89 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w89, state.scan);
+				state.scan += 2;
+				let w90 = w85.values;
+				if (!Array.isArray(w90)) { throw new Error("array expected"); }
+				let w91 = w90.length;
+				if (typeof w91 != "number" || w91 > 255 || w91 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w91, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w90.length });
+				for (let i92 = 0; i92 < w90.length; i92++) {
+					let w93 = w90[i92];
+					if (typeof w93 != "number" || w93 > 65535 || w93 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w93, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w94 = w85.unk1;
+				if (typeof w94 != "number" || w94 > 65535 || w94 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w94, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk13": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w95 = value[key51];
+				if (typeof w95 != "number" || w95 > 65535 || w95 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w95, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk14": {
+				if (typeof 20 != "number" || 20 > 255 || 20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(20, state.scan);
+				state.scan += 1;
+				let w96 = value[key51];
+				if (typeof w96 != "number" || w96 > 65535 || w96 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w96, state.scan);
+				state.scan += 2;
+				break;
+			}
+			default: throw new Error("unknown property " + key51);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
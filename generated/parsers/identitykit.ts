@@ -0,0 +1,186 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\identitykit.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x844502c0;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.bodypart = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden5 = { $index: 0, $length: v4 };
+				state.hiddenstack.push(hidden5);
+				state.stack.push({});
+				let arr6 = [];
+				for (let i7 = 0; i7 < v4; i7++) {
+					hidden5.$index = i7;
+					let v8 = ext[0].read(state);
+					arr6.push(v8);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.models = arr6;
+				break;
+			}
+			case 3: {
+				obj0.iscopy = true;
+				break;
+			}
+			case 40: {
+				let v9 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden10 = { $index: 0, $length: v9 };
+				state.hiddenstack.push(hidden10);
+				state.stack.push({});
+				let arr11 = [];
+				for (let i12 = 0; i12 < v9; i12++) {
+					hidden10.$index = i12;
+					let v13 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v14 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr15 = [v13, v14];
+					arr11.push(arr15);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.recolor = arr11;
+				break;
+			}
+			case 60: {
+				let v16 = ext[0].read(state);
+				obj0.headmodel = v16;
+				break;
+			}
+			case 61: {
+				let v17 = ext[0].read(state);
+				obj0.headbasemodel = v17;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key18 in value) {
+		if (key18.startsWith("$")) { continue; }
+		switch (key18) {
+			case "bodypart": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w19 = value[key18];
+				if (typeof w19 != "number" || w19 > 255 || w19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w19, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "models": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w20 = value[key18];
+				if (!Array.isArray(w20)) { throw new Error("array expected"); }
+				let w21 = w20.length;
+				if (typeof w21 != "number" || w21 > 255 || w21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w21, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w20.length });
+				for (let i22 = 0; i22 < w20.length; i22++) {
+					let w23 = w20[i22];
+					ext[0].write(state, w23);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "iscopy": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w24 = value[key18];
+				if (w24 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "recolor": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w25 = value[key18];
+				if (!Array.isArray(w25)) { throw new Error("array expected"); }
+				let w26 = w25.length;
+				if (typeof w26 != "number" || w26 > 255 || w26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w26, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w25.length });
+				for (let i27 = 0; i27 < w25.length; i27++) {
+					let w28 = w25[i27];
+					if (!Array.isArray(w28)) { throw new Error("array expected"); }
+					let w29 = w28[0];
+					if (typeof w29 != "number" || w29 > 65535 || w29 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w29, state.scan);
+					state.scan += 2;
+					let w30 = w28[1];
+					if (typeof w30 != "number" || w30 > 65535 || w30 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w30, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "headmodel": {
+				if (typeof 60 != "number" || 60 > 255 || 60 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(60, state.scan);
+				state.scan += 1;
+				let w31 = value[key18];
+				ext[0].write(state, w31);
+				break;
+			}
+			case "headbasemodel": {
+				if (typeof 61 != "number" || 61 > 255 || 61 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(61, state.scan);
+				state.scan += 1;
+				let w32 = value[key18];
+				ext[0].write(state, w32);
+				break;
+			}
+			default: throw new Error("unknown property " + key18);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
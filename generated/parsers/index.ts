@@ -0,0 +1,131 @@
+// GENERATED DO NOT EDIT
+// run `npm run filetypes` to rebuild
+
+import type { CompiledParserModule } from "../../src/parser/parsercompiler";
+import * as achievements from "./achievements";
+import * as animgroupconfigs from "./animgroupconfigs";
+import * as audio from "./audio";
+import * as avataroverrides from "./avataroverrides";
+import * as avatars from "./avatars";
+import * as cacheindex from "./cacheindex";
+import * as classicmodels from "./classicmodels";
+import * as client_cutscenes from "./client_cutscenes";
+import * as clientscript from "./clientscript";
+import * as clientscriptdata from "./clientscriptdata";
+import * as config83 from "./config83";
+import * as cursors from "./cursors";
+import * as cutscenes from "./cutscenes";
+import * as dbrows from "./dbrows";
+import * as dbtables from "./dbtables";
+import * as enums from "./enums";
+import * as fontmetrics from "./fontmetrics";
+import * as framemaps from "./framemaps";
+import * as frames from "./frames";
+import * as headbars from "./headbars";
+import * as hitmarks from "./hitmarks";
+import * as identitykit from "./identitykit";
+import * as interfaces from "./interfaces";
+import * as inventories from "./inventories";
+import * as items from "./items";
+import * as locs from "./locs";
+import * as maplabellocations from "./maplabellocations";
+import * as maplabels from "./maplabels";
+import * as mapscenes from "./mapscenes";
+import * as mapsquare_envs from "./mapsquare_envs";
+import * as mapsquare_locations from "./mapsquare_locations";
+import * as mapsquare_overlays from "./mapsquare_overlays";
+import * as mapsquare_tiles from "./mapsquare_tiles";
+import * as mapsquare_tiles_nxt from "./mapsquare_tiles_nxt";
+import * as mapsquare_underlays from "./mapsquare_underlays";
+import * as mapsquare_watertiles from "./mapsquare_watertiles";
+import * as mapzones from "./mapzones";
+import * as mapzones_pastes from "./mapzones_pastes";
+import * as mapzones_sub3 from "./mapzones_sub3";
+import * as mapzones_sub4 from "./mapzones_sub4";
+import * as materials from "./materials";
+import * as models from "./models";
+import * as npcs from "./npcs";
+import * as oldmaterials from "./oldmaterials";
+import * as oldmodels from "./oldmodels";
+import * as oldproctexture from "./oldproctexture";
+import * as params from "./params";
+import * as particles_0 from "./particles_0";
+import * as particles_1 from "./particles_1";
+import * as proctexture from "./proctexture";
+import * as quests from "./quests";
+import * as quickchatcategories from "./quickchatcategories";
+import * as quickchatlines from "./quickchatlines";
+import * as rootcacheindex from "./rootcacheindex";
+import * as sequences from "./sequences";
+import * as skeletalanim from "./skeletalanim";
+import * as skyboxes from "./skyboxes";
+import * as spotanims from "./spotanims";
+import * as structs from "./structs";
+import * as stylesheets from "./stylesheets";
+import * as varbits from "./varbits";
+import * as vars from "./vars";
+
+export const compiledParsers: CompiledParserModule[] = [
+	achievements,
+	animgroupconfigs,
+	audio,
+	avataroverrides,
+	avatars,
+	cacheindex,
+	classicmodels,
+	client_cutscenes,
+	clientscript,
+	clientscriptdata,
+	config83,
+	cursors,
+	cutscenes,
+	dbrows,
+	dbtables,
+	enums,
+	fontmetrics,
+	framemaps,
+	frames,
+	headbars,
+	hitmarks,
+	identitykit,
+	interfaces,
+	inventories,
+	items,
+	locs,
+	maplabellocations,
+	maplabels,
+	mapscenes,
+	mapsquare_envs,
+	mapsquare_locations,
+	mapsquare_overlays,
+	mapsquare_tiles,
+	mapsquare_tiles_nxt,
+	mapsquare_underlays,
+	mapsquare_watertiles,
+	mapzones,
+	mapzones_pastes,
+	mapzones_sub3,
+	mapzones_sub4,
+	materials,
+	models,
+	npcs,
+	oldmaterials,
+	oldmodels,
+	oldproctexture,
+	params,
+	particles_0,
+	particles_1,
+	proctexture,
+	quests,
+	quickchatcategories,
+	quickchatlines,
+	rootcacheindex,
+	sequences,
+	skeletalanim,
+	skyboxes,
+	spotanims,
+	structs,
+	stylesheets,
+	varbits,
+	vars,
+];
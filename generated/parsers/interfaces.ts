@@ -0,0 +1,3472 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\interfaces.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xfa70bc91;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 > 500) { match5 = 0; }
+	else if (true) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getInt8(state.scan);
+		state.scan += 1;
+		v6 = v7;
+	}
+	else if (match5 == 1) {
+		v6 = -1;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.version = v6; }
+	let v8 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v8 !== undefined) { obj0.type = v8; }
+	let ref9 = state.stack[state.stack.length - 1].type;
+	let match10 = -1;
+	if ((ref9 & 128) != 0) { match10 = 0; }
+	let v11 = null;
+	if (match10 != -1) {
+		let v12 = ext[1].read(state);
+		v11 = v12;
+	}
+	if (v11 !== undefined) { obj0.name = v11; }
+	let v13 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v13 !== undefined) { obj0.contenttype = v13; }
+	let v14 = state.view.getInt16(state.scan);
+	state.scan += 2;
+	if (v14 !== undefined) { obj0.baseposx = v14; }
+	let v15 = state.view.getInt16(state.scan);
+	state.scan += 2;
+	if (v15 !== undefined) { obj0.baseposy = v15; }
+	let v16 = state.view.getInt16(state.scan);
+	state.scan += 2;
+	if (v16 !== undefined) { obj0.basewidth = v16; }
+	let v17 = state.view.getInt16(state.scan);
+	state.scan += 2;
+	if (v17 !== undefined) { obj0.baseheight = v17; }
+	let v18 = state.view.getInt8(state.scan);
+	state.scan += 1;
+	if (v18 !== undefined) { obj0.aspectwidthtype = v18; }
+	let v19 = state.view.getInt8(state.scan);
+	state.scan += 1;
+	if (v19 !== undefined) { obj0.aspectheighttype = v19; }
+	let v20 = state.view.getInt8(state.scan);
+	state.scan += 1;
+	if (v20 !== undefined) { obj0.aspectxtype = v20; }
+	let v21 = state.view.getInt8(state.scan);
+	state.scan += 1;
+	if (v21 !== undefined) { obj0.aspectytype = v21; }
+	let v22 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v22 !== undefined) { obj0.parentid = v22; }
+	let v23 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v23 !== undefined) { obj0.hidden = v23; }
+	let ref24 = state.stack[state.stack.length - 1].type;
+	let match25 = -1;
+	if (ref24 == 0) { match25 = 0; }
+	let v26 = null;
+	if (match25 != -1) {
+		let obj27 = {};
+		let hidden28 = {};
+		state.stack.push(obj27);
+		state.hiddenstack.push(hidden28);
+		let v29 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v29 !== undefined) { obj27.layerwidth = v29; }
+		let v30 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v30 !== undefined) { obj27.layerheight = v30; }
+		let ref31 = state.stack[state.stack.length - 1].layerheight;
+		let match32 = -1;
+		if ((ref31 & 32768) != 0) { match32 = 0; }
+		let v33 = null;
+		if (match32 != -1) {
+			let v34 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v33 = v34;
+		}
+		if (v33 !== undefined) { obj27.layerheightextra = v33; }
+		let ref35 = state.stack[state.stack.length - 2].version;
+		let match36 = -1;
+		if (ref35 == -1) { match36 = 0; }
+		let v37 = null;
+		if (match36 != -1) {
+			let v38 = state.view.getUint8(state.scan++);
+			if (v38 != 0 && v38 != 1) { throw new Error("1 or 0 expected boolean value"); }
+			v37 = (v38 != 0);
+		}
+		if (v37 !== undefined) { obj27.disablehover = v37; }
+		let ref39 = state.stack[state.stack.length - 2].version;
+		let match40 = -1;
+		if (ref39 >= 6) { match40 = 0; }
+		let v41 = null;
+		if (match40 != -1) {
+			let v42 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v41 = v42;
+		}
+		if (v41 !== undefined) { obj27.v6unk1 = v41; }
+		let ref43 = state.stack[state.stack.length - 2].version;
+		let match44 = -1;
+		if (ref43 == 6) { match44 = 0; }
+		let v45 = null;
+		if (match44 != -1) {
+			let v46 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v45 = v46;
+		}
+		if (v45 !== undefined) { obj27.v6unk2 = v45; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v26 = obj27;
+	}
+	if (v26 !== undefined) { obj0.containerdata = v26; }
+	let ref47 = state.stack[state.stack.length - 1].type;
+	let match48 = -1;
+	if (ref47 == 3) { match48 = 0; }
+	let v49 = null;
+	if (match48 != -1) {
+		let obj50 = {};
+		let hidden51 = {};
+		state.stack.push(obj50);
+		state.hiddenstack.push(hidden51);
+		let v52 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v52 !== undefined) { obj50.color = v52; }
+		let v53 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v53 !== undefined) { obj50.filled = v53; }
+		let v54 = state.view.getInt8(state.scan);
+		state.scan += 1;
+		if (v54 !== undefined) { obj50.trans = v54; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v49 = obj50;
+	}
+	if (v49 !== undefined) { obj0.figuredata = v49; }
+	let ref55 = state.stack[state.stack.length - 1].type;
+	let match56 = -1;
+	if (ref55 == 4) { match56 = 0; }
+	let v57 = null;
+	if (match56 != -1) {
+		let obj58 = {};
+		let hidden59 = {};
+		state.stack.push(obj58);
+		state.hiddenstack.push(hidden59);
+		let v60 = ext[2].read(state);
+		if (v60 !== undefined) { obj58.fontid = v60; }
+		let hidden61 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden61);
+		hidden61.$opcode = 0;
+		let ref62 = state.stack[state.stack.length - 3].version;
+		let match63 = -1;
+		if (ref62 >= 0) { match63 = 0; }
+		else if (true) { match63 = 1; }
+		if (match63 == -1) { throw new Error("no opcode matched"); }
+		let v64;
+		if (match63 == 0) {
+			let v65 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v64 = v65;
+		}
+		else if (match63 == 1) {
+			v64 = false;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v64 !== undefined) { obj58.unk1 = v64; }
+		let v66 = ext[1].read(state);
+		if (v66 !== undefined) { obj58.text = v66; }
+		let v67 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v67 !== undefined) { obj58.unk2 = v67; }
+		let v68 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v68 !== undefined) { obj58.alignhor = v68; }
+		let v69 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v69 !== undefined) { obj58.alignver = v69; }
+		let v70 = state.view.getUint8(state.scan++);
+		if (v70 != 0 && v70 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v70 != 0) !== undefined) { obj58.shadow = (v70 != 0); }
+		let v71 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v71 !== undefined) { obj58.color = v71; }
+		let v72 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v72 !== undefined) { obj58.trans = v72; }
+		let ref73 = state.stack[state.stack.length - 2].version;
+		let match74 = -1;
+		if (ref73 >= 0) { match74 = 0; }
+		let v75 = null;
+		if (match74 != -1) {
+			let v76 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v75 = v76;
+		}
+		if (v75 !== undefined) { obj58.multiline = v75; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v57 = obj58;
+	}
+	if (v57 !== undefined) { obj0.textdata = v57; }
+	let ref77 = state.stack[state.stack.length - 1].type;
+	let match78 = -1;
+	if (ref77 == 5) { match78 = 0; }
+	let v79 = null;
+	if (match78 != -1) {
+		let obj80 = {};
+		let hidden81 = {};
+		state.stack.push(obj80);
+		state.hiddenstack.push(hidden81);
+		let v82 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		if (v82 !== undefined) { obj80.spriteid = v82; }
+		let v83 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v83 !== undefined) { obj80.rotation = v83; }
+		let v84 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v84 !== undefined) { obj80.tiling = v84; }
+		let hidden85 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden85);
+		hidden85.$opcode = 0;
+		let ref86 = state.stack[state.stack.length - 3].aspectwidthtype;
+		let match87 = -1;
+		if (ref86 == 4) { match87 = 0; }
+		else if (true) { match87 = 1; }
+		if (match87 == -1) { throw new Error("no opcode matched"); }
+		let v88;
+		if (match87 == 0) {
+			let v89 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v88 = v89;
+		}
+		else if (match87 == 1) {
+			v88 = -1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v88 !== undefined) { obj80.aspectwidthdata = v88; }
+		let hidden90 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden90);
+		hidden90.$opcode = 0;
+		let ref91 = state.stack[state.stack.length - 3].aspectheighttype;
+		let match92 = -1;
+		if (ref91 == 4) { match92 = 0; }
+		else if (true) { match92 = 1; }
+		if (match92 == -1) { throw new Error("no opcode matched"); }
+		let v93;
+		if (match92 == 0) {
+			let v94 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v93 = v94;
+		}
+		else if (match92 == 1) {
+			v93 = -1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v93 !== undefined) { obj80.aspectheightdata = v93; }
+		let v95 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v95 !== undefined) { obj80.transparency = v95; }
+		let v96 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v96 !== undefined) { obj80.borderthickness = v96; }
+		let v97 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		if (v97 !== undefined) { obj80.unk2 = v97; }
+		let v98 = state.view.getUint8(state.scan++);
+		if (v98 != 0 && v98 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v98 != 0) !== undefined) { obj80.vflip = (v98 != 0); }
+		let v99 = state.view.getUint8(state.scan++);
+		if (v99 != 0 && v99 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v99 != 0) !== undefined) { obj80.hflip = (v99 != 0); }
+		let v100 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v100 !== undefined) { obj80.color = v100; }
+		let ref101 = state.stack[state.stack.length - 2].version;
+		let match102 = -1;
+		if (ref101 >= 0) { match102 = 0; }
+		let v103 = null;
+		if (match102 != -1) {
+			let v104 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v103 = v104;
+		}
+		if (v103 !== undefined) { obj80.clickmask = v103; }
+		let ref105 = state.stack[state.stack.length - 2].version;
+		let match106 = -1;
+		if (ref105 >= 6) { match106 = 0; }
+		let v107 = null;
+		if (match106 != -1) {
+			let v108 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v107 = v108;
+		}
+		if (v107 !== undefined) { obj80.v6unk = v107; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v79 = obj80;
+	}
+	if (v79 !== undefined) { obj0.spritedata = v79; }
+	let ref109 = state.stack[state.stack.length - 1].type;
+	let match110 = -1;
+	if (ref109 == 6) { match110 = 0; }
+	let v111 = null;
+	if (match110 != -1) {
+		let obj112 = {};
+		let hidden113 = {};
+		state.stack.push(obj112);
+		state.hiddenstack.push(hidden113);
+		let hidden114 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden114);
+		let v115 = ext[3].read(state);
+		hidden114.$opcode = v115;
+		let ref116 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match117 = -1;
+		if (ref116 > 616) { match117 = 0; }
+		else if (true) { match117 = 1; }
+		if (match117 == -1) { throw new Error("no opcode matched"); }
+		let v118;
+		if (match117 == 0) {
+			let v119 = ext[2].read(state);
+			v118 = v119;
+		}
+		else if (match117 == 1) {
+			let v120 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v118 = v120;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v118 !== undefined) { obj112.modelid = v118; }
+		let hidden121 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden121);
+		let v122 = ext[4].read(state);
+		hidden121.$opcode = v122;
+		let ref123 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match124 = -1;
+		if (ref123 > 616) { match124 = 0; }
+		else if (true) { match124 = 1; }
+		if (match124 == -1) { throw new Error("no opcode matched"); }
+		let v125;
+		if (match124 == 0) {
+			let v126 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v125 = v126;
+		}
+		else if (match124 == 1) {
+			v125 = 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v125 !== undefined) { obj112.mode = v125; }
+		let ref127 = state.stack[state.stack.length - 1].mode;
+		let match128 = -1;
+		if (ref127 != 0) { match128 = 0; }
+		let v129 = null;
+		if (match128 != -1) {
+			let obj130 = {};
+			let hidden131 = {};
+			state.stack.push(obj130);
+			state.hiddenstack.push(hidden131);
+			let v132 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			if (v132 !== undefined) { obj130.translate_x = v132; }
+			let v133 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			if (v133 !== undefined) { obj130.translate_y = v133; }
+			let ref134 = state.stack[state.stack.length - 2].mode;
+			let match135 = -1;
+			if (ref134 == 2) { match135 = 0; }
+			let v136 = null;
+			if (match135 != -1) {
+				let v137 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				v136 = v137;
+			}
+			if (v136 !== undefined) { obj130.unkextra = v136; }
+			let v138 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v138 !== undefined) { obj130.rotate_x = v138; }
+			let v139 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v139 !== undefined) { obj130.rotate_y = v139; }
+			let v140 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v140 !== undefined) { obj130.rotate_z = v140; }
+			let v141 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v141 !== undefined) { obj130.zoom = v141; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v129 = obj130;
+		}
+		if (v129 !== undefined) { obj112.positiondata = v129; }
+		let hidden142 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden142);
+		let v143 = ext[5].read(state);
+		hidden142.$opcode = v143;
+		let ref144 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match145 = -1;
+		if (ref144 > 616) { match145 = 0; }
+		else if (true) { match145 = 1; }
+		if (match145 == -1) { throw new Error("no opcode matched"); }
+		let v146;
+		if (match145 == 0) {
+			let v147 = ext[2].read(state);
+			v146 = v147;
+		}
+		else if (match145 == 1) {
+			let v148 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v146 = v148;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v146 !== undefined) { obj112.animid = v146; }
+		let hidden149 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden149);
+		let v150 = ext[6].read(state);
+		hidden149.$opcode = v150;
+		let ref151 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match152 = -1;
+		if (ref151 > 616) { match152 = 0; }
+		else if (true) { match152 = 1; }
+		if (match152 == -1) { throw new Error("no opcode matched"); }
+		let v153;
+		if (match152 == 0) {
+			v153 = null;
+		}
+		else if (match152 == 1) {
+			let v154 = ext[7].read(state);
+			v153 = v154;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v153 !== undefined) { obj112.unkdata = v153; }
+		let hidden155 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden155);
+		hidden155.$opcode = 0;
+		let ref156 = state.stack[state.stack.length - 3].aspectwidthtype;
+		let match157 = -1;
+		if (ref156 != 0) { match157 = 0; }
+		else if (true) { match157 = 1; }
+		if (match157 == -1) { throw new Error("no opcode matched"); }
+		let v158;
+		if (match157 == 0) {
+			let v159 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v158 = v159;
+		}
+		else if (match157 == 1) {
+			v158 = -1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v158 !== undefined) { obj112.aspectwidthdata = v158; }
+		let hidden160 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden160);
+		hidden160.$opcode = 0;
+		let ref161 = state.stack[state.stack.length - 3].aspectheighttype;
+		let match162 = -1;
+		if (ref161 != 0) { match162 = 0; }
+		else if (true) { match162 = 1; }
+		if (match162 == -1) { throw new Error("no opcode matched"); }
+		let v163;
+		if (match162 == 0) {
+			let v164 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			v163 = v164;
+		}
+		else if (match162 == 1) {
+			v163 = -1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v163 !== undefined) { obj112.aspectheightdata = v163; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v111 = obj112;
+	}
+	if (v111 !== undefined) { obj0.modeldata = v111; }
+	let ref165 = state.stack[state.stack.length - 1].type;
+	let match166 = -1;
+	if (ref165 == 9) { match166 = 0; }
+	let v167 = null;
+	if (match166 != -1) {
+		let obj168 = {};
+		let hidden169 = {};
+		state.stack.push(obj168);
+		state.hiddenstack.push(hidden169);
+		let v170 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v170 !== undefined) { obj168.width = v170; }
+		let v171 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v171 !== undefined) { obj168.color = v171; }
+		let v172 = state.view.getUint8(state.scan++);
+		if (v172 != 0 && v172 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v172 != 0) !== undefined) { obj168.dir = (v172 != 0); }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v167 = obj168;
+	}
+	if (v167 !== undefined) { obj0.linedata = v167; }
+	let ref173 = state.stack[state.stack.length - 1].type;
+	let match174 = -1;
+	if (ref173 == 10) { match174 = 0; }
+	let v175 = null;
+	if (match174 != -1) {
+		let obj176 = {};
+		let hidden177 = {};
+		state.stack.push(obj176);
+		state.hiddenstack.push(hidden177);
+		let v178 = ext[8].read(state);
+		if (v178 !== undefined) { obj176.data = v178; }
+		let v179 = ext[1].read(state);
+		if (v179 !== undefined) { obj176.str1 = v179; }
+		let v180 = ext[9].read(state);
+		if (v180 !== undefined) { obj176.data2 = v180; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v175 = obj176;
+	}
+	if (v175 !== undefined) { obj0.unk10data = v175; }
+	let ref181 = state.stack[state.stack.length - 1].type;
+	let match182 = -1;
+	if (ref181 == 11) { match182 = 0; }
+	let v183 = null;
+	if (match182 != -1) {
+		let obj184 = {};
+		let hidden185 = {};
+		state.stack.push(obj184);
+		state.hiddenstack.push(hidden185);
+		let v186 = ext[10].read(state);
+		if (v186 !== undefined) { obj184.data = v186; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v183 = obj184;
+	}
+	if (v183 !== undefined) { obj0.unk11data = v183; }
+	let ref187 = state.stack[state.stack.length - 1].type;
+	let match188 = -1;
+	if (ref187 == 12) { match188 = 0; }
+	let v189 = null;
+	if (match188 != -1) {
+		let obj190 = {};
+		let hidden191 = {};
+		state.stack.push(obj190);
+		state.hiddenstack.push(hidden191);
+		let v192 = ext[11].read(state);
+		if (v192 !== undefined) { obj190.data = v192; }
+		let v193 = ext[1].read(state);
+		if (v193 !== undefined) { obj190.str = v193; }
+		let v194 = ext[12].read(state);
+		if (v194 !== undefined) { obj190.data2 = v194; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v189 = obj190;
+	}
+	if (v189 !== undefined) { obj0.unk12data = v189; }
+	let ref195 = state.stack[state.stack.length - 1].type;
+	let match196 = -1;
+	if (ref195 == 13) { match196 = 0; }
+	let v197 = null;
+	if (match196 != -1) {
+		let obj198 = {};
+		let hidden199 = {};
+		state.stack.push(obj198);
+		state.hiddenstack.push(hidden199);
+		let v200 = ext[13].read(state);
+		if (v200 !== undefined) { obj198.data = v200; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v197 = obj198;
+	}
+	if (v197 !== undefined) { obj0.unk13data = v197; }
+	let ref201 = state.stack[state.stack.length - 1].type;
+	let match202 = -1;
+	if (ref201 == 15) { match202 = 0; }
+	let v203 = null;
+	if (match202 != -1) {
+		let obj204 = {};
+		let hidden205 = {};
+		state.stack.push(obj204);
+		state.hiddenstack.push(hidden205);
+		let v206 = ext[14].read(state);
+		if (v206 !== undefined) { obj204.data = v206; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v203 = obj204;
+	}
+	if (v203 !== undefined) { obj0.unk15data = v203; }
+	let ref207 = state.stack[state.stack.length - 1].type;
+	let match208 = -1;
+	if (ref207 == 16) { match208 = 0; }
+	let v209 = null;
+	if (match208 != -1) {
+		let obj210 = {};
+		let hidden211 = {};
+		state.stack.push(obj210);
+		state.hiddenstack.push(hidden211);
+		let v212 = ext[15].read(state);
+		if (v212 !== undefined) { obj210.data = v212; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v209 = obj210;
+	}
+	if (v209 !== undefined) { obj0.unk16data = v209; }
+	let ref213 = state.stack[state.stack.length - 1].version;
+	let match214 = -1;
+	if (ref213 >= 6) { match214 = 0; }
+	let v215 = null;
+	if (match214 != -1) {
+		let v216 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		v215 = v216;
+	}
+	if (v215 !== undefined) { obj0.unkffff = v215; }
+	let v217 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v217 !== undefined) { obj0.optmask = v217; }
+	let v218 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v218 !== undefined) { obj0.unk2 = v218; }
+	let ref219 = state.stack[state.stack.length - 1].version;
+	let match220 = -1;
+	if (ref219 >= 7) { match220 = 0; }
+	let v221 = null;
+	if (match220 != -1) {
+		let v222 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v221 = v222;
+	}
+	if (v221 !== undefined) { obj0.unkprepre3 = v221; }
+	let ref223 = state.stack[state.stack.length - 1].version;
+	let match224 = -1;
+	if (ref223 >= 6) { match224 = 0; }
+	let v225 = null;
+	if (match224 != -1) {
+		let v226 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v225 = v226;
+	}
+	if (v225 !== undefined) { obj0.unkpre3 = v225; }
+	let hidden227 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden227);
+	hidden227.$opcode = 0;
+	let ref228 = state.stack[state.stack.length - 2].version;
+	let match229 = -1;
+	if (ref228 == -1) { match229 = 0; }
+	else if (true) { match229 = 1; }
+	if (match229 == -1) { throw new Error("no opcode matched"); }
+	let v230;
+	if (match229 == 0) {
+		let v231 = ext[16].read(state);
+		v230 = v231;
+	}
+	else if (match229 == 1) {
+		let obj232 = {};
+		let hidden233 = {};
+		state.stack.push(obj232);
+		state.hiddenstack.push(hidden233);
+		let v234 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v234 !== undefined) { obj232.op = v234; }
+		let ref235 = state.stack[state.stack.length - 1].op;
+		let match236 = -1;
+		if (ref235 != 0) { match236 = 0; }
+		let v237 = null;
+		if (match236 != -1) {
+			let v238 = ext[17].read(state);
+			v237 = v238;
+		}
+		if (v237 !== undefined) { obj232.data = v237; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v230 = obj232;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v230 !== undefined) { obj0.unk3 = v230; }
+	let v239 = ext[1].read(state);
+	if (v239 !== undefined) { obj0.name2 = v239; }
+	let v240 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v240 !== undefined) { obj0.menucounts = v240; }
+	let ref241 = state.stack[state.stack.length - 1].menucounts;
+	ref241 = (ref241 >> 0) & 15;
+	ref241 = ref241 + 0;
+	let hidden242 = { $index: 0, $length: ref241 };
+	state.hiddenstack.push(hidden242);
+	state.stack.push({});
+	let arr243 = [];
+	for (let i244 = 0; i244 < ref241; i244++) {
+		hidden242.$index = i244;
+		let v245 = ext[1].read(state);
+		arr243.push(v245);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr243 !== undefined) { obj0.rightclickopts = arr243; }
+	let ref246 = state.stack[state.stack.length - 1].menucounts;
+	ref246 = (ref246 >> 4) & 15;
+	ref246 = ref246 + 0;
+	let hidden247 = { $index: 0, $length: ref246 };
+	state.hiddenstack.push(hidden247);
+	state.stack.push({});
+	let arr248 = [];
+	for (let i249 = 0; i249 < ref246; i249++) {
+		hidden247.$index = i249;
+		let obj250 = {};
+		let hidden251 = {};
+		state.stack.push(obj250);
+		state.hiddenstack.push(hidden251);
+		let v252 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v252 !== undefined) { obj250.op = v252; }
+		let v253 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v253 !== undefined) { obj250.cursor = v253; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr248.push(obj250);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr248 !== undefined) { obj0.rightclickcursors = arr248; }
+	let ref254 = state.stack[state.stack.length - 1].optmask;
+	let match255 = -1;
+	if ((ref254 & 1024) == 0) { match255 = 0; }
+	let v256 = null;
+	if (match255 != -1) {
+		let v257 = ext[1].read(state);
+		v256 = v257;
+	}
+	if (v256 !== undefined) { obj0.unkstring1 = v256; }
+	let v258 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v258 !== undefined) { obj0.unk4 = v258; }
+	let ref259 = state.stack[state.stack.length - 1].optmask;
+	let match260 = -1;
+	if ((ref259 & 1024) != 0) { match260 = 0; }
+	let v261 = null;
+	if (match260 != -1) {
+		let v262 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v261 = v262;
+	}
+	if (v261 !== undefined) { obj0.bit4data = v261; }
+	let v263 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v263 !== undefined) { obj0.unk5 = v263; }
+	let v264 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v264 !== undefined) { obj0.unk6 = v264; }
+	let v265 = ext[1].read(state);
+	if (v265 !== undefined) { obj0.unkstuff123 = v265; }
+	let ref266 = state.stack[state.stack.length - 1].optmask;
+	let match267 = -1;
+	if ((ref266 & 576) != 0) { match267 = 0; }
+	let v268 = null;
+	if (match267 != -1) {
+		let v269 = ext[18].read(state);
+		v268 = v269;
+	}
+	if (v268 !== undefined) { obj0.optmask1data_bit40 = v268; }
+	let hidden270 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden270);
+	hidden270.$opcode = 0;
+	let ref271 = state.stack[state.stack.length - 2].version;
+	let match272 = -1;
+	if (ref271 >= 0) { match272 = 0; }
+	else if (true) { match272 = 1; }
+	if (match272 == -1) { throw new Error("no opcode matched"); }
+	let v273;
+	if (match272 == 0) {
+		let v274 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		v273 = v274;
+	}
+	else if (match272 == 1) {
+		v273 = -1;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v273 !== undefined) { obj0.cursor = v273; }
+	let ref275 = state.stack[state.stack.length - 1].version;
+	let match276 = -1;
+	if (ref275 >= 0) { match276 = 0; }
+	let v277 = null;
+	if (match276 != -1) {
+		let v278 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		v277 = v278;
+	}
+	if (v277 !== undefined) { obj0.unkdata = v277; }
+	let ref279 = state.stack[state.stack.length - 1].version;
+	let ref280 = state.stack[state.stack.length - 1].unkdata;
+	let match281 = -1;
+	if (ref279 >= 0 && ref280 != 0) { match281 = 0; }
+	let v282 = null;
+	if (match281 != -1) {
+		let v283 = ext[19].read(state);
+		v282 = v283;
+	}
+	if (v282 !== undefined) { obj0.unkdatadata = v282; }
+	let obj284 = {};
+	let hidden285 = {};
+	state.stack.push(obj284);
+	state.hiddenstack.push(hidden285);
+	let v286 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden287 = { $index: 0, $length: v286 };
+	state.hiddenstack.push(hidden287);
+	state.stack.push({});
+	let arr288 = [];
+	for (let i289 = 0; i289 < v286; i289++) {
+		hidden287.$index = i289;
+		let hidden290 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden290);
+		let v291 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden290.$opcode = v291;
+		let ref292 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match293 = -1;
+		if (ref292 == 0) { match293 = 0; }
+		else if (ref292 == 1) { match293 = 1; }
+		if (match293 == -1) { throw new Error("no opcode matched"); }
+		let v294;
+		if (match293 == 0) {
+			let v295 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v294 = v295;
+		}
+		else if (match293 == 1) {
+			let v296 = ext[1].read(state);
+			v294 = v296;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr288.push(v294);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr288 !== undefined) { obj284.load = arr288; }
+	let v297 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden298 = { $index: 0, $length: v297 };
+	state.hiddenstack.push(hidden298);
+	state.stack.push({});
+	let arr299 = [];
+	for (let i300 = 0; i300 < v297; i300++) {
+		hidden298.$index = i300;
+		let hidden301 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden301);
+		let v302 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden301.$opcode = v302;
+		let ref303 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match304 = -1;
+		if (ref303 == 0) { match304 = 0; }
+		else if (ref303 == 1) { match304 = 1; }
+		if (match304 == -1) { throw new Error("no opcode matched"); }
+		let v305;
+		if (match304 == 0) {
+			let v306 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v305 = v306;
+		}
+		else if (match304 == 1) {
+			let v307 = ext[1].read(state);
+			v305 = v307;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr299.push(v305);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr299 !== undefined) { obj284.mousehover = arr299; }
+	let v308 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden309 = { $index: 0, $length: v308 };
+	state.hiddenstack.push(hidden309);
+	state.stack.push({});
+	let arr310 = [];
+	for (let i311 = 0; i311 < v308; i311++) {
+		hidden309.$index = i311;
+		let hidden312 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden312);
+		let v313 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden312.$opcode = v313;
+		let ref314 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match315 = -1;
+		if (ref314 == 0) { match315 = 0; }
+		else if (ref314 == 1) { match315 = 1; }
+		if (match315 == -1) { throw new Error("no opcode matched"); }
+		let v316;
+		if (match315 == 0) {
+			let v317 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v316 = v317;
+		}
+		else if (match315 == 1) {
+			let v318 = ext[1].read(state);
+			v316 = v318;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr310.push(v316);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr310 !== undefined) { obj284.mouseleave = arr310; }
+	let v319 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden320 = { $index: 0, $length: v319 };
+	state.hiddenstack.push(hidden320);
+	state.stack.push({});
+	let arr321 = [];
+	for (let i322 = 0; i322 < v319; i322++) {
+		hidden320.$index = i322;
+		let hidden323 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden323);
+		let v324 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden323.$opcode = v324;
+		let ref325 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match326 = -1;
+		if (ref325 == 0) { match326 = 0; }
+		else if (ref325 == 1) { match326 = 1; }
+		if (match326 == -1) { throw new Error("no opcode matched"); }
+		let v327;
+		if (match326 == 0) {
+			let v328 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v327 = v328;
+		}
+		else if (match326 == 1) {
+			let v329 = ext[1].read(state);
+			v327 = v329;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr321.push(v327);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr321 !== undefined) { obj284.unk0 = arr321; }
+	let v330 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden331 = { $index: 0, $length: v330 };
+	state.hiddenstack.push(hidden331);
+	state.stack.push({});
+	let arr332 = [];
+	for (let i333 = 0; i333 < v330; i333++) {
+		hidden331.$index = i333;
+		let hidden334 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden334);
+		let v335 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden334.$opcode = v335;
+		let ref336 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match337 = -1;
+		if (ref336 == 0) { match337 = 0; }
+		else if (ref336 == 1) { match337 = 1; }
+		if (match337 == -1) { throw new Error("no opcode matched"); }
+		let v338;
+		if (match337 == 0) {
+			let v339 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v338 = v339;
+		}
+		else if (match337 == 1) {
+			let v340 = ext[1].read(state);
+			v338 = v340;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr332.push(v338);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr332 !== undefined) { obj284.unk1 = arr332; }
+	let v341 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden342 = { $index: 0, $length: v341 };
+	state.hiddenstack.push(hidden342);
+	state.stack.push({});
+	let arr343 = [];
+	for (let i344 = 0; i344 < v341; i344++) {
+		hidden342.$index = i344;
+		let hidden345 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden345);
+		let v346 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden345.$opcode = v346;
+		let ref347 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match348 = -1;
+		if (ref347 == 0) { match348 = 0; }
+		else if (ref347 == 1) { match348 = 1; }
+		if (match348 == -1) { throw new Error("no opcode matched"); }
+		let v349;
+		if (match348 == 0) {
+			let v350 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v349 = v350;
+		}
+		else if (match348 == 1) {
+			let v351 = ext[1].read(state);
+			v349 = v351;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr343.push(v349);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr343 !== undefined) { obj284.unk2 = arr343; }
+	let v352 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden353 = { $index: 0, $length: v352 };
+	state.hiddenstack.push(hidden353);
+	state.stack.push({});
+	let arr354 = [];
+	for (let i355 = 0; i355 < v352; i355++) {
+		hidden353.$index = i355;
+		let hidden356 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden356);
+		let v357 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden356.$opcode = v357;
+		let ref358 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match359 = -1;
+		if (ref358 == 0) { match359 = 0; }
+		else if (ref358 == 1) { match359 = 1; }
+		if (match359 == -1) { throw new Error("no opcode matched"); }
+		let v360;
+		if (match359 == 0) {
+			let v361 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v360 = v361;
+		}
+		else if (match359 == 1) {
+			let v362 = ext[1].read(state);
+			v360 = v362;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr354.push(v360);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr354 !== undefined) { obj284.unk3 = arr354; }
+	let v363 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden364 = { $index: 0, $length: v363 };
+	state.hiddenstack.push(hidden364);
+	state.stack.push({});
+	let arr365 = [];
+	for (let i366 = 0; i366 < v363; i366++) {
+		hidden364.$index = i366;
+		let hidden367 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden367);
+		let v368 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden367.$opcode = v368;
+		let ref369 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match370 = -1;
+		if (ref369 == 0) { match370 = 0; }
+		else if (ref369 == 1) { match370 = 1; }
+		if (match370 == -1) { throw new Error("no opcode matched"); }
+		let v371;
+		if (match370 == 0) {
+			let v372 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v371 = v372;
+		}
+		else if (match370 == 1) {
+			let v373 = ext[1].read(state);
+			v371 = v373;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr365.push(v371);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr365 !== undefined) { obj284.unk4 = arr365; }
+	let v374 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden375 = { $index: 0, $length: v374 };
+	state.hiddenstack.push(hidden375);
+	state.stack.push({});
+	let arr376 = [];
+	for (let i377 = 0; i377 < v374; i377++) {
+		hidden375.$index = i377;
+		let hidden378 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden378);
+		let v379 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden378.$opcode = v379;
+		let ref380 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match381 = -1;
+		if (ref380 == 0) { match381 = 0; }
+		else if (ref380 == 1) { match381 = 1; }
+		if (match381 == -1) { throw new Error("no opcode matched"); }
+		let v382;
+		if (match381 == 0) {
+			let v383 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v382 = v383;
+		}
+		else if (match381 == 1) {
+			let v384 = ext[1].read(state);
+			v382 = v384;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr376.push(v382);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr376 !== undefined) { obj284.unk5 = arr376; }
+	let v385 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden386 = { $index: 0, $length: v385 };
+	state.hiddenstack.push(hidden386);
+	state.stack.push({});
+	let arr387 = [];
+	for (let i388 = 0; i388 < v385; i388++) {
+		hidden386.$index = i388;
+		let hidden389 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden389);
+		let v390 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden389.$opcode = v390;
+		let ref391 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match392 = -1;
+		if (ref391 == 0) { match392 = 0; }
+		else if (ref391 == 1) { match392 = 1; }
+		if (match392 == -1) { throw new Error("no opcode matched"); }
+		let v393;
+		if (match392 == 0) {
+			let v394 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v393 = v394;
+		}
+		else if (match392 == 1) {
+			let v395 = ext[1].read(state);
+			v393 = v395;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr387.push(v393);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr387 !== undefined) { obj284.unk6 = arr387; }
+	let ref396 = state.stack[state.stack.length - 2].version;
+	let match397 = -1;
+	if (ref396 >= 0) { match397 = 0; }
+	let v398 = null;
+	if (match397 != -1) {
+		let v399 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden400 = { $index: 0, $length: v399 };
+		state.hiddenstack.push(hidden400);
+		state.stack.push({});
+		let arr401 = [];
+		for (let i402 = 0; i402 < v399; i402++) {
+			hidden400.$index = i402;
+			let hidden403 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden403);
+			let v404 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			hidden403.$opcode = v404;
+			let ref405 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match406 = -1;
+			if (ref405 == 0) { match406 = 0; }
+			else if (ref405 == 1) { match406 = 1; }
+			if (match406 == -1) { throw new Error("no opcode matched"); }
+			let v407;
+			if (match406 == 0) {
+				let v408 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				v407 = v408;
+			}
+			else if (match406 == 1) {
+				let v409 = ext[1].read(state);
+				v407 = v409;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr401.push(v407);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v398 = arr401;
+	}
+	if (v398 !== undefined) { obj284.unk7 = v398; }
+	let v410 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden411 = { $index: 0, $length: v410 };
+	state.hiddenstack.push(hidden411);
+	state.stack.push({});
+	let arr412 = [];
+	for (let i413 = 0; i413 < v410; i413++) {
+		hidden411.$index = i413;
+		let hidden414 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden414);
+		let v415 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden414.$opcode = v415;
+		let ref416 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match417 = -1;
+		if (ref416 == 0) { match417 = 0; }
+		else if (ref416 == 1) { match417 = 1; }
+		if (match417 == -1) { throw new Error("no opcode matched"); }
+		let v418;
+		if (match417 == 0) {
+			let v419 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v418 = v419;
+		}
+		else if (match417 == 1) {
+			let v420 = ext[1].read(state);
+			v418 = v420;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr412.push(v418);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr412 !== undefined) { obj284.hovertext = arr412; }
+	let v421 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden422 = { $index: 0, $length: v421 };
+	state.hiddenstack.push(hidden422);
+	state.stack.push({});
+	let arr423 = [];
+	for (let i424 = 0; i424 < v421; i424++) {
+		hidden422.$index = i424;
+		let hidden425 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden425);
+		let v426 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden425.$opcode = v426;
+		let ref427 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match428 = -1;
+		if (ref427 == 0) { match428 = 0; }
+		else if (ref427 == 1) { match428 = 1; }
+		if (match428 == -1) { throw new Error("no opcode matched"); }
+		let v429;
+		if (match428 == 0) {
+			let v430 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v429 = v430;
+		}
+		else if (match428 == 1) {
+			let v431 = ext[1].read(state);
+			v429 = v431;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr423.push(v429);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr423 !== undefined) { obj284.unk8 = arr423; }
+	let v432 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden433 = { $index: 0, $length: v432 };
+	state.hiddenstack.push(hidden433);
+	state.stack.push({});
+	let arr434 = [];
+	for (let i435 = 0; i435 < v432; i435++) {
+		hidden433.$index = i435;
+		let hidden436 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden436);
+		let v437 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden436.$opcode = v437;
+		let ref438 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match439 = -1;
+		if (ref438 == 0) { match439 = 0; }
+		else if (ref438 == 1) { match439 = 1; }
+		if (match439 == -1) { throw new Error("no opcode matched"); }
+		let v440;
+		if (match439 == 0) {
+			let v441 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v440 = v441;
+		}
+		else if (match439 == 1) {
+			let v442 = ext[1].read(state);
+			v440 = v442;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr434.push(v440);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr434 !== undefined) { obj284.unk9 = arr434; }
+	let v443 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden444 = { $index: 0, $length: v443 };
+	state.hiddenstack.push(hidden444);
+	state.stack.push({});
+	let arr445 = [];
+	for (let i446 = 0; i446 < v443; i446++) {
+		hidden444.$index = i446;
+		let hidden447 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden447);
+		let v448 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden447.$opcode = v448;
+		let ref449 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match450 = -1;
+		if (ref449 == 0) { match450 = 0; }
+		else if (ref449 == 1) { match450 = 1; }
+		if (match450 == -1) { throw new Error("no opcode matched"); }
+		let v451;
+		if (match450 == 0) {
+			let v452 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v451 = v452;
+		}
+		else if (match450 == 1) {
+			let v453 = ext[1].read(state);
+			v451 = v453;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr445.push(v451);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr445 !== undefined) { obj284.unk10 = arr445; }
+	let v454 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden455 = { $index: 0, $length: v454 };
+	state.hiddenstack.push(hidden455);
+	state.stack.push({});
+	let arr456 = [];
+	for (let i457 = 0; i457 < v454; i457++) {
+		hidden455.$index = i457;
+		let hidden458 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden458);
+		let v459 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden458.$opcode = v459;
+		let ref460 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match461 = -1;
+		if (ref460 == 0) { match461 = 0; }
+		else if (ref460 == 1) { match461 = 1; }
+		if (match461 == -1) { throw new Error("no opcode matched"); }
+		let v462;
+		if (match461 == 0) {
+			let v463 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v462 = v463;
+		}
+		else if (match461 == 1) {
+			let v464 = ext[1].read(state);
+			v462 = v464;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr456.push(v462);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr456 !== undefined) { obj284.unk11 = arr456; }
+	let v465 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden466 = { $index: 0, $length: v465 };
+	state.hiddenstack.push(hidden466);
+	state.stack.push({});
+	let arr467 = [];
+	for (let i468 = 0; i468 < v465; i468++) {
+		hidden466.$index = i468;
+		let hidden469 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden469);
+		let v470 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden469.$opcode = v470;
+		let ref471 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match472 = -1;
+		if (ref471 == 0) { match472 = 0; }
+		else if (ref471 == 1) { match472 = 1; }
+		if (match472 == -1) { throw new Error("no opcode matched"); }
+		let v473;
+		if (match472 == 0) {
+			let v474 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v473 = v474;
+		}
+		else if (match472 == 1) {
+			let v475 = ext[1].read(state);
+			v473 = v475;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr467.push(v473);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr467 !== undefined) { obj284.unk12 = arr467; }
+	let v476 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden477 = { $index: 0, $length: v476 };
+	state.hiddenstack.push(hidden477);
+	state.stack.push({});
+	let arr478 = [];
+	for (let i479 = 0; i479 < v476; i479++) {
+		hidden477.$index = i479;
+		let hidden480 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden480);
+		let v481 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden480.$opcode = v481;
+		let ref482 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match483 = -1;
+		if (ref482 == 0) { match483 = 0; }
+		else if (ref482 == 1) { match483 = 1; }
+		if (match483 == -1) { throw new Error("no opcode matched"); }
+		let v484;
+		if (match483 == 0) {
+			let v485 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v484 = v485;
+		}
+		else if (match483 == 1) {
+			let v486 = ext[1].read(state);
+			v484 = v486;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr478.push(v484);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr478 !== undefined) { obj284.unk13 = arr478; }
+	let v487 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden488 = { $index: 0, $length: v487 };
+	state.hiddenstack.push(hidden488);
+	state.stack.push({});
+	let arr489 = [];
+	for (let i490 = 0; i490 < v487; i490++) {
+		hidden488.$index = i490;
+		let hidden491 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden491);
+		let v492 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden491.$opcode = v492;
+		let ref493 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match494 = -1;
+		if (ref493 == 0) { match494 = 0; }
+		else if (ref493 == 1) { match494 = 1; }
+		if (match494 == -1) { throw new Error("no opcode matched"); }
+		let v495;
+		if (match494 == 0) {
+			let v496 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v495 = v496;
+		}
+		else if (match494 == 1) {
+			let v497 = ext[1].read(state);
+			v495 = v497;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr489.push(v495);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr489 !== undefined) { obj284.unk14 = arr489; }
+	let v498 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden499 = { $index: 0, $length: v498 };
+	state.hiddenstack.push(hidden499);
+	state.stack.push({});
+	let arr500 = [];
+	for (let i501 = 0; i501 < v498; i501++) {
+		hidden499.$index = i501;
+		let hidden502 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden502);
+		let v503 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden502.$opcode = v503;
+		let ref504 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match505 = -1;
+		if (ref504 == 0) { match505 = 0; }
+		else if (ref504 == 1) { match505 = 1; }
+		if (match505 == -1) { throw new Error("no opcode matched"); }
+		let v506;
+		if (match505 == 0) {
+			let v507 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v506 = v507;
+		}
+		else if (match505 == 1) {
+			let v508 = ext[1].read(state);
+			v506 = v508;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr500.push(v506);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr500 !== undefined) { obj284.unk15 = arr500; }
+	let v509 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden510 = { $index: 0, $length: v509 };
+	state.hiddenstack.push(hidden510);
+	state.stack.push({});
+	let arr511 = [];
+	for (let i512 = 0; i512 < v509; i512++) {
+		hidden510.$index = i512;
+		let hidden513 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden513);
+		let v514 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden513.$opcode = v514;
+		let ref515 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match516 = -1;
+		if (ref515 == 0) { match516 = 0; }
+		else if (ref515 == 1) { match516 = 1; }
+		if (match516 == -1) { throw new Error("no opcode matched"); }
+		let v517;
+		if (match516 == 0) {
+			let v518 = state.view.getInt32(state.scan);
+			state.scan += 4;
+			v517 = v518;
+		}
+		else if (match516 == 1) {
+			let v519 = ext[1].read(state);
+			v517 = v519;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr511.push(v517);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr511 !== undefined) { obj284.unk16 = arr511; }
+	let ref520 = state.stack[state.stack.length - 2].version;
+	let match521 = -1;
+	if (ref520 >= 6) { match521 = 0; }
+	let v522 = null;
+	if (match521 != -1) {
+		let v523 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden524 = { $index: 0, $length: v523 };
+		state.hiddenstack.push(hidden524);
+		state.stack.push({});
+		let arr525 = [];
+		for (let i526 = 0; i526 < v523; i526++) {
+			hidden524.$index = i526;
+			let hidden527 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden527);
+			let v528 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			hidden527.$opcode = v528;
+			let ref529 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match530 = -1;
+			if (ref529 == 0) { match530 = 0; }
+			else if (ref529 == 1) { match530 = 1; }
+			if (match530 == -1) { throw new Error("no opcode matched"); }
+			let v531;
+			if (match530 == 0) {
+				let v532 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				v531 = v532;
+			}
+			else if (match530 == 1) {
+				let v533 = ext[1].read(state);
+				v531 = v533;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr525.push(v531);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v522 = arr525;
+	}
+	if (v522 !== undefined) { obj284.unk17 = v522; }
+	let ref534 = state.stack[state.stack.length - 2].version;
+	let match535 = -1;
+	if (ref534 >= 6) { match535 = 0; }
+	let v536 = null;
+	if (match535 != -1) {
+		let v537 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden538 = { $index: 0, $length: v537 };
+		state.hiddenstack.push(hidden538);
+		state.stack.push({});
+		let arr539 = [];
+		for (let i540 = 0; i540 < v537; i540++) {
+			hidden538.$index = i540;
+			let hidden541 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden541);
+			let v542 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			hidden541.$opcode = v542;
+			let ref543 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match544 = -1;
+			if (ref543 == 0) { match544 = 0; }
+			else if (ref543 == 1) { match544 = 1; }
+			if (match544 == -1) { throw new Error("no opcode matched"); }
+			let v545;
+			if (match544 == 0) {
+				let v546 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				v545 = v546;
+			}
+			else if (match544 == 1) {
+				let v547 = ext[1].read(state);
+				v545 = v547;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr539.push(v545);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v536 = arr539;
+	}
+	if (v536 !== undefined) { obj284.unk18 = v536; }
+	let ref548 = state.stack[state.stack.length - 2].version;
+	let match549 = -1;
+	if (ref548 >= 6) { match549 = 0; }
+	let v550 = null;
+	if (match549 != -1) {
+		let v551 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden552 = { $index: 0, $length: v551 };
+		state.hiddenstack.push(hidden552);
+		state.stack.push({});
+		let arr553 = [];
+		for (let i554 = 0; i554 < v551; i554++) {
+			hidden552.$index = i554;
+			let hidden555 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden555);
+			let v556 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			hidden555.$opcode = v556;
+			let ref557 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match558 = -1;
+			if (ref557 == 0) { match558 = 0; }
+			else if (ref557 == 1) { match558 = 1; }
+			if (match558 == -1) { throw new Error("no opcode matched"); }
+			let v559;
+			if (match558 == 0) {
+				let v560 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				v559 = v560;
+			}
+			else if (match558 == 1) {
+				let v561 = ext[1].read(state);
+				v559 = v561;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr553.push(v559);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v550 = arr553;
+	}
+	if (v550 !== undefined) { obj284.unk19 = v550; }
+	let ref562 = state.stack[state.stack.length - 2].version;
+	let match563 = -1;
+	if (ref562 >= 7) { match563 = 0; }
+	let v564 = null;
+	if (match563 != -1) {
+		let v565 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden566 = { $index: 0, $length: v565 };
+		state.hiddenstack.push(hidden566);
+		state.stack.push({});
+		let arr567 = [];
+		for (let i568 = 0; i568 < v565; i568++) {
+			hidden566.$index = i568;
+			let hidden569 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden569);
+			let v570 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			hidden569.$opcode = v570;
+			let ref571 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match572 = -1;
+			if (ref571 == 0) { match572 = 0; }
+			else if (ref571 == 1) { match572 = 1; }
+			if (match572 == -1) { throw new Error("no opcode matched"); }
+			let v573;
+			if (match572 == 0) {
+				let v574 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				v573 = v574;
+			}
+			else if (match572 == 1) {
+				let v575 = ext[1].read(state);
+				v573 = v575;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr567.push(v573);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v564 = arr567;
+	}
+	if (v564 !== undefined) { obj284.unk20 = v564; }
+	let v576 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden577 = { $index: 0, $length: v576 };
+	state.hiddenstack.push(hidden577);
+	state.stack.push({});
+	let arr578 = [];
+	for (let i579 = 0; i579 < v576; i579++) {
+		hidden577.$index = i579;
+		let v580 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		arr578.push(v580);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr578 !== undefined) { obj284.v2unk0 = arr578; }
+	let v581 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden582 = { $index: 0, $length: v581 };
+	state.hiddenstack.push(hidden582);
+	state.stack.push({});
+	let arr583 = [];
+	for (let i584 = 0; i584 < v581; i584++) {
+		hidden582.$index = i584;
+		let v585 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		arr583.push(v585);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr583 !== undefined) { obj284.v2unk1 = arr583; }
+	let v586 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden587 = { $index: 0, $length: v586 };
+	state.hiddenstack.push(hidden587);
+	state.stack.push({});
+	let arr588 = [];
+	for (let i589 = 0; i589 < v586; i589++) {
+		hidden587.$index = i589;
+		let v590 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		arr588.push(v590);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr588 !== undefined) { obj284.v2unk2 = arr588; }
+	let v591 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden592 = { $index: 0, $length: v591 };
+	state.hiddenstack.push(hidden592);
+	state.stack.push({});
+	let arr593 = [];
+	for (let i594 = 0; i594 < v591; i594++) {
+		hidden592.$index = i594;
+		let v595 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		arr593.push(v595);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr593 !== undefined) { obj284.v2unk3 = arr593; }
+	let v596 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden597 = { $index: 0, $length: v596 };
+	state.hiddenstack.push(hidden597);
+	state.stack.push({});
+	let arr598 = [];
+	for (let i599 = 0; i599 < v596; i599++) {
+		hidden597.$index = i599;
+		let v600 = state.view.getInt32(state.scan);
+		state.scan += 4;
+		arr598.push(v600);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr598 !== undefined) { obj284.v2unk4 = arr598; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (obj284 !== undefined) { obj0.scripts = obj284; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden601 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden601);
+	let w602 = value.version;
+	let hidden603 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden603);
+	hidden603.$opcode = ext[0].readConst(state);
+	let ref604 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match605 = -1;
+	if (ref604 > 500) { match605 = 0; }
+	else if (true) { match605 = 1; }
+	if (match605 == -1) { throw new Error("no opcode matched"); }
+	if (match605 == 0) {
+		if (typeof w602 != "number" || w602 > 127 || w602 < -128) { throw new Error(); }
+		state.buffer.writeInt8(w602, state.scan);
+		state.scan += 1;
+	}
+	else if (match605 == 1) {
+		if (w602 != -1) { throw new Error("expected constant -1 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w606 = value.type;
+	if (typeof w606 != "number" || w606 > 255 || w606 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w606, state.scan);
+	state.scan += 1;
+	let w607 = value.name;
+	if (w607 != null) {
+		ext[1].write(state, w607);
+	}
+	let w608 = value.contenttype;
+	if (typeof w608 != "number" || w608 > 65535 || w608 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w608, state.scan);
+	state.scan += 2;
+	let w609 = value.baseposx;
+	if (typeof w609 != "number" || w609 > 32767 || w609 < -32768) { throw new Error(); }
+	state.buffer.writeInt16BE(w609, state.scan);
+	state.scan += 2;
+	let w610 = value.baseposy;
+	if (typeof w610 != "number" || w610 > 32767 || w610 < -32768) { throw new Error(); }
+	state.buffer.writeInt16BE(w610, state.scan);
+	state.scan += 2;
+	let w611 = value.basewidth;
+	if (typeof w611 != "number" || w611 > 32767 || w611 < -32768) { throw new Error(); }
+	state.buffer.writeInt16BE(w611, state.scan);
+	state.scan += 2;
+	let w612 = value.baseheight;
+	if (typeof w612 != "number" || w612 > 32767 || w612 < -32768) { throw new Error(); }
+	state.buffer.writeInt16BE(w612, state.scan);
+	state.scan += 2;
+	let w613 = value.aspectwidthtype;
+	if (typeof w613 != "number" || w613 > 127 || w613 < -128) { throw new Error(); }
+	state.buffer.writeInt8(w613, state.scan);
+	state.scan += 1;
+	let w614 = value.aspectheighttype;
+	if (typeof w614 != "number" || w614 > 127 || w614 < -128) { throw new Error(); }
+	state.buffer.writeInt8(w614, state.scan);
+	state.scan += 1;
+	let w615 = value.aspectxtype;
+	if (typeof w615 != "number" || w615 > 127 || w615 < -128) { throw new Error(); }
+	state.buffer.writeInt8(w615, state.scan);
+	state.scan += 1;
+	let w616 = value.aspectytype;
+	if (typeof w616 != "number" || w616 > 127 || w616 < -128) { throw new Error(); }
+	state.buffer.writeInt8(w616, state.scan);
+	state.scan += 1;
+	let w617 = value.parentid;
+	if (typeof w617 != "number" || w617 > 65535 || w617 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w617, state.scan);
+	state.scan += 2;
+	let w618 = value.hidden;
+	if (typeof w618 != "number" || w618 > 255 || w618 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w618, state.scan);
+	state.scan += 1;
+	let w619 = value.containerdata;
+	if (w619 != null) {
+		if (typeof w619 != "object" || !w619) { throw new Error("object expected"); }
+		let hidden620 = {};
+		state.stack.push(w619);
+		state.hiddenstack.push(hidden620);
+		let w621 = w619.layerwidth;
+		if (typeof w621 != "number" || w621 > 65535 || w621 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w621, state.scan);
+		state.scan += 2;
+		let w622 = w619.layerheight;
+		if (typeof w622 != "number" || w622 > 65535 || w622 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w622, state.scan);
+		state.scan += 2;
+		let w623 = w619.layerheightextra;
+		if (w623 != null) {
+			if (typeof w623 != "number" || w623 > 4294967295 || w623 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w623, state.scan);
+			state.scan += 4;
+		}
+		let w624 = w619.disablehover;
+		if (w624 != null) {
+			if (typeof w624 != "boolean") { throw new Error("boolean expected"); }
+			state.buffer.writeUInt8(+w624, state.scan++);
+		}
+		let w625 = w619.v6unk1;
+		if (w625 != null) {
+			if (typeof w625 != "number" || w625 > 4294967295 || w625 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w625, state.scan);
+			state.scan += 4;
+		}
+		let w626 = w619.v6unk2;
+		if (w626 != null) {
+			if (typeof w626 != "number" || w626 > 4294967295 || w626 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w626, state.scan);
+			state.scan += 4;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w627 = value.figuredata;
+	if (w627 != null) {
+		if (typeof w627 != "object" || !w627) { throw new Error("object expected"); }
+		let hidden628 = {};
+		state.stack.push(w627);
+		state.hiddenstack.push(hidden628);
+		let w629 = w627.color;
+		if (typeof w629 != "number" || w629 > 4294967295 || w629 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w629, state.scan);
+		state.scan += 4;
+		let w630 = w627.filled;
+		if (typeof w630 != "number" || w630 > 255 || w630 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w630, state.scan);
+		state.scan += 1;
+		let w631 = w627.trans;
+		if (typeof w631 != "number" || w631 > 127 || w631 < -128) { throw new Error(); }
+		state.buffer.writeInt8(w631, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w632 = value.textdata;
+	if (w632 != null) {
+		if (typeof w632 != "object" || !w632) { throw new Error("object expected"); }
+		let hidden633 = {};
+		state.stack.push(w632);
+		state.hiddenstack.push(hidden633);
+		let w634 = w632.fontid;
+		ext[2].write(state, w634);
+		let w635 = w632.unk1;
+		let hidden636 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden636);
+		let ref637 = state.stack[state.stack.length - 3].version;
+		let match638 = -1;
+		if (ref637 >= 0) { match638 = 0; }
+		else if (true) { match638 = 1; }
+		if (match638 == -1) { throw new Error("no opcode matched"); }
+		if (match638 == 0) {
+			if (typeof w635 != "number" || w635 > 255 || w635 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w635, state.scan);
+			state.scan += 1;
+		}
+		else if (match638 == 1) {
+			if (w635 != false) { throw new Error("expected constant false was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w639 = w632.text;
+		ext[1].write(state, w639);
+		let w640 = w632.unk2;
+		if (typeof w640 != "number" || w640 > 255 || w640 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w640, state.scan);
+		state.scan += 1;
+		let w641 = w632.alignhor;
+		if (typeof w641 != "number" || w641 > 255 || w641 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w641, state.scan);
+		state.scan += 1;
+		let w642 = w632.alignver;
+		if (typeof w642 != "number" || w642 > 255 || w642 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w642, state.scan);
+		state.scan += 1;
+		let w643 = w632.shadow;
+		if (typeof w643 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w643, state.scan++);
+		let w644 = w632.color;
+		if (typeof w644 != "number" || w644 > 4294967295 || w644 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w644, state.scan);
+		state.scan += 4;
+		let w645 = w632.trans;
+		if (typeof w645 != "number" || w645 > 255 || w645 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w645, state.scan);
+		state.scan += 1;
+		let w646 = w632.multiline;
+		if (w646 != null) {
+			if (typeof w646 != "number" || w646 > 255 || w646 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w646, state.scan);
+			state.scan += 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w647 = value.spritedata;
+	if (w647 != null) {
+		if (typeof w647 != "object" || !w647) { throw new Error("object expected"); }
+		let hidden648 = {};
+		state.stack.push(w647);
+		state.hiddenstack.push(hidden648);
+		let w649 = w647.spriteid;
+		if (typeof w649 != "number" || w649 > 2147483647 || w649 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w649, state.scan);
+		state.scan += 4;
+		let w650 = w647.rotation;
+		if (typeof w650 != "number" || w650 > 65535 || w650 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w650, state.scan);
+		state.scan += 2;
+		let w651 = w647.tiling;
+		if (typeof w651 != "number" || w651 > 255 || w651 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w651, state.scan);
+		state.scan += 1;
+		let w652 = w647.aspectwidthdata;
+		let hidden653 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden653);
+		let ref654 = state.stack[state.stack.length - 3].aspectwidthtype;
+		let match655 = -1;
+		if (ref654 == 4) { match655 = 0; }
+		else if (true) { match655 = 1; }
+		if (match655 == -1) { throw new Error("no opcode matched"); }
+		if (match655 == 0) {
+			if (typeof w652 != "number" || w652 > 4294967295 || w652 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w652, state.scan);
+			state.scan += 4;
+		}
+		else if (match655 == 1) {
+			if (w652 != -1) { throw new Error("expected constant -1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w656 = w647.aspectheightdata;
+		let hidden657 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden657);
+		let ref658 = state.stack[state.stack.length - 3].aspectheighttype;
+		let match659 = -1;
+		if (ref658 == 4) { match659 = 0; }
+		else if (true) { match659 = 1; }
+		if (match659 == -1) { throw new Error("no opcode matched"); }
+		if (match659 == 0) {
+			if (typeof w656 != "number" || w656 > 4294967295 || w656 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w656, state.scan);
+			state.scan += 4;
+		}
+		else if (match659 == 1) {
+			if (w656 != -1) { throw new Error("expected constant -1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w660 = w647.transparency;
+		if (typeof w660 != "number" || w660 > 255 || w660 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w660, state.scan);
+		state.scan += 1;
+		let w661 = w647.borderthickness;
+		if (typeof w661 != "number" || w661 > 255 || w661 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w661, state.scan);
+		state.scan += 1;
+		let w662 = w647.unk2;
+		if (typeof w662 != "number" || w662 > 2147483647 || w662 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w662, state.scan);
+		state.scan += 4;
+		let w663 = w647.vflip;
+		if (typeof w663 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w663, state.scan++);
+		let w664 = w647.hflip;
+		if (typeof w664 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w664, state.scan++);
+		let w665 = w647.color;
+		if (typeof w665 != "number" || w665 > 4294967295 || w665 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w665, state.scan);
+		state.scan += 4;
+		let w666 = w647.clickmask;
+		if (w666 != null) {
+			if (typeof w666 != "number" || w666 > 255 || w666 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w666, state.scan);
+			state.scan += 1;
+		}
+		let w667 = w647.v6unk;
+		if (w667 != null) {
+			if (typeof w667 != "number" || w667 > 4294967295 || w667 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w667, state.scan);
+			state.scan += 4;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w668 = value.modeldata;
+	if (w668 != null) {
+		if (typeof w668 != "object" || !w668) { throw new Error("object expected"); }
+		let hidden669 = {};
+		state.stack.push(w668);
+		state.hiddenstack.push(hidden669);
+		let w670 = w668.modelid;
+		let hidden671 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden671);
+		hidden671.$opcode = ext[3].readConst(state);
+		let ref672 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match673 = -1;
+		if (ref672 > 616) { match673 = 0; }
+		else if (true) { match673 = 1; }
+		if (match673 == -1) { throw new Error("no opcode matched"); }
+		if (match673 == 0) {
+			ext[2].write(state, w670);
+		}
+		else if (match673 == 1) {
+			if (typeof w670 != "number" || w670 > 65535 || w670 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w670, state.scan);
+			state.scan += 2;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w674 = w668.mode;
+		let hidden675 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden675);
+		hidden675.$opcode = ext[4].readConst(state);
+		let ref676 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match677 = -1;
+		if (ref676 > 616) { match677 = 0; }
+		else if (true) { match677 = 1; }
+		if (match677 == -1) { throw new Error("no opcode matched"); }
+		if (match677 == 0) {
+			if (typeof w674 != "number" || w674 > 255 || w674 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w674, state.scan);
+			state.scan += 1;
+		}
+		else if (match677 == 1) {
+			if (w674 != 1) { throw new Error("expected constant 1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w678 = w668.positiondata;
+		if (w678 != null) {
+			if (typeof w678 != "object" || !w678) { throw new Error("object expected"); }
+			let hidden679 = {};
+			state.stack.push(w678);
+			state.hiddenstack.push(hidden679);
+			let w680 = w678.translate_x;
+			if (typeof w680 != "number" || w680 > 32767 || w680 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w680, state.scan);
+			state.scan += 2;
+			let w681 = w678.translate_y;
+			if (typeof w681 != "number" || w681 > 32767 || w681 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w681, state.scan);
+			state.scan += 2;
+			let w682 = w678.unkextra;
+			if (w682 != null) {
+				if (typeof w682 != "number" || w682 > 32767 || w682 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w682, state.scan);
+				state.scan += 2;
+			}
+			let w683 = w678.rotate_x;
+			if (typeof w683 != "number" || w683 > 65535 || w683 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w683, state.scan);
+			state.scan += 2;
+			let w684 = w678.rotate_y;
+			if (typeof w684 != "number" || w684 > 65535 || w684 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w684, state.scan);
+			state.scan += 2;
+			let w685 = w678.rotate_z;
+			if (typeof w685 != "number" || w685 > 65535 || w685 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w685, state.scan);
+			state.scan += 2;
+			let w686 = w678.zoom;
+			if (typeof w686 != "number" || w686 > 65535 || w686 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w686, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w687 = w668.animid;
+		let hidden688 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden688);
+		hidden688.$opcode = ext[5].readConst(state);
+		let ref689 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match690 = -1;
+		if (ref689 > 616) { match690 = 0; }
+		else if (true) { match690 = 1; }
+		if (match690 == -1) { throw new Error("no opcode matched"); }
+		if (match690 == 0) {
+			ext[2].write(state, w687);
+		}
+		else if (match690 == 1) {
+			if (typeof w687 != "number" || w687 > 65535 || w687 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w687, state.scan);
+			state.scan += 2;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w691 = w668.unkdata;
+		let hidden692 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden692);
+		hidden692.$opcode = ext[6].readConst(state);
+		let ref693 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match694 = -1;
+		if (ref693 > 616) { match694 = 0; }
+		else if (true) { match694 = 1; }
+		if (match694 == -1) { throw new Error("no opcode matched"); }
+		if (match694 == 0) {
+			if (w691 != null) { throw new Error("expected constant null was not present during write"); }
+		}
+		else if (match694 == 1) {
+			ext[7].write(state, w691);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w695 = w668.aspectwidthdata;
+		let hidden696 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden696);
+		let ref697 = state.stack[state.stack.length - 3].aspectwidthtype;
+		let match698 = -1;
+		if (ref697 != 0) { match698 = 0; }
+		else if (true) { match698 = 1; }
+		if (match698 == -1) { throw new Error("no opcode matched"); }
+		if (match698 == 0) {
+			if (typeof w695 != "number" || w695 > 65535 || w695 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w695, state.scan);
+			state.scan += 2;
+		}
+		else if (match698 == 1) {
+			if (w695 != -1) { throw new Error("expected constant -1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w699 = w668.aspectheightdata;
+		let hidden700 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden700);
+		let ref701 = state.stack[state.stack.length - 3].aspectheighttype;
+		let match702 = -1;
+		if (ref701 != 0) { match702 = 0; }
+		else if (true) { match702 = 1; }
+		if (match702 == -1) { throw new Error("no opcode matched"); }
+		if (match702 == 0) {
+			if (typeof w699 != "number" || w699 > 65535 || w699 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w699, state.scan);
+			state.scan += 2;
+		}
+		else if (match702 == 1) {
+			if (w699 != -1) { throw new Error("expected constant -1 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w703 = value.linedata;
+	if (w703 != null) {
+		if (typeof w703 != "object" || !w703) { throw new Error("object expected"); }
+		let hidden704 = {};
+		state.stack.push(w703);
+		state.hiddenstack.push(hidden704);
+		let w705 = w703.width;
+		if (typeof w705 != "number" || w705 > 255 || w705 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w705, state.scan);
+		state.scan += 1;
+		let w706 = w703.color;
+		if (typeof w706 != "number" || w706 > 4294967295 || w706 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w706, state.scan);
+		state.scan += 4;
+		let w707 = w703.dir;
+		if (typeof w707 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w707, state.scan++);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w708 = value.unk10data;
+	if (w708 != null) {
+		if (typeof w708 != "object" || !w708) { throw new Error("object expected"); }
+		let hidden709 = {};
+		state.stack.push(w708);
+		state.hiddenstack.push(hidden709);
+		let w710 = w708.data;
+		ext[8].write(state, w710);
+		let w711 = w708.str1;
+		ext[1].write(state, w711);
+		let w712 = w708.data2;
+		ext[9].write(state, w712);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w713 = value.unk11data;
+	if (w713 != null) {
+		if (typeof w713 != "object" || !w713) { throw new Error("object expected"); }
+		let hidden714 = {};
+		state.stack.push(w713);
+		state.hiddenstack.push(hidden714);
+		let w715 = w713.data;
+		ext[10].write(state, w715);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w716 = value.unk12data;
+	if (w716 != null) {
+		if (typeof w716 != "object" || !w716) { throw new Error("object expected"); }
+		let hidden717 = {};
+		state.stack.push(w716);
+		state.hiddenstack.push(hidden717);
+		let w718 = w716.data;
+		ext[11].write(state, w718);
+		let w719 = w716.str;
+		ext[1].write(state, w719);
+		let w720 = w716.data2;
+		ext[12].write(state, w720);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w721 = value.unk13data;
+	if (w721 != null) {
+		if (typeof w721 != "object" || !w721) { throw new Error("object expected"); }
+		let hidden722 = {};
+		state.stack.push(w721);
+		state.hiddenstack.push(hidden722);
+		let w723 = w721.data;
+		ext[13].write(state, w723);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w724 = value.unk15data;
+	if (w724 != null) {
+		if (typeof w724 != "object" || !w724) { throw new Error("object expected"); }
+		let hidden725 = {};
+		state.stack.push(w724);
+		state.hiddenstack.push(hidden725);
+		let w726 = w724.data;
+		ext[14].write(state, w726);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w727 = value.unk16data;
+	if (w727 != null) {
+		if (typeof w727 != "object" || !w727) { throw new Error("object expected"); }
+		let hidden728 = {};
+		state.stack.push(w727);
+		state.hiddenstack.push(hidden728);
+		let w729 = w727.data;
+		ext[15].write(state, w729);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w730 = value.unkffff;
+	if (w730 != null) {
+		if (typeof w730 != "number" || w730 > 4294967295 || w730 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w730, state.scan);
+		state.scan += 4;
+	}
+	let w731 = value.optmask;
+	if (typeof w731 != "number" || w731 > 65535 || w731 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w731, state.scan);
+	state.scan += 2;
+	let w732 = value.unk2;
+	if (typeof w732 != "number" || w732 > 255 || w732 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w732, state.scan);
+	state.scan += 1;
+	let w733 = value.unkprepre3;
+	if (w733 != null) {
+		if (typeof w733 != "number" || w733 > 255 || w733 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w733, state.scan);
+		state.scan += 1;
+	}
+	let w734 = value.unkpre3;
+	if (w734 != null) {
+		if (typeof w734 != "number" || w734 > 255 || w734 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w734, state.scan);
+		state.scan += 1;
+	}
+	let w735 = value.unk3;
+	let hidden736 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden736);
+	let ref737 = state.stack[state.stack.length - 2].version;
+	let match738 = -1;
+	if (ref737 == -1) { match738 = 0; }
+	else if (true) { match738 = 1; }
+	if (match738 == -1) { throw new Error("no opcode matched"); }
+	if (match738 == 0) {
+		ext[16].write(state, w735);
+	}
+	else if (match738 == 1) {
+		if (typeof w735 != "object" || !w735) { throw new Error("object expected"); }
+		let hidden739 = {};
+		state.stack.push(w735);
+		state.hiddenstack.push(hidden739);
+		let w740 = w735.op;
+		if (typeof w740 != "number" || w740 > 255 || w740 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w740, state.scan);
+		state.scan += 1;
+		let w741 = w735.data;
+		if (w741 != null) {
+			ext[17].write(state, w741);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w742 = value.name2;
+	ext[1].write(state, w742);
+	let w743 = value.menucounts;
+	if (typeof w743 != "number" || w743 > 255 || w743 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w743, state.scan);
+	state.scan += 1;
+	let w744 = value.rightclickopts;
+	if (!Array.isArray(w744)) { throw new Error("array expected"); }
+	let w745 = w744.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w744.length });
+	for (let i746 = 0; i746 < w744.length; i746++) {
+		let w747 = w744[i746];
+		ext[1].write(state, w747);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w748 = value.rightclickcursors;
+	if (!Array.isArray(w748)) { throw new Error("array expected"); }
+	let w749 = w748.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w748.length });
+	for (let i750 = 0; i750 < w748.length; i750++) {
+		let w751 = w748[i750];
+		if (typeof w751 != "object" || !w751) { throw new Error("object expected"); }
+		let hidden752 = {};
+		state.stack.push(w751);
+		state.hiddenstack.push(hidden752);
+		let w753 = w751.op;
+		if (typeof w753 != "number" || w753 > 255 || w753 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w753, state.scan);
+		state.scan += 1;
+		let w754 = w751.cursor;
+		if (typeof w754 != "number" || w754 > 65535 || w754 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w754, state.scan);
+		state.scan += 2;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w755 = value.unkstring1;
+	if (w755 != null) {
+		ext[1].write(state, w755);
+	}
+	let w756 = value.unk4;
+	if (typeof w756 != "number" || w756 > 255 || w756 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w756, state.scan);
+	state.scan += 1;
+	let w757 = value.bit4data;
+	if (w757 != null) {
+		if (typeof w757 != "number" || w757 > 255 || w757 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w757, state.scan);
+		state.scan += 1;
+	}
+	let w758 = value.unk5;
+	if (typeof w758 != "number" || w758 > 255 || w758 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w758, state.scan);
+	state.scan += 1;
+	let w759 = value.unk6;
+	if (typeof w759 != "number" || w759 > 255 || w759 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w759, state.scan);
+	state.scan += 1;
+	let w760 = value.unkstuff123;
+	ext[1].write(state, w760);
+	let w761 = value.optmask1data_bit40;
+	if (w761 != null) {
+		ext[18].write(state, w761);
+	}
+	let w762 = value.cursor;
+	let hidden763 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden763);
+	let ref764 = state.stack[state.stack.length - 2].version;
+	let match765 = -1;
+	if (ref764 >= 0) { match765 = 0; }
+	else if (true) { match765 = 1; }
+	if (match765 == -1) { throw new Error("no opcode matched"); }
+	if (match765 == 0) {
+		if (typeof w762 != "number" || w762 > 65535 || w762 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w762, state.scan);
+		state.scan += 2;
+	}
+	else if (match765 == 1) {
+		if (w762 != -1) { throw new Error("expected constant -1 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w766 = value.unkdata;
+	if (w766 != null) {
+		if (typeof w766 != "number" || w766 > 65535 || w766 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w766, state.scan);
+		state.scan += 2;
+	}
+	let w767 = value.unkdatadata;
+	if (w767 != null) {
+		ext[19].write(state, w767);
+	}
+	let w768 = value.scripts;
+	if (typeof w768 != "object" || !w768) { throw new Error("object expected"); }
+	let hidden769 = {};
+	state.stack.push(w768);
+	state.hiddenstack.push(hidden769);
+	let w770 = w768.load;
+	if (!Array.isArray(w770)) { throw new Error("array expected"); }
+	let w771 = w770.length;
+	if (typeof w771 != "number" || w771 > 255 || w771 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w771, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w770.length });
+	for (let i772 = 0; i772 < w770.length; i772++) {
+		let w773 = w770[i772];
+		let hidden774 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden774);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref775 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match776 = -1;
+		if (ref775 == 0) { match776 = 0; }
+		else if (ref775 == 1) { match776 = 1; }
+		if (match776 == -1) { throw new Error("no opcode matched"); }
+		if (match776 == 0) {
+			if (typeof w773 != "number" || w773 > 2147483647 || w773 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w773, state.scan);
+			state.scan += 4;
+		}
+		else if (match776 == 1) {
+			ext[1].write(state, w773);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w777 = w768.mousehover;
+	if (!Array.isArray(w777)) { throw new Error("array expected"); }
+	let w778 = w777.length;
+	if (typeof w778 != "number" || w778 > 255 || w778 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w778, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w777.length });
+	for (let i779 = 0; i779 < w777.length; i779++) {
+		let w780 = w777[i779];
+		let hidden781 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden781);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref782 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match783 = -1;
+		if (ref782 == 0) { match783 = 0; }
+		else if (ref782 == 1) { match783 = 1; }
+		if (match783 == -1) { throw new Error("no opcode matched"); }
+		if (match783 == 0) {
+			if (typeof w780 != "number" || w780 > 2147483647 || w780 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w780, state.scan);
+			state.scan += 4;
+		}
+		else if (match783 == 1) {
+			ext[1].write(state, w780);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w784 = w768.mouseleave;
+	if (!Array.isArray(w784)) { throw new Error("array expected"); }
+	let w785 = w784.length;
+	if (typeof w785 != "number" || w785 > 255 || w785 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w785, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w784.length });
+	for (let i786 = 0; i786 < w784.length; i786++) {
+		let w787 = w784[i786];
+		let hidden788 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden788);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref789 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match790 = -1;
+		if (ref789 == 0) { match790 = 0; }
+		else if (ref789 == 1) { match790 = 1; }
+		if (match790 == -1) { throw new Error("no opcode matched"); }
+		if (match790 == 0) {
+			if (typeof w787 != "number" || w787 > 2147483647 || w787 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w787, state.scan);
+			state.scan += 4;
+		}
+		else if (match790 == 1) {
+			ext[1].write(state, w787);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w791 = w768.unk0;
+	if (!Array.isArray(w791)) { throw new Error("array expected"); }
+	let w792 = w791.length;
+	if (typeof w792 != "number" || w792 > 255 || w792 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w792, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w791.length });
+	for (let i793 = 0; i793 < w791.length; i793++) {
+		let w794 = w791[i793];
+		let hidden795 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden795);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref796 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match797 = -1;
+		if (ref796 == 0) { match797 = 0; }
+		else if (ref796 == 1) { match797 = 1; }
+		if (match797 == -1) { throw new Error("no opcode matched"); }
+		if (match797 == 0) {
+			if (typeof w794 != "number" || w794 > 2147483647 || w794 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w794, state.scan);
+			state.scan += 4;
+		}
+		else if (match797 == 1) {
+			ext[1].write(state, w794);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w798 = w768.unk1;
+	if (!Array.isArray(w798)) { throw new Error("array expected"); }
+	let w799 = w798.length;
+	if (typeof w799 != "number" || w799 > 255 || w799 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w799, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w798.length });
+	for (let i800 = 0; i800 < w798.length; i800++) {
+		let w801 = w798[i800];
+		let hidden802 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden802);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref803 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match804 = -1;
+		if (ref803 == 0) { match804 = 0; }
+		else if (ref803 == 1) { match804 = 1; }
+		if (match804 == -1) { throw new Error("no opcode matched"); }
+		if (match804 == 0) {
+			if (typeof w801 != "number" || w801 > 2147483647 || w801 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w801, state.scan);
+			state.scan += 4;
+		}
+		else if (match804 == 1) {
+			ext[1].write(state, w801);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w805 = w768.unk2;
+	if (!Array.isArray(w805)) { throw new Error("array expected"); }
+	let w806 = w805.length;
+	if (typeof w806 != "number" || w806 > 255 || w806 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w806, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w805.length });
+	for (let i807 = 0; i807 < w805.length; i807++) {
+		let w808 = w805[i807];
+		let hidden809 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden809);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref810 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match811 = -1;
+		if (ref810 == 0) { match811 = 0; }
+		else if (ref810 == 1) { match811 = 1; }
+		if (match811 == -1) { throw new Error("no opcode matched"); }
+		if (match811 == 0) {
+			if (typeof w808 != "number" || w808 > 2147483647 || w808 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w808, state.scan);
+			state.scan += 4;
+		}
+		else if (match811 == 1) {
+			ext[1].write(state, w808);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w812 = w768.unk3;
+	if (!Array.isArray(w812)) { throw new Error("array expected"); }
+	let w813 = w812.length;
+	if (typeof w813 != "number" || w813 > 255 || w813 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w813, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w812.length });
+	for (let i814 = 0; i814 < w812.length; i814++) {
+		let w815 = w812[i814];
+		let hidden816 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden816);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref817 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match818 = -1;
+		if (ref817 == 0) { match818 = 0; }
+		else if (ref817 == 1) { match818 = 1; }
+		if (match818 == -1) { throw new Error("no opcode matched"); }
+		if (match818 == 0) {
+			if (typeof w815 != "number" || w815 > 2147483647 || w815 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w815, state.scan);
+			state.scan += 4;
+		}
+		else if (match818 == 1) {
+			ext[1].write(state, w815);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w819 = w768.unk4;
+	if (!Array.isArray(w819)) { throw new Error("array expected"); }
+	let w820 = w819.length;
+	if (typeof w820 != "number" || w820 > 255 || w820 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w820, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w819.length });
+	for (let i821 = 0; i821 < w819.length; i821++) {
+		let w822 = w819[i821];
+		let hidden823 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden823);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref824 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match825 = -1;
+		if (ref824 == 0) { match825 = 0; }
+		else if (ref824 == 1) { match825 = 1; }
+		if (match825 == -1) { throw new Error("no opcode matched"); }
+		if (match825 == 0) {
+			if (typeof w822 != "number" || w822 > 2147483647 || w822 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w822, state.scan);
+			state.scan += 4;
+		}
+		else if (match825 == 1) {
+			ext[1].write(state, w822);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w826 = w768.unk5;
+	if (!Array.isArray(w826)) { throw new Error("array expected"); }
+	let w827 = w826.length;
+	if (typeof w827 != "number" || w827 > 255 || w827 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w827, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w826.length });
+	for (let i828 = 0; i828 < w826.length; i828++) {
+		let w829 = w826[i828];
+		let hidden830 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden830);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref831 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match832 = -1;
+		if (ref831 == 0) { match832 = 0; }
+		else if (ref831 == 1) { match832 = 1; }
+		if (match832 == -1) { throw new Error("no opcode matched"); }
+		if (match832 == 0) {
+			if (typeof w829 != "number" || w829 > 2147483647 || w829 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w829, state.scan);
+			state.scan += 4;
+		}
+		else if (match832 == 1) {
+			ext[1].write(state, w829);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w833 = w768.unk6;
+	if (!Array.isArray(w833)) { throw new Error("array expected"); }
+	let w834 = w833.length;
+	if (typeof w834 != "number" || w834 > 255 || w834 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w834, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w833.length });
+	for (let i835 = 0; i835 < w833.length; i835++) {
+		let w836 = w833[i835];
+		let hidden837 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden837);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref838 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match839 = -1;
+		if (ref838 == 0) { match839 = 0; }
+		else if (ref838 == 1) { match839 = 1; }
+		if (match839 == -1) { throw new Error("no opcode matched"); }
+		if (match839 == 0) {
+			if (typeof w836 != "number" || w836 > 2147483647 || w836 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w836, state.scan);
+			state.scan += 4;
+		}
+		else if (match839 == 1) {
+			ext[1].write(state, w836);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w840 = w768.unk7;
+	if (w840 != null) {
+		if (!Array.isArray(w840)) { throw new Error("array expected"); }
+		let w841 = w840.length;
+		if (typeof w841 != "number" || w841 > 255 || w841 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w841, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w840.length });
+		for (let i842 = 0; i842 < w840.length; i842++) {
+			let w843 = w840[i842];
+			let hidden844 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden844);
+			throw new Error("non-const or non-reference match value not implemented in write mode");
+			let ref845 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match846 = -1;
+			if (ref845 == 0) { match846 = 0; }
+			else if (ref845 == 1) { match846 = 1; }
+			if (match846 == -1) { throw new Error("no opcode matched"); }
+			if (match846 == 0) {
+				if (typeof w843 != "number" || w843 > 2147483647 || w843 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w843, state.scan);
+				state.scan += 4;
+			}
+			else if (match846 == 1) {
+				ext[1].write(state, w843);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w847 = w768.hovertext;
+	if (!Array.isArray(w847)) { throw new Error("array expected"); }
+	let w848 = w847.length;
+	if (typeof w848 != "number" || w848 > 255 || w848 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w848, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w847.length });
+	for (let i849 = 0; i849 < w847.length; i849++) {
+		let w850 = w847[i849];
+		let hidden851 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden851);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref852 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match853 = -1;
+		if (ref852 == 0) { match853 = 0; }
+		else if (ref852 == 1) { match853 = 1; }
+		if (match853 == -1) { throw new Error("no opcode matched"); }
+		if (match853 == 0) {
+			if (typeof w850 != "number" || w850 > 2147483647 || w850 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w850, state.scan);
+			state.scan += 4;
+		}
+		else if (match853 == 1) {
+			ext[1].write(state, w850);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w854 = w768.unk8;
+	if (!Array.isArray(w854)) { throw new Error("array expected"); }
+	let w855 = w854.length;
+	if (typeof w855 != "number" || w855 > 255 || w855 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w855, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w854.length });
+	for (let i856 = 0; i856 < w854.length; i856++) {
+		let w857 = w854[i856];
+		let hidden858 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden858);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref859 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match860 = -1;
+		if (ref859 == 0) { match860 = 0; }
+		else if (ref859 == 1) { match860 = 1; }
+		if (match860 == -1) { throw new Error("no opcode matched"); }
+		if (match860 == 0) {
+			if (typeof w857 != "number" || w857 > 2147483647 || w857 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w857, state.scan);
+			state.scan += 4;
+		}
+		else if (match860 == 1) {
+			ext[1].write(state, w857);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w861 = w768.unk9;
+	if (!Array.isArray(w861)) { throw new Error("array expected"); }
+	let w862 = w861.length;
+	if (typeof w862 != "number" || w862 > 255 || w862 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w862, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w861.length });
+	for (let i863 = 0; i863 < w861.length; i863++) {
+		let w864 = w861[i863];
+		let hidden865 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden865);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref866 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match867 = -1;
+		if (ref866 == 0) { match867 = 0; }
+		else if (ref866 == 1) { match867 = 1; }
+		if (match867 == -1) { throw new Error("no opcode matched"); }
+		if (match867 == 0) {
+			if (typeof w864 != "number" || w864 > 2147483647 || w864 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w864, state.scan);
+			state.scan += 4;
+		}
+		else if (match867 == 1) {
+			ext[1].write(state, w864);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w868 = w768.unk10;
+	if (!Array.isArray(w868)) { throw new Error("array expected"); }
+	let w869 = w868.length;
+	if (typeof w869 != "number" || w869 > 255 || w869 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w869, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w868.length });
+	for (let i870 = 0; i870 < w868.length; i870++) {
+		let w871 = w868[i870];
+		let hidden872 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden872);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref873 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match874 = -1;
+		if (ref873 == 0) { match874 = 0; }
+		else if (ref873 == 1) { match874 = 1; }
+		if (match874 == -1) { throw new Error("no opcode matched"); }
+		if (match874 == 0) {
+			if (typeof w871 != "number" || w871 > 2147483647 || w871 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w871, state.scan);
+			state.scan += 4;
+		}
+		else if (match874 == 1) {
+			ext[1].write(state, w871);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w875 = w768.unk11;
+	if (!Array.isArray(w875)) { throw new Error("array expected"); }
+	let w876 = w875.length;
+	if (typeof w876 != "number" || w876 > 255 || w876 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w876, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w875.length });
+	for (let i877 = 0; i877 < w875.length; i877++) {
+		let w878 = w875[i877];
+		let hidden879 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden879);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref880 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match881 = -1;
+		if (ref880 == 0) { match881 = 0; }
+		else if (ref880 == 1) { match881 = 1; }
+		if (match881 == -1) { throw new Error("no opcode matched"); }
+		if (match881 == 0) {
+			if (typeof w878 != "number" || w878 > 2147483647 || w878 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w878, state.scan);
+			state.scan += 4;
+		}
+		else if (match881 == 1) {
+			ext[1].write(state, w878);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w882 = w768.unk12;
+	if (!Array.isArray(w882)) { throw new Error("array expected"); }
+	let w883 = w882.length;
+	if (typeof w883 != "number" || w883 > 255 || w883 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w883, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w882.length });
+	for (let i884 = 0; i884 < w882.length; i884++) {
+		let w885 = w882[i884];
+		let hidden886 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden886);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref887 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match888 = -1;
+		if (ref887 == 0) { match888 = 0; }
+		else if (ref887 == 1) { match888 = 1; }
+		if (match888 == -1) { throw new Error("no opcode matched"); }
+		if (match888 == 0) {
+			if (typeof w885 != "number" || w885 > 2147483647 || w885 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w885, state.scan);
+			state.scan += 4;
+		}
+		else if (match888 == 1) {
+			ext[1].write(state, w885);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w889 = w768.unk13;
+	if (!Array.isArray(w889)) { throw new Error("array expected"); }
+	let w890 = w889.length;
+	if (typeof w890 != "number" || w890 > 255 || w890 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w890, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w889.length });
+	for (let i891 = 0; i891 < w889.length; i891++) {
+		let w892 = w889[i891];
+		let hidden893 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden893);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref894 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match895 = -1;
+		if (ref894 == 0) { match895 = 0; }
+		else if (ref894 == 1) { match895 = 1; }
+		if (match895 == -1) { throw new Error("no opcode matched"); }
+		if (match895 == 0) {
+			if (typeof w892 != "number" || w892 > 2147483647 || w892 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w892, state.scan);
+			state.scan += 4;
+		}
+		else if (match895 == 1) {
+			ext[1].write(state, w892);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w896 = w768.unk14;
+	if (!Array.isArray(w896)) { throw new Error("array expected"); }
+	let w897 = w896.length;
+	if (typeof w897 != "number" || w897 > 255 || w897 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w897, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w896.length });
+	for (let i898 = 0; i898 < w896.length; i898++) {
+		let w899 = w896[i898];
+		let hidden900 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden900);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref901 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match902 = -1;
+		if (ref901 == 0) { match902 = 0; }
+		else if (ref901 == 1) { match902 = 1; }
+		if (match902 == -1) { throw new Error("no opcode matched"); }
+		if (match902 == 0) {
+			if (typeof w899 != "number" || w899 > 2147483647 || w899 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w899, state.scan);
+			state.scan += 4;
+		}
+		else if (match902 == 1) {
+			ext[1].write(state, w899);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w903 = w768.unk15;
+	if (!Array.isArray(w903)) { throw new Error("array expected"); }
+	let w904 = w903.length;
+	if (typeof w904 != "number" || w904 > 255 || w904 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w904, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w903.length });
+	for (let i905 = 0; i905 < w903.length; i905++) {
+		let w906 = w903[i905];
+		let hidden907 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden907);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref908 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match909 = -1;
+		if (ref908 == 0) { match909 = 0; }
+		else if (ref908 == 1) { match909 = 1; }
+		if (match909 == -1) { throw new Error("no opcode matched"); }
+		if (match909 == 0) {
+			if (typeof w906 != "number" || w906 > 2147483647 || w906 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w906, state.scan);
+			state.scan += 4;
+		}
+		else if (match909 == 1) {
+			ext[1].write(state, w906);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w910 = w768.unk16;
+	if (!Array.isArray(w910)) { throw new Error("array expected"); }
+	let w911 = w910.length;
+	if (typeof w911 != "number" || w911 > 255 || w911 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w911, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w910.length });
+	for (let i912 = 0; i912 < w910.length; i912++) {
+		let w913 = w910[i912];
+		let hidden914 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden914);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref915 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match916 = -1;
+		if (ref915 == 0) { match916 = 0; }
+		else if (ref915 == 1) { match916 = 1; }
+		if (match916 == -1) { throw new Error("no opcode matched"); }
+		if (match916 == 0) {
+			if (typeof w913 != "number" || w913 > 2147483647 || w913 < -2147483648) { throw new Error(); }
+			state.buffer.writeInt32BE(w913, state.scan);
+			state.scan += 4;
+		}
+		else if (match916 == 1) {
+			ext[1].write(state, w913);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w917 = w768.unk17;
+	if (w917 != null) {
+		if (!Array.isArray(w917)) { throw new Error("array expected"); }
+		let w918 = w917.length;
+		if (typeof w918 != "number" || w918 > 255 || w918 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w918, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w917.length });
+		for (let i919 = 0; i919 < w917.length; i919++) {
+			let w920 = w917[i919];
+			let hidden921 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden921);
+			throw new Error("non-const or non-reference match value not implemented in write mode");
+			let ref922 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match923 = -1;
+			if (ref922 == 0) { match923 = 0; }
+			else if (ref922 == 1) { match923 = 1; }
+			if (match923 == -1) { throw new Error("no opcode matched"); }
+			if (match923 == 0) {
+				if (typeof w920 != "number" || w920 > 2147483647 || w920 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w920, state.scan);
+				state.scan += 4;
+			}
+			else if (match923 == 1) {
+				ext[1].write(state, w920);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w924 = w768.unk18;
+	if (w924 != null) {
+		if (!Array.isArray(w924)) { throw new Error("array expected"); }
+		let w925 = w924.length;
+		if (typeof w925 != "number" || w925 > 255 || w925 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w925, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w924.length });
+		for (let i926 = 0; i926 < w924.length; i926++) {
+			let w927 = w924[i926];
+			let hidden928 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden928);
+			throw new Error("non-const or non-reference match value not implemented in write mode");
+			let ref929 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match930 = -1;
+			if (ref929 == 0) { match930 = 0; }
+			else if (ref929 == 1) { match930 = 1; }
+			if (match930 == -1) { throw new Error("no opcode matched"); }
+			if (match930 == 0) {
+				if (typeof w927 != "number" || w927 > 2147483647 || w927 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w927, state.scan);
+				state.scan += 4;
+			}
+			else if (match930 == 1) {
+				ext[1].write(state, w927);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w931 = w768.unk19;
+	if (w931 != null) {
+		if (!Array.isArray(w931)) { throw new Error("array expected"); }
+		let w932 = w931.length;
+		if (typeof w932 != "number" || w932 > 255 || w932 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w932, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w931.length });
+		for (let i933 = 0; i933 < w931.length; i933++) {
+			let w934 = w931[i933];
+			let hidden935 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden935);
+			throw new Error("non-const or non-reference match value not implemented in write mode");
+			let ref936 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match937 = -1;
+			if (ref936 == 0) { match937 = 0; }
+			else if (ref936 == 1) { match937 = 1; }
+			if (match937 == -1) { throw new Error("no opcode matched"); }
+			if (match937 == 0) {
+				if (typeof w934 != "number" || w934 > 2147483647 || w934 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w934, state.scan);
+				state.scan += 4;
+			}
+			else if (match937 == 1) {
+				ext[1].write(state, w934);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w938 = w768.unk20;
+	if (w938 != null) {
+		if (!Array.isArray(w938)) { throw new Error("array expected"); }
+		let w939 = w938.length;
+		if (typeof w939 != "number" || w939 > 255 || w939 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w939, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w938.length });
+		for (let i940 = 0; i940 < w938.length; i940++) {
+			let w941 = w938[i940];
+			let hidden942 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden942);
+			throw new Error("non-const or non-reference match value not implemented in write mode");
+			let ref943 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match944 = -1;
+			if (ref943 == 0) { match944 = 0; }
+			else if (ref943 == 1) { match944 = 1; }
+			if (match944 == -1) { throw new Error("no opcode matched"); }
+			if (match944 == 0) {
+				if (typeof w941 != "number" || w941 > 2147483647 || w941 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w941, state.scan);
+				state.scan += 4;
+			}
+			else if (match944 == 1) {
+				ext[1].write(state, w941);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w945 = w768.v2unk0;
+	if (!Array.isArray(w945)) { throw new Error("array expected"); }
+	let w946 = w945.length;
+	if (typeof w946 != "number" || w946 > 255 || w946 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w946, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w945.length });
+	for (let i947 = 0; i947 < w945.length; i947++) {
+		let w948 = w945[i947];
+		if (typeof w948 != "number" || w948 > 2147483647 || w948 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w948, state.scan);
+		state.scan += 4;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w949 = w768.v2unk1;
+	if (!Array.isArray(w949)) { throw new Error("array expected"); }
+	let w950 = w949.length;
+	if (typeof w950 != "number" || w950 > 255 || w950 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w950, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w949.length });
+	for (let i951 = 0; i951 < w949.length; i951++) {
+		let w952 = w949[i951];
+		if (typeof w952 != "number" || w952 > 2147483647 || w952 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w952, state.scan);
+		state.scan += 4;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w953 = w768.v2unk2;
+	if (!Array.isArray(w953)) { throw new Error("array expected"); }
+	let w954 = w953.length;
+	if (typeof w954 != "number" || w954 > 255 || w954 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w954, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w953.length });
+	for (let i955 = 0; i955 < w953.length; i955++) {
+		let w956 = w953[i955];
+		if (typeof w956 != "number" || w956 > 2147483647 || w956 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w956, state.scan);
+		state.scan += 4;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w957 = w768.v2unk3;
+	if (!Array.isArray(w957)) { throw new Error("array expected"); }
+	let w958 = w957.length;
+	if (typeof w958 != "number" || w958 > 255 || w958 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w958, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w957.length });
+	for (let i959 = 0; i959 < w957.length; i959++) {
+		let w960 = w957[i959];
+		if (typeof w960 != "number" || w960 > 2147483647 || w960 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w960, state.scan);
+		state.scan += 4;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w961 = w768.v2unk4;
+	if (!Array.isArray(w961)) { throw new Error("array expected"); }
+	let w962 = w961.length;
+	if (typeof w962 != "number" || w962 > 255 || w962 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w962, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w961.length });
+	for (let i963 = 0; i963 < w961.length; i963++) {
+		let w964 = w961[i963];
+		if (typeof w964 != "number" || w964 > 2147483647 || w964 < -2147483648) { throw new Error(); }
+		state.buffer.writeInt32BE(w964, state.scan);
+		state.scan += 4;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
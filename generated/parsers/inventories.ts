@@ -0,0 +1,120 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\inventories.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x782d03e9;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 2: {
+				let v3 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.size = v3;
+				break;
+			}
+			case 21: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden5 = { $index: 0, $length: v4 };
+				state.hiddenstack.push(hidden5);
+				state.stack.push({});
+				let arr6 = [];
+				for (let i7 = 0; i7 < v4; i7++) {
+					hidden5.$index = i7;
+					let obj8 = {};
+					let hidden9 = {};
+					state.stack.push(obj8);
+					state.hiddenstack.push(hidden9);
+					let v10 = ext[0].read(state);
+					if (v10 !== undefined) { obj8.item = v10; }
+					let v11 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v11 !== undefined) { obj8.stock = v11; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr6.push(obj8);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.shopdata = arr6;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key12 in value) {
+		if (key12.startsWith("$")) { continue; }
+		switch (key12) {
+			case "size": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w13 = value[key12];
+				if (typeof w13 != "number" || w13 > 65535 || w13 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w13, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "shopdata": {
+				if (typeof 21 != "number" || 21 > 255 || 21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(21, state.scan);
+				state.scan += 1;
+				let w14 = value[key12];
+				if (!Array.isArray(w14)) { throw new Error("array expected"); }
+				let w15 = w14.length;
+				if (typeof w15 != "number" || w15 > 255 || w15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w15, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w14.length });
+				for (let i16 = 0; i16 < w14.length; i16++) {
+					let w17 = w14[i16];
+					if (typeof w17 != "object" || !w17) { throw new Error("object expected"); }
+					let hidden18 = {};
+					state.stack.push(w17);
+					state.hiddenstack.push(hidden18);
+					let w19 = w17.item;
+					ext[0].write(state, w19);
+					let w20 = w17.stock;
+					if (typeof w20 != "number" || w20 > 65535 || w20 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w20, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key12);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
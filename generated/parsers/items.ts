@@ -0,0 +1,3095 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\items.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x6455a13f;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		switch (v2) {
+			case 0: {
+				obj0.nullopt = true;
+				break;
+			}
+			case 1: {
+				let hidden3 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden3);
+				let v4 = ext[0].read(state);
+				hidden3.$opcode = v4;
+				let ref5 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match6 = -1;
+				if (ref5 >= 670) { match6 = 0; }
+				else if (ref5 >= 0) { match6 = 1; }
+				if (match6 == -1) { throw new Error("no opcode matched"); }
+				let v7;
+				if (match6 == 0) {
+					let v8 = ext[1].read(state);
+					v7 = v8;
+				}
+				else if (match6 == 1) {
+					let v9 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v7 = v9;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.baseModel = v7;
+				break;
+			}
+			case 2: {
+				let v10 = ext[2].read(state);
+				obj0.name = v10;
+				break;
+			}
+			case 3: {
+				let v11 = ext[2].read(state);
+				obj0.buff_effect = v11;
+				break;
+			}
+			case 4: {
+				let v12 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.model_zoom = v12;
+				break;
+			}
+			case 5: {
+				let v13 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.rotation_0 = v13;
+				break;
+			}
+			case 6: {
+				let v14 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.rotation_1 = v14;
+				break;
+			}
+			case 7: {
+				let v15 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.modelTranslate_0 = v15;
+				break;
+			}
+			case 8: {
+				let v16 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.modelTranslate_1 = v16;
+				break;
+			}
+			case 9: {
+				let v17 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden18 = { $index: 0, $length: v17 };
+				state.hiddenstack.push(hidden18);
+				state.stack.push({});
+				let arr19 = [];
+				for (let i20 = 0; i20 < v17; i20++) {
+					hidden18.$index = i20;
+					let hidden21 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden21);
+					let v22 = ext[3].read(state);
+					hidden21.$opcode = v22;
+					let ref23 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match24 = -1;
+					if (ref23 >= 670) { match24 = 0; }
+					else if (ref23 >= 0) { match24 = 1; }
+					if (match24 == -1) { throw new Error("no opcode matched"); }
+					let v25;
+					if (match24 == 0) {
+						let v26 = ext[1].read(state);
+						v25 = v26;
+					}
+					else if (match24 == 1) {
+						let v27 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v25 = v27;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr19.push(v25);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.baseModelList = arr19;
+				break;
+			}
+			case 10: {
+				let v28 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_0A = v28;
+				break;
+			}
+			case 11: {
+				obj0.stackable_1 = true;
+				break;
+			}
+			case 12: {
+				let v29 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.value = v29;
+				break;
+			}
+			case 13: {
+				let v30 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.equipSlotId = v30;
+				break;
+			}
+			case 14: {
+				let v31 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.equipId = v31;
+				break;
+			}
+			case 15: {
+				obj0.unknown_0F = true;
+				break;
+			}
+			case 16: {
+				obj0.members = true;
+				break;
+			}
+			case 18: {
+				let v32 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.multiStackSize = v32;
+				break;
+			}
+			case 23: {
+				let obj33 = {};
+				let hidden34 = {};
+				state.stack.push(obj33);
+				state.hiddenstack.push(hidden34);
+				let hidden35 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden35);
+				let v36 = ext[4].read(state);
+				hidden35.$opcode = v36;
+				let ref37 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match38 = -1;
+				if (ref37 >= 670) { match38 = 0; }
+				else if (ref37 >= 0) { match38 = 1; }
+				if (match38 == -1) { throw new Error("no opcode matched"); }
+				let v39;
+				if (match38 == 0) {
+					let v40 = ext[1].read(state);
+					v39 = v40;
+				}
+				else if (match38 == 1) {
+					let v41 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v39 = v41;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v39 !== undefined) { obj33.id = v39; }
+				let hidden42 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden42);
+				let v43 = ext[5].read(state);
+				hidden42.$opcode = v43;
+				let ref44 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match45 = -1;
+				if (ref44 >= 502) { match45 = 0; }
+				else if (true) { match45 = 1; }
+				if (match45 == -1) { throw new Error("no opcode matched"); }
+				let v46;
+				if (match45 == 0) {
+					v46 = 0;
+				}
+				else if (match45 == 1) {
+					let v47 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v46 = v47;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v46 !== undefined) { obj33.type = v46; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.maleModels_0 = obj33;
+				break;
+			}
+			case 24: {
+				let hidden48 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden48);
+				let v49 = ext[6].read(state);
+				hidden48.$opcode = v49;
+				let ref50 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match51 = -1;
+				if (ref50 >= 670) { match51 = 0; }
+				else if (ref50 >= 0) { match51 = 1; }
+				if (match51 == -1) { throw new Error("no opcode matched"); }
+				let v52;
+				if (match51 == 0) {
+					let v53 = ext[1].read(state);
+					v52 = v53;
+				}
+				else if (match51 == 1) {
+					let v54 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v52 = v54;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.maleModels_1 = v52;
+				break;
+			}
+			case 25: {
+				let obj55 = {};
+				let hidden56 = {};
+				state.stack.push(obj55);
+				state.hiddenstack.push(hidden56);
+				let hidden57 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden57);
+				let v58 = ext[7].read(state);
+				hidden57.$opcode = v58;
+				let ref59 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match60 = -1;
+				if (ref59 >= 670) { match60 = 0; }
+				else if (ref59 >= 0) { match60 = 1; }
+				if (match60 == -1) { throw new Error("no opcode matched"); }
+				let v61;
+				if (match60 == 0) {
+					let v62 = ext[1].read(state);
+					v61 = v62;
+				}
+				else if (match60 == 1) {
+					let v63 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v61 = v63;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v61 !== undefined) { obj55.id = v61; }
+				let hidden64 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden64);
+				let v65 = ext[8].read(state);
+				hidden64.$opcode = v65;
+				let ref66 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match67 = -1;
+				if (ref66 >= 502) { match67 = 0; }
+				else if (true) { match67 = 1; }
+				if (match67 == -1) { throw new Error("no opcode matched"); }
+				let v68;
+				if (match67 == 0) {
+					v68 = 0;
+				}
+				else if (match67 == 1) {
+					let v69 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v68 = v69;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v68 !== undefined) { obj55.type = v68; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.femaleModels_0 = obj55;
+				break;
+			}
+			case 26: {
+				let hidden70 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden70);
+				let v71 = ext[9].read(state);
+				hidden70.$opcode = v71;
+				let ref72 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match73 = -1;
+				if (ref72 >= 670) { match73 = 0; }
+				else if (ref72 >= 0) { match73 = 1; }
+				if (match73 == -1) { throw new Error("no opcode matched"); }
+				let v74;
+				if (match73 == 0) {
+					let v75 = ext[1].read(state);
+					v74 = v75;
+				}
+				else if (match73 == 1) {
+					let v76 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v74 = v76;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.femaleModels_1 = v74;
+				break;
+			}
+			case 27: {
+				let v77 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_1B = v77;
+				break;
+			}
+			case 30: {
+				let v78 = ext[2].read(state);
+				obj0.ground_actions_0 = v78;
+				break;
+			}
+			case 31: {
+				let v79 = ext[2].read(state);
+				obj0.ground_actions_1 = v79;
+				break;
+			}
+			case 32: {
+				let v80 = ext[2].read(state);
+				obj0.ground_actions_2 = v80;
+				break;
+			}
+			case 33: {
+				let v81 = ext[2].read(state);
+				obj0.ground_actions_3 = v81;
+				break;
+			}
+			case 34: {
+				let v82 = ext[2].read(state);
+				obj0.ground_actions_4 = v82;
+				break;
+			}
+			case 35: {
+				let v83 = ext[2].read(state);
+				obj0.widget_actions_0 = v83;
+				break;
+			}
+			case 36: {
+				let v84 = ext[2].read(state);
+				obj0.widget_actions_1 = v84;
+				break;
+			}
+			case 37: {
+				let v85 = ext[2].read(state);
+				obj0.widget_actions_2 = v85;
+				break;
+			}
+			case 38: {
+				let v86 = ext[2].read(state);
+				obj0.widget_actions_3 = v86;
+				break;
+			}
+			case 39: {
+				let v87 = ext[2].read(state);
+				obj0.widget_actions_4 = v87;
+				break;
+			}
+			case 40: {
+				let v88 = ext[10].read(state);
+				let hidden89 = { $index: 0, $length: v88 };
+				state.hiddenstack.push(hidden89);
+				state.stack.push({});
+				let arr90 = [];
+				for (let i91 = 0; i91 < v88; i91++) {
+					hidden89.$index = i91;
+					let v92 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v93 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr94 = [v92, v93];
+					arr90.push(arr94);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.color_replacements = arr90;
+				break;
+			}
+			case 41: {
+				let v95 = ext[10].read(state);
+				let hidden96 = { $index: 0, $length: v95 };
+				state.hiddenstack.push(hidden96);
+				state.stack.push({});
+				let arr97 = [];
+				for (let i98 = 0; i98 < v95; i98++) {
+					hidden96.$index = i98;
+					let v99 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v100 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr101 = [v99, v100];
+					arr97.push(arr101);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.material_replacements = arr97;
+				break;
+			}
+			case 42: {
+				let v102 = ext[10].read(state);
+				let hidden103 = { $index: 0, $length: v102 };
+				state.hiddenstack.push(hidden103);
+				state.stack.push({});
+				let arr104 = [];
+				for (let i105 = 0; i105 < v102; i105++) {
+					hidden103.$index = i105;
+					let v106 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let v107 = state.view.getInt8(state.scan);
+					state.scan += 1;
+					let arr108 = [v106, v107];
+					arr104.push(arr108);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.recolourPalette = arr104;
+				break;
+			}
+			case 43: {
+				let v109 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.nameColor = v109;
+				break;
+			}
+			case 44: {
+				let v110 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.recolorDstIndices = v110;
+				break;
+			}
+			case 45: {
+				let v111 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.retextureDstIndices = v111;
+				break;
+			}
+			case 65: {
+				obj0.tradeable = true;
+				break;
+			}
+			case 69: {
+				let v112 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.buy_limit = v112;
+				break;
+			}
+			case 78: {
+				let hidden113 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden113);
+				let v114 = ext[11].read(state);
+				hidden113.$opcode = v114;
+				let ref115 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match116 = -1;
+				if (ref115 >= 670) { match116 = 0; }
+				else if (ref115 >= 0) { match116 = 1; }
+				if (match116 == -1) { throw new Error("no opcode matched"); }
+				let v117;
+				if (match116 == 0) {
+					let v118 = ext[1].read(state);
+					v117 = v118;
+				}
+				else if (match116 == 1) {
+					let v119 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v117 = v119;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.maleModels_2 = v117;
+				break;
+			}
+			case 79: {
+				let hidden120 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden120);
+				let v121 = ext[12].read(state);
+				hidden120.$opcode = v121;
+				let ref122 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match123 = -1;
+				if (ref122 >= 670) { match123 = 0; }
+				else if (ref122 >= 0) { match123 = 1; }
+				if (match123 == -1) { throw new Error("no opcode matched"); }
+				let v124;
+				if (match123 == 0) {
+					let v125 = ext[1].read(state);
+					v124 = v125;
+				}
+				else if (match123 == 1) {
+					let v126 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v124 = v126;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.femaleModels_2 = v124;
+				break;
+			}
+			case 90: {
+				let hidden127 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden127);
+				let v128 = ext[13].read(state);
+				hidden127.$opcode = v128;
+				let ref129 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match130 = -1;
+				if (ref129 >= 670) { match130 = 0; }
+				else if (ref129 >= 0) { match130 = 1; }
+				if (match130 == -1) { throw new Error("no opcode matched"); }
+				let v131;
+				if (match130 == 0) {
+					let v132 = ext[1].read(state);
+					v131 = v132;
+				}
+				else if (match130 == 1) {
+					let v133 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v131 = v133;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.maleHeads_0 = v131;
+				break;
+			}
+			case 91: {
+				let hidden134 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden134);
+				let v135 = ext[14].read(state);
+				hidden134.$opcode = v135;
+				let ref136 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match137 = -1;
+				if (ref136 >= 670) { match137 = 0; }
+				else if (ref136 >= 0) { match137 = 1; }
+				if (match137 == -1) { throw new Error("no opcode matched"); }
+				let v138;
+				if (match137 == 0) {
+					let v139 = ext[1].read(state);
+					v138 = v139;
+				}
+				else if (match137 == 1) {
+					let v140 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v138 = v140;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.femaleHeads_0 = v138;
+				break;
+			}
+			case 92: {
+				let hidden141 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden141);
+				let v142 = ext[15].read(state);
+				hidden141.$opcode = v142;
+				let ref143 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match144 = -1;
+				if (ref143 >= 670) { match144 = 0; }
+				else if (ref143 >= 0) { match144 = 1; }
+				if (match144 == -1) { throw new Error("no opcode matched"); }
+				let v145;
+				if (match144 == 0) {
+					let v146 = ext[1].read(state);
+					v145 = v146;
+				}
+				else if (match144 == 1) {
+					let v147 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v145 = v147;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.maleHeads_1 = v145;
+				break;
+			}
+			case 93: {
+				let hidden148 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden148);
+				let v149 = ext[16].read(state);
+				hidden148.$opcode = v149;
+				let ref150 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match151 = -1;
+				if (ref150 >= 670) { match151 = 0; }
+				else if (ref150 >= 0) { match151 = 1; }
+				if (match151 == -1) { throw new Error("no opcode matched"); }
+				let v152;
+				if (match151 == 0) {
+					let v153 = ext[1].read(state);
+					v152 = v153;
+				}
+				else if (match151 == 1) {
+					let v154 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v152 = v154;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.femaleHeads_1 = v152;
+				break;
+			}
+			case 94: {
+				let v155 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.category = v155;
+				break;
+			}
+			case 95: {
+				let v156 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.rotation_2 = v156;
+				break;
+			}
+			case 96: {
+				let v157 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.dummyItem = v157;
+				break;
+			}
+			case 97: {
+				let v158 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.noteData_old = v158;
+				break;
+			}
+			case 98: {
+				let v159 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.noteTemplate_old = v159;
+				break;
+			}
+			case 100: {
+				let obj160 = {};
+				let hidden161 = {};
+				state.stack.push(obj160);
+				state.hiddenstack.push(hidden161);
+				let v162 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v162 !== undefined) { obj160.icon = v162; }
+				let v163 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v163 !== undefined) { obj160.count = v163; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_0 = obj160;
+				break;
+			}
+			case 101: {
+				let obj164 = {};
+				let hidden165 = {};
+				state.stack.push(obj164);
+				state.hiddenstack.push(hidden165);
+				let v166 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v166 !== undefined) { obj164.icon = v166; }
+				let v167 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v167 !== undefined) { obj164.count = v167; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_1 = obj164;
+				break;
+			}
+			case 102: {
+				let obj168 = {};
+				let hidden169 = {};
+				state.stack.push(obj168);
+				state.hiddenstack.push(hidden169);
+				let v170 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v170 !== undefined) { obj168.icon = v170; }
+				let v171 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v171 !== undefined) { obj168.count = v171; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_2 = obj168;
+				break;
+			}
+			case 103: {
+				let obj172 = {};
+				let hidden173 = {};
+				state.stack.push(obj172);
+				state.hiddenstack.push(hidden173);
+				let v174 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v174 !== undefined) { obj172.icon = v174; }
+				let v175 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v175 !== undefined) { obj172.count = v175; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_3 = obj172;
+				break;
+			}
+			case 104: {
+				let obj176 = {};
+				let hidden177 = {};
+				state.stack.push(obj176);
+				state.hiddenstack.push(hidden177);
+				let v178 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v178 !== undefined) { obj176.icon = v178; }
+				let v179 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v179 !== undefined) { obj176.count = v179; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_4 = obj176;
+				break;
+			}
+			case 105: {
+				let obj180 = {};
+				let hidden181 = {};
+				state.stack.push(obj180);
+				state.hiddenstack.push(hidden181);
+				let v182 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v182 !== undefined) { obj180.icon = v182; }
+				let v183 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v183 !== undefined) { obj180.count = v183; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_5 = obj180;
+				break;
+			}
+			case 106: {
+				let obj184 = {};
+				let hidden185 = {};
+				state.stack.push(obj184);
+				state.hiddenstack.push(hidden185);
+				let v186 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v186 !== undefined) { obj184.icon = v186; }
+				let v187 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v187 !== undefined) { obj184.count = v187; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_6 = obj184;
+				break;
+			}
+			case 107: {
+				let obj188 = {};
+				let hidden189 = {};
+				state.stack.push(obj188);
+				state.hiddenstack.push(hidden189);
+				let v190 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v190 !== undefined) { obj188.icon = v190; }
+				let v191 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v191 !== undefined) { obj188.count = v191; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_7 = obj188;
+				break;
+			}
+			case 108: {
+				let obj192 = {};
+				let hidden193 = {};
+				state.stack.push(obj192);
+				state.hiddenstack.push(hidden193);
+				let v194 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v194 !== undefined) { obj192.icon = v194; }
+				let v195 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v195 !== undefined) { obj192.count = v195; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_8 = obj192;
+				break;
+			}
+			case 109: {
+				let obj196 = {};
+				let hidden197 = {};
+				state.stack.push(obj196);
+				state.hiddenstack.push(hidden197);
+				let v198 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v198 !== undefined) { obj196.icon = v198; }
+				let v199 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v199 !== undefined) { obj196.count = v199; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_old_9 = obj196;
+				break;
+			}
+			case 110: {
+				let v200 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scale_0 = v200;
+				break;
+			}
+			case 111: {
+				let v201 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scale_1 = v201;
+				break;
+			}
+			case 112: {
+				let v202 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scale_2 = v202;
+				break;
+			}
+			case 113: {
+				let v203 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.ambiance = v203;
+				break;
+			}
+			case 114: {
+				let v204 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.contrast = v204;
+				break;
+			}
+			case 115: {
+				let v205 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.team = v205;
+				break;
+			}
+			case 121: {
+				let v206 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.loanId_old = v206;
+				break;
+			}
+			case 122: {
+				let v207 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.loanTemplate_old = v207;
+				break;
+			}
+			case 125: {
+				let v208 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v209 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v210 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr211 = [v208, v209, v210];
+				obj0.male_translate = arr211;
+				break;
+			}
+			case 126: {
+				let v212 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v213 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v214 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr215 = [v212, v213, v214];
+				obj0.female_translate = arr215;
+				break;
+			}
+			case 127: {
+				let v216 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v217 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr218 = [v216, v217];
+				obj0.unknown_7F = arr218;
+				break;
+			}
+			case 128: {
+				let v219 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v220 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr221 = [v219, v220];
+				obj0.unknown_80 = arr221;
+				break;
+			}
+			case 129: {
+				let v222 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v223 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr224 = [v222, v223];
+				obj0.unknown_81 = arr224;
+				break;
+			}
+			case 130: {
+				let v225 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v226 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr227 = [v225, v226];
+				obj0.unknown_82 = arr227;
+				break;
+			}
+			case 132: {
+				let v228 = ext[10].read(state);
+				let hidden229 = { $index: 0, $length: v228 };
+				state.hiddenstack.push(hidden229);
+				state.stack.push({});
+				let arr230 = [];
+				for (let i231 = 0; i231 < v228; i231++) {
+					hidden229.$index = i231;
+					let v232 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let v233 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr234 = [v232, v233];
+					arr230.push(arr234);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.quests = arr230;
+				break;
+			}
+			case 134: {
+				let v235 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.pickSizeShift = v235;
+				break;
+			}
+			case 139: {
+				let v236 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.bindLink_old = v236;
+				break;
+			}
+			case 140: {
+				let v237 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.bindTemplate_old = v237;
+				break;
+			}
+			case 142: {
+				let v238 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.ground_actions_cursor_0 = v238;
+				break;
+			}
+			case 143: {
+				let v239 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.ground_actions_cursor_1 = v239;
+				break;
+			}
+			case 144: {
+				let v240 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.ground_actions_cursor_2 = v240;
+				break;
+			}
+			case 145: {
+				let v241 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.ground_actions_cursor_3 = v241;
+				break;
+			}
+			case 146: {
+				let v242 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.ground_actions_cursor_4 = v242;
+				break;
+			}
+			case 150: {
+				let v243 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.widget_actions_cursor_0 = v243;
+				break;
+			}
+			case 151: {
+				let v244 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.widget_actions_cursor_1 = v244;
+				break;
+			}
+			case 152: {
+				let v245 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.widget_actions_cursor_2 = v245;
+				break;
+			}
+			case 153: {
+				let v246 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.widget_actions_cursor_3 = v246;
+				break;
+			}
+			case 154: {
+				let v247 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.widget_actions_cursor_4 = v247;
+				break;
+			}
+			case 156: {
+				obj0.dummy = true;
+				break;
+			}
+			case 157: {
+				obj0.randomizeGroundPos = true;
+				break;
+			}
+			case 161: {
+				let v248 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.combine_info_old = v248;
+				break;
+			}
+			case 162: {
+				let v249 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.combine_template_old = v249;
+				break;
+			}
+			case 163: {
+				let v250 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.combine_num_required = v250;
+				break;
+			}
+			case 164: {
+				let v251 = ext[2].read(state);
+				obj0.combine_shard_name = v251;
+				break;
+			}
+			case 165: {
+				obj0.neverStackable = true;
+				break;
+			}
+			case 167: {
+				obj0.unknown_A7 = true;
+				break;
+			}
+			case 168: {
+				obj0.unknown_A8 = true;
+				break;
+			}
+			case 178: {
+				obj0.unknown_B2 = true;
+				break;
+			}
+			case 181: {
+				let v252 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				let v253 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				let arr254 = [v252, v253];
+				obj0.big_value = arr254;
+				break;
+			}
+			case 182: {
+				let v255 = ext[17].read(state);
+				obj0.noteDataIcon = v255;
+				break;
+			}
+			case 190: {
+				let obj256 = {};
+				let hidden257 = {};
+				state.stack.push(obj256);
+				state.hiddenstack.push(hidden257);
+				let v258 = ext[17].read(state);
+				if (v258 !== undefined) { obj256.icon = v258; }
+				let v259 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v259 !== undefined) { obj256.count = v259; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_0 = obj256;
+				break;
+			}
+			case 191: {
+				let obj260 = {};
+				let hidden261 = {};
+				state.stack.push(obj260);
+				state.hiddenstack.push(hidden261);
+				let v262 = ext[17].read(state);
+				if (v262 !== undefined) { obj260.icon = v262; }
+				let v263 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v263 !== undefined) { obj260.count = v263; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_1 = obj260;
+				break;
+			}
+			case 192: {
+				let obj264 = {};
+				let hidden265 = {};
+				state.stack.push(obj264);
+				state.hiddenstack.push(hidden265);
+				let v266 = ext[17].read(state);
+				if (v266 !== undefined) { obj264.icon = v266; }
+				let v267 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v267 !== undefined) { obj264.count = v267; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_2 = obj264;
+				break;
+			}
+			case 193: {
+				let obj268 = {};
+				let hidden269 = {};
+				state.stack.push(obj268);
+				state.hiddenstack.push(hidden269);
+				let v270 = ext[17].read(state);
+				if (v270 !== undefined) { obj268.icon = v270; }
+				let v271 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v271 !== undefined) { obj268.count = v271; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_3 = obj268;
+				break;
+			}
+			case 194: {
+				let obj272 = {};
+				let hidden273 = {};
+				state.stack.push(obj272);
+				state.hiddenstack.push(hidden273);
+				let v274 = ext[17].read(state);
+				if (v274 !== undefined) { obj272.icon = v274; }
+				let v275 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v275 !== undefined) { obj272.count = v275; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_4 = obj272;
+				break;
+			}
+			case 195: {
+				let obj276 = {};
+				let hidden277 = {};
+				state.stack.push(obj276);
+				state.hiddenstack.push(hidden277);
+				let v278 = ext[17].read(state);
+				if (v278 !== undefined) { obj276.icon = v278; }
+				let v279 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v279 !== undefined) { obj276.count = v279; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_5 = obj276;
+				break;
+			}
+			case 196: {
+				let obj280 = {};
+				let hidden281 = {};
+				state.stack.push(obj280);
+				state.hiddenstack.push(hidden281);
+				let v282 = ext[17].read(state);
+				if (v282 !== undefined) { obj280.icon = v282; }
+				let v283 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v283 !== undefined) { obj280.count = v283; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_6 = obj280;
+				break;
+			}
+			case 197: {
+				let obj284 = {};
+				let hidden285 = {};
+				state.stack.push(obj284);
+				state.hiddenstack.push(hidden285);
+				let v286 = ext[17].read(state);
+				if (v286 !== undefined) { obj284.icon = v286; }
+				let v287 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v287 !== undefined) { obj284.count = v287; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_7 = obj284;
+				break;
+			}
+			case 198: {
+				let obj288 = {};
+				let hidden289 = {};
+				state.stack.push(obj288);
+				state.hiddenstack.push(hidden289);
+				let v290 = ext[17].read(state);
+				if (v290 !== undefined) { obj288.icon = v290; }
+				let v291 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v291 !== undefined) { obj288.count = v291; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_8 = obj288;
+				break;
+			}
+			case 199: {
+				let obj292 = {};
+				let hidden293 = {};
+				state.stack.push(obj292);
+				state.hiddenstack.push(hidden293);
+				let v294 = ext[17].read(state);
+				if (v294 !== undefined) { obj292.icon = v294; }
+				let v295 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v295 !== undefined) { obj292.count = v295; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.stack_info_9 = obj292;
+				break;
+			}
+			case 201: {
+				let v296 = ext[17].read(state);
+				obj0.noteData = v296;
+				break;
+			}
+			case 202: {
+				let v297 = ext[17].read(state);
+				obj0.noteTemplate = v297;
+				break;
+			}
+			case 203: {
+				let v298 = ext[17].read(state);
+				obj0.loanId = v298;
+				break;
+			}
+			case 204: {
+				let v299 = ext[17].read(state);
+				obj0.loanTemplate = v299;
+				break;
+			}
+			case 205: {
+				let v300 = ext[17].read(state);
+				obj0.bindLink = v300;
+				break;
+			}
+			case 206: {
+				let v301 = ext[17].read(state);
+				obj0.bindTemplate = v301;
+				break;
+			}
+			case 207: {
+				let v302 = ext[17].read(state);
+				obj0.combine_info = v302;
+				break;
+			}
+			case 208: {
+				let v303 = ext[17].read(state);
+				obj0.combine_template = v303;
+				break;
+			}
+			case 249: {
+				let v304 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden305 = { $index: 0, $length: v304 };
+				state.hiddenstack.push(hidden305);
+				state.stack.push({});
+				let arr306 = [];
+				for (let i307 = 0; i307 < v304; i307++) {
+					hidden305.$index = i307;
+					let obj308 = {};
+					let hidden309 = {};
+					state.stack.push(obj308);
+					state.hiddenstack.push(hidden309);
+					let v310 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v310 !== undefined) { hidden309.$type = v310; }
+					let v311 = ext[17].read(state);
+					if (v311 !== undefined) { obj308.prop = v311; }
+					let ref312 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match313 = -1;
+					if (ref312 == 0) { match313 = 0; }
+					let v314 = null;
+					if (match313 != -1) {
+						let v315 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v314 = v315;
+					}
+					if (v314 !== undefined) { obj308.intvalue = v314; }
+					let ref316 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match317 = -1;
+					if (ref316 == 1) { match317 = 0; }
+					let v318 = null;
+					if (match317 != -1) {
+						let v319 = ext[2].read(state);
+						v318 = v319;
+					}
+					if (v318 !== undefined) { obj308.stringvalue = v318; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr306.push(obj308);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr306;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key320 in value) {
+		if (key320.startsWith("$")) { continue; }
+		switch (key320) {
+			case "nullopt": {
+				if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(0, state.scan);
+				state.scan += 1;
+				let w321 = value[key320];
+				if (w321 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "baseModel": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w322 = value[key320];
+				let hidden323 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden323);
+				hidden323.$opcode = ext[0].readConst(state);
+				let ref324 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match325 = -1;
+				if (ref324 >= 670) { match325 = 0; }
+				else if (ref324 >= 0) { match325 = 1; }
+				if (match325 == -1) { throw new Error("no opcode matched"); }
+				if (match325 == 0) {
+					ext[1].write(state, w322);
+				}
+				else if (match325 == 1) {
+					if (typeof w322 != "number" || w322 > 65535 || w322 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w322, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "name": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w326 = value[key320];
+				ext[2].write(state, w326);
+				break;
+			}
+			case "buff_effect": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w327 = value[key320];
+				ext[2].write(state, w327);
+				break;
+			}
+			case "model_zoom": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w328 = value[key320];
+				if (typeof w328 != "number" || w328 > 65535 || w328 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w328, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "rotation_0": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w329 = value[key320];
+				if (typeof w329 != "number" || w329 > 65535 || w329 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w329, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "rotation_1": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w330 = value[key320];
+				if (typeof w330 != "number" || w330 > 65535 || w330 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w330, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "modelTranslate_0": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w331 = value[key320];
+				if (typeof w331 != "number" || w331 > 32767 || w331 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w331, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "modelTranslate_1": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w332 = value[key320];
+				if (typeof w332 != "number" || w332 > 32767 || w332 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w332, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "baseModelList": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w333 = value[key320];
+				if (!Array.isArray(w333)) { throw new Error("array expected"); }
+				let w334 = w333.length;
+				if (typeof w334 != "number" || w334 > 255 || w334 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w334, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w333.length });
+				for (let i335 = 0; i335 < w333.length; i335++) {
+					let w336 = w333[i335];
+					let hidden337 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden337);
+					hidden337.$opcode = ext[3].readConst(state);
+					let ref338 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match339 = -1;
+					if (ref338 >= 670) { match339 = 0; }
+					else if (ref338 >= 0) { match339 = 1; }
+					if (match339 == -1) { throw new Error("no opcode matched"); }
+					if (match339 == 0) {
+						ext[1].write(state, w336);
+					}
+					else if (match339 == 1) {
+						if (typeof w336 != "number" || w336 > 65535 || w336 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w336, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0A": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w340 = value[key320];
+				if (typeof w340 != "number" || w340 > 65535 || w340 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w340, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "stackable_1": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w341 = value[key320];
+				if (w341 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "value": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w342 = value[key320];
+				if (typeof w342 != "number" || w342 > 2147483647 || w342 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w342, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "equipSlotId": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w343 = value[key320];
+				if (typeof w343 != "number" || w343 > 255 || w343 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w343, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "equipId": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w344 = value[key320];
+				if (typeof w344 != "number" || w344 > 255 || w344 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w344, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0F": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w345 = value[key320];
+				if (w345 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "members": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w346 = value[key320];
+				if (w346 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "multiStackSize": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w347 = value[key320];
+				if (typeof w347 != "number" || w347 > 65535 || w347 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w347, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "maleModels_0": {
+				if (typeof 23 != "number" || 23 > 255 || 23 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(23, state.scan);
+				state.scan += 1;
+				let w348 = value[key320];
+				if (typeof w348 != "object" || !w348) { throw new Error("object expected"); }
+				let hidden349 = {};
+				state.stack.push(w348);
+				state.hiddenstack.push(hidden349);
+				let w350 = w348.id;
+				let hidden351 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden351);
+				hidden351.$opcode = ext[4].readConst(state);
+				let ref352 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match353 = -1;
+				if (ref352 >= 670) { match353 = 0; }
+				else if (ref352 >= 0) { match353 = 1; }
+				if (match353 == -1) { throw new Error("no opcode matched"); }
+				if (match353 == 0) {
+					ext[1].write(state, w350);
+				}
+				else if (match353 == 1) {
+					if (typeof w350 != "number" || w350 > 65535 || w350 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w350, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let w354 = w348.type;
+				let hidden355 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden355);
+				hidden355.$opcode = ext[5].readConst(state);
+				let ref356 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match357 = -1;
+				if (ref356 >= 502) { match357 = 0; }
+				else if (true) { match357 = 1; }
+				if (match357 == -1) { throw new Error("no opcode matched"); }
+				if (match357 == 0) {
+					if (w354 != 0) { throw new Error("expected constant 0 was not present during write"); }
+				}
+				else if (match357 == 1) {
+					if (typeof w354 != "number" || w354 > 255 || w354 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w354, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "maleModels_1": {
+				if (typeof 24 != "number" || 24 > 255 || 24 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(24, state.scan);
+				state.scan += 1;
+				let w358 = value[key320];
+				let hidden359 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden359);
+				hidden359.$opcode = ext[6].readConst(state);
+				let ref360 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match361 = -1;
+				if (ref360 >= 670) { match361 = 0; }
+				else if (ref360 >= 0) { match361 = 1; }
+				if (match361 == -1) { throw new Error("no opcode matched"); }
+				if (match361 == 0) {
+					ext[1].write(state, w358);
+				}
+				else if (match361 == 1) {
+					if (typeof w358 != "number" || w358 > 65535 || w358 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w358, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "femaleModels_0": {
+				if (typeof 25 != "number" || 25 > 255 || 25 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(25, state.scan);
+				state.scan += 1;
+				let w362 = value[key320];
+				if (typeof w362 != "object" || !w362) { throw new Error("object expected"); }
+				let hidden363 = {};
+				state.stack.push(w362);
+				state.hiddenstack.push(hidden363);
+				let w364 = w362.id;
+				let hidden365 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden365);
+				hidden365.$opcode = ext[7].readConst(state);
+				let ref366 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match367 = -1;
+				if (ref366 >= 670) { match367 = 0; }
+				else if (ref366 >= 0) { match367 = 1; }
+				if (match367 == -1) { throw new Error("no opcode matched"); }
+				if (match367 == 0) {
+					ext[1].write(state, w364);
+				}
+				else if (match367 == 1) {
+					if (typeof w364 != "number" || w364 > 65535 || w364 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w364, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let w368 = w362.type;
+				let hidden369 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden369);
+				hidden369.$opcode = ext[8].readConst(state);
+				let ref370 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match371 = -1;
+				if (ref370 >= 502) { match371 = 0; }
+				else if (true) { match371 = 1; }
+				if (match371 == -1) { throw new Error("no opcode matched"); }
+				if (match371 == 0) {
+					if (w368 != 0) { throw new Error("expected constant 0 was not present during write"); }
+				}
+				else if (match371 == 1) {
+					if (typeof w368 != "number" || w368 > 255 || w368 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w368, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "femaleModels_1": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w372 = value[key320];
+				let hidden373 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden373);
+				hidden373.$opcode = ext[9].readConst(state);
+				let ref374 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match375 = -1;
+				if (ref374 >= 670) { match375 = 0; }
+				else if (ref374 >= 0) { match375 = 1; }
+				if (match375 == -1) { throw new Error("no opcode matched"); }
+				if (match375 == 0) {
+					ext[1].write(state, w372);
+				}
+				else if (match375 == 1) {
+					if (typeof w372 != "number" || w372 > 65535 || w372 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w372, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_1B": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w376 = value[key320];
+				if (typeof w376 != "number" || w376 > 255 || w376 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w376, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "ground_actions_0": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w377 = value[key320];
+				ext[2].write(state, w377);
+				break;
+			}
+			case "ground_actions_1": {
+				if (typeof 31 != "number" || 31 > 255 || 31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(31, state.scan);
+				state.scan += 1;
+				let w378 = value[key320];
+				ext[2].write(state, w378);
+				break;
+			}
+			case "ground_actions_2": {
+				if (typeof 32 != "number" || 32 > 255 || 32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(32, state.scan);
+				state.scan += 1;
+				let w379 = value[key320];
+				ext[2].write(state, w379);
+				break;
+			}
+			case "ground_actions_3": {
+				if (typeof 33 != "number" || 33 > 255 || 33 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(33, state.scan);
+				state.scan += 1;
+				let w380 = value[key320];
+				ext[2].write(state, w380);
+				break;
+			}
+			case "ground_actions_4": {
+				if (typeof 34 != "number" || 34 > 255 || 34 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(34, state.scan);
+				state.scan += 1;
+				let w381 = value[key320];
+				ext[2].write(state, w381);
+				break;
+			}
+			case "widget_actions_0": {
+				if (typeof 35 != "number" || 35 > 255 || 35 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(35, state.scan);
+				state.scan += 1;
+				let w382 = value[key320];
+				ext[2].write(state, w382);
+				break;
+			}
+			case "widget_actions_1": {
+				if (typeof 36 != "number" || 36 > 255 || 36 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(36, state.scan);
+				state.scan += 1;
+				let w383 = value[key320];
+				ext[2].write(state, w383);
+				break;
+			}
+			case "widget_actions_2": {
+				if (typeof 37 != "number" || 37 > 255 || 37 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(37, state.scan);
+				state.scan += 1;
+				let w384 = value[key320];
+				ext[2].write(state, w384);
+				break;
+			}
+			case "widget_actions_3": {
+				if (typeof 38 != "number" || 38 > 255 || 38 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(38, state.scan);
+				state.scan += 1;
+				let w385 = value[key320];
+				ext[2].write(state, w385);
+				break;
+			}
+			case "widget_actions_4": {
+				if (typeof 39 != "number" || 39 > 255 || 39 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(39, state.scan);
+				state.scan += 1;
+				let w386 = value[key320];
+				ext[2].write(state, w386);
+				break;
+			}
+			case "color_replacements": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w387 = value[key320];
+				if (!Array.isArray(w387)) { throw new Error("array expected"); }
+				let w388 = w387.length;
+				ext[10].write(state, w388);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w387.length });
+				for (let i389 = 0; i389 < w387.length; i389++) {
+					let w390 = w387[i389];
+					if (!Array.isArray(w390)) { throw new Error("array expected"); }
+					let w391 = w390[0];
+					if (typeof w391 != "number" || w391 > 65535 || w391 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w391, state.scan);
+					state.scan += 2;
+					let w392 = w390[1];
+					if (typeof w392 != "number" || w392 > 65535 || w392 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w392, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "material_replacements": {
+				if (typeof 41 != "number" || 41 > 255 || 41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(41, state.scan);
+				state.scan += 1;
+				let w393 = value[key320];
+				if (!Array.isArray(w393)) { throw new Error("array expected"); }
+				let w394 = w393.length;
+				ext[10].write(state, w394);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w393.length });
+				for (let i395 = 0; i395 < w393.length; i395++) {
+					let w396 = w393[i395];
+					if (!Array.isArray(w396)) { throw new Error("array expected"); }
+					let w397 = w396[0];
+					if (typeof w397 != "number" || w397 > 65535 || w397 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w397, state.scan);
+					state.scan += 2;
+					let w398 = w396[1];
+					if (typeof w398 != "number" || w398 > 65535 || w398 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w398, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "recolourPalette": {
+				if (typeof 42 != "number" || 42 > 255 || 42 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(42, state.scan);
+				state.scan += 1;
+				let w399 = value[key320];
+				if (!Array.isArray(w399)) { throw new Error("array expected"); }
+				let w400 = w399.length;
+				ext[10].write(state, w400);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w399.length });
+				for (let i401 = 0; i401 < w399.length; i401++) {
+					let w402 = w399[i401];
+					if (!Array.isArray(w402)) { throw new Error("array expected"); }
+					let w403 = w402[0];
+					if (typeof w403 != "number" || w403 > 255 || w403 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w403, state.scan);
+					state.scan += 1;
+					let w404 = w402[1];
+					if (typeof w404 != "number" || w404 > 127 || w404 < -128) { throw new Error(); }
+					state.buffer.writeInt8(w404, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "nameColor": {
+				if (typeof 43 != "number" || 43 > 255 || 43 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(43, state.scan);
+				state.scan += 1;
+				let w405 = value[key320];
+				if (typeof w405 != "number" || w405 > 2147483647 || w405 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w405, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "recolorDstIndices": {
+				if (typeof 44 != "number" || 44 > 255 || 44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(44, state.scan);
+				state.scan += 1;
+				let w406 = value[key320];
+				if (typeof w406 != "number" || w406 > 65535 || w406 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w406, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "retextureDstIndices": {
+				if (typeof 45 != "number" || 45 > 255 || 45 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(45, state.scan);
+				state.scan += 1;
+				let w407 = value[key320];
+				if (typeof w407 != "number" || w407 > 65535 || w407 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w407, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "tradeable": {
+				if (typeof 65 != "number" || 65 > 255 || 65 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(65, state.scan);
+				state.scan += 1;
+				let w408 = value[key320];
+				if (w408 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "buy_limit": {
+				if (typeof 69 != "number" || 69 > 255 || 69 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(69, state.scan);
+				state.scan += 1;
+				let w409 = value[key320];
+				if (typeof w409 != "number" || w409 > 2147483647 || w409 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w409, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "maleModels_2": {
+				if (typeof 78 != "number" || 78 > 255 || 78 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(78, state.scan);
+				state.scan += 1;
+				let w410 = value[key320];
+				let hidden411 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden411);
+				hidden411.$opcode = ext[11].readConst(state);
+				let ref412 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match413 = -1;
+				if (ref412 >= 670) { match413 = 0; }
+				else if (ref412 >= 0) { match413 = 1; }
+				if (match413 == -1) { throw new Error("no opcode matched"); }
+				if (match413 == 0) {
+					ext[1].write(state, w410);
+				}
+				else if (match413 == 1) {
+					if (typeof w410 != "number" || w410 > 65535 || w410 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w410, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "femaleModels_2": {
+				if (typeof 79 != "number" || 79 > 255 || 79 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(79, state.scan);
+				state.scan += 1;
+				let w414 = value[key320];
+				let hidden415 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden415);
+				hidden415.$opcode = ext[12].readConst(state);
+				let ref416 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match417 = -1;
+				if (ref416 >= 670) { match417 = 0; }
+				else if (ref416 >= 0) { match417 = 1; }
+				if (match417 == -1) { throw new Error("no opcode matched"); }
+				if (match417 == 0) {
+					ext[1].write(state, w414);
+				}
+				else if (match417 == 1) {
+					if (typeof w414 != "number" || w414 > 65535 || w414 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w414, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "maleHeads_0": {
+				if (typeof 90 != "number" || 90 > 255 || 90 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(90, state.scan);
+				state.scan += 1;
+				let w418 = value[key320];
+				let hidden419 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden419);
+				hidden419.$opcode = ext[13].readConst(state);
+				let ref420 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match421 = -1;
+				if (ref420 >= 670) { match421 = 0; }
+				else if (ref420 >= 0) { match421 = 1; }
+				if (match421 == -1) { throw new Error("no opcode matched"); }
+				if (match421 == 0) {
+					ext[1].write(state, w418);
+				}
+				else if (match421 == 1) {
+					if (typeof w418 != "number" || w418 > 65535 || w418 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w418, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "femaleHeads_0": {
+				if (typeof 91 != "number" || 91 > 255 || 91 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(91, state.scan);
+				state.scan += 1;
+				let w422 = value[key320];
+				let hidden423 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden423);
+				hidden423.$opcode = ext[14].readConst(state);
+				let ref424 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match425 = -1;
+				if (ref424 >= 670) { match425 = 0; }
+				else if (ref424 >= 0) { match425 = 1; }
+				if (match425 == -1) { throw new Error("no opcode matched"); }
+				if (match425 == 0) {
+					ext[1].write(state, w422);
+				}
+				else if (match425 == 1) {
+					if (typeof w422 != "number" || w422 > 65535 || w422 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w422, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "maleHeads_1": {
+				if (typeof 92 != "number" || 92 > 255 || 92 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(92, state.scan);
+				state.scan += 1;
+				let w426 = value[key320];
+				let hidden427 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden427);
+				hidden427.$opcode = ext[15].readConst(state);
+				let ref428 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match429 = -1;
+				if (ref428 >= 670) { match429 = 0; }
+				else if (ref428 >= 0) { match429 = 1; }
+				if (match429 == -1) { throw new Error("no opcode matched"); }
+				if (match429 == 0) {
+					ext[1].write(state, w426);
+				}
+				else if (match429 == 1) {
+					if (typeof w426 != "number" || w426 > 65535 || w426 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w426, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "femaleHeads_1": {
+				if (typeof 93 != "number" || 93 > 255 || 93 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(93, state.scan);
+				state.scan += 1;
+				let w430 = value[key320];
+				let hidden431 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden431);
+				hidden431.$opcode = ext[16].readConst(state);
+				let ref432 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match433 = -1;
+				if (ref432 >= 670) { match433 = 0; }
+				else if (ref432 >= 0) { match433 = 1; }
+				if (match433 == -1) { throw new Error("no opcode matched"); }
+				if (match433 == 0) {
+					ext[1].write(state, w430);
+				}
+				else if (match433 == 1) {
+					if (typeof w430 != "number" || w430 > 65535 || w430 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w430, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "category": {
+				if (typeof 94 != "number" || 94 > 255 || 94 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(94, state.scan);
+				state.scan += 1;
+				let w434 = value[key320];
+				if (typeof w434 != "number" || w434 > 65535 || w434 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w434, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "rotation_2": {
+				if (typeof 95 != "number" || 95 > 255 || 95 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(95, state.scan);
+				state.scan += 1;
+				let w435 = value[key320];
+				if (typeof w435 != "number" || w435 > 65535 || w435 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w435, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "dummyItem": {
+				if (typeof 96 != "number" || 96 > 255 || 96 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(96, state.scan);
+				state.scan += 1;
+				let w436 = value[key320];
+				if (typeof w436 != "number" || w436 > 255 || w436 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w436, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "noteData_old": {
+				if (typeof 97 != "number" || 97 > 255 || 97 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(97, state.scan);
+				state.scan += 1;
+				let w437 = value[key320];
+				if (typeof w437 != "number" || w437 > 65535 || w437 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w437, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "noteTemplate_old": {
+				if (typeof 98 != "number" || 98 > 255 || 98 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(98, state.scan);
+				state.scan += 1;
+				let w438 = value[key320];
+				if (typeof w438 != "number" || w438 > 65535 || w438 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w438, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "stack_info_old_0": {
+				if (typeof 100 != "number" || 100 > 255 || 100 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(100, state.scan);
+				state.scan += 1;
+				let w439 = value[key320];
+				if (typeof w439 != "object" || !w439) { throw new Error("object expected"); }
+				let hidden440 = {};
+				state.stack.push(w439);
+				state.hiddenstack.push(hidden440);
+				let w441 = w439.icon;
+				if (typeof w441 != "number" || w441 > 65535 || w441 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w441, state.scan);
+				state.scan += 2;
+				let w442 = w439.count;
+				if (typeof w442 != "number" || w442 > 65535 || w442 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w442, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_1": {
+				if (typeof 101 != "number" || 101 > 255 || 101 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(101, state.scan);
+				state.scan += 1;
+				let w443 = value[key320];
+				if (typeof w443 != "object" || !w443) { throw new Error("object expected"); }
+				let hidden444 = {};
+				state.stack.push(w443);
+				state.hiddenstack.push(hidden444);
+				let w445 = w443.icon;
+				if (typeof w445 != "number" || w445 > 65535 || w445 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w445, state.scan);
+				state.scan += 2;
+				let w446 = w443.count;
+				if (typeof w446 != "number" || w446 > 65535 || w446 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w446, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_2": {
+				if (typeof 102 != "number" || 102 > 255 || 102 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(102, state.scan);
+				state.scan += 1;
+				let w447 = value[key320];
+				if (typeof w447 != "object" || !w447) { throw new Error("object expected"); }
+				let hidden448 = {};
+				state.stack.push(w447);
+				state.hiddenstack.push(hidden448);
+				let w449 = w447.icon;
+				if (typeof w449 != "number" || w449 > 65535 || w449 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w449, state.scan);
+				state.scan += 2;
+				let w450 = w447.count;
+				if (typeof w450 != "number" || w450 > 65535 || w450 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w450, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_3": {
+				if (typeof 103 != "number" || 103 > 255 || 103 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(103, state.scan);
+				state.scan += 1;
+				let w451 = value[key320];
+				if (typeof w451 != "object" || !w451) { throw new Error("object expected"); }
+				let hidden452 = {};
+				state.stack.push(w451);
+				state.hiddenstack.push(hidden452);
+				let w453 = w451.icon;
+				if (typeof w453 != "number" || w453 > 65535 || w453 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w453, state.scan);
+				state.scan += 2;
+				let w454 = w451.count;
+				if (typeof w454 != "number" || w454 > 65535 || w454 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w454, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_4": {
+				if (typeof 104 != "number" || 104 > 255 || 104 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(104, state.scan);
+				state.scan += 1;
+				let w455 = value[key320];
+				if (typeof w455 != "object" || !w455) { throw new Error("object expected"); }
+				let hidden456 = {};
+				state.stack.push(w455);
+				state.hiddenstack.push(hidden456);
+				let w457 = w455.icon;
+				if (typeof w457 != "number" || w457 > 65535 || w457 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w457, state.scan);
+				state.scan += 2;
+				let w458 = w455.count;
+				if (typeof w458 != "number" || w458 > 65535 || w458 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w458, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_5": {
+				if (typeof 105 != "number" || 105 > 255 || 105 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(105, state.scan);
+				state.scan += 1;
+				let w459 = value[key320];
+				if (typeof w459 != "object" || !w459) { throw new Error("object expected"); }
+				let hidden460 = {};
+				state.stack.push(w459);
+				state.hiddenstack.push(hidden460);
+				let w461 = w459.icon;
+				if (typeof w461 != "number" || w461 > 65535 || w461 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w461, state.scan);
+				state.scan += 2;
+				let w462 = w459.count;
+				if (typeof w462 != "number" || w462 > 65535 || w462 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w462, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_6": {
+				if (typeof 106 != "number" || 106 > 255 || 106 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(106, state.scan);
+				state.scan += 1;
+				let w463 = value[key320];
+				if (typeof w463 != "object" || !w463) { throw new Error("object expected"); }
+				let hidden464 = {};
+				state.stack.push(w463);
+				state.hiddenstack.push(hidden464);
+				let w465 = w463.icon;
+				if (typeof w465 != "number" || w465 > 65535 || w465 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w465, state.scan);
+				state.scan += 2;
+				let w466 = w463.count;
+				if (typeof w466 != "number" || w466 > 65535 || w466 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w466, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_7": {
+				if (typeof 107 != "number" || 107 > 255 || 107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(107, state.scan);
+				state.scan += 1;
+				let w467 = value[key320];
+				if (typeof w467 != "object" || !w467) { throw new Error("object expected"); }
+				let hidden468 = {};
+				state.stack.push(w467);
+				state.hiddenstack.push(hidden468);
+				let w469 = w467.icon;
+				if (typeof w469 != "number" || w469 > 65535 || w469 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w469, state.scan);
+				state.scan += 2;
+				let w470 = w467.count;
+				if (typeof w470 != "number" || w470 > 65535 || w470 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w470, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_8": {
+				if (typeof 108 != "number" || 108 > 255 || 108 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(108, state.scan);
+				state.scan += 1;
+				let w471 = value[key320];
+				if (typeof w471 != "object" || !w471) { throw new Error("object expected"); }
+				let hidden472 = {};
+				state.stack.push(w471);
+				state.hiddenstack.push(hidden472);
+				let w473 = w471.icon;
+				if (typeof w473 != "number" || w473 > 65535 || w473 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w473, state.scan);
+				state.scan += 2;
+				let w474 = w471.count;
+				if (typeof w474 != "number" || w474 > 65535 || w474 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w474, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_old_9": {
+				if (typeof 109 != "number" || 109 > 255 || 109 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(109, state.scan);
+				state.scan += 1;
+				let w475 = value[key320];
+				if (typeof w475 != "object" || !w475) { throw new Error("object expected"); }
+				let hidden476 = {};
+				state.stack.push(w475);
+				state.hiddenstack.push(hidden476);
+				let w477 = w475.icon;
+				if (typeof w477 != "number" || w477 > 65535 || w477 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w477, state.scan);
+				state.scan += 2;
+				let w478 = w475.count;
+				if (typeof w478 != "number" || w478 > 65535 || w478 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w478, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "scale_0": {
+				if (typeof 110 != "number" || 110 > 255 || 110 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(110, state.scan);
+				state.scan += 1;
+				let w479 = value[key320];
+				if (typeof w479 != "number" || w479 > 65535 || w479 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w479, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scale_1": {
+				if (typeof 111 != "number" || 111 > 255 || 111 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(111, state.scan);
+				state.scan += 1;
+				let w480 = value[key320];
+				if (typeof w480 != "number" || w480 > 65535 || w480 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w480, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scale_2": {
+				if (typeof 112 != "number" || 112 > 255 || 112 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(112, state.scan);
+				state.scan += 1;
+				let w481 = value[key320];
+				if (typeof w481 != "number" || w481 > 65535 || w481 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w481, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ambiance": {
+				if (typeof 113 != "number" || 113 > 255 || 113 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(113, state.scan);
+				state.scan += 1;
+				let w482 = value[key320];
+				if (typeof w482 != "number" || w482 > 127 || w482 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w482, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "contrast": {
+				if (typeof 114 != "number" || 114 > 255 || 114 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(114, state.scan);
+				state.scan += 1;
+				let w483 = value[key320];
+				if (typeof w483 != "number" || w483 > 127 || w483 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w483, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "team": {
+				if (typeof 115 != "number" || 115 > 255 || 115 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(115, state.scan);
+				state.scan += 1;
+				let w484 = value[key320];
+				if (typeof w484 != "number" || w484 > 255 || w484 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w484, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "loanId_old": {
+				if (typeof 121 != "number" || 121 > 255 || 121 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(121, state.scan);
+				state.scan += 1;
+				let w485 = value[key320];
+				if (typeof w485 != "number" || w485 > 65535 || w485 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w485, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "loanTemplate_old": {
+				if (typeof 122 != "number" || 122 > 255 || 122 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(122, state.scan);
+				state.scan += 1;
+				let w486 = value[key320];
+				if (typeof w486 != "number" || w486 > 65535 || w486 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w486, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "male_translate": {
+				if (typeof 125 != "number" || 125 > 255 || 125 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(125, state.scan);
+				state.scan += 1;
+				let w487 = value[key320];
+				if (!Array.isArray(w487)) { throw new Error("array expected"); }
+				let w488 = w487[0];
+				if (typeof w488 != "number" || w488 > 255 || w488 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w488, state.scan);
+				state.scan += 1;
+				let w489 = w487[1];
+				if (typeof w489 != "number" || w489 > 255 || w489 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w489, state.scan);
+				state.scan += 1;
+				let w490 = w487[2];
+				if (typeof w490 != "number" || w490 > 255 || w490 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w490, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "female_translate": {
+				if (typeof 126 != "number" || 126 > 255 || 126 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(126, state.scan);
+				state.scan += 1;
+				let w491 = value[key320];
+				if (!Array.isArray(w491)) { throw new Error("array expected"); }
+				let w492 = w491[0];
+				if (typeof w492 != "number" || w492 > 255 || w492 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w492, state.scan);
+				state.scan += 1;
+				let w493 = w491[1];
+				if (typeof w493 != "number" || w493 > 255 || w493 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w493, state.scan);
+				state.scan += 1;
+				let w494 = w491[2];
+				if (typeof w494 != "number" || w494 > 255 || w494 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w494, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_7F": {
+				if (typeof 127 != "number" || 127 > 255 || 127 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(127, state.scan);
+				state.scan += 1;
+				let w495 = value[key320];
+				if (!Array.isArray(w495)) { throw new Error("array expected"); }
+				let w496 = w495[0];
+				if (typeof w496 != "number" || w496 > 255 || w496 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w496, state.scan);
+				state.scan += 1;
+				let w497 = w495[1];
+				if (typeof w497 != "number" || w497 > 65535 || w497 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w497, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_80": {
+				if (typeof 128 != "number" || 128 > 255 || 128 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(128, state.scan);
+				state.scan += 1;
+				let w498 = value[key320];
+				if (!Array.isArray(w498)) { throw new Error("array expected"); }
+				let w499 = w498[0];
+				if (typeof w499 != "number" || w499 > 255 || w499 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w499, state.scan);
+				state.scan += 1;
+				let w500 = w498[1];
+				if (typeof w500 != "number" || w500 > 65535 || w500 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w500, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_81": {
+				if (typeof 129 != "number" || 129 > 255 || 129 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(129, state.scan);
+				state.scan += 1;
+				let w501 = value[key320];
+				if (!Array.isArray(w501)) { throw new Error("array expected"); }
+				let w502 = w501[0];
+				if (typeof w502 != "number" || w502 > 255 || w502 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w502, state.scan);
+				state.scan += 1;
+				let w503 = w501[1];
+				if (typeof w503 != "number" || w503 > 65535 || w503 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w503, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_82": {
+				if (typeof 130 != "number" || 130 > 255 || 130 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(130, state.scan);
+				state.scan += 1;
+				let w504 = value[key320];
+				if (!Array.isArray(w504)) { throw new Error("array expected"); }
+				let w505 = w504[0];
+				if (typeof w505 != "number" || w505 > 255 || w505 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w505, state.scan);
+				state.scan += 1;
+				let w506 = w504[1];
+				if (typeof w506 != "number" || w506 > 65535 || w506 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w506, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "quests": {
+				if (typeof 132 != "number" || 132 > 255 || 132 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(132, state.scan);
+				state.scan += 1;
+				let w507 = value[key320];
+				if (!Array.isArray(w507)) { throw new Error("array expected"); }
+				let w508 = w507.length;
+				ext[10].write(state, w508);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w507.length });
+				for (let i509 = 0; i509 < w507.length; i509++) {
+					let w510 = w507[i509];
+					if (!Array.isArray(w510)) { throw new Error("array expected"); }
+					let w511 = w510[0];
+					if (typeof w511 != "number" || w511 > 255 || w511 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w511, state.scan);
+					state.scan += 1;
+					let w512 = w510[1];
+					if (typeof w512 != "number" || w512 > 65535 || w512 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w512, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "pickSizeShift": {
+				if (typeof 134 != "number" || 134 > 255 || 134 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(134, state.scan);
+				state.scan += 1;
+				let w513 = value[key320];
+				if (typeof w513 != "number" || w513 > 255 || w513 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w513, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "bindLink_old": {
+				if (typeof 139 != "number" || 139 > 255 || 139 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(139, state.scan);
+				state.scan += 1;
+				let w514 = value[key320];
+				if (typeof w514 != "number" || w514 > 65535 || w514 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w514, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "bindTemplate_old": {
+				if (typeof 140 != "number" || 140 > 255 || 140 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(140, state.scan);
+				state.scan += 1;
+				let w515 = value[key320];
+				if (typeof w515 != "number" || w515 > 65535 || w515 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w515, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ground_actions_cursor_0": {
+				if (typeof 142 != "number" || 142 > 255 || 142 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(142, state.scan);
+				state.scan += 1;
+				let w516 = value[key320];
+				if (typeof w516 != "number" || w516 > 65535 || w516 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w516, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ground_actions_cursor_1": {
+				if (typeof 143 != "number" || 143 > 255 || 143 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(143, state.scan);
+				state.scan += 1;
+				let w517 = value[key320];
+				if (typeof w517 != "number" || w517 > 65535 || w517 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w517, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ground_actions_cursor_2": {
+				if (typeof 144 != "number" || 144 > 255 || 144 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(144, state.scan);
+				state.scan += 1;
+				let w518 = value[key320];
+				if (typeof w518 != "number" || w518 > 65535 || w518 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w518, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ground_actions_cursor_3": {
+				if (typeof 145 != "number" || 145 > 255 || 145 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(145, state.scan);
+				state.scan += 1;
+				let w519 = value[key320];
+				if (typeof w519 != "number" || w519 > 65535 || w519 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w519, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ground_actions_cursor_4": {
+				if (typeof 146 != "number" || 146 > 255 || 146 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(146, state.scan);
+				state.scan += 1;
+				let w520 = value[key320];
+				if (typeof w520 != "number" || w520 > 65535 || w520 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w520, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "widget_actions_cursor_0": {
+				if (typeof 150 != "number" || 150 > 255 || 150 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(150, state.scan);
+				state.scan += 1;
+				let w521 = value[key320];
+				if (typeof w521 != "number" || w521 > 65535 || w521 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w521, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "widget_actions_cursor_1": {
+				if (typeof 151 != "number" || 151 > 255 || 151 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(151, state.scan);
+				state.scan += 1;
+				let w522 = value[key320];
+				if (typeof w522 != "number" || w522 > 65535 || w522 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w522, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "widget_actions_cursor_2": {
+				if (typeof 152 != "number" || 152 > 255 || 152 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(152, state.scan);
+				state.scan += 1;
+				let w523 = value[key320];
+				if (typeof w523 != "number" || w523 > 65535 || w523 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w523, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "widget_actions_cursor_3": {
+				if (typeof 153 != "number" || 153 > 255 || 153 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(153, state.scan);
+				state.scan += 1;
+				let w524 = value[key320];
+				if (typeof w524 != "number" || w524 > 65535 || w524 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w524, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "widget_actions_cursor_4": {
+				if (typeof 154 != "number" || 154 > 255 || 154 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(154, state.scan);
+				state.scan += 1;
+				let w525 = value[key320];
+				if (typeof w525 != "number" || w525 > 65535 || w525 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w525, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "dummy": {
+				if (typeof 156 != "number" || 156 > 255 || 156 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(156, state.scan);
+				state.scan += 1;
+				let w526 = value[key320];
+				if (w526 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "randomizeGroundPos": {
+				if (typeof 157 != "number" || 157 > 255 || 157 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(157, state.scan);
+				state.scan += 1;
+				let w527 = value[key320];
+				if (w527 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "combine_info_old": {
+				if (typeof 161 != "number" || 161 > 255 || 161 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(161, state.scan);
+				state.scan += 1;
+				let w528 = value[key320];
+				if (typeof w528 != "number" || w528 > 65535 || w528 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w528, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "combine_template_old": {
+				if (typeof 162 != "number" || 162 > 255 || 162 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(162, state.scan);
+				state.scan += 1;
+				let w529 = value[key320];
+				if (typeof w529 != "number" || w529 > 65535 || w529 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w529, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "combine_num_required": {
+				if (typeof 163 != "number" || 163 > 255 || 163 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(163, state.scan);
+				state.scan += 1;
+				let w530 = value[key320];
+				if (typeof w530 != "number" || w530 > 65535 || w530 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w530, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "combine_shard_name": {
+				if (typeof 164 != "number" || 164 > 255 || 164 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(164, state.scan);
+				state.scan += 1;
+				let w531 = value[key320];
+				ext[2].write(state, w531);
+				break;
+			}
+			case "neverStackable": {
+				if (typeof 165 != "number" || 165 > 255 || 165 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(165, state.scan);
+				state.scan += 1;
+				let w532 = value[key320];
+				if (w532 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_A7": {
+				if (typeof 167 != "number" || 167 > 255 || 167 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(167, state.scan);
+				state.scan += 1;
+				let w533 = value[key320];
+				if (w533 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_A8": {
+				if (typeof 168 != "number" || 168 > 255 || 168 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(168, state.scan);
+				state.scan += 1;
+				let w534 = value[key320];
+				if (w534 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_B2": {
+				if (typeof 178 != "number" || 178 > 255 || 178 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(178, state.scan);
+				state.scan += 1;
+				let w535 = value[key320];
+				if (w535 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "big_value": {
+				if (typeof 181 != "number" || 181 > 255 || 181 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(181, state.scan);
+				state.scan += 1;
+				let w536 = value[key320];
+				if (!Array.isArray(w536)) { throw new Error("array expected"); }
+				let w537 = w536[0];
+				if (typeof w537 != "number" || w537 > 2147483647 || w537 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w537, state.scan);
+				state.scan += 4;
+				let w538 = w536[1];
+				if (typeof w538 != "number" || w538 > 2147483647 || w538 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w538, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "noteDataIcon": {
+				if (typeof 182 != "number" || 182 > 255 || 182 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(182, state.scan);
+				state.scan += 1;
+				let w539 = value[key320];
+				ext[17].write(state, w539);
+				break;
+			}
+			case "stack_info_0": {
+				if (typeof 190 != "number" || 190 > 255 || 190 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(190, state.scan);
+				state.scan += 1;
+				let w540 = value[key320];
+				if (typeof w540 != "object" || !w540) { throw new Error("object expected"); }
+				let hidden541 = {};
+				state.stack.push(w540);
+				state.hiddenstack.push(hidden541);
+				let w542 = w540.icon;
+				ext[17].write(state, w542);
+				let w543 = w540.count;
+				if (typeof w543 != "number" || w543 > 65535 || w543 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w543, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_1": {
+				if (typeof 191 != "number" || 191 > 255 || 191 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(191, state.scan);
+				state.scan += 1;
+				let w544 = value[key320];
+				if (typeof w544 != "object" || !w544) { throw new Error("object expected"); }
+				let hidden545 = {};
+				state.stack.push(w544);
+				state.hiddenstack.push(hidden545);
+				let w546 = w544.icon;
+				ext[17].write(state, w546);
+				let w547 = w544.count;
+				if (typeof w547 != "number" || w547 > 65535 || w547 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w547, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_2": {
+				if (typeof 192 != "number" || 192 > 255 || 192 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(192, state.scan);
+				state.scan += 1;
+				let w548 = value[key320];
+				if (typeof w548 != "object" || !w548) { throw new Error("object expected"); }
+				let hidden549 = {};
+				state.stack.push(w548);
+				state.hiddenstack.push(hidden549);
+				let w550 = w548.icon;
+				ext[17].write(state, w550);
+				let w551 = w548.count;
+				if (typeof w551 != "number" || w551 > 65535 || w551 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w551, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_3": {
+				if (typeof 193 != "number" || 193 > 255 || 193 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(193, state.scan);
+				state.scan += 1;
+				let w552 = value[key320];
+				if (typeof w552 != "object" || !w552) { throw new Error("object expected"); }
+				let hidden553 = {};
+				state.stack.push(w552);
+				state.hiddenstack.push(hidden553);
+				let w554 = w552.icon;
+				ext[17].write(state, w554);
+				let w555 = w552.count;
+				if (typeof w555 != "number" || w555 > 65535 || w555 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w555, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_4": {
+				if (typeof 194 != "number" || 194 > 255 || 194 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(194, state.scan);
+				state.scan += 1;
+				let w556 = value[key320];
+				if (typeof w556 != "object" || !w556) { throw new Error("object expected"); }
+				let hidden557 = {};
+				state.stack.push(w556);
+				state.hiddenstack.push(hidden557);
+				let w558 = w556.icon;
+				ext[17].write(state, w558);
+				let w559 = w556.count;
+				if (typeof w559 != "number" || w559 > 65535 || w559 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w559, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_5": {
+				if (typeof 195 != "number" || 195 > 255 || 195 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(195, state.scan);
+				state.scan += 1;
+				let w560 = value[key320];
+				if (typeof w560 != "object" || !w560) { throw new Error("object expected"); }
+				let hidden561 = {};
+				state.stack.push(w560);
+				state.hiddenstack.push(hidden561);
+				let w562 = w560.icon;
+				ext[17].write(state, w562);
+				let w563 = w560.count;
+				if (typeof w563 != "number" || w563 > 65535 || w563 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w563, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_6": {
+				if (typeof 196 != "number" || 196 > 255 || 196 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(196, state.scan);
+				state.scan += 1;
+				let w564 = value[key320];
+				if (typeof w564 != "object" || !w564) { throw new Error("object expected"); }
+				let hidden565 = {};
+				state.stack.push(w564);
+				state.hiddenstack.push(hidden565);
+				let w566 = w564.icon;
+				ext[17].write(state, w566);
+				let w567 = w564.count;
+				if (typeof w567 != "number" || w567 > 65535 || w567 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w567, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_7": {
+				if (typeof 197 != "number" || 197 > 255 || 197 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(197, state.scan);
+				state.scan += 1;
+				let w568 = value[key320];
+				if (typeof w568 != "object" || !w568) { throw new Error("object expected"); }
+				let hidden569 = {};
+				state.stack.push(w568);
+				state.hiddenstack.push(hidden569);
+				let w570 = w568.icon;
+				ext[17].write(state, w570);
+				let w571 = w568.count;
+				if (typeof w571 != "number" || w571 > 65535 || w571 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w571, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_8": {
+				if (typeof 198 != "number" || 198 > 255 || 198 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(198, state.scan);
+				state.scan += 1;
+				let w572 = value[key320];
+				if (typeof w572 != "object" || !w572) { throw new Error("object expected"); }
+				let hidden573 = {};
+				state.stack.push(w572);
+				state.hiddenstack.push(hidden573);
+				let w574 = w572.icon;
+				ext[17].write(state, w574);
+				let w575 = w572.count;
+				if (typeof w575 != "number" || w575 > 65535 || w575 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w575, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "stack_info_9": {
+				if (typeof 199 != "number" || 199 > 255 || 199 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(199, state.scan);
+				state.scan += 1;
+				let w576 = value[key320];
+				if (typeof w576 != "object" || !w576) { throw new Error("object expected"); }
+				let hidden577 = {};
+				state.stack.push(w576);
+				state.hiddenstack.push(hidden577);
+				let w578 = w576.icon;
+				ext[17].write(state, w578);
+				let w579 = w576.count;
+				if (typeof w579 != "number" || w579 > 65535 || w579 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w579, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "noteData": {
+				if (typeof 201 != "number" || 201 > 255 || 201 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(201, state.scan);
+				state.scan += 1;
+				let w580 = value[key320];
+				ext[17].write(state, w580);
+				break;
+			}
+			case "noteTemplate": {
+				if (typeof 202 != "number" || 202 > 255 || 202 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(202, state.scan);
+				state.scan += 1;
+				let w581 = value[key320];
+				ext[17].write(state, w581);
+				break;
+			}
+			case "loanId": {
+				if (typeof 203 != "number" || 203 > 255 || 203 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(203, state.scan);
+				state.scan += 1;
+				let w582 = value[key320];
+				ext[17].write(state, w582);
+				break;
+			}
+			case "loanTemplate": {
+				if (typeof 204 != "number" || 204 > 255 || 204 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(204, state.scan);
+				state.scan += 1;
+				let w583 = value[key320];
+				ext[17].write(state, w583);
+				break;
+			}
+			case "bindLink": {
+				if (typeof 205 != "number" || 205 > 255 || 205 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(205, state.scan);
+				state.scan += 1;
+				let w584 = value[key320];
+				ext[17].write(state, w584);
+				break;
+			}
+			case "bindTemplate": {
+				if (typeof 206 != "number" || 206 > 255 || 206 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(206, state.scan);
+				state.scan += 1;
+				let w585 = value[key320];
+				ext[17].write(state, w585);
+				break;
+			}
+			case "combine_info": {
+				if (typeof 207 != "number" || 207 > 255 || 207 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(207, state.scan);
+				state.scan += 1;
+				let w586 = value[key320];
+				ext[17].write(state, w586);
+				break;
+			}
+			case "combine_template": {
+				if (typeof 208 != "number" || 208 > 255 || 208 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(208, state.scan);
+				state.scan += 1;
+				let w587 = value[key320];
+				ext[17].write(state, w587);
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w588 = value[key320];
+				if (!Array.isArray(w588)) { throw new Error("array expected"); }
+				let w589 = w588.length;
+				if (typeof w589 != "number" || w589 > 255 || w589 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w589, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w588.length });
+				for (let i590 = 0; i590 < w588.length; i590++) {
+					let w591 = w588[i590];
+					if (typeof w591 != "object" || !w591) { throw new Error("object expected"); }
+					let hidden592 = {};
+					state.stack.push(w591);
+					state.hiddenstack.push(hidden592);
+					let w593 = w591.$type;
+					w593 ??= 0;
+					w593 = ext[18].resolve(w591, w593);
+					w593 = ext[19].resolve(w591, w593);
+					hidden592.$type = w593;
+					if (typeof w593 != "number" || w593 > 255 || w593 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w593, state.scan);
+					state.scan += 1;
+					let w594 = w591.prop;
+					ext[17].write(state, w594);
+					let w595 = w591.intvalue;
+					if (w595 != null) {
+						if (typeof w595 != "number" || w595 > 2147483647 || w595 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w595, state.scan);
+						state.scan += 4;
+					}
+					let w596 = w591.stringvalue;
+					if (w596 != null) {
+						ext[2].write(state, w596);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key320);
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,3901 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\locs.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xc6f538b8;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let hidden3 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden3);
+				let v4 = ext[0].read(state);
+				hidden3.$opcode = v4;
+				let ref5 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match6 = -1;
+				if (ref5 >= 582) { match6 = 0; }
+				else if (true) { match6 = 1; }
+				if (match6 == -1) { throw new Error("no opcode matched"); }
+				let v7;
+				if (match6 == 0) {
+					let v8 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden9 = { $index: 0, $length: v8 };
+					state.hiddenstack.push(hidden9);
+					state.stack.push({});
+					let arr10 = [];
+					for (let i11 = 0; i11 < v8; i11++) {
+						hidden9.$index = i11;
+						let obj12 = {};
+						let hidden13 = {};
+						state.stack.push(obj12);
+						state.hiddenstack.push(hidden13);
+						let v14 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v14 !== undefined) { obj12.type = v14; }
+						let v15 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden16 = { $index: 0, $length: v15 };
+						state.hiddenstack.push(hidden16);
+						state.stack.push({});
+						let arr17 = [];
+						for (let i18 = 0; i18 < v15; i18++) {
+							hidden16.$index = i18;
+							let hidden19 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden19);
+							let v20 = ext[1].read(state);
+							hidden19.$opcode = v20;
+							let ref21 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match22 = -1;
+							if (ref21 >= 670) { match22 = 0; }
+							else if (ref21 >= 0) { match22 = 1; }
+							if (match22 == -1) { throw new Error("no opcode matched"); }
+							let v23;
+							if (match22 == 0) {
+								let v24 = ext[2].read(state);
+								v23 = v24;
+							}
+							else if (match22 == 1) {
+								let v25 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v23 = v25;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr17.push(v23);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr17 !== undefined) { obj12.values = arr17; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr10.push(obj12);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v7 = arr10;
+				}
+				else if (match6 == 1) {
+					let v26 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden27 = { $index: 0, $length: v26 };
+					state.hiddenstack.push(hidden27);
+					state.stack.push({});
+					let arr28 = [];
+					for (let i29 = 0; i29 < v26; i29++) {
+						hidden27.$index = i29;
+						let obj30 = {};
+						let hidden31 = {};
+						state.stack.push(obj30);
+						state.hiddenstack.push(hidden31);
+						let hidden32 = { $index: 0, $length: 1 };
+						state.hiddenstack.push(hidden32);
+						state.stack.push({});
+						let arr33 = [];
+						for (let i34 = 0; i34 < 1; i34++) {
+							hidden32.$index = i34;
+							let hidden35 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden35);
+							let v36 = ext[3].read(state);
+							hidden35.$opcode = v36;
+							let ref37 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match38 = -1;
+							if (ref37 >= 670) { match38 = 0; }
+							else if (ref37 >= 0) { match38 = 1; }
+							if (match38 == -1) { throw new Error("no opcode matched"); }
+							let v39;
+							if (match38 == 0) {
+								let v40 = ext[2].read(state);
+								v39 = v40;
+							}
+							else if (match38 == 1) {
+								let v41 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v39 = v41;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr33.push(v39);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr33 !== undefined) { obj30.values = arr33; }
+						let v42 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v42 !== undefined) { obj30.type = v42; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr28.push(obj30);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v7 = arr28;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.models = v7;
+				break;
+			}
+			case 2: {
+				let v43 = ext[4].read(state);
+				obj0.name = v43;
+				break;
+			}
+			case 3: {
+				let v44 = ext[4].read(state);
+				obj0.examine = v44;
+				break;
+			}
+			case 5: {
+				let hidden45 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden45);
+				let v46 = ext[5].read(state);
+				hidden45.$opcode = v46;
+				let ref47 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match48 = -1;
+				if (ref47 >= 582) { match48 = 0; }
+				else if (true) { match48 = 1; }
+				if (match48 == -1) { throw new Error("no opcode matched"); }
+				let v49;
+				if (match48 == 0) {
+					let obj50 = {};
+					let hidden51 = {};
+					state.stack.push(obj50);
+					state.hiddenstack.push(hidden51);
+					let v52 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden53 = { $index: 0, $length: v52 };
+					state.hiddenstack.push(hidden53);
+					state.stack.push({});
+					let arr54 = [];
+					for (let i55 = 0; i55 < v52; i55++) {
+						hidden53.$index = i55;
+						let obj56 = {};
+						let hidden57 = {};
+						state.stack.push(obj56);
+						state.hiddenstack.push(hidden57);
+						let v58 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v58 !== undefined) { obj56.type = v58; }
+						let v59 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden60 = { $index: 0, $length: v59 };
+						state.hiddenstack.push(hidden60);
+						state.stack.push({});
+						let arr61 = [];
+						for (let i62 = 0; i62 < v59; i62++) {
+							hidden60.$index = i62;
+							let hidden63 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden63);
+							let v64 = ext[6].read(state);
+							hidden63.$opcode = v64;
+							let ref65 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match66 = -1;
+							if (ref65 >= 670) { match66 = 0; }
+							else if (ref65 >= 0) { match66 = 1; }
+							if (match66 == -1) { throw new Error("no opcode matched"); }
+							let v67;
+							if (match66 == 0) {
+								let v68 = ext[2].read(state);
+								v67 = v68;
+							}
+							else if (match66 == 1) {
+								let v69 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v67 = v69;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr61.push(v67);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr61 !== undefined) { obj56.values = arr61; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr54.push(obj56);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr54 !== undefined) { obj50.models = arr54; }
+					let v70 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden71 = { $index: 0, $length: v70 };
+					state.hiddenstack.push(hidden71);
+					state.stack.push({});
+					let arr72 = [];
+					for (let i73 = 0; i73 < v70; i73++) {
+						hidden71.$index = i73;
+						let hidden74 = { $index: 0, $length: 2 };
+						state.hiddenstack.push(hidden74);
+						state.stack.push({});
+						let arr75 = [];
+						for (let i76 = 0; i76 < 2; i76++) {
+							hidden74.$index = i76;
+							let hidden77 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden77);
+							let v78 = ext[7].read(state);
+							hidden77.$opcode = v78;
+							let ref79 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match80 = -1;
+							if (ref79 >= 670) { match80 = 0; }
+							else if (ref79 >= 0) { match80 = 1; }
+							if (match80 == -1) { throw new Error("no opcode matched"); }
+							let v81;
+							if (match80 == 0) {
+								let v82 = ext[2].read(state);
+								v81 = v82;
+							}
+							else if (match80 == 1) {
+								let v83 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v81 = v83;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr75.push(v81);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						arr72.push(arr75);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr72 !== undefined) { obj50.unktail = arr72; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					v49 = obj50;
+				}
+				else if (match48 == 1) {
+					let obj84 = {};
+					let hidden85 = {};
+					state.stack.push(obj84);
+					state.hiddenstack.push(hidden85);
+					let hidden86 = { $index: 0, $length: 1 };
+					state.hiddenstack.push(hidden86);
+					state.stack.push({});
+					let arr87 = [];
+					for (let i88 = 0; i88 < 1; i88++) {
+						hidden86.$index = i88;
+						let obj89 = {};
+						let hidden90 = {};
+						state.stack.push(obj89);
+						state.hiddenstack.push(hidden90);
+						if (10 !== undefined) { obj89.type = 10; }
+						let v91 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden92 = { $index: 0, $length: v91 };
+						state.hiddenstack.push(hidden92);
+						state.stack.push({});
+						let arr93 = [];
+						for (let i94 = 0; i94 < v91; i94++) {
+							hidden92.$index = i94;
+							let hidden95 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden95);
+							let v96 = ext[8].read(state);
+							hidden95.$opcode = v96;
+							let ref97 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match98 = -1;
+							if (ref97 >= 670) { match98 = 0; }
+							else if (ref97 >= 0) { match98 = 1; }
+							if (match98 == -1) { throw new Error("no opcode matched"); }
+							let v99;
+							if (match98 == 0) {
+								let v100 = ext[2].read(state);
+								v99 = v100;
+							}
+							else if (match98 == 1) {
+								let v101 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v99 = v101;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr93.push(v99);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr93 !== undefined) { obj89.values = arr93; }
+						let hidden102 = { $index: 0, $length: 0 };
+						state.hiddenstack.push(hidden102);
+						state.stack.push({});
+						let arr103 = [];
+						for (let i104 = 0; i104 < 0; i104++) {
+							hidden102.$index = i104;
+							let hidden105 = { $index: 0, $length: 2 };
+							state.hiddenstack.push(hidden105);
+							state.stack.push({});
+							let arr106 = [];
+							for (let i107 = 0; i107 < 2; i107++) {
+								hidden105.$index = i107;
+								let hidden108 = { $opcode: 0 };
+								state.stack.push({});
+								state.hiddenstack.push(hidden108);
+								let v109 = ext[9].read(state);
+								hidden108.$opcode = v109;
+								let ref110 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+								let match111 = -1;
+								if (ref110 >= 670) { match111 = 0; }
+								else if (ref110 >= 0) { match111 = 1; }
+								if (match111 == -1) { throw new Error("no opcode matched"); }
+								let v112;
+								if (match111 == 0) {
+									let v113 = ext[2].read(state);
+									v112 = v113;
+								}
+								else if (match111 == 1) {
+									let v114 = state.view.getUint16(state.scan);
+									state.scan += 2;
+									v112 = v114;
+								}
+								state.stack.pop();
+								state.hiddenstack.pop();
+								arr106.push(v112);
+							}
+							state.hiddenstack.pop();
+							state.stack.pop();
+							arr103.push(arr106);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr103 !== undefined) { obj89.unktail = arr103; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr87.push(obj89);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr87 !== undefined) { obj84.models = arr87; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					v49 = obj84;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.models_05 = v49;
+				break;
+			}
+			case 14: {
+				let v115 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.width = v115;
+				break;
+			}
+			case 15: {
+				let v116 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.length = v116;
+				break;
+			}
+			case 17: {
+				obj0.walkable = true;
+				break;
+			}
+			case 18: {
+				obj0.allows_lineofsight = true;
+				break;
+			}
+			case 19: {
+				let v117 = state.view.getUint8(state.scan++);
+				if (v117 != 0 && v117 != 1) { throw new Error("1 or 0 expected boolean value"); }
+				obj0.deletable = (v117 != 0);
+				break;
+			}
+			case 21: {
+				obj0.morphFloor = true;
+				break;
+			}
+			case 22: {
+				obj0.unknown_16 = true;
+				break;
+			}
+			case 23: {
+				obj0.occludes_1 = false;
+				break;
+			}
+			case 24: {
+				let v118 = ext[2].read(state);
+				obj0.animation = v118;
+				break;
+			}
+			case 27: {
+				obj0.blocks_movement = true;
+				break;
+			}
+			case 28: {
+				let v119 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.wallkit_related_1C = v119;
+				break;
+			}
+			case 29: {
+				let v120 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.ambient = v120;
+				break;
+			}
+			case 30: {
+				let v121 = ext[4].read(state);
+				obj0.actions_0 = v121;
+				break;
+			}
+			case 31: {
+				let v122 = ext[4].read(state);
+				obj0.actions_1 = v122;
+				break;
+			}
+			case 32: {
+				let v123 = ext[4].read(state);
+				obj0.actions_2 = v123;
+				break;
+			}
+			case 33: {
+				let v124 = ext[4].read(state);
+				obj0.actions_3 = v124;
+				break;
+			}
+			case 34: {
+				let v125 = ext[4].read(state);
+				obj0.actions_4 = v125;
+				break;
+			}
+			case 39: {
+				let v126 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.contrast = v126;
+				break;
+			}
+			case 40: {
+				let v127 = ext[10].read(state);
+				let hidden128 = { $index: 0, $length: v127 };
+				state.hiddenstack.push(hidden128);
+				state.stack.push({});
+				let arr129 = [];
+				for (let i130 = 0; i130 < v127; i130++) {
+					hidden128.$index = i130;
+					let v131 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v132 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr133 = [v131, v132];
+					arr129.push(arr133);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.color_replacements = arr129;
+				break;
+			}
+			case 41: {
+				let v134 = ext[10].read(state);
+				let hidden135 = { $index: 0, $length: v134 };
+				state.hiddenstack.push(hidden135);
+				state.stack.push({});
+				let arr136 = [];
+				for (let i137 = 0; i137 < v134; i137++) {
+					hidden135.$index = i137;
+					let v138 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v139 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr140 = [v138, v139];
+					arr136.push(arr140);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.material_replacements = arr136;
+				break;
+			}
+			case 42: {
+				let v141 = ext[10].read(state);
+				let hidden142 = { $index: 0, $length: v141 };
+				state.hiddenstack.push(hidden142);
+				state.stack.push({});
+				let arr143 = [];
+				for (let i144 = 0; i144 < v141; i144++) {
+					hidden142.$index = i144;
+					let v145 = state.view.getInt8(state.scan);
+					state.scan += 1;
+					arr143.push(v145);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.recolourPalette = arr143;
+				break;
+			}
+			case 44: {
+				let v146 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_2C = v146;
+				break;
+			}
+			case 45: {
+				let v147 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_2D = v147;
+				break;
+			}
+			case 54: {
+				obj0.unknown_36 = true;
+				break;
+			}
+			case 55: {
+				obj0.unknown_37 = true;
+				break;
+			}
+			case 56: {
+				obj0.unknown_38 = true;
+				break;
+			}
+			case 57: {
+				obj0.unknown_39 = true;
+				break;
+			}
+			case 60: {
+				let v148 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_3c = v148;
+				break;
+			}
+			case 62: {
+				obj0.mirror = true;
+				break;
+			}
+			case 64: {
+				obj0.unknown_40 = true;
+				break;
+			}
+			case 65: {
+				let v149 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.scaleX = v149;
+				break;
+			}
+			case 66: {
+				let v150 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.scaleY = v150;
+				break;
+			}
+			case 67: {
+				let v151 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.scaleZ = v151;
+				break;
+			}
+			case 68: {
+				let v152 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.mapscene_old = v152;
+				break;
+			}
+			case 69: {
+				let v153 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.dummy_45 = v153;
+				break;
+			}
+			case 70: {
+				let v154 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.translateX = v154;
+				break;
+			}
+			case 71: {
+				let v155 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.translateY = v155;
+				break;
+			}
+			case 72: {
+				let v156 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.translateZ = v156;
+				break;
+			}
+			case 73: {
+				obj0.unknown_49 = true;
+				break;
+			}
+			case 74: {
+				obj0.unknown_4A = true;
+				break;
+			}
+			case 75: {
+				let v157 = state.view.getUint8(state.scan++);
+				if (v157 != 0 && v157 != 1) { throw new Error("1 or 0 expected boolean value"); }
+				obj0.unknown_4B = (v157 != 0);
+				break;
+			}
+			case 77: {
+				let obj158 = {};
+				let hidden159 = {};
+				state.stack.push(obj158);
+				state.hiddenstack.push(hidden159);
+				let v160 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v160 !== undefined) { obj158.varbit = v160; }
+				let v161 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v161 !== undefined) { obj158.varp = v161; }
+				let hidden162 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden162);
+				let v163 = ext[11].read(state);
+				hidden162.$opcode = v163;
+				let ref164 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match165 = -1;
+				if (ref164 >= 910) { match165 = 0; }
+				else if (ref164 >= 0) { match165 = 1; }
+				if (match165 == -1) { throw new Error("no opcode matched"); }
+				let v166;
+				if (match165 == 0) {
+					let v167 = ext[10].read(state);
+					v166 = v167;
+				}
+				else if (match165 == 1) {
+					let v168 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v166 = v168;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let hidden169 = { $index: 0, $length: v166 };
+				state.hiddenstack.push(hidden169);
+				state.stack.push({});
+				let arr170 = [];
+				for (let i171 = 0; i171 < v166; i171++) {
+					hidden169.$index = i171;
+					let hidden172 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden172);
+					let v173 = ext[12].read(state);
+					hidden172.$opcode = v173;
+					let ref174 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match175 = -1;
+					if (ref174 >= 670) { match175 = 0; }
+					else if (ref174 >= 0) { match175 = 1; }
+					if (match175 == -1) { throw new Error("no opcode matched"); }
+					let v176;
+					if (match175 == 0) {
+						let v177 = ext[2].read(state);
+						v176 = v177;
+					}
+					else if (match175 == 1) {
+						let v178 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v176 = v178;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr170.push(v176);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr170 !== undefined) { obj158.options = arr170; }
+				let hidden179 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden179);
+				let v180 = ext[13].read(state);
+				hidden179.$opcode = v180;
+				let ref181 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match182 = -1;
+				if (ref181 >= 670) { match182 = 0; }
+				else if (ref181 >= 0) { match182 = 1; }
+				if (match182 == -1) { throw new Error("no opcode matched"); }
+				let v183;
+				if (match182 == 0) {
+					let v184 = ext[2].read(state);
+					v183 = v184;
+				}
+				else if (match182 == 1) {
+					let v185 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v183 = v185;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v183 !== undefined) { obj158.default = v183; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morphs_1 = obj158;
+				break;
+			}
+			case 78: {
+				let obj186 = {};
+				let hidden187 = {};
+				state.stack.push(obj186);
+				state.hiddenstack.push(hidden187);
+				let v188 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v188 !== undefined) { obj186.sound = v188; }
+				let v189 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v189 !== undefined) { obj186.unk = v189; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.sound = obj186;
+				break;
+			}
+			case 79: {
+				let obj190 = {};
+				let hidden191 = {};
+				state.stack.push(obj190);
+				state.hiddenstack.push(hidden191);
+				let v192 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v192 !== undefined) { obj190.unknown_1 = v192; }
+				let v193 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v193 !== undefined) { obj190.unknown_2 = v193; }
+				let v194 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v194 !== undefined) { obj190.unknown_3 = v194; }
+				let v195 = ext[10].read(state);
+				let hidden196 = { $index: 0, $length: v195 };
+				state.hiddenstack.push(hidden196);
+				state.stack.push({});
+				let arr197 = [];
+				for (let i198 = 0; i198 < v195; i198++) {
+					hidden196.$index = i198;
+					let v199 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr197.push(v199);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr197 !== undefined) { obj190.sounds = arr197; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.background_sounds = obj190;
+				break;
+			}
+			case 81: {
+				let v200 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_51 = v200;
+				break;
+			}
+			case 82: {
+				obj0.unknown_52 = true;
+				break;
+			}
+			case 88: {
+				obj0.is_members = true;
+				break;
+			}
+			case 89: {
+				obj0.unknown_59 = true;
+				break;
+			}
+			case 90: {
+				obj0.unknown_5A = true;
+				break;
+			}
+			case 91: {
+				obj0.isMembers = true;
+				break;
+			}
+			case 92: {
+				let obj201 = {};
+				let hidden202 = {};
+				state.stack.push(obj201);
+				state.hiddenstack.push(hidden202);
+				let v203 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v203 !== undefined) { obj201.varbit = v203; }
+				let v204 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v204 !== undefined) { obj201.varp = v204; }
+				let hidden205 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden205);
+				let v206 = ext[14].read(state);
+				hidden205.$opcode = v206;
+				let ref207 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match208 = -1;
+				if (ref207 >= 670) { match208 = 0; }
+				else if (ref207 >= 0) { match208 = 1; }
+				if (match208 == -1) { throw new Error("no opcode matched"); }
+				let v209;
+				if (match208 == 0) {
+					let v210 = ext[2].read(state);
+					v209 = v210;
+				}
+				else if (match208 == 1) {
+					let v211 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v209 = v211;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v209 !== undefined) { obj201.unk2 = v209; }
+				let hidden212 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden212);
+				let v213 = ext[15].read(state);
+				hidden212.$opcode = v213;
+				let ref214 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match215 = -1;
+				if (ref214 >= 910) { match215 = 0; }
+				else if (ref214 >= 0) { match215 = 1; }
+				if (match215 == -1) { throw new Error("no opcode matched"); }
+				let v216;
+				if (match215 == 0) {
+					let v217 = ext[10].read(state);
+					v216 = v217;
+				}
+				else if (match215 == 1) {
+					let v218 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v216 = v218;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let hidden219 = { $index: 0, $length: v216 };
+				state.hiddenstack.push(hidden219);
+				state.stack.push({});
+				let arr220 = [];
+				for (let i221 = 0; i221 < v216; i221++) {
+					hidden219.$index = i221;
+					let hidden222 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden222);
+					let v223 = ext[16].read(state);
+					hidden222.$opcode = v223;
+					let ref224 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match225 = -1;
+					if (ref224 >= 670) { match225 = 0; }
+					else if (ref224 >= 0) { match225 = 1; }
+					if (match225 == -1) { throw new Error("no opcode matched"); }
+					let v226;
+					if (match225 == 0) {
+						let v227 = ext[2].read(state);
+						v226 = v227;
+					}
+					else if (match225 == 1) {
+						let v228 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v226 = v228;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr220.push(v226);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr220 !== undefined) { obj201.options = arr220; }
+				let hidden229 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden229);
+				let v230 = ext[17].read(state);
+				hidden229.$opcode = v230;
+				let ref231 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match232 = -1;
+				if (ref231 >= 670) { match232 = 0; }
+				else if (ref231 >= 0) { match232 = 1; }
+				if (match232 == -1) { throw new Error("no opcode matched"); }
+				let v233;
+				if (match232 == 0) {
+					let v234 = ext[2].read(state);
+					v233 = v234;
+				}
+				else if (match232 == 1) {
+					let v235 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v233 = v235;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v233 !== undefined) { obj201.default = v233; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morphs_2 = obj201;
+				break;
+			}
+			case 93: {
+				let v236 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				let v237 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				let arr238 = [v236, v237];
+				obj0.tilt_xz = arr238;
+				break;
+			}
+			case 94: {
+				obj0.under_water = true;
+				break;
+			}
+			case 95: {
+				let hidden239 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden239);
+				let v240 = ext[18].read(state);
+				hidden239.$opcode = v240;
+				let ref241 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match242 = -1;
+				if (ref241 >= 596) { match242 = 0; }
+				else if (true) { match242 = 1; }
+				if (match242 == -1) { throw new Error("no opcode matched"); }
+				let v243;
+				if (match242 == 0) {
+					let v244 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					v243 = v244;
+				}
+				else if (match242 == 1) {
+					v243 = 0;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morphCeilingOffset = v243;
+				break;
+			}
+			case 96: {
+				obj0.unknown_60 = true;
+				break;
+			}
+			case 97: {
+				obj0.ground_decoration_related_61 = true;
+				break;
+			}
+			case 98: {
+				obj0.has_animated_texture = true;
+				break;
+			}
+			case 99: {
+				let obj245 = {};
+				let hidden246 = {};
+				state.stack.push(obj245);
+				state.hiddenstack.push(hidden246);
+				let v247 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v247 !== undefined) { obj245.unknown_2 = v247; }
+				let v248 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v248 !== undefined) { obj245.unknown_1 = v248; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.dummy_63 = obj245;
+				break;
+			}
+			case 100: {
+				let obj249 = {};
+				let hidden250 = {};
+				state.stack.push(obj249);
+				state.hiddenstack.push(hidden250);
+				let v251 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v251 !== undefined) { obj249.unknown_2 = v251; }
+				let v252 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v252 !== undefined) { obj249.unknown_1 = v252; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.dummy_64 = obj249;
+				break;
+			}
+			case 101: {
+				let v253 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unused_65 = v253;
+				break;
+			}
+			case 102: {
+				let v254 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.mapscene = v254;
+				break;
+			}
+			case 103: {
+				obj0.occludes_2 = false;
+				break;
+			}
+			case 104: {
+				let v255 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.interactable_related_68 = v255;
+				break;
+			}
+			case 105: {
+				obj0.invertMapScene = true;
+				break;
+			}
+			case 106: {
+				let v256 = ext[10].read(state);
+				let hidden257 = { $index: 0, $length: v256 };
+				state.hiddenstack.push(hidden257);
+				state.stack.push({});
+				let arr258 = [];
+				for (let i259 = 0; i259 < v256; i259++) {
+					hidden257.$index = i259;
+					let obj260 = {};
+					let hidden261 = {};
+					state.stack.push(obj260);
+					state.hiddenstack.push(hidden261);
+					let v262 = ext[2].read(state);
+					if (v262 !== undefined) { obj260.animid = v262; }
+					let v263 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v263 !== undefined) { obj260.weight = v263; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr258.push(obj260);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.animVariations = arr258;
+				break;
+			}
+			case 107: {
+				let v264 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.maplabel = v264;
+				break;
+			}
+			case 108: {
+				obj0.unknown_6C = true;
+				break;
+			}
+			case 109: {
+				obj0.unknown_6D = true;
+				break;
+			}
+			case 110: {
+				obj0.unknown_6E = true;
+				break;
+			}
+			case 113: {
+				let v265 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_71 = v265;
+				break;
+			}
+			case 150: {
+				let v266 = ext[4].read(state);
+				obj0.members_action_1 = v266;
+				break;
+			}
+			case 151: {
+				let v267 = ext[4].read(state);
+				obj0.members_action_2 = v267;
+				break;
+			}
+			case 152: {
+				let v268 = ext[4].read(state);
+				obj0.members_action_3 = v268;
+				break;
+			}
+			case 153: {
+				let v269 = ext[4].read(state);
+				obj0.members_action_4 = v269;
+				break;
+			}
+			case 154: {
+				let v270 = ext[4].read(state);
+				obj0.members_action_5 = v270;
+				break;
+			}
+			case 160: {
+				let v271 = ext[10].read(state);
+				let hidden272 = { $index: 0, $length: v271 };
+				state.hiddenstack.push(hidden272);
+				state.stack.push({});
+				let arr273 = [];
+				for (let i274 = 0; i274 < v271; i274++) {
+					hidden272.$index = i274;
+					let v275 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr273.push(v275);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.quests = arr273;
+				break;
+			}
+			case 162: {
+				let v276 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.singleuse_A2 = v276;
+				break;
+			}
+			case 163: {
+				let v277 = ext[19].read(state);
+				obj0.unknown_A3 = v277;
+				break;
+			}
+			case 164: {
+				let v278 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.singleuse_A4 = v278;
+				break;
+			}
+			case 165: {
+				let v279 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				obj0.singleuse_A5 = v279;
+				break;
+			}
+			case 166: {
+				let v280 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.singleuse_A6 = v280;
+				break;
+			}
+			case 167: {
+				let v281 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.floor_thickness = v281;
+				break;
+			}
+			case 168: {
+				obj0.unused_a8 = true;
+				break;
+			}
+			case 169: {
+				obj0.unused_a9 = true;
+				break;
+			}
+			case 170: {
+				let v282 = ext[10].read(state);
+				obj0.wallkit_related_AA = v282;
+				break;
+			}
+			case 171: {
+				let v283 = ext[10].read(state);
+				obj0.possibly_wallkit_skew_AB = v283;
+				break;
+			}
+			case 173: {
+				let obj284 = {};
+				let hidden285 = {};
+				state.stack.push(obj284);
+				state.hiddenstack.push(hidden285);
+				let v286 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v286 !== undefined) { obj284.unknown_1 = v286; }
+				let v287 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v287 !== undefined) { obj284.unknown_2 = v287; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.sound_related_AD = obj284;
+				break;
+			}
+			case 177: {
+				obj0.can_change_color = true;
+				break;
+			}
+			case 178: {
+				let v288 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.sound_related_B2 = v288;
+				break;
+			}
+			case 186: {
+				let v289 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_BA = v289;
+				break;
+			}
+			case 188: {
+				obj0.dummy_bc = true;
+				break;
+			}
+			case 189: {
+				obj0.treerockordoor_BD = true;
+				break;
+			}
+			case 190: {
+				let v290 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_0 = v290;
+				break;
+			}
+			case 191: {
+				let v291 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_1 = v291;
+				break;
+			}
+			case 192: {
+				let v292 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_2 = v292;
+				break;
+			}
+			case 193: {
+				let v293 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_3 = v293;
+				break;
+			}
+			case 194: {
+				let v294 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_4 = v294;
+				break;
+			}
+			case 195: {
+				let v295 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_5 = v295;
+				break;
+			}
+			case 196: {
+				let v296 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.tileplacement_related_c4 = v296;
+				break;
+			}
+			case 197: {
+				let v297 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.clan_citadel_C5 = v297;
+				break;
+			}
+			case 198: {
+				obj0.invisible_c6 = true;
+				break;
+			}
+			case 199: {
+				obj0.flooroverlay_c7 = true;
+				break;
+			}
+			case 200: {
+				obj0.singleuse_C8 = true;
+				break;
+			}
+			case 201: {
+				let obj298 = {};
+				let hidden299 = {};
+				state.stack.push(obj298);
+				state.hiddenstack.push(hidden299);
+				let v300 = ext[20].read(state);
+				if (v300 !== undefined) { obj298.unknown_1 = v300; }
+				let v301 = ext[20].read(state);
+				if (v301 !== undefined) { obj298.unknown_2 = v301; }
+				let v302 = ext[20].read(state);
+				if (v302 !== undefined) { obj298.unknown_3 = v302; }
+				let v303 = ext[20].read(state);
+				if (v303 !== undefined) { obj298.unknown_4 = v303; }
+				let v304 = ext[20].read(state);
+				if (v304 !== undefined) { obj298.unknown_5 = v304; }
+				let v305 = ext[20].read(state);
+				if (v305 !== undefined) { obj298.unknown_6 = v305; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_C9 = obj298;
+				break;
+			}
+			case 202: {
+				let v306 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.singleuse_CA = v306;
+				break;
+			}
+			case 203: {
+				obj0.unknown_CB = true;
+				break;
+			}
+			case 204: {
+				let v307 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden308 = { $index: 0, $length: v307 };
+				state.hiddenstack.push(hidden308);
+				state.stack.push({});
+				let arr309 = [];
+				for (let i310 = 0; i310 < v307; i310++) {
+					hidden308.$index = i310;
+					let v311 = ext[21].read(state);
+					arr309.push(v311);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unknown_CC = arr309;
+				break;
+			}
+			case 205: {
+				let obj312 = {};
+				let hidden313 = {};
+				state.stack.push(obj312);
+				state.hiddenstack.push(hidden313);
+				let v314 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v314 !== undefined) { obj312.unk0 = v314; }
+				let v315 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v315 !== undefined) { obj312.varbit = v315; }
+				let v316 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v316 !== undefined) { obj312.varp = v316; }
+				let v317 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v317 !== undefined) { hidden313.$flags = v317; }
+				let ref318 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match319 = -1;
+				if ((ref318 & 1) != 0) { match319 = 0; }
+				let v320 = null;
+				if (match319 != -1) {
+					let v321 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden322 = { $index: 0, $length: v321 };
+					state.hiddenstack.push(hidden322);
+					state.stack.push({});
+					let arr323 = [];
+					for (let i324 = 0; i324 < v321; i324++) {
+						hidden322.$index = i324;
+						let obj325 = {};
+						let hidden326 = {};
+						state.stack.push(obj325);
+						state.hiddenstack.push(hidden326);
+						let v327 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v327 !== undefined) { obj325.value = v327; }
+						let v328 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden329 = { $index: 0, $length: v328 };
+						state.hiddenstack.push(hidden329);
+						state.stack.push({});
+						let arr330 = [];
+						for (let i331 = 0; i331 < v328; i331++) {
+							hidden329.$index = i331;
+							let obj332 = {};
+							let hidden333 = {};
+							state.stack.push(obj332);
+							state.hiddenstack.push(hidden333);
+							let v334 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v334 !== undefined) { obj332.unk1 = v334; }
+							let v335 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v335 !== undefined) { obj332.unk2 = v335; }
+							let v336 = ext[2].read(state);
+							if (v336 !== undefined) { obj332.model = v336; }
+							let v337 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							if (v337 !== undefined) { obj332.extracount = v337; }
+							let ref338 = state.stack[state.stack.length - 1].extracount;
+							let match339 = -1;
+							if (ref338 >= 1) { match339 = 0; }
+							let v340 = null;
+							if (match339 != -1) {
+								let v341 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v340 = v341;
+							}
+							if (v340 !== undefined) { obj332.extra1 = v340; }
+							let ref342 = state.stack[state.stack.length - 1].extracount;
+							let match343 = -1;
+							if (ref342 >= 2) { match343 = 0; }
+							let v344 = null;
+							if (match343 != -1) {
+								let v345 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v344 = v345;
+							}
+							if (v344 !== undefined) { obj332.extra2 = v344; }
+							let ref346 = state.stack[state.stack.length - 1].extracount;
+							let match347 = -1;
+							if (ref346 >= 3) { match347 = 0; }
+							let v348 = null;
+							if (match347 != -1) {
+								let v349 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v348 = v349;
+							}
+							if (v348 !== undefined) { obj332.extra3 = v348; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr330.push(obj332);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr330 !== undefined) { obj325.models = arr330; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr323.push(obj325);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v320 = arr323;
+				}
+				if (v320 !== undefined) { obj312.multimodel = v320; }
+				let ref350 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match351 = -1;
+				if ((ref350 & 2) != 0) { match351 = 0; }
+				let v352 = null;
+				if (match351 != -1) {
+					let v353 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden354 = { $index: 0, $length: v353 };
+					state.hiddenstack.push(hidden354);
+					state.stack.push({});
+					let arr355 = [];
+					for (let i356 = 0; i356 < v353; i356++) {
+						hidden354.$index = i356;
+						let obj357 = {};
+						let hidden358 = {};
+						state.stack.push(obj357);
+						state.hiddenstack.push(hidden358);
+						let v359 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v359 !== undefined) { obj357.value = v359; }
+						let v360 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden361 = { $index: 0, $length: v360 };
+						state.hiddenstack.push(hidden361);
+						state.stack.push({});
+						let arr362 = [];
+						for (let i363 = 0; i363 < v360; i363++) {
+							hidden361.$index = i363;
+							let obj364 = {};
+							let hidden365 = {};
+							state.stack.push(obj364);
+							state.hiddenstack.push(hidden365);
+							let v366 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v366 !== undefined) { obj364.unk1 = v366; }
+							let v367 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v367 !== undefined) { obj364.unk2 = v367; }
+							let v368 = ext[2].read(state);
+							if (v368 !== undefined) { obj364.model = v368; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr362.push(obj364);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr362 !== undefined) { obj357.models = arr362; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr355.push(obj357);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v352 = arr355;
+				}
+				if (v352 !== undefined) { obj312.multiheadmodel = v352; }
+				let ref369 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match370 = -1;
+				if ((ref369 & 4) != 0) { match370 = 0; }
+				let v371 = null;
+				if (match370 != -1) {
+					let v372 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden373 = { $index: 0, $length: v372 };
+					state.hiddenstack.push(hidden373);
+					state.stack.push({});
+					let arr374 = [];
+					for (let i375 = 0; i375 < v372; i375++) {
+						hidden373.$index = i375;
+						let obj376 = {};
+						let hidden377 = {};
+						state.stack.push(obj376);
+						state.hiddenstack.push(hidden377);
+						let v378 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v378 !== undefined) { obj376.value = v378; }
+						let v379 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden380 = { $index: 0, $length: v379 };
+						state.hiddenstack.push(hidden380);
+						state.stack.push({});
+						let arr381 = [];
+						for (let i382 = 0; i382 < v379; i382++) {
+							hidden380.$index = i382;
+							let obj383 = {};
+							let hidden384 = {};
+							state.stack.push(obj383);
+							state.hiddenstack.push(hidden384);
+							let v385 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v385 !== undefined) { obj383.unk1 = v385; }
+							let v386 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v386 !== undefined) { obj383.unk2 = v386; }
+							let v387 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v387 !== undefined) { obj383.unk3 = v387; }
+							let v388 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v388 !== undefined) { obj383.unk4 = v388; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr381.push(obj383);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr381 !== undefined) { obj376.entries = arr381; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr374.push(obj376);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v371 = arr374;
+				}
+				if (v371 !== undefined) { obj312.multiretex = v371; }
+				let ref389 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match390 = -1;
+				if ((ref389 & 8) != 0) { match390 = 0; }
+				let v391 = null;
+				if (match390 != -1) {
+					let v392 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden393 = { $index: 0, $length: v392 };
+					state.hiddenstack.push(hidden393);
+					state.stack.push({});
+					let arr394 = [];
+					for (let i395 = 0; i395 < v392; i395++) {
+						hidden393.$index = i395;
+						let obj396 = {};
+						let hidden397 = {};
+						state.stack.push(obj396);
+						state.hiddenstack.push(hidden397);
+						let v398 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v398 !== undefined) { obj396.value = v398; }
+						let v399 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden400 = { $index: 0, $length: v399 };
+						state.hiddenstack.push(hidden400);
+						state.stack.push({});
+						let arr401 = [];
+						for (let i402 = 0; i402 < v399; i402++) {
+							hidden400.$index = i402;
+							let obj403 = {};
+							let hidden404 = {};
+							state.stack.push(obj403);
+							state.hiddenstack.push(hidden404);
+							let v405 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v405 !== undefined) { obj403.unk1 = v405; }
+							let v406 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v406 !== undefined) { obj403.unk2 = v406; }
+							let v407 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v407 !== undefined) { obj403.unk3 = v407; }
+							let v408 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v408 !== undefined) { obj403.unk4 = v408; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr401.push(obj403);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr401 !== undefined) { obj396.entries = arr401; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr394.push(obj396);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v391 = arr394;
+				}
+				if (v391 !== undefined) { obj312.multirecol = v391; }
+				let ref409 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match410 = -1;
+				if ((ref409 & 16) != 0) { match410 = 0; }
+				let v411 = null;
+				if (match410 != -1) {
+					let v412 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden413 = { $index: 0, $length: v412 };
+					state.hiddenstack.push(hidden413);
+					state.stack.push({});
+					let arr414 = [];
+					for (let i415 = 0; i415 < v412; i415++) {
+						hidden413.$index = i415;
+						let obj416 = {};
+						let hidden417 = {};
+						state.stack.push(obj416);
+						state.hiddenstack.push(hidden417);
+						let v418 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v418 !== undefined) { obj416.value = v418; }
+						let v419 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden420 = { $index: 0, $length: v419 };
+						state.hiddenstack.push(hidden420);
+						state.stack.push({});
+						let arr421 = [];
+						for (let i422 = 0; i422 < v419; i422++) {
+							hidden420.$index = i422;
+							let obj423 = {};
+							let hidden424 = {};
+							state.stack.push(obj423);
+							state.hiddenstack.push(hidden424);
+							let v425 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v425 !== undefined) { obj423.unk1 = v425; }
+							let v426 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v426 !== undefined) { obj423.unk2 = v426; }
+							let v427 = state.view.getUint32(state.scan);
+							state.scan += 4;
+							if (v427 !== undefined) { obj423.unk3 = v427; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr421.push(obj423);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr421 !== undefined) { obj416.entries = arr421; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr414.push(obj416);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v411 = arr414;
+				}
+				if (v411 !== undefined) { obj312.multiretint = v411; }
+				let v428 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v428 !== undefined) { obj312.default = v428; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_CD = obj312;
+				break;
+			}
+			case 206: {
+				let obj429 = {};
+				let hidden430 = {};
+				state.stack.push(obj429);
+				state.hiddenstack.push(hidden430);
+				let v431 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v431 !== undefined) { obj429.bytelength = v431; }
+				let v432 = ext[10].read(state);
+				let hidden433 = { $index: 0, $length: v432 };
+				state.hiddenstack.push(hidden433);
+				state.stack.push({});
+				let arr434 = [];
+				for (let i435 = 0; i435 < v432; i435++) {
+					hidden433.$index = i435;
+					let v436 = ext[22].read(state);
+					arr434.push(v436);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr434 !== undefined) { obj429.elements = arr434; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_CE = obj429;
+				break;
+			}
+			case 249: {
+				let v437 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden438 = { $index: 0, $length: v437 };
+				state.hiddenstack.push(hidden438);
+				state.stack.push({});
+				let arr439 = [];
+				for (let i440 = 0; i440 < v437; i440++) {
+					hidden438.$index = i440;
+					let obj441 = {};
+					let hidden442 = {};
+					state.stack.push(obj441);
+					state.hiddenstack.push(hidden442);
+					let v443 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v443 !== undefined) { hidden442.$type = v443; }
+					let v444 = ext[23].read(state);
+					if (v444 !== undefined) { obj441.prop = v444; }
+					let ref445 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match446 = -1;
+					if (ref445 == 0) { match446 = 0; }
+					let v447 = null;
+					if (match446 != -1) {
+						let v448 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v447 = v448;
+					}
+					if (v447 !== undefined) { obj441.intvalue = v447; }
+					let ref449 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match450 = -1;
+					if (ref449 == 1) { match450 = 0; }
+					let v451 = null;
+					if (match450 != -1) {
+						let v452 = ext[4].read(state);
+						v451 = v452;
+					}
+					if (v451 !== undefined) { obj441.stringvalue = v451; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr439.push(obj441);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr439;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key453 in value) {
+		if (key453.startsWith("$")) { continue; }
+		switch (key453) {
+			case "models": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w454 = value[key453];
+				let hidden455 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden455);
+				hidden455.$opcode = ext[0].readConst(state);
+				let ref456 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match457 = -1;
+				if (ref456 >= 582) { match457 = 0; }
+				else if (true) { match457 = 1; }
+				if (match457 == -1) { throw new Error("no opcode matched"); }
+				if (match457 == 0) {
+					if (!Array.isArray(w454)) { throw new Error("array expected"); }
+					let w458 = w454.length;
+					if (typeof w458 != "number" || w458 > 255 || w458 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w458, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w454.length });
+					for (let i459 = 0; i459 < w454.length; i459++) {
+						let w460 = w454[i459];
+						if (typeof w460 != "object" || !w460) { throw new Error("object expected"); }
+						let hidden461 = {};
+						state.stack.push(w460);
+						state.hiddenstack.push(hidden461);
+						let w462 = w460.type;
+						if (typeof w462 != "number" || w462 > 255 || w462 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w462, state.scan);
+						state.scan += 1;
+						let w463 = w460.values;
+						if (!Array.isArray(w463)) { throw new Error("array expected"); }
+						let w464 = w463.length;
+						if (typeof w464 != "number" || w464 > 255 || w464 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w464, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w463.length });
+						for (let i465 = 0; i465 < w463.length; i465++) {
+							let w466 = w463[i465];
+							let hidden467 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden467);
+							hidden467.$opcode = ext[1].readConst(state);
+							let ref468 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match469 = -1;
+							if (ref468 >= 670) { match469 = 0; }
+							else if (ref468 >= 0) { match469 = 1; }
+							if (match469 == -1) { throw new Error("no opcode matched"); }
+							if (match469 == 0) {
+								ext[2].write(state, w466);
+							}
+							else if (match469 == 1) {
+								if (typeof w466 != "number" || w466 > 65535 || w466 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w466, state.scan);
+								state.scan += 2;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				else if (match457 == 1) {
+					if (!Array.isArray(w454)) { throw new Error("array expected"); }
+					let w470 = w454.length;
+					if (typeof w470 != "number" || w470 > 255 || w470 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w470, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w454.length });
+					for (let i471 = 0; i471 < w454.length; i471++) {
+						let w472 = w454[i471];
+						if (typeof w472 != "object" || !w472) { throw new Error("object expected"); }
+						let hidden473 = {};
+						state.stack.push(w472);
+						state.hiddenstack.push(hidden473);
+						let w474 = w472.values;
+						if (!Array.isArray(w474)) { throw new Error("array expected"); }
+						let w475 = w474.length;
+						if (w475 != 1) { throw new Error("expected constant 1 was not present during write"); }
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w474.length });
+						for (let i476 = 0; i476 < w474.length; i476++) {
+							let w477 = w474[i476];
+							let hidden478 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden478);
+							hidden478.$opcode = ext[3].readConst(state);
+							let ref479 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match480 = -1;
+							if (ref479 >= 670) { match480 = 0; }
+							else if (ref479 >= 0) { match480 = 1; }
+							if (match480 == -1) { throw new Error("no opcode matched"); }
+							if (match480 == 0) {
+								ext[2].write(state, w477);
+							}
+							else if (match480 == 1) {
+								if (typeof w477 != "number" || w477 > 65535 || w477 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w477, state.scan);
+								state.scan += 2;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						let w481 = w472.type;
+						if (typeof w481 != "number" || w481 > 255 || w481 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w481, state.scan);
+						state.scan += 1;
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "name": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w482 = value[key453];
+				ext[4].write(state, w482);
+				break;
+			}
+			case "examine": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w483 = value[key453];
+				ext[4].write(state, w483);
+				break;
+			}
+			case "models_05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w484 = value[key453];
+				let hidden485 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden485);
+				hidden485.$opcode = ext[5].readConst(state);
+				let ref486 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match487 = -1;
+				if (ref486 >= 582) { match487 = 0; }
+				else if (true) { match487 = 1; }
+				if (match487 == -1) { throw new Error("no opcode matched"); }
+				if (match487 == 0) {
+					if (typeof w484 != "object" || !w484) { throw new Error("object expected"); }
+					let hidden488 = {};
+					state.stack.push(w484);
+					state.hiddenstack.push(hidden488);
+					let w489 = w484.models;
+					if (!Array.isArray(w489)) { throw new Error("array expected"); }
+					let w490 = w489.length;
+					if (typeof w490 != "number" || w490 > 255 || w490 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w490, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w489.length });
+					for (let i491 = 0; i491 < w489.length; i491++) {
+						let w492 = w489[i491];
+						if (typeof w492 != "object" || !w492) { throw new Error("object expected"); }
+						let hidden493 = {};
+						state.stack.push(w492);
+						state.hiddenstack.push(hidden493);
+						let w494 = w492.type;
+						if (typeof w494 != "number" || w494 > 255 || w494 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w494, state.scan);
+						state.scan += 1;
+						let w495 = w492.values;
+						if (!Array.isArray(w495)) { throw new Error("array expected"); }
+						let w496 = w495.length;
+						if (typeof w496 != "number" || w496 > 255 || w496 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w496, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w495.length });
+						for (let i497 = 0; i497 < w495.length; i497++) {
+							let w498 = w495[i497];
+							let hidden499 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden499);
+							hidden499.$opcode = ext[6].readConst(state);
+							let ref500 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match501 = -1;
+							if (ref500 >= 670) { match501 = 0; }
+							else if (ref500 >= 0) { match501 = 1; }
+							if (match501 == -1) { throw new Error("no opcode matched"); }
+							if (match501 == 0) {
+								ext[2].write(state, w498);
+							}
+							else if (match501 == 1) {
+								if (typeof w498 != "number" || w498 > 65535 || w498 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w498, state.scan);
+								state.scan += 2;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					let w502 = w484.unktail;
+					if (!Array.isArray(w502)) { throw new Error("array expected"); }
+					let w503 = w502.length;
+					if (typeof w503 != "number" || w503 > 255 || w503 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w503, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w502.length });
+					for (let i504 = 0; i504 < w502.length; i504++) {
+						let w505 = w502[i504];
+						if (!Array.isArray(w505)) { throw new Error("array expected"); }
+						let w506 = w505.length;
+						if (w506 != 2) { throw new Error("expected constant 2 was not present during write"); }
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w505.length });
+						for (let i507 = 0; i507 < w505.length; i507++) {
+							let w508 = w505[i507];
+							let hidden509 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden509);
+							hidden509.$opcode = ext[7].readConst(state);
+							let ref510 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match511 = -1;
+							if (ref510 >= 670) { match511 = 0; }
+							else if (ref510 >= 0) { match511 = 1; }
+							if (match511 == -1) { throw new Error("no opcode matched"); }
+							if (match511 == 0) {
+								ext[2].write(state, w508);
+							}
+							else if (match511 == 1) {
+								if (typeof w508 != "number" || w508 > 65535 || w508 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w508, state.scan);
+								state.scan += 2;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				else if (match487 == 1) {
+					if (typeof w484 != "object" || !w484) { throw new Error("object expected"); }
+					let hidden512 = {};
+					state.stack.push(w484);
+					state.hiddenstack.push(hidden512);
+					let w513 = w484.models;
+					if (!Array.isArray(w513)) { throw new Error("array expected"); }
+					let w514 = w513.length;
+					if (w514 != 1) { throw new Error("expected constant 1 was not present during write"); }
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w513.length });
+					for (let i515 = 0; i515 < w513.length; i515++) {
+						let w516 = w513[i515];
+						if (typeof w516 != "object" || !w516) { throw new Error("object expected"); }
+						let hidden517 = {};
+						state.stack.push(w516);
+						state.hiddenstack.push(hidden517);
+						let w518 = w516.type;
+						if (w518 != 10) { throw new Error("expected constant 10 was not present during write"); }
+						let w519 = w516.values;
+						if (!Array.isArray(w519)) { throw new Error("array expected"); }
+						let w520 = w519.length;
+						if (typeof w520 != "number" || w520 > 255 || w520 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w520, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w519.length });
+						for (let i521 = 0; i521 < w519.length; i521++) {
+							let w522 = w519[i521];
+							let hidden523 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden523);
+							hidden523.$opcode = ext[8].readConst(state);
+							let ref524 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match525 = -1;
+							if (ref524 >= 670) { match525 = 0; }
+							else if (ref524 >= 0) { match525 = 1; }
+							if (match525 == -1) { throw new Error("no opcode matched"); }
+							if (match525 == 0) {
+								ext[2].write(state, w522);
+							}
+							else if (match525 == 1) {
+								if (typeof w522 != "number" || w522 > 65535 || w522 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w522, state.scan);
+								state.scan += 2;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						let w526 = w516.unktail;
+						if (!Array.isArray(w526)) { throw new Error("array expected"); }
+						let w527 = w526.length;
+						if (w527 != 0) { throw new Error("expected constant 0 was not present during write"); }
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w526.length });
+						for (let i528 = 0; i528 < w526.length; i528++) {
+							let w529 = w526[i528];
+							if (!Array.isArray(w529)) { throw new Error("array expected"); }
+							let w530 = w529.length;
+							if (w530 != 2) { throw new Error("expected constant 2 was not present during write"); }
+							state.stack.push({});
+							state.hiddenstack.push({ $index: 0, $length: w529.length });
+							for (let i531 = 0; i531 < w529.length; i531++) {
+								let w532 = w529[i531];
+								let hidden533 = { $opcode: 0 };
+								state.stack.push({});
+								state.hiddenstack.push(hidden533);
+								hidden533.$opcode = ext[9].readConst(state);
+								let ref534 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+								let match535 = -1;
+								if (ref534 >= 670) { match535 = 0; }
+								else if (ref534 >= 0) { match535 = 1; }
+								if (match535 == -1) { throw new Error("no opcode matched"); }
+								if (match535 == 0) {
+									ext[2].write(state, w532);
+								}
+								else if (match535 == 1) {
+									if (typeof w532 != "number" || w532 > 65535 || w532 < 0) { throw new Error(); }
+									state.buffer.writeUInt16BE(w532, state.scan);
+									state.scan += 2;
+								}
+								state.stack.pop();
+								state.hiddenstack.pop();
+							}
+							state.hiddenstack.pop();
+							state.stack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "width": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w536 = value[key453];
+				if (typeof w536 != "number" || w536 > 255 || w536 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w536, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "length": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w537 = value[key453];
+				if (typeof w537 != "number" || w537 > 255 || w537 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w537, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "walkable": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w538 = value[key453];
+				if (w538 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "allows_lineofsight": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w539 = value[key453];
+				if (w539 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "deletable": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w540 = value[key453];
+				if (typeof w540 != "boolean") { throw new Error("boolean expected"); }
+				state.buffer.writeUInt8(+w540, state.scan++);
+				break;
+			}
+			case "morphFloor": {
+				if (typeof 21 != "number" || 21 > 255 || 21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(21, state.scan);
+				state.scan += 1;
+				let w541 = value[key453];
+				if (w541 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_16": {
+				if (typeof 22 != "number" || 22 > 255 || 22 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(22, state.scan);
+				state.scan += 1;
+				let w542 = value[key453];
+				if (w542 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "occludes_1": {
+				if (typeof 23 != "number" || 23 > 255 || 23 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(23, state.scan);
+				state.scan += 1;
+				let w543 = value[key453];
+				if (w543 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "animation": {
+				if (typeof 24 != "number" || 24 > 255 || 24 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(24, state.scan);
+				state.scan += 1;
+				let w544 = value[key453];
+				ext[2].write(state, w544);
+				break;
+			}
+			case "blocks_movement": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w545 = value[key453];
+				if (w545 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "wallkit_related_1C": {
+				if (typeof 28 != "number" || 28 > 255 || 28 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(28, state.scan);
+				state.scan += 1;
+				let w546 = value[key453];
+				if (typeof w546 != "number" || w546 > 255 || w546 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w546, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "ambient": {
+				if (typeof 29 != "number" || 29 > 255 || 29 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(29, state.scan);
+				state.scan += 1;
+				let w547 = value[key453];
+				if (typeof w547 != "number" || w547 > 255 || w547 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w547, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "actions_0": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w548 = value[key453];
+				ext[4].write(state, w548);
+				break;
+			}
+			case "actions_1": {
+				if (typeof 31 != "number" || 31 > 255 || 31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(31, state.scan);
+				state.scan += 1;
+				let w549 = value[key453];
+				ext[4].write(state, w549);
+				break;
+			}
+			case "actions_2": {
+				if (typeof 32 != "number" || 32 > 255 || 32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(32, state.scan);
+				state.scan += 1;
+				let w550 = value[key453];
+				ext[4].write(state, w550);
+				break;
+			}
+			case "actions_3": {
+				if (typeof 33 != "number" || 33 > 255 || 33 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(33, state.scan);
+				state.scan += 1;
+				let w551 = value[key453];
+				ext[4].write(state, w551);
+				break;
+			}
+			case "actions_4": {
+				if (typeof 34 != "number" || 34 > 255 || 34 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(34, state.scan);
+				state.scan += 1;
+				let w552 = value[key453];
+				ext[4].write(state, w552);
+				break;
+			}
+			case "contrast": {
+				if (typeof 39 != "number" || 39 > 255 || 39 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(39, state.scan);
+				state.scan += 1;
+				let w553 = value[key453];
+				if (typeof w553 != "number" || w553 > 127 || w553 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w553, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "color_replacements": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w554 = value[key453];
+				if (!Array.isArray(w554)) { throw new Error("array expected"); }
+				let w555 = w554.length;
+				ext[10].write(state, w555);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w554.length });
+				for (let i556 = 0; i556 < w554.length; i556++) {
+					let w557 = w554[i556];
+					if (!Array.isArray(w557)) { throw new Error("array expected"); }
+					let w558 = w557[0];
+					if (typeof w558 != "number" || w558 > 65535 || w558 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w558, state.scan);
+					state.scan += 2;
+					let w559 = w557[1];
+					if (typeof w559 != "number" || w559 > 65535 || w559 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w559, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "material_replacements": {
+				if (typeof 41 != "number" || 41 > 255 || 41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(41, state.scan);
+				state.scan += 1;
+				let w560 = value[key453];
+				if (!Array.isArray(w560)) { throw new Error("array expected"); }
+				let w561 = w560.length;
+				ext[10].write(state, w561);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w560.length });
+				for (let i562 = 0; i562 < w560.length; i562++) {
+					let w563 = w560[i562];
+					if (!Array.isArray(w563)) { throw new Error("array expected"); }
+					let w564 = w563[0];
+					if (typeof w564 != "number" || w564 > 65535 || w564 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w564, state.scan);
+					state.scan += 2;
+					let w565 = w563[1];
+					if (typeof w565 != "number" || w565 > 65535 || w565 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w565, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "recolourPalette": {
+				if (typeof 42 != "number" || 42 > 255 || 42 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(42, state.scan);
+				state.scan += 1;
+				let w566 = value[key453];
+				if (!Array.isArray(w566)) { throw new Error("array expected"); }
+				let w567 = w566.length;
+				ext[10].write(state, w567);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w566.length });
+				for (let i568 = 0; i568 < w566.length; i568++) {
+					let w569 = w566[i568];
+					if (typeof w569 != "number" || w569 > 127 || w569 < -128) { throw new Error(); }
+					state.buffer.writeInt8(w569, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_2C": {
+				if (typeof 44 != "number" || 44 > 255 || 44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(44, state.scan);
+				state.scan += 1;
+				let w570 = value[key453];
+				if (typeof w570 != "number" || w570 > 65535 || w570 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w570, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_2D": {
+				if (typeof 45 != "number" || 45 > 255 || 45 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(45, state.scan);
+				state.scan += 1;
+				let w571 = value[key453];
+				if (typeof w571 != "number" || w571 > 65535 || w571 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w571, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_36": {
+				if (typeof 54 != "number" || 54 > 255 || 54 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(54, state.scan);
+				state.scan += 1;
+				let w572 = value[key453];
+				if (w572 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_37": {
+				if (typeof 55 != "number" || 55 > 255 || 55 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(55, state.scan);
+				state.scan += 1;
+				let w573 = value[key453];
+				if (w573 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_38": {
+				if (typeof 56 != "number" || 56 > 255 || 56 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(56, state.scan);
+				state.scan += 1;
+				let w574 = value[key453];
+				if (w574 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_39": {
+				if (typeof 57 != "number" || 57 > 255 || 57 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(57, state.scan);
+				state.scan += 1;
+				let w575 = value[key453];
+				if (w575 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_3c": {
+				if (typeof 60 != "number" || 60 > 255 || 60 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(60, state.scan);
+				state.scan += 1;
+				let w576 = value[key453];
+				if (typeof w576 != "number" || w576 > 65535 || w576 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w576, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "mirror": {
+				if (typeof 62 != "number" || 62 > 255 || 62 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(62, state.scan);
+				state.scan += 1;
+				let w577 = value[key453];
+				if (w577 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_40": {
+				if (typeof 64 != "number" || 64 > 255 || 64 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(64, state.scan);
+				state.scan += 1;
+				let w578 = value[key453];
+				if (w578 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "scaleX": {
+				if (typeof 65 != "number" || 65 > 255 || 65 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(65, state.scan);
+				state.scan += 1;
+				let w579 = value[key453];
+				if (typeof w579 != "number" || w579 > 32767 || w579 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w579, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scaleY": {
+				if (typeof 66 != "number" || 66 > 255 || 66 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(66, state.scan);
+				state.scan += 1;
+				let w580 = value[key453];
+				if (typeof w580 != "number" || w580 > 32767 || w580 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w580, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scaleZ": {
+				if (typeof 67 != "number" || 67 > 255 || 67 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(67, state.scan);
+				state.scan += 1;
+				let w581 = value[key453];
+				if (typeof w581 != "number" || w581 > 32767 || w581 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w581, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "mapscene_old": {
+				if (typeof 68 != "number" || 68 > 255 || 68 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(68, state.scan);
+				state.scan += 1;
+				let w582 = value[key453];
+				if (typeof w582 != "number" || w582 > 65535 || w582 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w582, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "dummy_45": {
+				if (typeof 69 != "number" || 69 > 255 || 69 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(69, state.scan);
+				state.scan += 1;
+				let w583 = value[key453];
+				if (typeof w583 != "number" || w583 > 255 || w583 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w583, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "translateX": {
+				if (typeof 70 != "number" || 70 > 255 || 70 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(70, state.scan);
+				state.scan += 1;
+				let w584 = value[key453];
+				if (typeof w584 != "number" || w584 > 32767 || w584 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w584, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "translateY": {
+				if (typeof 71 != "number" || 71 > 255 || 71 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(71, state.scan);
+				state.scan += 1;
+				let w585 = value[key453];
+				if (typeof w585 != "number" || w585 > 32767 || w585 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w585, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "translateZ": {
+				if (typeof 72 != "number" || 72 > 255 || 72 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(72, state.scan);
+				state.scan += 1;
+				let w586 = value[key453];
+				if (typeof w586 != "number" || w586 > 32767 || w586 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w586, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_49": {
+				if (typeof 73 != "number" || 73 > 255 || 73 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(73, state.scan);
+				state.scan += 1;
+				let w587 = value[key453];
+				if (w587 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_4A": {
+				if (typeof 74 != "number" || 74 > 255 || 74 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(74, state.scan);
+				state.scan += 1;
+				let w588 = value[key453];
+				if (w588 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_4B": {
+				if (typeof 75 != "number" || 75 > 255 || 75 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(75, state.scan);
+				state.scan += 1;
+				let w589 = value[key453];
+				if (typeof w589 != "boolean") { throw new Error("boolean expected"); }
+				state.buffer.writeUInt8(+w589, state.scan++);
+				break;
+			}
+			case "morphs_1": {
+				if (typeof 77 != "number" || 77 > 255 || 77 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(77, state.scan);
+				state.scan += 1;
+				let w590 = value[key453];
+				if (typeof w590 != "object" || !w590) { throw new Error("object expected"); }
+				let hidden591 = {};
+				state.stack.push(w590);
+				state.hiddenstack.push(hidden591);
+				let w592 = w590.varbit;
+				if (typeof w592 != "number" || w592 > 65535 || w592 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w592, state.scan);
+				state.scan += 2;
+				let w593 = w590.varp;
+				if (typeof w593 != "number" || w593 > 65535 || w593 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w593, state.scan);
+				state.scan += 2;
+				let w594 = w590.options;
+				if (!Array.isArray(w594)) { throw new Error("array expected"); }
+				let w595 = w594.length;
+				let hidden596 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden596);
+				hidden596.$opcode = ext[11].readConst(state);
+				let ref597 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match598 = -1;
+				if (ref597 >= 910) { match598 = 0; }
+				else if (ref597 >= 0) { match598 = 1; }
+				if (match598 == -1) { throw new Error("no opcode matched"); }
+				if (match598 == 0) {
+					ext[10].write(state, w595);
+				}
+				else if (match598 == 1) {
+					if (typeof w595 != "number" || w595 > 255 || w595 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w595, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w594.length });
+				for (let i599 = 0; i599 < w594.length; i599++) {
+					let w600 = w594[i599];
+					let hidden601 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden601);
+					hidden601.$opcode = ext[12].readConst(state);
+					let ref602 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match603 = -1;
+					if (ref602 >= 670) { match603 = 0; }
+					else if (ref602 >= 0) { match603 = 1; }
+					if (match603 == -1) { throw new Error("no opcode matched"); }
+					if (match603 == 0) {
+						ext[2].write(state, w600);
+					}
+					else if (match603 == 1) {
+						if (typeof w600 != "number" || w600 > 65535 || w600 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w600, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w604 = w590.default;
+				let hidden605 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden605);
+				hidden605.$opcode = ext[13].readConst(state);
+				let ref606 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match607 = -1;
+				if (ref606 >= 670) { match607 = 0; }
+				else if (ref606 >= 0) { match607 = 1; }
+				if (match607 == -1) { throw new Error("no opcode matched"); }
+				if (match607 == 0) {
+					ext[2].write(state, w604);
+				}
+				else if (match607 == 1) {
+					if (typeof w604 != "number" || w604 > 65535 || w604 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w604, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "sound": {
+				if (typeof 78 != "number" || 78 > 255 || 78 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(78, state.scan);
+				state.scan += 1;
+				let w608 = value[key453];
+				if (typeof w608 != "object" || !w608) { throw new Error("object expected"); }
+				let hidden609 = {};
+				state.stack.push(w608);
+				state.hiddenstack.push(hidden609);
+				let w610 = w608.sound;
+				if (typeof w610 != "number" || w610 > 65535 || w610 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w610, state.scan);
+				state.scan += 2;
+				let w611 = w608.unk;
+				if (typeof w611 != "number" || w611 > 255 || w611 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w611, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "background_sounds": {
+				if (typeof 79 != "number" || 79 > 255 || 79 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(79, state.scan);
+				state.scan += 1;
+				let w612 = value[key453];
+				if (typeof w612 != "object" || !w612) { throw new Error("object expected"); }
+				let hidden613 = {};
+				state.stack.push(w612);
+				state.hiddenstack.push(hidden613);
+				let w614 = w612.unknown_1;
+				if (typeof w614 != "number" || w614 > 65535 || w614 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w614, state.scan);
+				state.scan += 2;
+				let w615 = w612.unknown_2;
+				if (typeof w615 != "number" || w615 > 65535 || w615 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w615, state.scan);
+				state.scan += 2;
+				let w616 = w612.unknown_3;
+				if (typeof w616 != "number" || w616 > 255 || w616 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w616, state.scan);
+				state.scan += 1;
+				let w617 = w612.sounds;
+				if (!Array.isArray(w617)) { throw new Error("array expected"); }
+				let w618 = w617.length;
+				ext[10].write(state, w618);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w617.length });
+				for (let i619 = 0; i619 < w617.length; i619++) {
+					let w620 = w617[i619];
+					if (typeof w620 != "number" || w620 > 65535 || w620 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w620, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_51": {
+				if (typeof 81 != "number" || 81 > 255 || 81 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(81, state.scan);
+				state.scan += 1;
+				let w621 = value[key453];
+				if (typeof w621 != "number" || w621 > 255 || w621 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w621, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_52": {
+				if (typeof 82 != "number" || 82 > 255 || 82 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(82, state.scan);
+				state.scan += 1;
+				let w622 = value[key453];
+				if (w622 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "is_members": {
+				if (typeof 88 != "number" || 88 > 255 || 88 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(88, state.scan);
+				state.scan += 1;
+				let w623 = value[key453];
+				if (w623 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_59": {
+				if (typeof 89 != "number" || 89 > 255 || 89 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(89, state.scan);
+				state.scan += 1;
+				let w624 = value[key453];
+				if (w624 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_5A": {
+				if (typeof 90 != "number" || 90 > 255 || 90 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(90, state.scan);
+				state.scan += 1;
+				let w625 = value[key453];
+				if (w625 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "isMembers": {
+				if (typeof 91 != "number" || 91 > 255 || 91 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(91, state.scan);
+				state.scan += 1;
+				let w626 = value[key453];
+				if (w626 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "morphs_2": {
+				if (typeof 92 != "number" || 92 > 255 || 92 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(92, state.scan);
+				state.scan += 1;
+				let w627 = value[key453];
+				if (typeof w627 != "object" || !w627) { throw new Error("object expected"); }
+				let hidden628 = {};
+				state.stack.push(w627);
+				state.hiddenstack.push(hidden628);
+				let w629 = w627.varbit;
+				if (typeof w629 != "number" || w629 > 65535 || w629 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w629, state.scan);
+				state.scan += 2;
+				let w630 = w627.varp;
+				if (typeof w630 != "number" || w630 > 65535 || w630 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w630, state.scan);
+				state.scan += 2;
+				let w631 = w627.unk2;
+				let hidden632 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden632);
+				hidden632.$opcode = ext[14].readConst(state);
+				let ref633 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match634 = -1;
+				if (ref633 >= 670) { match634 = 0; }
+				else if (ref633 >= 0) { match634 = 1; }
+				if (match634 == -1) { throw new Error("no opcode matched"); }
+				if (match634 == 0) {
+					ext[2].write(state, w631);
+				}
+				else if (match634 == 1) {
+					if (typeof w631 != "number" || w631 > 65535 || w631 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w631, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let w635 = w627.options;
+				if (!Array.isArray(w635)) { throw new Error("array expected"); }
+				let w636 = w635.length;
+				let hidden637 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden637);
+				hidden637.$opcode = ext[15].readConst(state);
+				let ref638 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match639 = -1;
+				if (ref638 >= 910) { match639 = 0; }
+				else if (ref638 >= 0) { match639 = 1; }
+				if (match639 == -1) { throw new Error("no opcode matched"); }
+				if (match639 == 0) {
+					ext[10].write(state, w636);
+				}
+				else if (match639 == 1) {
+					if (typeof w636 != "number" || w636 > 255 || w636 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w636, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w635.length });
+				for (let i640 = 0; i640 < w635.length; i640++) {
+					let w641 = w635[i640];
+					let hidden642 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden642);
+					hidden642.$opcode = ext[16].readConst(state);
+					let ref643 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match644 = -1;
+					if (ref643 >= 670) { match644 = 0; }
+					else if (ref643 >= 0) { match644 = 1; }
+					if (match644 == -1) { throw new Error("no opcode matched"); }
+					if (match644 == 0) {
+						ext[2].write(state, w641);
+					}
+					else if (match644 == 1) {
+						if (typeof w641 != "number" || w641 > 65535 || w641 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w641, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w645 = w627.default;
+				let hidden646 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden646);
+				hidden646.$opcode = ext[17].readConst(state);
+				let ref647 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match648 = -1;
+				if (ref647 >= 670) { match648 = 0; }
+				else if (ref647 >= 0) { match648 = 1; }
+				if (match648 == -1) { throw new Error("no opcode matched"); }
+				if (match648 == 0) {
+					ext[2].write(state, w645);
+				}
+				else if (match648 == 1) {
+					if (typeof w645 != "number" || w645 > 65535 || w645 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w645, state.scan);
+					state.scan += 2;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "tilt_xz": {
+				if (typeof 93 != "number" || 93 > 255 || 93 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(93, state.scan);
+				state.scan += 1;
+				let w649 = value[key453];
+				if (!Array.isArray(w649)) { throw new Error("array expected"); }
+				let w650 = w649[0];
+				if (typeof w650 != "number" || w650 > 127 || w650 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w650, state.scan);
+				state.scan += 1;
+				let w651 = w649[1];
+				if (typeof w651 != "number" || w651 > 127 || w651 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w651, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "under_water": {
+				if (typeof 94 != "number" || 94 > 255 || 94 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(94, state.scan);
+				state.scan += 1;
+				let w652 = value[key453];
+				if (w652 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "morphCeilingOffset": {
+				if (typeof 95 != "number" || 95 > 255 || 95 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(95, state.scan);
+				state.scan += 1;
+				let w653 = value[key453];
+				let hidden654 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden654);
+				hidden654.$opcode = ext[18].readConst(state);
+				let ref655 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match656 = -1;
+				if (ref655 >= 596) { match656 = 0; }
+				else if (true) { match656 = 1; }
+				if (match656 == -1) { throw new Error("no opcode matched"); }
+				if (match656 == 0) {
+					if (typeof w653 != "number" || w653 > 32767 || w653 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w653, state.scan);
+					state.scan += 2;
+				}
+				else if (match656 == 1) {
+					if (w653 != 0) { throw new Error("expected constant 0 was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_60": {
+				if (typeof 96 != "number" || 96 > 255 || 96 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(96, state.scan);
+				state.scan += 1;
+				let w657 = value[key453];
+				if (w657 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "ground_decoration_related_61": {
+				if (typeof 97 != "number" || 97 > 255 || 97 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(97, state.scan);
+				state.scan += 1;
+				let w658 = value[key453];
+				if (w658 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "has_animated_texture": {
+				if (typeof 98 != "number" || 98 > 255 || 98 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(98, state.scan);
+				state.scan += 1;
+				let w659 = value[key453];
+				if (w659 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "dummy_63": {
+				if (typeof 99 != "number" || 99 > 255 || 99 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(99, state.scan);
+				state.scan += 1;
+				let w660 = value[key453];
+				if (typeof w660 != "object" || !w660) { throw new Error("object expected"); }
+				let hidden661 = {};
+				state.stack.push(w660);
+				state.hiddenstack.push(hidden661);
+				let w662 = w660.unknown_2;
+				if (typeof w662 != "number" || w662 > 255 || w662 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w662, state.scan);
+				state.scan += 1;
+				let w663 = w660.unknown_1;
+				if (typeof w663 != "number" || w663 > 65535 || w663 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w663, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "dummy_64": {
+				if (typeof 100 != "number" || 100 > 255 || 100 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(100, state.scan);
+				state.scan += 1;
+				let w664 = value[key453];
+				if (typeof w664 != "object" || !w664) { throw new Error("object expected"); }
+				let hidden665 = {};
+				state.stack.push(w664);
+				state.hiddenstack.push(hidden665);
+				let w666 = w664.unknown_2;
+				if (typeof w666 != "number" || w666 > 255 || w666 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w666, state.scan);
+				state.scan += 1;
+				let w667 = w664.unknown_1;
+				if (typeof w667 != "number" || w667 > 65535 || w667 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w667, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unused_65": {
+				if (typeof 101 != "number" || 101 > 255 || 101 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(101, state.scan);
+				state.scan += 1;
+				let w668 = value[key453];
+				if (typeof w668 != "number" || w668 > 255 || w668 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w668, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "mapscene": {
+				if (typeof 102 != "number" || 102 > 255 || 102 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(102, state.scan);
+				state.scan += 1;
+				let w669 = value[key453];
+				if (typeof w669 != "number" || w669 > 65535 || w669 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w669, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "occludes_2": {
+				if (typeof 103 != "number" || 103 > 255 || 103 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(103, state.scan);
+				state.scan += 1;
+				let w670 = value[key453];
+				if (w670 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "interactable_related_68": {
+				if (typeof 104 != "number" || 104 > 255 || 104 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(104, state.scan);
+				state.scan += 1;
+				let w671 = value[key453];
+				if (typeof w671 != "number" || w671 > 255 || w671 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w671, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "invertMapScene": {
+				if (typeof 105 != "number" || 105 > 255 || 105 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(105, state.scan);
+				state.scan += 1;
+				let w672 = value[key453];
+				if (w672 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "animVariations": {
+				if (typeof 106 != "number" || 106 > 255 || 106 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(106, state.scan);
+				state.scan += 1;
+				let w673 = value[key453];
+				if (!Array.isArray(w673)) { throw new Error("array expected"); }
+				let w674 = w673.length;
+				ext[10].write(state, w674);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w673.length });
+				for (let i675 = 0; i675 < w673.length; i675++) {
+					let w676 = w673[i675];
+					if (typeof w676 != "object" || !w676) { throw new Error("object expected"); }
+					let hidden677 = {};
+					state.stack.push(w676);
+					state.hiddenstack.push(hidden677);
+					let w678 = w676.animid;
+					ext[2].write(state, w678);
+					let w679 = w676.weight;
+					if (typeof w679 != "number" || w679 > 255 || w679 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w679, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "maplabel": {
+				if (typeof 107 != "number" || 107 > 255 || 107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(107, state.scan);
+				state.scan += 1;
+				let w680 = value[key453];
+				if (typeof w680 != "number" || w680 > 65535 || w680 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w680, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_6C": {
+				if (typeof 108 != "number" || 108 > 255 || 108 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(108, state.scan);
+				state.scan += 1;
+				let w681 = value[key453];
+				if (w681 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_6D": {
+				if (typeof 109 != "number" || 109 > 255 || 109 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(109, state.scan);
+				state.scan += 1;
+				let w682 = value[key453];
+				if (w682 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_6E": {
+				if (typeof 110 != "number" || 110 > 255 || 110 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(110, state.scan);
+				state.scan += 1;
+				let w683 = value[key453];
+				if (w683 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_71": {
+				if (typeof 113 != "number" || 113 > 255 || 113 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(113, state.scan);
+				state.scan += 1;
+				let w684 = value[key453];
+				if (typeof w684 != "number" || w684 > 255 || w684 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w684, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "members_action_1": {
+				if (typeof 150 != "number" || 150 > 255 || 150 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(150, state.scan);
+				state.scan += 1;
+				let w685 = value[key453];
+				ext[4].write(state, w685);
+				break;
+			}
+			case "members_action_2": {
+				if (typeof 151 != "number" || 151 > 255 || 151 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(151, state.scan);
+				state.scan += 1;
+				let w686 = value[key453];
+				ext[4].write(state, w686);
+				break;
+			}
+			case "members_action_3": {
+				if (typeof 152 != "number" || 152 > 255 || 152 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(152, state.scan);
+				state.scan += 1;
+				let w687 = value[key453];
+				ext[4].write(state, w687);
+				break;
+			}
+			case "members_action_4": {
+				if (typeof 153 != "number" || 153 > 255 || 153 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(153, state.scan);
+				state.scan += 1;
+				let w688 = value[key453];
+				ext[4].write(state, w688);
+				break;
+			}
+			case "members_action_5": {
+				if (typeof 154 != "number" || 154 > 255 || 154 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(154, state.scan);
+				state.scan += 1;
+				let w689 = value[key453];
+				ext[4].write(state, w689);
+				break;
+			}
+			case "quests": {
+				if (typeof 160 != "number" || 160 > 255 || 160 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(160, state.scan);
+				state.scan += 1;
+				let w690 = value[key453];
+				if (!Array.isArray(w690)) { throw new Error("array expected"); }
+				let w691 = w690.length;
+				ext[10].write(state, w691);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w690.length });
+				for (let i692 = 0; i692 < w690.length; i692++) {
+					let w693 = w690[i692];
+					if (typeof w693 != "number" || w693 > 65535 || w693 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w693, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "singleuse_A2": {
+				if (typeof 162 != "number" || 162 > 255 || 162 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(162, state.scan);
+				state.scan += 1;
+				let w694 = value[key453];
+				if (typeof w694 != "number" || w694 > 2147483647 || w694 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w694, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "unknown_A3": {
+				if (typeof 163 != "number" || 163 > 255 || 163 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(163, state.scan);
+				state.scan += 1;
+				let w695 = value[key453];
+				ext[19].write(state, w695);
+				break;
+			}
+			case "singleuse_A4": {
+				if (typeof 164 != "number" || 164 > 255 || 164 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(164, state.scan);
+				state.scan += 1;
+				let w696 = value[key453];
+				if (typeof w696 != "number" || w696 > 32767 || w696 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w696, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "singleuse_A5": {
+				if (typeof 165 != "number" || 165 > 255 || 165 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(165, state.scan);
+				state.scan += 1;
+				let w697 = value[key453];
+				if (typeof w697 != "number" || w697 > 32767 || w697 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w697, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "singleuse_A6": {
+				if (typeof 166 != "number" || 166 > 255 || 166 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(166, state.scan);
+				state.scan += 1;
+				let w698 = value[key453];
+				if (typeof w698 != "number" || w698 > 65535 || w698 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w698, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "floor_thickness": {
+				if (typeof 167 != "number" || 167 > 255 || 167 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(167, state.scan);
+				state.scan += 1;
+				let w699 = value[key453];
+				if (typeof w699 != "number" || w699 > 65535 || w699 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w699, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unused_a8": {
+				if (typeof 168 != "number" || 168 > 255 || 168 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(168, state.scan);
+				state.scan += 1;
+				let w700 = value[key453];
+				if (w700 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unused_a9": {
+				if (typeof 169 != "number" || 169 > 255 || 169 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(169, state.scan);
+				state.scan += 1;
+				let w701 = value[key453];
+				if (w701 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "wallkit_related_AA": {
+				if (typeof 170 != "number" || 170 > 255 || 170 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(170, state.scan);
+				state.scan += 1;
+				let w702 = value[key453];
+				ext[10].write(state, w702);
+				break;
+			}
+			case "possibly_wallkit_skew_AB": {
+				if (typeof 171 != "number" || 171 > 255 || 171 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(171, state.scan);
+				state.scan += 1;
+				let w703 = value[key453];
+				ext[10].write(state, w703);
+				break;
+			}
+			case "sound_related_AD": {
+				if (typeof 173 != "number" || 173 > 255 || 173 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(173, state.scan);
+				state.scan += 1;
+				let w704 = value[key453];
+				if (typeof w704 != "object" || !w704) { throw new Error("object expected"); }
+				let hidden705 = {};
+				state.stack.push(w704);
+				state.hiddenstack.push(hidden705);
+				let w706 = w704.unknown_1;
+				if (typeof w706 != "number" || w706 > 65535 || w706 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w706, state.scan);
+				state.scan += 2;
+				let w707 = w704.unknown_2;
+				if (typeof w707 != "number" || w707 > 65535 || w707 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w707, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "can_change_color": {
+				if (typeof 177 != "number" || 177 > 255 || 177 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(177, state.scan);
+				state.scan += 1;
+				let w708 = value[key453];
+				if (w708 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "sound_related_B2": {
+				if (typeof 178 != "number" || 178 > 255 || 178 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(178, state.scan);
+				state.scan += 1;
+				let w709 = value[key453];
+				if (typeof w709 != "number" || w709 > 255 || w709 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w709, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_BA": {
+				if (typeof 186 != "number" || 186 > 255 || 186 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(186, state.scan);
+				state.scan += 1;
+				let w710 = value[key453];
+				if (typeof w710 != "number" || w710 > 255 || w710 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w710, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "dummy_bc": {
+				if (typeof 188 != "number" || 188 > 255 || 188 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(188, state.scan);
+				state.scan += 1;
+				let w711 = value[key453];
+				if (w711 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "treerockordoor_BD": {
+				if (typeof 189 != "number" || 189 > 255 || 189 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(189, state.scan);
+				state.scan += 1;
+				let w712 = value[key453];
+				if (w712 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "action_cursors_0": {
+				if (typeof 190 != "number" || 190 > 255 || 190 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(190, state.scan);
+				state.scan += 1;
+				let w713 = value[key453];
+				if (typeof w713 != "number" || w713 > 65535 || w713 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w713, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_1": {
+				if (typeof 191 != "number" || 191 > 255 || 191 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(191, state.scan);
+				state.scan += 1;
+				let w714 = value[key453];
+				if (typeof w714 != "number" || w714 > 65535 || w714 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w714, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_2": {
+				if (typeof 192 != "number" || 192 > 255 || 192 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(192, state.scan);
+				state.scan += 1;
+				let w715 = value[key453];
+				if (typeof w715 != "number" || w715 > 65535 || w715 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w715, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_3": {
+				if (typeof 193 != "number" || 193 > 255 || 193 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(193, state.scan);
+				state.scan += 1;
+				let w716 = value[key453];
+				if (typeof w716 != "number" || w716 > 65535 || w716 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w716, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_4": {
+				if (typeof 194 != "number" || 194 > 255 || 194 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(194, state.scan);
+				state.scan += 1;
+				let w717 = value[key453];
+				if (typeof w717 != "number" || w717 > 65535 || w717 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w717, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_5": {
+				if (typeof 195 != "number" || 195 > 255 || 195 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(195, state.scan);
+				state.scan += 1;
+				let w718 = value[key453];
+				if (typeof w718 != "number" || w718 > 65535 || w718 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w718, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "tileplacement_related_c4": {
+				if (typeof 196 != "number" || 196 > 255 || 196 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(196, state.scan);
+				state.scan += 1;
+				let w719 = value[key453];
+				if (typeof w719 != "number" || w719 > 255 || w719 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w719, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "clan_citadel_C5": {
+				if (typeof 197 != "number" || 197 > 255 || 197 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(197, state.scan);
+				state.scan += 1;
+				let w720 = value[key453];
+				if (typeof w720 != "number" || w720 > 255 || w720 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w720, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "invisible_c6": {
+				if (typeof 198 != "number" || 198 > 255 || 198 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(198, state.scan);
+				state.scan += 1;
+				let w721 = value[key453];
+				if (w721 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "flooroverlay_c7": {
+				if (typeof 199 != "number" || 199 > 255 || 199 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(199, state.scan);
+				state.scan += 1;
+				let w722 = value[key453];
+				if (w722 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "singleuse_C8": {
+				if (typeof 200 != "number" || 200 > 255 || 200 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(200, state.scan);
+				state.scan += 1;
+				let w723 = value[key453];
+				if (w723 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_C9": {
+				if (typeof 201 != "number" || 201 > 255 || 201 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(201, state.scan);
+				state.scan += 1;
+				let w724 = value[key453];
+				if (typeof w724 != "object" || !w724) { throw new Error("object expected"); }
+				let hidden725 = {};
+				state.stack.push(w724);
+				state.hiddenstack.push(hidden725);
+				let w726 = w724.unknown_1;
+				ext[20].write(state, w726);
+				let w727 = w724.unknown_2;
+				ext[20].write(state, w727);
+				let w728 = w724.unknown_3;
+				ext[20].write(state, w728);
+				let w729 = w724.unknown_4;
+				ext[20].write(state, w729);
+				let w730 = w724.unknown_5;
+				ext[20].write(state, w730);
+				let w731 = w724.unknown_6;
+				ext[20].write(state, w731);
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "singleuse_CA": {
+				if (typeof 202 != "number" || 202 > 255 || 202 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(202, state.scan);
+				state.scan += 1;
+				let w732 = value[key453];
+				if (typeof w732 != "number" || w732 > 255 || w732 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w732, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_CB": {
+				if (typeof 203 != "number" || 203 > 255 || 203 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(203, state.scan);
+				state.scan += 1;
+				let w733 = value[key453];
+				if (w733 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_CC": {
+				if (typeof 204 != "number" || 204 > 255 || 204 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(204, state.scan);
+				state.scan += 1;
+				let w734 = value[key453];
+				if (!Array.isArray(w734)) { throw new Error("array expected"); }
+				let w735 = w734.length;
+				if (typeof w735 != "number" || w735 > 255 || w735 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w735, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w734.length });
+				for (let i736 = 0; i736 < w734.length; i736++) {
+					let w737 = w734[i736];
+					ext[21].write(state, w737);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_CD": {
+				if (typeof 205 != "number" || 205 > 255 || 205 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(205, state.scan);
+				state.scan += 1;
+				let w738 = value[key453];
+				if (typeof w738 != "object" || !w738) { throw new Error("object expected"); }
+				let hidden739 = {};
+				state.stack.push(w738);
+				state.hiddenstack.push(hidden739);
+				let w740 = w738.unk0;
+				if (typeof w740 != "number" || w740 > 65535 || w740 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w740, state.scan);
+				state.scan += 2;
+				let w741 = w738.varbit;
+				if (typeof w741 != "number" || w741 > 65535 || w741 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w741, state.scan);
+				state.scan += 2;
+				let w742 = w738.varp;
+				if (typeof w742 != "number" || w742 > 65535 || w742 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w742, state.scan);
+				state.scan += 2;
+				let w743 = w738.$flags;
+				w743 ??= 0;
+				w743 = ext[24].resolve(w738, w743);
+				w743 = ext[25].resolve(w738, w743);
+				w743 = ext[26].resolve(w738, w743);
+				w743 = ext[27].resolve(w738, w743);
+				w743 = ext[28].resolve(w738, w743);
+				hidden739.$flags = w743;
+				if (typeof w743 != "number" || w743 > 255 || w743 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w743, state.scan);
+				state.scan += 1;
+				let w744 = w738.multimodel;
+				if (w744 != null) {
+					if (!Array.isArray(w744)) { throw new Error("array expected"); }
+					let w745 = w744.length;
+					if (typeof w745 != "number" || w745 > 255 || w745 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w745, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w744.length });
+					for (let i746 = 0; i746 < w744.length; i746++) {
+						let w747 = w744[i746];
+						if (typeof w747 != "object" || !w747) { throw new Error("object expected"); }
+						let hidden748 = {};
+						state.stack.push(w747);
+						state.hiddenstack.push(hidden748);
+						let w749 = w747.value;
+						if (typeof w749 != "number" || w749 > 255 || w749 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w749, state.scan);
+						state.scan += 1;
+						let w750 = w747.models;
+						if (!Array.isArray(w750)) { throw new Error("array expected"); }
+						let w751 = w750.length;
+						if (typeof w751 != "number" || w751 > 255 || w751 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w751, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w750.length });
+						for (let i752 = 0; i752 < w750.length; i752++) {
+							let w753 = w750[i752];
+							if (typeof w753 != "object" || !w753) { throw new Error("object expected"); }
+							let hidden754 = {};
+							state.stack.push(w753);
+							state.hiddenstack.push(hidden754);
+							let w755 = w753.unk1;
+							if (typeof w755 != "number" || w755 > 65535 || w755 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w755, state.scan);
+							state.scan += 2;
+							let w756 = w753.unk2;
+							if (typeof w756 != "number" || w756 > 65535 || w756 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w756, state.scan);
+							state.scan += 2;
+							let w757 = w753.model;
+							ext[2].write(state, w757);
+							let w758 = w753.extracount;
+							if (typeof w758 != "number" || w758 > 255 || w758 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w758, state.scan);
+							state.scan += 1;
+							let w759 = w753.extra1;
+							if (w759 != null) {
+								if (typeof w759 != "number" || w759 > 255 || w759 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w759, state.scan);
+								state.scan += 1;
+							}
+							let w760 = w753.extra2;
+							if (w760 != null) {
+								if (typeof w760 != "number" || w760 > 255 || w760 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w760, state.scan);
+								state.scan += 1;
+							}
+							let w761 = w753.extra3;
+							if (w761 != null) {
+								if (typeof w761 != "number" || w761 > 255 || w761 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w761, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w762 = w738.multiheadmodel;
+				if (w762 != null) {
+					if (!Array.isArray(w762)) { throw new Error("array expected"); }
+					let w763 = w762.length;
+					if (typeof w763 != "number" || w763 > 255 || w763 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w763, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w762.length });
+					for (let i764 = 0; i764 < w762.length; i764++) {
+						let w765 = w762[i764];
+						if (typeof w765 != "object" || !w765) { throw new Error("object expected"); }
+						let hidden766 = {};
+						state.stack.push(w765);
+						state.hiddenstack.push(hidden766);
+						let w767 = w765.value;
+						if (typeof w767 != "number" || w767 > 255 || w767 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w767, state.scan);
+						state.scan += 1;
+						let w768 = w765.models;
+						if (!Array.isArray(w768)) { throw new Error("array expected"); }
+						let w769 = w768.length;
+						if (typeof w769 != "number" || w769 > 255 || w769 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w769, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w768.length });
+						for (let i770 = 0; i770 < w768.length; i770++) {
+							let w771 = w768[i770];
+							if (typeof w771 != "object" || !w771) { throw new Error("object expected"); }
+							let hidden772 = {};
+							state.stack.push(w771);
+							state.hiddenstack.push(hidden772);
+							let w773 = w771.unk1;
+							if (typeof w773 != "number" || w773 > 65535 || w773 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w773, state.scan);
+							state.scan += 2;
+							let w774 = w771.unk2;
+							if (typeof w774 != "number" || w774 > 65535 || w774 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w774, state.scan);
+							state.scan += 2;
+							let w775 = w771.model;
+							ext[2].write(state, w775);
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w776 = w738.multiretex;
+				if (w776 != null) {
+					if (!Array.isArray(w776)) { throw new Error("array expected"); }
+					let w777 = w776.length;
+					if (typeof w777 != "number" || w777 > 255 || w777 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w777, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w776.length });
+					for (let i778 = 0; i778 < w776.length; i778++) {
+						let w779 = w776[i778];
+						if (typeof w779 != "object" || !w779) { throw new Error("object expected"); }
+						let hidden780 = {};
+						state.stack.push(w779);
+						state.hiddenstack.push(hidden780);
+						let w781 = w779.value;
+						if (typeof w781 != "number" || w781 > 255 || w781 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w781, state.scan);
+						state.scan += 1;
+						let w782 = w779.entries;
+						if (!Array.isArray(w782)) { throw new Error("array expected"); }
+						let w783 = w782.length;
+						if (typeof w783 != "number" || w783 > 255 || w783 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w783, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w782.length });
+						for (let i784 = 0; i784 < w782.length; i784++) {
+							let w785 = w782[i784];
+							if (typeof w785 != "object" || !w785) { throw new Error("object expected"); }
+							let hidden786 = {};
+							state.stack.push(w785);
+							state.hiddenstack.push(hidden786);
+							let w787 = w785.unk1;
+							if (typeof w787 != "number" || w787 > 65535 || w787 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w787, state.scan);
+							state.scan += 2;
+							let w788 = w785.unk2;
+							if (typeof w788 != "number" || w788 > 65535 || w788 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w788, state.scan);
+							state.scan += 2;
+							let w789 = w785.unk3;
+							if (typeof w789 != "number" || w789 > 65535 || w789 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w789, state.scan);
+							state.scan += 2;
+							let w790 = w785.unk4;
+							if (typeof w790 != "number" || w790 > 65535 || w790 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w790, state.scan);
+							state.scan += 2;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w791 = w738.multirecol;
+				if (w791 != null) {
+					if (!Array.isArray(w791)) { throw new Error("array expected"); }
+					let w792 = w791.length;
+					if (typeof w792 != "number" || w792 > 255 || w792 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w792, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w791.length });
+					for (let i793 = 0; i793 < w791.length; i793++) {
+						let w794 = w791[i793];
+						if (typeof w794 != "object" || !w794) { throw new Error("object expected"); }
+						let hidden795 = {};
+						state.stack.push(w794);
+						state.hiddenstack.push(hidden795);
+						let w796 = w794.value;
+						if (typeof w796 != "number" || w796 > 255 || w796 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w796, state.scan);
+						state.scan += 1;
+						let w797 = w794.entries;
+						if (!Array.isArray(w797)) { throw new Error("array expected"); }
+						let w798 = w797.length;
+						if (typeof w798 != "number" || w798 > 255 || w798 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w798, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w797.length });
+						for (let i799 = 0; i799 < w797.length; i799++) {
+							let w800 = w797[i799];
+							if (typeof w800 != "object" || !w800) { throw new Error("object expected"); }
+							let hidden801 = {};
+							state.stack.push(w800);
+							state.hiddenstack.push(hidden801);
+							let w802 = w800.unk1;
+							if (typeof w802 != "number" || w802 > 65535 || w802 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w802, state.scan);
+							state.scan += 2;
+							let w803 = w800.unk2;
+							if (typeof w803 != "number" || w803 > 65535 || w803 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w803, state.scan);
+							state.scan += 2;
+							let w804 = w800.unk3;
+							if (typeof w804 != "number" || w804 > 65535 || w804 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w804, state.scan);
+							state.scan += 2;
+							let w805 = w800.unk4;
+							if (typeof w805 != "number" || w805 > 65535 || w805 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w805, state.scan);
+							state.scan += 2;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w806 = w738.multiretint;
+				if (w806 != null) {
+					if (!Array.isArray(w806)) { throw new Error("array expected"); }
+					let w807 = w806.length;
+					if (typeof w807 != "number" || w807 > 255 || w807 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w807, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w806.length });
+					for (let i808 = 0; i808 < w806.length; i808++) {
+						let w809 = w806[i808];
+						if (typeof w809 != "object" || !w809) { throw new Error("object expected"); }
+						let hidden810 = {};
+						state.stack.push(w809);
+						state.hiddenstack.push(hidden810);
+						let w811 = w809.value;
+						if (typeof w811 != "number" || w811 > 255 || w811 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w811, state.scan);
+						state.scan += 1;
+						let w812 = w809.entries;
+						if (!Array.isArray(w812)) { throw new Error("array expected"); }
+						let w813 = w812.length;
+						if (typeof w813 != "number" || w813 > 255 || w813 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w813, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w812.length });
+						for (let i814 = 0; i814 < w812.length; i814++) {
+							let w815 = w812[i814];
+							if (typeof w815 != "object" || !w815) { throw new Error("object expected"); }
+							let hidden816 = {};
+							state.stack.push(w815);
+							state.hiddenstack.push(hidden816);
+							let w817 = w815.unk1;
+							if (typeof w817 != "number" || w817 > 65535 || w817 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w817, state.scan);
+							state.scan += 2;
+							let w818 = w815.unk2;
+							if (typeof w818 != "number" || w818 > 65535 || w818 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w818, state.scan);
+							state.scan += 2;
+							let w819 = w815.unk3;
+							if (typeof w819 != "number" || w819 > 4294967295 || w819 < 0) { throw new Error(); }
+							state.buffer.writeUInt32BE(w819, state.scan);
+							state.scan += 4;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w820 = w738.default;
+				if (typeof w820 != "number" || w820 > 65535 || w820 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w820, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_CE": {
+				if (typeof 206 != "number" || 206 > 255 || 206 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(206, state.scan);
+				state.scan += 1;
+				let w821 = value[key453];
+				if (typeof w821 != "object" || !w821) { throw new Error("object expected"); }
+				let hidden822 = {};
+				state.stack.push(w821);
+				state.hiddenstack.push(hidden822);
+				let w823 = w821.bytelength;
+				if (typeof w823 != "number" || w823 > 65535 || w823 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w823, state.scan);
+				state.scan += 2;
+				let w824 = w821.elements;
+				if (!Array.isArray(w824)) { throw new Error("array expected"); }
+				let w825 = w824.length;
+				ext[10].write(state, w825);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w824.length });
+				for (let i826 = 0; i826 < w824.length; i826++) {
+					let w827 = w824[i826];
+					ext[22].write(state, w827);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w828 = value[key453];
+				if (!Array.isArray(w828)) { throw new Error("array expected"); }
+				let w829 = w828.length;
+				if (typeof w829 != "number" || w829 > 255 || w829 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w829, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w828.length });
+				for (let i830 = 0; i830 < w828.length; i830++) {
+					let w831 = w828[i830];
+					if (typeof w831 != "object" || !w831) { throw new Error("object expected"); }
+					let hidden832 = {};
+					state.stack.push(w831);
+					state.hiddenstack.push(hidden832);
+					let w833 = w831.$type;
+					w833 ??= 0;
+					w833 = ext[29].resolve(w831, w833);
+					w833 = ext[30].resolve(w831, w833);
+					hidden832.$type = w833;
+					if (typeof w833 != "number" || w833 > 255 || w833 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w833, state.scan);
+					state.scan += 1;
+					let w834 = w831.prop;
+					ext[23].write(state, w834);
+					let w835 = w831.intvalue;
+					if (w835 != null) {
+						if (typeof w835 != "number" || w835 > 2147483647 || w835 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w835, state.scan);
+						state.scan += 4;
+					}
+					let w836 = w831.stringvalue;
+					if (w836 != null) {
+						ext[4].write(state, w836);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key453);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
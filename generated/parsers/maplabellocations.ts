@@ -0,0 +1,69 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\maplabellocations.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x7cf55261;
+
+export function read(state, ext) {
+	let v0 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	let hidden1 = { $index: 0, $length: v0 };
+	state.hiddenstack.push(hidden1);
+	state.stack.push({});
+	let arr2 = [];
+	for (let i3 = 0; i3 < v0; i3++) {
+		hidden1.$index = i3;
+		let obj4 = {};
+		let hidden5 = {};
+		state.stack.push(obj4);
+		state.hiddenstack.push(hidden5);
+		let v6 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v6 !== undefined) { obj4.location = v6; }
+		let v7 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v7 !== undefined) { obj4.labelId = v7; }
+		let v8 = state.view.getUint8(state.scan++);
+		if (v8 != 0 && v8 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v8 != 0) !== undefined) { obj4.conditional = (v8 != 0); }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr2.push(obj4);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	return arr2;
+}
+
+export function write(state, ext, value) {
+	if (!Array.isArray(value)) { throw new Error("array expected"); }
+	let w9 = value.length;
+	if (typeof w9 != "number" || w9 > 65535 || w9 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w9, state.scan);
+	state.scan += 2;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: value.length });
+	for (let i10 = 0; i10 < value.length; i10++) {
+		let w11 = value[i10];
+		if (typeof w11 != "object" || !w11) { throw new Error("object expected"); }
+		let hidden12 = {};
+		state.stack.push(w11);
+		state.hiddenstack.push(hidden12);
+		let w13 = w11.location;
+		if (typeof w13 != "number" || w13 > 4294967295 || w13 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w13, state.scan);
+		state.scan += 4;
+		let w14 = w11.labelId;
+		if (typeof w14 != "number" || w14 > 65535 || w14 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w14, state.scan);
+		state.scan += 2;
+		let w15 = w11.conditional;
+		if (typeof w15 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w15, state.scan++);
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+}
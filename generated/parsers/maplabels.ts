@@ -0,0 +1,818 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\maplabels.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x84414681;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.sprite = v3;
+				break;
+			}
+			case 2: {
+				let v4 = ext[0].read(state);
+				obj0.sprite_hover = v4;
+				break;
+			}
+			case 3: {
+				let v5 = ext[1].read(state);
+				obj0.text = v5;
+				break;
+			}
+			case 4: {
+				let v6 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v7 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v8 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr9 = [v6, v7, v8];
+				obj0.color_1 = arr9;
+				break;
+			}
+			case 5: {
+				let v10 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v11 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v12 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr13 = [v10, v11, v12];
+				obj0.color_2 = arr13;
+				break;
+			}
+			case 6: {
+				let v14 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.font_size = v14;
+				break;
+			}
+			case 7: {
+				let v15 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_07 = v15;
+				break;
+			}
+			case 8: {
+				let v16 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_08 = v16;
+				break;
+			}
+			case 9: {
+				let obj17 = {};
+				let hidden18 = {};
+				state.stack.push(obj17);
+				state.hiddenstack.push(hidden18);
+				let v19 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v19 !== undefined) { obj17.varbit = v19; }
+				let v20 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v20 !== undefined) { obj17.varp = v20; }
+				let v21 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				if (v21 !== undefined) { obj17.lower = v21; }
+				let v22 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				if (v22 !== undefined) { obj17.upper = v22; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.toggle_1 = obj17;
+				break;
+			}
+			case 10: {
+				let v23 = ext[1].read(state);
+				obj0.rightclick_1 = v23;
+				break;
+			}
+			case 11: {
+				let v24 = ext[1].read(state);
+				obj0.unktext_0b = v24;
+				break;
+			}
+			case 15: {
+				let obj25 = {};
+				let hidden26 = {};
+				state.stack.push(obj25);
+				state.hiddenstack.push(hidden26);
+				let v27 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v27 !== undefined) { obj25.pointcount = v27; }
+				let ref28 = state.stack[state.stack.length - 1].pointcount;
+				ref28 = ref28 + 0;
+				let hidden29 = { $index: 0, $length: ref28 };
+				state.hiddenstack.push(hidden29);
+				state.stack.push({});
+				let arr30 = [];
+				for (let i31 = 0; i31 < ref28; i31++) {
+					hidden29.$index = i31;
+					let obj32 = {};
+					let hidden33 = {};
+					state.stack.push(obj32);
+					state.hiddenstack.push(hidden33);
+					let v34 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					if (v34 !== undefined) { obj32.x = v34; }
+					let v35 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					if (v35 !== undefined) { obj32.y = v35; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr30.push(obj32);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr30 !== undefined) { obj25.points = arr30; }
+				let v36 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v37 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v38 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v39 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr40 = [v36, v37, v38, v39];
+				if (arr40 !== undefined) { obj25.color = arr40; }
+				let hidden41 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden41);
+				let v42 = ext[2].read(state);
+				hidden41.$opcode = v42;
+				let ref43 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match44 = -1;
+				if (ref43 >= 623) { match44 = 0; }
+				else if (true) { match44 = 1; }
+				if (match44 == -1) { throw new Error("no opcode matched"); }
+				let v45;
+				if (match44 == 0) {
+					let v46 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v45 = v46;
+				}
+				else if (match44 == 1) {
+					v45 = 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v45 !== undefined) { obj25.always_1 = v45; }
+				let v47 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v48 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v49 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v50 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr51 = [v47, v48, v49, v50];
+				if (arr51 !== undefined) { obj25.back_color = arr51; }
+				let hidden52 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden52);
+				let v53 = ext[3].read(state);
+				hidden52.$opcode = v53;
+				let ref54 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match55 = -1;
+				if (ref54 >= 629) { match55 = 0; }
+				else if (true) { match55 = 1; }
+				if (match55 == -1) { throw new Error("no opcode matched"); }
+				let v56;
+				if (match55 == 0) {
+					let ref57 = state.stack[state.stack.length - 2].pointcount;
+					ref57 = ref57 + 0;
+					let hidden58 = { $index: 0, $length: ref57 };
+					state.hiddenstack.push(hidden58);
+					state.stack.push({});
+					let arr59 = [];
+					for (let i60 = 0; i60 < ref57; i60++) {
+						hidden58.$index = i60;
+						let v61 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						arr59.push(v61);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v56 = arr59;
+				}
+				else if (match55 == 1) {
+					v56 = null;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v56 !== undefined) { obj25.pointplanes = v56; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.polygon = obj25;
+				break;
+			}
+			case 17: {
+				let v62 = ext[1].read(state);
+				obj0.rightclick_2 = v62;
+				break;
+			}
+			case 19: {
+				let v63 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.category = v63;
+				break;
+			}
+			case 20: {
+				let obj64 = {};
+				let hidden65 = {};
+				state.stack.push(obj64);
+				state.hiddenstack.push(hidden65);
+				let v66 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v66 !== undefined) { obj64.varbit = v66; }
+				let v67 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v67 !== undefined) { obj64.varp = v67; }
+				let v68 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				if (v68 !== undefined) { obj64.lower = v68; }
+				let v69 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				if (v69 !== undefined) { obj64.upper = v69; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.toggle_2 = obj64;
+				break;
+			}
+			case 21: {
+				let v70 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.unknown_15 = v70;
+				break;
+			}
+			case 22: {
+				let v71 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.unknown_16 = v71;
+				break;
+			}
+			case 25: {
+				let v72 = ext[0].read(state);
+				obj0.background_sprite = v72;
+				break;
+			}
+			case 26: {
+				let obj73 = {};
+				let hidden74 = {};
+				state.stack.push(obj73);
+				state.hiddenstack.push(hidden74);
+				let v75 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v75 !== undefined) { obj73.varbit = v75; }
+				let v76 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v76 !== undefined) { obj73.varp = v76; }
+				let v77 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v77 !== undefined) { obj73.value = v77; }
+				let v78 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v78 !== undefined) { obj73.default_ref = v78; }
+				let v79 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v79 !== undefined) { obj73.legacy_ref = v79; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.legacy_switch = obj73;
+				break;
+			}
+			case 28: {
+				let v80 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_1c = v80;
+				break;
+			}
+			case 30: {
+				let v81 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_1e = v81;
+				break;
+			}
+			case 249: {
+				let v82 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden83 = { $index: 0, $length: v82 };
+				state.hiddenstack.push(hidden83);
+				state.stack.push({});
+				let arr84 = [];
+				for (let i85 = 0; i85 < v82; i85++) {
+					hidden83.$index = i85;
+					let obj86 = {};
+					let hidden87 = {};
+					state.stack.push(obj86);
+					state.hiddenstack.push(hidden87);
+					let v88 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v88 !== undefined) { hidden87.$type = v88; }
+					let v89 = ext[4].read(state);
+					if (v89 !== undefined) { obj86.prop = v89; }
+					let ref90 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match91 = -1;
+					if (ref90 == 0) { match91 = 0; }
+					let v92 = null;
+					if (match91 != -1) {
+						let v93 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v92 = v93;
+					}
+					if (v92 !== undefined) { obj86.intvalue = v92; }
+					let ref94 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match95 = -1;
+					if (ref94 == 1) { match95 = 0; }
+					let v96 = null;
+					if (match95 != -1) {
+						let v97 = ext[1].read(state);
+						v96 = v97;
+					}
+					if (v96 !== undefined) { obj86.stringvalue = v96; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr84.push(obj86);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr84;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key98 in value) {
+		if (key98.startsWith("$")) { continue; }
+		switch (key98) {
+			case "sprite": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w99 = value[key98];
+				ext[0].write(state, w99);
+				break;
+			}
+			case "sprite_hover": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w100 = value[key98];
+				ext[0].write(state, w100);
+				break;
+			}
+			case "text": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w101 = value[key98];
+				ext[1].write(state, w101);
+				break;
+			}
+			case "color_1": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w102 = value[key98];
+				if (!Array.isArray(w102)) { throw new Error("array expected"); }
+				let w103 = w102[0];
+				if (typeof w103 != "number" || w103 > 255 || w103 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w103, state.scan);
+				state.scan += 1;
+				let w104 = w102[1];
+				if (typeof w104 != "number" || w104 > 255 || w104 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w104, state.scan);
+				state.scan += 1;
+				let w105 = w102[2];
+				if (typeof w105 != "number" || w105 > 255 || w105 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w105, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "color_2": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w106 = value[key98];
+				if (!Array.isArray(w106)) { throw new Error("array expected"); }
+				let w107 = w106[0];
+				if (typeof w107 != "number" || w107 > 255 || w107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w107, state.scan);
+				state.scan += 1;
+				let w108 = w106[1];
+				if (typeof w108 != "number" || w108 > 255 || w108 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w108, state.scan);
+				state.scan += 1;
+				let w109 = w106[2];
+				if (typeof w109 != "number" || w109 > 255 || w109 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w109, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "font_size": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w110 = value[key98];
+				if (typeof w110 != "number" || w110 > 255 || w110 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w110, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_07": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w111 = value[key98];
+				if (typeof w111 != "number" || w111 > 255 || w111 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w111, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w112 = value[key98];
+				if (typeof w112 != "number" || w112 > 255 || w112 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w112, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "toggle_1": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w113 = value[key98];
+				if (typeof w113 != "object" || !w113) { throw new Error("object expected"); }
+				let hidden114 = {};
+				state.stack.push(w113);
+				state.hiddenstack.push(hidden114);
+				let w115 = w113.varbit;
+				if (typeof w115 != "number" || w115 > 65535 || w115 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w115, state.scan);
+				state.scan += 2;
+				let w116 = w113.varp;
+				if (typeof w116 != "number" || w116 > 65535 || w116 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w116, state.scan);
+				state.scan += 2;
+				let w117 = w113.lower;
+				if (typeof w117 != "number" || w117 > 4294967295 || w117 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w117, state.scan);
+				state.scan += 4;
+				let w118 = w113.upper;
+				if (typeof w118 != "number" || w118 > 4294967295 || w118 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w118, state.scan);
+				state.scan += 4;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "rightclick_1": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w119 = value[key98];
+				ext[1].write(state, w119);
+				break;
+			}
+			case "unktext_0b": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w120 = value[key98];
+				ext[1].write(state, w120);
+				break;
+			}
+			case "polygon": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w121 = value[key98];
+				if (typeof w121 != "object" || !w121) { throw new Error("object expected"); }
+				let hidden122 = {};
+				state.stack.push(w121);
+				state.hiddenstack.push(hidden122);
+				let w123 = w121.pointcount;
+				if (typeof w123 != "number" || w123 > 255 || w123 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w123, state.scan);
+				state.scan += 1;
+				let w124 = w121.points;
+				if (!Array.isArray(w124)) { throw new Error("array expected"); }
+				let w125 = w124.length;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w124.length });
+				for (let i126 = 0; i126 < w124.length; i126++) {
+					let w127 = w124[i126];
+					if (typeof w127 != "object" || !w127) { throw new Error("object expected"); }
+					let hidden128 = {};
+					state.stack.push(w127);
+					state.hiddenstack.push(hidden128);
+					let w129 = w127.x;
+					if (typeof w129 != "number" || w129 > 32767 || w129 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w129, state.scan);
+					state.scan += 2;
+					let w130 = w127.y;
+					if (typeof w130 != "number" || w130 > 32767 || w130 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w130, state.scan);
+					state.scan += 2;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w131 = w121.color;
+				if (!Array.isArray(w131)) { throw new Error("array expected"); }
+				let w132 = w131[0];
+				if (typeof w132 != "number" || w132 > 255 || w132 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w132, state.scan);
+				state.scan += 1;
+				let w133 = w131[1];
+				if (typeof w133 != "number" || w133 > 255 || w133 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w133, state.scan);
+				state.scan += 1;
+				let w134 = w131[2];
+				if (typeof w134 != "number" || w134 > 255 || w134 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w134, state.scan);
+				state.scan += 1;
+				let w135 = w131[3];
+				if (typeof w135 != "number" || w135 > 255 || w135 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w135, state.scan);
+				state.scan += 1;
+				let w136 = w121.always_1;
+				let hidden137 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden137);
+				hidden137.$opcode = ext[2].readConst(state);
+				let ref138 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match139 = -1;
+				if (ref138 >= 623) { match139 = 0; }
+				else if (true) { match139 = 1; }
+				if (match139 == -1) { throw new Error("no opcode matched"); }
+				if (match139 == 0) {
+					if (typeof w136 != "number" || w136 > 255 || w136 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w136, state.scan);
+					state.scan += 1;
+				}
+				else if (match139 == 1) {
+					if (w136 != 1) { throw new Error("expected constant 1 was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let w140 = w121.back_color;
+				if (!Array.isArray(w140)) { throw new Error("array expected"); }
+				let w141 = w140[0];
+				if (typeof w141 != "number" || w141 > 255 || w141 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w141, state.scan);
+				state.scan += 1;
+				let w142 = w140[1];
+				if (typeof w142 != "number" || w142 > 255 || w142 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w142, state.scan);
+				state.scan += 1;
+				let w143 = w140[2];
+				if (typeof w143 != "number" || w143 > 255 || w143 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w143, state.scan);
+				state.scan += 1;
+				let w144 = w140[3];
+				if (typeof w144 != "number" || w144 > 255 || w144 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w144, state.scan);
+				state.scan += 1;
+				let w145 = w121.pointplanes;
+				let hidden146 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden146);
+				hidden146.$opcode = ext[3].readConst(state);
+				let ref147 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match148 = -1;
+				if (ref147 >= 629) { match148 = 0; }
+				else if (true) { match148 = 1; }
+				if (match148 == -1) { throw new Error("no opcode matched"); }
+				if (match148 == 0) {
+					if (!Array.isArray(w145)) { throw new Error("array expected"); }
+					let w149 = w145.length;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w145.length });
+					for (let i150 = 0; i150 < w145.length; i150++) {
+						let w151 = w145[i150];
+						if (typeof w151 != "number" || w151 > 255 || w151 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w151, state.scan);
+						state.scan += 1;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				else if (match148 == 1) {
+					if (w145 != null) { throw new Error("expected constant null was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "rightclick_2": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w152 = value[key98];
+				ext[1].write(state, w152);
+				break;
+			}
+			case "category": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w153 = value[key98];
+				if (typeof w153 != "number" || w153 > 65535 || w153 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w153, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "toggle_2": {
+				if (typeof 20 != "number" || 20 > 255 || 20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(20, state.scan);
+				state.scan += 1;
+				let w154 = value[key98];
+				if (typeof w154 != "object" || !w154) { throw new Error("object expected"); }
+				let hidden155 = {};
+				state.stack.push(w154);
+				state.hiddenstack.push(hidden155);
+				let w156 = w154.varbit;
+				if (typeof w156 != "number" || w156 > 65535 || w156 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w156, state.scan);
+				state.scan += 2;
+				let w157 = w154.varp;
+				if (typeof w157 != "number" || w157 > 65535 || w157 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w157, state.scan);
+				state.scan += 2;
+				let w158 = w154.lower;
+				if (typeof w158 != "number" || w158 > 4294967295 || w158 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w158, state.scan);
+				state.scan += 4;
+				let w159 = w154.upper;
+				if (typeof w159 != "number" || w159 > 4294967295 || w159 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w159, state.scan);
+				state.scan += 4;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_15": {
+				if (typeof 21 != "number" || 21 > 255 || 21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(21, state.scan);
+				state.scan += 1;
+				let w160 = value[key98];
+				if (typeof w160 != "number" || w160 > 2147483647 || w160 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w160, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "unknown_16": {
+				if (typeof 22 != "number" || 22 > 255 || 22 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(22, state.scan);
+				state.scan += 1;
+				let w161 = value[key98];
+				if (typeof w161 != "number" || w161 > 2147483647 || w161 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w161, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "background_sprite": {
+				if (typeof 25 != "number" || 25 > 255 || 25 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(25, state.scan);
+				state.scan += 1;
+				let w162 = value[key98];
+				ext[0].write(state, w162);
+				break;
+			}
+			case "legacy_switch": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w163 = value[key98];
+				if (typeof w163 != "object" || !w163) { throw new Error("object expected"); }
+				let hidden164 = {};
+				state.stack.push(w163);
+				state.hiddenstack.push(hidden164);
+				let w165 = w163.varbit;
+				if (typeof w165 != "number" || w165 > 65535 || w165 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w165, state.scan);
+				state.scan += 2;
+				let w166 = w163.varp;
+				if (typeof w166 != "number" || w166 > 65535 || w166 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w166, state.scan);
+				state.scan += 2;
+				let w167 = w163.value;
+				if (typeof w167 != "number" || w167 > 255 || w167 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w167, state.scan);
+				state.scan += 1;
+				let w168 = w163.default_ref;
+				if (typeof w168 != "number" || w168 > 65535 || w168 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w168, state.scan);
+				state.scan += 2;
+				let w169 = w163.legacy_ref;
+				if (typeof w169 != "number" || w169 > 65535 || w169 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w169, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_1c": {
+				if (typeof 28 != "number" || 28 > 255 || 28 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(28, state.scan);
+				state.scan += 1;
+				let w170 = value[key98];
+				if (typeof w170 != "number" || w170 > 255 || w170 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w170, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_1e": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w171 = value[key98];
+				if (typeof w171 != "number" || w171 > 255 || w171 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w171, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w172 = value[key98];
+				if (!Array.isArray(w172)) { throw new Error("array expected"); }
+				let w173 = w172.length;
+				if (typeof w173 != "number" || w173 > 255 || w173 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w173, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w172.length });
+				for (let i174 = 0; i174 < w172.length; i174++) {
+					let w175 = w172[i174];
+					if (typeof w175 != "object" || !w175) { throw new Error("object expected"); }
+					let hidden176 = {};
+					state.stack.push(w175);
+					state.hiddenstack.push(hidden176);
+					let w177 = w175.$type;
+					w177 ??= 0;
+					w177 = ext[5].resolve(w175, w177);
+					w177 = ext[6].resolve(w175, w177);
+					hidden176.$type = w177;
+					if (typeof w177 != "number" || w177 > 255 || w177 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w177, state.scan);
+					state.scan += 1;
+					let w178 = w175.prop;
+					ext[4].write(state, w178);
+					let w179 = w175.intvalue;
+					if (w179 != null) {
+						if (typeof w179 != "number" || w179 > 2147483647 || w179 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w179, state.scan);
+						state.scan += 4;
+					}
+					let w180 = w175.stringvalue;
+					if (w180 != null) {
+						ext[1].write(state, w180);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key98);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
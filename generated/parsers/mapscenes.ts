@@ -0,0 +1,140 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapscenes.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x1dcd2d34;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.sprite_id = v3;
+				break;
+			}
+			case 2: {
+				let hidden4 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden4);
+				state.stack.push({});
+				let arr5 = [];
+				for (let i6 = 0; i6 < 3; i6++) {
+					hidden4.$index = i6;
+					let v7 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr5.push(v7);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let v8 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr9 = [arr5, v8];
+				obj0.unknown_2 = arr9;
+				break;
+			}
+			case 3: {
+				obj0.unknown_3 = true;
+				break;
+			}
+			case 4: {
+				obj0.unknown_4 = true;
+				break;
+			}
+			case 5: {
+				obj0.unknown_5 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key10 in value) {
+		if (key10.startsWith("$")) { continue; }
+		switch (key10) {
+			case "sprite_id": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w11 = value[key10];
+				ext[0].write(state, w11);
+				break;
+			}
+			case "unknown_2": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w12 = value[key10];
+				if (!Array.isArray(w12)) { throw new Error("array expected"); }
+				let w13 = w12[0];
+				if (!Array.isArray(w13)) { throw new Error("array expected"); }
+				let w14 = w13.length;
+				if (w14 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w13.length });
+				for (let i15 = 0; i15 < w13.length; i15++) {
+					let w16 = w13[i15];
+					if (typeof w16 != "number" || w16 > 255 || w16 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w16, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w17 = w12[1];
+				if (typeof w17 != "number" || w17 > 255 || w17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w17, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_3": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w18 = value[key10];
+				if (w18 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_4": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w19 = value[key10];
+				if (w19 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_5": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w20 = value[key10];
+				if (w20 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key10);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
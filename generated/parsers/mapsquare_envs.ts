@@ -0,0 +1,32 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_envs.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xa1cfb372;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.unk = v2; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden3 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden3);
+	let w4 = value.unk;
+	if (typeof w4 != "number" || w4 > 255 || w4 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w4, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,362 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_overlays.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x0abcdc40;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let hidden3 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden3);
+				state.stack.push({});
+				let arr4 = [];
+				for (let i5 = 0; i5 < 3; i5++) {
+					hidden3.$index = i5;
+					let v6 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr4.push(v6);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.color = arr4;
+				break;
+			}
+			case 2: {
+				let v7 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.materialbyte = v7;
+				break;
+			}
+			case 3: {
+				let hidden8 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden8);
+				let v9 = ext[0].read(state);
+				hidden8.$opcode = v9;
+				let ref10 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match11 = -1;
+				if (ref10 > 377) { match11 = 0; }
+				else if (true) { match11 = 1; }
+				if (match11 == -1) { throw new Error("no opcode matched"); }
+				let v12;
+				if (match11 == 0) {
+					let v13 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v12 = v13;
+				}
+				else if (match11 == 1) {
+					v12 = 0;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.material = v12;
+				break;
+			}
+			case 5: {
+				obj0.unknown_0x05 = true;
+				break;
+			}
+			case 6: {
+				let v14 = ext[1].read(state);
+				obj0.name = v14;
+				break;
+			}
+			case 7: {
+				let hidden15 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden15);
+				state.stack.push({});
+				let arr16 = [];
+				for (let i17 = 0; i17 < 3; i17++) {
+					hidden15.$index = i17;
+					let v18 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr16.push(v18);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.secondary_colour = arr16;
+				break;
+			}
+			case 8: {
+				obj0.unknown_0x08 = true;
+				break;
+			}
+			case 9: {
+				let v19 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.material_tiling = v19;
+				break;
+			}
+			case 10: {
+				obj0.unknown_0x0A = true;
+				break;
+			}
+			case 11: {
+				let v20 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.bleedpriority = v20;
+				break;
+			}
+			case 12: {
+				obj0.bleedToUnderlay = true;
+				break;
+			}
+			case 13: {
+				let hidden21 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden21);
+				state.stack.push({});
+				let arr22 = [];
+				for (let i23 = 0; i23 < 3; i23++) {
+					hidden21.$index = i23;
+					let v24 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr22.push(v24);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.tertiary_colour = arr22;
+				break;
+			}
+			case 14: {
+				let v25 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0x0E = v25;
+				break;
+			}
+			case 15: {
+				let v26 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_0x0F = v26;
+				break;
+			}
+			case 16: {
+				let v27 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0x10 = v27;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key28 in value) {
+		if (key28.startsWith("$")) { continue; }
+		switch (key28) {
+			case "color": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w29 = value[key28];
+				if (!Array.isArray(w29)) { throw new Error("array expected"); }
+				let w30 = w29.length;
+				if (w30 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w29.length });
+				for (let i31 = 0; i31 < w29.length; i31++) {
+					let w32 = w29[i31];
+					if (typeof w32 != "number" || w32 > 255 || w32 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w32, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "materialbyte": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w33 = value[key28];
+				if (typeof w33 != "number" || w33 > 255 || w33 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w33, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "material": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w34 = value[key28];
+				let hidden35 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden35);
+				hidden35.$opcode = ext[0].readConst(state);
+				let ref36 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match37 = -1;
+				if (ref36 > 377) { match37 = 0; }
+				else if (true) { match37 = 1; }
+				if (match37 == -1) { throw new Error("no opcode matched"); }
+				if (match37 == 0) {
+					if (typeof w34 != "number" || w34 > 65535 || w34 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w34, state.scan);
+					state.scan += 2;
+				}
+				else if (match37 == 1) {
+					if (w34 != 0) { throw new Error("expected constant 0 was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_0x05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w38 = value[key28];
+				if (w38 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "name": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w39 = value[key28];
+				ext[1].write(state, w39);
+				break;
+			}
+			case "secondary_colour": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w40 = value[key28];
+				if (!Array.isArray(w40)) { throw new Error("array expected"); }
+				let w41 = w40.length;
+				if (w41 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w40.length });
+				for (let i42 = 0; i42 < w40.length; i42++) {
+					let w43 = w40[i42];
+					if (typeof w43 != "number" || w43 > 255 || w43 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w43, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0x08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w44 = value[key28];
+				if (w44 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "material_tiling": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w45 = value[key28];
+				if (typeof w45 != "number" || w45 > 65535 || w45 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w45, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_0x0A": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w46 = value[key28];
+				if (w46 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "bleedpriority": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w47 = value[key28];
+				if (typeof w47 != "number" || w47 > 255 || w47 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w47, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "bleedToUnderlay": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w48 = value[key28];
+				if (w48 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "tertiary_colour": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w49 = value[key28];
+				if (!Array.isArray(w49)) { throw new Error("array expected"); }
+				let w50 = w49.length;
+				if (w50 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w49.length });
+				for (let i51 = 0; i51 < w49.length; i51++) {
+					let w52 = w49[i51];
+					if (typeof w52 != "number" || w52 > 255 || w52 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w52, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0x0E": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w53 = value[key28];
+				if (typeof w53 != "number" || w53 > 255 || w53 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w53, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0x0F": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w54 = value[key28];
+				if (typeof w54 != "number" || w54 > 65535 || w54 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w54, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_0x10": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w55 = value[key28];
+				if (typeof w55 != "number" || w55 > 255 || w55 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w55, state.scan);
+				state.scan += 1;
+				break;
+			}
+			default: throw new Error("unknown property " + key28);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1060 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_tiles.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x306df5d0;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 >= 936) { match5 = 0; }
+	else if (true) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		let v8 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let arr9 = [v7, v8];
+		v6 = arr9;
+	}
+	else if (match5 == 1) {
+		v6 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.magic = v6; }
+	let hidden10 = { $index: 0, $length: 16384 };
+	state.hiddenstack.push(hidden10);
+	state.stack.push({});
+	let arr11 = [];
+	for (let i12 = 0; i12 < 16384; i12++) {
+		hidden10.$index = i12;
+		let hidden13 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden13);
+		let v14 = ext[1].read(state);
+		hidden13.$opcode = v14;
+		let ref15 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match16 = -1;
+		if (ref15 >= 750) { match16 = 0; }
+		else if (true) { match16 = 1; }
+		if (match16 == -1) { throw new Error("no opcode matched"); }
+		let v17;
+		if (match16 == 0) {
+			let obj18 = {};
+			let hidden19 = {};
+			state.stack.push(obj18);
+			state.hiddenstack.push(hidden19);
+			let v20 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v20 !== undefined) { obj18.flags = v20; }
+			let ref21 = state.stack[state.stack.length - 1].flags;
+			let match22 = -1;
+			if ((ref21 & 1) != 0) { match22 = 0; }
+			let v23 = null;
+			if (match22 != -1) {
+				let v24 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				v23 = v24;
+			}
+			if (v23 !== undefined) { obj18.shape = v23; }
+			let ref25 = state.stack[state.stack.length - 1].flags;
+			let match26 = -1;
+			if ((ref25 & 1) != 0) { match26 = 0; }
+			let v27 = null;
+			if (match26 != -1) {
+				let v28 = ext[2].read(state);
+				v27 = v28;
+			}
+			if (v27 !== undefined) { obj18.overlay = v27; }
+			let ref29 = state.stack[state.stack.length - 1].flags;
+			let match30 = -1;
+			if ((ref29 & 2) != 0) { match30 = 0; }
+			let v31 = null;
+			if (match30 != -1) {
+				let v32 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				v31 = v32;
+			}
+			if (v31 !== undefined) { obj18.settings = v31; }
+			let ref33 = state.stack[state.stack.length - 1].flags;
+			let match34 = -1;
+			if ((ref33 & 4) != 0) { match34 = 0; }
+			let v35 = null;
+			if (match34 != -1) {
+				let v36 = ext[2].read(state);
+				v35 = v36;
+			}
+			if (v35 !== undefined) { obj18.underlay = v35; }
+			let ref37 = state.stack[state.stack.length - 1].flags;
+			let match38 = -1;
+			if ((ref37 & 8) != 0) { match38 = 0; }
+			let v39 = null;
+			if (match38 != -1) {
+				let hidden40 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden40);
+				let v41 = ext[3].read(state);
+				hidden40.$opcode = v41;
+				let ref42 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match43 = -1;
+				if (ref42 >= 936) { match43 = 0; }
+				else if (true) { match43 = 1; }
+				if (match43 == -1) { throw new Error("no opcode matched"); }
+				let v44;
+				if (match43 == 0) {
+					let v45 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v44 = v45;
+				}
+				else if (match43 == 1) {
+					let v46 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v44 = v46;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				v39 = v44;
+			}
+			if (v39 !== undefined) { obj18.height = v39; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v17 = obj18;
+		}
+		else if (match16 == 1) {
+			let v47 = ext[4].read(state);
+			v17 = v47;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr11.push(v17);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr11 !== undefined) { obj0.tiles = arr11; }
+	let hidden48 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden48);
+	let v49 = ext[5].read(state);
+	hidden48.$opcode = v49;
+	let ref50 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match51 = -1;
+	if (ref50 >= 498) { match51 = 0; }
+	else if (true) { match51 = 1; }
+	if (match51 == -1) { throw new Error("no opcode matched"); }
+	let v52;
+	if (match51 == 0) {
+		v52 = null;
+	}
+	else if (match51 == 1) {
+		let v53 = ext[6].read(state);
+		v52 = v53;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v52 !== undefined) { obj0.olddata = v52; }
+	let hidden54 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden54);
+	let v55 = ext[7].read(state);
+	hidden54.$opcode = v55;
+	let ref56 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match57 = -1;
+	if (ref56 >= 765) { match57 = 0; }
+	else if (true) { match57 = 1; }
+	if (match57 == -1) { throw new Error("no opcode matched"); }
+	let v58;
+	if (match57 == 0) {
+		let v59 = ext[8].read(state);
+		v58 = v59;
+	}
+	else if (match57 == 1) {
+		v58 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v58 !== undefined) { obj0.nonmembarea = v58; }
+	let obj60 = {};
+	let hidden61 = { $opcode: 0 };
+	state.stack.push(obj60);
+	state.hiddenstack.push(hidden61);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			break;
+		}
+		let v62 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden61.$opcode = v62;
+		switch (v62) {
+			case 0: {
+				let obj63 = {};
+				let hidden64 = {};
+				state.stack.push(obj63);
+				state.hiddenstack.push(hidden64);
+				let v65 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v65 !== undefined) { obj63.flags = v65; }
+				let ref66 = state.stack[state.stack.length - 1].flags;
+				let match67 = -1;
+				if ((ref66 & 1) != 0) { match67 = 0; }
+				let v68 = null;
+				if (match67 != -1) {
+					let hidden69 = { $index: 0, $length: 4 };
+					state.hiddenstack.push(hidden69);
+					state.stack.push({});
+					let arr70 = [];
+					for (let i71 = 0; i71 < 4; i71++) {
+						hidden69.$index = i71;
+						let v72 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						arr70.push(v72);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v68 = arr70;
+				}
+				if (v68 !== undefined) { obj63.unk01 = v68; }
+				let ref73 = state.stack[state.stack.length - 1].flags;
+				let match74 = -1;
+				if ((ref73 & 2) != 0) { match74 = 0; }
+				let v75 = null;
+				if (match74 != -1) {
+					let v76 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v75 = v76;
+				}
+				if (v75 !== undefined) { obj63.unk02 = v75; }
+				let ref77 = state.stack[state.stack.length - 1].flags;
+				let match78 = -1;
+				if ((ref77 & 4) != 0) { match78 = 0; }
+				let v79 = null;
+				if (match78 != -1) {
+					let v80 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v79 = v80;
+				}
+				if (v79 !== undefined) { obj63.unk04 = v79; }
+				let ref81 = state.stack[state.stack.length - 1].flags;
+				let match82 = -1;
+				if ((ref81 & 8) != 0) { match82 = 0; }
+				let v83 = null;
+				if (match82 != -1) {
+					let v84 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v83 = v84;
+				}
+				if (v83 !== undefined) { obj63.unk08 = v83; }
+				let ref85 = state.stack[state.stack.length - 1].flags;
+				let match86 = -1;
+				if ((ref85 & 16) != 0) { match86 = 0; }
+				let v87 = null;
+				if (match86 != -1) {
+					let v88 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v89 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v90 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr91 = [v88, v89, v90];
+					v87 = arr91;
+				}
+				if (v87 !== undefined) { obj63.unk10 = v87; }
+				let ref92 = state.stack[state.stack.length - 1].flags;
+				let match93 = -1;
+				if ((ref92 & 32) != 0) { match93 = 0; }
+				let v94 = null;
+				if (match93 != -1) {
+					let hidden95 = { $index: 0, $length: 4 };
+					state.hiddenstack.push(hidden95);
+					state.stack.push({});
+					let arr96 = [];
+					for (let i97 = 0; i97 < 4; i97++) {
+						hidden95.$index = i97;
+						let v98 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						arr96.push(v98);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v94 = arr96;
+				}
+				if (v94 !== undefined) { obj63.unk20 = v94; }
+				let ref99 = state.stack[state.stack.length - 1].flags;
+				let match100 = -1;
+				if ((ref99 & 64) != 0) { match100 = 0; }
+				let v101 = null;
+				if (match100 != -1) {
+					let v102 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v101 = v102;
+				}
+				if (v101 !== undefined) { obj63.unk40 = v101; }
+				let ref103 = state.stack[state.stack.length - 1].flags;
+				let match104 = -1;
+				if ((ref103 & 128) != 0) { match104 = 0; }
+				let v105 = null;
+				if (match104 != -1) {
+					let hidden106 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden106);
+					let v107 = ext[9].read(state);
+					hidden106.$opcode = v107;
+					let ref108 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match109 = -1;
+					if (ref108 >= 759) { match109 = 0; }
+					else if (true) { match109 = 1; }
+					if (match109 == -1) { throw new Error("no opcode matched"); }
+					let v110;
+					if (match109 == 0) {
+						let v111 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v110 = v111;
+					}
+					else if (match109 == 1) {
+						let hidden112 = { $index: 0, $length: 6 };
+						state.hiddenstack.push(hidden112);
+						state.stack.push({});
+						let arr113 = [];
+						for (let i114 = 0; i114 < 6; i114++) {
+							hidden112.$index = i114;
+							let v115 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							arr113.push(v115);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						v110 = arr113;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					v105 = v110;
+				}
+				if (v105 !== undefined) { obj63.unk80 = v105; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj60.unk00 = obj63;
+				break;
+			}
+			case 1: {
+				let v116 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden117 = { $index: 0, $length: v116 };
+				state.hiddenstack.push(hidden117);
+				state.stack.push({});
+				let arr118 = [];
+				for (let i119 = 0; i119 < v116; i119++) {
+					hidden117.$index = i119;
+					let obj120 = {};
+					let hidden121 = {};
+					state.stack.push(obj120);
+					state.hiddenstack.push(hidden121);
+					let v122 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v122 !== undefined) { obj120.byte2 = v122; }
+					let v123 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v123 !== undefined) { obj120.short0 = v123; }
+					let v124 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v124 !== undefined) { obj120.short1 = v124; }
+					let v125 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v125 !== undefined) { obj120.short2 = v125; }
+					let v126 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden127 = { $index: 0, $length: v126 };
+					state.hiddenstack.push(hidden127);
+					state.stack.push({});
+					let arr128 = [];
+					for (let i129 = 0; i129 < v126; i129++) {
+						hidden127.$index = i129;
+						let hidden130 = { $index: 0, $length: 4 };
+						state.hiddenstack.push(hidden130);
+						state.stack.push({});
+						let arr131 = [];
+						for (let i132 = 0; i132 < 4; i132++) {
+							hidden130.$index = i132;
+							let v133 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							arr131.push(v133);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						arr128.push(arr131);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr128 !== undefined) { obj120.array5 = arr128; }
+					let v134 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v134 !== undefined) { obj120.short3 = v134; }
+					let v135 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v135 !== undefined) { obj120.short4 = v135; }
+					let v136 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v136 !== undefined) { obj120.extraflags = v136; }
+					let hidden137 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden137);
+					let v138 = ext[10].read(state);
+					hidden137.$opcode = v138;
+					let ref139 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match140 = -1;
+					if (ref139 >= 804) { match140 = 0; }
+					else if (true) { match140 = 1; }
+					if (match140 == -1) { throw new Error("no opcode matched"); }
+					let v141;
+					if (match140 == 0) {
+						let v142 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v141 = v142;
+					}
+					else if (match140 == 1) {
+						v141 = 0;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v141 !== undefined) { obj120.extra08 = v141; }
+					let ref143 = state.stack[state.stack.length - 1].extraflags;
+					let match144 = -1;
+					if ((ref143 & 31) == 31) { match144 = 0; }
+					let v145 = null;
+					if (match144 != -1) {
+						let v146 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v145 = v146;
+					}
+					if (v145 !== undefined) { obj120.extra1f = v145; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr118.push(obj120);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj60.unk01 = arr118;
+				break;
+			}
+			case 2: {
+				let hidden147 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden147);
+				state.stack.push({});
+				let arr148 = [];
+				for (let i149 = 0; i149 < 3; i149++) {
+					hidden147.$index = i149;
+					let hidden150 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden150);
+					let v151 = ext[11].read(state);
+					hidden150.$opcode = v151;
+					let ref152 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match153 = -1;
+					if (ref152 >= 780) { match153 = 0; }
+					else if (true) { match153 = 1; }
+					if (match153 == -1) { throw new Error("no opcode matched"); }
+					let v154;
+					if (match153 == 0) {
+						let v155 = state.view.getFloat32(state.scan);
+						state.scan += 4;
+						v154 = v155;
+					}
+					else if (match153 == 1) {
+						let v156 = state.view.getInt8(state.scan);
+						state.scan += 1;
+						v154 = v156;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr148.push(v154);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj60.unk02 = arr148;
+				break;
+			}
+			case 3: {
+				let v157 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				let v158 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				let arr159 = [v157, v158];
+				obj60.unk03 = arr159;
+				break;
+			}
+			case 128: {
+				let obj160 = {};
+				let hidden161 = {};
+				state.stack.push(obj160);
+				state.hiddenstack.push(hidden161);
+				let v162 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v162 !== undefined) { obj160.skybox = v162; }
+				let v163 = ext[12].read(state);
+				if (v163 !== undefined) { obj160.always00 = v163; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj60.skyboxdata = obj160;
+				break;
+			}
+			case 129: {
+				let hidden164 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden164);
+				state.stack.push({});
+				let arr165 = [];
+				for (let i166 = 0; i166 < 4; i166++) {
+					hidden164.$index = i166;
+					let obj167 = {};
+					let hidden168 = {};
+					state.stack.push(obj167);
+					state.hiddenstack.push(hidden168);
+					let v169 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v169 !== undefined) { obj167.flag = v169; }
+					let ref170 = state.stack[state.stack.length - 1].flag;
+					let match171 = -1;
+					if ((ref170 & 1) != 0) { match171 = 0; }
+					let v172 = null;
+					if (match171 != -1) {
+						let v173 = ext[13].read(state);
+						v172 = v173;
+					}
+					if (v172 !== undefined) { obj167.data = v172; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr165.push(obj167);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj60.unk81 = arr165;
+				break;
+			}
+			case 130: {
+				obj60.unk82 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v62.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (obj60 !== undefined) { obj0.extra = obj60; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden174 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden174);
+	let w175 = value.magic;
+	let hidden176 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden176);
+	hidden176.$opcode = ext[0].readConst(state);
+	let ref177 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match178 = -1;
+	if (ref177 >= 936) { match178 = 0; }
+	else if (true) { match178 = 1; }
+	if (match178 == -1) { throw new Error("no opcode matched"); }
+	if (match178 == 0) {
+		if (!Array.isArray(w175)) { throw new Error("array expected"); }
+		let w179 = w175[0];
+		if (typeof w179 != "number" || w179 > 4294967295 || w179 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w179, state.scan);
+		state.scan += 4;
+		let w180 = w175[1];
+		if (typeof w180 != "number" || w180 > 255 || w180 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w180, state.scan);
+		state.scan += 1;
+	}
+	else if (match178 == 1) {
+		if (w175 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w181 = value.tiles;
+	if (!Array.isArray(w181)) { throw new Error("array expected"); }
+	let w182 = w181.length;
+	if (w182 != 16384) { throw new Error("expected constant 16384 was not present during write"); }
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w181.length });
+	for (let i183 = 0; i183 < w181.length; i183++) {
+		let w184 = w181[i183];
+		let hidden185 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden185);
+		hidden185.$opcode = ext[1].readConst(state);
+		let ref186 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match187 = -1;
+		if (ref186 >= 750) { match187 = 0; }
+		else if (true) { match187 = 1; }
+		if (match187 == -1) { throw new Error("no opcode matched"); }
+		if (match187 == 0) {
+			if (typeof w184 != "object" || !w184) { throw new Error("object expected"); }
+			let hidden188 = {};
+			state.stack.push(w184);
+			state.hiddenstack.push(hidden188);
+			let w189 = w184.flags;
+			if (typeof w189 != "number" || w189 > 255 || w189 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w189, state.scan);
+			state.scan += 1;
+			let w190 = w184.shape;
+			if (w190 != null) {
+				if (typeof w190 != "number" || w190 > 255 || w190 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w190, state.scan);
+				state.scan += 1;
+			}
+			let w191 = w184.overlay;
+			if (w191 != null) {
+				ext[2].write(state, w191);
+			}
+			let w192 = w184.settings;
+			if (w192 != null) {
+				if (typeof w192 != "number" || w192 > 255 || w192 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w192, state.scan);
+				state.scan += 1;
+			}
+			let w193 = w184.underlay;
+			if (w193 != null) {
+				ext[2].write(state, w193);
+			}
+			let w194 = w184.height;
+			if (w194 != null) {
+				let hidden195 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden195);
+				hidden195.$opcode = ext[3].readConst(state);
+				let ref196 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match197 = -1;
+				if (ref196 >= 936) { match197 = 0; }
+				else if (true) { match197 = 1; }
+				if (match197 == -1) { throw new Error("no opcode matched"); }
+				if (match197 == 0) {
+					if (typeof w194 != "number" || w194 > 65535 || w194 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w194, state.scan);
+					state.scan += 2;
+				}
+				else if (match197 == 1) {
+					if (typeof w194 != "number" || w194 > 255 || w194 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w194, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match187 == 1) {
+			ext[4].write(state, w184);
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w198 = value.olddata;
+	let hidden199 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden199);
+	hidden199.$opcode = ext[5].readConst(state);
+	let ref200 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match201 = -1;
+	if (ref200 >= 498) { match201 = 0; }
+	else if (true) { match201 = 1; }
+	if (match201 == -1) { throw new Error("no opcode matched"); }
+	if (match201 == 0) {
+		if (w198 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	else if (match201 == 1) {
+		ext[6].write(state, w198);
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w202 = value.nonmembarea;
+	let hidden203 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden203);
+	hidden203.$opcode = ext[7].readConst(state);
+	let ref204 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match205 = -1;
+	if (ref204 >= 765) { match205 = 0; }
+	else if (true) { match205 = 1; }
+	if (match205 == -1) { throw new Error("no opcode matched"); }
+	if (match205 == 0) {
+		ext[8].write(state, w202);
+	}
+	else if (match205 == 1) {
+		if (w202 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w206 = value.extra;
+	if (typeof w206 != "object" || !w206) { throw new Error("oject expected"); }
+	state.stack.push(w206);
+	state.hiddenstack.push({});
+	for (let key207 in w206) {
+		if (key207.startsWith("$")) { continue; }
+		switch (key207) {
+			case "unk00": {
+				if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(0, state.scan);
+				state.scan += 1;
+				let w208 = w206[key207];
+				if (typeof w208 != "object" || !w208) { throw new Error("object expected"); }
+				let hidden209 = {};
+				state.stack.push(w208);
+				state.hiddenstack.push(hidden209);
+				let w210 = w208.flags;
+				if (typeof w210 != "number" || w210 > 255 || w210 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w210, state.scan);
+				state.scan += 1;
+				let w211 = w208.unk01;
+				if (w211 != null) {
+					if (!Array.isArray(w211)) { throw new Error("array expected"); }
+					let w212 = w211.length;
+					if (w212 != 4) { throw new Error("expected constant 4 was not present during write"); }
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w211.length });
+					for (let i213 = 0; i213 < w211.length; i213++) {
+						let w214 = w211[i213];
+						if (typeof w214 != "number" || w214 > 255 || w214 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w214, state.scan);
+						state.scan += 1;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w215 = w208.unk02;
+				if (w215 != null) {
+					if (typeof w215 != "number" || w215 > 65535 || w215 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w215, state.scan);
+					state.scan += 2;
+				}
+				let w216 = w208.unk04;
+				if (w216 != null) {
+					if (typeof w216 != "number" || w216 > 65535 || w216 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w216, state.scan);
+					state.scan += 2;
+				}
+				let w217 = w208.unk08;
+				if (w217 != null) {
+					if (typeof w217 != "number" || w217 > 65535 || w217 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w217, state.scan);
+					state.scan += 2;
+				}
+				let w218 = w208.unk10;
+				if (w218 != null) {
+					if (!Array.isArray(w218)) { throw new Error("array expected"); }
+					let w219 = w218[0];
+					if (typeof w219 != "number" || w219 > 65535 || w219 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w219, state.scan);
+					state.scan += 2;
+					let w220 = w218[1];
+					if (typeof w220 != "number" || w220 > 65535 || w220 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w220, state.scan);
+					state.scan += 2;
+					let w221 = w218[2];
+					if (typeof w221 != "number" || w221 > 65535 || w221 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w221, state.scan);
+					state.scan += 2;
+				}
+				let w222 = w208.unk20;
+				if (w222 != null) {
+					if (!Array.isArray(w222)) { throw new Error("array expected"); }
+					let w223 = w222.length;
+					if (w223 != 4) { throw new Error("expected constant 4 was not present during write"); }
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w222.length });
+					for (let i224 = 0; i224 < w222.length; i224++) {
+						let w225 = w222[i224];
+						if (typeof w225 != "number" || w225 > 255 || w225 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w225, state.scan);
+						state.scan += 1;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w226 = w208.unk40;
+				if (w226 != null) {
+					if (typeof w226 != "number" || w226 > 65535 || w226 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w226, state.scan);
+					state.scan += 2;
+				}
+				let w227 = w208.unk80;
+				if (w227 != null) {
+					let hidden228 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden228);
+					hidden228.$opcode = ext[9].readConst(state);
+					let ref229 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match230 = -1;
+					if (ref229 >= 759) { match230 = 0; }
+					else if (true) { match230 = 1; }
+					if (match230 == -1) { throw new Error("no opcode matched"); }
+					if (match230 == 0) {
+						if (typeof w227 != "number" || w227 > 65535 || w227 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w227, state.scan);
+						state.scan += 2;
+					}
+					else if (match230 == 1) {
+						if (!Array.isArray(w227)) { throw new Error("array expected"); }
+						let w231 = w227.length;
+						if (w231 != 6) { throw new Error("expected constant 6 was not present during write"); }
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w227.length });
+						for (let i232 = 0; i232 < w227.length; i232++) {
+							let w233 = w227[i232];
+							if (typeof w233 != "number" || w233 > 65535 || w233 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w233, state.scan);
+							state.scan += 2;
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk01": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w234 = w206[key207];
+				if (!Array.isArray(w234)) { throw new Error("array expected"); }
+				let w235 = w234.length;
+				if (typeof w235 != "number" || w235 > 255 || w235 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w235, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w234.length });
+				for (let i236 = 0; i236 < w234.length; i236++) {
+					let w237 = w234[i236];
+					if (typeof w237 != "object" || !w237) { throw new Error("object expected"); }
+					let hidden238 = {};
+					state.stack.push(w237);
+					state.hiddenstack.push(hidden238);
+					let w239 = w237.byte2;
+					if (typeof w239 != "number" || w239 > 255 || w239 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w239, state.scan);
+					state.scan += 1;
+					let w240 = w237.short0;
+					if (typeof w240 != "number" || w240 > 65535 || w240 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w240, state.scan);
+					state.scan += 2;
+					let w241 = w237.short1;
+					if (typeof w241 != "number" || w241 > 65535 || w241 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w241, state.scan);
+					state.scan += 2;
+					let w242 = w237.short2;
+					if (typeof w242 != "number" || w242 > 65535 || w242 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w242, state.scan);
+					state.scan += 2;
+					let w243 = w237.array5;
+					if (!Array.isArray(w243)) { throw new Error("array expected"); }
+					let w244 = w243.length;
+					if (typeof w244 != "number" || w244 > 255 || w244 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w244, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w243.length });
+					for (let i245 = 0; i245 < w243.length; i245++) {
+						let w246 = w243[i245];
+						if (!Array.isArray(w246)) { throw new Error("array expected"); }
+						let w247 = w246.length;
+						if (w247 != 4) { throw new Error("expected constant 4 was not present during write"); }
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w246.length });
+						for (let i248 = 0; i248 < w246.length; i248++) {
+							let w249 = w246[i248];
+							if (typeof w249 != "number" || w249 > 255 || w249 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w249, state.scan);
+							state.scan += 1;
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					let w250 = w237.short3;
+					if (typeof w250 != "number" || w250 > 65535 || w250 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w250, state.scan);
+					state.scan += 2;
+					let w251 = w237.short4;
+					if (typeof w251 != "number" || w251 > 65535 || w251 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w251, state.scan);
+					state.scan += 2;
+					let w252 = w237.extraflags;
+					if (typeof w252 != "number" || w252 > 255 || w252 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w252, state.scan);
+					state.scan += 1;
+					let w253 = w237.extra08;
+					let hidden254 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden254);
+					hidden254.$opcode = ext[10].readConst(state);
+					let ref255 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match256 = -1;
+					if (ref255 >= 804) { match256 = 0; }
+					else if (true) { match256 = 1; }
+					if (match256 == -1) { throw new Error("no opcode matched"); }
+					if (match256 == 0) {
+						if (typeof w253 != "number" || w253 > 65535 || w253 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w253, state.scan);
+						state.scan += 2;
+					}
+					else if (match256 == 1) {
+						if (w253 != 0) { throw new Error("expected constant 0 was not present during write"); }
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w257 = w237.extra1f;
+					if (w257 != null) {
+						if (typeof w257 != "number" || w257 > 65535 || w257 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w257, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk02": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w258 = w206[key207];
+				if (!Array.isArray(w258)) { throw new Error("array expected"); }
+				let w259 = w258.length;
+				if (w259 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w258.length });
+				for (let i260 = 0; i260 < w258.length; i260++) {
+					let w261 = w258[i260];
+					let hidden262 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden262);
+					hidden262.$opcode = ext[11].readConst(state);
+					let ref263 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match264 = -1;
+					if (ref263 >= 780) { match264 = 0; }
+					else if (true) { match264 = 1; }
+					if (match264 == -1) { throw new Error("no opcode matched"); }
+					if (match264 == 0) {
+						if (typeof w261 != "number" || w261 > 1.7976931348623157e+308 || w261 < 5e-324) { throw new Error(); }
+						state.buffer.writeFloatBE(w261, state.scan);
+						state.scan += 4;
+					}
+					else if (match264 == 1) {
+						if (typeof w261 != "number" || w261 > 127 || w261 < -128) { throw new Error(); }
+						state.buffer.writeInt8(w261, state.scan);
+						state.scan += 1;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk03": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w265 = w206[key207];
+				if (!Array.isArray(w265)) { throw new Error("array expected"); }
+				let w266 = w265[0];
+				if (typeof w266 != "number" || w266 > 32767 || w266 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w266, state.scan);
+				state.scan += 2;
+				let w267 = w265[1];
+				if (typeof w267 != "number" || w267 > 1.7976931348623157e+308 || w267 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w267, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "skyboxdata": {
+				if (typeof 128 != "number" || 128 > 255 || 128 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(128, state.scan);
+				state.scan += 1;
+				let w268 = w206[key207];
+				if (typeof w268 != "object" || !w268) { throw new Error("object expected"); }
+				let hidden269 = {};
+				state.stack.push(w268);
+				state.hiddenstack.push(hidden269);
+				let w270 = w268.skybox;
+				if (typeof w270 != "number" || w270 > 65535 || w270 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w270, state.scan);
+				state.scan += 2;
+				let w271 = w268.always00;
+				ext[12].write(state, w271);
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk81": {
+				if (typeof 129 != "number" || 129 > 255 || 129 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(129, state.scan);
+				state.scan += 1;
+				let w272 = w206[key207];
+				if (!Array.isArray(w272)) { throw new Error("array expected"); }
+				let w273 = w272.length;
+				if (w273 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w272.length });
+				for (let i274 = 0; i274 < w272.length; i274++) {
+					let w275 = w272[i274];
+					if (typeof w275 != "object" || !w275) { throw new Error("object expected"); }
+					let hidden276 = {};
+					state.stack.push(w275);
+					state.hiddenstack.push(hidden276);
+					let w277 = w275.flag;
+					if (typeof w277 != "number" || w277 > 255 || w277 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w277, state.scan);
+					state.scan += 1;
+					let w278 = w275.data;
+					if (w278 != null) {
+						ext[13].write(state, w278);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk82": {
+				if (typeof 130 != "number" || 130 > 255 || 130 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(130, state.scan);
+				state.scan += 1;
+				let w279 = w206[key207];
+				if (w279 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key207);
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1021 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_tiles_nxt.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xf80cbcf5;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		switch (v2) {
+			case 106: {
+				let v3 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				obj0.magic = v3;
+				break;
+			}
+			case 0: {
+				let hidden4 = { $index: 0, $length: 4356 };
+				state.hiddenstack.push(hidden4);
+				state.stack.push({});
+				let arr5 = [];
+				for (let i6 = 0; i6 < 4356; i6++) {
+					hidden4.$index = i6;
+					let obj7 = {};
+					let hidden8 = {};
+					state.stack.push(obj7);
+					state.hiddenstack.push(hidden8);
+					let v9 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v9 !== undefined) { obj7.flags = v9; }
+					let hidden10 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden10);
+					let v11 = ext[0].read(state);
+					hidden10.$opcode = v11;
+					let ref12 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match13 = -1;
+					if (ref12 >= 936) { match13 = 0; }
+					else if (true) { match13 = 1; }
+					if (match13 == -1) { throw new Error("no opcode matched"); }
+					let v14;
+					if (match13 == 0) {
+						let v15 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v14 = v15;
+					}
+					else if (match13 == 1) {
+						let v16 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v14 = v16;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v14 !== undefined) { obj7.height = v14; }
+					let ref17 = state.stack[state.stack.length - 1].flags;
+					let match18 = -1;
+					if ((ref17 & 1) != 0) { match18 = 0; }
+					let v19 = null;
+					if (match18 != -1) {
+						let obj20 = {};
+						let hidden21 = {};
+						state.stack.push(obj20);
+						state.hiddenstack.push(hidden21);
+						let ref22 = state.stack[state.stack.length - 2].flags;
+						let match23 = -1;
+						if ((ref22 & 16) != 0) { match23 = 0; }
+						let v24 = null;
+						if (match23 != -1) {
+							let hidden25 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden25);
+							let v26 = ext[1].read(state);
+							hidden25.$opcode = v26;
+							let ref27 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match28 = -1;
+							if (ref27 >= 936) { match28 = 0; }
+							else if (true) { match28 = 1; }
+							if (match28 == -1) { throw new Error("no opcode matched"); }
+							let v29;
+							if (match28 == 0) {
+								let v30 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v29 = v30;
+							}
+							else if (match28 == 1) {
+								let v31 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v29 = v31;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							v24 = v29;
+						}
+						if (v24 !== undefined) { obj20.waterheight = v24; }
+						let v32 = ext[2].read(state);
+						if (v32 !== undefined) { obj20.underlay = v32; }
+						let ref33 = state.stack[state.stack.length - 1].underlay;
+						let match34 = -1;
+						if (ref33 != 0) { match34 = 0; }
+						let v35 = null;
+						if (match34 != -1) {
+							let v36 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							v35 = v36;
+						}
+						if (v35 !== undefined) { obj20.underlaycolor = v35; }
+						let v37 = ext[2].read(state);
+						if (v37 !== undefined) { obj20.overlay = v37; }
+						let ref38 = state.stack[state.stack.length - 2].flags;
+						let match39 = -1;
+						if ((ref38 & 16) != 0) { match39 = 0; }
+						let v40 = null;
+						if (match39 != -1) {
+							let v41 = ext[2].read(state);
+							v40 = v41;
+						}
+						if (v40 !== undefined) { obj20.overlay_under = v40; }
+						let ref42 = state.stack[state.stack.length - 1].overlay;
+						let match43 = -1;
+						if (ref42 != 0) { match43 = 0; }
+						let v44 = null;
+						if (match43 != -1) {
+							let v45 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							v44 = v45;
+						}
+						if (v44 !== undefined) { obj20.shape = v44; }
+						let ref46 = state.stack[state.stack.length - 1].overlay;
+						let ref47 = state.stack[state.stack.length - 2].flags;
+						let match48 = -1;
+						if (ref46 != 0 && (ref47 & 16) != 0) { match48 = 0; }
+						let v49 = null;
+						if (match48 != -1) {
+							let v50 = ext[2].read(state);
+							v49 = v50;
+						}
+						if (v49 !== undefined) { obj20.underlay_under = v49; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v19 = obj20;
+					}
+					if (v19 !== undefined) { obj7.rest = v19; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr5.push(obj7);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.level0 = arr5;
+				break;
+			}
+			case 1: {
+				let hidden51 = { $index: 0, $length: 4356 };
+				state.hiddenstack.push(hidden51);
+				state.stack.push({});
+				let arr52 = [];
+				for (let i53 = 0; i53 < 4356; i53++) {
+					hidden51.$index = i53;
+					let obj54 = {};
+					let hidden55 = {};
+					state.stack.push(obj54);
+					state.hiddenstack.push(hidden55);
+					let v56 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v56 !== undefined) { obj54.flags = v56; }
+					let hidden57 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden57);
+					let v58 = ext[3].read(state);
+					hidden57.$opcode = v58;
+					let ref59 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match60 = -1;
+					if (ref59 >= 936) { match60 = 0; }
+					else if (true) { match60 = 1; }
+					if (match60 == -1) { throw new Error("no opcode matched"); }
+					let v61;
+					if (match60 == 0) {
+						let v62 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v61 = v62;
+					}
+					else if (match60 == 1) {
+						let v63 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v61 = v63;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v61 !== undefined) { obj54.height = v61; }
+					let ref64 = state.stack[state.stack.length - 1].flags;
+					let match65 = -1;
+					if ((ref64 & 1) != 0) { match65 = 0; }
+					let v66 = null;
+					if (match65 != -1) {
+						let obj67 = {};
+						let hidden68 = {};
+						state.stack.push(obj67);
+						state.hiddenstack.push(hidden68);
+						let ref69 = state.stack[state.stack.length - 2].flags;
+						let match70 = -1;
+						if ((ref69 & 16) != 0) { match70 = 0; }
+						let v71 = null;
+						if (match70 != -1) {
+							let hidden72 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden72);
+							let v73 = ext[4].read(state);
+							hidden72.$opcode = v73;
+							let ref74 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match75 = -1;
+							if (ref74 >= 936) { match75 = 0; }
+							else if (true) { match75 = 1; }
+							if (match75 == -1) { throw new Error("no opcode matched"); }
+							let v76;
+							if (match75 == 0) {
+								let v77 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v76 = v77;
+							}
+							else if (match75 == 1) {
+								let v78 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v76 = v78;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							v71 = v76;
+						}
+						if (v71 !== undefined) { obj67.waterheight = v71; }
+						let v79 = ext[2].read(state);
+						if (v79 !== undefined) { obj67.underlay = v79; }
+						let ref80 = state.stack[state.stack.length - 1].underlay;
+						let match81 = -1;
+						if (ref80 != 0) { match81 = 0; }
+						let v82 = null;
+						if (match81 != -1) {
+							let v83 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							v82 = v83;
+						}
+						if (v82 !== undefined) { obj67.underlaycolor = v82; }
+						let v84 = ext[2].read(state);
+						if (v84 !== undefined) { obj67.overlay = v84; }
+						let ref85 = state.stack[state.stack.length - 2].flags;
+						let match86 = -1;
+						if ((ref85 & 16) != 0) { match86 = 0; }
+						let v87 = null;
+						if (match86 != -1) {
+							let v88 = ext[2].read(state);
+							v87 = v88;
+						}
+						if (v87 !== undefined) { obj67.overlay_under = v87; }
+						let ref89 = state.stack[state.stack.length - 1].overlay;
+						let match90 = -1;
+						if (ref89 != 0) { match90 = 0; }
+						let v91 = null;
+						if (match90 != -1) {
+							let v92 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							v91 = v92;
+						}
+						if (v91 !== undefined) { obj67.shape = v91; }
+						let ref93 = state.stack[state.stack.length - 1].overlay;
+						let ref94 = state.stack[state.stack.length - 2].flags;
+						let match95 = -1;
+						if (ref93 != 0 && (ref94 & 16) != 0) { match95 = 0; }
+						let v96 = null;
+						if (match95 != -1) {
+							let v97 = ext[2].read(state);
+							v96 = v97;
+						}
+						if (v96 !== undefined) { obj67.underlay_under = v96; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v66 = obj67;
+					}
+					if (v66 !== undefined) { obj54.rest = v66; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr52.push(obj54);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.level1 = arr52;
+				break;
+			}
+			case 2: {
+				let hidden98 = { $index: 0, $length: 4356 };
+				state.hiddenstack.push(hidden98);
+				state.stack.push({});
+				let arr99 = [];
+				for (let i100 = 0; i100 < 4356; i100++) {
+					hidden98.$index = i100;
+					let obj101 = {};
+					let hidden102 = {};
+					state.stack.push(obj101);
+					state.hiddenstack.push(hidden102);
+					let v103 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v103 !== undefined) { obj101.flags = v103; }
+					let hidden104 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden104);
+					let v105 = ext[5].read(state);
+					hidden104.$opcode = v105;
+					let ref106 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match107 = -1;
+					if (ref106 >= 936) { match107 = 0; }
+					else if (true) { match107 = 1; }
+					if (match107 == -1) { throw new Error("no opcode matched"); }
+					let v108;
+					if (match107 == 0) {
+						let v109 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v108 = v109;
+					}
+					else if (match107 == 1) {
+						let v110 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v108 = v110;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v108 !== undefined) { obj101.height = v108; }
+					let ref111 = state.stack[state.stack.length - 1].flags;
+					let match112 = -1;
+					if ((ref111 & 1) != 0) { match112 = 0; }
+					let v113 = null;
+					if (match112 != -1) {
+						let obj114 = {};
+						let hidden115 = {};
+						state.stack.push(obj114);
+						state.hiddenstack.push(hidden115);
+						let ref116 = state.stack[state.stack.length - 2].flags;
+						let match117 = -1;
+						if ((ref116 & 16) != 0) { match117 = 0; }
+						let v118 = null;
+						if (match117 != -1) {
+							let hidden119 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden119);
+							let v120 = ext[6].read(state);
+							hidden119.$opcode = v120;
+							let ref121 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match122 = -1;
+							if (ref121 >= 936) { match122 = 0; }
+							else if (true) { match122 = 1; }
+							if (match122 == -1) { throw new Error("no opcode matched"); }
+							let v123;
+							if (match122 == 0) {
+								let v124 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v123 = v124;
+							}
+							else if (match122 == 1) {
+								let v125 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v123 = v125;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							v118 = v123;
+						}
+						if (v118 !== undefined) { obj114.waterheight = v118; }
+						let v126 = ext[2].read(state);
+						if (v126 !== undefined) { obj114.underlay = v126; }
+						let ref127 = state.stack[state.stack.length - 1].underlay;
+						let match128 = -1;
+						if (ref127 != 0) { match128 = 0; }
+						let v129 = null;
+						if (match128 != -1) {
+							let v130 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							v129 = v130;
+						}
+						if (v129 !== undefined) { obj114.underlaycolor = v129; }
+						let v131 = ext[2].read(state);
+						if (v131 !== undefined) { obj114.overlay = v131; }
+						let ref132 = state.stack[state.stack.length - 2].flags;
+						let match133 = -1;
+						if ((ref132 & 16) != 0) { match133 = 0; }
+						let v134 = null;
+						if (match133 != -1) {
+							let v135 = ext[2].read(state);
+							v134 = v135;
+						}
+						if (v134 !== undefined) { obj114.overlay_under = v134; }
+						let ref136 = state.stack[state.stack.length - 1].overlay;
+						let match137 = -1;
+						if (ref136 != 0) { match137 = 0; }
+						let v138 = null;
+						if (match137 != -1) {
+							let v139 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							v138 = v139;
+						}
+						if (v138 !== undefined) { obj114.shape = v138; }
+						let ref140 = state.stack[state.stack.length - 1].overlay;
+						let ref141 = state.stack[state.stack.length - 2].flags;
+						let match142 = -1;
+						if (ref140 != 0 && (ref141 & 16) != 0) { match142 = 0; }
+						let v143 = null;
+						if (match142 != -1) {
+							let v144 = ext[2].read(state);
+							v143 = v144;
+						}
+						if (v143 !== undefined) { obj114.underlay_under = v143; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v113 = obj114;
+					}
+					if (v113 !== undefined) { obj101.rest = v113; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr99.push(obj101);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.level2 = arr99;
+				break;
+			}
+			case 3: {
+				let hidden145 = { $index: 0, $length: 4356 };
+				state.hiddenstack.push(hidden145);
+				state.stack.push({});
+				let arr146 = [];
+				for (let i147 = 0; i147 < 4356; i147++) {
+					hidden145.$index = i147;
+					let obj148 = {};
+					let hidden149 = {};
+					state.stack.push(obj148);
+					state.hiddenstack.push(hidden149);
+					let v150 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v150 !== undefined) { obj148.flags = v150; }
+					let hidden151 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden151);
+					let v152 = ext[7].read(state);
+					hidden151.$opcode = v152;
+					let ref153 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match154 = -1;
+					if (ref153 >= 936) { match154 = 0; }
+					else if (true) { match154 = 1; }
+					if (match154 == -1) { throw new Error("no opcode matched"); }
+					let v155;
+					if (match154 == 0) {
+						let v156 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v155 = v156;
+					}
+					else if (match154 == 1) {
+						let v157 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v155 = v157;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					if (v155 !== undefined) { obj148.height = v155; }
+					let ref158 = state.stack[state.stack.length - 1].flags;
+					let match159 = -1;
+					if ((ref158 & 1) != 0) { match159 = 0; }
+					let v160 = null;
+					if (match159 != -1) {
+						let obj161 = {};
+						let hidden162 = {};
+						state.stack.push(obj161);
+						state.hiddenstack.push(hidden162);
+						let ref163 = state.stack[state.stack.length - 2].flags;
+						let match164 = -1;
+						if ((ref163 & 16) != 0) { match164 = 0; }
+						let v165 = null;
+						if (match164 != -1) {
+							let hidden166 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden166);
+							let v167 = ext[8].read(state);
+							hidden166.$opcode = v167;
+							let ref168 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match169 = -1;
+							if (ref168 >= 936) { match169 = 0; }
+							else if (true) { match169 = 1; }
+							if (match169 == -1) { throw new Error("no opcode matched"); }
+							let v170;
+							if (match169 == 0) {
+								let v171 = state.view.getUint16(state.scan);
+								state.scan += 2;
+								v170 = v171;
+							}
+							else if (match169 == 1) {
+								let v172 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v170 = v172;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+							v165 = v170;
+						}
+						if (v165 !== undefined) { obj161.waterheight = v165; }
+						let v173 = ext[2].read(state);
+						if (v173 !== undefined) { obj161.underlay = v173; }
+						let ref174 = state.stack[state.stack.length - 1].underlay;
+						let match175 = -1;
+						if (ref174 != 0) { match175 = 0; }
+						let v176 = null;
+						if (match175 != -1) {
+							let v177 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							v176 = v177;
+						}
+						if (v176 !== undefined) { obj161.underlaycolor = v176; }
+						let v178 = ext[2].read(state);
+						if (v178 !== undefined) { obj161.overlay = v178; }
+						let ref179 = state.stack[state.stack.length - 2].flags;
+						let match180 = -1;
+						if ((ref179 & 16) != 0) { match180 = 0; }
+						let v181 = null;
+						if (match180 != -1) {
+							let v182 = ext[2].read(state);
+							v181 = v182;
+						}
+						if (v181 !== undefined) { obj161.overlay_under = v181; }
+						let ref183 = state.stack[state.stack.length - 1].overlay;
+						let match184 = -1;
+						if (ref183 != 0) { match184 = 0; }
+						let v185 = null;
+						if (match184 != -1) {
+							let v186 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							v185 = v186;
+						}
+						if (v185 !== undefined) { obj161.shape = v185; }
+						let ref187 = state.stack[state.stack.length - 1].overlay;
+						let ref188 = state.stack[state.stack.length - 2].flags;
+						let match189 = -1;
+						if (ref187 != 0 && (ref188 & 16) != 0) { match189 = 0; }
+						let v190 = null;
+						if (match189 != -1) {
+							let v191 = ext[2].read(state);
+							v190 = v191;
+						}
+						if (v190 !== undefined) { obj161.underlay_under = v190; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v160 = obj161;
+					}
+					if (v160 !== undefined) { obj148.rest = v160; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr146.push(obj148);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.level3 = arr146;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key192 in value) {
+		if (key192.startsWith("$")) { continue; }
+		switch (key192) {
+			case "magic": {
+				if (typeof 106 != "number" || 106 > 255 || 106 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(106, state.scan);
+				state.scan += 1;
+				let w193 = value[key192];
+				if (typeof w193 != "number" || w193 > 4294967295 || w193 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w193, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "level0": {
+				if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(0, state.scan);
+				state.scan += 1;
+				let w194 = value[key192];
+				if (!Array.isArray(w194)) { throw new Error("array expected"); }
+				let w195 = w194.length;
+				if (w195 != 4356) { throw new Error("expected constant 4356 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w194.length });
+				for (let i196 = 0; i196 < w194.length; i196++) {
+					let w197 = w194[i196];
+					if (typeof w197 != "object" || !w197) { throw new Error("object expected"); }
+					let hidden198 = {};
+					state.stack.push(w197);
+					state.hiddenstack.push(hidden198);
+					let w199 = w197.flags;
+					if (typeof w199 != "number" || w199 > 255 || w199 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w199, state.scan);
+					state.scan += 1;
+					let w200 = w197.height;
+					let hidden201 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden201);
+					hidden201.$opcode = ext[0].readConst(state);
+					let ref202 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match203 = -1;
+					if (ref202 >= 936) { match203 = 0; }
+					else if (true) { match203 = 1; }
+					if (match203 == -1) { throw new Error("no opcode matched"); }
+					if (match203 == 0) {
+						if (typeof w200 != "number" || w200 > 65535 || w200 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w200, state.scan);
+						state.scan += 2;
+					}
+					else if (match203 == 1) {
+						if (typeof w200 != "number" || w200 > 255 || w200 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w200, state.scan);
+						state.scan += 1;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w204 = w197.rest;
+					if (w204 != null) {
+						if (typeof w204 != "object" || !w204) { throw new Error("object expected"); }
+						let hidden205 = {};
+						state.stack.push(w204);
+						state.hiddenstack.push(hidden205);
+						let w206 = w204.waterheight;
+						if (w206 != null) {
+							let hidden207 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden207);
+							hidden207.$opcode = ext[1].readConst(state);
+							let ref208 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match209 = -1;
+							if (ref208 >= 936) { match209 = 0; }
+							else if (true) { match209 = 1; }
+							if (match209 == -1) { throw new Error("no opcode matched"); }
+							if (match209 == 0) {
+								if (typeof w206 != "number" || w206 > 65535 || w206 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w206, state.scan);
+								state.scan += 2;
+							}
+							else if (match209 == 1) {
+								if (typeof w206 != "number" || w206 > 255 || w206 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w206, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						let w210 = w204.underlay;
+						ext[2].write(state, w210);
+						let w211 = w204.underlaycolor;
+						if (w211 != null) {
+							if (typeof w211 != "number" || w211 > 65535 || w211 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w211, state.scan);
+							state.scan += 2;
+						}
+						let w212 = w204.overlay;
+						ext[2].write(state, w212);
+						let w213 = w204.overlay_under;
+						if (w213 != null) {
+							ext[2].write(state, w213);
+						}
+						let w214 = w204.shape;
+						if (w214 != null) {
+							if (typeof w214 != "number" || w214 > 255 || w214 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w214, state.scan);
+							state.scan += 1;
+						}
+						let w215 = w204.underlay_under;
+						if (w215 != null) {
+							ext[2].write(state, w215);
+						}
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "level1": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w216 = value[key192];
+				if (!Array.isArray(w216)) { throw new Error("array expected"); }
+				let w217 = w216.length;
+				if (w217 != 4356) { throw new Error("expected constant 4356 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w216.length });
+				for (let i218 = 0; i218 < w216.length; i218++) {
+					let w219 = w216[i218];
+					if (typeof w219 != "object" || !w219) { throw new Error("object expected"); }
+					let hidden220 = {};
+					state.stack.push(w219);
+					state.hiddenstack.push(hidden220);
+					let w221 = w219.flags;
+					if (typeof w221 != "number" || w221 > 255 || w221 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w221, state.scan);
+					state.scan += 1;
+					let w222 = w219.height;
+					let hidden223 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden223);
+					hidden223.$opcode = ext[3].readConst(state);
+					let ref224 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match225 = -1;
+					if (ref224 >= 936) { match225 = 0; }
+					else if (true) { match225 = 1; }
+					if (match225 == -1) { throw new Error("no opcode matched"); }
+					if (match225 == 0) {
+						if (typeof w222 != "number" || w222 > 65535 || w222 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w222, state.scan);
+						state.scan += 2;
+					}
+					else if (match225 == 1) {
+						if (typeof w222 != "number" || w222 > 255 || w222 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w222, state.scan);
+						state.scan += 1;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w226 = w219.rest;
+					if (w226 != null) {
+						if (typeof w226 != "object" || !w226) { throw new Error("object expected"); }
+						let hidden227 = {};
+						state.stack.push(w226);
+						state.hiddenstack.push(hidden227);
+						let w228 = w226.waterheight;
+						if (w228 != null) {
+							let hidden229 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden229);
+							hidden229.$opcode = ext[4].readConst(state);
+							let ref230 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match231 = -1;
+							if (ref230 >= 936) { match231 = 0; }
+							else if (true) { match231 = 1; }
+							if (match231 == -1) { throw new Error("no opcode matched"); }
+							if (match231 == 0) {
+								if (typeof w228 != "number" || w228 > 65535 || w228 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w228, state.scan);
+								state.scan += 2;
+							}
+							else if (match231 == 1) {
+								if (typeof w228 != "number" || w228 > 255 || w228 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w228, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						let w232 = w226.underlay;
+						ext[2].write(state, w232);
+						let w233 = w226.underlaycolor;
+						if (w233 != null) {
+							if (typeof w233 != "number" || w233 > 65535 || w233 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w233, state.scan);
+							state.scan += 2;
+						}
+						let w234 = w226.overlay;
+						ext[2].write(state, w234);
+						let w235 = w226.overlay_under;
+						if (w235 != null) {
+							ext[2].write(state, w235);
+						}
+						let w236 = w226.shape;
+						if (w236 != null) {
+							if (typeof w236 != "number" || w236 > 255 || w236 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w236, state.scan);
+							state.scan += 1;
+						}
+						let w237 = w226.underlay_under;
+						if (w237 != null) {
+							ext[2].write(state, w237);
+						}
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "level2": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w238 = value[key192];
+				if (!Array.isArray(w238)) { throw new Error("array expected"); }
+				let w239 = w238.length;
+				if (w239 != 4356) { throw new Error("expected constant 4356 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w238.length });
+				for (let i240 = 0; i240 < w238.length; i240++) {
+					let w241 = w238[i240];
+					if (typeof w241 != "object" || !w241) { throw new Error("object expected"); }
+					let hidden242 = {};
+					state.stack.push(w241);
+					state.hiddenstack.push(hidden242);
+					let w243 = w241.flags;
+					if (typeof w243 != "number" || w243 > 255 || w243 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w243, state.scan);
+					state.scan += 1;
+					let w244 = w241.height;
+					let hidden245 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden245);
+					hidden245.$opcode = ext[5].readConst(state);
+					let ref246 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match247 = -1;
+					if (ref246 >= 936) { match247 = 0; }
+					else if (true) { match247 = 1; }
+					if (match247 == -1) { throw new Error("no opcode matched"); }
+					if (match247 == 0) {
+						if (typeof w244 != "number" || w244 > 65535 || w244 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w244, state.scan);
+						state.scan += 2;
+					}
+					else if (match247 == 1) {
+						if (typeof w244 != "number" || w244 > 255 || w244 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w244, state.scan);
+						state.scan += 1;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w248 = w241.rest;
+					if (w248 != null) {
+						if (typeof w248 != "object" || !w248) { throw new Error("object expected"); }
+						let hidden249 = {};
+						state.stack.push(w248);
+						state.hiddenstack.push(hidden249);
+						let w250 = w248.waterheight;
+						if (w250 != null) {
+							let hidden251 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden251);
+							hidden251.$opcode = ext[6].readConst(state);
+							let ref252 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match253 = -1;
+							if (ref252 >= 936) { match253 = 0; }
+							else if (true) { match253 = 1; }
+							if (match253 == -1) { throw new Error("no opcode matched"); }
+							if (match253 == 0) {
+								if (typeof w250 != "number" || w250 > 65535 || w250 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w250, state.scan);
+								state.scan += 2;
+							}
+							else if (match253 == 1) {
+								if (typeof w250 != "number" || w250 > 255 || w250 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w250, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						let w254 = w248.underlay;
+						ext[2].write(state, w254);
+						let w255 = w248.underlaycolor;
+						if (w255 != null) {
+							if (typeof w255 != "number" || w255 > 65535 || w255 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w255, state.scan);
+							state.scan += 2;
+						}
+						let w256 = w248.overlay;
+						ext[2].write(state, w256);
+						let w257 = w248.overlay_under;
+						if (w257 != null) {
+							ext[2].write(state, w257);
+						}
+						let w258 = w248.shape;
+						if (w258 != null) {
+							if (typeof w258 != "number" || w258 > 255 || w258 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w258, state.scan);
+							state.scan += 1;
+						}
+						let w259 = w248.underlay_under;
+						if (w259 != null) {
+							ext[2].write(state, w259);
+						}
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "level3": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w260 = value[key192];
+				if (!Array.isArray(w260)) { throw new Error("array expected"); }
+				let w261 = w260.length;
+				if (w261 != 4356) { throw new Error("expected constant 4356 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w260.length });
+				for (let i262 = 0; i262 < w260.length; i262++) {
+					let w263 = w260[i262];
+					if (typeof w263 != "object" || !w263) { throw new Error("object expected"); }
+					let hidden264 = {};
+					state.stack.push(w263);
+					state.hiddenstack.push(hidden264);
+					let w265 = w263.flags;
+					if (typeof w265 != "number" || w265 > 255 || w265 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w265, state.scan);
+					state.scan += 1;
+					let w266 = w263.height;
+					let hidden267 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden267);
+					hidden267.$opcode = ext[7].readConst(state);
+					let ref268 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match269 = -1;
+					if (ref268 >= 936) { match269 = 0; }
+					else if (true) { match269 = 1; }
+					if (match269 == -1) { throw new Error("no opcode matched"); }
+					if (match269 == 0) {
+						if (typeof w266 != "number" || w266 > 65535 || w266 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w266, state.scan);
+						state.scan += 2;
+					}
+					else if (match269 == 1) {
+						if (typeof w266 != "number" || w266 > 255 || w266 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w266, state.scan);
+						state.scan += 1;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					let w270 = w263.rest;
+					if (w270 != null) {
+						if (typeof w270 != "object" || !w270) { throw new Error("object expected"); }
+						let hidden271 = {};
+						state.stack.push(w270);
+						state.hiddenstack.push(hidden271);
+						let w272 = w270.waterheight;
+						if (w272 != null) {
+							let hidden273 = { $opcode: 0 };
+							state.stack.push({});
+							state.hiddenstack.push(hidden273);
+							hidden273.$opcode = ext[8].readConst(state);
+							let ref274 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+							let match275 = -1;
+							if (ref274 >= 936) { match275 = 0; }
+							else if (true) { match275 = 1; }
+							if (match275 == -1) { throw new Error("no opcode matched"); }
+							if (match275 == 0) {
+								if (typeof w272 != "number" || w272 > 65535 || w272 < 0) { throw new Error(); }
+								state.buffer.writeUInt16BE(w272, state.scan);
+								state.scan += 2;
+							}
+							else if (match275 == 1) {
+								if (typeof w272 != "number" || w272 > 255 || w272 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w272, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						let w276 = w270.underlay;
+						ext[2].write(state, w276);
+						let w277 = w270.underlaycolor;
+						if (w277 != null) {
+							if (typeof w277 != "number" || w277 > 65535 || w277 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w277, state.scan);
+							state.scan += 2;
+						}
+						let w278 = w270.overlay;
+						ext[2].write(state, w278);
+						let w279 = w270.overlay_under;
+						if (w279 != null) {
+							ext[2].write(state, w279);
+						}
+						let w280 = w270.shape;
+						if (w280 != null) {
+							if (typeof w280 != "number" || w280 > 255 || w280 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w280, state.scan);
+							state.scan += 1;
+						}
+						let w281 = w270.underlay_under;
+						if (w281 != null) {
+							ext[2].write(state, w281);
+						}
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key192);
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
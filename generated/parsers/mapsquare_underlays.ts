@@ -0,0 +1,138 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_underlays.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xef5c6fbc;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let hidden3 = { $index: 0, $length: 3 };
+				state.hiddenstack.push(hidden3);
+				state.stack.push({});
+				let arr4 = [];
+				for (let i5 = 0; i5 < 3; i5++) {
+					hidden3.$index = i5;
+					let v6 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr4.push(v6);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.color = arr4;
+				break;
+			}
+			case 2: {
+				let v7 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.material = v7;
+				break;
+			}
+			case 3: {
+				let v8 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.material_tiling = v8;
+				break;
+			}
+			case 4: {
+				obj0.unknown_0x04 = true;
+				break;
+			}
+			case 5: {
+				obj0.unknown_0x05 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key9 in value) {
+		if (key9.startsWith("$")) { continue; }
+		switch (key9) {
+			case "color": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w10 = value[key9];
+				if (!Array.isArray(w10)) { throw new Error("array expected"); }
+				let w11 = w10.length;
+				if (w11 != 3) { throw new Error("expected constant 3 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w10.length });
+				for (let i12 = 0; i12 < w10.length; i12++) {
+					let w13 = w10[i12];
+					if (typeof w13 != "number" || w13 > 255 || w13 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w13, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "material": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w14 = value[key9];
+				if (typeof w14 != "number" || w14 > 65535 || w14 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w14, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "material_tiling": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w15 = value[key9];
+				if (typeof w15 != "number" || w15 > 65535 || w15 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w15, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_0x04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w16 = value[key9];
+				if (w16 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_0x05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w17 = value[key9];
+				if (w17 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key9);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
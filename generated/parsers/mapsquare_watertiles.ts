@@ -0,0 +1,126 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapsquare_watertiles.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x0acb9f5d;
+
+export function read(state, ext) {
+	let hidden0 = { $index: 0, $length: 4096 };
+	state.hiddenstack.push(hidden0);
+	state.stack.push({});
+	let arr1 = [];
+	for (let i2 = 0; i2 < 4096; i2++) {
+		hidden0.$index = i2;
+		let obj3 = {};
+		let hidden4 = {};
+		state.stack.push(obj3);
+		state.hiddenstack.push(hidden4);
+		let v5 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v5 !== undefined) { obj3.flags = v5; }
+		let ref6 = state.stack[state.stack.length - 1].flags;
+		let match7 = -1;
+		if ((ref6 & 1) != 0) { match7 = 0; }
+		let v8 = null;
+		if (match7 != -1) {
+			let v9 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v8 = v9;
+		}
+		if (v8 !== undefined) { obj3.shape = v8; }
+		let ref10 = state.stack[state.stack.length - 1].flags;
+		let match11 = -1;
+		if ((ref10 & 1) != 0) { match11 = 0; }
+		let v12 = null;
+		if (match11 != -1) {
+			let v13 = ext[0].read(state);
+			v12 = v13;
+		}
+		if (v12 !== undefined) { obj3.overlay = v12; }
+		let ref14 = state.stack[state.stack.length - 1].flags;
+		let match15 = -1;
+		if ((ref14 & 2) != 0) { match15 = 0; }
+		let v16 = null;
+		if (match15 != -1) {
+			let v17 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v16 = v17;
+		}
+		if (v16 !== undefined) { obj3.settings = v16; }
+		let ref18 = state.stack[state.stack.length - 1].flags;
+		let match19 = -1;
+		if ((ref18 & 4) != 0) { match19 = 0; }
+		let v20 = null;
+		if (match19 != -1) {
+			let v21 = ext[0].read(state);
+			v20 = v21;
+		}
+		if (v20 !== undefined) { obj3.underlay = v20; }
+		let ref22 = state.stack[state.stack.length - 1].flags;
+		let match23 = -1;
+		if ((ref22 & 8) != 0) { match23 = 0; }
+		let v24 = null;
+		if (match23 != -1) {
+			let v25 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v24 = v25;
+		}
+		if (v24 !== undefined) { obj3.height = v24; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr1.push(obj3);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	return arr1;
+}
+
+export function write(state, ext, value) {
+	if (!Array.isArray(value)) { throw new Error("array expected"); }
+	let w26 = value.length;
+	if (w26 != 4096) { throw new Error("expected constant 4096 was not present during write"); }
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: value.length });
+	for (let i27 = 0; i27 < value.length; i27++) {
+		let w28 = value[i27];
+		if (typeof w28 != "object" || !w28) { throw new Error("object expected"); }
+		let hidden29 = {};
+		state.stack.push(w28);
+		state.hiddenstack.push(hidden29);
+		let w30 = w28.flags;
+		if (typeof w30 != "number" || w30 > 255 || w30 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w30, state.scan);
+		state.scan += 1;
+		let w31 = w28.shape;
+		if (w31 != null) {
+			if (typeof w31 != "number" || w31 > 255 || w31 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w31, state.scan);
+			state.scan += 1;
+		}
+		let w32 = w28.overlay;
+		if (w32 != null) {
+			ext[0].write(state, w32);
+		}
+		let w33 = w28.settings;
+		if (w33 != null) {
+			if (typeof w33 != "number" || w33 > 255 || w33 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w33, state.scan);
+			state.scan += 1;
+		}
+		let w34 = w28.underlay;
+		if (w34 != null) {
+			ext[0].write(state, w34);
+		}
+		let w35 = w28.height;
+		if (w35 != null) {
+			if (typeof w35 != "number" || w35 > 255 || w35 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w35, state.scan);
+			state.scan += 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+}
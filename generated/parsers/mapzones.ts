@@ -0,0 +1,193 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapzones.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xa8ac41c5;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = ext[0].read(state);
+	if (v2 !== undefined) { obj0.internal_name = v2; }
+	let v3 = ext[0].read(state);
+	if (v3 !== undefined) { obj0.name = v3; }
+	let v4 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v4 !== undefined) { obj0.center = v4; }
+	let v5 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v5 !== undefined) { obj0.unknown_1 = v5; }
+	let v6 = state.view.getUint8(state.scan++);
+	if (v6 != 0 && v6 != 1) { throw new Error("1 or 0 expected boolean value"); }
+	if ((v6 != 0) !== undefined) { obj0.show = (v6 != 0); }
+	let v7 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v7 !== undefined) { obj0.default_zoom = v7; }
+	let v8 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v8 !== undefined) { obj0.unknown_2 = v8; }
+	let v9 = ext[1].read(state);
+	let hidden10 = { $index: 0, $length: v9 };
+	state.hiddenstack.push(hidden10);
+	state.stack.push({});
+	let arr11 = [];
+	for (let i12 = 0; i12 < v9; i12++) {
+		hidden10.$index = i12;
+		let obj13 = {};
+		let hidden14 = {};
+		state.stack.push(obj13);
+		state.hiddenstack.push(hidden14);
+		let v15 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v15 !== undefined) { obj13.plane = v15; }
+		let obj16 = {};
+		let hidden17 = {};
+		state.stack.push(obj16);
+		state.hiddenstack.push(hidden17);
+		let v18 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v18 !== undefined) { obj16.xstart = v18; }
+		let v19 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v19 !== undefined) { obj16.zstart = v19; }
+		let v20 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v20 !== undefined) { obj16.xend = v20; }
+		let v21 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v21 !== undefined) { obj16.zend = v21; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (obj16 !== undefined) { obj13.src = obj16; }
+		let obj22 = {};
+		let hidden23 = {};
+		state.stack.push(obj22);
+		state.hiddenstack.push(hidden23);
+		let v24 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v24 !== undefined) { obj22.xstart = v24; }
+		let v25 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v25 !== undefined) { obj22.zstart = v25; }
+		let v26 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v26 !== undefined) { obj22.xend = v26; }
+		let v27 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v27 !== undefined) { obj22.zend = v27; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (obj22 !== undefined) { obj13.dst = obj22; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr11.push(obj13);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr11 !== undefined) { obj0.bounds = arr11; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden28 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden28);
+	let w29 = value.internal_name;
+	ext[0].write(state, w29);
+	let w30 = value.name;
+	ext[0].write(state, w30);
+	let w31 = value.center;
+	if (typeof w31 != "number" || w31 > 4294967295 || w31 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w31, state.scan);
+	state.scan += 4;
+	let w32 = value.unknown_1;
+	if (typeof w32 != "number" || w32 > 4294967295 || w32 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w32, state.scan);
+	state.scan += 4;
+	let w33 = value.show;
+	if (typeof w33 != "boolean") { throw new Error("boolean expected"); }
+	state.buffer.writeUInt8(+w33, state.scan++);
+	let w34 = value.default_zoom;
+	if (typeof w34 != "number" || w34 > 255 || w34 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w34, state.scan);
+	state.scan += 1;
+	let w35 = value.unknown_2;
+	if (typeof w35 != "number" || w35 > 255 || w35 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w35, state.scan);
+	state.scan += 1;
+	let w36 = value.bounds;
+	if (!Array.isArray(w36)) { throw new Error("array expected"); }
+	let w37 = w36.length;
+	ext[1].write(state, w37);
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w36.length });
+	for (let i38 = 0; i38 < w36.length; i38++) {
+		let w39 = w36[i38];
+		if (typeof w39 != "object" || !w39) { throw new Error("object expected"); }
+		let hidden40 = {};
+		state.stack.push(w39);
+		state.hiddenstack.push(hidden40);
+		let w41 = w39.plane;
+		if (typeof w41 != "number" || w41 > 255 || w41 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w41, state.scan);
+		state.scan += 1;
+		let w42 = w39.src;
+		if (typeof w42 != "object" || !w42) { throw new Error("object expected"); }
+		let hidden43 = {};
+		state.stack.push(w42);
+		state.hiddenstack.push(hidden43);
+		let w44 = w42.xstart;
+		if (typeof w44 != "number" || w44 > 65535 || w44 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w44, state.scan);
+		state.scan += 2;
+		let w45 = w42.zstart;
+		if (typeof w45 != "number" || w45 > 65535 || w45 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w45, state.scan);
+		state.scan += 2;
+		let w46 = w42.xend;
+		if (typeof w46 != "number" || w46 > 65535 || w46 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w46, state.scan);
+		state.scan += 2;
+		let w47 = w42.zend;
+		if (typeof w47 != "number" || w47 > 65535 || w47 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w47, state.scan);
+		state.scan += 2;
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w48 = w39.dst;
+		if (typeof w48 != "object" || !w48) { throw new Error("object expected"); }
+		let hidden49 = {};
+		state.stack.push(w48);
+		state.hiddenstack.push(hidden49);
+		let w50 = w48.xstart;
+		if (typeof w50 != "number" || w50 > 65535 || w50 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w50, state.scan);
+		state.scan += 2;
+		let w51 = w48.zstart;
+		if (typeof w51 != "number" || w51 > 65535 || w51 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w51, state.scan);
+		state.scan += 2;
+		let w52 = w48.xend;
+		if (typeof w52 != "number" || w52 > 65535 || w52 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w52, state.scan);
+		state.scan += 2;
+		let w53 = w48.zend;
+		if (typeof w53 != "number" || w53 > 65535 || w53 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w53, state.scan);
+		state.scan += 2;
+		state.stack.pop();
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
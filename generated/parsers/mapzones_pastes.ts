@@ -0,0 +1,241 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapzones_pastes.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x49d272ac;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	let hidden3 = { $index: 0, $length: v2 };
+	state.hiddenstack.push(hidden3);
+	state.stack.push({});
+	let arr4 = [];
+	for (let i5 = 0; i5 < v2; i5++) {
+		hidden3.$index = i5;
+		let obj6 = {};
+		let hidden7 = {};
+		state.stack.push(obj6);
+		state.hiddenstack.push(hidden7);
+		let v8 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v8 !== undefined) { obj6.original_plane = v8; }
+		let v9 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v9 !== undefined) { obj6.n_planes = v9; }
+		let v10 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v10 !== undefined) { obj6.original_regionX = v10; }
+		let v11 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v11 !== undefined) { obj6.original_regionY = v11; }
+		let v12 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v12 !== undefined) { obj6.new_plane = v12; }
+		let v13 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v13 !== undefined) { obj6.new_regionX = v13; }
+		let v14 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v14 !== undefined) { obj6.new_regionY = v14; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr4.push(obj6);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr4 !== undefined) { obj0.squares = arr4; }
+	let v15 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	let hidden16 = { $index: 0, $length: v15 };
+	state.hiddenstack.push(hidden16);
+	state.stack.push({});
+	let arr17 = [];
+	for (let i18 = 0; i18 < v15; i18++) {
+		hidden16.$index = i18;
+		let obj19 = {};
+		let hidden20 = {};
+		state.stack.push(obj19);
+		state.hiddenstack.push(hidden20);
+		let v21 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v21 !== undefined) { obj19.original_plane = v21; }
+		let v22 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v22 !== undefined) { obj19.n_planes = v22; }
+		let v23 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v23 !== undefined) { obj19.original_regionX = v23; }
+		let v24 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v24 !== undefined) { obj19.original_regionY = v24; }
+		let v25 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v25 !== undefined) { obj19.original_chunkX = v25; }
+		let v26 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v26 !== undefined) { obj19.original_chunkY = v26; }
+		let v27 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v27 !== undefined) { obj19.new_plane = v27; }
+		let v28 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v28 !== undefined) { obj19.new_regionX = v28; }
+		let v29 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v29 !== undefined) { obj19.new_regionY = v29; }
+		let v30 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v30 !== undefined) { obj19.new_chunkX = v30; }
+		let v31 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v31 !== undefined) { obj19.new_chunkY = v31; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr17.push(obj19);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr17 !== undefined) { obj0.chunks = arr17; }
+	let v32 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v32 !== undefined) { obj0.width = v32; }
+	let v33 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v33 !== undefined) { obj0.height = v33; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden34 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden34);
+	let w35 = value.squares;
+	if (!Array.isArray(w35)) { throw new Error("array expected"); }
+	let w36 = w35.length;
+	if (typeof w36 != "number" || w36 > 65535 || w36 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w36, state.scan);
+	state.scan += 2;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w35.length });
+	for (let i37 = 0; i37 < w35.length; i37++) {
+		let w38 = w35[i37];
+		if (typeof w38 != "object" || !w38) { throw new Error("object expected"); }
+		let hidden39 = {};
+		state.stack.push(w38);
+		state.hiddenstack.push(hidden39);
+		let w40 = w38.original_plane;
+		if (typeof w40 != "number" || w40 > 255 || w40 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w40, state.scan);
+		state.scan += 1;
+		let w41 = w38.n_planes;
+		if (typeof w41 != "number" || w41 > 255 || w41 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w41, state.scan);
+		state.scan += 1;
+		let w42 = w38.original_regionX;
+		if (typeof w42 != "number" || w42 > 65535 || w42 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w42, state.scan);
+		state.scan += 2;
+		let w43 = w38.original_regionY;
+		if (typeof w43 != "number" || w43 > 65535 || w43 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w43, state.scan);
+		state.scan += 2;
+		let w44 = w38.new_plane;
+		if (typeof w44 != "number" || w44 > 255 || w44 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w44, state.scan);
+		state.scan += 1;
+		let w45 = w38.new_regionX;
+		if (typeof w45 != "number" || w45 > 65535 || w45 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w45, state.scan);
+		state.scan += 2;
+		let w46 = w38.new_regionY;
+		if (typeof w46 != "number" || w46 > 65535 || w46 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w46, state.scan);
+		state.scan += 2;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w47 = value.chunks;
+	if (!Array.isArray(w47)) { throw new Error("array expected"); }
+	let w48 = w47.length;
+	if (typeof w48 != "number" || w48 > 65535 || w48 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w48, state.scan);
+	state.scan += 2;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w47.length });
+	for (let i49 = 0; i49 < w47.length; i49++) {
+		let w50 = w47[i49];
+		if (typeof w50 != "object" || !w50) { throw new Error("object expected"); }
+		let hidden51 = {};
+		state.stack.push(w50);
+		state.hiddenstack.push(hidden51);
+		let w52 = w50.original_plane;
+		if (typeof w52 != "number" || w52 > 255 || w52 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w52, state.scan);
+		state.scan += 1;
+		let w53 = w50.n_planes;
+		if (typeof w53 != "number" || w53 > 255 || w53 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w53, state.scan);
+		state.scan += 1;
+		let w54 = w50.original_regionX;
+		if (typeof w54 != "number" || w54 > 65535 || w54 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w54, state.scan);
+		state.scan += 2;
+		let w55 = w50.original_regionY;
+		if (typeof w55 != "number" || w55 > 65535 || w55 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w55, state.scan);
+		state.scan += 2;
+		let w56 = w50.original_chunkX;
+		if (typeof w56 != "number" || w56 > 255 || w56 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w56, state.scan);
+		state.scan += 1;
+		let w57 = w50.original_chunkY;
+		if (typeof w57 != "number" || w57 > 255 || w57 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w57, state.scan);
+		state.scan += 1;
+		let w58 = w50.new_plane;
+		if (typeof w58 != "number" || w58 > 255 || w58 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w58, state.scan);
+		state.scan += 1;
+		let w59 = w50.new_regionX;
+		if (typeof w59 != "number" || w59 > 65535 || w59 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w59, state.scan);
+		state.scan += 2;
+		let w60 = w50.new_regionY;
+		if (typeof w60 != "number" || w60 > 65535 || w60 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w60, state.scan);
+		state.scan += 2;
+		let w61 = w50.new_chunkX;
+		if (typeof w61 != "number" || w61 > 255 || w61 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w61, state.scan);
+		state.scan += 1;
+		let w62 = w50.new_chunkY;
+		if (typeof w62 != "number" || w62 > 255 || w62 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w62, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w63 = value.width;
+	if (typeof w63 != "number" || w63 > 255 || w63 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w63, state.scan);
+	state.scan += 1;
+	let w64 = value.height;
+	if (typeof w64 != "number" || w64 > 255 || w64 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w64, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,15 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapzones_sub3.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x0c3d5be6;
+
+export function read(state, ext) {
+	let v0 = ext[0].read(state);
+	return v0;
+}
+
+export function write(state, ext, value) {
+	ext[0].write(state, value);
+}
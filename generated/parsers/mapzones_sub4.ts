@@ -0,0 +1,33 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\mapzones_sub4.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x8e1dce88;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = ext[0].read(state);
+	if (v2 !== undefined) { obj0.img = v2; }
+	let v3 = ext[1].read(state);
+	if (v3 !== undefined) { obj0.pixeldata = v3; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden4 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden4);
+	let w5 = value.img;
+	ext[0].write(state, w5);
+	let w6 = value.pixeldata;
+	ext[1].write(state, w6);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1441 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\materials.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x053cbd3b;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 >= 887) { match5 = 0; }
+	else if (ref4 >= 0) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v6 = v7;
+	}
+	else if (match5 == 1) {
+		v6 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.version = v6; }
+	let ref8 = state.stack[state.stack.length - 1].version;
+	let match9 = -1;
+	if (ref8 == 0) { match9 = 0; }
+	let v10 = null;
+	if (match9 != -1) {
+		let obj11 = {};
+		let hidden12 = {};
+		state.stack.push(obj11);
+		state.hiddenstack.push(hidden12);
+		let v13 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v13 !== undefined) { obj11.unk0 = v13; }
+		let v14 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v14 !== undefined) { obj11.texsize = v14; }
+		let v15 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v15 !== undefined) { obj11.opt0 = v15; }
+		let ref16 = state.stack[state.stack.length - 1].opt0;
+		let match17 = -1;
+		if (ref16 == 16) { match17 = 0; }
+		let v18 = null;
+		if (match17 != -1) {
+			let v19 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let v20 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let arr21 = [v19, v20];
+			v18 = arr21;
+		}
+		if (v18 !== undefined) { obj11.opt0data = v18; }
+		let v22 = ext[1].read(state);
+		if (v22 !== undefined) { obj11.arr = v22; }
+		let v23 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v23 !== undefined) { obj11.textureflags = v23; }
+		let ref24 = state.stack[state.stack.length - 1].textureflags;
+		let match25 = -1;
+		if ((ref24 & 17) != 0) { match25 = 0; }
+		let v26 = null;
+		if (match25 != -1) {
+			let hidden27 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden27);
+			let v28 = ext[2].read(state);
+			hidden27.$opcode = v28;
+			let ref29 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match30 = -1;
+			if (ref29 >= 887) { match30 = 0; }
+			else if (ref29 >= 0) { match30 = 1; }
+			if (match30 == -1) { throw new Error("no opcode matched"); }
+			let v31;
+			if (match30 == 0) {
+				let v32 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				v31 = v32;
+			}
+			else if (match30 == 1) {
+				v31 = 0;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v26 = v31;
+		}
+		if (v26 !== undefined) { obj11.diffuse = v26; }
+		let ref33 = state.stack[state.stack.length - 1].textureflags;
+		let match34 = -1;
+		if ((ref33 & 10) != 0) { match34 = 0; }
+		let v35 = null;
+		if (match34 != -1) {
+			let hidden36 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden36);
+			let v37 = ext[3].read(state);
+			hidden36.$opcode = v37;
+			let ref38 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match39 = -1;
+			if (ref38 >= 887) { match39 = 0; }
+			else if (ref38 >= 0) { match39 = 1; }
+			if (match39 == -1) { throw new Error("no opcode matched"); }
+			let v40;
+			if (match39 == 0) {
+				let v41 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				v40 = v41;
+			}
+			else if (match39 == 1) {
+				v40 = 0;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v35 = v40;
+		}
+		if (v35 !== undefined) { obj11.normal = v35; }
+		let hidden42 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden42);
+		let v43 = ext[4].read(state);
+		hidden42.$opcode = v43;
+		let ref44 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match45 = -1;
+		if (ref44 >= 876) { match45 = 0; }
+		else if (ref44 >= 0) { match45 = 1; }
+		if (match45 == -1) { throw new Error("no opcode matched"); }
+		let v46;
+		if (match45 == 0) {
+			let v47 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v46 = v47;
+		}
+		else if (match45 == 1) {
+			v46 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v46 !== undefined) { obj11.texrepeatflags = v46; }
+		let hidden48 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden48);
+		let v49 = ext[5].read(state);
+		hidden48.$opcode = v49;
+		let ref50 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match51 = -1;
+		if (ref50 >= 876) { match51 = 0; }
+		else if (ref50 >= 0) { match51 = 1; }
+		if (match51 == -1) { throw new Error("no opcode matched"); }
+		let v52;
+		if (match51 == 0) {
+			let v53 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v52 = v53;
+		}
+		else if (match51 == 1) {
+			v52 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v52 !== undefined) { obj11.unk3_skybox0 = v52; }
+		let hidden54 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden54);
+		let v55 = ext[6].read(state);
+		hidden54.$opcode = v55;
+		let ref56 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match57 = -1;
+		if (ref56 >= 876) { match57 = 0; }
+		else if (ref56 >= 0) { match57 = 1; }
+		if (match57 == -1) { throw new Error("no opcode matched"); }
+		let v58;
+		if (match57 == 0) {
+			let v59 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v58 = v59;
+		}
+		else if (match57 == 1) {
+			v58 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v58 !== undefined) { obj11.unk3_skybox1 = v58; }
+		let hidden60 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden60);
+		let v61 = ext[7].read(state);
+		hidden60.$opcode = v61;
+		let ref62 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match63 = -1;
+		if (ref62 >= 876) { match63 = 0; }
+		else if (ref62 >= 0) { match63 = 1; }
+		if (match63 == -1) { throw new Error("no opcode matched"); }
+		let v64;
+		if (match63 == 0) {
+			let v65 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v64 = v65;
+		}
+		else if (match63 == 1) {
+			v64 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v64 !== undefined) { obj11.unk3_skybox2 = v64; }
+		let v66 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v66 !== undefined) { obj11.flags2 = v66; }
+		let ref67 = state.stack[state.stack.length - 1].flags2;
+		let match68 = -1;
+		if ((ref67 & 16) != 0) { match68 = 0; }
+		let v69 = null;
+		if (match68 != -1) {
+			let v70 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v71 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let arr72 = [v70, v71];
+			v69 = arr72;
+		}
+		if (v69 !== undefined) { obj11.unkfloats = v69; }
+		let v73 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v73 !== undefined) { obj11.unk7 = v73; }
+		let ref74 = state.stack[state.stack.length - 1].unk7;
+		let match75 = -1;
+		if (ref74 == 255) { match75 = 0; }
+		let v76 = null;
+		if (match75 != -1) {
+			let v77 = ext[8].read(state);
+			v76 = v77;
+		}
+		if (v76 !== undefined) { obj11.weirdshit = v76; }
+		let hidden78 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden78);
+		let v79 = ext[9].read(state);
+		hidden78.$opcode = v79;
+		let ref80 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match81 = -1;
+		if (ref80 >= 887) { match81 = 0; }
+		else if (ref80 >= 0) { match81 = 1; }
+		if (match81 == -1) { throw new Error("no opcode matched"); }
+		let v82;
+		if (match81 == 0) {
+			let ref83 = state.stack[state.stack.length - 2].textureflags;
+			let match84 = -1;
+			if ((ref83 & 16) != 0) { match84 = 0; }
+			let v85 = null;
+			if (match84 != -1) {
+				let v86 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				v85 = v86;
+			}
+			v82 = v85;
+		}
+		else if (match81 == 1) {
+			let v87 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v82 = v87;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v82 !== undefined) { obj11.diffuse_related1 = v82; }
+		let ref88 = state.stack[state.stack.length - 1].textureflags;
+		let match89 = -1;
+		if ((ref88 & 2) != 0) { match89 = 0; }
+		let v90 = null;
+		if (match89 != -1) {
+			let v91 = ext[10].read(state);
+			v90 = v91;
+		}
+		if (v90 !== undefined) { obj11.normal_related = v90; }
+		let hidden92 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden92);
+		let v93 = ext[11].read(state);
+		hidden92.$opcode = v93;
+		let ref94 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match95 = -1;
+		if (ref94 >= 887) { match95 = 0; }
+		else if (ref94 >= 0) { match95 = 1; }
+		if (match95 == -1) { throw new Error("no opcode matched"); }
+		let v96;
+		if (match95 == 0) {
+			let ref97 = state.stack[state.stack.length - 2].textureflags;
+			let match98 = -1;
+			if ((ref97 & 1) != 0) { match98 = 0; }
+			let v99 = null;
+			if (match98 != -1) {
+				let v100 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				v99 = v100;
+			}
+			v96 = v99;
+		}
+		else if (match95 == 1) {
+			let v101 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v96 = v101;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		if (v96 !== undefined) { obj11.diffuse_related2 = v96; }
+		let ref102 = state.stack[state.stack.length - 1].diffuse_related2;
+		let match103 = -1;
+		if (ref102 == 2) { match103 = 0; }
+		let v104 = null;
+		if (match103 != -1) {
+			let v105 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v104 = v105;
+		}
+		if (v104 !== undefined) { obj11.diffuse_ralated2_data = v104; }
+		let v106 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v106 !== undefined) { obj11.alphamode = v106; }
+		let ref107 = state.stack[state.stack.length - 1].alphamode;
+		let match108 = -1;
+		if (ref107 == 1) { match108 = 0; }
+		let v109 = null;
+		if (match108 != -1) {
+			let v110 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v109 = v110;
+		}
+		if (v109 !== undefined) { obj11.alphacutoff = v109; }
+		let v111 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v111 !== undefined) { obj11.animtex = v111; }
+		let ref112 = state.stack[state.stack.length - 1].animtex;
+		let match113 = -1;
+		if ((ref112 & 1) != 0) { match113 = 0; }
+		let v114 = null;
+		if (match113 != -1) {
+			let hidden115 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden115);
+			let v116 = ext[12].read(state);
+			hidden115.$opcode = v116;
+			let ref117 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match118 = -1;
+			if (ref117 >= 897) { match118 = 0; }
+			else if (ref117 >= 0) { match118 = 1; }
+			if (match118 == -1) { throw new Error("no opcode matched"); }
+			let v119;
+			if (match118 == 0) {
+				let v120 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				v119 = v120;
+			}
+			else if (match118 == 1) {
+				let v121 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				v119 = v121;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v114 = v119;
+		}
+		if (v114 !== undefined) { obj11.animtexU = v114; }
+		let ref122 = state.stack[state.stack.length - 1].animtex;
+		let match123 = -1;
+		if ((ref122 & 2) != 0) { match123 = 0; }
+		let v124 = null;
+		if (match123 != -1) {
+			let hidden125 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden125);
+			let v126 = ext[13].read(state);
+			hidden125.$opcode = v126;
+			let ref127 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match128 = -1;
+			if (ref127 >= 897) { match128 = 0; }
+			else if (ref127 >= 0) { match128 = 1; }
+			if (match128 == -1) { throw new Error("no opcode matched"); }
+			let v129;
+			if (match128 == 0) {
+				let v130 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				v129 = v130;
+			}
+			else if (match128 == 1) {
+				let v131 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				v129 = v131;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v124 = v129;
+		}
+		if (v124 !== undefined) { obj11.animtexV = v124; }
+		let ref132 = state.stack[state.stack.length - 1].unk3_skybox1;
+		let match133 = -1;
+		if ((ref132 & 128) != 0) { match133 = 0; }
+		let v134 = null;
+		if (match133 != -1) {
+			let v135 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v134 = v135;
+		}
+		if (v134 !== undefined) { obj11.skybox_extra = v134; }
+		let v136 = state.view.getUint8(state.scan++);
+		if (v136 != 0 && v136 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v136 != 0) !== undefined) { obj11.flagextra = (v136 != 0); }
+		let ref137 = state.stack[state.stack.length - 1].flagextra;
+		let match138 = -1;
+		if (ref137 == 1) { match138 = 0; }
+		let v139 = null;
+		if (match138 != -1) {
+			let obj140 = {};
+			let hidden141 = {};
+			state.stack.push(obj140);
+			state.hiddenstack.push(hidden141);
+			let v142 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v142 !== undefined) { obj140.unk00_flags = v142; }
+			let v143 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v143 !== undefined) { obj140.unk01_flagsornumber = v143; }
+			let v144 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v144 !== undefined) { obj140.unk02 = v144; }
+			let v145 = ext[14].read(state);
+			if (v145 !== undefined) { obj140.unknown = v145; }
+			let v146 = state.view.getUint8(state.scan++);
+			if (v146 != 0 && v146 != 1) { throw new Error("1 or 0 expected boolean value"); }
+			if ((v146 != 0) !== undefined) { obj140.unk07_bool = (v146 != 0); }
+			let v147 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v147 !== undefined) { obj140.unk08_flags = v147; }
+			let v148 = state.view.getUint8(state.scan++);
+			if (v148 != 0 && v148 != 1) { throw new Error("1 or 0 expected boolean value"); }
+			if ((v148 != 0) !== undefined) { obj140.unk09_bool = (v148 != 0); }
+			let v149 = state.view.getUint8(state.scan++);
+			if (v149 != 0 && v149 != 1) { throw new Error("1 or 0 expected boolean value"); }
+			if ((v149 != 0) !== undefined) { obj140.unk0a_bool = (v149 != 0); }
+			let v150 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v150 !== undefined) { obj140.specular = v150; }
+			let v151 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v151 !== undefined) { obj140.baseColorFraction = v151; }
+			let v152 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v152 !== undefined) { obj140.baseColor = v152; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v139 = obj140;
+		}
+		if (v139 !== undefined) { obj11.extra = v139; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v10 = obj11;
+	}
+	if (v10 !== undefined) { obj0.v0 = v10; }
+	let ref153 = state.stack[state.stack.length - 1].version;
+	let match154 = -1;
+	if (ref153 != 0) { match154 = 0; }
+	let v155 = null;
+	if (match154 != -1) {
+		let obj156 = {};
+		let hidden157 = {};
+		state.stack.push(obj156);
+		state.hiddenstack.push(hidden157);
+		let v158 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v158 !== undefined) { obj156.flags = v158; }
+		let ref159 = state.stack[state.stack.length - 1].flags;
+		ref159 = (ref159 >> 0) & 1;
+		ref159 = ref159 + 0;
+		if (ref159 !== undefined) { obj156.flag1 = ref159; }
+		let ref160 = state.stack[state.stack.length - 1].flags;
+		ref160 = (ref160 >> 1) & 1;
+		ref160 = ref160 + 0;
+		if (ref160 !== undefined) { obj156.flag2 = ref160; }
+		let ref161 = state.stack[state.stack.length - 1].flags;
+		ref161 = (ref161 >> 2) & 1;
+		ref161 = ref161 + 0;
+		if (ref161 !== undefined) { obj156.opaque_2 = ref161; }
+		let ref162 = state.stack[state.stack.length - 1].flags;
+		ref162 = (ref162 >> 3) & 1;
+		ref162 = ref162 + 0;
+		if (ref162 !== undefined) { obj156.flag3 = ref162; }
+		let ref163 = state.stack[state.stack.length - 1].flags;
+		ref163 = (ref163 >> 4) & 1;
+		ref163 = ref163 + 0;
+		if (ref163 !== undefined) { obj156.flag4 = ref163; }
+		let ref164 = state.stack[state.stack.length - 1].flags;
+		ref164 = (ref164 >> 5) & 1;
+		ref164 = ref164 + 0;
+		if (ref164 !== undefined) { obj156.hasDiffuse = ref164; }
+		let ref165 = state.stack[state.stack.length - 1].flags;
+		ref165 = (ref165 >> 6) & 1;
+		ref165 = ref165 + 0;
+		if (ref165 !== undefined) { obj156.hasNormal = ref165; }
+		let ref166 = state.stack[state.stack.length - 1].flags;
+		ref166 = (ref166 >> 7) & 1;
+		ref166 = ref166 + 0;
+		if (ref166 !== undefined) { obj156.hasCompound = ref166; }
+		let ref167 = state.stack[state.stack.length - 1].flags;
+		ref167 = (ref167 >> 8) & 1;
+		ref167 = ref167 + 0;
+		if (ref167 !== undefined) { obj156.hasUVanimU = ref167; }
+		let ref168 = state.stack[state.stack.length - 1].flags;
+		ref168 = (ref168 >> 9) & 1;
+		ref168 = ref168 + 0;
+		if (ref168 !== undefined) { obj156.hasUVanimV = ref168; }
+		let ref169 = state.stack[state.stack.length - 1].flags;
+		ref169 = (ref169 >> 10) & 1;
+		ref169 = ref169 + 0;
+		if (ref169 !== undefined) { obj156.flag10 = ref169; }
+		let ref170 = state.stack[state.stack.length - 1].flags;
+		ref170 = (ref170 >> 11) & 1;
+		ref170 = ref170 + 0;
+		if (ref170 !== undefined) { obj156.flag11 = ref170; }
+		let ref171 = state.stack[state.stack.length - 1].flags;
+		ref171 = (ref171 >> 12) & 1;
+		ref171 = ref171 + 0;
+		if (ref171 !== undefined) { obj156.flag12 = ref171; }
+		let ref172 = state.stack[state.stack.length - 1].flags;
+		ref172 = (ref172 >> 13) & 1;
+		ref172 = ref172 + 0;
+		if (ref172 !== undefined) { obj156.flag13 = ref172; }
+		let ref173 = state.stack[state.stack.length - 1].flags;
+		ref173 = (ref173 >> 14) & 1;
+		ref173 = ref173 + 0;
+		if (ref173 !== undefined) { obj156.colorMultiply = ref173; }
+		let ref174 = state.stack[state.stack.length - 1].flags;
+		ref174 = (ref174 >> 15) & 1;
+		ref174 = ref174 + 0;
+		if (ref174 !== undefined) { obj156.flag15 = ref174; }
+		let ref175 = state.stack[state.stack.length - 1].flags;
+		ref175 = (ref175 >> 16) & 1;
+		ref175 = ref175 + 0;
+		if (ref175 !== undefined) { obj156.flag16 = ref175; }
+		let ref176 = state.stack[state.stack.length - 1].flags;
+		ref176 = (ref176 >> 17) & 1;
+		ref176 = ref176 + 0;
+		if (ref176 !== undefined) { obj156.flag17 = ref176; }
+		let ref177 = state.stack[state.stack.length - 1].flags;
+		ref177 = (ref177 >> 18) & 1;
+		ref177 = ref177 + 0;
+		if (ref177 !== undefined) { obj156.flag18 = ref177; }
+		let ref178 = state.stack[state.stack.length - 1].flags;
+		ref178 = (ref178 >> 19) & 1;
+		ref178 = ref178 + 0;
+		if (ref178 !== undefined) { obj156.flag19 = ref178; }
+		let ref179 = state.stack[state.stack.length - 1].flags;
+		ref179 = (ref179 >> 20) & 1;
+		ref179 = ref179 + 0;
+		if (ref179 !== undefined) { obj156.flag20 = ref179; }
+		let ref180 = state.stack[state.stack.length - 1].flags;
+		ref180 = (ref180 >> 21) & 1;
+		ref180 = ref180 + 0;
+		if (ref180 !== undefined) { obj156.flag21 = ref180; }
+		let ref181 = state.stack[state.stack.length - 1].flags;
+		ref181 = (ref181 >> 22) & 1023;
+		ref181 = ref181 + 0;
+		if (ref181 !== undefined) { obj156.flag22_32 = ref181; }
+		let ref182 = state.stack[state.stack.length - 1].hasDiffuse;
+		let match183 = -1;
+		if (ref182 == 1) { match183 = 0; }
+		let v184 = null;
+		if (match183 != -1) {
+			let obj185 = {};
+			let hidden186 = {};
+			state.stack.push(obj185);
+			state.hiddenstack.push(hidden186);
+			let v187 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v187 !== undefined) { obj185.size = v187; }
+			let v188 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v188 !== undefined) { obj185.texture = v188; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v184 = obj185;
+		}
+		if (v184 !== undefined) { obj156.diffuse = v184; }
+		let ref189 = state.stack[state.stack.length - 1].hasNormal;
+		let match190 = -1;
+		if (ref189 == 1) { match190 = 0; }
+		let v191 = null;
+		if (match190 != -1) {
+			let obj192 = {};
+			let hidden193 = {};
+			state.stack.push(obj192);
+			state.hiddenstack.push(hidden193);
+			let v194 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v194 !== undefined) { obj192.size = v194; }
+			let v195 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v195 !== undefined) { obj192.texture = v195; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v191 = obj192;
+		}
+		if (v191 !== undefined) { obj156.normal = v191; }
+		let ref196 = state.stack[state.stack.length - 1].hasCompound;
+		let match197 = -1;
+		if (ref196 == 1) { match197 = 0; }
+		let v198 = null;
+		if (match197 != -1) {
+			let obj199 = {};
+			let hidden200 = {};
+			state.stack.push(obj199);
+			state.hiddenstack.push(hidden200);
+			let v201 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v201 !== undefined) { obj199.size = v201; }
+			let v202 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v202 !== undefined) { obj199.texture = v202; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v198 = obj199;
+		}
+		if (v198 !== undefined) { obj156.compound = v198; }
+		let ref203 = state.stack[state.stack.length - 1].flag13;
+		let match204 = -1;
+		if (ref203 == 1) { match204 = 0; }
+		let v205 = null;
+		if (match204 != -1) {
+			let v206 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			v205 = v206;
+		}
+		if (v205 !== undefined) { obj156.flag13value = v205; }
+		let ref207 = state.stack[state.stack.length - 1].colorMultiply;
+		let match208 = -1;
+		if (ref207 == 1) { match208 = 0; }
+		let v209 = null;
+		if (match208 != -1) {
+			let obj210 = {};
+			let hidden211 = {};
+			state.stack.push(obj210);
+			state.hiddenstack.push(hidden211);
+			let v212 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v212 !== undefined) { obj210.static = v212; }
+			let v213 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v213 !== undefined) { obj210.compose_skybox = v213; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v209 = obj210;
+		}
+		if (v209 !== undefined) { obj156.textureMultiply = v209; }
+		let ref214 = state.stack[state.stack.length - 1].flag15;
+		let match215 = -1;
+		if (ref214 == 1) { match215 = 0; }
+		let v216 = null;
+		if (match215 != -1) {
+			let v217 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let v218 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let v219 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let v220 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let arr221 = [v217, v218, v219, v220];
+			v216 = arr221;
+		}
+		if (v216 !== undefined) { obj156.flag15value = v216; }
+		let ref222 = state.stack[state.stack.length - 1].flag18;
+		let match223 = -1;
+		if (ref222 == 1) { match223 = 0; }
+		let v224 = null;
+		if (match223 != -1) {
+			let v225 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			v224 = v225;
+		}
+		if (v224 !== undefined) { obj156.flag18value = v224; }
+		let ref226 = state.stack[state.stack.length - 1].flag16;
+		let match227 = -1;
+		if (ref226 == 1) { match227 = 0; }
+		let v228 = null;
+		if (match227 != -1) {
+			let v229 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			v228 = v229;
+		}
+		if (v228 !== undefined) { obj156.flag16value = v228; }
+		let ref230 = state.stack[state.stack.length - 1].flag12;
+		let match231 = -1;
+		if (ref230 == 1) { match231 = 0; }
+		let v232 = null;
+		if (match231 != -1) {
+			let v233 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			v232 = v233;
+		}
+		if (v232 !== undefined) { obj156.flag12value = v232; }
+		let ref234 = state.stack[state.stack.length - 1].flag11;
+		let match235 = -1;
+		if (ref234 == 1) { match235 = 0; }
+		let v236 = null;
+		if (match235 != -1) {
+			let v237 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v238 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v239 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let arr240 = [v237, v238, v239];
+			v236 = arr240;
+		}
+		if (v236 !== undefined) { obj156.flag11value = v236; }
+		let ref241 = state.stack[state.stack.length - 1].flag19;
+		let match242 = -1;
+		if (ref241 == 1) { match242 = 0; }
+		let v243 = null;
+		if (match242 != -1) {
+			let v244 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v245 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v246 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v247 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let v248 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			let arr249 = [v244, v245, v246, v247, v248];
+			v243 = arr249;
+		}
+		if (v243 !== undefined) { obj156.flag19value = v243; }
+		let ref250 = state.stack[state.stack.length - 1].hasNormal;
+		let match251 = -1;
+		if (ref250 == 1) { match251 = 0; }
+		let v252 = null;
+		if (match251 != -1) {
+			let v253 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			v252 = v253;
+		}
+		if (v252 !== undefined) { obj156.normalScale = v252; }
+		let ref254 = state.stack[state.stack.length - 1].flag17;
+		let match255 = -1;
+		if (ref254 == 1) { match255 = 0; }
+		let v256 = null;
+		if (match255 != -1) {
+			let v257 = state.view.getFloat32(state.scan);
+			state.scan += 4;
+			v256 = v257;
+		}
+		if (v256 !== undefined) { obj156.flag17value = v256; }
+		let ref258 = state.stack[state.stack.length - 1].hasUVanimU;
+		let match259 = -1;
+		if (ref258 == 1) { match259 = 0; }
+		let v260 = null;
+		if (match259 != -1) {
+			let v261 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			v260 = v261;
+		}
+		if (v260 !== undefined) { obj156.uvanim_u = v260; }
+		let ref262 = state.stack[state.stack.length - 1].hasUVanimV;
+		let match263 = -1;
+		if (ref262 == 1) { match263 = 0; }
+		let v264 = null;
+		if (match263 != -1) {
+			let v265 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			v264 = v265;
+		}
+		if (v264 !== undefined) { obj156.uvanim_v = v264; }
+		let v266 = ext[15].read(state);
+		if (v266 !== undefined) { obj156.always_0x0901 = v266; }
+		let v267 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v267 !== undefined) { obj156.unknownbyte0 = v267; }
+		let v268 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v268 !== undefined) { obj156.alphamode = v268; }
+		let ref269 = state.stack[state.stack.length - 1].alphamode;
+		let match270 = -1;
+		if (ref269 == 1) { match270 = 0; }
+		let v271 = null;
+		if (match270 != -1) {
+			let v272 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v271 = v272;
+		}
+		if (v271 !== undefined) { obj156.alphacutoff = v271; }
+		let v273 = ext[16].read(state);
+		if (v273 !== undefined) { obj156.unkFFFF = v273; }
+		let v274 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v274 !== undefined) { obj156.endbyte = v274; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v155 = obj156;
+	}
+	if (v155 !== undefined) { obj0.v1_or_v2 = v155; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden275 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden275);
+	let w276 = value.version;
+	let hidden277 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden277);
+	hidden277.$opcode = ext[0].readConst(state);
+	let ref278 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match279 = -1;
+	if (ref278 >= 887) { match279 = 0; }
+	else if (ref278 >= 0) { match279 = 1; }
+	if (match279 == -1) { throw new Error("no opcode matched"); }
+	if (match279 == 0) {
+		if (typeof w276 != "number" || w276 > 255 || w276 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w276, state.scan);
+		state.scan += 1;
+	}
+	else if (match279 == 1) {
+		if (w276 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w280 = value.v0;
+	if (w280 != null) {
+		if (typeof w280 != "object" || !w280) { throw new Error("object expected"); }
+		let hidden281 = {};
+		state.stack.push(w280);
+		state.hiddenstack.push(hidden281);
+		let w282 = w280.unk0;
+		if (typeof w282 != "number" || w282 > 255 || w282 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w282, state.scan);
+		state.scan += 1;
+		let w283 = w280.texsize;
+		if (typeof w283 != "number" || w283 > 65535 || w283 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w283, state.scan);
+		state.scan += 2;
+		let w284 = w280.opt0;
+		if (typeof w284 != "number" || w284 > 255 || w284 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w284, state.scan);
+		state.scan += 1;
+		let w285 = w280.opt0data;
+		if (w285 != null) {
+			if (!Array.isArray(w285)) { throw new Error("array expected"); }
+			let w286 = w285[0];
+			if (typeof w286 != "number" || w286 > 255 || w286 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w286, state.scan);
+			state.scan += 1;
+			let w287 = w285[1];
+			if (typeof w287 != "number" || w287 > 65535 || w287 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w287, state.scan);
+			state.scan += 2;
+		}
+		let w288 = w280.arr;
+		ext[1].write(state, w288);
+		let w289 = w280.textureflags;
+		if (typeof w289 != "number" || w289 > 255 || w289 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w289, state.scan);
+		state.scan += 1;
+		let w290 = w280.diffuse;
+		if (w290 != null) {
+			let hidden291 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden291);
+			hidden291.$opcode = ext[2].readConst(state);
+			let ref292 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match293 = -1;
+			if (ref292 >= 887) { match293 = 0; }
+			else if (ref292 >= 0) { match293 = 1; }
+			if (match293 == -1) { throw new Error("no opcode matched"); }
+			if (match293 == 0) {
+				if (typeof w290 != "number" || w290 > 4294967295 || w290 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w290, state.scan);
+				state.scan += 4;
+			}
+			else if (match293 == 1) {
+				if (w290 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w294 = w280.normal;
+		if (w294 != null) {
+			let hidden295 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden295);
+			hidden295.$opcode = ext[3].readConst(state);
+			let ref296 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match297 = -1;
+			if (ref296 >= 887) { match297 = 0; }
+			else if (ref296 >= 0) { match297 = 1; }
+			if (match297 == -1) { throw new Error("no opcode matched"); }
+			if (match297 == 0) {
+				if (typeof w294 != "number" || w294 > 4294967295 || w294 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w294, state.scan);
+				state.scan += 4;
+			}
+			else if (match297 == 1) {
+				if (w294 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w298 = w280.texrepeatflags;
+		let hidden299 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden299);
+		hidden299.$opcode = ext[4].readConst(state);
+		let ref300 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match301 = -1;
+		if (ref300 >= 876) { match301 = 0; }
+		else if (ref300 >= 0) { match301 = 1; }
+		if (match301 == -1) { throw new Error("no opcode matched"); }
+		if (match301 == 0) {
+			if (typeof w298 != "number" || w298 > 255 || w298 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w298, state.scan);
+			state.scan += 1;
+		}
+		else if (match301 == 1) {
+			if (w298 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w302 = w280.unk3_skybox0;
+		let hidden303 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden303);
+		hidden303.$opcode = ext[5].readConst(state);
+		let ref304 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match305 = -1;
+		if (ref304 >= 876) { match305 = 0; }
+		else if (ref304 >= 0) { match305 = 1; }
+		if (match305 == -1) { throw new Error("no opcode matched"); }
+		if (match305 == 0) {
+			if (typeof w302 != "number" || w302 > 255 || w302 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w302, state.scan);
+			state.scan += 1;
+		}
+		else if (match305 == 1) {
+			if (w302 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w306 = w280.unk3_skybox1;
+		let hidden307 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden307);
+		hidden307.$opcode = ext[6].readConst(state);
+		let ref308 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match309 = -1;
+		if (ref308 >= 876) { match309 = 0; }
+		else if (ref308 >= 0) { match309 = 1; }
+		if (match309 == -1) { throw new Error("no opcode matched"); }
+		if (match309 == 0) {
+			if (typeof w306 != "number" || w306 > 255 || w306 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w306, state.scan);
+			state.scan += 1;
+		}
+		else if (match309 == 1) {
+			if (w306 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w310 = w280.unk3_skybox2;
+		let hidden311 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden311);
+		hidden311.$opcode = ext[7].readConst(state);
+		let ref312 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match313 = -1;
+		if (ref312 >= 876) { match313 = 0; }
+		else if (ref312 >= 0) { match313 = 1; }
+		if (match313 == -1) { throw new Error("no opcode matched"); }
+		if (match313 == 0) {
+			if (typeof w310 != "number" || w310 > 255 || w310 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w310, state.scan);
+			state.scan += 1;
+		}
+		else if (match313 == 1) {
+			if (w310 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w314 = w280.flags2;
+		if (typeof w314 != "number" || w314 > 255 || w314 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w314, state.scan);
+		state.scan += 1;
+		let w315 = w280.unkfloats;
+		if (w315 != null) {
+			if (!Array.isArray(w315)) { throw new Error("array expected"); }
+			let w316 = w315[0];
+			if (typeof w316 != "number" || w316 > 1.7976931348623157e+308 || w316 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w316, state.scan);
+			state.scan += 4;
+			let w317 = w315[1];
+			if (typeof w317 != "number" || w317 > 1.7976931348623157e+308 || w317 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w317, state.scan);
+			state.scan += 4;
+		}
+		let w318 = w280.unk7;
+		if (typeof w318 != "number" || w318 > 255 || w318 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w318, state.scan);
+		state.scan += 1;
+		let w319 = w280.weirdshit;
+		if (w319 != null) {
+			ext[8].write(state, w319);
+		}
+		let w320 = w280.diffuse_related1;
+		let hidden321 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden321);
+		hidden321.$opcode = ext[9].readConst(state);
+		let ref322 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match323 = -1;
+		if (ref322 >= 887) { match323 = 0; }
+		else if (ref322 >= 0) { match323 = 1; }
+		if (match323 == -1) { throw new Error("no opcode matched"); }
+		if (match323 == 0) {
+			if (w320 != null) {
+				if (typeof w320 != "number" || w320 > 255 || w320 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w320, state.scan);
+				state.scan += 1;
+			}
+		}
+		else if (match323 == 1) {
+			if (typeof w320 != "number" || w320 > 255 || w320 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w320, state.scan);
+			state.scan += 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w324 = w280.normal_related;
+		if (w324 != null) {
+			ext[10].write(state, w324);
+		}
+		let w325 = w280.diffuse_related2;
+		let hidden326 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden326);
+		hidden326.$opcode = ext[11].readConst(state);
+		let ref327 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match328 = -1;
+		if (ref327 >= 887) { match328 = 0; }
+		else if (ref327 >= 0) { match328 = 1; }
+		if (match328 == -1) { throw new Error("no opcode matched"); }
+		if (match328 == 0) {
+			if (w325 != null) {
+				if (typeof w325 != "number" || w325 > 255 || w325 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w325, state.scan);
+				state.scan += 1;
+			}
+		}
+		else if (match328 == 1) {
+			if (typeof w325 != "number" || w325 > 255 || w325 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w325, state.scan);
+			state.scan += 1;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		let w329 = w280.diffuse_ralated2_data;
+		if (w329 != null) {
+			if (typeof w329 != "number" || w329 > 255 || w329 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w329, state.scan);
+			state.scan += 1;
+		}
+		let w330 = w280.alphamode;
+		if (typeof w330 != "number" || w330 > 255 || w330 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w330, state.scan);
+		state.scan += 1;
+		let w331 = w280.alphacutoff;
+		if (w331 != null) {
+			if (typeof w331 != "number" || w331 > 255 || w331 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w331, state.scan);
+			state.scan += 1;
+		}
+		let w332 = w280.animtex;
+		if (typeof w332 != "number" || w332 > 255 || w332 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w332, state.scan);
+		state.scan += 1;
+		let w333 = w280.animtexU;
+		if (w333 != null) {
+			let hidden334 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden334);
+			hidden334.$opcode = ext[12].readConst(state);
+			let ref335 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match336 = -1;
+			if (ref335 >= 897) { match336 = 0; }
+			else if (ref335 >= 0) { match336 = 1; }
+			if (match336 == -1) { throw new Error("no opcode matched"); }
+			if (match336 == 0) {
+				if (typeof w333 != "number" || w333 > 32767 || w333 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w333, state.scan);
+				state.scan += 2;
+			}
+			else if (match336 == 1) {
+				if (typeof w333 != "number" || w333 > 127 || w333 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w333, state.scan);
+				state.scan += 1;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w337 = w280.animtexV;
+		if (w337 != null) {
+			let hidden338 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden338);
+			hidden338.$opcode = ext[13].readConst(state);
+			let ref339 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match340 = -1;
+			if (ref339 >= 897) { match340 = 0; }
+			else if (ref339 >= 0) { match340 = 1; }
+			if (match340 == -1) { throw new Error("no opcode matched"); }
+			if (match340 == 0) {
+				if (typeof w337 != "number" || w337 > 32767 || w337 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w337, state.scan);
+				state.scan += 2;
+			}
+			else if (match340 == 1) {
+				if (typeof w337 != "number" || w337 > 127 || w337 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w337, state.scan);
+				state.scan += 1;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w341 = w280.skybox_extra;
+		if (w341 != null) {
+			if (typeof w341 != "number" || w341 > 4294967295 || w341 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w341, state.scan);
+			state.scan += 4;
+		}
+		let w342 = w280.flagextra;
+		if (typeof w342 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w342, state.scan++);
+		let w343 = w280.extra;
+		if (w343 != null) {
+			if (typeof w343 != "object" || !w343) { throw new Error("object expected"); }
+			let hidden344 = {};
+			state.stack.push(w343);
+			state.hiddenstack.push(hidden344);
+			let w345 = w343.unk00_flags;
+			if (typeof w345 != "number" || w345 > 255 || w345 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w345, state.scan);
+			state.scan += 1;
+			let w346 = w343.unk01_flagsornumber;
+			if (typeof w346 != "number" || w346 > 255 || w346 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w346, state.scan);
+			state.scan += 1;
+			let w347 = w343.unk02;
+			if (typeof w347 != "number" || w347 > 255 || w347 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w347, state.scan);
+			state.scan += 1;
+			let w348 = w343.unknown;
+			ext[14].write(state, w348);
+			let w349 = w343.unk07_bool;
+			if (typeof w349 != "boolean") { throw new Error("boolean expected"); }
+			state.buffer.writeUInt8(+w349, state.scan++);
+			let w350 = w343.unk08_flags;
+			if (typeof w350 != "number" || w350 > 255 || w350 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w350, state.scan);
+			state.scan += 1;
+			let w351 = w343.unk09_bool;
+			if (typeof w351 != "boolean") { throw new Error("boolean expected"); }
+			state.buffer.writeUInt8(+w351, state.scan++);
+			let w352 = w343.unk0a_bool;
+			if (typeof w352 != "boolean") { throw new Error("boolean expected"); }
+			state.buffer.writeUInt8(+w352, state.scan++);
+			let w353 = w343.specular;
+			if (typeof w353 != "number" || w353 > 255 || w353 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w353, state.scan);
+			state.scan += 1;
+			let w354 = w343.baseColorFraction;
+			if (typeof w354 != "number" || w354 > 255 || w354 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w354, state.scan);
+			state.scan += 1;
+			let w355 = w343.baseColor;
+			if (typeof w355 != "number" || w355 > 65535 || w355 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w355, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w356 = value.v1_or_v2;
+	if (w356 != null) {
+		if (typeof w356 != "object" || !w356) { throw new Error("object expected"); }
+		let hidden357 = {};
+		state.stack.push(w356);
+		state.hiddenstack.push(hidden357);
+		let w358 = w356.flags;
+		if (typeof w358 != "number" || w358 > 4294967295 || w358 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w358, state.scan);
+		state.scan += 4;
+		let w359 = w356.flag1;
+		let w360 = w356.flag2;
+		let w361 = w356.opaque_2;
+		let w362 = w356.flag3;
+		let w363 = w356.flag4;
+		let w364 = w356.hasDiffuse;
+		let w365 = w356.hasNormal;
+		let w366 = w356.hasCompound;
+		let w367 = w356.hasUVanimU;
+		let w368 = w356.hasUVanimV;
+		let w369 = w356.flag10;
+		let w370 = w356.flag11;
+		let w371 = w356.flag12;
+		let w372 = w356.flag13;
+		let w373 = w356.colorMultiply;
+		let w374 = w356.flag15;
+		let w375 = w356.flag16;
+		let w376 = w356.flag17;
+		let w377 = w356.flag18;
+		let w378 = w356.flag19;
+		let w379 = w356.flag20;
+		let w380 = w356.flag21;
+		let w381 = w356.flag22_32;
+		let w382 = w356.diffuse;
+		if (w382 != null) {
+			if (typeof w382 != "object" || !w382) { throw new Error("object expected"); }
+			let hidden383 = {};
+			state.stack.push(w382);
+			state.hiddenstack.push(hidden383);
+			let w384 = w382.size;
+			if (typeof w384 != "number" || w384 > 255 || w384 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w384, state.scan);
+			state.scan += 1;
+			let w385 = w382.texture;
+			if (typeof w385 != "number" || w385 > 4294967295 || w385 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w385, state.scan);
+			state.scan += 4;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w386 = w356.normal;
+		if (w386 != null) {
+			if (typeof w386 != "object" || !w386) { throw new Error("object expected"); }
+			let hidden387 = {};
+			state.stack.push(w386);
+			state.hiddenstack.push(hidden387);
+			let w388 = w386.size;
+			if (typeof w388 != "number" || w388 > 255 || w388 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w388, state.scan);
+			state.scan += 1;
+			let w389 = w386.texture;
+			if (typeof w389 != "number" || w389 > 4294967295 || w389 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w389, state.scan);
+			state.scan += 4;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w390 = w356.compound;
+		if (w390 != null) {
+			if (typeof w390 != "object" || !w390) { throw new Error("object expected"); }
+			let hidden391 = {};
+			state.stack.push(w390);
+			state.hiddenstack.push(hidden391);
+			let w392 = w390.size;
+			if (typeof w392 != "number" || w392 > 255 || w392 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w392, state.scan);
+			state.scan += 1;
+			let w393 = w390.texture;
+			if (typeof w393 != "number" || w393 > 4294967295 || w393 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w393, state.scan);
+			state.scan += 4;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w394 = w356.flag13value;
+		if (w394 != null) {
+			if (typeof w394 != "number" || w394 > 1.7976931348623157e+308 || w394 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w394, state.scan);
+			state.scan += 4;
+		}
+		let w395 = w356.textureMultiply;
+		if (w395 != null) {
+			if (typeof w395 != "object" || !w395) { throw new Error("object expected"); }
+			let hidden396 = {};
+			state.stack.push(w395);
+			state.hiddenstack.push(hidden396);
+			let w397 = w395.static;
+			if (typeof w397 != "number" || w397 > 65535 || w397 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w397, state.scan);
+			state.scan += 2;
+			let w398 = w395.compose_skybox;
+			if (typeof w398 != "number" || w398 > 65535 || w398 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w398, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w399 = w356.flag15value;
+		if (w399 != null) {
+			if (!Array.isArray(w399)) { throw new Error("array expected"); }
+			let w400 = w399[0];
+			if (typeof w400 != "number" || w400 > 255 || w400 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w400, state.scan);
+			state.scan += 1;
+			let w401 = w399[1];
+			if (typeof w401 != "number" || w401 > 255 || w401 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w401, state.scan);
+			state.scan += 1;
+			let w402 = w399[2];
+			if (typeof w402 != "number" || w402 > 255 || w402 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w402, state.scan);
+			state.scan += 1;
+			let w403 = w399[3];
+			if (typeof w403 != "number" || w403 > 255 || w403 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w403, state.scan);
+			state.scan += 1;
+		}
+		let w404 = w356.flag18value;
+		if (w404 != null) {
+			if (typeof w404 != "number" || w404 > 4294967295 || w404 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w404, state.scan);
+			state.scan += 4;
+		}
+		let w405 = w356.flag16value;
+		if (w405 != null) {
+			if (typeof w405 != "number" || w405 > 1.7976931348623157e+308 || w405 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w405, state.scan);
+			state.scan += 4;
+		}
+		let w406 = w356.flag12value;
+		if (w406 != null) {
+			if (typeof w406 != "number" || w406 > 1.7976931348623157e+308 || w406 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w406, state.scan);
+			state.scan += 4;
+		}
+		let w407 = w356.flag11value;
+		if (w407 != null) {
+			if (!Array.isArray(w407)) { throw new Error("array expected"); }
+			let w408 = w407[0];
+			if (typeof w408 != "number" || w408 > 1.7976931348623157e+308 || w408 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w408, state.scan);
+			state.scan += 4;
+			let w409 = w407[1];
+			if (typeof w409 != "number" || w409 > 1.7976931348623157e+308 || w409 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w409, state.scan);
+			state.scan += 4;
+			let w410 = w407[2];
+			if (typeof w410 != "number" || w410 > 1.7976931348623157e+308 || w410 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w410, state.scan);
+			state.scan += 4;
+		}
+		let w411 = w356.flag19value;
+		if (w411 != null) {
+			if (!Array.isArray(w411)) { throw new Error("array expected"); }
+			let w412 = w411[0];
+			if (typeof w412 != "number" || w412 > 1.7976931348623157e+308 || w412 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w412, state.scan);
+			state.scan += 4;
+			let w413 = w411[1];
+			if (typeof w413 != "number" || w413 > 1.7976931348623157e+308 || w413 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w413, state.scan);
+			state.scan += 4;
+			let w414 = w411[2];
+			if (typeof w414 != "number" || w414 > 1.7976931348623157e+308 || w414 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w414, state.scan);
+			state.scan += 4;
+			let w415 = w411[3];
+			if (typeof w415 != "number" || w415 > 1.7976931348623157e+308 || w415 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w415, state.scan);
+			state.scan += 4;
+			let w416 = w411[4];
+			if (typeof w416 != "number" || w416 > 1.7976931348623157e+308 || w416 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w416, state.scan);
+			state.scan += 4;
+		}
+		let w417 = w356.normalScale;
+		if (w417 != null) {
+			if (typeof w417 != "number" || w417 > 1.7976931348623157e+308 || w417 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w417, state.scan);
+			state.scan += 4;
+		}
+		let w418 = w356.flag17value;
+		if (w418 != null) {
+			if (typeof w418 != "number" || w418 > 1.7976931348623157e+308 || w418 < 5e-324) { throw new Error(); }
+			state.buffer.writeFloatBE(w418, state.scan);
+			state.scan += 4;
+		}
+		let w419 = w356.uvanim_u;
+		if (w419 != null) {
+			if (typeof w419 != "number" || w419 > 32767 || w419 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w419, state.scan);
+			state.scan += 2;
+		}
+		let w420 = w356.uvanim_v;
+		if (w420 != null) {
+			if (typeof w420 != "number" || w420 > 32767 || w420 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w420, state.scan);
+			state.scan += 2;
+		}
+		let w421 = w356.always_0x0901;
+		ext[15].write(state, w421);
+		let w422 = w356.unknownbyte0;
+		if (typeof w422 != "number" || w422 > 255 || w422 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w422, state.scan);
+		state.scan += 1;
+		let w423 = w356.alphamode;
+		if (typeof w423 != "number" || w423 > 255 || w423 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w423, state.scan);
+		state.scan += 1;
+		let w424 = w356.alphacutoff;
+		if (w424 != null) {
+			if (typeof w424 != "number" || w424 > 255 || w424 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w424, state.scan);
+			state.scan += 1;
+		}
+		let w425 = w356.unkFFFF;
+		ext[16].write(state, w425);
+		let w426 = w356.endbyte;
+		if (typeof w426 != "number" || w426 > 255 || w426 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w426, state.scan);
+		state.scan += 1;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1130 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\models.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd6d458d7;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.format = v2; }
+	let v3 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v3 !== undefined) { obj0.version = v3; }
+	let v4 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v4 !== undefined) { obj0.always_0f = v4; }
+	let v5 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v5 !== undefined) { obj0.meshCount = v5; }
+	let v6 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v6 !== undefined) { obj0.unkCount0 = v6; }
+	let v7 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v7 !== undefined) { obj0.unkCount1 = v7; }
+	let v8 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v8 !== undefined) { obj0.unkCount2 = v8; }
+	let v9 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v9 !== undefined) { obj0.unkCount3 = v9; }
+	let hidden10 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden10);
+	hidden10.$opcode = 0;
+	let ref11 = state.stack[state.stack.length - 2].version;
+	let match12 = -1;
+	if (ref11 >= 5) { match12 = 0; }
+	else if (true) { match12 = 1; }
+	if (match12 == -1) { throw new Error("no opcode matched"); }
+	let v13;
+	if (match12 == 0) {
+		let v14 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v13 = v14;
+	}
+	else if (match12 == 1) {
+		v13 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v13 !== undefined) { obj0.unkCount4 = v13; }
+	let ref15 = state.stack[state.stack.length - 1].version;
+	let match16 = -1;
+	if (ref15 <= 3) { match16 = 0; }
+	let v17 = null;
+	if (match16 != -1) {
+		let ref18 = state.stack[state.stack.length - 1].meshCount;
+		ref18 = ref18 + 0;
+		let hidden19 = { $index: 0, $length: ref18 };
+		state.hiddenstack.push(hidden19);
+		state.stack.push({});
+		let arr20 = [];
+		for (let i21 = 0; i21 < ref18; i21++) {
+			hidden19.$index = i21;
+			let obj22 = {};
+			let hidden23 = {};
+			state.stack.push(obj22);
+			state.hiddenstack.push(hidden23);
+			let v24 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v24 !== undefined) { hidden23.$groupFlags = v24; }
+			let v25 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v25 !== undefined) { obj22.unkint = v25; }
+			if (-1 !== undefined) { hidden23.$materialoffset = -1; }
+			let v26 = ext[0].read(state);
+			if (v26 !== undefined) { obj22.material = v26; }
+			let v27 = state.view.getUint16(state.scan, true);
+			state.scan += 2;
+			if (v27 !== undefined) { obj22.faceCount = v27; }
+			let ref28 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref28 = (ref28 >> 0) & 1;
+			ref28 = ref28 + 0;
+			if (ref28 !== undefined) { obj22.hasVertices = ref28; }
+			let ref29 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref29 = (ref29 >> 1) & 1;
+			ref29 = ref29 + 0;
+			if (ref29 !== undefined) { obj22.hasVertexAlpha = ref29; }
+			let ref30 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref30 = (ref30 >> 2) & 1;
+			ref30 = ref30 + 0;
+			if (ref30 !== undefined) { obj22.hasFaceBones = ref30; }
+			let ref31 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref31 = (ref31 >> 3) & 1;
+			ref31 = ref31 + 0;
+			if (ref31 !== undefined) { obj22.hasBoneIds = ref31; }
+			let ref32 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref32 = (ref32 >> 4) & 1;
+			ref32 = ref32 + 0;
+			if (ref32 !== undefined) { obj22.isHidden = ref32; }
+			let ref33 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref33 = (ref33 >> 5) & 1;
+			ref33 = ref33 + 0;
+			if (ref33 !== undefined) { obj22.hasSkin = ref33; }
+			let ref34 = state.stack[state.stack.length - 1].hasVertices;
+			let match35 = -1;
+			if (ref34 == 1) { match35 = 0; }
+			let v36 = null;
+			if (match35 != -1) {
+				let v37 = ext[1].read(state);
+				v36 = v37;
+			}
+			if (v36 !== undefined) { obj22.colourBuffer = v36; }
+			let ref38 = state.stack[state.stack.length - 1].hasVertexAlpha;
+			let match39 = -1;
+			if (ref38 == 1) { match39 = 0; }
+			let v40 = null;
+			if (match39 != -1) {
+				let v41 = ext[2].read(state);
+				v40 = v41;
+			}
+			if (v40 !== undefined) { obj22.alphaBuffer = v40; }
+			let ref42 = state.stack[state.stack.length - 1].hasFaceBones;
+			let match43 = -1;
+			if (ref42 == 1) { match43 = 0; }
+			let v44 = null;
+			if (match43 != -1) {
+				let v45 = ext[3].read(state);
+				v44 = v45;
+			}
+			if (v44 !== undefined) { obj22.faceboneidBuffer = v44; }
+			let v46 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden47 = { $index: 0, $length: v46 };
+			state.hiddenstack.push(hidden47);
+			state.stack.push({});
+			let arr48 = [];
+			for (let i49 = 0; i49 < v46; i49++) {
+				hidden47.$index = i49;
+				let v50 = ext[4].read(state);
+				arr48.push(v50);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr48 !== undefined) { obj22.indexBuffers = arr48; }
+			let hidden51 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden51);
+			let ref52 = state.stack[state.stack.length - 2].hasVertices;
+			ref52 = ref52 + 0;
+			hidden51.$opcode = ref52;
+			let ref53 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match54 = -1;
+			if (ref53 == 1) { match54 = 0; }
+			else if (ref53 == 0) { match54 = 1; }
+			if (match54 == -1) { throw new Error("no opcode matched"); }
+			let v55;
+			if (match54 == 0) {
+				let v56 = state.view.getUint16(state.scan, true);
+				state.scan += 2;
+				v55 = v56;
+			}
+			else if (match54 == 1) {
+				v55 = 0;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			if (v55 !== undefined) { obj22.vertexCount = v55; }
+			let ref57 = state.stack[state.stack.length - 1].hasVertices;
+			let match58 = -1;
+			if (ref57 == 1) { match58 = 0; }
+			let v59 = null;
+			if (match58 != -1) {
+				let v60 = ext[5].read(state);
+				v59 = v60;
+			}
+			if (v59 !== undefined) { obj22.positionBuffer = v59; }
+			let ref61 = state.stack[state.stack.length - 1].hasVertices;
+			let match62 = -1;
+			if (ref61 == 1) { match62 = 0; }
+			let v63 = null;
+			if (match62 != -1) {
+				let hidden64 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden64);
+				let v65 = ext[6].read(state);
+				hidden64.$opcode = v65;
+				let ref66 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match67 = -1;
+				if (ref66 >= 887) { match67 = 0; }
+				else if (ref66 >= 0) { match67 = 1; }
+				if (match67 == -1) { throw new Error("no opcode matched"); }
+				let v68;
+				if (match67 == 0) {
+					let v69 = ext[7].read(state);
+					v68 = v69;
+				}
+				else if (match67 == 1) {
+					let v70 = ext[8].read(state);
+					v68 = v70;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				v63 = v68;
+			}
+			if (v63 !== undefined) { obj22.normalBuffer = v63; }
+			let ref71 = state.stack[state.stack.length - 1].hasVertices;
+			let match72 = -1;
+			if (ref71 == 1) { match72 = 0; }
+			let v73 = null;
+			if (match72 != -1) {
+				let hidden74 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden74);
+				let v75 = ext[9].read(state);
+				hidden74.$opcode = v75;
+				let ref76 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match77 = -1;
+				if (ref76 >= 906) { match77 = 0; }
+				else if (ref76 >= 0) { match77 = 1; }
+				if (match77 == -1) { throw new Error("no opcode matched"); }
+				let v78;
+				if (match77 == 0) {
+					let v79 = ext[10].read(state);
+					v78 = v79;
+				}
+				else if (match77 == 1) {
+					v78 = null;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				v73 = v78;
+			}
+			if (v73 !== undefined) { obj22.tagentBuffer = v73; }
+			let ref80 = state.stack[state.stack.length - 1].hasVertices;
+			let match81 = -1;
+			if (ref80 == 1) { match81 = 0; }
+			let v82 = null;
+			if (match81 != -1) {
+				let hidden83 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden83);
+				let v84 = ext[11].read(state);
+				hidden83.$opcode = v84;
+				let ref85 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match86 = -1;
+				if (ref85 >= 887) { match86 = 0; }
+				else if (ref85 >= 0) { match86 = 1; }
+				if (match86 == -1) { throw new Error("no opcode matched"); }
+				let v87;
+				if (match86 == 0) {
+					let v88 = ext[12].read(state);
+					v87 = v88;
+				}
+				else if (match86 == 1) {
+					let v89 = ext[13].read(state);
+					v87 = v89;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				v82 = v87;
+			}
+			if (v82 !== undefined) { obj22.uvBuffer = v82; }
+			let ref90 = state.stack[state.stack.length - 1].hasBoneIds;
+			let match91 = -1;
+			if (ref90 == 1) { match91 = 0; }
+			let v92 = null;
+			if (match91 != -1) {
+				let v93 = ext[14].read(state);
+				v92 = v93;
+			}
+			if (v92 !== undefined) { obj22.boneidBuffer = v92; }
+			let ref94 = state.stack[state.stack.length - 1].hasSkin;
+			let match95 = -1;
+			if (ref94 == 1) { match95 = 0; }
+			let v96 = null;
+			if (match95 != -1) {
+				let obj97 = {};
+				let hidden98 = {};
+				state.stack.push(obj97);
+				state.hiddenstack.push(hidden98);
+				let v99 = state.view.getUint32(state.scan, true);
+				state.scan += 4;
+				if (v99 !== undefined) { obj97.skinWeightCount = v99; }
+				let v100 = ext[15].read(state);
+				if (v100 !== undefined) { obj97.skinBoneBuffer = v100; }
+				let v101 = ext[16].read(state);
+				if (v101 !== undefined) { obj97.skinWeightBuffer = v101; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				v96 = obj97;
+			}
+			if (v96 !== undefined) { obj22.skin = v96; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr20.push(obj22);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v17 = arr20;
+	}
+	if (v17 !== undefined) { obj0.meshes = v17; }
+	let ref102 = state.stack[state.stack.length - 1].version;
+	let match103 = -1;
+	if (ref102 > 3) { match103 = 0; }
+	let v104 = null;
+	if (match103 != -1) {
+		let obj105 = {};
+		let hidden106 = {};
+		state.stack.push(obj105);
+		state.hiddenstack.push(hidden106);
+		let v107 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v107 !== undefined) { hidden106.$groupFlags = v107; }
+		let v108 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v108 !== undefined) { obj105.positionFormat = v108; }
+		let v109 = state.view.getUint16(state.scan, true);
+		state.scan += 2;
+		if (v109 !== undefined) { obj105.faceCount = v109; }
+		let ref110 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref110 = (ref110 >> 0) & 1;
+		ref110 = ref110 + 0;
+		if (ref110 !== undefined) { obj105.hasVertices = ref110; }
+		let ref111 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref111 = (ref111 >> 1) & 1;
+		ref111 = ref111 + 0;
+		if (ref111 !== undefined) { obj105.hasVertexAlpha = ref111; }
+		let ref112 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref112 = (ref112 >> 2) & 1;
+		ref112 = ref112 + 0;
+		if (ref112 !== undefined) { obj105.hasFaceBones = ref112; }
+		let ref113 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref113 = (ref113 >> 3) & 1;
+		ref113 = ref113 + 0;
+		if (ref113 !== undefined) { obj105.hasBoneIds = ref113; }
+		let ref114 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref114 = (ref114 >> 4) & 1;
+		ref114 = ref114 + 0;
+		if (ref114 !== undefined) { obj105.isHidden = ref114; }
+		let ref115 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+		ref115 = (ref115 >> 5) & 1;
+		ref115 = ref115 + 0;
+		if (ref115 !== undefined) { obj105.hasSkin = ref115; }
+		let v116 = state.view.getUint32(state.scan, true);
+		state.scan += 4;
+		if (v116 !== undefined) { obj105.vertexCount = v116; }
+		let ref117 = state.stack[state.stack.length - 1].hasVertices;
+		let match118 = -1;
+		if (ref117 == 1) { match118 = 0; }
+		let v119 = null;
+		if (match118 != -1) {
+			let hidden120 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden120);
+			let ref121 = state.stack[state.stack.length - 2].positionFormat;
+			ref121 = ref121 + 0;
+			hidden120.$opcode = ref121;
+			let ref122 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match123 = -1;
+			if (ref122 == 0) { match123 = 0; }
+			else if (ref122 == 1) { match123 = 1; }
+			if (match123 == -1) { throw new Error("no opcode matched"); }
+			let v124;
+			if (match123 == 0) {
+				let v125 = ext[17].read(state);
+				v124 = v125;
+			}
+			else if (match123 == 1) {
+				let v126 = ext[18].read(state);
+				v124 = v126;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v119 = v124;
+		}
+		if (v119 !== undefined) { obj105.positionBuffer = v119; }
+		let ref127 = state.stack[state.stack.length - 1].hasVertices;
+		let match128 = -1;
+		if (ref127 == 1) { match128 = 0; }
+		let v129 = null;
+		if (match128 != -1) {
+			let v130 = ext[19].read(state);
+			v129 = v130;
+		}
+		if (v129 !== undefined) { obj105.normalBuffer = v129; }
+		let ref131 = state.stack[state.stack.length - 1].hasVertices;
+		let match132 = -1;
+		if (ref131 == 1) { match132 = 0; }
+		let v133 = null;
+		if (match132 != -1) {
+			let v134 = ext[20].read(state);
+			v133 = v134;
+		}
+		if (v133 !== undefined) { obj105.tagentBuffer = v133; }
+		let ref135 = state.stack[state.stack.length - 1].hasVertices;
+		let match136 = -1;
+		if (ref135 == 1) { match136 = 0; }
+		let v137 = null;
+		if (match136 != -1) {
+			let v138 = ext[21].read(state);
+			v137 = v138;
+		}
+		if (v137 !== undefined) { obj105.uvBuffer = v137; }
+		let ref139 = state.stack[state.stack.length - 1].hasBoneIds;
+		let match140 = -1;
+		if (ref139 == 1) { match140 = 0; }
+		let v141 = null;
+		if (match140 != -1) {
+			let v142 = ext[22].read(state);
+			v141 = v142;
+		}
+		if (v141 !== undefined) { obj105.boneidBuffer = v141; }
+		let ref143 = state.stack[state.stack.length - 1].hasSkin;
+		let match144 = -1;
+		if (ref143 == 1) { match144 = 0; }
+		let v145 = null;
+		if (match144 != -1) {
+			let ref146 = state.stack[state.stack.length - 1].vertexCount;
+			ref146 = ref146 + 0;
+			let hidden147 = { $index: 0, $length: ref146 };
+			state.hiddenstack.push(hidden147);
+			state.stack.push({});
+			let arr148 = [];
+			for (let i149 = 0; i149 < ref146; i149++) {
+				hidden147.$index = i149;
+				let obj150 = {};
+				let hidden151 = {};
+				state.stack.push(obj150);
+				state.hiddenstack.push(hidden151);
+				let v152 = state.view.getUint16(state.scan, true);
+				state.scan += 2;
+				let hidden153 = { $index: 0, $length: v152 };
+				state.hiddenstack.push(hidden153);
+				state.stack.push({});
+				let arr154 = [];
+				for (let i155 = 0; i155 < v152; i155++) {
+					hidden153.$index = i155;
+					let v156 = state.view.getUint16(state.scan, true);
+					state.scan += 2;
+					arr154.push(v156);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr154 !== undefined) { obj150.ids = arr154; }
+				let v157 = state.view.getUint16(state.scan, true);
+				state.scan += 2;
+				let hidden158 = { $index: 0, $length: v157 };
+				state.hiddenstack.push(hidden158);
+				state.stack.push({});
+				let arr159 = [];
+				for (let i160 = 0; i160 < v157; i160++) {
+					hidden158.$index = i160;
+					let v161 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr159.push(v161);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr159 !== undefined) { obj150.weights = arr159; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				arr148.push(obj150);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v145 = arr148;
+		}
+		if (v145 !== undefined) { obj105.skin = v145; }
+		let ref162 = state.stack[state.stack.length - 1].hasVertices;
+		let match163 = -1;
+		if (ref162 == 1) { match163 = 0; }
+		let v164 = null;
+		if (match163 != -1) {
+			let v165 = ext[23].read(state);
+			v164 = v165;
+		}
+		if (v164 !== undefined) { obj105.vertexColours = v164; }
+		let ref166 = state.stack[state.stack.length - 1].hasVertices;
+		let match167 = -1;
+		if (ref166 == 1) { match167 = 0; }
+		let v168 = null;
+		if (match167 != -1) {
+			let v169 = ext[24].read(state);
+			v168 = v169;
+		}
+		if (v168 !== undefined) { obj105.vertexAlpha = v168; }
+		let ref170 = state.stack[state.stack.length - 1].hasFaceBones;
+		let match171 = -1;
+		if (ref170 == 1) { match171 = 0; }
+		let v172 = null;
+		if (match171 != -1) {
+			let v173 = ext[25].read(state);
+			v172 = v173;
+		}
+		if (v172 !== undefined) { obj105.vertexFacebones = v172; }
+		let ref174 = state.stack[state.stack.length - 2].meshCount;
+		ref174 = ref174 + 0;
+		let hidden175 = { $index: 0, $length: ref174 };
+		state.hiddenstack.push(hidden175);
+		state.stack.push({});
+		let arr176 = [];
+		for (let i177 = 0; i177 < ref174; i177++) {
+			hidden175.$index = i177;
+			let obj178 = {};
+			let hidden179 = {};
+			state.stack.push(obj178);
+			state.hiddenstack.push(hidden179);
+			let v180 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v180 !== undefined) { hidden179.$groupFlags = v180; }
+			let ref181 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref181 = (ref181 >> 0) & 1;
+			ref181 = ref181 + 0;
+			if (ref181 !== undefined) { obj178.hasVertices = ref181; }
+			let ref182 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref182 = (ref182 >> 1) & 1;
+			ref182 = ref182 + 0;
+			if (ref182 !== undefined) { obj178.hasVertexAlpha = ref182; }
+			let ref183 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref183 = (ref183 >> 2) & 1;
+			ref183 = ref183 + 0;
+			if (ref183 !== undefined) { obj178.hasFaceBones = ref183; }
+			let ref184 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref184 = (ref184 >> 3) & 1;
+			ref184 = ref184 + 0;
+			if (ref184 !== undefined) { obj178.hasBoneIds = ref184; }
+			let ref185 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref185 = (ref185 >> 4) & 1;
+			ref185 = ref185 + 0;
+			if (ref185 !== undefined) { obj178.isHidden = ref185; }
+			let ref186 = state.hiddenstack[state.hiddenstack.length - 1].$groupFlags;
+			ref186 = (ref186 >> 5) & 1;
+			ref186 = ref186 + 0;
+			if (ref186 !== undefined) { obj178.hasSkin = ref186; }
+			let v187 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v187 !== undefined) { obj178.unkint = v187; }
+			if (-1 !== undefined) { hidden179.$materialoffset = -1; }
+			let v188 = ext[26].read(state);
+			if (v188 !== undefined) { obj178.material = v188; }
+			let v189 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v189 !== undefined) { obj178.unkbyte2 = v189; }
+			let hidden190 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden190);
+			hidden190.$opcode = 0;
+			let ref191 = state.stack[state.stack.length - 4].vertexCount;
+			let match192 = -1;
+			if (ref191 <= 65535) { match192 = 0; }
+			else if (true) { match192 = 1; }
+			if (match192 == -1) { throw new Error("no opcode matched"); }
+			let v193;
+			if (match192 == 0) {
+				let v194 = ext[27].read(state);
+				v193 = v194;
+			}
+			else if (match192 == 1) {
+				let v195 = ext[28].read(state);
+				v193 = v195;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			if (v193 !== undefined) { obj178.buf = v193; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr176.push(obj178);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		if (arr176 !== undefined) { obj105.renders = arr176; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v104 = obj105;
+	}
+	if (v104 !== undefined) { obj0.meshdata = v104; }
+	let ref196 = state.stack[state.stack.length - 1].unkCount1;
+	ref196 = ref196 + 0;
+	let hidden197 = { $index: 0, $length: ref196 };
+	state.hiddenstack.push(hidden197);
+	state.stack.push({});
+	let arr198 = [];
+	for (let i199 = 0; i199 < ref196; i199++) {
+		hidden197.$index = i199;
+		let v200 = ext[29].read(state);
+		arr198.push(v200);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr198 !== undefined) { obj0.unk1Buffer = arr198; }
+	let ref201 = state.stack[state.stack.length - 1].unkCount2;
+	ref201 = ref201 + 0;
+	let hidden202 = { $index: 0, $length: ref201 };
+	state.hiddenstack.push(hidden202);
+	state.stack.push({});
+	let arr203 = [];
+	for (let i204 = 0; i204 < ref201; i204++) {
+		hidden202.$index = i204;
+		let v205 = ext[30].read(state);
+		arr203.push(v205);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr203 !== undefined) { obj0.unk2Buffer = arr203; }
+	let ref206 = state.stack[state.stack.length - 1].unkCount3;
+	ref206 = ref206 + 0;
+	let hidden207 = { $index: 0, $length: ref206 };
+	state.hiddenstack.push(hidden207);
+	state.stack.push({});
+	let arr208 = [];
+	for (let i209 = 0; i209 < ref206; i209++) {
+		hidden207.$index = i209;
+		let v210 = ext[31].read(state);
+		arr208.push(v210);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr208 !== undefined) { obj0.unk3Buffer = arr208; }
+	let ref211 = state.stack[state.stack.length - 1].unkCount4;
+	ref211 = ref211 + 0;
+	let hidden212 = { $index: 0, $length: ref211 };
+	state.hiddenstack.push(hidden212);
+	state.stack.push({});
+	let arr213 = [];
+	for (let i214 = 0; i214 < ref211; i214++) {
+		hidden212.$index = i214;
+		let v215 = ext[32].read(state);
+		arr213.push(v215);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr213 !== undefined) { obj0.unk4Buffer = arr213; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden216 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden216);
+	let w217 = value.format;
+	if (typeof w217 != "number" || w217 > 255 || w217 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w217, state.scan);
+	state.scan += 1;
+	let w218 = value.version;
+	if (typeof w218 != "number" || w218 > 255 || w218 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w218, state.scan);
+	state.scan += 1;
+	let w219 = value.always_0f;
+	if (typeof w219 != "number" || w219 > 255 || w219 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w219, state.scan);
+	state.scan += 1;
+	let w220 = value.meshCount;
+	if (typeof w220 != "number" || w220 > 255 || w220 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w220, state.scan);
+	state.scan += 1;
+	let w221 = value.unkCount0;
+	if (typeof w221 != "number" || w221 > 255 || w221 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w221, state.scan);
+	state.scan += 1;
+	let w222 = value.unkCount1;
+	if (typeof w222 != "number" || w222 > 255 || w222 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w222, state.scan);
+	state.scan += 1;
+	let w223 = value.unkCount2;
+	if (typeof w223 != "number" || w223 > 255 || w223 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w223, state.scan);
+	state.scan += 1;
+	let w224 = value.unkCount3;
+	if (typeof w224 != "number" || w224 > 255 || w224 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w224, state.scan);
+	state.scan += 1;
+	let w225 = value.unkCount4;
+	let hidden226 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden226);
+	let ref227 = state.stack[state.stack.length - 2].version;
+	let match228 = -1;
+	if (ref227 >= 5) { match228 = 0; }
+	else if (true) { match228 = 1; }
+	if (match228 == -1) { throw new Error("no opcode matched"); }
+	if (match228 == 0) {
+		if (typeof w225 != "number" || w225 > 255 || w225 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w225, state.scan);
+		state.scan += 1;
+	}
+	else if (match228 == 1) {
+		if (w225 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w229 = value.meshes;
+	if (w229 != null) {
+		if (!Array.isArray(w229)) { throw new Error("array expected"); }
+		let w230 = w229.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w229.length });
+		for (let i231 = 0; i231 < w229.length; i231++) {
+			let w232 = w229[i231];
+			if (typeof w232 != "object" || !w232) { throw new Error("object expected"); }
+			let hidden233 = {};
+			state.stack.push(w232);
+			state.hiddenstack.push(hidden233);
+			let w234 = w232.$groupFlags;
+			w234 ??= 0;
+			w234 = ext[33].resolve(w232, w234);
+			w234 = ext[34].resolve(w232, w234);
+			w234 = ext[35].resolve(w232, w234);
+			w234 = ext[36].resolve(w232, w234);
+			w234 = ext[37].resolve(w232, w234);
+			w234 = ext[38].resolve(w232, w234);
+			hidden233.$groupFlags = w234;
+			if (typeof w234 != "number" || w234 > 255 || w234 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w234, state.scan);
+			state.scan += 1;
+			let w235 = w232.unkint;
+			if (typeof w235 != "number" || w235 > 4294967295 || w235 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w235, state.scan);
+			state.scan += 4;
+			let w236 = w232.$materialoffset;
+			w236 = ext[39].readConst(state);
+			hidden233.$materialoffset = w236;
+			if (w236 != -1) { throw new Error("expected constant -1 was not present during write"); }
+			let w237 = w232.material;
+			ext[0].write(state, w237);
+			let w238 = w232.faceCount;
+			if (typeof w238 != "number" || w238 > 65535 || w238 < 0) { throw new Error(); }
+			state.buffer.writeUint16LE(w238, state.scan);
+			state.scan += 2;
+			let w239 = w232.hasVertices;
+			let w240 = w232.hasVertexAlpha;
+			let w241 = w232.hasFaceBones;
+			let w242 = w232.hasBoneIds;
+			let w243 = w232.isHidden;
+			let w244 = w232.hasSkin;
+			let w245 = w232.colourBuffer;
+			if (w245 != null) {
+				ext[1].write(state, w245);
+			}
+			let w246 = w232.alphaBuffer;
+			if (w246 != null) {
+				ext[2].write(state, w246);
+			}
+			let w247 = w232.faceboneidBuffer;
+			if (w247 != null) {
+				ext[3].write(state, w247);
+			}
+			let w248 = w232.indexBuffers;
+			if (!Array.isArray(w248)) { throw new Error("array expected"); }
+			let w249 = w248.length;
+			if (typeof w249 != "number" || w249 > 255 || w249 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w249, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w248.length });
+			for (let i250 = 0; i250 < w248.length; i250++) {
+				let w251 = w248[i250];
+				ext[4].write(state, w251);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			let w252 = w232.vertexCount;
+			let hidden253 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden253);
+			hidden253.$opcode = ext[40].readConst(state);
+			let ref254 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match255 = -1;
+			if (ref254 == 1) { match255 = 0; }
+			else if (ref254 == 0) { match255 = 1; }
+			if (match255 == -1) { throw new Error("no opcode matched"); }
+			if (match255 == 0) {
+				if (typeof w252 != "number" || w252 > 65535 || w252 < 0) { throw new Error(); }
+				state.buffer.writeUint16LE(w252, state.scan);
+				state.scan += 2;
+			}
+			else if (match255 == 1) {
+				if (w252 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			let w256 = w232.positionBuffer;
+			if (w256 != null) {
+				ext[5].write(state, w256);
+			}
+			let w257 = w232.normalBuffer;
+			if (w257 != null) {
+				let hidden258 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden258);
+				hidden258.$opcode = ext[6].readConst(state);
+				let ref259 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match260 = -1;
+				if (ref259 >= 887) { match260 = 0; }
+				else if (ref259 >= 0) { match260 = 1; }
+				if (match260 == -1) { throw new Error("no opcode matched"); }
+				if (match260 == 0) {
+					ext[7].write(state, w257);
+				}
+				else if (match260 == 1) {
+					ext[8].write(state, w257);
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			let w261 = w232.tagentBuffer;
+			if (w261 != null) {
+				let hidden262 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden262);
+				hidden262.$opcode = ext[9].readConst(state);
+				let ref263 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match264 = -1;
+				if (ref263 >= 906) { match264 = 0; }
+				else if (ref263 >= 0) { match264 = 1; }
+				if (match264 == -1) { throw new Error("no opcode matched"); }
+				if (match264 == 0) {
+					ext[10].write(state, w261);
+				}
+				else if (match264 == 1) {
+					if (w261 != null) { throw new Error("expected constant null was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			let w265 = w232.uvBuffer;
+			if (w265 != null) {
+				let hidden266 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden266);
+				hidden266.$opcode = ext[11].readConst(state);
+				let ref267 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match268 = -1;
+				if (ref267 >= 887) { match268 = 0; }
+				else if (ref267 >= 0) { match268 = 1; }
+				if (match268 == -1) { throw new Error("no opcode matched"); }
+				if (match268 == 0) {
+					ext[12].write(state, w265);
+				}
+				else if (match268 == 1) {
+					ext[13].write(state, w265);
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			let w269 = w232.boneidBuffer;
+			if (w269 != null) {
+				ext[14].write(state, w269);
+			}
+			let w270 = w232.skin;
+			if (w270 != null) {
+				if (typeof w270 != "object" || !w270) { throw new Error("object expected"); }
+				let hidden271 = {};
+				state.stack.push(w270);
+				state.hiddenstack.push(hidden271);
+				let w272 = w270.skinWeightCount;
+				if (typeof w272 != "number" || w272 > 4294967295 || w272 < 0) { throw new Error(); }
+				state.buffer.writeUint32LE(w272, state.scan);
+				state.scan += 4;
+				let w273 = w270.skinBoneBuffer;
+				ext[15].write(state, w273);
+				let w274 = w270.skinWeightBuffer;
+				ext[16].write(state, w274);
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w275 = value.meshdata;
+	if (w275 != null) {
+		if (typeof w275 != "object" || !w275) { throw new Error("object expected"); }
+		let hidden276 = {};
+		state.stack.push(w275);
+		state.hiddenstack.push(hidden276);
+		let w277 = w275.$groupFlags;
+		w277 ??= 0;
+		w277 = ext[41].resolve(w275, w277);
+		w277 = ext[42].resolve(w275, w277);
+		w277 = ext[43].resolve(w275, w277);
+		w277 = ext[44].resolve(w275, w277);
+		w277 = ext[45].resolve(w275, w277);
+		w277 = ext[46].resolve(w275, w277);
+		hidden276.$groupFlags = w277;
+		if (typeof w277 != "number" || w277 > 255 || w277 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w277, state.scan);
+		state.scan += 1;
+		let w278 = w275.positionFormat;
+		if (typeof w278 != "number" || w278 > 255 || w278 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w278, state.scan);
+		state.scan += 1;
+		let w279 = w275.faceCount;
+		if (typeof w279 != "number" || w279 > 65535 || w279 < 0) { throw new Error(); }
+		state.buffer.writeUint16LE(w279, state.scan);
+		state.scan += 2;
+		let w280 = w275.hasVertices;
+		let w281 = w275.hasVertexAlpha;
+		let w282 = w275.hasFaceBones;
+		let w283 = w275.hasBoneIds;
+		let w284 = w275.isHidden;
+		let w285 = w275.hasSkin;
+		let w286 = w275.vertexCount;
+		if (typeof w286 != "number" || w286 > 4294967295 || w286 < 0) { throw new Error(); }
+		state.buffer.writeUint32LE(w286, state.scan);
+		state.scan += 4;
+		let w287 = w275.positionBuffer;
+		if (w287 != null) {
+			let hidden288 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden288);
+			hidden288.$opcode = ext[47].readConst(state);
+			let ref289 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match290 = -1;
+			if (ref289 == 0) { match290 = 0; }
+			else if (ref289 == 1) { match290 = 1; }
+			if (match290 == -1) { throw new Error("no opcode matched"); }
+			if (match290 == 0) {
+				ext[17].write(state, w287);
+			}
+			else if (match290 == 1) {
+				ext[18].write(state, w287);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		let w291 = w275.normalBuffer;
+		if (w291 != null) {
+			ext[19].write(state, w291);
+		}
+		let w292 = w275.tagentBuffer;
+		if (w292 != null) {
+			ext[20].write(state, w292);
+		}
+		let w293 = w275.uvBuffer;
+		if (w293 != null) {
+			ext[21].write(state, w293);
+		}
+		let w294 = w275.boneidBuffer;
+		if (w294 != null) {
+			ext[22].write(state, w294);
+		}
+		let w295 = w275.skin;
+		if (w295 != null) {
+			if (!Array.isArray(w295)) { throw new Error("array expected"); }
+			let w296 = w295.length;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w295.length });
+			for (let i297 = 0; i297 < w295.length; i297++) {
+				let w298 = w295[i297];
+				if (typeof w298 != "object" || !w298) { throw new Error("object expected"); }
+				let hidden299 = {};
+				state.stack.push(w298);
+				state.hiddenstack.push(hidden299);
+				let w300 = w298.ids;
+				if (!Array.isArray(w300)) { throw new Error("array expected"); }
+				let w301 = w300.length;
+				if (typeof w301 != "number" || w301 > 65535 || w301 < 0) { throw new Error(); }
+				state.buffer.writeUint16LE(w301, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w300.length });
+				for (let i302 = 0; i302 < w300.length; i302++) {
+					let w303 = w300[i302];
+					if (typeof w303 != "number" || w303 > 65535 || w303 < 0) { throw new Error(); }
+					state.buffer.writeUint16LE(w303, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w304 = w298.weights;
+				if (!Array.isArray(w304)) { throw new Error("array expected"); }
+				let w305 = w304.length;
+				if (typeof w305 != "number" || w305 > 65535 || w305 < 0) { throw new Error(); }
+				state.buffer.writeUint16LE(w305, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w304.length });
+				for (let i306 = 0; i306 < w304.length; i306++) {
+					let w307 = w304[i306];
+					if (typeof w307 != "number" || w307 > 255 || w307 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w307, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		let w308 = w275.vertexColours;
+		if (w308 != null) {
+			ext[23].write(state, w308);
+		}
+		let w309 = w275.vertexAlpha;
+		if (w309 != null) {
+			ext[24].write(state, w309);
+		}
+		let w310 = w275.vertexFacebones;
+		if (w310 != null) {
+			ext[25].write(state, w310);
+		}
+		let w311 = w275.renders;
+		if (!Array.isArray(w311)) { throw new Error("array expected"); }
+		let w312 = w311.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w311.length });
+		for (let i313 = 0; i313 < w311.length; i313++) {
+			let w314 = w311[i313];
+			if (typeof w314 != "object" || !w314) { throw new Error("object expected"); }
+			let hidden315 = {};
+			state.stack.push(w314);
+			state.hiddenstack.push(hidden315);
+			let w316 = w314.$groupFlags;
+			w316 ??= 0;
+			w316 = ext[48].resolve(w314, w316);
+			w316 = ext[49].resolve(w314, w316);
+			w316 = ext[50].resolve(w314, w316);
+			w316 = ext[51].resolve(w314, w316);
+			w316 = ext[52].resolve(w314, w316);
+			w316 = ext[53].resolve(w314, w316);
+			hidden315.$groupFlags = w316;
+			if (typeof w316 != "number" || w316 > 255 || w316 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w316, state.scan);
+			state.scan += 1;
+			let w317 = w314.hasVertices;
+			let w318 = w314.hasVertexAlpha;
+			let w319 = w314.hasFaceBones;
+			let w320 = w314.hasBoneIds;
+			let w321 = w314.isHidden;
+			let w322 = w314.hasSkin;
+			let w323 = w314.unkint;
+			if (typeof w323 != "number" || w323 > 4294967295 || w323 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w323, state.scan);
+			state.scan += 4;
+			let w324 = w314.$materialoffset;
+			w324 = ext[54].readConst(state);
+			hidden315.$materialoffset = w324;
+			if (w324 != -1) { throw new Error("expected constant -1 was not present during write"); }
+			let w325 = w314.material;
+			ext[26].write(state, w325);
+			let w326 = w314.unkbyte2;
+			if (typeof w326 != "number" || w326 > 255 || w326 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w326, state.scan);
+			state.scan += 1;
+			let w327 = w314.buf;
+			let hidden328 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden328);
+			let ref329 = state.stack[state.stack.length - 4].vertexCount;
+			let match330 = -1;
+			if (ref329 <= 65535) { match330 = 0; }
+			else if (true) { match330 = 1; }
+			if (match330 == -1) { throw new Error("no opcode matched"); }
+			if (match330 == 0) {
+				ext[27].write(state, w327);
+			}
+			else if (match330 == 1) {
+				ext[28].write(state, w327);
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w331 = value.unk1Buffer;
+	if (!Array.isArray(w331)) { throw new Error("array expected"); }
+	let w332 = w331.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w331.length });
+	for (let i333 = 0; i333 < w331.length; i333++) {
+		let w334 = w331[i333];
+		ext[29].write(state, w334);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w335 = value.unk2Buffer;
+	if (!Array.isArray(w335)) { throw new Error("array expected"); }
+	let w336 = w335.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w335.length });
+	for (let i337 = 0; i337 < w335.length; i337++) {
+		let w338 = w335[i337];
+		ext[30].write(state, w338);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w339 = value.unk3Buffer;
+	if (!Array.isArray(w339)) { throw new Error("array expected"); }
+	let w340 = w339.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w339.length });
+	for (let i341 = 0; i341 < w339.length; i341++) {
+		let w342 = w339[i341];
+		ext[31].write(state, w342);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w343 = value.unk4Buffer;
+	if (!Array.isArray(w343)) { throw new Error("array expected"); }
+	let w344 = w343.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w343.length });
+	for (let i345 = 0; i345 < w343.length; i345++) {
+		let w346 = w343[i345];
+		ext[32].write(state, w346);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
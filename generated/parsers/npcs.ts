@@ -0,0 +1,2891 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\npcs.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xef463dea;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				let hidden4 = { $index: 0, $length: v3 };
+				state.hiddenstack.push(hidden4);
+				state.stack.push({});
+				let arr5 = [];
+				for (let i6 = 0; i6 < v3; i6++) {
+					hidden4.$index = i6;
+					let hidden7 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden7);
+					let v8 = ext[1].read(state);
+					hidden7.$opcode = v8;
+					let ref9 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match10 = -1;
+					if (ref9 >= 669) { match10 = 0; }
+					else if (ref9 >= 0) { match10 = 1; }
+					if (match10 == -1) { throw new Error("no opcode matched"); }
+					let v11;
+					if (match10 == 0) {
+						let v12 = ext[2].read(state);
+						v11 = v12;
+					}
+					else if (match10 == 1) {
+						let v13 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v11 = v13;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr5.push(v11);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.models = arr5;
+				break;
+			}
+			case 2: {
+				let v14 = ext[3].read(state);
+				obj0.name = v14;
+				break;
+			}
+			case 3: {
+				let v15 = ext[3].read(state);
+				obj0.examine = v15;
+				break;
+			}
+			case 8: {
+				let v16 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_08 = v16;
+				break;
+			}
+			case 11: {
+				let v17 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0B = v17;
+				break;
+			}
+			case 12: {
+				let v18 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.boundSize = v18;
+				break;
+			}
+			case 13: {
+				let v19 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk_0D = v19;
+				break;
+			}
+			case 14: {
+				let v20 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk_0E = v20;
+				break;
+			}
+			case 17: {
+				let hidden21 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden21);
+				state.stack.push({});
+				let arr22 = [];
+				for (let i23 = 0; i23 < 4; i23++) {
+					hidden21.$index = i23;
+					let v24 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr22.push(v24);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk_11 = arr22;
+				break;
+			}
+			case 26: {
+				let v25 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk_1A = v25;
+				break;
+			}
+			case 27: {
+				let v26 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk_1B = v26;
+				break;
+			}
+			case 30: {
+				let v27 = ext[3].read(state);
+				obj0.actions_0 = v27;
+				break;
+			}
+			case 31: {
+				let v28 = ext[3].read(state);
+				obj0.actions_1 = v28;
+				break;
+			}
+			case 32: {
+				let v29 = ext[3].read(state);
+				obj0.actions_2 = v29;
+				break;
+			}
+			case 33: {
+				let v30 = ext[3].read(state);
+				obj0.actions_3 = v30;
+				break;
+			}
+			case 34: {
+				let v31 = ext[3].read(state);
+				obj0.actions_4 = v31;
+				break;
+			}
+			case 40: {
+				let v32 = ext[0].read(state);
+				let hidden33 = { $index: 0, $length: v32 };
+				state.hiddenstack.push(hidden33);
+				state.stack.push({});
+				let arr34 = [];
+				for (let i35 = 0; i35 < v32; i35++) {
+					hidden33.$index = i35;
+					let v36 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v37 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr38 = [v36, v37];
+					arr34.push(arr38);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.color_replacements = arr34;
+				break;
+			}
+			case 41: {
+				let v39 = ext[0].read(state);
+				let hidden40 = { $index: 0, $length: v39 };
+				state.hiddenstack.push(hidden40);
+				state.stack.push({});
+				let arr41 = [];
+				for (let i42 = 0; i42 < v39; i42++) {
+					hidden40.$index = i42;
+					let v43 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v44 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr45 = [v43, v44];
+					arr41.push(arr45);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.material_replacements = arr41;
+				break;
+			}
+			case 42: {
+				let v46 = ext[0].read(state);
+				let hidden47 = { $index: 0, $length: v46 };
+				state.hiddenstack.push(hidden47);
+				state.stack.push({});
+				let arr48 = [];
+				for (let i49 = 0; i49 < v46; i49++) {
+					hidden47.$index = i49;
+					let v50 = state.view.getInt8(state.scan);
+					state.scan += 1;
+					arr48.push(v50);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.recolourPalette = arr48;
+				break;
+			}
+			case 44: {
+				let v51 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.recolor_indices = v51;
+				break;
+			}
+			case 45: {
+				let v52 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.retexture_indices = v52;
+				break;
+			}
+			case 60: {
+				let v53 = ext[0].read(state);
+				let hidden54 = { $index: 0, $length: v53 };
+				state.hiddenstack.push(hidden54);
+				state.stack.push({});
+				let arr55 = [];
+				for (let i56 = 0; i56 < v53; i56++) {
+					hidden54.$index = i56;
+					let hidden57 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden57);
+					let v58 = ext[4].read(state);
+					hidden57.$opcode = v58;
+					let ref59 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match60 = -1;
+					if (ref59 >= 669) { match60 = 0; }
+					else if (ref59 >= 0) { match60 = 1; }
+					if (match60 == -1) { throw new Error("no opcode matched"); }
+					let v61;
+					if (match60 == 0) {
+						let v62 = ext[2].read(state);
+						v61 = v62;
+					}
+					else if (match60 == 1) {
+						let v63 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v61 = v63;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr55.push(v61);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.headModels = arr55;
+				break;
+			}
+			case 93: {
+				obj0.drawMapDot = false;
+				break;
+			}
+			case 95: {
+				let v64 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.combat = v64;
+				break;
+			}
+			case 97: {
+				let v65 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scaleXZ = v65;
+				break;
+			}
+			case 98: {
+				let v66 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scaleY = v66;
+				break;
+			}
+			case 99: {
+				obj0.unknown_63 = true;
+				break;
+			}
+			case 100: {
+				let v67 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.ambience = v67;
+				break;
+			}
+			case 101: {
+				let v68 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.modelContract = v68;
+				break;
+			}
+			case 102: {
+				let v69 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.head_icon_data = v69;
+				break;
+			}
+			case 103: {
+				let v70 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_67 = v70;
+				break;
+			}
+			case 106: {
+				let obj71 = {};
+				let hidden72 = {};
+				state.stack.push(obj71);
+				state.hiddenstack.push(hidden72);
+				let v73 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v73 !== undefined) { obj71.varbit = v73; }
+				let v74 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v74 !== undefined) { obj71.varp = v74; }
+				let hidden75 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden75);
+				let v76 = ext[5].read(state);
+				hidden75.$opcode = v76;
+				let ref77 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match78 = -1;
+				if (ref77 >= 910) { match78 = 0; }
+				else if (ref77 >= 0) { match78 = 1; }
+				if (match78 == -1) { throw new Error("no opcode matched"); }
+				let v79;
+				if (match78 == 0) {
+					let v80 = ext[0].read(state);
+					v79 = v80;
+				}
+				else if (match78 == 1) {
+					let v81 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v79 = v81;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let hidden82 = { $index: 0, $length: v79 };
+				state.hiddenstack.push(hidden82);
+				state.stack.push({});
+				let arr83 = [];
+				for (let i84 = 0; i84 < v79; i84++) {
+					hidden82.$index = i84;
+					let v85 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr83.push(v85);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr83 !== undefined) { obj71.options = arr83; }
+				let v86 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v86 !== undefined) { obj71.default = v86; }
+				let hidden87 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden87);
+				let v88 = ext[6].read(state);
+				hidden87.$opcode = v88;
+				let ref89 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match90 = -1;
+				if (ref89 >= 525) { match90 = 0; }
+				else if (ref89 >= 0) { match90 = 1; }
+				if (match90 == -1) { throw new Error("no opcode matched"); }
+				let v91;
+				if (match90 == 0) {
+					let v92 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v91 = v92;
+				}
+				else if (match90 == 1) {
+					v91 = null;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				if (v91 !== undefined) { obj71.unk5 = v91; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morphs_1 = obj71;
+				break;
+			}
+			case 107: {
+				obj0.unknown_6B = false;
+				break;
+			}
+			case 109: {
+				obj0.slowWalk = false;
+				break;
+			}
+			case 111: {
+				obj0.animateIdle = false;
+				break;
+			}
+			case 113: {
+				let obj93 = {};
+				let hidden94 = {};
+				state.stack.push(obj93);
+				state.hiddenstack.push(hidden94);
+				let v95 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v95 !== undefined) { obj93.SrcColor = v95; }
+				let v96 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v96 !== undefined) { obj93.DstColor = v96; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.shadow = obj93;
+				break;
+			}
+			case 114: {
+				let obj97 = {};
+				let hidden98 = {};
+				state.stack.push(obj97);
+				state.hiddenstack.push(hidden98);
+				let v99 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v99 !== undefined) { obj97.Src = v99; }
+				let v100 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v100 !== undefined) { obj97.Dst = v100; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.shadowAlphaIntensity = obj97;
+				break;
+			}
+			case 115: {
+				let v101 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v102 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr103 = [v101, v102];
+				obj0.unknown_73 = arr103;
+				break;
+			}
+			case 118: {
+				let obj104 = {};
+				let hidden105 = {};
+				state.stack.push(obj104);
+				state.hiddenstack.push(hidden105);
+				let v106 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v106 !== undefined) { obj104.varbit = v106; }
+				let v107 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v107 !== undefined) { obj104.varp = v107; }
+				let v108 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v108 !== undefined) { obj104.unk2 = v108; }
+				let hidden109 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden109);
+				let v110 = ext[7].read(state);
+				hidden109.$opcode = v110;
+				let ref111 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match112 = -1;
+				if (ref111 >= 910) { match112 = 0; }
+				else if (ref111 >= 0) { match112 = 1; }
+				if (match112 == -1) { throw new Error("no opcode matched"); }
+				let v113;
+				if (match112 == 0) {
+					let v114 = ext[0].read(state);
+					v113 = v114;
+				}
+				else if (match112 == 1) {
+					let v115 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v113 = v115;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				let hidden116 = { $index: 0, $length: v113 };
+				state.hiddenstack.push(hidden116);
+				state.stack.push({});
+				let arr117 = [];
+				for (let i118 = 0; i118 < v113; i118++) {
+					hidden116.$index = i118;
+					let v119 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr117.push(v119);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr117 !== undefined) { obj104.options = arr117; }
+				let v120 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v120 !== undefined) { obj104.default = v120; }
+				let v121 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v121 !== undefined) { obj104.unk5 = v121; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.morphs_2 = obj104;
+				break;
+			}
+			case 119: {
+				let v122 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.movementCapabilities = v122;
+				break;
+			}
+			case 120: {
+				let v123 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v124 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v125 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v126 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr127 = [v123, v124, v125, v126];
+				obj0.unknown_78 = arr127;
+				break;
+			}
+			case 121: {
+				let v128 = ext[0].read(state);
+				let hidden129 = { $index: 0, $length: v128 };
+				state.hiddenstack.push(hidden129);
+				state.stack.push({});
+				let arr130 = [];
+				for (let i131 = 0; i131 < v128; i131++) {
+					hidden129.$index = i131;
+					let v132 = ext[8].read(state);
+					arr130.push(v132);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.translations = arr130;
+				break;
+			}
+			case 122: {
+				let v133 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk_7A = v133;
+				break;
+			}
+			case 123: {
+				let v134 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.iconHeight = v134;
+				break;
+			}
+			case 125: {
+				let v135 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.respawnDirection = v135;
+				break;
+			}
+			case 127: {
+				let v136 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.animation_group = v136;
+				break;
+			}
+			case 128: {
+				let v137 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				obj0.movementType = v137;
+				break;
+			}
+			case 134: {
+				let obj138 = {};
+				let hidden139 = {};
+				state.stack.push(obj138);
+				state.hiddenstack.push(hidden139);
+				let v140 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v140 !== undefined) { obj138.unk1 = v140; }
+				let v141 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v141 !== undefined) { obj138.unk2 = v141; }
+				let v142 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v142 !== undefined) { obj138.unk3 = v142; }
+				let v143 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v143 !== undefined) { obj138.unk4 = v143; }
+				let v144 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v144 !== undefined) { obj138.unk45 = v144; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.ambient_sound = obj138;
+				break;
+			}
+			case 135: {
+				let obj145 = {};
+				let hidden146 = {};
+				state.stack.push(obj145);
+				state.hiddenstack.push(hidden146);
+				let v147 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v147 !== undefined) { obj145.Op = v147; }
+				let v148 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v148 !== undefined) { obj145.Cursor = v148; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.oldCursor = obj145;
+				break;
+			}
+			case 136: {
+				let obj149 = {};
+				let hidden150 = {};
+				state.stack.push(obj149);
+				state.hiddenstack.push(hidden150);
+				let v151 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v151 !== undefined) { obj149.Op = v151; }
+				let v152 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v152 !== undefined) { obj149.Cursor = v152; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.oldCursor2 = obj149;
+				break;
+			}
+			case 137: {
+				let v153 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.attackCursor = v153;
+				break;
+			}
+			case 138: {
+				let v154 = ext[9].read(state);
+				obj0.armyIcon = v154;
+				break;
+			}
+			case 140: {
+				let v155 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_8C = v155;
+				break;
+			}
+			case 141: {
+				obj0.unknown_8D = true;
+				break;
+			}
+			case 142: {
+				let v156 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.mapFunction = v156;
+				break;
+			}
+			case 143: {
+				obj0.unknown_8F = true;
+				break;
+			}
+			case 150: {
+				let v157 = ext[3].read(state);
+				obj0.members_actions_0 = v157;
+				break;
+			}
+			case 151: {
+				let v158 = ext[3].read(state);
+				obj0.members_actions_1 = v158;
+				break;
+			}
+			case 152: {
+				let v159 = ext[3].read(state);
+				obj0.members_actions_2 = v159;
+				break;
+			}
+			case 153: {
+				let v160 = ext[3].read(state);
+				obj0.members_actions_3 = v160;
+				break;
+			}
+			case 154: {
+				let v161 = ext[3].read(state);
+				obj0.members_actions_4 = v161;
+				break;
+			}
+			case 155: {
+				let obj162 = {};
+				let hidden163 = {};
+				state.stack.push(obj162);
+				state.hiddenstack.push(hidden163);
+				let v164 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v164 !== undefined) { obj162.unknown_1 = v164; }
+				let v165 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v165 !== undefined) { obj162.unknown_2 = v165; }
+				let v166 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v166 !== undefined) { obj162.unknown_3 = v166; }
+				let v167 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				if (v167 !== undefined) { obj162.unknown_4 = v167; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_9B = obj162;
+				break;
+			}
+			case 158: {
+				obj0.aByte3076_set_1 = true;
+				break;
+			}
+			case 159: {
+				obj0.aByte3076_set_0 = false;
+				break;
+			}
+			case 160: {
+				let v168 = ext[0].read(state);
+				let hidden169 = { $index: 0, $length: v168 };
+				state.hiddenstack.push(hidden169);
+				state.stack.push({});
+				let arr170 = [];
+				for (let i171 = 0; i171 < v168; i171++) {
+					hidden169.$index = i171;
+					let v172 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr170.push(v172);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.quests = arr170;
+				break;
+			}
+			case 162: {
+				obj0.dummy_1 = true;
+				break;
+			}
+			case 163: {
+				let v173 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_A3 = v173;
+				break;
+			}
+			case 164: {
+				let obj174 = {};
+				let hidden175 = {};
+				state.stack.push(obj174);
+				state.hiddenstack.push(hidden175);
+				let v176 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v176 !== undefined) { obj174.unknown_1 = v176; }
+				let v177 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v177 !== undefined) { obj174.unknown_2 = v177; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_A4 = obj174;
+				break;
+			}
+			case 165: {
+				let v178 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_A5 = v178;
+				break;
+			}
+			case 168: {
+				let v179 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_A8 = v179;
+				break;
+			}
+			case 169: {
+				obj0.unknown_A9 = false;
+				break;
+			}
+			case 170: {
+				let v180 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_0 = v180;
+				break;
+			}
+			case 171: {
+				let v181 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_1 = v181;
+				break;
+			}
+			case 172: {
+				let v182 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_2 = v182;
+				break;
+			}
+			case 173: {
+				let v183 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_3 = v183;
+				break;
+			}
+			case 174: {
+				let v184 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_4 = v184;
+				break;
+			}
+			case 175: {
+				let v185 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.action_cursors_5 = v185;
+				break;
+			}
+			case 178: {
+				obj0.dummy_2 = true;
+				break;
+			}
+			case 179: {
+				let obj186 = {};
+				let hidden187 = {};
+				state.stack.push(obj186);
+				state.hiddenstack.push(hidden187);
+				let v188 = ext[10].read(state);
+				if (v188 !== undefined) { obj186.unknown_1 = v188; }
+				let v189 = ext[10].read(state);
+				if (v189 !== undefined) { obj186.unknown_2 = v189; }
+				let v190 = ext[10].read(state);
+				if (v190 !== undefined) { obj186.unknown_3 = v190; }
+				let v191 = ext[10].read(state);
+				if (v191 !== undefined) { obj186.unknown_4 = v191; }
+				let v192 = ext[10].read(state);
+				if (v192 !== undefined) { obj186.unknown_5 = v192; }
+				let v193 = ext[10].read(state);
+				if (v193 !== undefined) { obj186.unknown_6 = v193; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_B3 = obj186;
+				break;
+			}
+			case 180: {
+				let v194 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_B4 = v194;
+				break;
+			}
+			case 181: {
+				let obj195 = {};
+				let hidden196 = {};
+				state.stack.push(obj195);
+				state.hiddenstack.push(hidden196);
+				let v197 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v197 !== undefined) { obj195.unknown_1 = v197; }
+				let v198 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v198 !== undefined) { obj195.unknown_2 = v198; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_B5 = obj195;
+				break;
+			}
+			case 182: {
+				obj0.unknown_B6 = true;
+				break;
+			}
+			case 183: {
+				let v199 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_B7 = v199;
+				break;
+			}
+			case 184: {
+				let v200 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_B8 = v200;
+				break;
+			}
+			case 185: {
+				obj0.unknown_B9 = true;
+				break;
+			}
+			case 186: {
+				let obj201 = {};
+				let hidden202 = {};
+				state.stack.push(obj201);
+				state.hiddenstack.push(hidden202);
+				let v203 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v203 !== undefined) { obj201.unk0 = v203; }
+				let v204 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v204 !== undefined) { obj201.varbit = v204; }
+				let v205 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v205 !== undefined) { obj201.varp = v205; }
+				let v206 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v206 !== undefined) { hidden202.$flags = v206; }
+				let ref207 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match208 = -1;
+				if ((ref207 & 1) != 0) { match208 = 0; }
+				let v209 = null;
+				if (match208 != -1) {
+					let v210 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden211 = { $index: 0, $length: v210 };
+					state.hiddenstack.push(hidden211);
+					state.stack.push({});
+					let arr212 = [];
+					for (let i213 = 0; i213 < v210; i213++) {
+						hidden211.$index = i213;
+						let obj214 = {};
+						let hidden215 = {};
+						state.stack.push(obj214);
+						state.hiddenstack.push(hidden215);
+						let v216 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v216 !== undefined) { obj214.value = v216; }
+						let v217 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden218 = { $index: 0, $length: v217 };
+						state.hiddenstack.push(hidden218);
+						state.stack.push({});
+						let arr219 = [];
+						for (let i220 = 0; i220 < v217; i220++) {
+							hidden218.$index = i220;
+							let obj221 = {};
+							let hidden222 = {};
+							state.stack.push(obj221);
+							state.hiddenstack.push(hidden222);
+							let v223 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v223 !== undefined) { obj221.unk1 = v223; }
+							let v224 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v224 !== undefined) { obj221.unk2 = v224; }
+							let v225 = ext[2].read(state);
+							if (v225 !== undefined) { obj221.model = v225; }
+							let v226 = state.view.getUint8(state.scan);
+							state.scan += 1;
+							if (v226 !== undefined) { obj221.extracount = v226; }
+							let ref227 = state.stack[state.stack.length - 1].extracount;
+							let match228 = -1;
+							if (ref227 >= 1) { match228 = 0; }
+							let v229 = null;
+							if (match228 != -1) {
+								let v230 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v229 = v230;
+							}
+							if (v229 !== undefined) { obj221.extra1 = v229; }
+							let ref231 = state.stack[state.stack.length - 1].extracount;
+							let match232 = -1;
+							if (ref231 >= 2) { match232 = 0; }
+							let v233 = null;
+							if (match232 != -1) {
+								let v234 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v233 = v234;
+							}
+							if (v233 !== undefined) { obj221.extra2 = v233; }
+							let ref235 = state.stack[state.stack.length - 1].extracount;
+							let match236 = -1;
+							if (ref235 >= 3) { match236 = 0; }
+							let v237 = null;
+							if (match236 != -1) {
+								let v238 = state.view.getUint8(state.scan);
+								state.scan += 1;
+								v237 = v238;
+							}
+							if (v237 !== undefined) { obj221.extra3 = v237; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr219.push(obj221);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr219 !== undefined) { obj214.models = arr219; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr212.push(obj214);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v209 = arr212;
+				}
+				if (v209 !== undefined) { obj201.multimodel = v209; }
+				let ref239 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match240 = -1;
+				if ((ref239 & 2) != 0) { match240 = 0; }
+				let v241 = null;
+				if (match240 != -1) {
+					let v242 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden243 = { $index: 0, $length: v242 };
+					state.hiddenstack.push(hidden243);
+					state.stack.push({});
+					let arr244 = [];
+					for (let i245 = 0; i245 < v242; i245++) {
+						hidden243.$index = i245;
+						let obj246 = {};
+						let hidden247 = {};
+						state.stack.push(obj246);
+						state.hiddenstack.push(hidden247);
+						let v248 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v248 !== undefined) { obj246.value = v248; }
+						let v249 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden250 = { $index: 0, $length: v249 };
+						state.hiddenstack.push(hidden250);
+						state.stack.push({});
+						let arr251 = [];
+						for (let i252 = 0; i252 < v249; i252++) {
+							hidden250.$index = i252;
+							let obj253 = {};
+							let hidden254 = {};
+							state.stack.push(obj253);
+							state.hiddenstack.push(hidden254);
+							let v255 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v255 !== undefined) { obj253.unk1 = v255; }
+							let v256 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v256 !== undefined) { obj253.unk2 = v256; }
+							let v257 = ext[2].read(state);
+							if (v257 !== undefined) { obj253.model = v257; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr251.push(obj253);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr251 !== undefined) { obj246.models = arr251; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr244.push(obj246);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v241 = arr244;
+				}
+				if (v241 !== undefined) { obj201.multiheadmodel = v241; }
+				let ref258 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match259 = -1;
+				if ((ref258 & 4) != 0) { match259 = 0; }
+				let v260 = null;
+				if (match259 != -1) {
+					let v261 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden262 = { $index: 0, $length: v261 };
+					state.hiddenstack.push(hidden262);
+					state.stack.push({});
+					let arr263 = [];
+					for (let i264 = 0; i264 < v261; i264++) {
+						hidden262.$index = i264;
+						let obj265 = {};
+						let hidden266 = {};
+						state.stack.push(obj265);
+						state.hiddenstack.push(hidden266);
+						let v267 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v267 !== undefined) { obj265.value = v267; }
+						let v268 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden269 = { $index: 0, $length: v268 };
+						state.hiddenstack.push(hidden269);
+						state.stack.push({});
+						let arr270 = [];
+						for (let i271 = 0; i271 < v268; i271++) {
+							hidden269.$index = i271;
+							let obj272 = {};
+							let hidden273 = {};
+							state.stack.push(obj272);
+							state.hiddenstack.push(hidden273);
+							let v274 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v274 !== undefined) { obj272.unk1 = v274; }
+							let v275 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v275 !== undefined) { obj272.unk2 = v275; }
+							let v276 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v276 !== undefined) { obj272.unk3 = v276; }
+							let v277 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v277 !== undefined) { obj272.unk4 = v277; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr270.push(obj272);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr270 !== undefined) { obj265.entries = arr270; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr263.push(obj265);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v260 = arr263;
+				}
+				if (v260 !== undefined) { obj201.multiretex = v260; }
+				let ref278 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match279 = -1;
+				if ((ref278 & 8) != 0) { match279 = 0; }
+				let v280 = null;
+				if (match279 != -1) {
+					let v281 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden282 = { $index: 0, $length: v281 };
+					state.hiddenstack.push(hidden282);
+					state.stack.push({});
+					let arr283 = [];
+					for (let i284 = 0; i284 < v281; i284++) {
+						hidden282.$index = i284;
+						let obj285 = {};
+						let hidden286 = {};
+						state.stack.push(obj285);
+						state.hiddenstack.push(hidden286);
+						let v287 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v287 !== undefined) { obj285.value = v287; }
+						let v288 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden289 = { $index: 0, $length: v288 };
+						state.hiddenstack.push(hidden289);
+						state.stack.push({});
+						let arr290 = [];
+						for (let i291 = 0; i291 < v288; i291++) {
+							hidden289.$index = i291;
+							let obj292 = {};
+							let hidden293 = {};
+							state.stack.push(obj292);
+							state.hiddenstack.push(hidden293);
+							let v294 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v294 !== undefined) { obj292.unk1 = v294; }
+							let v295 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v295 !== undefined) { obj292.unk2 = v295; }
+							let v296 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v296 !== undefined) { obj292.unk3 = v296; }
+							let v297 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v297 !== undefined) { obj292.unk4 = v297; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr290.push(obj292);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr290 !== undefined) { obj285.entries = arr290; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr283.push(obj285);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v280 = arr283;
+				}
+				if (v280 !== undefined) { obj201.multirecol = v280; }
+				let ref298 = state.hiddenstack[state.hiddenstack.length - 1].$flags;
+				let match299 = -1;
+				if ((ref298 & 16) != 0) { match299 = 0; }
+				let v300 = null;
+				if (match299 != -1) {
+					let v301 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let hidden302 = { $index: 0, $length: v301 };
+					state.hiddenstack.push(hidden302);
+					state.stack.push({});
+					let arr303 = [];
+					for (let i304 = 0; i304 < v301; i304++) {
+						hidden302.$index = i304;
+						let obj305 = {};
+						let hidden306 = {};
+						state.stack.push(obj305);
+						state.hiddenstack.push(hidden306);
+						let v307 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						if (v307 !== undefined) { obj305.value = v307; }
+						let v308 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						let hidden309 = { $index: 0, $length: v308 };
+						state.hiddenstack.push(hidden309);
+						state.stack.push({});
+						let arr310 = [];
+						for (let i311 = 0; i311 < v308; i311++) {
+							hidden309.$index = i311;
+							let obj312 = {};
+							let hidden313 = {};
+							state.stack.push(obj312);
+							state.hiddenstack.push(hidden313);
+							let v314 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v314 !== undefined) { obj312.unk1 = v314; }
+							let v315 = state.view.getUint16(state.scan);
+							state.scan += 2;
+							if (v315 !== undefined) { obj312.unk2 = v315; }
+							let v316 = state.view.getUint32(state.scan);
+							state.scan += 4;
+							if (v316 !== undefined) { obj312.unk3 = v316; }
+							state.stack.pop();
+							state.hiddenstack.pop();
+							arr310.push(obj312);
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						if (arr310 !== undefined) { obj305.entries = arr310; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						arr303.push(obj305);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					v300 = arr303;
+				}
+				if (v300 !== undefined) { obj201.multiretint = v300; }
+				let v317 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v317 !== undefined) { obj201.default = v317; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unknown_BA = obj201;
+				break;
+			}
+			case 219: {
+				let v318 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_DB = v318;
+				break;
+			}
+			case 249: {
+				let v319 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden320 = { $index: 0, $length: v319 };
+				state.hiddenstack.push(hidden320);
+				state.stack.push({});
+				let arr321 = [];
+				for (let i322 = 0; i322 < v319; i322++) {
+					hidden320.$index = i322;
+					let obj323 = {};
+					let hidden324 = {};
+					state.stack.push(obj323);
+					state.hiddenstack.push(hidden324);
+					let v325 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v325 !== undefined) { hidden324.$type = v325; }
+					let v326 = ext[11].read(state);
+					if (v326 !== undefined) { obj323.prop = v326; }
+					let ref327 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match328 = -1;
+					if (ref327 == 0) { match328 = 0; }
+					let v329 = null;
+					if (match328 != -1) {
+						let v330 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v329 = v330;
+					}
+					if (v329 !== undefined) { obj323.intvalue = v329; }
+					let ref331 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match332 = -1;
+					if (ref331 == 1) { match332 = 0; }
+					let v333 = null;
+					if (match332 != -1) {
+						let v334 = ext[3].read(state);
+						v333 = v334;
+					}
+					if (v333 !== undefined) { obj323.stringvalue = v333; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr321.push(obj323);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr321;
+				break;
+			}
+			case 253: {
+				let v335 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_FD = v335;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key336 in value) {
+		if (key336.startsWith("$")) { continue; }
+		switch (key336) {
+			case "models": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w337 = value[key336];
+				if (!Array.isArray(w337)) { throw new Error("array expected"); }
+				let w338 = w337.length;
+				ext[0].write(state, w338);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w337.length });
+				for (let i339 = 0; i339 < w337.length; i339++) {
+					let w340 = w337[i339];
+					let hidden341 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden341);
+					hidden341.$opcode = ext[1].readConst(state);
+					let ref342 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match343 = -1;
+					if (ref342 >= 669) { match343 = 0; }
+					else if (ref342 >= 0) { match343 = 1; }
+					if (match343 == -1) { throw new Error("no opcode matched"); }
+					if (match343 == 0) {
+						ext[2].write(state, w340);
+					}
+					else if (match343 == 1) {
+						if (typeof w340 != "number" || w340 > 65535 || w340 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w340, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "name": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w344 = value[key336];
+				ext[3].write(state, w344);
+				break;
+			}
+			case "examine": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w345 = value[key336];
+				ext[3].write(state, w345);
+				break;
+			}
+			case "unknown_08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w346 = value[key336];
+				if (typeof w346 != "number" || w346 > 255 || w346 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w346, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0B": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w347 = value[key336];
+				if (typeof w347 != "number" || w347 > 255 || w347 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w347, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "boundSize": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w348 = value[key336];
+				if (typeof w348 != "number" || w348 > 255 || w348 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w348, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk_0D": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w349 = value[key336];
+				if (typeof w349 != "number" || w349 > 65535 || w349 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w349, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk_0E": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w350 = value[key336];
+				if (typeof w350 != "number" || w350 > 65535 || w350 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w350, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk_11": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w351 = value[key336];
+				if (!Array.isArray(w351)) { throw new Error("array expected"); }
+				let w352 = w351.length;
+				if (w352 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w351.length });
+				for (let i353 = 0; i353 < w351.length; i353++) {
+					let w354 = w351[i353];
+					if (typeof w354 != "number" || w354 > 65535 || w354 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w354, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk_1A": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w355 = value[key336];
+				if (typeof w355 != "number" || w355 > 65535 || w355 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w355, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk_1B": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w356 = value[key336];
+				if (typeof w356 != "number" || w356 > 65535 || w356 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w356, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "actions_0": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w357 = value[key336];
+				ext[3].write(state, w357);
+				break;
+			}
+			case "actions_1": {
+				if (typeof 31 != "number" || 31 > 255 || 31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(31, state.scan);
+				state.scan += 1;
+				let w358 = value[key336];
+				ext[3].write(state, w358);
+				break;
+			}
+			case "actions_2": {
+				if (typeof 32 != "number" || 32 > 255 || 32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(32, state.scan);
+				state.scan += 1;
+				let w359 = value[key336];
+				ext[3].write(state, w359);
+				break;
+			}
+			case "actions_3": {
+				if (typeof 33 != "number" || 33 > 255 || 33 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(33, state.scan);
+				state.scan += 1;
+				let w360 = value[key336];
+				ext[3].write(state, w360);
+				break;
+			}
+			case "actions_4": {
+				if (typeof 34 != "number" || 34 > 255 || 34 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(34, state.scan);
+				state.scan += 1;
+				let w361 = value[key336];
+				ext[3].write(state, w361);
+				break;
+			}
+			case "color_replacements": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w362 = value[key336];
+				if (!Array.isArray(w362)) { throw new Error("array expected"); }
+				let w363 = w362.length;
+				ext[0].write(state, w363);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w362.length });
+				for (let i364 = 0; i364 < w362.length; i364++) {
+					let w365 = w362[i364];
+					if (!Array.isArray(w365)) { throw new Error("array expected"); }
+					let w366 = w365[0];
+					if (typeof w366 != "number" || w366 > 65535 || w366 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w366, state.scan);
+					state.scan += 2;
+					let w367 = w365[1];
+					if (typeof w367 != "number" || w367 > 65535 || w367 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w367, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "material_replacements": {
+				if (typeof 41 != "number" || 41 > 255 || 41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(41, state.scan);
+				state.scan += 1;
+				let w368 = value[key336];
+				if (!Array.isArray(w368)) { throw new Error("array expected"); }
+				let w369 = w368.length;
+				ext[0].write(state, w369);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w368.length });
+				for (let i370 = 0; i370 < w368.length; i370++) {
+					let w371 = w368[i370];
+					if (!Array.isArray(w371)) { throw new Error("array expected"); }
+					let w372 = w371[0];
+					if (typeof w372 != "number" || w372 > 65535 || w372 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w372, state.scan);
+					state.scan += 2;
+					let w373 = w371[1];
+					if (typeof w373 != "number" || w373 > 65535 || w373 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w373, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "recolourPalette": {
+				if (typeof 42 != "number" || 42 > 255 || 42 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(42, state.scan);
+				state.scan += 1;
+				let w374 = value[key336];
+				if (!Array.isArray(w374)) { throw new Error("array expected"); }
+				let w375 = w374.length;
+				ext[0].write(state, w375);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w374.length });
+				for (let i376 = 0; i376 < w374.length; i376++) {
+					let w377 = w374[i376];
+					if (typeof w377 != "number" || w377 > 127 || w377 < -128) { throw new Error(); }
+					state.buffer.writeInt8(w377, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "recolor_indices": {
+				if (typeof 44 != "number" || 44 > 255 || 44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(44, state.scan);
+				state.scan += 1;
+				let w378 = value[key336];
+				if (typeof w378 != "number" || w378 > 65535 || w378 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w378, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "retexture_indices": {
+				if (typeof 45 != "number" || 45 > 255 || 45 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(45, state.scan);
+				state.scan += 1;
+				let w379 = value[key336];
+				if (typeof w379 != "number" || w379 > 65535 || w379 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w379, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "headModels": {
+				if (typeof 60 != "number" || 60 > 255 || 60 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(60, state.scan);
+				state.scan += 1;
+				let w380 = value[key336];
+				if (!Array.isArray(w380)) { throw new Error("array expected"); }
+				let w381 = w380.length;
+				ext[0].write(state, w381);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w380.length });
+				for (let i382 = 0; i382 < w380.length; i382++) {
+					let w383 = w380[i382];
+					let hidden384 = { $opcode: 0 };
+					state.stack.push({});
+					state.hiddenstack.push(hidden384);
+					hidden384.$opcode = ext[4].readConst(state);
+					let ref385 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+					let match386 = -1;
+					if (ref385 >= 669) { match386 = 0; }
+					else if (ref385 >= 0) { match386 = 1; }
+					if (match386 == -1) { throw new Error("no opcode matched"); }
+					if (match386 == 0) {
+						ext[2].write(state, w383);
+					}
+					else if (match386 == 1) {
+						if (typeof w383 != "number" || w383 > 65535 || w383 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w383, state.scan);
+						state.scan += 2;
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "drawMapDot": {
+				if (typeof 93 != "number" || 93 > 255 || 93 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(93, state.scan);
+				state.scan += 1;
+				let w387 = value[key336];
+				if (w387 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "combat": {
+				if (typeof 95 != "number" || 95 > 255 || 95 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(95, state.scan);
+				state.scan += 1;
+				let w388 = value[key336];
+				if (typeof w388 != "number" || w388 > 65535 || w388 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w388, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scaleXZ": {
+				if (typeof 97 != "number" || 97 > 255 || 97 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(97, state.scan);
+				state.scan += 1;
+				let w389 = value[key336];
+				if (typeof w389 != "number" || w389 > 65535 || w389 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w389, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scaleY": {
+				if (typeof 98 != "number" || 98 > 255 || 98 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(98, state.scan);
+				state.scan += 1;
+				let w390 = value[key336];
+				if (typeof w390 != "number" || w390 > 65535 || w390 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w390, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_63": {
+				if (typeof 99 != "number" || 99 > 255 || 99 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(99, state.scan);
+				state.scan += 1;
+				let w391 = value[key336];
+				if (w391 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "ambience": {
+				if (typeof 100 != "number" || 100 > 255 || 100 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(100, state.scan);
+				state.scan += 1;
+				let w392 = value[key336];
+				if (typeof w392 != "number" || w392 > 127 || w392 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w392, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "modelContract": {
+				if (typeof 101 != "number" || 101 > 255 || 101 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(101, state.scan);
+				state.scan += 1;
+				let w393 = value[key336];
+				if (typeof w393 != "number" || w393 > 127 || w393 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w393, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "head_icon_data": {
+				if (typeof 102 != "number" || 102 > 255 || 102 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(102, state.scan);
+				state.scan += 1;
+				let w394 = value[key336];
+				if (typeof w394 != "number" || w394 > 65535 || w394 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w394, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_67": {
+				if (typeof 103 != "number" || 103 > 255 || 103 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(103, state.scan);
+				state.scan += 1;
+				let w395 = value[key336];
+				if (typeof w395 != "number" || w395 > 65535 || w395 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w395, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "morphs_1": {
+				if (typeof 106 != "number" || 106 > 255 || 106 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(106, state.scan);
+				state.scan += 1;
+				let w396 = value[key336];
+				if (typeof w396 != "object" || !w396) { throw new Error("object expected"); }
+				let hidden397 = {};
+				state.stack.push(w396);
+				state.hiddenstack.push(hidden397);
+				let w398 = w396.varbit;
+				if (typeof w398 != "number" || w398 > 65535 || w398 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w398, state.scan);
+				state.scan += 2;
+				let w399 = w396.varp;
+				if (typeof w399 != "number" || w399 > 65535 || w399 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w399, state.scan);
+				state.scan += 2;
+				let w400 = w396.options;
+				if (!Array.isArray(w400)) { throw new Error("array expected"); }
+				let w401 = w400.length;
+				let hidden402 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden402);
+				hidden402.$opcode = ext[5].readConst(state);
+				let ref403 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match404 = -1;
+				if (ref403 >= 910) { match404 = 0; }
+				else if (ref403 >= 0) { match404 = 1; }
+				if (match404 == -1) { throw new Error("no opcode matched"); }
+				if (match404 == 0) {
+					ext[0].write(state, w401);
+				}
+				else if (match404 == 1) {
+					if (typeof w401 != "number" || w401 > 255 || w401 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w401, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w400.length });
+				for (let i405 = 0; i405 < w400.length; i405++) {
+					let w406 = w400[i405];
+					if (typeof w406 != "number" || w406 > 65535 || w406 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w406, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w407 = w396.default;
+				if (typeof w407 != "number" || w407 > 65535 || w407 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w407, state.scan);
+				state.scan += 2;
+				let w408 = w396.unk5;
+				let hidden409 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden409);
+				hidden409.$opcode = ext[6].readConst(state);
+				let ref410 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match411 = -1;
+				if (ref410 >= 525) { match411 = 0; }
+				else if (ref410 >= 0) { match411 = 1; }
+				if (match411 == -1) { throw new Error("no opcode matched"); }
+				if (match411 == 0) {
+					if (typeof w408 != "number" || w408 > 65535 || w408 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w408, state.scan);
+					state.scan += 2;
+				}
+				else if (match411 == 1) {
+					if (w408 != null) { throw new Error("expected constant null was not present during write"); }
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_6B": {
+				if (typeof 107 != "number" || 107 > 255 || 107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(107, state.scan);
+				state.scan += 1;
+				let w412 = value[key336];
+				if (w412 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "slowWalk": {
+				if (typeof 109 != "number" || 109 > 255 || 109 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(109, state.scan);
+				state.scan += 1;
+				let w413 = value[key336];
+				if (w413 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "animateIdle": {
+				if (typeof 111 != "number" || 111 > 255 || 111 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(111, state.scan);
+				state.scan += 1;
+				let w414 = value[key336];
+				if (w414 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "shadow": {
+				if (typeof 113 != "number" || 113 > 255 || 113 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(113, state.scan);
+				state.scan += 1;
+				let w415 = value[key336];
+				if (typeof w415 != "object" || !w415) { throw new Error("object expected"); }
+				let hidden416 = {};
+				state.stack.push(w415);
+				state.hiddenstack.push(hidden416);
+				let w417 = w415.SrcColor;
+				if (typeof w417 != "number" || w417 > 65535 || w417 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w417, state.scan);
+				state.scan += 2;
+				let w418 = w415.DstColor;
+				if (typeof w418 != "number" || w418 > 65535 || w418 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w418, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "shadowAlphaIntensity": {
+				if (typeof 114 != "number" || 114 > 255 || 114 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(114, state.scan);
+				state.scan += 1;
+				let w419 = value[key336];
+				if (typeof w419 != "object" || !w419) { throw new Error("object expected"); }
+				let hidden420 = {};
+				state.stack.push(w419);
+				state.hiddenstack.push(hidden420);
+				let w421 = w419.Src;
+				if (typeof w421 != "number" || w421 > 127 || w421 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w421, state.scan);
+				state.scan += 1;
+				let w422 = w419.Dst;
+				if (typeof w422 != "number" || w422 > 127 || w422 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w422, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_73": {
+				if (typeof 115 != "number" || 115 > 255 || 115 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(115, state.scan);
+				state.scan += 1;
+				let w423 = value[key336];
+				if (!Array.isArray(w423)) { throw new Error("array expected"); }
+				let w424 = w423[0];
+				if (typeof w424 != "number" || w424 > 255 || w424 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w424, state.scan);
+				state.scan += 1;
+				let w425 = w423[1];
+				if (typeof w425 != "number" || w425 > 255 || w425 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w425, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "morphs_2": {
+				if (typeof 118 != "number" || 118 > 255 || 118 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(118, state.scan);
+				state.scan += 1;
+				let w426 = value[key336];
+				if (typeof w426 != "object" || !w426) { throw new Error("object expected"); }
+				let hidden427 = {};
+				state.stack.push(w426);
+				state.hiddenstack.push(hidden427);
+				let w428 = w426.varbit;
+				if (typeof w428 != "number" || w428 > 65535 || w428 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w428, state.scan);
+				state.scan += 2;
+				let w429 = w426.varp;
+				if (typeof w429 != "number" || w429 > 65535 || w429 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w429, state.scan);
+				state.scan += 2;
+				let w430 = w426.unk2;
+				if (typeof w430 != "number" || w430 > 65535 || w430 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w430, state.scan);
+				state.scan += 2;
+				let w431 = w426.options;
+				if (!Array.isArray(w431)) { throw new Error("array expected"); }
+				let w432 = w431.length;
+				let hidden433 = { $opcode: 0 };
+				state.stack.push({});
+				state.hiddenstack.push(hidden433);
+				hidden433.$opcode = ext[7].readConst(state);
+				let ref434 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+				let match435 = -1;
+				if (ref434 >= 910) { match435 = 0; }
+				else if (ref434 >= 0) { match435 = 1; }
+				if (match435 == -1) { throw new Error("no opcode matched"); }
+				if (match435 == 0) {
+					ext[0].write(state, w432);
+				}
+				else if (match435 == 1) {
+					if (typeof w432 != "number" || w432 > 255 || w432 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w432, state.scan);
+					state.scan += 1;
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w431.length });
+				for (let i436 = 0; i436 < w431.length; i436++) {
+					let w437 = w431[i436];
+					if (typeof w437 != "number" || w437 > 65535 || w437 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w437, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w438 = w426.default;
+				if (typeof w438 != "number" || w438 > 65535 || w438 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w438, state.scan);
+				state.scan += 2;
+				let w439 = w426.unk5;
+				if (typeof w439 != "number" || w439 > 65535 || w439 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w439, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "movementCapabilities": {
+				if (typeof 119 != "number" || 119 > 255 || 119 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(119, state.scan);
+				state.scan += 1;
+				let w440 = value[key336];
+				if (typeof w440 != "number" || w440 > 127 || w440 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w440, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_78": {
+				if (typeof 120 != "number" || 120 > 255 || 120 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(120, state.scan);
+				state.scan += 1;
+				let w441 = value[key336];
+				if (!Array.isArray(w441)) { throw new Error("array expected"); }
+				let w442 = w441[0];
+				if (typeof w442 != "number" || w442 > 65535 || w442 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w442, state.scan);
+				state.scan += 2;
+				let w443 = w441[1];
+				if (typeof w443 != "number" || w443 > 65535 || w443 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w443, state.scan);
+				state.scan += 2;
+				let w444 = w441[2];
+				if (typeof w444 != "number" || w444 > 65535 || w444 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w444, state.scan);
+				state.scan += 2;
+				let w445 = w441[3];
+				if (typeof w445 != "number" || w445 > 255 || w445 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w445, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "translations": {
+				if (typeof 121 != "number" || 121 > 255 || 121 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(121, state.scan);
+				state.scan += 1;
+				let w446 = value[key336];
+				if (!Array.isArray(w446)) { throw new Error("array expected"); }
+				let w447 = w446.length;
+				ext[0].write(state, w447);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w446.length });
+				for (let i448 = 0; i448 < w446.length; i448++) {
+					let w449 = w446[i448];
+					ext[8].write(state, w449);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk_7A": {
+				if (typeof 122 != "number" || 122 > 255 || 122 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(122, state.scan);
+				state.scan += 1;
+				let w450 = value[key336];
+				if (typeof w450 != "number" || w450 > 65535 || w450 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w450, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "iconHeight": {
+				if (typeof 123 != "number" || 123 > 255 || 123 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(123, state.scan);
+				state.scan += 1;
+				let w451 = value[key336];
+				if (typeof w451 != "number" || w451 > 65535 || w451 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w451, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "respawnDirection": {
+				if (typeof 125 != "number" || 125 > 255 || 125 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(125, state.scan);
+				state.scan += 1;
+				let w452 = value[key336];
+				if (typeof w452 != "number" || w452 > 127 || w452 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w452, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "animation_group": {
+				if (typeof 127 != "number" || 127 > 255 || 127 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(127, state.scan);
+				state.scan += 1;
+				let w453 = value[key336];
+				if (typeof w453 != "number" || w453 > 65535 || w453 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w453, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "movementType": {
+				if (typeof 128 != "number" || 128 > 255 || 128 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(128, state.scan);
+				state.scan += 1;
+				let w454 = value[key336];
+				if (typeof w454 != "number" || w454 > 127 || w454 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w454, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "ambient_sound": {
+				if (typeof 134 != "number" || 134 > 255 || 134 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(134, state.scan);
+				state.scan += 1;
+				let w455 = value[key336];
+				if (typeof w455 != "object" || !w455) { throw new Error("object expected"); }
+				let hidden456 = {};
+				state.stack.push(w455);
+				state.hiddenstack.push(hidden456);
+				let w457 = w455.unk1;
+				if (typeof w457 != "number" || w457 > 65535 || w457 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w457, state.scan);
+				state.scan += 2;
+				let w458 = w455.unk2;
+				if (typeof w458 != "number" || w458 > 65535 || w458 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w458, state.scan);
+				state.scan += 2;
+				let w459 = w455.unk3;
+				if (typeof w459 != "number" || w459 > 65535 || w459 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w459, state.scan);
+				state.scan += 2;
+				let w460 = w455.unk4;
+				if (typeof w460 != "number" || w460 > 65535 || w460 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w460, state.scan);
+				state.scan += 2;
+				let w461 = w455.unk45;
+				if (typeof w461 != "number" || w461 > 255 || w461 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w461, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "oldCursor": {
+				if (typeof 135 != "number" || 135 > 255 || 135 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(135, state.scan);
+				state.scan += 1;
+				let w462 = value[key336];
+				if (typeof w462 != "object" || !w462) { throw new Error("object expected"); }
+				let hidden463 = {};
+				state.stack.push(w462);
+				state.hiddenstack.push(hidden463);
+				let w464 = w462.Op;
+				if (typeof w464 != "number" || w464 > 255 || w464 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w464, state.scan);
+				state.scan += 1;
+				let w465 = w462.Cursor;
+				if (typeof w465 != "number" || w465 > 65535 || w465 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w465, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "oldCursor2": {
+				if (typeof 136 != "number" || 136 > 255 || 136 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(136, state.scan);
+				state.scan += 1;
+				let w466 = value[key336];
+				if (typeof w466 != "object" || !w466) { throw new Error("object expected"); }
+				let hidden467 = {};
+				state.stack.push(w466);
+				state.hiddenstack.push(hidden467);
+				let w468 = w466.Op;
+				if (typeof w468 != "number" || w468 > 255 || w468 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w468, state.scan);
+				state.scan += 1;
+				let w469 = w466.Cursor;
+				if (typeof w469 != "number" || w469 > 65535 || w469 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w469, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "attackCursor": {
+				if (typeof 137 != "number" || 137 > 255 || 137 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(137, state.scan);
+				state.scan += 1;
+				let w470 = value[key336];
+				if (typeof w470 != "number" || w470 > 65535 || w470 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w470, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "armyIcon": {
+				if (typeof 138 != "number" || 138 > 255 || 138 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(138, state.scan);
+				state.scan += 1;
+				let w471 = value[key336];
+				ext[9].write(state, w471);
+				break;
+			}
+			case "unknown_8C": {
+				if (typeof 140 != "number" || 140 > 255 || 140 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(140, state.scan);
+				state.scan += 1;
+				let w472 = value[key336];
+				if (typeof w472 != "number" || w472 > 255 || w472 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w472, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_8D": {
+				if (typeof 141 != "number" || 141 > 255 || 141 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(141, state.scan);
+				state.scan += 1;
+				let w473 = value[key336];
+				if (w473 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "mapFunction": {
+				if (typeof 142 != "number" || 142 > 255 || 142 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(142, state.scan);
+				state.scan += 1;
+				let w474 = value[key336];
+				if (typeof w474 != "number" || w474 > 65535 || w474 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w474, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_8F": {
+				if (typeof 143 != "number" || 143 > 255 || 143 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(143, state.scan);
+				state.scan += 1;
+				let w475 = value[key336];
+				if (w475 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "members_actions_0": {
+				if (typeof 150 != "number" || 150 > 255 || 150 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(150, state.scan);
+				state.scan += 1;
+				let w476 = value[key336];
+				ext[3].write(state, w476);
+				break;
+			}
+			case "members_actions_1": {
+				if (typeof 151 != "number" || 151 > 255 || 151 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(151, state.scan);
+				state.scan += 1;
+				let w477 = value[key336];
+				ext[3].write(state, w477);
+				break;
+			}
+			case "members_actions_2": {
+				if (typeof 152 != "number" || 152 > 255 || 152 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(152, state.scan);
+				state.scan += 1;
+				let w478 = value[key336];
+				ext[3].write(state, w478);
+				break;
+			}
+			case "members_actions_3": {
+				if (typeof 153 != "number" || 153 > 255 || 153 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(153, state.scan);
+				state.scan += 1;
+				let w479 = value[key336];
+				ext[3].write(state, w479);
+				break;
+			}
+			case "members_actions_4": {
+				if (typeof 154 != "number" || 154 > 255 || 154 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(154, state.scan);
+				state.scan += 1;
+				let w480 = value[key336];
+				ext[3].write(state, w480);
+				break;
+			}
+			case "unknown_9B": {
+				if (typeof 155 != "number" || 155 > 255 || 155 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(155, state.scan);
+				state.scan += 1;
+				let w481 = value[key336];
+				if (typeof w481 != "object" || !w481) { throw new Error("object expected"); }
+				let hidden482 = {};
+				state.stack.push(w481);
+				state.hiddenstack.push(hidden482);
+				let w483 = w481.unknown_1;
+				if (typeof w483 != "number" || w483 > 127 || w483 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w483, state.scan);
+				state.scan += 1;
+				let w484 = w481.unknown_2;
+				if (typeof w484 != "number" || w484 > 127 || w484 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w484, state.scan);
+				state.scan += 1;
+				let w485 = w481.unknown_3;
+				if (typeof w485 != "number" || w485 > 127 || w485 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w485, state.scan);
+				state.scan += 1;
+				let w486 = w481.unknown_4;
+				if (typeof w486 != "number" || w486 > 127 || w486 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w486, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "aByte3076_set_1": {
+				if (typeof 158 != "number" || 158 > 255 || 158 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(158, state.scan);
+				state.scan += 1;
+				let w487 = value[key336];
+				if (w487 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "aByte3076_set_0": {
+				if (typeof 159 != "number" || 159 > 255 || 159 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(159, state.scan);
+				state.scan += 1;
+				let w488 = value[key336];
+				if (w488 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "quests": {
+				if (typeof 160 != "number" || 160 > 255 || 160 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(160, state.scan);
+				state.scan += 1;
+				let w489 = value[key336];
+				if (!Array.isArray(w489)) { throw new Error("array expected"); }
+				let w490 = w489.length;
+				ext[0].write(state, w490);
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w489.length });
+				for (let i491 = 0; i491 < w489.length; i491++) {
+					let w492 = w489[i491];
+					if (typeof w492 != "number" || w492 > 65535 || w492 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w492, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "dummy_1": {
+				if (typeof 162 != "number" || 162 > 255 || 162 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(162, state.scan);
+				state.scan += 1;
+				let w493 = value[key336];
+				if (w493 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_A3": {
+				if (typeof 163 != "number" || 163 > 255 || 163 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(163, state.scan);
+				state.scan += 1;
+				let w494 = value[key336];
+				if (typeof w494 != "number" || w494 > 255 || w494 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w494, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_A4": {
+				if (typeof 164 != "number" || 164 > 255 || 164 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(164, state.scan);
+				state.scan += 1;
+				let w495 = value[key336];
+				if (typeof w495 != "object" || !w495) { throw new Error("object expected"); }
+				let hidden496 = {};
+				state.stack.push(w495);
+				state.hiddenstack.push(hidden496);
+				let w497 = w495.unknown_1;
+				if (typeof w497 != "number" || w497 > 65535 || w497 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w497, state.scan);
+				state.scan += 2;
+				let w498 = w495.unknown_2;
+				if (typeof w498 != "number" || w498 > 65535 || w498 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w498, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_A5": {
+				if (typeof 165 != "number" || 165 > 255 || 165 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(165, state.scan);
+				state.scan += 1;
+				let w499 = value[key336];
+				if (typeof w499 != "number" || w499 > 255 || w499 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w499, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_A8": {
+				if (typeof 168 != "number" || 168 > 255 || 168 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(168, state.scan);
+				state.scan += 1;
+				let w500 = value[key336];
+				if (typeof w500 != "number" || w500 > 255 || w500 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w500, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_A9": {
+				if (typeof 169 != "number" || 169 > 255 || 169 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(169, state.scan);
+				state.scan += 1;
+				let w501 = value[key336];
+				if (w501 != false) { throw new Error("expected constant false was not present during write"); }
+				break;
+			}
+			case "action_cursors_0": {
+				if (typeof 170 != "number" || 170 > 255 || 170 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(170, state.scan);
+				state.scan += 1;
+				let w502 = value[key336];
+				if (typeof w502 != "number" || w502 > 65535 || w502 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w502, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_1": {
+				if (typeof 171 != "number" || 171 > 255 || 171 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(171, state.scan);
+				state.scan += 1;
+				let w503 = value[key336];
+				if (typeof w503 != "number" || w503 > 65535 || w503 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w503, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_2": {
+				if (typeof 172 != "number" || 172 > 255 || 172 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(172, state.scan);
+				state.scan += 1;
+				let w504 = value[key336];
+				if (typeof w504 != "number" || w504 > 65535 || w504 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w504, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_3": {
+				if (typeof 173 != "number" || 173 > 255 || 173 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(173, state.scan);
+				state.scan += 1;
+				let w505 = value[key336];
+				if (typeof w505 != "number" || w505 > 65535 || w505 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w505, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_4": {
+				if (typeof 174 != "number" || 174 > 255 || 174 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(174, state.scan);
+				state.scan += 1;
+				let w506 = value[key336];
+				if (typeof w506 != "number" || w506 > 65535 || w506 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w506, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "action_cursors_5": {
+				if (typeof 175 != "number" || 175 > 255 || 175 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(175, state.scan);
+				state.scan += 1;
+				let w507 = value[key336];
+				if (typeof w507 != "number" || w507 > 65535 || w507 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w507, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "dummy_2": {
+				if (typeof 178 != "number" || 178 > 255 || 178 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(178, state.scan);
+				state.scan += 1;
+				let w508 = value[key336];
+				if (w508 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_B3": {
+				if (typeof 179 != "number" || 179 > 255 || 179 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(179, state.scan);
+				state.scan += 1;
+				let w509 = value[key336];
+				if (typeof w509 != "object" || !w509) { throw new Error("object expected"); }
+				let hidden510 = {};
+				state.stack.push(w509);
+				state.hiddenstack.push(hidden510);
+				let w511 = w509.unknown_1;
+				ext[10].write(state, w511);
+				let w512 = w509.unknown_2;
+				ext[10].write(state, w512);
+				let w513 = w509.unknown_3;
+				ext[10].write(state, w513);
+				let w514 = w509.unknown_4;
+				ext[10].write(state, w514);
+				let w515 = w509.unknown_5;
+				ext[10].write(state, w515);
+				let w516 = w509.unknown_6;
+				ext[10].write(state, w516);
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_B4": {
+				if (typeof 180 != "number" || 180 > 255 || 180 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(180, state.scan);
+				state.scan += 1;
+				let w517 = value[key336];
+				if (typeof w517 != "number" || w517 > 255 || w517 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w517, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_B5": {
+				if (typeof 181 != "number" || 181 > 255 || 181 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(181, state.scan);
+				state.scan += 1;
+				let w518 = value[key336];
+				if (typeof w518 != "object" || !w518) { throw new Error("object expected"); }
+				let hidden519 = {};
+				state.stack.push(w518);
+				state.hiddenstack.push(hidden519);
+				let w520 = w518.unknown_1;
+				if (typeof w520 != "number" || w520 > 65535 || w520 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w520, state.scan);
+				state.scan += 2;
+				let w521 = w518.unknown_2;
+				if (typeof w521 != "number" || w521 > 255 || w521 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w521, state.scan);
+				state.scan += 1;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_B6": {
+				if (typeof 182 != "number" || 182 > 255 || 182 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(182, state.scan);
+				state.scan += 1;
+				let w522 = value[key336];
+				if (w522 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_B7": {
+				if (typeof 183 != "number" || 183 > 255 || 183 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(183, state.scan);
+				state.scan += 1;
+				let w523 = value[key336];
+				if (typeof w523 != "number" || w523 > 255 || w523 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w523, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_B8": {
+				if (typeof 184 != "number" || 184 > 255 || 184 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(184, state.scan);
+				state.scan += 1;
+				let w524 = value[key336];
+				if (typeof w524 != "number" || w524 > 255 || w524 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w524, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_B9": {
+				if (typeof 185 != "number" || 185 > 255 || 185 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(185, state.scan);
+				state.scan += 1;
+				let w525 = value[key336];
+				if (w525 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_BA": {
+				if (typeof 186 != "number" || 186 > 255 || 186 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(186, state.scan);
+				state.scan += 1;
+				let w526 = value[key336];
+				if (typeof w526 != "object" || !w526) { throw new Error("object expected"); }
+				let hidden527 = {};
+				state.stack.push(w526);
+				state.hiddenstack.push(hidden527);
+				let w528 = w526.unk0;
+				if (typeof w528 != "number" || w528 > 65535 || w528 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w528, state.scan);
+				state.scan += 2;
+				let w529 = w526.varbit;
+				if (typeof w529 != "number" || w529 > 65535 || w529 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w529, state.scan);
+				state.scan += 2;
+				let w530 = w526.varp;
+				if (typeof w530 != "number" || w530 > 65535 || w530 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w530, state.scan);
+				state.scan += 2;
+				let w531 = w526.$flags;
+				w531 ??= 0;
+				w531 = ext[12].resolve(w526, w531);
+				w531 = ext[13].resolve(w526, w531);
+				w531 = ext[14].resolve(w526, w531);
+				w531 = ext[15].resolve(w526, w531);
+				w531 = ext[16].resolve(w526, w531);
+				hidden527.$flags = w531;
+				if (typeof w531 != "number" || w531 > 255 || w531 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w531, state.scan);
+				state.scan += 1;
+				let w532 = w526.multimodel;
+				if (w532 != null) {
+					if (!Array.isArray(w532)) { throw new Error("array expected"); }
+					let w533 = w532.length;
+					if (typeof w533 != "number" || w533 > 255 || w533 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w533, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w532.length });
+					for (let i534 = 0; i534 < w532.length; i534++) {
+						let w535 = w532[i534];
+						if (typeof w535 != "object" || !w535) { throw new Error("object expected"); }
+						let hidden536 = {};
+						state.stack.push(w535);
+						state.hiddenstack.push(hidden536);
+						let w537 = w535.value;
+						if (typeof w537 != "number" || w537 > 255 || w537 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w537, state.scan);
+						state.scan += 1;
+						let w538 = w535.models;
+						if (!Array.isArray(w538)) { throw new Error("array expected"); }
+						let w539 = w538.length;
+						if (typeof w539 != "number" || w539 > 255 || w539 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w539, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w538.length });
+						for (let i540 = 0; i540 < w538.length; i540++) {
+							let w541 = w538[i540];
+							if (typeof w541 != "object" || !w541) { throw new Error("object expected"); }
+							let hidden542 = {};
+							state.stack.push(w541);
+							state.hiddenstack.push(hidden542);
+							let w543 = w541.unk1;
+							if (typeof w543 != "number" || w543 > 65535 || w543 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w543, state.scan);
+							state.scan += 2;
+							let w544 = w541.unk2;
+							if (typeof w544 != "number" || w544 > 65535 || w544 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w544, state.scan);
+							state.scan += 2;
+							let w545 = w541.model;
+							ext[2].write(state, w545);
+							let w546 = w541.extracount;
+							if (typeof w546 != "number" || w546 > 255 || w546 < 0) { throw new Error(); }
+							state.buffer.writeUInt8(w546, state.scan);
+							state.scan += 1;
+							let w547 = w541.extra1;
+							if (w547 != null) {
+								if (typeof w547 != "number" || w547 > 255 || w547 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w547, state.scan);
+								state.scan += 1;
+							}
+							let w548 = w541.extra2;
+							if (w548 != null) {
+								if (typeof w548 != "number" || w548 > 255 || w548 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w548, state.scan);
+								state.scan += 1;
+							}
+							let w549 = w541.extra3;
+							if (w549 != null) {
+								if (typeof w549 != "number" || w549 > 255 || w549 < 0) { throw new Error(); }
+								state.buffer.writeUInt8(w549, state.scan);
+								state.scan += 1;
+							}
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w550 = w526.multiheadmodel;
+				if (w550 != null) {
+					if (!Array.isArray(w550)) { throw new Error("array expected"); }
+					let w551 = w550.length;
+					if (typeof w551 != "number" || w551 > 255 || w551 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w551, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w550.length });
+					for (let i552 = 0; i552 < w550.length; i552++) {
+						let w553 = w550[i552];
+						if (typeof w553 != "object" || !w553) { throw new Error("object expected"); }
+						let hidden554 = {};
+						state.stack.push(w553);
+						state.hiddenstack.push(hidden554);
+						let w555 = w553.value;
+						if (typeof w555 != "number" || w555 > 255 || w555 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w555, state.scan);
+						state.scan += 1;
+						let w556 = w553.models;
+						if (!Array.isArray(w556)) { throw new Error("array expected"); }
+						let w557 = w556.length;
+						if (typeof w557 != "number" || w557 > 255 || w557 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w557, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w556.length });
+						for (let i558 = 0; i558 < w556.length; i558++) {
+							let w559 = w556[i558];
+							if (typeof w559 != "object" || !w559) { throw new Error("object expected"); }
+							let hidden560 = {};
+							state.stack.push(w559);
+							state.hiddenstack.push(hidden560);
+							let w561 = w559.unk1;
+							if (typeof w561 != "number" || w561 > 65535 || w561 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w561, state.scan);
+							state.scan += 2;
+							let w562 = w559.unk2;
+							if (typeof w562 != "number" || w562 > 65535 || w562 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w562, state.scan);
+							state.scan += 2;
+							let w563 = w559.model;
+							ext[2].write(state, w563);
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w564 = w526.multiretex;
+				if (w564 != null) {
+					if (!Array.isArray(w564)) { throw new Error("array expected"); }
+					let w565 = w564.length;
+					if (typeof w565 != "number" || w565 > 255 || w565 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w565, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w564.length });
+					for (let i566 = 0; i566 < w564.length; i566++) {
+						let w567 = w564[i566];
+						if (typeof w567 != "object" || !w567) { throw new Error("object expected"); }
+						let hidden568 = {};
+						state.stack.push(w567);
+						state.hiddenstack.push(hidden568);
+						let w569 = w567.value;
+						if (typeof w569 != "number" || w569 > 255 || w569 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w569, state.scan);
+						state.scan += 1;
+						let w570 = w567.entries;
+						if (!Array.isArray(w570)) { throw new Error("array expected"); }
+						let w571 = w570.length;
+						if (typeof w571 != "number" || w571 > 255 || w571 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w571, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w570.length });
+						for (let i572 = 0; i572 < w570.length; i572++) {
+							let w573 = w570[i572];
+							if (typeof w573 != "object" || !w573) { throw new Error("object expected"); }
+							let hidden574 = {};
+							state.stack.push(w573);
+							state.hiddenstack.push(hidden574);
+							let w575 = w573.unk1;
+							if (typeof w575 != "number" || w575 > 65535 || w575 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w575, state.scan);
+							state.scan += 2;
+							let w576 = w573.unk2;
+							if (typeof w576 != "number" || w576 > 65535 || w576 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w576, state.scan);
+							state.scan += 2;
+							let w577 = w573.unk3;
+							if (typeof w577 != "number" || w577 > 65535 || w577 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w577, state.scan);
+							state.scan += 2;
+							let w578 = w573.unk4;
+							if (typeof w578 != "number" || w578 > 65535 || w578 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w578, state.scan);
+							state.scan += 2;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w579 = w526.multirecol;
+				if (w579 != null) {
+					if (!Array.isArray(w579)) { throw new Error("array expected"); }
+					let w580 = w579.length;
+					if (typeof w580 != "number" || w580 > 255 || w580 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w580, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w579.length });
+					for (let i581 = 0; i581 < w579.length; i581++) {
+						let w582 = w579[i581];
+						if (typeof w582 != "object" || !w582) { throw new Error("object expected"); }
+						let hidden583 = {};
+						state.stack.push(w582);
+						state.hiddenstack.push(hidden583);
+						let w584 = w582.value;
+						if (typeof w584 != "number" || w584 > 255 || w584 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w584, state.scan);
+						state.scan += 1;
+						let w585 = w582.entries;
+						if (!Array.isArray(w585)) { throw new Error("array expected"); }
+						let w586 = w585.length;
+						if (typeof w586 != "number" || w586 > 255 || w586 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w586, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w585.length });
+						for (let i587 = 0; i587 < w585.length; i587++) {
+							let w588 = w585[i587];
+							if (typeof w588 != "object" || !w588) { throw new Error("object expected"); }
+							let hidden589 = {};
+							state.stack.push(w588);
+							state.hiddenstack.push(hidden589);
+							let w590 = w588.unk1;
+							if (typeof w590 != "number" || w590 > 65535 || w590 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w590, state.scan);
+							state.scan += 2;
+							let w591 = w588.unk2;
+							if (typeof w591 != "number" || w591 > 65535 || w591 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w591, state.scan);
+							state.scan += 2;
+							let w592 = w588.unk3;
+							if (typeof w592 != "number" || w592 > 65535 || w592 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w592, state.scan);
+							state.scan += 2;
+							let w593 = w588.unk4;
+							if (typeof w593 != "number" || w593 > 65535 || w593 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w593, state.scan);
+							state.scan += 2;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w594 = w526.multiretint;
+				if (w594 != null) {
+					if (!Array.isArray(w594)) { throw new Error("array expected"); }
+					let w595 = w594.length;
+					if (typeof w595 != "number" || w595 > 255 || w595 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w595, state.scan);
+					state.scan += 1;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w594.length });
+					for (let i596 = 0; i596 < w594.length; i596++) {
+						let w597 = w594[i596];
+						if (typeof w597 != "object" || !w597) { throw new Error("object expected"); }
+						let hidden598 = {};
+						state.stack.push(w597);
+						state.hiddenstack.push(hidden598);
+						let w599 = w597.value;
+						if (typeof w599 != "number" || w599 > 255 || w599 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w599, state.scan);
+						state.scan += 1;
+						let w600 = w597.entries;
+						if (!Array.isArray(w600)) { throw new Error("array expected"); }
+						let w601 = w600.length;
+						if (typeof w601 != "number" || w601 > 255 || w601 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w601, state.scan);
+						state.scan += 1;
+						state.stack.push({});
+						state.hiddenstack.push({ $index: 0, $length: w600.length });
+						for (let i602 = 0; i602 < w600.length; i602++) {
+							let w603 = w600[i602];
+							if (typeof w603 != "object" || !w603) { throw new Error("object expected"); }
+							let hidden604 = {};
+							state.stack.push(w603);
+							state.hiddenstack.push(hidden604);
+							let w605 = w603.unk1;
+							if (typeof w605 != "number" || w605 > 65535 || w605 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w605, state.scan);
+							state.scan += 2;
+							let w606 = w603.unk2;
+							if (typeof w606 != "number" || w606 > 65535 || w606 < 0) { throw new Error(); }
+							state.buffer.writeUInt16BE(w606, state.scan);
+							state.scan += 2;
+							let w607 = w603.unk3;
+							if (typeof w607 != "number" || w607 > 4294967295 || w607 < 0) { throw new Error(); }
+							state.buffer.writeUInt32BE(w607, state.scan);
+							state.scan += 4;
+							state.stack.pop();
+							state.hiddenstack.pop();
+						}
+						state.hiddenstack.pop();
+						state.stack.pop();
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+				}
+				let w608 = w526.default;
+				if (typeof w608 != "number" || w608 > 65535 || w608 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w608, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unknown_DB": {
+				if (typeof 219 != "number" || 219 > 255 || 219 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(219, state.scan);
+				state.scan += 1;
+				let w609 = value[key336];
+				if (typeof w609 != "number" || w609 > 255 || w609 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w609, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w610 = value[key336];
+				if (!Array.isArray(w610)) { throw new Error("array expected"); }
+				let w611 = w610.length;
+				if (typeof w611 != "number" || w611 > 255 || w611 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w611, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w610.length });
+				for (let i612 = 0; i612 < w610.length; i612++) {
+					let w613 = w610[i612];
+					if (typeof w613 != "object" || !w613) { throw new Error("object expected"); }
+					let hidden614 = {};
+					state.stack.push(w613);
+					state.hiddenstack.push(hidden614);
+					let w615 = w613.$type;
+					w615 ??= 0;
+					w615 = ext[17].resolve(w613, w615);
+					w615 = ext[18].resolve(w613, w615);
+					hidden614.$type = w615;
+					if (typeof w615 != "number" || w615 > 255 || w615 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w615, state.scan);
+					state.scan += 1;
+					let w616 = w613.prop;
+					ext[11].write(state, w616);
+					let w617 = w613.intvalue;
+					if (w617 != null) {
+						if (typeof w617 != "number" || w617 > 2147483647 || w617 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w617, state.scan);
+						state.scan += 4;
+					}
+					let w618 = w613.stringvalue;
+					if (w618 != null) {
+						ext[3].write(state, w618);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_FD": {
+				if (typeof 253 != "number" || 253 > 255 || 253 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(253, state.scan);
+				state.scan += 1;
+				let w619 = value[key336];
+				if (typeof w619 != "number" || w619 > 255 || w619 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w619, state.scan);
+				state.scan += 1;
+				break;
+			}
+			default: throw new Error("unknown property " + key336);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,34 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\oldmaterials.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xe3259050;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	if (0 !== undefined) { hidden1.$idcount = 0; }
+	let v2 = ext[0].read(state);
+	if (v2 !== undefined) { obj0.mats = v2; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden3 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden3);
+	let w4 = value.$idcount;
+	w4 = ext[1].readConst(state);
+	hidden3.$idcount = w4;
+	if (w4 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	let w5 = value.mats;
+	ext[0].write(state, w5);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,1616 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\oldmodels.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x352315f5;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 >= 764) { match5 = 0; }
+	else if (ref4 >= 0) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		v6 = 65535;
+	}
+	else if (match5 == 1) {
+		let v7 = ext[1].read(state);
+		v6 = v7;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.footbytes = v6; }
+	let hidden8 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden8);
+	let v9 = ext[2].read(state);
+	hidden8.$opcode = v9;
+	let ref10 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match11 = -1;
+	if (ref10 >= 764) { match11 = 0; }
+	else if (ref10 >= 0) { match11 = 1; }
+	if (match11 == -1) { throw new Error("no opcode matched"); }
+	let v12;
+	if (match11 == 0) {
+		let v13 = ext[3].read(state);
+		v12 = v13;
+	}
+	else if (match11 == 1) {
+		v12 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v12 !== undefined) { obj0.colanimcount = v12; }
+	let hidden14 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden14);
+	let v15 = ext[4].read(state);
+	hidden14.$opcode = v15;
+	let ref16 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match17 = -1;
+	if (ref16 >= 764) { match17 = 0; }
+	else if (ref16 >= 0) { match17 = 1; }
+	if (match17 == -1) { throw new Error("no opcode matched"); }
+	let v18;
+	if (match17 == 0) {
+		let v19 = ext[5].read(state);
+		v18 = v19;
+	}
+	else if (match17 == 1) {
+		v18 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v18 !== undefined) { obj0.unkcount0 = v18; }
+	let hidden20 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden20);
+	let ref21 = state.stack[state.stack.length - 2].footbytes;
+	ref21 = ref21 + 0;
+	hidden20.$opcode = ref21;
+	let ref22 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match23 = -1;
+	if (ref22 == 65535) { match23 = 0; }
+	else if (true) { match23 = 1; }
+	if (match23 == -1) { throw new Error("no opcode matched"); }
+	let v24;
+	if (match23 == 0) {
+		let v25 = ext[6].read(state);
+		v24 = v25;
+	}
+	else if (match23 == 1) {
+		v24 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v24 !== undefined) { obj0.uvcount = v24; }
+	let hidden26 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden26);
+	let ref27 = state.stack[state.stack.length - 2].footbytes;
+	ref27 = ref27 + 0;
+	hidden26.$opcode = ref27;
+	let ref28 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match29 = -1;
+	if (ref28 == 65535) { match29 = 0; }
+	else if (true) { match29 = 1; }
+	if (match29 == -1) { throw new Error("no opcode matched"); }
+	let v30;
+	if (match29 == 0) {
+		let v31 = ext[7].read(state);
+		v30 = v31;
+	}
+	else if (match29 == 1) {
+		let ref32 = state.stack[state.stack.length - 2].footbytes;
+		ref32 = ref32 + 0;
+		v30 = ref32;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v30 !== undefined) { obj0.indexbufsize = v30; }
+	let v33 = ext[8].read(state);
+	if (v33 !== undefined) { obj0.zsize = v33; }
+	let v34 = ext[9].read(state);
+	if (v34 !== undefined) { obj0.ysize = v34; }
+	let v35 = ext[10].read(state);
+	if (v35 !== undefined) { obj0.xsize = v35; }
+	let v36 = ext[11].read(state);
+	if (v36 !== undefined) { obj0.hasbones = v36; }
+	let hidden37 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden37);
+	let ref38 = state.stack[state.stack.length - 2].footbytes;
+	ref38 = ref38 + 0;
+	hidden37.$opcode = ref38;
+	let ref39 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match40 = -1;
+	if (ref39 == 65535) { match40 = 0; }
+	else if (true) { match40 = 1; }
+	if (match40 == -1) { throw new Error("no opcode matched"); }
+	let v41;
+	if (match40 == 0) {
+		let v42 = ext[12].read(state);
+		v41 = v42;
+	}
+	else if (match40 == 1) {
+		v41 = false;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v41 !== undefined) { obj0.hasmaterials = v41; }
+	let v43 = ext[13].read(state);
+	if (v43 !== undefined) { obj0.flag3 = v43; }
+	let v44 = ext[14].read(state);
+	if (v44 !== undefined) { obj0.hasalpha = v44; }
+	let v45 = ext[15].read(state);
+	if (v45 !== undefined) { obj0.priority = v45; }
+	let v46 = ext[16].read(state);
+	if (v46 !== undefined) { obj0.extraflags = v46; }
+	let hidden47 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden47);
+	let v48 = ext[17].read(state);
+	hidden47.$opcode = v48;
+	let ref49 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match50 = -1;
+	if (ref49 >= 764) { match50 = 0; }
+	else if (ref49 >= 0) { match50 = 1; }
+	if (match50 == -1) { throw new Error("no opcode matched"); }
+	let v51;
+	if (match50 == 0) {
+		let v52 = ext[18].read(state);
+		v51 = v52;
+	}
+	else if (match50 == 1) {
+		let v53 = ext[19].read(state);
+		v51 = v53;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v51 !== undefined) { obj0.texmapcount = v51; }
+	let v54 = ext[20].read(state);
+	if (v54 !== undefined) { obj0.facecount = v54; }
+	let v55 = ext[21].read(state);
+	if (v55 !== undefined) { obj0.vertcount = v55; }
+	let hidden56 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden56);
+	let v57 = ext[22].read(state);
+	hidden56.$opcode = v57;
+	let ref58 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match59 = -1;
+	if (ref58 >= 754) { match59 = 0; }
+	else if (ref58 >= 0) { match59 = 1; }
+	if (match59 == -1) { throw new Error("no opcode matched"); }
+	let v60;
+	if (match59 == 0) {
+		let v61 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v60 = v61;
+	}
+	else if (match59 == 1) {
+		v60 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v60 !== undefined) { obj0.header1 = v60; }
+	let hidden62 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden62);
+	let v63 = ext[23].read(state);
+	hidden62.$opcode = v63;
+	let ref64 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match65 = -1;
+	if (ref64 >= 764) { match65 = 0; }
+	else if (ref64 >= 0) { match65 = 1; }
+	if (match65 == -1) { throw new Error("no opcode matched"); }
+	let v66;
+	if (match65 == 0) {
+		let v67 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v66 = v67;
+	}
+	else if (match65 == 1) {
+		v66 = 0;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v66 !== undefined) { obj0.header2 = v66; }
+	let hidden68 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden68);
+	let v69 = ext[24].read(state);
+	hidden68.$opcode = v69;
+	let ref70 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match71 = -1;
+	if (ref70 >= 764) { match71 = 0; }
+	else if (true) { match71 = 1; }
+	if (match71 == -1) { throw new Error("no opcode matched"); }
+	let v72;
+	if (match71 == 0) {
+		let v73 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		v72 = v73;
+	}
+	else if (match71 == 1) {
+		let hidden74 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden74);
+		let ref75 = state.stack[state.stack.length - 3].extraflags;
+		ref75 = ref75 + 0;
+		hidden74.$opcode = ref75;
+		let ref76 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match77 = -1;
+		if ((ref76 & 8) != 0) { match77 = 0; }
+		else if (true) { match77 = 1; }
+		if (match77 == -1) { throw new Error("no opcode matched"); }
+		let v78;
+		if (match77 == 0) {
+			let v79 = ext[25].read(state);
+			v78 = v79;
+		}
+		else if (match77 == 1) {
+			v78 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v72 = v78;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v72 !== undefined) { obj0.modelversion = v72; }
+	let hidden80 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden80);
+	let v81 = ext[26].read(state);
+	hidden80.$opcode = v81;
+	let ref82 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match83 = -1;
+	if (ref82 >= 764) { match83 = 0; }
+	else if (true) { match83 = 1; }
+	if (match83 == -1) { throw new Error("no opcode matched"); }
+	let v84;
+	if (match83 == 0) {
+		let ref85 = state.stack[state.stack.length - 2].unkcount0;
+		ref85 = ref85 + 0;
+		v84 = ref85;
+	}
+	else if (match83 == 1) {
+		let hidden86 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden86);
+		let ref87 = state.stack[state.stack.length - 3].extraflags;
+		ref87 = ref87 + 0;
+		hidden86.$opcode = ref87;
+		let ref88 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match89 = -1;
+		if ((ref88 & 16) != 0) { match89 = 0; }
+		else if (true) { match89 = 1; }
+		if (match89 == -1) { throw new Error("no opcode matched"); }
+		let v90;
+		if (match89 == 0) {
+			let v91 = ext[27].read(state);
+			v90 = v91;
+		}
+		else if (match89 == 1) {
+			let ref92 = state.stack[state.stack.length - 3].vertcount;
+			ref92 = ref92 + 0;
+			v90 = ref92;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v84 = v90;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v84 !== undefined) { obj0.vertdatasize = v84; }
+	if (0 !== undefined) { obj0.texmap_vertcount = 0; }
+	if (0 !== undefined) { obj0.texmap_projectioncount = 0; }
+	if (0 !== undefined) { obj0.texmap_transsize = 0; }
+	let ref93 = state.stack[state.stack.length - 1].texmapcount;
+	ref93 = ref93 + 0;
+	let hidden94 = { $index: 0, $length: ref93 };
+	state.hiddenstack.push(hidden94);
+	state.stack.push({});
+	let arr95 = [];
+	for (let i96 = 0; i96 < ref93; i96++) {
+		hidden94.$index = i96;
+		let hidden97 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden97);
+		let hidden98 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden98);
+		let ref99 = state.stack[state.stack.length - 4].footbytes;
+		ref99 = ref99 + 0;
+		hidden98.$opcode = ref99;
+		let ref100 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match101 = -1;
+		if (ref100 == 65535) { match101 = 0; }
+		else if (true) { match101 = 1; }
+		if (match101 == -1) { throw new Error("no opcode matched"); }
+		let v102;
+		if (match101 == 0) {
+			let v103 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			v102 = v103;
+		}
+		else if (match101 == 1) {
+			v102 = 0;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		hidden97.$opcode = v102;
+		let ref104 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match105 = -1;
+		if (ref104 == 0) { match105 = 0; }
+		else if (ref104 == 1) { match105 = 1; }
+		else if (ref104 == 2) { match105 = 2; }
+		else if (ref104 == 3) { match105 = 3; }
+		if (match105 == -1) { throw new Error("no opcode matched"); }
+		let v106;
+		if (match105 == 0) {
+			let obj107 = {};
+			let hidden108 = {};
+			state.stack.push(obj107);
+			state.hiddenstack.push(hidden108);
+			if (0 !== undefined) { obj107.type = 0; }
+			let v109 = ext[28].read(state);
+			if (v109 !== undefined) { obj107.vertindex = v109; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v106 = obj107;
+		}
+		else if (match105 == 1) {
+			let obj110 = {};
+			let hidden111 = {};
+			state.stack.push(obj110);
+			state.hiddenstack.push(hidden111);
+			if (1 !== undefined) { obj110.type = 1; }
+			let v112 = ext[29].read(state);
+			if (v112 !== undefined) { obj110.projection = v112; }
+			let v113 = ext[30].read(state);
+			if (v113 !== undefined) { obj110.speed = v113; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v106 = obj110;
+		}
+		else if (match105 == 2) {
+			let obj114 = {};
+			let hidden115 = {};
+			state.stack.push(obj114);
+			state.hiddenstack.push(hidden115);
+			if (2 !== undefined) { obj114.type = 2; }
+			let v116 = ext[31].read(state);
+			if (v116 !== undefined) { obj114.projection = v116; }
+			let v117 = ext[32].read(state);
+			if (v117 !== undefined) { obj114.speed = v117; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v106 = obj114;
+		}
+		else if (match105 == 3) {
+			let obj118 = {};
+			let hidden119 = {};
+			state.stack.push(obj118);
+			state.hiddenstack.push(hidden119);
+			if (3 !== undefined) { obj118.type = 3; }
+			let v120 = ext[33].read(state);
+			if (v120 !== undefined) { obj118.projection = v120; }
+			let v121 = ext[34].read(state);
+			if (v121 !== undefined) { obj118.speed = v121; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			v106 = obj118;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr95.push(v106);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr95 !== undefined) { obj0.texflags = arr95; }
+	let v122 = ext[35].read(state);
+	if (v122 !== undefined) { obj0.vertflags = v122; }
+	let hidden123 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden123);
+	let ref124 = state.stack[state.stack.length - 2].footbytes;
+	ref124 = ref124 + 0;
+	hidden123.$opcode = ref124;
+	let ref125 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match126 = -1;
+	if (ref125 == 65535) { match126 = 0; }
+	else if (true) { match126 = 1; }
+	if (match126 == -1) { throw new Error("no opcode matched"); }
+	let v127;
+	if (match126 == 0) {
+		let ref128 = state.stack[state.stack.length - 2].extraflags;
+		let match129 = -1;
+		if ((ref128 & 1) != 0) { match129 = 0; }
+		let v130 = null;
+		if (match129 != -1) {
+			let v131 = ext[36].read(state);
+			v130 = v131;
+		}
+		v127 = v130;
+	}
+	else if (match126 == 1) {
+		v127 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v127 !== undefined) { obj0.mode_1 = v127; }
+	let v132 = ext[37].read(state);
+	if (v132 !== undefined) { obj0.tritype = v132; }
+	let ref133 = state.stack[state.stack.length - 1].priority;
+	let match134 = -1;
+	if (ref133 == 255) { match134 = 0; }
+	let v135 = null;
+	if (match134 != -1) {
+		let v136 = ext[38].read(state);
+		v135 = v136;
+	}
+	if (v135 !== undefined) { obj0.facepriority = v135; }
+	let ref137 = state.stack[state.stack.length - 1].flag3;
+	let match138 = -1;
+	if (ref137 == 1) { match138 = 0; }
+	let v139 = null;
+	if (match138 != -1) {
+		let v140 = ext[39].read(state);
+		v139 = v140;
+	}
+	if (v139 !== undefined) { obj0.unk1 = v139; }
+	let hidden141 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden141);
+	let ref142 = state.stack[state.stack.length - 2].footbytes;
+	ref142 = ref142 + 0;
+	hidden141.$opcode = ref142;
+	let ref143 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match144 = -1;
+	if (ref143 == 65535) { match144 = 0; }
+	else if (true) { match144 = 1; }
+	if (match144 == -1) { throw new Error("no opcode matched"); }
+	let v145;
+	if (match144 == 0) {
+		v145 = null;
+	}
+	else if (match144 == 1) {
+		let ref146 = state.stack[state.stack.length - 2].extraflags;
+		let match147 = -1;
+		if ((ref146 & 1) != 0) { match147 = 0; }
+		let v148 = null;
+		if (match147 != -1) {
+			let v149 = ext[40].read(state);
+			v148 = v149;
+		}
+		v145 = v148;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v145 !== undefined) { obj0.mode_2 = v145; }
+	let ref150 = state.stack[state.stack.length - 1].hasbones;
+	let match151 = -1;
+	if (ref150 == 1) { match151 = 0; }
+	let v152 = null;
+	if (match151 != -1) {
+		let v153 = ext[41].read(state);
+		v152 = v153;
+	}
+	if (v152 !== undefined) { obj0.boneids = v152; }
+	let ref154 = state.stack[state.stack.length - 1].hasalpha;
+	let match155 = -1;
+	if (ref154 == 1) { match155 = 0; }
+	let v156 = null;
+	if (match155 != -1) {
+		let v157 = ext[42].read(state);
+		v156 = v157;
+	}
+	if (v156 !== undefined) { obj0.alpha = v156; }
+	let v158 = ext[43].read(state);
+	if (v158 !== undefined) { obj0.indexbuffer = v158; }
+	let hidden159 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden159);
+	let ref160 = state.stack[state.stack.length - 2].footbytes;
+	ref160 = ref160 + 0;
+	hidden159.$opcode = ref160;
+	let ref161 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match162 = -1;
+	if (ref161 == 65535) { match162 = 0; }
+	else if (true) { match162 = 1; }
+	if (match162 == -1) { throw new Error("no opcode matched"); }
+	let v163;
+	if (match162 == 0) {
+		let ref164 = state.stack[state.stack.length - 2].hasmaterials;
+		let match165 = -1;
+		if (ref164 == 1) { match165 = 0; }
+		let v166 = null;
+		if (match165 != -1) {
+			let v167 = ext[44].read(state);
+			v166 = v167;
+		}
+		v163 = v166;
+	}
+	else if (match162 == 1) {
+		v163 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v163 !== undefined) { obj0.material = v163; }
+	let v168 = ext[45].read(state);
+	if (v168 !== undefined) { obj0.uvs = v168; }
+	let v169 = ext[46].read(state);
+	if (v169 !== undefined) { obj0.colors = v169; }
+	let hidden170 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden170);
+	let ref171 = state.stack[state.stack.length - 2].footbytes;
+	ref171 = ref171 + 0;
+	hidden170.$opcode = ref171;
+	let ref172 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match173 = -1;
+	if (ref172 == 65535) { match173 = 0; }
+	else if (true) { match173 = 1; }
+	if (match173 == -1) { throw new Error("no opcode matched"); }
+	let v174;
+	if (match173 == 0) {
+		v174 = null;
+	}
+	else if (match173 == 1) {
+		let ref175 = state.stack[state.stack.length - 2].texmap_vertcount;
+		ref175 = ref175 + 0;
+		let hidden176 = { $index: 0, $length: ref175 };
+		state.hiddenstack.push(hidden176);
+		state.stack.push({});
+		let arr177 = [];
+		for (let i178 = 0; i178 < ref175; i178++) {
+			hidden176.$index = i178;
+			let v179 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let v180 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let v181 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let arr182 = [v179, v180, v181];
+			arr177.push(arr182);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v174 = arr177;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v174 !== undefined) { obj0.texmap_verts_1 = v174; }
+	let v183 = ext[47].read(state);
+	if (v183 !== undefined) { obj0.posx = v183; }
+	let v184 = ext[48].read(state);
+	if (v184 !== undefined) { obj0.posy = v184; }
+	let v185 = ext[49].read(state);
+	if (v185 !== undefined) { obj0.posz = v185; }
+	let hidden186 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden186);
+	let ref187 = state.stack[state.stack.length - 2].footbytes;
+	ref187 = ref187 + 0;
+	hidden186.$opcode = ref187;
+	let ref188 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match189 = -1;
+	if (ref188 == 65535) { match189 = 0; }
+	else if (true) { match189 = 1; }
+	if (match189 == -1) { throw new Error("no opcode matched"); }
+	let v190;
+	if (match189 == 0) {
+		let ref191 = state.stack[state.stack.length - 2].texmap_vertcount;
+		ref191 = ref191 + 0;
+		let hidden192 = { $index: 0, $length: ref191 };
+		state.hiddenstack.push(hidden192);
+		state.stack.push({});
+		let arr193 = [];
+		for (let i194 = 0; i194 < ref191; i194++) {
+			hidden192.$index = i194;
+			let v195 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let v196 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let v197 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			let arr198 = [v195, v196, v197];
+			arr193.push(arr198);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v190 = arr193;
+	}
+	else if (match189 == 1) {
+		v190 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v190 !== undefined) { obj0.texmap_verts_2 = v190; }
+	let v199 = ext[50].read(state);
+	if (v199 !== undefined) { obj0.texmap_projections = v199; }
+	let ref200 = state.stack[state.stack.length - 1].texmap_transsize;
+	ref200 = ref200 + 0;
+	let hidden201 = { $index: 0, $length: ref200 };
+	state.hiddenstack.push(hidden201);
+	state.stack.push({});
+	let arr202 = [];
+	for (let i203 = 0; i203 < ref200; i203++) {
+		hidden201.$index = i203;
+		let v204 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		arr202.push(v204);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr202 !== undefined) { obj0.texmap_translates = arr202; }
+	let ref205 = state.stack[state.stack.length - 1].extraflags;
+	let match206 = -1;
+	if ((ref205 & 2) != 0) { match206 = 0; }
+	let v207 = null;
+	if (match206 != -1) {
+		let v208 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden209 = { $index: 0, $length: v208 };
+		state.hiddenstack.push(hidden209);
+		state.stack.push({});
+		let arr210 = [];
+		for (let i211 = 0; i211 < v208; i211++) {
+			hidden209.$index = i211;
+			let obj212 = {};
+			let hidden213 = {};
+			state.stack.push(obj212);
+			state.hiddenstack.push(hidden213);
+			let v214 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v214 !== undefined) { obj212.texture = v214; }
+			let v215 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v215 !== undefined) { obj212.faceid = v215; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr210.push(obj212);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v207 = arr210;
+	}
+	if (v207 !== undefined) { obj0.particles = v207; }
+	let ref216 = state.stack[state.stack.length - 1].extraflags;
+	let match217 = -1;
+	if ((ref216 & 2) != 0) { match217 = 0; }
+	let v218 = null;
+	if (match217 != -1) {
+		let v219 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden220 = { $index: 0, $length: v219 };
+		state.hiddenstack.push(hidden220);
+		state.stack.push({});
+		let arr221 = [];
+		for (let i222 = 0; i222 < v219; i222++) {
+			hidden220.$index = i222;
+			let obj223 = {};
+			let hidden224 = {};
+			state.stack.push(obj223);
+			state.hiddenstack.push(hidden224);
+			let v225 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v225 !== undefined) { obj223.effector = v225; }
+			let v226 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v226 !== undefined) { obj223.vertex = v226; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr221.push(obj223);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v218 = arr221;
+	}
+	if (v218 !== undefined) { obj0.effectors = v218; }
+	let ref227 = state.stack[state.stack.length - 1].extraflags;
+	let match228 = -1;
+	if ((ref227 & 4) != 0) { match228 = 0; }
+	let v229 = null;
+	if (match228 != -1) {
+		let v230 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden231 = { $index: 0, $length: v230 };
+		state.hiddenstack.push(hidden231);
+		state.stack.push({});
+		let arr232 = [];
+		for (let i233 = 0; i233 < v230; i233++) {
+			hidden231.$index = i233;
+			let obj234 = {};
+			let hidden235 = {};
+			state.stack.push(obj234);
+			state.hiddenstack.push(hidden235);
+			let v236 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v236 !== undefined) { obj234.unk1 = v236; }
+			let v237 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v237 !== undefined) { obj234.unk2 = v237; }
+			let v238 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v238 !== undefined) { obj234.unk3 = v238; }
+			let v239 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			if (v239 !== undefined) { obj234.unk4 = v239; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr232.push(obj234);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v229 = arr232;
+	}
+	if (v229 !== undefined) { obj0.billboards = v229; }
+	let ref240 = state.stack[state.stack.length - 1].extraflags;
+	let match241 = -1;
+	if ((ref240 & 128) != 0) { match241 = 0; }
+	let v242 = null;
+	if (match241 != -1) {
+		let obj243 = {};
+		let hidden244 = {};
+		state.stack.push(obj243);
+		state.hiddenstack.push(hidden244);
+		let v245 = ext[51].read(state);
+		if (v245 !== undefined) { obj243.headoffset = v245; }
+		let v246 = ext[52].read(state);
+		if (v246 !== undefined) { obj243.indexsize = v246; }
+		let v247 = ext[53].read(state);
+		if (v247 !== undefined) { obj243.datasize = v247; }
+		let v248 = ext[54].read(state);
+		if (v248 !== undefined) { obj243.coordcount = v248; }
+		let v249 = ext[55].read(state);
+		if (v249 !== undefined) { obj243.index = v249; }
+		let v250 = ext[56].read(state);
+		if (v250 !== undefined) { obj243.vertex = v250; }
+		let ref251 = state.stack[state.stack.length - 1].coordcount;
+		ref251 = ref251 + 0;
+		let hidden252 = { $index: 0, $length: ref251 };
+		state.hiddenstack.push(hidden252);
+		state.stack.push({});
+		let arr253 = [];
+		for (let i254 = 0; i254 < ref251; i254++) {
+			hidden252.$index = i254;
+			let v255 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			arr253.push(v255);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		if (arr253 !== undefined) { obj243.udata = arr253; }
+		let ref256 = state.stack[state.stack.length - 1].coordcount;
+		ref256 = ref256 + 0;
+		let hidden257 = { $index: 0, $length: ref256 };
+		state.hiddenstack.push(hidden257);
+		state.stack.push({});
+		let arr258 = [];
+		for (let i259 = 0; i259 < ref256; i259++) {
+			hidden257.$index = i259;
+			let v260 = state.view.getInt16(state.scan);
+			state.scan += 2;
+			arr258.push(v260);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		if (arr258 !== undefined) { obj243.vdata = arr258; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v242 = obj243;
+	}
+	if (v242 !== undefined) { obj0.texuvs = v242; }
+	let hidden261 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden261);
+	let ref262 = state.stack[state.stack.length - 2].footbytes;
+	ref262 = ref262 + 0;
+	hidden261.$opcode = ref262;
+	let ref263 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match264 = -1;
+	if (ref263 == 65535) { match264 = 0; }
+	else if (true) { match264 = 1; }
+	if (match264 == -1) { throw new Error("no opcode matched"); }
+	let v265;
+	if (match264 == 0) {
+		let hidden266 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden266);
+		let v267 = ext[57].read(state);
+		hidden266.$opcode = v267;
+		let ref268 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match269 = -1;
+		if (ref268 >= 526) { match269 = 0; }
+		else if (true) { match269 = 1; }
+		if (match269 == -1) { throw new Error("no opcode matched"); }
+		let v270;
+		if (match269 == 0) {
+			v270 = null;
+		}
+		else if (match269 == 1) {
+			let v271 = state.view.getUint8(state.scan);
+			state.scan += 1;
+			let hidden272 = { $index: 0, $length: v271 };
+			state.hiddenstack.push(hidden272);
+			state.stack.push({});
+			let arr273 = [];
+			for (let i274 = 0; i274 < v271; i274++) {
+				hidden272.$index = i274;
+				let v275 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v276 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v277 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v278 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				let arr279 = [v275, v276, v277, v278];
+				arr273.push(arr279);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			v270 = arr273;
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+		v265 = v270;
+	}
+	else if (match264 == 1) {
+		v265 = null;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v265 !== undefined) { obj0.unusedendbytes = v265; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden280 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden280);
+	let w281 = value.footbytes;
+	let hidden282 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden282);
+	hidden282.$opcode = ext[0].readConst(state);
+	let ref283 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match284 = -1;
+	if (ref283 >= 764) { match284 = 0; }
+	else if (ref283 >= 0) { match284 = 1; }
+	if (match284 == -1) { throw new Error("no opcode matched"); }
+	if (match284 == 0) {
+		if (w281 != 65535) { throw new Error("expected constant 65535 was not present during write"); }
+	}
+	else if (match284 == 1) {
+		ext[1].write(state, w281);
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w285 = value.colanimcount;
+	let hidden286 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden286);
+	hidden286.$opcode = ext[2].readConst(state);
+	let ref287 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match288 = -1;
+	if (ref287 >= 764) { match288 = 0; }
+	else if (ref287 >= 0) { match288 = 1; }
+	if (match288 == -1) { throw new Error("no opcode matched"); }
+	if (match288 == 0) {
+		ext[3].write(state, w285);
+	}
+	else if (match288 == 1) {
+		if (w285 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w289 = value.unkcount0;
+	let hidden290 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden290);
+	hidden290.$opcode = ext[4].readConst(state);
+	let ref291 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match292 = -1;
+	if (ref291 >= 764) { match292 = 0; }
+	else if (ref291 >= 0) { match292 = 1; }
+	if (match292 == -1) { throw new Error("no opcode matched"); }
+	if (match292 == 0) {
+		ext[5].write(state, w289);
+	}
+	else if (match292 == 1) {
+		if (w289 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w293 = value.uvcount;
+	let hidden294 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden294);
+	hidden294.$opcode = ext[58].readConst(state);
+	let ref295 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match296 = -1;
+	if (ref295 == 65535) { match296 = 0; }
+	else if (true) { match296 = 1; }
+	if (match296 == -1) { throw new Error("no opcode matched"); }
+	if (match296 == 0) {
+		ext[6].write(state, w293);
+	}
+	else if (match296 == 1) {
+		if (w293 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w297 = value.indexbufsize;
+	let hidden298 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden298);
+	hidden298.$opcode = ext[59].readConst(state);
+	let ref299 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match300 = -1;
+	if (ref299 == 65535) { match300 = 0; }
+	else if (true) { match300 = 1; }
+	if (match300 == -1) { throw new Error("no opcode matched"); }
+	if (match300 == 0) {
+		ext[7].write(state, w297);
+	}
+	else if (match300 == 1) {
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w301 = value.zsize;
+	ext[8].write(state, w301);
+	let w302 = value.ysize;
+	ext[9].write(state, w302);
+	let w303 = value.xsize;
+	ext[10].write(state, w303);
+	let w304 = value.hasbones;
+	ext[11].write(state, w304);
+	let w305 = value.hasmaterials;
+	let hidden306 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden306);
+	hidden306.$opcode = ext[60].readConst(state);
+	let ref307 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match308 = -1;
+	if (ref307 == 65535) { match308 = 0; }
+	else if (true) { match308 = 1; }
+	if (match308 == -1) { throw new Error("no opcode matched"); }
+	if (match308 == 0) {
+		ext[12].write(state, w305);
+	}
+	else if (match308 == 1) {
+		if (w305 != false) { throw new Error("expected constant false was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w309 = value.flag3;
+	ext[13].write(state, w309);
+	let w310 = value.hasalpha;
+	ext[14].write(state, w310);
+	let w311 = value.priority;
+	ext[15].write(state, w311);
+	let w312 = value.extraflags;
+	ext[16].write(state, w312);
+	let w313 = value.texmapcount;
+	let hidden314 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden314);
+	hidden314.$opcode = ext[17].readConst(state);
+	let ref315 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match316 = -1;
+	if (ref315 >= 764) { match316 = 0; }
+	else if (ref315 >= 0) { match316 = 1; }
+	if (match316 == -1) { throw new Error("no opcode matched"); }
+	if (match316 == 0) {
+		ext[18].write(state, w313);
+	}
+	else if (match316 == 1) {
+		ext[19].write(state, w313);
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w317 = value.facecount;
+	ext[20].write(state, w317);
+	let w318 = value.vertcount;
+	ext[21].write(state, w318);
+	let w319 = value.header1;
+	let hidden320 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden320);
+	hidden320.$opcode = ext[22].readConst(state);
+	let ref321 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match322 = -1;
+	if (ref321 >= 754) { match322 = 0; }
+	else if (ref321 >= 0) { match322 = 1; }
+	if (match322 == -1) { throw new Error("no opcode matched"); }
+	if (match322 == 0) {
+		if (typeof w319 != "number" || w319 > 255 || w319 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w319, state.scan);
+		state.scan += 1;
+	}
+	else if (match322 == 1) {
+		if (w319 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w323 = value.header2;
+	let hidden324 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden324);
+	hidden324.$opcode = ext[23].readConst(state);
+	let ref325 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match326 = -1;
+	if (ref325 >= 764) { match326 = 0; }
+	else if (ref325 >= 0) { match326 = 1; }
+	if (match326 == -1) { throw new Error("no opcode matched"); }
+	if (match326 == 0) {
+		if (typeof w323 != "number" || w323 > 255 || w323 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w323, state.scan);
+		state.scan += 1;
+	}
+	else if (match326 == 1) {
+		if (w323 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w327 = value.modelversion;
+	let hidden328 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden328);
+	hidden328.$opcode = ext[24].readConst(state);
+	let ref329 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match330 = -1;
+	if (ref329 >= 764) { match330 = 0; }
+	else if (true) { match330 = 1; }
+	if (match330 == -1) { throw new Error("no opcode matched"); }
+	if (match330 == 0) {
+		if (typeof w327 != "number" || w327 > 255 || w327 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w327, state.scan);
+		state.scan += 1;
+	}
+	else if (match330 == 1) {
+		let hidden331 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden331);
+		hidden331.$opcode = ext[61].readConst(state);
+		let ref332 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match333 = -1;
+		if ((ref332 & 8) != 0) { match333 = 0; }
+		else if (true) { match333 = 1; }
+		if (match333 == -1) { throw new Error("no opcode matched"); }
+		if (match333 == 0) {
+			ext[25].write(state, w327);
+		}
+		else if (match333 == 1) {
+			if (w327 != 0) { throw new Error("expected constant 0 was not present during write"); }
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w334 = value.vertdatasize;
+	let hidden335 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden335);
+	hidden335.$opcode = ext[26].readConst(state);
+	let ref336 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match337 = -1;
+	if (ref336 >= 764) { match337 = 0; }
+	else if (true) { match337 = 1; }
+	if (match337 == -1) { throw new Error("no opcode matched"); }
+	if (match337 == 0) {
+	}
+	else if (match337 == 1) {
+		let hidden338 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden338);
+		hidden338.$opcode = ext[62].readConst(state);
+		let ref339 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match340 = -1;
+		if ((ref339 & 16) != 0) { match340 = 0; }
+		else if (true) { match340 = 1; }
+		if (match340 == -1) { throw new Error("no opcode matched"); }
+		if (match340 == 0) {
+			ext[27].write(state, w334);
+		}
+		else if (match340 == 1) {
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w341 = value.texmap_vertcount;
+	if (w341 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	let w342 = value.texmap_projectioncount;
+	if (w342 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	let w343 = value.texmap_transsize;
+	if (w343 != 0) { throw new Error("expected constant 0 was not present during write"); }
+	let w344 = value.texflags;
+	if (!Array.isArray(w344)) { throw new Error("array expected"); }
+	let w345 = w344.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w344.length });
+	for (let i346 = 0; i346 < w344.length; i346++) {
+		let w347 = w344[i346];
+		let hidden348 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden348);
+		throw new Error("non-const or non-reference match value not implemented in write mode");
+		let ref349 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match350 = -1;
+		if (ref349 == 0) { match350 = 0; }
+		else if (ref349 == 1) { match350 = 1; }
+		else if (ref349 == 2) { match350 = 2; }
+		else if (ref349 == 3) { match350 = 3; }
+		if (match350 == -1) { throw new Error("no opcode matched"); }
+		if (match350 == 0) {
+			if (typeof w347 != "object" || !w347) { throw new Error("object expected"); }
+			let hidden351 = {};
+			state.stack.push(w347);
+			state.hiddenstack.push(hidden351);
+			let w352 = w347.type;
+			if (w352 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			let w353 = w347.vertindex;
+			ext[28].write(state, w353);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match350 == 1) {
+			if (typeof w347 != "object" || !w347) { throw new Error("object expected"); }
+			let hidden354 = {};
+			state.stack.push(w347);
+			state.hiddenstack.push(hidden354);
+			let w355 = w347.type;
+			if (w355 != 1) { throw new Error("expected constant 1 was not present during write"); }
+			let w356 = w347.projection;
+			ext[29].write(state, w356);
+			let w357 = w347.speed;
+			ext[30].write(state, w357);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match350 == 2) {
+			if (typeof w347 != "object" || !w347) { throw new Error("object expected"); }
+			let hidden358 = {};
+			state.stack.push(w347);
+			state.hiddenstack.push(hidden358);
+			let w359 = w347.type;
+			if (w359 != 2) { throw new Error("expected constant 2 was not present during write"); }
+			let w360 = w347.projection;
+			ext[31].write(state, w360);
+			let w361 = w347.speed;
+			ext[32].write(state, w361);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		else if (match350 == 3) {
+			if (typeof w347 != "object" || !w347) { throw new Error("object expected"); }
+			let hidden362 = {};
+			state.stack.push(w347);
+			state.hiddenstack.push(hidden362);
+			let w363 = w347.type;
+			if (w363 != 3) { throw new Error("expected constant 3 was not present during write"); }
+			let w364 = w347.projection;
+			ext[33].write(state, w364);
+			let w365 = w347.speed;
+			ext[34].write(state, w365);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w366 = value.vertflags;
+	ext[35].write(state, w366);
+	let w367 = value.mode_1;
+	let hidden368 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden368);
+	hidden368.$opcode = ext[63].readConst(state);
+	let ref369 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match370 = -1;
+	if (ref369 == 65535) { match370 = 0; }
+	else if (true) { match370 = 1; }
+	if (match370 == -1) { throw new Error("no opcode matched"); }
+	if (match370 == 0) {
+		if (w367 != null) {
+			ext[36].write(state, w367);
+		}
+	}
+	else if (match370 == 1) {
+		if (w367 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w371 = value.tritype;
+	ext[37].write(state, w371);
+	let w372 = value.facepriority;
+	if (w372 != null) {
+		ext[38].write(state, w372);
+	}
+	let w373 = value.unk1;
+	if (w373 != null) {
+		ext[39].write(state, w373);
+	}
+	let w374 = value.mode_2;
+	let hidden375 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden375);
+	hidden375.$opcode = ext[64].readConst(state);
+	let ref376 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match377 = -1;
+	if (ref376 == 65535) { match377 = 0; }
+	else if (true) { match377 = 1; }
+	if (match377 == -1) { throw new Error("no opcode matched"); }
+	if (match377 == 0) {
+		if (w374 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	else if (match377 == 1) {
+		if (w374 != null) {
+			ext[40].write(state, w374);
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w378 = value.boneids;
+	if (w378 != null) {
+		ext[41].write(state, w378);
+	}
+	let w379 = value.alpha;
+	if (w379 != null) {
+		ext[42].write(state, w379);
+	}
+	let w380 = value.indexbuffer;
+	ext[43].write(state, w380);
+	let w381 = value.material;
+	let hidden382 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden382);
+	hidden382.$opcode = ext[65].readConst(state);
+	let ref383 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match384 = -1;
+	if (ref383 == 65535) { match384 = 0; }
+	else if (true) { match384 = 1; }
+	if (match384 == -1) { throw new Error("no opcode matched"); }
+	if (match384 == 0) {
+		if (w381 != null) {
+			ext[44].write(state, w381);
+		}
+	}
+	else if (match384 == 1) {
+		if (w381 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w385 = value.uvs;
+	ext[45].write(state, w385);
+	let w386 = value.colors;
+	ext[46].write(state, w386);
+	let w387 = value.texmap_verts_1;
+	let hidden388 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden388);
+	hidden388.$opcode = ext[66].readConst(state);
+	let ref389 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match390 = -1;
+	if (ref389 == 65535) { match390 = 0; }
+	else if (true) { match390 = 1; }
+	if (match390 == -1) { throw new Error("no opcode matched"); }
+	if (match390 == 0) {
+		if (w387 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	else if (match390 == 1) {
+		if (!Array.isArray(w387)) { throw new Error("array expected"); }
+		let w391 = w387.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w387.length });
+		for (let i392 = 0; i392 < w387.length; i392++) {
+			let w393 = w387[i392];
+			if (!Array.isArray(w393)) { throw new Error("array expected"); }
+			let w394 = w393[0];
+			if (typeof w394 != "number" || w394 > 65535 || w394 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w394, state.scan);
+			state.scan += 2;
+			let w395 = w393[1];
+			if (typeof w395 != "number" || w395 > 65535 || w395 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w395, state.scan);
+			state.scan += 2;
+			let w396 = w393[2];
+			if (typeof w396 != "number" || w396 > 65535 || w396 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w396, state.scan);
+			state.scan += 2;
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w397 = value.posx;
+	ext[47].write(state, w397);
+	let w398 = value.posy;
+	ext[48].write(state, w398);
+	let w399 = value.posz;
+	ext[49].write(state, w399);
+	let w400 = value.texmap_verts_2;
+	let hidden401 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden401);
+	hidden401.$opcode = ext[67].readConst(state);
+	let ref402 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match403 = -1;
+	if (ref402 == 65535) { match403 = 0; }
+	else if (true) { match403 = 1; }
+	if (match403 == -1) { throw new Error("no opcode matched"); }
+	if (match403 == 0) {
+		if (!Array.isArray(w400)) { throw new Error("array expected"); }
+		let w404 = w400.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w400.length });
+		for (let i405 = 0; i405 < w400.length; i405++) {
+			let w406 = w400[i405];
+			if (!Array.isArray(w406)) { throw new Error("array expected"); }
+			let w407 = w406[0];
+			if (typeof w407 != "number" || w407 > 65535 || w407 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w407, state.scan);
+			state.scan += 2;
+			let w408 = w406[1];
+			if (typeof w408 != "number" || w408 > 65535 || w408 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w408, state.scan);
+			state.scan += 2;
+			let w409 = w406[2];
+			if (typeof w409 != "number" || w409 > 65535 || w409 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w409, state.scan);
+			state.scan += 2;
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	else if (match403 == 1) {
+		if (w400 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w410 = value.texmap_projections;
+	ext[50].write(state, w410);
+	let w411 = value.texmap_translates;
+	if (!Array.isArray(w411)) { throw new Error("array expected"); }
+	let w412 = w411.length;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w411.length });
+	for (let i413 = 0; i413 < w411.length; i413++) {
+		let w414 = w411[i413];
+		if (typeof w414 != "number" || w414 > 255 || w414 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w414, state.scan);
+		state.scan += 1;
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	let w415 = value.particles;
+	if (w415 != null) {
+		if (!Array.isArray(w415)) { throw new Error("array expected"); }
+		let w416 = w415.length;
+		if (typeof w416 != "number" || w416 > 255 || w416 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w416, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w415.length });
+		for (let i417 = 0; i417 < w415.length; i417++) {
+			let w418 = w415[i417];
+			if (typeof w418 != "object" || !w418) { throw new Error("object expected"); }
+			let hidden419 = {};
+			state.stack.push(w418);
+			state.hiddenstack.push(hidden419);
+			let w420 = w418.texture;
+			if (typeof w420 != "number" || w420 > 65535 || w420 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w420, state.scan);
+			state.scan += 2;
+			let w421 = w418.faceid;
+			if (typeof w421 != "number" || w421 > 65535 || w421 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w421, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w422 = value.effectors;
+	if (w422 != null) {
+		if (!Array.isArray(w422)) { throw new Error("array expected"); }
+		let w423 = w422.length;
+		if (typeof w423 != "number" || w423 > 255 || w423 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w423, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w422.length });
+		for (let i424 = 0; i424 < w422.length; i424++) {
+			let w425 = w422[i424];
+			if (typeof w425 != "object" || !w425) { throw new Error("object expected"); }
+			let hidden426 = {};
+			state.stack.push(w425);
+			state.hiddenstack.push(hidden426);
+			let w427 = w425.effector;
+			if (typeof w427 != "number" || w427 > 65535 || w427 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w427, state.scan);
+			state.scan += 2;
+			let w428 = w425.vertex;
+			if (typeof w428 != "number" || w428 > 65535 || w428 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w428, state.scan);
+			state.scan += 2;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w429 = value.billboards;
+	if (w429 != null) {
+		if (!Array.isArray(w429)) { throw new Error("array expected"); }
+		let w430 = w429.length;
+		if (typeof w430 != "number" || w430 > 255 || w430 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w430, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w429.length });
+		for (let i431 = 0; i431 < w429.length; i431++) {
+			let w432 = w429[i431];
+			if (typeof w432 != "object" || !w432) { throw new Error("object expected"); }
+			let hidden433 = {};
+			state.stack.push(w432);
+			state.hiddenstack.push(hidden433);
+			let w434 = w432.unk1;
+			if (typeof w434 != "number" || w434 > 65535 || w434 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w434, state.scan);
+			state.scan += 2;
+			let w435 = w432.unk2;
+			if (typeof w435 != "number" || w435 > 65535 || w435 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w435, state.scan);
+			state.scan += 2;
+			let w436 = w432.unk3;
+			if (typeof w436 != "number" || w436 > 255 || w436 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w436, state.scan);
+			state.scan += 1;
+			let w437 = w432.unk4;
+			if (typeof w437 != "number" || w437 > 255 || w437 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w437, state.scan);
+			state.scan += 1;
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	let w438 = value.texuvs;
+	if (w438 != null) {
+		if (typeof w438 != "object" || !w438) { throw new Error("object expected"); }
+		let hidden439 = {};
+		state.stack.push(w438);
+		state.hiddenstack.push(hidden439);
+		let w440 = w438.headoffset;
+		ext[51].write(state, w440);
+		let w441 = w438.indexsize;
+		ext[52].write(state, w441);
+		let w442 = w438.datasize;
+		ext[53].write(state, w442);
+		let w443 = w438.coordcount;
+		ext[54].write(state, w443);
+		let w444 = w438.index;
+		ext[55].write(state, w444);
+		let w445 = w438.vertex;
+		ext[56].write(state, w445);
+		let w446 = w438.udata;
+		if (!Array.isArray(w446)) { throw new Error("array expected"); }
+		let w447 = w446.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w446.length });
+		for (let i448 = 0; i448 < w446.length; i448++) {
+			let w449 = w446[i448];
+			if (typeof w449 != "number" || w449 > 32767 || w449 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w449, state.scan);
+			state.scan += 2;
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		let w450 = w438.vdata;
+		if (!Array.isArray(w450)) { throw new Error("array expected"); }
+		let w451 = w450.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w450.length });
+		for (let i452 = 0; i452 < w450.length; i452++) {
+			let w453 = w450[i452];
+			if (typeof w453 != "number" || w453 > 32767 || w453 < -32768) { throw new Error(); }
+			state.buffer.writeInt16BE(w453, state.scan);
+			state.scan += 2;
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	let w454 = value.unusedendbytes;
+	let hidden455 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden455);
+	hidden455.$opcode = ext[68].readConst(state);
+	let ref456 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match457 = -1;
+	if (ref456 == 65535) { match457 = 0; }
+	else if (true) { match457 = 1; }
+	if (match457 == -1) { throw new Error("no opcode matched"); }
+	if (match457 == 0) {
+		let hidden458 = { $opcode: 0 };
+		state.stack.push({});
+		state.hiddenstack.push(hidden458);
+		hidden458.$opcode = ext[57].readConst(state);
+		let ref459 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+		let match460 = -1;
+		if (ref459 >= 526) { match460 = 0; }
+		else if (true) { match460 = 1; }
+		if (match460 == -1) { throw new Error("no opcode matched"); }
+		if (match460 == 0) {
+			if (w454 != null) { throw new Error("expected constant null was not present during write"); }
+		}
+		else if (match460 == 1) {
+			if (!Array.isArray(w454)) { throw new Error("array expected"); }
+			let w461 = w454.length;
+			if (typeof w461 != "number" || w461 > 255 || w461 < 0) { throw new Error(); }
+			state.buffer.writeUInt8(w461, state.scan);
+			state.scan += 1;
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w454.length });
+			for (let i462 = 0; i462 < w454.length; i462++) {
+				let w463 = w454[i462];
+				if (!Array.isArray(w463)) { throw new Error("array expected"); }
+				let w464 = w463[0];
+				if (typeof w464 != "number" || w464 > 65535 || w464 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w464, state.scan);
+				state.scan += 2;
+				let w465 = w463[1];
+				if (typeof w465 != "number" || w465 > 65535 || w465 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w465, state.scan);
+				state.scan += 2;
+				let w466 = w463[2];
+				if (typeof w466 != "number" || w466 > 65535 || w466 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w466, state.scan);
+				state.scan += 2;
+				let w467 = w463[3];
+				if (typeof w467 != "number" || w467 > 2147483647 || w467 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w467, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+		}
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	else if (match457 == 1) {
+		if (w454 != null) { throw new Error("expected constant null was not present during write"); }
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
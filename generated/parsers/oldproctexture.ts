@@ -0,0 +1,55 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\oldproctexture.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x94148316;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v2 !== undefined) { obj0.color = v2; }
+	let v3 = state.view.getUint8(state.scan++);
+	if (v3 != 0 && v3 != 1) { throw new Error("1 or 0 expected boolean value"); }
+	if ((v3 != 0) !== undefined) { obj0.bool0 = (v3 != 0); }
+	let v4 = state.view.getUint8(state.scan++);
+	if (v4 != 0 && v4 != 1) { throw new Error("1 or 0 expected boolean value"); }
+	if ((v4 != 0) !== undefined) { obj0.bool1 = (v4 != 0); }
+	let v5 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v5 !== undefined) { obj0.spriteid = v5; }
+	let v6 = ext[0].read(state);
+	if (v6 !== undefined) { obj0.always00 = v6; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden7 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden7);
+	let w8 = value.color;
+	if (typeof w8 != "number" || w8 > 65535 || w8 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w8, state.scan);
+	state.scan += 2;
+	let w9 = value.bool0;
+	if (typeof w9 != "boolean") { throw new Error("boolean expected"); }
+	state.buffer.writeUInt8(+w9, state.scan++);
+	let w10 = value.bool1;
+	if (typeof w10 != "boolean") { throw new Error("boolean expected"); }
+	state.buffer.writeUInt8(+w10, state.scan++);
+	let w11 = value.spriteid;
+	if (typeof w11 != "number" || w11 > 65535 || w11 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w11, state.scan);
+	state.scan += 2;
+	let w12 = value.always00;
+	ext[0].write(state, w12);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,125 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\params.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd4b9dd2f;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 4: {
+				obj0.unk04 = true;
+				break;
+			}
+			case 101: {
+				let obj3 = {};
+				let hidden4 = {};
+				state.stack.push(obj3);
+				state.hiddenstack.push(hidden4);
+				let v5 = ext[0].read(state);
+				if (v5 !== undefined) { obj3.vartype = v5; }
+				let v6 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v6 !== undefined) { hidden4.$primitive = v6; }
+				let ref7 = state.hiddenstack[state.hiddenstack.length - 1].$primitive;
+				let match8 = -1;
+				if (ref7 == 2) { match8 = 0; }
+				let v9 = null;
+				if (match8 != -1) {
+					let v10 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					v9 = v10;
+				}
+				if (v9 !== undefined) { obj3.defaultint = v9; }
+				let ref11 = state.hiddenstack[state.hiddenstack.length - 1].$primitive;
+				let match12 = -1;
+				if (ref11 == 5) { match12 = 0; }
+				let v13 = null;
+				if (match12 != -1) {
+					let v14 = ext[1].read(state);
+					v13 = v14;
+				}
+				if (v13 !== undefined) { obj3.defaultstring = v13; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.type = obj3;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key15 in value) {
+		if (key15.startsWith("$")) { continue; }
+		switch (key15) {
+			case "unk04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w16 = value[key15];
+				if (w16 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "type": {
+				if (typeof 101 != "number" || 101 > 255 || 101 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(101, state.scan);
+				state.scan += 1;
+				let w17 = value[key15];
+				if (typeof w17 != "object" || !w17) { throw new Error("object expected"); }
+				let hidden18 = {};
+				state.stack.push(w17);
+				state.hiddenstack.push(hidden18);
+				let w19 = w17.vartype;
+				ext[0].write(state, w19);
+				let w20 = w17.$primitive;
+				w20 ??= 0;
+				w20 = ext[2].resolve(w17, w20);
+				w20 = ext[3].resolve(w17, w20);
+				hidden18.$primitive = w20;
+				if (typeof w20 != "number" || w20 > 255 || w20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w20, state.scan);
+				state.scan += 1;
+				let w21 = w17.defaultint;
+				if (w21 != null) {
+					if (typeof w21 != "number" || w21 > 2147483647 || w21 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w21, state.scan);
+					state.scan += 4;
+				}
+				let w22 = w17.defaultstring;
+				if (w22 != null) {
+					ext[1].write(state, w22);
+				}
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key15);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
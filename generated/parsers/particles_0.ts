@@ -0,0 +1,1037 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\particles_0.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xc9c1bbbb;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let hidden3 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden3);
+				state.stack.push({});
+				let arr4 = [];
+				for (let i5 = 0; i5 < 4; i5++) {
+					hidden3.$index = i5;
+					let v6 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr4.push(v6);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk01 = arr4;
+				break;
+			}
+			case 2: {
+				let hidden7 = { $index: 0, $length: 1 };
+				state.hiddenstack.push(hidden7);
+				state.stack.push({});
+				let arr8 = [];
+				for (let i9 = 0; i9 < 1; i9++) {
+					hidden7.$index = i9;
+					let v10 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr8.push(v10);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk02 = arr8;
+				break;
+			}
+			case 3: {
+				let hidden11 = { $index: 0, $length: 4 };
+				state.hiddenstack.push(hidden11);
+				state.stack.push({});
+				let arr12 = [];
+				for (let i13 = 0; i13 < 4; i13++) {
+					hidden11.$index = i13;
+					let v14 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr12.push(v14);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk03 = arr12;
+				break;
+			}
+			case 4: {
+				let hidden15 = { $index: 0, $length: 1 };
+				state.hiddenstack.push(hidden15);
+				state.stack.push({});
+				let arr16 = [];
+				for (let i17 = 0; i17 < 1; i17++) {
+					hidden15.$index = i17;
+					let v18 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr16.push(v18);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk04 = arr16;
+				break;
+			}
+			case 5: {
+				let hidden19 = { $index: 0, $length: 1 };
+				state.hiddenstack.push(hidden19);
+				state.stack.push({});
+				let arr20 = [];
+				for (let i21 = 0; i21 < 1; i21++) {
+					hidden19.$index = i21;
+					let v22 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr20.push(v22);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk05 = arr20;
+				break;
+			}
+			case 6: {
+				let v23 = ext[0].read(state);
+				obj0.unk06 = v23;
+				break;
+			}
+			case 7: {
+				let hidden24 = { $index: 0, $length: 2 };
+				state.hiddenstack.push(hidden24);
+				state.stack.push({});
+				let arr25 = [];
+				for (let i26 = 0; i26 < 2; i26++) {
+					hidden24.$index = i26;
+					let v27 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr25.push(v27);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk07 = arr25;
+				break;
+			}
+			case 8: {
+				let hidden28 = { $index: 0, $length: 2 };
+				state.hiddenstack.push(hidden28);
+				state.stack.push({});
+				let arr29 = [];
+				for (let i30 = 0; i30 < 2; i30++) {
+					hidden28.$index = i30;
+					let v31 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr29.push(v31);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk08 = arr29;
+				break;
+			}
+			case 9: {
+				let v32 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden33 = { $index: 0, $length: v32 };
+				state.hiddenstack.push(hidden33);
+				state.stack.push({});
+				let arr34 = [];
+				for (let i35 = 0; i35 < v32; i35++) {
+					hidden33.$index = i35;
+					let v36 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr34.push(v36);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk09 = arr34;
+				break;
+			}
+			case 10: {
+				let v37 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden38 = { $index: 0, $length: v37 };
+				state.hiddenstack.push(hidden38);
+				state.stack.push({});
+				let arr39 = [];
+				for (let i40 = 0; i40 < v37; i40++) {
+					hidden38.$index = i40;
+					let v41 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr39.push(v41);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk0A = arr39;
+				break;
+			}
+			case 12: {
+				let v42 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk0C = v42;
+				break;
+			}
+			case 13: {
+				let v43 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk0D = v43;
+				break;
+			}
+			case 14: {
+				let v44 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk0E = v44;
+				break;
+			}
+			case 15: {
+				let v45 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk0F = v45;
+				break;
+			}
+			case 16: {
+				let v46 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v47 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				let v48 = state.view.getInt16(state.scan);
+				state.scan += 2;
+				let v49 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr50 = [v46, v47, v48, v49];
+				obj0.unk10 = arr50;
+				break;
+			}
+			case 18: {
+				let v51 = ext[1].read(state);
+				obj0.unk12 = v51;
+				break;
+			}
+			case 19: {
+				let v52 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk13 = v52;
+				break;
+			}
+			case 20: {
+				let v53 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk14 = v53;
+				break;
+			}
+			case 21: {
+				let v54 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk15 = v54;
+				break;
+			}
+			case 22: {
+				let hidden55 = { $index: 0, $length: 2 };
+				state.hiddenstack.push(hidden55);
+				state.stack.push({});
+				let arr56 = [];
+				for (let i57 = 0; i57 < 2; i57++) {
+					hidden55.$index = i57;
+					let v58 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr56.push(v58);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk16 = arr56;
+				break;
+			}
+			case 23: {
+				let v59 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk17 = v59;
+				break;
+			}
+			case 24: {
+				let v60 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk18 = v60;
+				break;
+			}
+			case 25: {
+				let v61 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden62 = { $index: 0, $length: v61 };
+				state.hiddenstack.push(hidden62);
+				state.stack.push({});
+				let arr63 = [];
+				for (let i64 = 0; i64 < v61; i64++) {
+					hidden62.$index = i64;
+					let v65 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr63.push(v65);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk19 = arr63;
+				break;
+			}
+			case 26: {
+				obj0.unk1A = true;
+				break;
+			}
+			case 27: {
+				let v66 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk1B = v66;
+				break;
+			}
+			case 28: {
+				let obj67 = {};
+				let hidden68 = {};
+				state.stack.push(obj67);
+				state.hiddenstack.push(hidden68);
+				let v69 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v69 !== undefined) { obj67.unk0 = v69; }
+				let v70 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v70 !== undefined) { obj67.flags = v70; }
+				let v71 = ext[2].read(state);
+				if (v71 !== undefined) { obj67.unkmain = v71; }
+				let ref72 = state.stack[state.stack.length - 1].flags;
+				let match73 = -1;
+				if ((ref72 & 2) != 0) { match73 = 0; }
+				let v74 = null;
+				if (match73 != -1) {
+					let v75 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					v74 = v75;
+				}
+				if (v74 !== undefined) { obj67.opt2 = v74; }
+				let ref76 = state.stack[state.stack.length - 1].flags;
+				let match77 = -1;
+				if ((ref76 & 4) != 0) { match77 = 0; }
+				let v78 = null;
+				if (match77 != -1) {
+					let v79 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v78 = v79;
+				}
+				if (v78 !== undefined) { obj67.opt4 = v78; }
+				let ref80 = state.stack[state.stack.length - 1].flags;
+				let match81 = -1;
+				if ((ref80 & 8) != 0) { match81 = 0; }
+				let v82 = null;
+				if (match81 != -1) {
+					let v83 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					v82 = v83;
+				}
+				if (v82 !== undefined) { obj67.opt8 = v82; }
+				let ref84 = state.stack[state.stack.length - 1].flags;
+				let match85 = -1;
+				if ((ref84 & 16) != 0) { match85 = 0; }
+				let v86 = null;
+				if (match85 != -1) {
+					let v87 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v88 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let arr89 = [v87, v88];
+					v86 = arr89;
+				}
+				if (v86 !== undefined) { obj67.opt16 = v86; }
+				let v90 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v90 !== undefined) { obj67.unk2 = v90; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unk1C = obj67;
+				break;
+			}
+			case 29: {
+				let obj91 = {};
+				let hidden92 = {};
+				state.stack.push(obj91);
+				state.hiddenstack.push(hidden92);
+				let v93 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden94 = { $index: 0, $length: v93 };
+				state.hiddenstack.push(hidden94);
+				state.stack.push({});
+				let arr95 = [];
+				for (let i96 = 0; i96 < v93; i96++) {
+					hidden94.$index = i96;
+					let v97 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr95.push(v97);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr95 !== undefined) { obj91.unk1 = arr95; }
+				let v98 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v98 !== undefined) { obj91.unk2 = v98; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unk1D = obj91;
+				break;
+			}
+			case 30: {
+				obj0.unk1E = true;
+				break;
+			}
+			case 31: {
+				let hidden99 = { $index: 0, $length: 2 };
+				state.hiddenstack.push(hidden99);
+				state.stack.push({});
+				let arr100 = [];
+				for (let i101 = 0; i101 < 2; i101++) {
+					hidden99.$index = i101;
+					let v102 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr100.push(v102);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk1F = arr100;
+				break;
+			}
+			case 32: {
+				obj0.unk20 = true;
+				break;
+			}
+			case 33: {
+				obj0.unk21 = true;
+				break;
+			}
+			case 34: {
+				obj0.unk22 = true;
+				break;
+			}
+			case 35: {
+				let obj103 = {};
+				let hidden104 = {};
+				state.stack.push(obj103);
+				state.hiddenstack.push(hidden104);
+				let v105 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden106 = { $index: 0, $length: v105 };
+				state.hiddenstack.push(hidden106);
+				state.stack.push({});
+				let arr107 = [];
+				for (let i108 = 0; i108 < v105; i108++) {
+					hidden106.$index = i108;
+					let v109 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					let v110 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					let arr111 = [v109, v110];
+					arr107.push(arr111);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				if (arr107 !== undefined) { obj103.unk1 = arr107; }
+				let v112 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v112 !== undefined) { obj103.unk2 = v112; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unk23 = obj103;
+				break;
+			}
+			case 36: {
+				obj0.unk24 = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key113 in value) {
+		if (key113.startsWith("$")) { continue; }
+		switch (key113) {
+			case "unk01": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w114 = value[key113];
+				if (!Array.isArray(w114)) { throw new Error("array expected"); }
+				let w115 = w114.length;
+				if (w115 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w114.length });
+				for (let i116 = 0; i116 < w114.length; i116++) {
+					let w117 = w114[i116];
+					if (typeof w117 != "number" || w117 > 65535 || w117 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w117, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk02": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w118 = value[key113];
+				if (!Array.isArray(w118)) { throw new Error("array expected"); }
+				let w119 = w118.length;
+				if (w119 != 1) { throw new Error("expected constant 1 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w118.length });
+				for (let i120 = 0; i120 < w118.length; i120++) {
+					let w121 = w118[i120];
+					if (typeof w121 != "number" || w121 > 65535 || w121 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w121, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk03": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w122 = value[key113];
+				if (!Array.isArray(w122)) { throw new Error("array expected"); }
+				let w123 = w122.length;
+				if (w123 != 4) { throw new Error("expected constant 4 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w122.length });
+				for (let i124 = 0; i124 < w122.length; i124++) {
+					let w125 = w122[i124];
+					if (typeof w125 != "number" || w125 > 65535 || w125 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w125, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w126 = value[key113];
+				if (!Array.isArray(w126)) { throw new Error("array expected"); }
+				let w127 = w126.length;
+				if (w127 != 1) { throw new Error("expected constant 1 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w126.length });
+				for (let i128 = 0; i128 < w126.length; i128++) {
+					let w129 = w126[i128];
+					if (typeof w129 != "number" || w129 > 65535 || w129 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w129, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w130 = value[key113];
+				if (!Array.isArray(w130)) { throw new Error("array expected"); }
+				let w131 = w130.length;
+				if (w131 != 1) { throw new Error("expected constant 1 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w130.length });
+				for (let i132 = 0; i132 < w130.length; i132++) {
+					let w133 = w130[i132];
+					if (typeof w133 != "number" || w133 > 65535 || w133 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w133, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk06": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w134 = value[key113];
+				ext[0].write(state, w134);
+				break;
+			}
+			case "unk07": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w135 = value[key113];
+				if (!Array.isArray(w135)) { throw new Error("array expected"); }
+				let w136 = w135.length;
+				if (w136 != 2) { throw new Error("expected constant 2 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w135.length });
+				for (let i137 = 0; i137 < w135.length; i137++) {
+					let w138 = w135[i137];
+					if (typeof w138 != "number" || w138 > 65535 || w138 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w138, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w139 = value[key113];
+				if (!Array.isArray(w139)) { throw new Error("array expected"); }
+				let w140 = w139.length;
+				if (w140 != 2) { throw new Error("expected constant 2 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w139.length });
+				for (let i141 = 0; i141 < w139.length; i141++) {
+					let w142 = w139[i141];
+					if (typeof w142 != "number" || w142 > 65535 || w142 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w142, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk09": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w143 = value[key113];
+				if (!Array.isArray(w143)) { throw new Error("array expected"); }
+				let w144 = w143.length;
+				if (typeof w144 != "number" || w144 > 255 || w144 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w144, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w143.length });
+				for (let i145 = 0; i145 < w143.length; i145++) {
+					let w146 = w143[i145];
+					if (typeof w146 != "number" || w146 > 65535 || w146 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w146, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk0A": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w147 = value[key113];
+				if (!Array.isArray(w147)) { throw new Error("array expected"); }
+				let w148 = w147.length;
+				if (typeof w148 != "number" || w148 > 255 || w148 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w148, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w147.length });
+				for (let i149 = 0; i149 < w147.length; i149++) {
+					let w150 = w147[i149];
+					if (typeof w150 != "number" || w150 > 65535 || w150 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w150, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk0C": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w151 = value[key113];
+				if (typeof w151 != "number" || w151 > 255 || w151 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w151, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk0D": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w152 = value[key113];
+				if (typeof w152 != "number" || w152 > 255 || w152 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w152, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk0E": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w153 = value[key113];
+				if (typeof w153 != "number" || w153 > 65535 || w153 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w153, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk0F": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w154 = value[key113];
+				if (typeof w154 != "number" || w154 > 65535 || w154 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w154, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk10": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w155 = value[key113];
+				if (!Array.isArray(w155)) { throw new Error("array expected"); }
+				let w156 = w155[0];
+				if (typeof w156 != "number" || w156 > 255 || w156 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w156, state.scan);
+				state.scan += 1;
+				let w157 = w155[1];
+				if (typeof w157 != "number" || w157 > 32767 || w157 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w157, state.scan);
+				state.scan += 2;
+				let w158 = w155[2];
+				if (typeof w158 != "number" || w158 > 32767 || w158 < -32768) { throw new Error(); }
+				state.buffer.writeInt16BE(w158, state.scan);
+				state.scan += 2;
+				let w159 = w155[3];
+				if (typeof w159 != "number" || w159 > 255 || w159 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w159, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk12": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w160 = value[key113];
+				ext[1].write(state, w160);
+				break;
+			}
+			case "unk13": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w161 = value[key113];
+				if (typeof w161 != "number" || w161 > 255 || w161 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w161, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk14": {
+				if (typeof 20 != "number" || 20 > 255 || 20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(20, state.scan);
+				state.scan += 1;
+				let w162 = value[key113];
+				if (typeof w162 != "number" || w162 > 255 || w162 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w162, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk15": {
+				if (typeof 21 != "number" || 21 > 255 || 21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(21, state.scan);
+				state.scan += 1;
+				let w163 = value[key113];
+				if (typeof w163 != "number" || w163 > 255 || w163 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w163, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk16": {
+				if (typeof 22 != "number" || 22 > 255 || 22 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(22, state.scan);
+				state.scan += 1;
+				let w164 = value[key113];
+				if (!Array.isArray(w164)) { throw new Error("array expected"); }
+				let w165 = w164.length;
+				if (w165 != 2) { throw new Error("expected constant 2 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w164.length });
+				for (let i166 = 0; i166 < w164.length; i166++) {
+					let w167 = w164[i166];
+					if (typeof w167 != "number" || w167 > 65535 || w167 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w167, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk17": {
+				if (typeof 23 != "number" || 23 > 255 || 23 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(23, state.scan);
+				state.scan += 1;
+				let w168 = value[key113];
+				if (typeof w168 != "number" || w168 > 255 || w168 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w168, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk18": {
+				if (typeof 24 != "number" || 24 > 255 || 24 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(24, state.scan);
+				state.scan += 1;
+				let w169 = value[key113];
+				if (typeof w169 != "number" || w169 > 255 || w169 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w169, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk19": {
+				if (typeof 25 != "number" || 25 > 255 || 25 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(25, state.scan);
+				state.scan += 1;
+				let w170 = value[key113];
+				if (!Array.isArray(w170)) { throw new Error("array expected"); }
+				let w171 = w170.length;
+				if (typeof w171 != "number" || w171 > 255 || w171 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w171, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w170.length });
+				for (let i172 = 0; i172 < w170.length; i172++) {
+					let w173 = w170[i172];
+					if (typeof w173 != "number" || w173 > 65535 || w173 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w173, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk1A": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w174 = value[key113];
+				if (w174 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk1B": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w175 = value[key113];
+				if (typeof w175 != "number" || w175 > 65535 || w175 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w175, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk1C": {
+				if (typeof 28 != "number" || 28 > 255 || 28 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(28, state.scan);
+				state.scan += 1;
+				let w176 = value[key113];
+				if (typeof w176 != "object" || !w176) { throw new Error("object expected"); }
+				let hidden177 = {};
+				state.stack.push(w176);
+				state.hiddenstack.push(hidden177);
+				let w178 = w176.unk0;
+				if (typeof w178 != "number" || w178 > 255 || w178 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w178, state.scan);
+				state.scan += 1;
+				let w179 = w176.flags;
+				if (typeof w179 != "number" || w179 > 255 || w179 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w179, state.scan);
+				state.scan += 1;
+				let w180 = w176.unkmain;
+				ext[2].write(state, w180);
+				let w181 = w176.opt2;
+				if (w181 != null) {
+					if (typeof w181 != "number" || w181 > 255 || w181 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w181, state.scan);
+					state.scan += 1;
+				}
+				let w182 = w176.opt4;
+				if (w182 != null) {
+					if (typeof w182 != "number" || w182 > 65535 || w182 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w182, state.scan);
+					state.scan += 2;
+				}
+				let w183 = w176.opt8;
+				if (w183 != null) {
+					if (typeof w183 != "number" || w183 > 65535 || w183 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w183, state.scan);
+					state.scan += 2;
+				}
+				let w184 = w176.opt16;
+				if (w184 != null) {
+					if (!Array.isArray(w184)) { throw new Error("array expected"); }
+					let w185 = w184[0];
+					if (typeof w185 != "number" || w185 > 65535 || w185 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w185, state.scan);
+					state.scan += 2;
+					let w186 = w184[1];
+					if (typeof w186 != "number" || w186 > 255 || w186 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w186, state.scan);
+					state.scan += 1;
+				}
+				let w187 = w176.unk2;
+				if (typeof w187 != "number" || w187 > 65535 || w187 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w187, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk1D": {
+				if (typeof 29 != "number" || 29 > 255 || 29 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(29, state.scan);
+				state.scan += 1;
+				let w188 = value[key113];
+				if (typeof w188 != "object" || !w188) { throw new Error("object expected"); }
+				let hidden189 = {};
+				state.stack.push(w188);
+				state.hiddenstack.push(hidden189);
+				let w190 = w188.unk1;
+				if (!Array.isArray(w190)) { throw new Error("array expected"); }
+				let w191 = w190.length;
+				if (typeof w191 != "number" || w191 > 255 || w191 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w191, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w190.length });
+				for (let i192 = 0; i192 < w190.length; i192++) {
+					let w193 = w190[i192];
+					if (typeof w193 != "number" || w193 > 65535 || w193 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w193, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w194 = w188.unk2;
+				if (typeof w194 != "number" || w194 > 65535 || w194 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w194, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk1E": {
+				if (typeof 30 != "number" || 30 > 255 || 30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(30, state.scan);
+				state.scan += 1;
+				let w195 = value[key113];
+				if (w195 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk1F": {
+				if (typeof 31 != "number" || 31 > 255 || 31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(31, state.scan);
+				state.scan += 1;
+				let w196 = value[key113];
+				if (!Array.isArray(w196)) { throw new Error("array expected"); }
+				let w197 = w196.length;
+				if (w197 != 2) { throw new Error("expected constant 2 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w196.length });
+				for (let i198 = 0; i198 < w196.length; i198++) {
+					let w199 = w196[i198];
+					if (typeof w199 != "number" || w199 > 65535 || w199 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w199, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk20": {
+				if (typeof 32 != "number" || 32 > 255 || 32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(32, state.scan);
+				state.scan += 1;
+				let w200 = value[key113];
+				if (w200 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk21": {
+				if (typeof 33 != "number" || 33 > 255 || 33 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(33, state.scan);
+				state.scan += 1;
+				let w201 = value[key113];
+				if (w201 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk22": {
+				if (typeof 34 != "number" || 34 > 255 || 34 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(34, state.scan);
+				state.scan += 1;
+				let w202 = value[key113];
+				if (w202 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk23": {
+				if (typeof 35 != "number" || 35 > 255 || 35 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(35, state.scan);
+				state.scan += 1;
+				let w203 = value[key113];
+				if (typeof w203 != "object" || !w203) { throw new Error("object expected"); }
+				let hidden204 = {};
+				state.stack.push(w203);
+				state.hiddenstack.push(hidden204);
+				let w205 = w203.unk1;
+				if (!Array.isArray(w205)) { throw new Error("array expected"); }
+				let w206 = w205.length;
+				if (typeof w206 != "number" || w206 > 255 || w206 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w206, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w205.length });
+				for (let i207 = 0; i207 < w205.length; i207++) {
+					let w208 = w205[i207];
+					if (!Array.isArray(w208)) { throw new Error("array expected"); }
+					let w209 = w208[0];
+					if (typeof w209 != "number" || w209 > 32767 || w209 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w209, state.scan);
+					state.scan += 2;
+					let w210 = w208[1];
+					if (typeof w210 != "number" || w210 > 255 || w210 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w210, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				let w211 = w203.unk2;
+				if (typeof w211 != "number" || w211 > 65535 || w211 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w211, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk24": {
+				if (typeof 36 != "number" || 36 > 255 || 36 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(36, state.scan);
+				state.scan += 1;
+				let w212 = value[key113];
+				if (w212 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key113);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,203 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\particles_1.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x603f16b5;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v4 = state.view.getInt8(state.scan);
+				state.scan += 1;
+				let arr5 = [v3, v4];
+				obj0.unk01 = arr5;
+				break;
+			}
+			case 3: {
+				let hidden6 = { $index: 0, $length: 6 };
+				state.hiddenstack.push(hidden6);
+				state.stack.push({});
+				let arr7 = [];
+				for (let i8 = 0; i8 < 6; i8++) {
+					hidden6.$index = i8;
+					let v9 = state.view.getInt16(state.scan);
+					state.scan += 2;
+					arr7.push(v9);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unk03 = arr7;
+				break;
+			}
+			case 4: {
+				let obj10 = {};
+				let hidden11 = {};
+				state.stack.push(obj10);
+				state.hiddenstack.push(hidden11);
+				let v12 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				if (v12 !== undefined) { obj10.unk0 = v12; }
+				let v13 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v13 !== undefined) { obj10.unk1_0000 = v13; }
+				let v14 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				if (v14 !== undefined) { obj10.unk2 = v14; }
+				state.stack.pop();
+				state.hiddenstack.pop();
+				obj0.unk04 = obj10;
+				break;
+			}
+			case 6: {
+				let v15 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unk06 = v15;
+				break;
+			}
+			case 8: {
+				obj0.unk08 = true;
+				break;
+			}
+			case 9: {
+				obj0.unk09 = true;
+				break;
+			}
+			case 10: {
+				obj0.unk0A = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key16 in value) {
+		if (key16.startsWith("$")) { continue; }
+		switch (key16) {
+			case "unk01": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w17 = value[key16];
+				if (!Array.isArray(w17)) { throw new Error("array expected"); }
+				let w18 = w17[0];
+				if (typeof w18 != "number" || w18 > 255 || w18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w18, state.scan);
+				state.scan += 1;
+				let w19 = w17[1];
+				if (typeof w19 != "number" || w19 > 127 || w19 < -128) { throw new Error(); }
+				state.buffer.writeInt8(w19, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk03": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w20 = value[key16];
+				if (!Array.isArray(w20)) { throw new Error("array expected"); }
+				let w21 = w20.length;
+				if (w21 != 6) { throw new Error("expected constant 6 was not present during write"); }
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w20.length });
+				for (let i22 = 0; i22 < w20.length; i22++) {
+					let w23 = w20[i22];
+					if (typeof w23 != "number" || w23 > 32767 || w23 < -32768) { throw new Error(); }
+					state.buffer.writeInt16BE(w23, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w24 = value[key16];
+				if (typeof w24 != "object" || !w24) { throw new Error("object expected"); }
+				let hidden25 = {};
+				state.stack.push(w24);
+				state.hiddenstack.push(hidden25);
+				let w26 = w24.unk0;
+				if (typeof w26 != "number" || w26 > 255 || w26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w26, state.scan);
+				state.scan += 1;
+				let w27 = w24.unk1_0000;
+				if (typeof w27 != "number" || w27 > 65535 || w27 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w27, state.scan);
+				state.scan += 2;
+				let w28 = w24.unk2;
+				if (typeof w28 != "number" || w28 > 65535 || w28 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w28, state.scan);
+				state.scan += 2;
+				state.stack.pop();
+				state.hiddenstack.pop();
+				break;
+			}
+			case "unk06": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w29 = value[key16];
+				if (typeof w29 != "number" || w29 > 255 || w29 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w29, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w30 = value[key16];
+				if (w30 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk09": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w31 = value[key16];
+				if (w31 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unk0A": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w32 = value[key16];
+				if (w32 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key16);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
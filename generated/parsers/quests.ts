@@ -0,0 +1,561 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\quests.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x64452bb4;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.name = v3;
+				break;
+			}
+			case 2: {
+				let v4 = ext[0].read(state);
+				obj0.quest_list_name = v4;
+				break;
+			}
+			case 3: {
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden6 = { $index: 0, $length: v5 };
+				state.hiddenstack.push(hidden6);
+				state.stack.push({});
+				let arr7 = [];
+				for (let i8 = 0; i8 < v5; i8++) {
+					hidden6.$index = i8;
+					let obj9 = {};
+					let hidden10 = {};
+					state.stack.push(obj9);
+					state.hiddenstack.push(hidden10);
+					let v11 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v11 !== undefined) { obj9.varp = v11; }
+					let v12 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					if (v12 !== undefined) { obj9.startvalue = v12; }
+					let v13 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					if (v13 !== undefined) { obj9.endvalue = v13; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr7.push(obj9);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.varps = arr7;
+				break;
+			}
+			case 4: {
+				let v14 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden15 = { $index: 0, $length: v14 };
+				state.hiddenstack.push(hidden15);
+				state.stack.push({});
+				let arr16 = [];
+				for (let i17 = 0; i17 < v14; i17++) {
+					hidden15.$index = i17;
+					let obj18 = {};
+					let hidden19 = {};
+					state.stack.push(obj18);
+					state.hiddenstack.push(hidden19);
+					let v20 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v20 !== undefined) { obj18.varbit = v20; }
+					let v21 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					if (v21 !== undefined) { obj18.startvalue = v21; }
+					let v22 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					if (v22 !== undefined) { obj18.endvalue = v22; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr16.push(obj18);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.varbits = arr16;
+				break;
+			}
+			case 5: {
+				let v23 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.subquest_of = v23;
+				break;
+			}
+			case 6: {
+				let v24 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.discontinued_status = v24;
+				break;
+			}
+			case 7: {
+				let v25 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.quest_difficulty = v25;
+				break;
+			}
+			case 8: {
+				obj0.members = true;
+				break;
+			}
+			case 9: {
+				let v26 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.quest_points = v26;
+				break;
+			}
+			case 10: {
+				let v27 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden28 = { $index: 0, $length: v27 };
+				state.hiddenstack.push(hidden28);
+				state.stack.push({});
+				let arr29 = [];
+				for (let i30 = 0; i30 < v27; i30++) {
+					hidden28.$index = i30;
+					let v31 = state.view.getInt32(state.scan);
+					state.scan += 4;
+					arr29.push(v31);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.start_location_path = arr29;
+				break;
+			}
+			case 12: {
+				let v32 = state.view.getInt32(state.scan);
+				state.scan += 4;
+				obj0.alternate_quest_start = v32;
+				break;
+			}
+			case 13: {
+				let v33 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden34 = { $index: 0, $length: v33 };
+				state.hiddenstack.push(hidden34);
+				state.stack.push({});
+				let arr35 = [];
+				for (let i36 = 0; i36 < v33; i36++) {
+					hidden34.$index = i36;
+					let v37 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr35.push(v37);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.required_quests = arr35;
+				break;
+			}
+			case 14: {
+				let v38 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden39 = { $index: 0, $length: v38 };
+				state.hiddenstack.push(hidden39);
+				state.stack.push({});
+				let arr40 = [];
+				for (let i41 = 0; i41 < v38; i41++) {
+					hidden39.$index = i41;
+					let obj42 = {};
+					let hidden43 = {};
+					state.stack.push(obj42);
+					state.hiddenstack.push(hidden43);
+					let v44 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v44 !== undefined) { obj42.skill = v44; }
+					let v45 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v45 !== undefined) { obj42.level = v45; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr40.push(obj42);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.skill_requirements = arr40;
+				break;
+			}
+			case 15: {
+				let v46 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.quest_point_req = v46;
+				break;
+			}
+			case 17: {
+				let v47 = ext[1].read(state);
+				obj0.quest_item_sprite = v47;
+				break;
+			}
+			case 249: {
+				let v48 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden49 = { $index: 0, $length: v48 };
+				state.hiddenstack.push(hidden49);
+				state.stack.push({});
+				let arr50 = [];
+				for (let i51 = 0; i51 < v48; i51++) {
+					hidden49.$index = i51;
+					let obj52 = {};
+					let hidden53 = {};
+					state.stack.push(obj52);
+					state.hiddenstack.push(hidden53);
+					let v54 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v54 !== undefined) { hidden53.$type = v54; }
+					let v55 = ext[2].read(state);
+					if (v55 !== undefined) { obj52.prop = v55; }
+					let ref56 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match57 = -1;
+					if (ref56 == 0) { match57 = 0; }
+					let v58 = null;
+					if (match57 != -1) {
+						let v59 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v58 = v59;
+					}
+					if (v58 !== undefined) { obj52.intvalue = v58; }
+					let ref60 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match61 = -1;
+					if (ref60 == 1) { match61 = 0; }
+					let v62 = null;
+					if (match61 != -1) {
+						let v63 = ext[3].read(state);
+						v62 = v63;
+					}
+					if (v62 !== undefined) { obj52.stringvalue = v62; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr50.push(obj52);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr50;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key64 in value) {
+		if (key64.startsWith("$")) { continue; }
+		switch (key64) {
+			case "name": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w65 = value[key64];
+				ext[0].write(state, w65);
+				break;
+			}
+			case "quest_list_name": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w66 = value[key64];
+				ext[0].write(state, w66);
+				break;
+			}
+			case "varps": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w67 = value[key64];
+				if (!Array.isArray(w67)) { throw new Error("array expected"); }
+				let w68 = w67.length;
+				if (typeof w68 != "number" || w68 > 255 || w68 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w68, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w67.length });
+				for (let i69 = 0; i69 < w67.length; i69++) {
+					let w70 = w67[i69];
+					if (typeof w70 != "object" || !w70) { throw new Error("object expected"); }
+					let hidden71 = {};
+					state.stack.push(w70);
+					state.hiddenstack.push(hidden71);
+					let w72 = w70.varp;
+					if (typeof w72 != "number" || w72 > 65535 || w72 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w72, state.scan);
+					state.scan += 2;
+					let w73 = w70.startvalue;
+					if (typeof w73 != "number" || w73 > 2147483647 || w73 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w73, state.scan);
+					state.scan += 4;
+					let w74 = w70.endvalue;
+					if (typeof w74 != "number" || w74 > 2147483647 || w74 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w74, state.scan);
+					state.scan += 4;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "varbits": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w75 = value[key64];
+				if (!Array.isArray(w75)) { throw new Error("array expected"); }
+				let w76 = w75.length;
+				if (typeof w76 != "number" || w76 > 255 || w76 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w76, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w75.length });
+				for (let i77 = 0; i77 < w75.length; i77++) {
+					let w78 = w75[i77];
+					if (typeof w78 != "object" || !w78) { throw new Error("object expected"); }
+					let hidden79 = {};
+					state.stack.push(w78);
+					state.hiddenstack.push(hidden79);
+					let w80 = w78.varbit;
+					if (typeof w80 != "number" || w80 > 65535 || w80 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w80, state.scan);
+					state.scan += 2;
+					let w81 = w78.startvalue;
+					if (typeof w81 != "number" || w81 > 2147483647 || w81 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w81, state.scan);
+					state.scan += 4;
+					let w82 = w78.endvalue;
+					if (typeof w82 != "number" || w82 > 2147483647 || w82 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w82, state.scan);
+					state.scan += 4;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "subquest_of": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w83 = value[key64];
+				if (typeof w83 != "number" || w83 > 65535 || w83 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w83, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "discontinued_status": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w84 = value[key64];
+				if (typeof w84 != "number" || w84 > 255 || w84 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w84, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "quest_difficulty": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w85 = value[key64];
+				if (typeof w85 != "number" || w85 > 255 || w85 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w85, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "members": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w86 = value[key64];
+				if (w86 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "quest_points": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w87 = value[key64];
+				if (typeof w87 != "number" || w87 > 255 || w87 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w87, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "start_location_path": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w88 = value[key64];
+				if (!Array.isArray(w88)) { throw new Error("array expected"); }
+				let w89 = w88.length;
+				if (typeof w89 != "number" || w89 > 255 || w89 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w89, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w88.length });
+				for (let i90 = 0; i90 < w88.length; i90++) {
+					let w91 = w88[i90];
+					if (typeof w91 != "number" || w91 > 2147483647 || w91 < -2147483648) { throw new Error(); }
+					state.buffer.writeInt32BE(w91, state.scan);
+					state.scan += 4;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "alternate_quest_start": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w92 = value[key64];
+				if (typeof w92 != "number" || w92 > 2147483647 || w92 < -2147483648) { throw new Error(); }
+				state.buffer.writeInt32BE(w92, state.scan);
+				state.scan += 4;
+				break;
+			}
+			case "required_quests": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w93 = value[key64];
+				if (!Array.isArray(w93)) { throw new Error("array expected"); }
+				let w94 = w93.length;
+				if (typeof w94 != "number" || w94 > 255 || w94 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w94, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w93.length });
+				for (let i95 = 0; i95 < w93.length; i95++) {
+					let w96 = w93[i95];
+					if (typeof w96 != "number" || w96 > 65535 || w96 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w96, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "skill_requirements": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w97 = value[key64];
+				if (!Array.isArray(w97)) { throw new Error("array expected"); }
+				let w98 = w97.length;
+				if (typeof w98 != "number" || w98 > 255 || w98 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w98, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w97.length });
+				for (let i99 = 0; i99 < w97.length; i99++) {
+					let w100 = w97[i99];
+					if (typeof w100 != "object" || !w100) { throw new Error("object expected"); }
+					let hidden101 = {};
+					state.stack.push(w100);
+					state.hiddenstack.push(hidden101);
+					let w102 = w100.skill;
+					if (typeof w102 != "number" || w102 > 255 || w102 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w102, state.scan);
+					state.scan += 1;
+					let w103 = w100.level;
+					if (typeof w103 != "number" || w103 > 255 || w103 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w103, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "quest_point_req": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w104 = value[key64];
+				if (typeof w104 != "number" || w104 > 65535 || w104 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w104, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "quest_item_sprite": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w105 = value[key64];
+				ext[1].write(state, w105);
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w106 = value[key64];
+				if (!Array.isArray(w106)) { throw new Error("array expected"); }
+				let w107 = w106.length;
+				if (typeof w107 != "number" || w107 > 255 || w107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w107, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w106.length });
+				for (let i108 = 0; i108 < w106.length; i108++) {
+					let w109 = w106[i108];
+					if (typeof w109 != "object" || !w109) { throw new Error("object expected"); }
+					let hidden110 = {};
+					state.stack.push(w109);
+					state.hiddenstack.push(hidden110);
+					let w111 = w109.$type;
+					w111 ??= 0;
+					w111 = ext[4].resolve(w109, w111);
+					w111 = ext[5].resolve(w109, w111);
+					hidden110.$type = w111;
+					if (typeof w111 != "number" || w111 > 255 || w111 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w111, state.scan);
+					state.scan += 1;
+					let w112 = w109.prop;
+					ext[2].write(state, w112);
+					let w113 = w109.intvalue;
+					if (w113 != null) {
+						if (typeof w113 != "number" || w113 > 2147483647 || w113 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w113, state.scan);
+						state.scan += 4;
+					}
+					let w114 = w109.stringvalue;
+					if (w114 != null) {
+						ext[3].write(state, w114);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key64);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,193 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\quickchatcategories.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xf6a3637c;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.text = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden5 = { $index: 0, $length: v4 };
+				state.hiddenstack.push(hidden5);
+				state.stack.push({});
+				let arr6 = [];
+				for (let i7 = 0; i7 < v4; i7++) {
+					hidden5.$index = i7;
+					let obj8 = {};
+					let hidden9 = {};
+					state.stack.push(obj8);
+					state.hiddenstack.push(hidden9);
+					let v10 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v10 !== undefined) { obj8.id = v10; }
+					let v11 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v11 !== undefined) { obj8.hotkey = v11; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr6.push(obj8);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.subcategories = arr6;
+				break;
+			}
+			case 3: {
+				let v12 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden13 = { $index: 0, $length: v12 };
+				state.hiddenstack.push(hidden13);
+				state.stack.push({});
+				let arr14 = [];
+				for (let i15 = 0; i15 < v12; i15++) {
+					hidden13.$index = i15;
+					let obj16 = {};
+					let hidden17 = {};
+					state.stack.push(obj16);
+					state.hiddenstack.push(hidden17);
+					let v18 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v18 !== undefined) { obj16.id = v18; }
+					let v19 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v19 !== undefined) { obj16.hotkey = v19; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr14.push(obj16);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.lines = arr14;
+				break;
+			}
+			case 4: {
+				obj0.nonsearchable = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key20 in value) {
+		if (key20.startsWith("$")) { continue; }
+		switch (key20) {
+			case "text": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w21 = value[key20];
+				ext[0].write(state, w21);
+				break;
+			}
+			case "subcategories": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w22 = value[key20];
+				if (!Array.isArray(w22)) { throw new Error("array expected"); }
+				let w23 = w22.length;
+				if (typeof w23 != "number" || w23 > 255 || w23 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w23, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w22.length });
+				for (let i24 = 0; i24 < w22.length; i24++) {
+					let w25 = w22[i24];
+					if (typeof w25 != "object" || !w25) { throw new Error("object expected"); }
+					let hidden26 = {};
+					state.stack.push(w25);
+					state.hiddenstack.push(hidden26);
+					let w27 = w25.id;
+					if (typeof w27 != "number" || w27 > 65535 || w27 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w27, state.scan);
+					state.scan += 2;
+					let w28 = w25.hotkey;
+					if (typeof w28 != "number" || w28 > 255 || w28 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w28, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "lines": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w29 = value[key20];
+				if (!Array.isArray(w29)) { throw new Error("array expected"); }
+				let w30 = w29.length;
+				if (typeof w30 != "number" || w30 > 255 || w30 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w30, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w29.length });
+				for (let i31 = 0; i31 < w29.length; i31++) {
+					let w32 = w29[i31];
+					if (typeof w32 != "object" || !w32) { throw new Error("object expected"); }
+					let hidden33 = {};
+					state.stack.push(w32);
+					state.hiddenstack.push(hidden33);
+					let w34 = w32.id;
+					if (typeof w34 != "number" || w34 > 65535 || w34 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w34, state.scan);
+					state.scan += 2;
+					let w35 = w32.hotkey;
+					if (typeof w35 != "number" || w35 > 255 || w35 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w35, state.scan);
+					state.scan += 1;
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "nonsearchable": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w36 = value[key20];
+				if (w36 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key20);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,404 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\quickchatlines.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x398446d4;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.text = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden5 = { $index: 0, $length: v4 };
+				state.hiddenstack.push(hidden5);
+				state.stack.push({});
+				let arr6 = [];
+				for (let i7 = 0; i7 < v4; i7++) {
+					hidden5.$index = i7;
+					let v8 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					arr6.push(v8);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.replies = arr6;
+				break;
+			}
+			case 3: {
+				let v9 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden10 = { $index: 0, $length: v9 };
+				state.hiddenstack.push(hidden10);
+				state.stack.push({});
+				let arr11 = [];
+				for (let i12 = 0; i12 < v9; i12++) {
+					hidden10.$index = i12;
+					let obj13 = {};
+					let hidden14 = {};
+					state.stack.push(obj13);
+					state.hiddenstack.push(hidden14);
+					let v15 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					if (v15 !== undefined) { obj13.type = v15; }
+					let ref16 = state.stack[state.stack.length - 1].type;
+					let match17 = -1;
+					if (ref16 == 0) { match17 = 0; }
+					let v18 = null;
+					if (match17 != -1) {
+						let v19 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v18 = v19;
+					}
+					if (v18 !== undefined) { obj13.pickEnum = v18; }
+					let ref20 = state.stack[state.stack.length - 1].type;
+					let match21 = -1;
+					if (ref20 == 1) { match21 = 0; }
+					let v22 = null;
+					if (match21 != -1) {
+						v22 = true;
+					}
+					if (v22 !== undefined) { obj13.pickTtem = v22; }
+					let ref23 = state.stack[state.stack.length - 1].type;
+					let match24 = -1;
+					if (ref23 == 4) { match24 = 0; }
+					let v25 = null;
+					if (match24 != -1) {
+						let v26 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v25 = v26;
+					}
+					if (v25 !== undefined) { obj13.skillLevel = v25; }
+					let ref27 = state.stack[state.stack.length - 1].type;
+					let match28 = -1;
+					if (ref27 == 6) { match28 = 0; }
+					let v29 = null;
+					if (match28 != -1) {
+						let obj30 = {};
+						let hidden31 = {};
+						state.stack.push(obj30);
+						state.hiddenstack.push(hidden31);
+						let v32 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v32 !== undefined) { obj30.enum = v32; }
+						let v33 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v33 !== undefined) { obj30.varbit = v33; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v29 = obj30;
+					}
+					if (v29 !== undefined) { obj13.varplayerEnum = v29; }
+					let ref34 = state.stack[state.stack.length - 1].type;
+					let match35 = -1;
+					if (ref34 == 8) { match35 = 0; }
+					let v36 = null;
+					if (match35 != -1) {
+						let v37 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v36 = v37;
+					}
+					if (v36 !== undefined) { obj13.varplayer = v36; }
+					let ref38 = state.stack[state.stack.length - 1].type;
+					let match39 = -1;
+					if (ref38 == 9) { match39 = 0; }
+					let v40 = null;
+					if (match39 != -1) {
+						let v41 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v40 = v41;
+					}
+					if (v40 !== undefined) { obj13.varbit = v40; }
+					let ref42 = state.stack[state.stack.length - 1].type;
+					let match43 = -1;
+					if (ref42 == 10) { match43 = 0; }
+					let v44 = null;
+					if (match43 != -1) {
+						v44 = true;
+					}
+					if (v44 !== undefined) { obj13.pickTradeableItem = v44; }
+					let ref45 = state.stack[state.stack.length - 1].type;
+					let match46 = -1;
+					if (ref45 == 11) { match46 = 0; }
+					let v47 = null;
+					if (match46 != -1) {
+						let obj48 = {};
+						let hidden49 = {};
+						state.stack.push(obj48);
+						state.hiddenstack.push(hidden49);
+						let v50 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v50 !== undefined) { obj48.enum = v50; }
+						let v51 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v51 !== undefined) { obj48.skill = v51; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v47 = obj48;
+					}
+					if (v47 !== undefined) { obj13.skillLevelEnum = v47; }
+					let ref52 = state.stack[state.stack.length - 1].type;
+					let match53 = -1;
+					if (ref52 == 12) { match53 = 0; }
+					let v54 = null;
+					if (match53 != -1) {
+						v54 = true;
+					}
+					if (v54 !== undefined) { obj13.friendsChatCount = v54; }
+					let ref55 = state.stack[state.stack.length - 1].type;
+					let match56 = -1;
+					if (ref55 == 14) { match56 = 0; }
+					let v57 = null;
+					if (match56 != -1) {
+						let v58 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v57 = v58;
+					}
+					if (v57 !== undefined) { obj13.varWorld = v57; }
+					let ref59 = state.stack[state.stack.length - 1].type;
+					let match60 = -1;
+					if (ref59 == 15) { match60 = 0; }
+					let v61 = null;
+					if (match60 != -1) {
+						v61 = true;
+					}
+					if (v61 !== undefined) { obj13.combatlevel = v61; }
+					let ref62 = state.stack[state.stack.length - 1].type;
+					let match63 = -1;
+					if (ref62 == 16) { match63 = 0; }
+					let v64 = null;
+					if (match63 != -1) {
+						let obj65 = {};
+						let hidden66 = {};
+						state.stack.push(obj65);
+						state.hiddenstack.push(hidden66);
+						let v67 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v67 !== undefined) { obj65.enum = v67; }
+						let v68 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						if (v68 !== undefined) { obj65.varbit = v68; }
+						state.stack.pop();
+						state.hiddenstack.pop();
+						v64 = obj65;
+					}
+					if (v64 !== undefined) { obj13.varbitEnumstring = v64; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr11.push(obj13);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.inserts = arr11;
+				break;
+			}
+			case 4: {
+				obj0.nonsearchable = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key69 in value) {
+		if (key69.startsWith("$")) { continue; }
+		switch (key69) {
+			case "text": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w70 = value[key69];
+				ext[0].write(state, w70);
+				break;
+			}
+			case "replies": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w71 = value[key69];
+				if (!Array.isArray(w71)) { throw new Error("array expected"); }
+				let w72 = w71.length;
+				if (typeof w72 != "number" || w72 > 255 || w72 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w72, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w71.length });
+				for (let i73 = 0; i73 < w71.length; i73++) {
+					let w74 = w71[i73];
+					if (typeof w74 != "number" || w74 > 65535 || w74 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w74, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "inserts": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w75 = value[key69];
+				if (!Array.isArray(w75)) { throw new Error("array expected"); }
+				let w76 = w75.length;
+				if (typeof w76 != "number" || w76 > 255 || w76 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w76, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w75.length });
+				for (let i77 = 0; i77 < w75.length; i77++) {
+					let w78 = w75[i77];
+					if (typeof w78 != "object" || !w78) { throw new Error("object expected"); }
+					let hidden79 = {};
+					state.stack.push(w78);
+					state.hiddenstack.push(hidden79);
+					let w80 = w78.type;
+					if (typeof w80 != "number" || w80 > 65535 || w80 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w80, state.scan);
+					state.scan += 2;
+					let w81 = w78.pickEnum;
+					if (w81 != null) {
+						if (typeof w81 != "number" || w81 > 65535 || w81 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w81, state.scan);
+						state.scan += 2;
+					}
+					let w82 = w78.pickTtem;
+					if (w82 != null) {
+						if (w82 != true) { throw new Error("expected constant true was not present during write"); }
+					}
+					let w83 = w78.skillLevel;
+					if (w83 != null) {
+						if (typeof w83 != "number" || w83 > 65535 || w83 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w83, state.scan);
+						state.scan += 2;
+					}
+					let w84 = w78.varplayerEnum;
+					if (w84 != null) {
+						if (typeof w84 != "object" || !w84) { throw new Error("object expected"); }
+						let hidden85 = {};
+						state.stack.push(w84);
+						state.hiddenstack.push(hidden85);
+						let w86 = w84.enum;
+						if (typeof w86 != "number" || w86 > 65535 || w86 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w86, state.scan);
+						state.scan += 2;
+						let w87 = w84.varbit;
+						if (typeof w87 != "number" || w87 > 65535 || w87 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w87, state.scan);
+						state.scan += 2;
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					let w88 = w78.varplayer;
+					if (w88 != null) {
+						if (typeof w88 != "number" || w88 > 65535 || w88 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w88, state.scan);
+						state.scan += 2;
+					}
+					let w89 = w78.varbit;
+					if (w89 != null) {
+						if (typeof w89 != "number" || w89 > 65535 || w89 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w89, state.scan);
+						state.scan += 2;
+					}
+					let w90 = w78.pickTradeableItem;
+					if (w90 != null) {
+						if (w90 != true) { throw new Error("expected constant true was not present during write"); }
+					}
+					let w91 = w78.skillLevelEnum;
+					if (w91 != null) {
+						if (typeof w91 != "object" || !w91) { throw new Error("object expected"); }
+						let hidden92 = {};
+						state.stack.push(w91);
+						state.hiddenstack.push(hidden92);
+						let w93 = w91.enum;
+						if (typeof w93 != "number" || w93 > 65535 || w93 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w93, state.scan);
+						state.scan += 2;
+						let w94 = w91.skill;
+						if (typeof w94 != "number" || w94 > 65535 || w94 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w94, state.scan);
+						state.scan += 2;
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					let w95 = w78.friendsChatCount;
+					if (w95 != null) {
+						if (w95 != true) { throw new Error("expected constant true was not present during write"); }
+					}
+					let w96 = w78.varWorld;
+					if (w96 != null) {
+						if (typeof w96 != "number" || w96 > 65535 || w96 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w96, state.scan);
+						state.scan += 2;
+					}
+					let w97 = w78.combatlevel;
+					if (w97 != null) {
+						if (w97 != true) { throw new Error("expected constant true was not present during write"); }
+					}
+					let w98 = w78.varbitEnumstring;
+					if (w98 != null) {
+						if (typeof w98 != "object" || !w98) { throw new Error("object expected"); }
+						let hidden99 = {};
+						state.stack.push(w98);
+						state.hiddenstack.push(hidden99);
+						let w100 = w98.enum;
+						if (typeof w100 != "number" || w100 > 65535 || w100 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w100, state.scan);
+						state.scan += 2;
+						let w101 = w98.varbit;
+						if (typeof w101 != "number" || w101 > 65535 || w101 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w101, state.scan);
+						state.scan += 2;
+						state.stack.pop();
+						state.hiddenstack.pop();
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "nonsearchable": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w102 = value[key69];
+				if (w102 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key69);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,214 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\rootcacheindex.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x192ff66e;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	if (-1 !== undefined) { hidden1.$minorindex = -1; }
+	let hidden2 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden2);
+	let v3 = ext[0].read(state);
+	hidden2.$opcode = v3;
+	let ref4 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match5 = -1;
+	if (ref4 >= 605) { match5 = 0; }
+	else if (true) { match5 = 1; }
+	if (match5 == -1) { throw new Error("no opcode matched"); }
+	let v6;
+	if (match5 == 0) {
+		let v7 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		let hidden8 = { $index: 0, $length: v7 };
+		state.hiddenstack.push(hidden8);
+		state.stack.push({});
+		let arr9 = [];
+		for (let i10 = 0; i10 < v7; i10++) {
+			hidden8.$index = i10;
+			let obj11 = {};
+			let hidden12 = {};
+			state.stack.push(obj11);
+			state.hiddenstack.push(hidden12);
+			let v13 = ext[1].read(state);
+			if (v13 !== undefined) { obj11.minor = v13; }
+			let v14 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v14 !== undefined) { obj11.crc = v14; }
+			let v15 = state.view.getUint32(state.scan);
+			state.scan += 4;
+			if (v15 !== undefined) { obj11.version = v15; }
+			let hidden16 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden16);
+			let v17 = ext[2].read(state);
+			hidden16.$opcode = v17;
+			let ref18 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match19 = -1;
+			if (ref18 >= 816) { match19 = 0; }
+			else if (true) { match19 = 1; }
+			if (match19 == -1) { throw new Error("no opcode matched"); }
+			let v20;
+			if (match19 == 0) {
+				let v21 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				v20 = v21;
+			}
+			else if (match19 == 1) {
+				v20 = 0;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			if (v20 !== undefined) { obj11.subindexcount = v20; }
+			let hidden22 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden22);
+			let v23 = ext[3].read(state);
+			hidden22.$opcode = v23;
+			let ref24 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match25 = -1;
+			if (ref24 >= 816) { match25 = 0; }
+			else if (true) { match25 = 1; }
+			if (match25 == -1) { throw new Error("no opcode matched"); }
+			let v26;
+			if (match25 == 0) {
+				let v27 = state.view.getUint32(state.scan);
+				state.scan += 4;
+				v26 = v27;
+			}
+			else if (match25 == 1) {
+				v26 = 0;
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			if (v26 !== undefined) { obj11.integer_10 = v26; }
+			let v28 = ext[4].read(state);
+			if (v28 !== undefined) { obj11.maybe_checksum1 = v28; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr9.push(obj11);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		v6 = arr9;
+	}
+	else if (match5 == 1) {
+		let v29 = ext[5].read(state);
+		v6 = v29;
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	if (v6 !== undefined) { obj0.cachemajors = v6; }
+	let v30 = ext[6].read(state);
+	if (v30 !== undefined) { obj0.maybe_proper_checksum = v30; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden31 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden31);
+	let w32 = value.$minorindex;
+	w32 = ext[7].readConst(state);
+	hidden31.$minorindex = w32;
+	if (w32 != -1) { throw new Error("expected constant -1 was not present during write"); }
+	let w33 = value.cachemajors;
+	let hidden34 = { $opcode: 0 };
+	state.stack.push({});
+	state.hiddenstack.push(hidden34);
+	hidden34.$opcode = ext[0].readConst(state);
+	let ref35 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+	let match36 = -1;
+	if (ref35 >= 605) { match36 = 0; }
+	else if (true) { match36 = 1; }
+	if (match36 == -1) { throw new Error("no opcode matched"); }
+	if (match36 == 0) {
+		if (!Array.isArray(w33)) { throw new Error("array expected"); }
+		let w37 = w33.length;
+		if (typeof w37 != "number" || w37 > 255 || w37 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w37, state.scan);
+		state.scan += 1;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w33.length });
+		for (let i38 = 0; i38 < w33.length; i38++) {
+			let w39 = w33[i38];
+			if (typeof w39 != "object" || !w39) { throw new Error("object expected"); }
+			let hidden40 = {};
+			state.stack.push(w39);
+			state.hiddenstack.push(hidden40);
+			let w41 = w39.minor;
+			ext[1].write(state, w41);
+			let w42 = w39.crc;
+			if (typeof w42 != "number" || w42 > 4294967295 || w42 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w42, state.scan);
+			state.scan += 4;
+			let w43 = w39.version;
+			if (typeof w43 != "number" || w43 > 4294967295 || w43 < 0) { throw new Error(); }
+			state.buffer.writeUInt32BE(w43, state.scan);
+			state.scan += 4;
+			let w44 = w39.subindexcount;
+			let hidden45 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden45);
+			hidden45.$opcode = ext[2].readConst(state);
+			let ref46 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match47 = -1;
+			if (ref46 >= 816) { match47 = 0; }
+			else if (true) { match47 = 1; }
+			if (match47 == -1) { throw new Error("no opcode matched"); }
+			if (match47 == 0) {
+				if (typeof w44 != "number" || w44 > 4294967295 || w44 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w44, state.scan);
+				state.scan += 4;
+			}
+			else if (match47 == 1) {
+				if (w44 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			let w48 = w39.integer_10;
+			let hidden49 = { $opcode: 0 };
+			state.stack.push({});
+			state.hiddenstack.push(hidden49);
+			hidden49.$opcode = ext[3].readConst(state);
+			let ref50 = state.hiddenstack[state.hiddenstack.length - 1].$opcode;
+			let match51 = -1;
+			if (ref50 >= 816) { match51 = 0; }
+			else if (true) { match51 = 1; }
+			if (match51 == -1) { throw new Error("no opcode matched"); }
+			if (match51 == 0) {
+				if (typeof w48 != "number" || w48 > 4294967295 || w48 < 0) { throw new Error(); }
+				state.buffer.writeUInt32BE(w48, state.scan);
+				state.scan += 4;
+			}
+			else if (match51 == 1) {
+				if (w48 != 0) { throw new Error("expected constant 0 was not present during write"); }
+			}
+			state.stack.pop();
+			state.hiddenstack.pop();
+			let w52 = w39.maybe_checksum1;
+			ext[4].write(state, w52);
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+	}
+	else if (match36 == 1) {
+		ext[5].write(state, w33);
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	let w53 = value.maybe_proper_checksum;
+	ext[6].write(state, w53);
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
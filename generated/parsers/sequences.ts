@@ -0,0 +1,713 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\sequences.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xd5f0f13b;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.frames = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_02 = v4;
+				break;
+			}
+			case 3: {
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden6 = { $index: 0, $length: v5 };
+				state.hiddenstack.push(hidden6);
+				state.stack.push({});
+				let arr7 = [];
+				for (let i8 = 0; i8 < v5; i8++) {
+					hidden6.$index = i8;
+					let v9 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					arr7.push(v9);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unknown_03 = arr7;
+				break;
+			}
+			case 4: {
+				obj0.unknown_04 = true;
+				break;
+			}
+			case 5: {
+				let v10 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_05 = v10;
+				break;
+			}
+			case 6: {
+				let v11 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_06 = v11;
+				break;
+			}
+			case 7: {
+				let v12 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_07 = v12;
+				break;
+			}
+			case 8: {
+				let v13 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_08 = v13;
+				break;
+			}
+			case 9: {
+				let v14 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_09 = v14;
+				break;
+			}
+			case 10: {
+				let v15 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0A = v15;
+				break;
+			}
+			case 11: {
+				let v16 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_0B = v16;
+				break;
+			}
+			case 12: {
+				let v17 = ext[1].read(state);
+				obj0.unknown_0C = v17;
+				break;
+			}
+			case 13: {
+				let v18 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let hidden19 = { $index: 0, $length: v18 };
+				state.hiddenstack.push(hidden19);
+				state.stack.push({});
+				let arr20 = [];
+				for (let i21 = 0; i21 < v18; i21++) {
+					hidden19.$index = i21;
+					let obj22 = {};
+					let hidden23 = {};
+					state.stack.push(obj22);
+					state.hiddenstack.push(hidden23);
+					let v24 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v24 !== undefined) { hidden23.$keys = v24; }
+					let ref25 = state.hiddenstack[state.hiddenstack.length - 1].$keys;
+					let match26 = -1;
+					if (ref25 != 0) { match26 = 0; }
+					let v27 = null;
+					if (match26 != -1) {
+						let v28 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						v27 = v28;
+					}
+					if (v27 !== undefined) { obj22.default = v27; }
+					let ref29 = state.hiddenstack[state.hiddenstack.length - 1].$keys;
+					let match30 = -1;
+					if (ref29 != 0) { match30 = 0; }
+					let v31 = null;
+					if (match30 != -1) {
+						let v32 = state.view.getUint8(state.scan);
+						state.scan += 1;
+						v31 = v32;
+					}
+					if (v31 !== undefined) { obj22.weirdbyte = v31; }
+					let ref33 = state.hiddenstack[state.hiddenstack.length - 1].$keys;
+					ref33 = ref33 + -1;
+					let hidden34 = { $index: 0, $length: ref33 };
+					state.hiddenstack.push(hidden34);
+					state.stack.push({});
+					let arr35 = [];
+					for (let i36 = 0; i36 < ref33; i36++) {
+						hidden34.$index = i36;
+						let v37 = state.view.getUint16(state.scan);
+						state.scan += 2;
+						arr35.push(v37);
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					if (arr35 !== undefined) { obj22.extras = arr35; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr20.push(obj22);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.unknown_0D = arr20;
+				break;
+			}
+			case 14: {
+				obj0.unknown_0E = true;
+				break;
+			}
+			case 15: {
+				obj0.unknown_0F = true;
+				break;
+			}
+			case 16: {
+				obj0.unknown_10 = true;
+				break;
+			}
+			case 17: {
+				let v38 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_11 = v38;
+				break;
+			}
+			case 18: {
+				obj0.unknown_12 = true;
+				break;
+			}
+			case 19: {
+				let v39 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_13 = v39;
+				break;
+			}
+			case 20: {
+				let v40 = ext[2].read(state);
+				obj0.unknown_14 = v40;
+				break;
+			}
+			case 22: {
+				let v41 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_16 = v41;
+				break;
+			}
+			case 24: {
+				let v42 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unknown_18 = v42;
+				break;
+			}
+			case 25: {
+				let v43 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.skeletal_animation = v43;
+				break;
+			}
+			case 26: {
+				let v44 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v45 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr46 = [v44, v45];
+				obj0.skeletal_range = arr46;
+				break;
+			}
+			case 27: {
+				let v47 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.unknown_1B = v47;
+				break;
+			}
+			case 112: {
+				let v48 = ext[3].read(state);
+				obj0.unknown_70 = v48;
+				break;
+			}
+			case 119: {
+				let v49 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v50 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr51 = [v49, v50];
+				obj0.unknown_77 = arr51;
+				break;
+			}
+			case 120: {
+				let v52 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v53 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let v54 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				let arr55 = [v52, v53, v54];
+				obj0.unknown_78 = arr55;
+				break;
+			}
+			case 249: {
+				let v56 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden57 = { $index: 0, $length: v56 };
+				state.hiddenstack.push(hidden57);
+				state.stack.push({});
+				let arr58 = [];
+				for (let i59 = 0; i59 < v56; i59++) {
+					hidden57.$index = i59;
+					let obj60 = {};
+					let hidden61 = {};
+					state.stack.push(obj60);
+					state.hiddenstack.push(hidden61);
+					let v62 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v62 !== undefined) { hidden61.$type = v62; }
+					let v63 = ext[4].read(state);
+					if (v63 !== undefined) { obj60.prop = v63; }
+					let ref64 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match65 = -1;
+					if (ref64 == 0) { match65 = 0; }
+					let v66 = null;
+					if (match65 != -1) {
+						let v67 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v66 = v67;
+					}
+					if (v66 !== undefined) { obj60.intvalue = v66; }
+					let ref68 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match69 = -1;
+					if (ref68 == 1) { match69 = 0; }
+					let v70 = null;
+					if (match69 != -1) {
+						let v71 = ext[5].read(state);
+						v70 = v71;
+					}
+					if (v70 !== undefined) { obj60.stringvalue = v70; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr58.push(obj60);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr58;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key72 in value) {
+		if (key72.startsWith("$")) { continue; }
+		switch (key72) {
+			case "frames": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w73 = value[key72];
+				ext[0].write(state, w73);
+				break;
+			}
+			case "unknown_02": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w74 = value[key72];
+				if (typeof w74 != "number" || w74 > 65535 || w74 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w74, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_03": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w75 = value[key72];
+				if (!Array.isArray(w75)) { throw new Error("array expected"); }
+				let w76 = w75.length;
+				if (typeof w76 != "number" || w76 > 255 || w76 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w76, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w75.length });
+				for (let i77 = 0; i77 < w75.length; i77++) {
+					let w78 = w75[i77];
+					if (typeof w78 != "number" || w78 > 255 || w78 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w78, state.scan);
+					state.scan += 1;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w79 = value[key72];
+				if (w79 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_05": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w80 = value[key72];
+				if (typeof w80 != "number" || w80 > 255 || w80 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w80, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_06": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w81 = value[key72];
+				if (typeof w81 != "number" || w81 > 65535 || w81 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w81, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_07": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w82 = value[key72];
+				if (typeof w82 != "number" || w82 > 65535 || w82 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w82, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_08": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w83 = value[key72];
+				if (typeof w83 != "number" || w83 > 255 || w83 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w83, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_09": {
+				if (typeof 9 != "number" || 9 > 255 || 9 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(9, state.scan);
+				state.scan += 1;
+				let w84 = value[key72];
+				if (typeof w84 != "number" || w84 > 255 || w84 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w84, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0A": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w85 = value[key72];
+				if (typeof w85 != "number" || w85 > 255 || w85 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w85, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0B": {
+				if (typeof 11 != "number" || 11 > 255 || 11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(11, state.scan);
+				state.scan += 1;
+				let w86 = value[key72];
+				if (typeof w86 != "number" || w86 > 255 || w86 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w86, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_0C": {
+				if (typeof 12 != "number" || 12 > 255 || 12 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(12, state.scan);
+				state.scan += 1;
+				let w87 = value[key72];
+				ext[1].write(state, w87);
+				break;
+			}
+			case "unknown_0D": {
+				if (typeof 13 != "number" || 13 > 255 || 13 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(13, state.scan);
+				state.scan += 1;
+				let w88 = value[key72];
+				if (!Array.isArray(w88)) { throw new Error("array expected"); }
+				let w89 = w88.length;
+				if (typeof w89 != "number" || w89 > 65535 || w89 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w89, state.scan);
+				state.scan += 2;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w88.length });
+				for (let i90 = 0; i90 < w88.length; i90++) {
+					let w91 = w88[i90];
+					if (typeof w91 != "object" || !w91) { throw new Error("object expected"); }
+					let hidden92 = {};
+					state.stack.push(w91);
+					state.hiddenstack.push(hidden92);
+					let w93 = w91.$keys;
+					w93 ??= 0;
+					w93 = ext[6].resolve(w91, w93);
+					w93 = ext[7].resolve(w91, w93);
+					w93 = ext[8].resolve(w91, w93);
+					hidden92.$keys = w93;
+					if (typeof w93 != "number" || w93 > 255 || w93 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w93, state.scan);
+					state.scan += 1;
+					let w94 = w91.default;
+					if (w94 != null) {
+						if (typeof w94 != "number" || w94 > 65535 || w94 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w94, state.scan);
+						state.scan += 2;
+					}
+					let w95 = w91.weirdbyte;
+					if (w95 != null) {
+						if (typeof w95 != "number" || w95 > 255 || w95 < 0) { throw new Error(); }
+						state.buffer.writeUInt8(w95, state.scan);
+						state.scan += 1;
+					}
+					let w96 = w91.extras;
+					if (!Array.isArray(w96)) { throw new Error("array expected"); }
+					let w97 = w96.length;
+					state.stack.push({});
+					state.hiddenstack.push({ $index: 0, $length: w96.length });
+					for (let i98 = 0; i98 < w96.length; i98++) {
+						let w99 = w96[i98];
+						if (typeof w99 != "number" || w99 > 65535 || w99 < 0) { throw new Error(); }
+						state.buffer.writeUInt16BE(w99, state.scan);
+						state.scan += 2;
+					}
+					state.hiddenstack.pop();
+					state.stack.pop();
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unknown_0E": {
+				if (typeof 14 != "number" || 14 > 255 || 14 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(14, state.scan);
+				state.scan += 1;
+				let w100 = value[key72];
+				if (w100 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_0F": {
+				if (typeof 15 != "number" || 15 > 255 || 15 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(15, state.scan);
+				state.scan += 1;
+				let w101 = value[key72];
+				if (w101 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_10": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w102 = value[key72];
+				if (w102 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_11": {
+				if (typeof 17 != "number" || 17 > 255 || 17 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(17, state.scan);
+				state.scan += 1;
+				let w103 = value[key72];
+				if (typeof w103 != "number" || w103 > 255 || w103 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w103, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_12": {
+				if (typeof 18 != "number" || 18 > 255 || 18 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(18, state.scan);
+				state.scan += 1;
+				let w104 = value[key72];
+				if (w104 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "unknown_13": {
+				if (typeof 19 != "number" || 19 > 255 || 19 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(19, state.scan);
+				state.scan += 1;
+				let w105 = value[key72];
+				if (typeof w105 != "number" || w105 > 65535 || w105 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w105, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_14": {
+				if (typeof 20 != "number" || 20 > 255 || 20 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(20, state.scan);
+				state.scan += 1;
+				let w106 = value[key72];
+				ext[2].write(state, w106);
+				break;
+			}
+			case "unknown_16": {
+				if (typeof 22 != "number" || 22 > 255 || 22 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(22, state.scan);
+				state.scan += 1;
+				let w107 = value[key72];
+				if (typeof w107 != "number" || w107 > 255 || w107 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w107, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_18": {
+				if (typeof 24 != "number" || 24 > 255 || 24 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(24, state.scan);
+				state.scan += 1;
+				let w108 = value[key72];
+				if (typeof w108 != "number" || w108 > 65535 || w108 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w108, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "skeletal_animation": {
+				if (typeof 25 != "number" || 25 > 255 || 25 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(25, state.scan);
+				state.scan += 1;
+				let w109 = value[key72];
+				if (typeof w109 != "number" || w109 > 65535 || w109 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w109, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "skeletal_range": {
+				if (typeof 26 != "number" || 26 > 255 || 26 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(26, state.scan);
+				state.scan += 1;
+				let w110 = value[key72];
+				if (!Array.isArray(w110)) { throw new Error("array expected"); }
+				let w111 = w110[0];
+				if (typeof w111 != "number" || w111 > 65535 || w111 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w111, state.scan);
+				state.scan += 2;
+				let w112 = w110[1];
+				if (typeof w112 != "number" || w112 > 65535 || w112 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w112, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unknown_1B": {
+				if (typeof 27 != "number" || 27 > 255 || 27 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(27, state.scan);
+				state.scan += 1;
+				let w113 = value[key72];
+				if (typeof w113 != "number" || w113 > 255 || w113 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w113, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_70": {
+				if (typeof 112 != "number" || 112 > 255 || 112 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(112, state.scan);
+				state.scan += 1;
+				let w114 = value[key72];
+				ext[3].write(state, w114);
+				break;
+			}
+			case "unknown_77": {
+				if (typeof 119 != "number" || 119 > 255 || 119 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(119, state.scan);
+				state.scan += 1;
+				let w115 = value[key72];
+				if (!Array.isArray(w115)) { throw new Error("array expected"); }
+				let w116 = w115[0];
+				if (typeof w116 != "number" || w116 > 65535 || w116 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w116, state.scan);
+				state.scan += 2;
+				let w117 = w115[1];
+				if (typeof w117 != "number" || w117 > 255 || w117 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w117, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unknown_78": {
+				if (typeof 120 != "number" || 120 > 255 || 120 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(120, state.scan);
+				state.scan += 1;
+				let w118 = value[key72];
+				if (!Array.isArray(w118)) { throw new Error("array expected"); }
+				let w119 = w118[0];
+				if (typeof w119 != "number" || w119 > 65535 || w119 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w119, state.scan);
+				state.scan += 2;
+				let w120 = w118[1];
+				if (typeof w120 != "number" || w120 > 65535 || w120 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w120, state.scan);
+				state.scan += 2;
+				let w121 = w118[2];
+				if (typeof w121 != "number" || w121 > 65535 || w121 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w121, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w122 = value[key72];
+				if (!Array.isArray(w122)) { throw new Error("array expected"); }
+				let w123 = w122.length;
+				if (typeof w123 != "number" || w123 > 255 || w123 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w123, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w122.length });
+				for (let i124 = 0; i124 < w122.length; i124++) {
+					let w125 = w122[i124];
+					if (typeof w125 != "object" || !w125) { throw new Error("object expected"); }
+					let hidden126 = {};
+					state.stack.push(w125);
+					state.hiddenstack.push(hidden126);
+					let w127 = w125.$type;
+					w127 ??= 0;
+					w127 = ext[9].resolve(w125, w127);
+					w127 = ext[10].resolve(w125, w127);
+					hidden126.$type = w127;
+					if (typeof w127 != "number" || w127 > 255 || w127 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w127, state.scan);
+					state.scan += 1;
+					let w128 = w125.prop;
+					ext[4].write(state, w128);
+					let w129 = w125.intvalue;
+					if (w129 != null) {
+						if (typeof w129 != "number" || w129 > 2147483647 || w129 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w129, state.scan);
+						state.scan += 4;
+					}
+					let w130 = w125.stringvalue;
+					if (w130 != null) {
+						ext[5].write(state, w130);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key72);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
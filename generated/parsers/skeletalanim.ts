@@ -0,0 +1,208 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\skeletalanim.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x70266f0e;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v2 !== undefined) { obj0.header = v2; }
+	let v3 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v3 !== undefined) { obj0.framebase = v3; }
+	let v4 = state.view.getUint32(state.scan);
+	state.scan += 4;
+	if (v4 !== undefined) { obj0.endtime = v4; }
+	let v5 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v5 !== undefined) { obj0.unk_always0 = v5; }
+	let v6 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	let hidden7 = { $index: 0, $length: v6 };
+	state.hiddenstack.push(hidden7);
+	state.stack.push({});
+	let arr8 = [];
+	for (let i9 = 0; i9 < v6; i9++) {
+		hidden7.$index = i9;
+		let obj10 = {};
+		let hidden11 = {};
+		state.stack.push(obj10);
+		state.hiddenstack.push(hidden11);
+		let v12 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v12 !== undefined) { obj10.unk_1to4 = v12; }
+		let v13 = ext[0].read(state);
+		if (v13 !== undefined) { obj10.boneid = v13; }
+		let v14 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v14 !== undefined) { obj10.type_0to9 = v14; }
+		let v15 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v15 !== undefined) { hidden11.$packetlength = v15; }
+		let v16 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v16 !== undefined) { obj10.bonetype_01or3 = v16; }
+		let v17 = state.view.getUint16(state.scan);
+		state.scan += 2;
+		if (v17 !== undefined) { obj10.always0 = v17; }
+		let v18 = state.view.getUint8(state.scan++);
+		if (v18 != 0 && v18 != 1) { throw new Error("1 or 0 expected boolean value"); }
+		if ((v18 != 0) !== undefined) { obj10.flag2 = (v18 != 0); }
+		let ref19 = state.hiddenstack[state.hiddenstack.length - 1].$packetlength;
+		ref19 = ref19 + 0;
+		let hidden20 = { $index: 0, $length: ref19 };
+		state.hiddenstack.push(hidden20);
+		state.stack.push({});
+		let arr21 = [];
+		for (let i22 = 0; i22 < ref19; i22++) {
+			hidden20.$index = i22;
+			let obj23 = {};
+			let hidden24 = {};
+			state.stack.push(obj23);
+			state.hiddenstack.push(hidden24);
+			let v25 = state.view.getUint16(state.scan);
+			state.scan += 2;
+			if (v25 !== undefined) { obj23.time = v25; }
+			let hidden26 = { $index: 0, $length: 5 };
+			state.hiddenstack.push(hidden26);
+			state.stack.push({});
+			let arr27 = [];
+			for (let i28 = 0; i28 < 5; i28++) {
+				hidden26.$index = i28;
+				let v29 = state.view.getFloat32(state.scan);
+				state.scan += 4;
+				arr27.push(v29);
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			if (arr27 !== undefined) { obj23.value = arr27; }
+			state.stack.pop();
+			state.hiddenstack.pop();
+			arr21.push(obj23);
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		if (arr21 !== undefined) { obj10.chunks = arr21; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr8.push(obj10);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr8 !== undefined) { obj0.tracks = arr8; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden30 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden30);
+	let w31 = value.header;
+	if (typeof w31 != "number" || w31 > 255 || w31 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w31, state.scan);
+	state.scan += 1;
+	let w32 = value.framebase;
+	if (typeof w32 != "number" || w32 > 65535 || w32 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w32, state.scan);
+	state.scan += 2;
+	let w33 = value.endtime;
+	if (typeof w33 != "number" || w33 > 4294967295 || w33 < 0) { throw new Error(); }
+	state.buffer.writeUInt32BE(w33, state.scan);
+	state.scan += 4;
+	let w34 = value.unk_always0;
+	if (typeof w34 != "number" || w34 > 255 || w34 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w34, state.scan);
+	state.scan += 1;
+	let w35 = value.tracks;
+	if (!Array.isArray(w35)) { throw new Error("array expected"); }
+	let w36 = w35.length;
+	if (typeof w36 != "number" || w36 > 65535 || w36 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w36, state.scan);
+	state.scan += 2;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w35.length });
+	for (let i37 = 0; i37 < w35.length; i37++) {
+		let w38 = w35[i37];
+		if (typeof w38 != "object" || !w38) { throw new Error("object expected"); }
+		let hidden39 = {};
+		state.stack.push(w38);
+		state.hiddenstack.push(hidden39);
+		let w40 = w38.unk_1to4;
+		if (typeof w40 != "number" || w40 > 255 || w40 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w40, state.scan);
+		state.scan += 1;
+		let w41 = w38.boneid;
+		ext[0].write(state, w41);
+		let w42 = w38.type_0to9;
+		if (typeof w42 != "number" || w42 > 255 || w42 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w42, state.scan);
+		state.scan += 1;
+		let w43 = w38.$packetlength;
+		w43 ??= 0;
+		w43 = ext[1].resolve(w38, w43);
+		hidden39.$packetlength = w43;
+		if (typeof w43 != "number" || w43 > 65535 || w43 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w43, state.scan);
+		state.scan += 2;
+		let w44 = w38.bonetype_01or3;
+		if (typeof w44 != "number" || w44 > 255 || w44 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w44, state.scan);
+		state.scan += 1;
+		let w45 = w38.always0;
+		if (typeof w45 != "number" || w45 > 65535 || w45 < 0) { throw new Error(); }
+		state.buffer.writeUInt16BE(w45, state.scan);
+		state.scan += 2;
+		let w46 = w38.flag2;
+		if (typeof w46 != "boolean") { throw new Error("boolean expected"); }
+		state.buffer.writeUInt8(+w46, state.scan++);
+		let w47 = w38.chunks;
+		if (!Array.isArray(w47)) { throw new Error("array expected"); }
+		let w48 = w47.length;
+		state.stack.push({});
+		state.hiddenstack.push({ $index: 0, $length: w47.length });
+		for (let i49 = 0; i49 < w47.length; i49++) {
+			let w50 = w47[i49];
+			if (typeof w50 != "object" || !w50) { throw new Error("object expected"); }
+			let hidden51 = {};
+			state.stack.push(w50);
+			state.hiddenstack.push(hidden51);
+			let w52 = w50.time;
+			if (typeof w52 != "number" || w52 > 65535 || w52 < 0) { throw new Error(); }
+			state.buffer.writeUInt16BE(w52, state.scan);
+			state.scan += 2;
+			let w53 = w50.value;
+			if (!Array.isArray(w53)) { throw new Error("array expected"); }
+			let w54 = w53.length;
+			if (w54 != 5) { throw new Error("expected constant 5 was not present during write"); }
+			state.stack.push({});
+			state.hiddenstack.push({ $index: 0, $length: w53.length });
+			for (let i55 = 0; i55 < w53.length; i55++) {
+				let w56 = w53[i55];
+				if (typeof w56 != "number" || w56 > 1.7976931348623157e+308 || w56 < 5e-324) { throw new Error(); }
+				state.buffer.writeFloatBE(w56, state.scan);
+				state.scan += 4;
+			}
+			state.hiddenstack.pop();
+			state.stack.pop();
+			state.stack.pop();
+			state.hiddenstack.pop();
+		}
+		state.hiddenstack.pop();
+		state.stack.pop();
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,106 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\skyboxes.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xe6353ab8;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.box_material_low = v3;
+				break;
+			}
+			case 4: {
+				let v4 = state.view.getUint8(state.scan++);
+				if (v4 != 0 && v4 != 1) { throw new Error("1 or 0 expected boolean value"); }
+				obj0.unk04 = (v4 != 0);
+				break;
+			}
+			case 5: {
+				let v5 = ext[0].read(state);
+				obj0.model = v5;
+				break;
+			}
+			case 6: {
+				let v6 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.box_material = v6;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key7 in value) {
+		if (key7.startsWith("$")) { continue; }
+		switch (key7) {
+			case "box_material_low": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w8 = value[key7];
+				if (typeof w8 != "number" || w8 > 65535 || w8 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w8, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk04": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w9 = value[key7];
+				if (typeof w9 != "boolean") { throw new Error("boolean expected"); }
+				state.buffer.writeUInt8(+w9, state.scan++);
+				break;
+			}
+			case "model": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w10 = value[key7];
+				ext[0].write(state, w10);
+				break;
+			}
+			case "box_material": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w11 = value[key7];
+				if (typeof w11 != "number" || w11 > 65535 || w11 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w11, state.scan);
+				state.scan += 2;
+				break;
+			}
+			default: throw new Error("unknown property " + key7);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,290 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\spotanims.json'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x2f32b856;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.model = v3;
+				break;
+			}
+			case 2: {
+				let v4 = ext[0].read(state);
+				obj0.sequence = v4;
+				break;
+			}
+			case 4: {
+				let v5 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scaleX = v5;
+				break;
+			}
+			case 5: {
+				let v6 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.scaleYorZ = v6;
+				break;
+			}
+			case 6: {
+				let v7 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.rotation = v7;
+				break;
+			}
+			case 7: {
+				let v8 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.ambient = v8;
+				break;
+			}
+			case 8: {
+				let v9 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.contrast = v9;
+				break;
+			}
+			case 10: {
+				obj0.unk0a = true;
+				break;
+			}
+			case 40: {
+				let v10 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden11 = { $index: 0, $length: v10 };
+				state.hiddenstack.push(hidden11);
+				state.stack.push({});
+				let arr12 = [];
+				for (let i13 = 0; i13 < v10; i13++) {
+					hidden11.$index = i13;
+					let v14 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v15 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr16 = [v14, v15];
+					arr12.push(arr16);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.replace_colors = arr12;
+				break;
+			}
+			case 41: {
+				let v17 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden18 = { $index: 0, $length: v17 };
+				state.hiddenstack.push(hidden18);
+				state.stack.push({});
+				let arr19 = [];
+				for (let i20 = 0; i20 < v17; i20++) {
+					hidden18.$index = i20;
+					let v21 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let v22 = state.view.getUint16(state.scan);
+					state.scan += 2;
+					let arr23 = [v21, v22];
+					arr19.push(arr23);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.replace_materials = arr19;
+				break;
+			}
+			case 44: {
+				let v24 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.unk2c = v24;
+				break;
+			}
+			case 46: {
+				obj0.unk2e = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key25 in value) {
+		if (key25.startsWith("$")) { continue; }
+		switch (key25) {
+			case "model": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w26 = value[key25];
+				ext[0].write(state, w26);
+				break;
+			}
+			case "sequence": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w27 = value[key25];
+				ext[0].write(state, w27);
+				break;
+			}
+			case "scaleX": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w28 = value[key25];
+				if (typeof w28 != "number" || w28 > 65535 || w28 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w28, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "scaleYorZ": {
+				if (typeof 5 != "number" || 5 > 255 || 5 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(5, state.scan);
+				state.scan += 1;
+				let w29 = value[key25];
+				if (typeof w29 != "number" || w29 > 65535 || w29 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w29, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "rotation": {
+				if (typeof 6 != "number" || 6 > 255 || 6 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(6, state.scan);
+				state.scan += 1;
+				let w30 = value[key25];
+				if (typeof w30 != "number" || w30 > 65535 || w30 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w30, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "ambient": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w31 = value[key25];
+				if (typeof w31 != "number" || w31 > 255 || w31 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w31, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "contrast": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w32 = value[key25];
+				if (typeof w32 != "number" || w32 > 255 || w32 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w32, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "unk0a": {
+				if (typeof 10 != "number" || 10 > 255 || 10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(10, state.scan);
+				state.scan += 1;
+				let w33 = value[key25];
+				if (w33 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "replace_colors": {
+				if (typeof 40 != "number" || 40 > 255 || 40 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(40, state.scan);
+				state.scan += 1;
+				let w34 = value[key25];
+				if (!Array.isArray(w34)) { throw new Error("array expected"); }
+				let w35 = w34.length;
+				if (typeof w35 != "number" || w35 > 255 || w35 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w35, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w34.length });
+				for (let i36 = 0; i36 < w34.length; i36++) {
+					let w37 = w34[i36];
+					if (!Array.isArray(w37)) { throw new Error("array expected"); }
+					let w38 = w37[0];
+					if (typeof w38 != "number" || w38 > 65535 || w38 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w38, state.scan);
+					state.scan += 2;
+					let w39 = w37[1];
+					if (typeof w39 != "number" || w39 > 65535 || w39 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w39, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "replace_materials": {
+				if (typeof 41 != "number" || 41 > 255 || 41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(41, state.scan);
+				state.scan += 1;
+				let w40 = value[key25];
+				if (!Array.isArray(w40)) { throw new Error("array expected"); }
+				let w41 = w40.length;
+				if (typeof w41 != "number" || w41 > 255 || w41 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w41, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w40.length });
+				for (let i42 = 0; i42 < w40.length; i42++) {
+					let w43 = w40[i42];
+					if (!Array.isArray(w43)) { throw new Error("array expected"); }
+					let w44 = w43[0];
+					if (typeof w44 != "number" || w44 > 65535 || w44 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w44, state.scan);
+					state.scan += 2;
+					let w45 = w43[1];
+					if (typeof w45 != "number" || w45 > 65535 || w45 < 0) { throw new Error(); }
+					state.buffer.writeUInt16BE(w45, state.scan);
+					state.scan += 2;
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			case "unk2c": {
+				if (typeof 44 != "number" || 44 > 255 || 44 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(44, state.scan);
+				state.scan += 1;
+				let w46 = value[key25];
+				if (typeof w46 != "number" || w46 > 65535 || w46 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w46, state.scan);
+				state.scan += 2;
+				break;
+			}
+			case "unk2e": {
+				if (typeof 46 != "number" || 46 > 255 || 46 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(46, state.scan);
+				state.scan += 1;
+				let w47 = value[key25];
+				if (w47 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key25);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
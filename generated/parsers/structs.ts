@@ -0,0 +1,137 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\structs.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x9ae78d69;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 249: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let hidden4 = { $index: 0, $length: v3 };
+				state.hiddenstack.push(hidden4);
+				state.stack.push({});
+				let arr5 = [];
+				for (let i6 = 0; i6 < v3; i6++) {
+					hidden4.$index = i6;
+					let obj7 = {};
+					let hidden8 = {};
+					state.stack.push(obj7);
+					state.hiddenstack.push(hidden8);
+					let v9 = state.view.getUint8(state.scan);
+					state.scan += 1;
+					if (v9 !== undefined) { hidden8.$type = v9; }
+					let v10 = ext[0].read(state);
+					if (v10 !== undefined) { obj7.prop = v10; }
+					let ref11 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match12 = -1;
+					if (ref11 == 0) { match12 = 0; }
+					let v13 = null;
+					if (match12 != -1) {
+						let v14 = state.view.getInt32(state.scan);
+						state.scan += 4;
+						v13 = v14;
+					}
+					if (v13 !== undefined) { obj7.intvalue = v13; }
+					let ref15 = state.hiddenstack[state.hiddenstack.length - 1].$type;
+					let match16 = -1;
+					if (ref15 == 1) { match16 = 0; }
+					let v17 = null;
+					if (match16 != -1) {
+						let v18 = ext[1].read(state);
+						v17 = v18;
+					}
+					if (v17 !== undefined) { obj7.stringvalue = v17; }
+					state.stack.pop();
+					state.hiddenstack.pop();
+					arr5.push(obj7);
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				obj0.extra = arr5;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key19 in value) {
+		if (key19.startsWith("$")) { continue; }
+		switch (key19) {
+			case "extra": {
+				if (typeof 249 != "number" || 249 > 255 || 249 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(249, state.scan);
+				state.scan += 1;
+				let w20 = value[key19];
+				if (!Array.isArray(w20)) { throw new Error("array expected"); }
+				let w21 = w20.length;
+				if (typeof w21 != "number" || w21 > 255 || w21 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w21, state.scan);
+				state.scan += 1;
+				state.stack.push({});
+				state.hiddenstack.push({ $index: 0, $length: w20.length });
+				for (let i22 = 0; i22 < w20.length; i22++) {
+					let w23 = w20[i22];
+					if (typeof w23 != "object" || !w23) { throw new Error("object expected"); }
+					let hidden24 = {};
+					state.stack.push(w23);
+					state.hiddenstack.push(hidden24);
+					let w25 = w23.$type;
+					w25 ??= 0;
+					w25 = ext[2].resolve(w23, w25);
+					w25 = ext[3].resolve(w23, w25);
+					hidden24.$type = w25;
+					if (typeof w25 != "number" || w25 > 255 || w25 < 0) { throw new Error(); }
+					state.buffer.writeUInt8(w25, state.scan);
+					state.scan += 1;
+					let w26 = w23.prop;
+					ext[0].write(state, w26);
+					let w27 = w23.intvalue;
+					if (w27 != null) {
+						if (typeof w27 != "number" || w27 > 2147483647 || w27 < -2147483648) { throw new Error(); }
+						state.buffer.writeInt32BE(w27, state.scan);
+						state.scan += 4;
+					}
+					let w28 = w23.stringvalue;
+					if (w28 != null) {
+						ext[1].write(state, w28);
+					}
+					state.stack.pop();
+					state.hiddenstack.pop();
+				}
+				state.hiddenstack.pop();
+				state.stack.pop();
+				break;
+			}
+			default: throw new Error("unknown property " + key19);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
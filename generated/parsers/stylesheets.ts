@@ -0,0 +1,98 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\stylesheets.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0x03640bfe;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = {};
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	let v2 = state.view.getUint16(state.scan);
+	state.scan += 2;
+	if (v2 !== undefined) { obj0.parent = v2; }
+	let v3 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	if (v3 !== undefined) { obj0.unk2 = v3; }
+	let v4 = state.view.getUint8(state.scan);
+	state.scan += 1;
+	let hidden5 = { $index: 0, $length: v4 };
+	state.hiddenstack.push(hidden5);
+	state.stack.push({});
+	let arr6 = [];
+	for (let i7 = 0; i7 < v4; i7++) {
+		hidden5.$index = i7;
+		let obj8 = {};
+		let hidden9 = {};
+		state.stack.push(obj8);
+		state.hiddenstack.push(hidden9);
+		let v10 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		if (v10 !== undefined) { obj8.unk0 = v10; }
+		let v11 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v11 !== undefined) { obj8.prop = v11; }
+		let v12 = state.view.getUint32(state.scan);
+		state.scan += 4;
+		if (v12 !== undefined) { obj8.value = v12; }
+		state.stack.pop();
+		state.hiddenstack.pop();
+		arr6.push(obj8);
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	if (arr6 !== undefined) { obj0.data = arr6; }
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("object expected"); }
+	let hidden13 = {};
+	state.stack.push(value);
+	state.hiddenstack.push(hidden13);
+	let w14 = value.parent;
+	if (typeof w14 != "number" || w14 > 65535 || w14 < 0) { throw new Error(); }
+	state.buffer.writeUInt16BE(w14, state.scan);
+	state.scan += 2;
+	let w15 = value.unk2;
+	if (typeof w15 != "number" || w15 > 255 || w15 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w15, state.scan);
+	state.scan += 1;
+	let w16 = value.data;
+	if (!Array.isArray(w16)) { throw new Error("array expected"); }
+	let w17 = w16.length;
+	if (typeof w17 != "number" || w17 > 255 || w17 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(w17, state.scan);
+	state.scan += 1;
+	state.stack.push({});
+	state.hiddenstack.push({ $index: 0, $length: w16.length });
+	for (let i18 = 0; i18 < w16.length; i18++) {
+		let w19 = w16[i18];
+		if (typeof w19 != "object" || !w19) { throw new Error("object expected"); }
+		let hidden20 = {};
+		state.stack.push(w19);
+		state.hiddenstack.push(hidden20);
+		let w21 = w19.unk0;
+		if (typeof w21 != "number" || w21 > 255 || w21 < 0) { throw new Error(); }
+		state.buffer.writeUInt8(w21, state.scan);
+		state.scan += 1;
+		let w22 = w19.prop;
+		if (typeof w22 != "number" || w22 > 4294967295 || w22 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w22, state.scan);
+		state.scan += 4;
+		let w23 = w19.value;
+		if (typeof w23 != "number" || w23 > 4294967295 || w23 < 0) { throw new Error(); }
+		state.buffer.writeUInt32BE(w23, state.scan);
+		state.scan += 4;
+		state.stack.pop();
+		state.hiddenstack.pop();
+	}
+	state.hiddenstack.pop();
+	state.stack.pop();
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -0,0 +1,96 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\varbits.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xb036bf7c;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 1: {
+				let v3 = ext[0].read(state);
+				obj0.varid = v3;
+				break;
+			}
+			case 2: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let v5 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				let arr6 = [v4, v5];
+				obj0.bits = arr6;
+				break;
+			}
+			case 16: {
+				obj0.wikisync = true;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key7 in value) {
+		if (key7.startsWith("$")) { continue; }
+		switch (key7) {
+			case "varid": {
+				if (typeof 1 != "number" || 1 > 255 || 1 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(1, state.scan);
+				state.scan += 1;
+				let w8 = value[key7];
+				ext[0].write(state, w8);
+				break;
+			}
+			case "bits": {
+				if (typeof 2 != "number" || 2 > 255 || 2 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(2, state.scan);
+				state.scan += 1;
+				let w9 = value[key7];
+				if (!Array.isArray(w9)) { throw new Error("array expected"); }
+				let w10 = w9[0];
+				if (typeof w10 != "number" || w10 > 255 || w10 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w10, state.scan);
+				state.scan += 1;
+				let w11 = w9[1];
+				if (typeof w11 != "number" || w11 > 255 || w11 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w11, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "wikisync": {
+				if (typeof 16 != "number" || 16 > 255 || 16 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(16, state.scan);
+				state.scan += 1;
+				let w12 = value[key7];
+				if (w12 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			default: throw new Error("unknown property " + key7);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
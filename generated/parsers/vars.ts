@@ -0,0 +1,118 @@
+// GENERATED DO NOT EDIT
+// This source data is located at '..\..\src\opcodes\vars.jsonc'
+// run `npm run filetypes` to rebuild
+// @ts-nocheck
+
+export const hash = 0xa777703d;
+
+export function read(state, ext) {
+	let obj0 = {};
+	let hidden1 = { $opcode: 0 };
+	state.stack.push(obj0);
+	state.hiddenstack.push(hidden1);
+	while (true) {
+		if (state.scan == state.endoffset) {
+			console.log("ended reading opcode struct at end of file without 0x00 opcode");
+			break;
+		}
+		let v2 = state.view.getUint8(state.scan);
+		state.scan += 1;
+		hidden1.$opcode = v2;
+		if (v2 == 0) { break; }
+		switch (v2) {
+			case 3: {
+				let v3 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.type = v3;
+				break;
+			}
+			case 4: {
+				let v4 = state.view.getUint8(state.scan);
+				state.scan += 1;
+				obj0.lifetime = v4;
+				break;
+			}
+			case 7: {
+				obj0.domaindefault = true;
+				break;
+			}
+			case 8: {
+				obj0.wikisync = true;
+				break;
+			}
+			case 110: {
+				let v5 = state.view.getUint16(state.scan);
+				state.scan += 2;
+				obj0.clientcode = v5;
+				break;
+			}
+			default: throw new Error("unknown chunk 0x" + v2.toString(16).toUpperCase());
+		}
+	}
+	state.stack.pop();
+	state.hiddenstack.pop();
+	return obj0;
+}
+
+export function write(state, ext, value) {
+	if (typeof value != "object" || !value) { throw new Error("oject expected"); }
+	state.stack.push(value);
+	state.hiddenstack.push({});
+	for (let key6 in value) {
+		if (key6.startsWith("$")) { continue; }
+		switch (key6) {
+			case "type": {
+				if (typeof 3 != "number" || 3 > 255 || 3 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(3, state.scan);
+				state.scan += 1;
+				let w7 = value[key6];
+				if (typeof w7 != "number" || w7 > 255 || w7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w7, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "lifetime": {
+				if (typeof 4 != "number" || 4 > 255 || 4 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(4, state.scan);
+				state.scan += 1;
+				let w8 = value[key6];
+				if (typeof w8 != "number" || w8 > 255 || w8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(w8, state.scan);
+				state.scan += 1;
+				break;
+			}
+			case "domaindefault": {
+				if (typeof 7 != "number" || 7 > 255 || 7 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(7, state.scan);
+				state.scan += 1;
+				let w9 = value[key6];
+				if (w9 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "wikisync": {
+				if (typeof 8 != "number" || 8 > 255 || 8 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(8, state.scan);
+				state.scan += 1;
+				let w10 = value[key6];
+				if (w10 != true) { throw new Error("expected constant true was not present during write"); }
+				break;
+			}
+			case "clientcode": {
+				if (typeof 110 != "number" || 110 > 255 || 110 < 0) { throw new Error(); }
+				state.buffer.writeUInt8(110, state.scan);
+				state.scan += 1;
+				let w11 = value[key6];
+				if (typeof w11 != "number" || w11 > 65535 || w11 < 0) { throw new Error(); }
+				state.buffer.writeUInt16BE(w11, state.scan);
+				state.scan += 2;
+				break;
+			}
+			default: throw new Error("unknown property " + key6);
+		}
+	}
+	if (typeof 0 != "number" || 0 > 255 || 0 < 0) { throw new Error(); }
+	state.buffer.writeUInt8(0, state.scan);
+	state.scan += 1;
+	state.stack.pop();
+	state.hiddenstack.pop();
+}
@@ -7,7 +7,7 @@ import { mapsquare_locations } from "../../generated/mapsquare_locations";
 import { ModelData, ModelMeshData } from "./modeldata";
 import { mapsquare_tiles } from "../../generated/mapsquare_tiles";
 import { mapsquare_watertiles } from "../../generated/mapsquare_watertiles";
-import { augmentThreeJsFloorMaterial, ThreejsSceneCache, ob3ModelToThree, EngineCache, applyMaterial, ParsedMaterial, augmentZOffsetMaterial } from "./modeltothree";
+import { augmentThreeJsFloorMaterial, ThreejsSceneCache, ob3ModelToThree, EngineCache, applyMaterial, ParsedMaterial, augmentZOffsetMaterial, applyMaterialColorRange } from "./modeltothree";
 import { BufferAttribute, DataTexture, Matrix4, MeshBasicMaterial, Object3D, Quaternion, RGBAFormat, Vector3 } from "three";
 import { defaultMaterial, materialCacheKey, MaterialData } from "./materials/jmat";
 import { locs } from "../../generated/locs";
@@ -17,10 +17,10 @@ import { legacyMajors } from "../cache/legacycache";
 import { classicModifyTileGrid, getClassicLoc, getClassicMapData } from "./classicmap";
 import { MeshBuilder, computePartialNormals, getAttributeBackingStore, topdown2dWallModels } from "./meshes/meshutils";
 import { CacheFileSource } from "../cache";
-import { CanvasImage } from "../imgutils";
-import { minimapFloorMaterial, minimapWaterMaterial } from "../rs3shaders";
+import { MinimapLocAtlas, minimapFloorMaterial, minimapWaterMaterial } from "../rs3shaders";
 import { mapsquare_tiles_nxt } from "../../generated/mapsquare_tiles_nxt";
 import { crc32addInt } from "../libs/crc32util";
+import { simplifiedMeshIndices, simplifyMesh } from "./meshes/simplify";
 
 
 export const tiledimensions = 512;
@@ -426,6 +426,9 @@ function invertTileShape(shape: number) {
 	throw new Error("unexpected");
 }
 
+//recolored copies of color attributes, shared between placements so they can still be instanced
+const recoloredAttributes = new WeakMap<BufferAttribute, Map<string, BufferAttribute | null>>();
+
 export function modifyMesh(mesh: ModelMeshData, mods: ModelModifications) {
 	let newmat = mods.replaceMaterials?.find(q => q[0] == mesh.materialId)?.[1];
 	let newmesh = { ...mesh };
@@ -437,7 +440,16 @@ export function modifyMesh(mesh: ModelMeshData, mods: ModelModifications) {
 	}
 
 	let clonedcolors: BufferAttribute | undefined = undefined;
+	let recolorcache: Map<string, BufferAttribute | null> | undefined = undefined;
+	let recolorkey = "";
 	if (mods.replaceColors && mods.replaceColors.length != 0 && mesh.attributes.color) {
+		recolorcache = getOrInsert(recoloredAttributes, mesh.attributes.color, () => new Map());
+		recolorkey = mods.replaceColors.join(",");
+	}
+	let cachedcolors = recolorcache?.get(recolorkey);
+	if (cachedcolors !== undefined) {
+		clonedcolors = cachedcolors ?? undefined;
+	} else if (mods.replaceColors && mods.replaceColors.length != 0 && mesh.attributes.color) {
 		let colors = mesh.attributes.color;
 
 		let map: [number, [number, number, number]][] = [];
@@ -459,6 +471,7 @@ export function modifyMesh(mesh: ModelMeshData, mods: ModelModifications) {
 				}
 			}
 		}
+		recolorcache!.set(recolorkey, clonedcolors ?? null);
 	}
 	// if (typeof mods.brightness == "number" && mods.brightness != 1 && mesh.attributes.color) {
 	// 	let colors = mesh.attributes.color;
@@ -930,7 +943,7 @@ export class TileGrid implements TileGridSource {
 	}
 }
 
-export type ParsemapOpts = { padfloor?: boolean, invisibleLayers?: boolean, collision?: boolean, map2d?: boolean, minimap?: boolean, hashboxes?: boolean, skybox?: boolean, mask?: MapRect[] };
+export type ParsemapOpts = { padfloor?: boolean, invisibleLayers?: boolean, collision?: boolean, map2d?: boolean, minimap?: boolean, minimapatlas?: boolean, hashboxes?: boolean, skybox?: boolean, mask?: MapRect[], lod?: number };
 
 export async function getMapsquareData(engine: EngineCache, chunkx: number, chunkz: number) {
 	let squareSize = (engine.classicData ? classicChunkSize : rs2ChunkSize);
@@ -1111,45 +1124,24 @@ export async function mapsquareSkybox(scene: ThreejsSceneCache, mainchunk: Chunk
 export async function mapsquareFloors(scene: ThreejsSceneCache, grid: TileGrid, chunk: ChunkData, opts?: ParsemapOpts) {
 	let floors: FloorMeshData[] = [];
 	let matids = grid.gatherMaterials(chunk.tilerect.x, chunk.tilerect.z, chunk.tilerect.xsize + 1, chunk.tilerect.zsize + 1);
-	let textures = new Map<number, { tex: CanvasImage, repeat: number }>();
+	let textures = new Map<number, { img: ImageData, repeat: number }>();
 	let textureproms: Promise<void>[] = [];
 	for (let [matid, repeat] of matids.entries()) {
 		let mat = scene.engine.getMaterialData(matid);
 		if (mat.textures.diffuse && scene.textureType != "none") {
 			textureproms.push(scene.getTextureFile("diffuse", mat.textures.diffuse, mat.stripDiffuseAlpha)
-				.then(tex => tex.toWebgl())
-				.then(src => {
-					textures.set(mat.textures.diffuse!, { tex: src, repeat });
+				.then(tex => tex.toImageData())
+				.then(img => {
+					let old = textures.get(mat.textures.diffuse!);
+					if (!old || old.repeat < repeat) {
+						textures.set(mat.textures.diffuse!, { img, repeat });
+					}
 				})
 			);
 		}
 	}
 	await Promise.all(textureproms);
-	let atlas!: SimpleTexturePacker;
-	//sort from large to small for more efficient packing
-	let sortedtextures = [...textures.entries()].sort((a, b) => b[1].tex.width * b[1].repeat - a[1].tex.width * a[1].repeat);
-	let sizelist: [number, number][] = [
-		[256, 256],
-		[512, 512],
-		[1024, 512],
-		[1024, 1024],
-		[1024, 2048],
-		[2048, 1024],//try both orientations because the layout algo isnt symmetric
-		[2048, 2048],
-		[2048, 2048 + 1024],
-		[2048, 4096],
-		[2048 + 1024, 4096],
-		[4096, 4096]
-	];
-	retrysize: for (let size of sizelist) {
-		atlas = new SimpleTexturePacker(size[0], size[1]);
-		for (let [id, { tex, repeat }] of sortedtextures) {
-			if (!atlas.addTexture(id, tex, repeat)) {
-				continue retrysize;
-			}
-		}
-		break;
-	}
+	let atlas = getFloorAtlas(scene, [...textures.entries()]);
 
 	for (let level = 0; level < squareLevels; level++) {
 		floors.push(mapsquareMesh(grid, chunk, level, atlas, true, "default"));
@@ -1167,11 +1159,18 @@ export async function mapsquareFloors(scene: ThreejsSceneCache, grid: TileGrid,
 			floors.push(mapsquareMesh(grid, chunk, level, atlas, false, "minimap", true));
 		}
 	}
+	let lod = opts?.lod ?? 0;
+	if (lod > 0) {
+		floors = floors.map(q => (q.mode == "walkmesh" || q.mode == "wireframe" ? q : simplifyFloorMesh(q, lod)));
+	}
 	return floors
 }
 
 export type ThreeJsRenderSection = {
-	mesh: RSBatchMesh,
+	mesh: RSBatchMesh | RSInstancedMesh,
+	//position in mesh.renderSections, also the instance index for instanced meshes
+	sectionindex: number,
+	//index range in the original (unhidden) layout, these never change
 	startindex: number,
 	endindex: number,
 	startvertex: number,
@@ -1188,7 +1187,9 @@ export type RSMapChunkData = {
 	chunkroot: THREE.Group,
 	chunkx: number,
 	chunkz: number,
-	locRenders: Map<WorldLocation, ThreeJsRenderSection[]>
+	locRenders: Map<WorldLocation, ThreeJsRenderSection[]>,
+	//owned by this chunk, unlike the materials in the scenecache
+	minimapatlas: MinimapLocAtlas | null
 }
 
 export async function renderMapSquare(cache: ThreejsSceneCache, parsedsquare: ReturnType<typeof parseMapsquare>, chunkx: number, chunkz: number, opts: ParsemapOpts): Promise<RSMapChunkData> {
@@ -1197,14 +1198,21 @@ export async function renderMapSquare(cache: ThreejsSceneCache, parsedsquare: Re
 	let chunkroot = new THREE.Group();
 	chunkroot.name = `mapsquare ${chunkx}.${chunkz}`;
 	let locRenders = new Map<WorldLocation, ThreeJsRenderSection[]>();
+	let minimapatlas: MinimapLocAtlas | null = null;
 	if (chunk) {
 		let floordatas = await mapsquareFloors(cache, grid, chunk, opts);
 		let overlays = (!opts?.map2d ? [] : await mapsquareOverlays(cache.engine, grid, chunk.locs));
-		let locmeshes = await generateLocationMeshgroups(cache, chunk.locs);
+		let locmeshes = await generateLocationMeshgroups(cache, chunk.locs, false, opts.lod);
 		let allmeshes = [...locmeshes.byMaterial, ...overlays];
 		if (opts.minimap) {
-			let minimeshes = await generateLocationMeshgroups(cache, chunk.locs, true);
-			allmeshes.push(...minimeshes.byMaterial);
+			let minimeshes = await generateLocationMeshgroups(cache, chunk.locs, true, opts.lod);
+			if (opts.minimapatlas) {
+				let groups = await minimapAtlasMeshgroups(cache, minimeshes.byMaterial);
+				minimapatlas = groups.find(q => q.atlas)?.atlas ?? null;
+				allmeshes.push(...groups);
+			} else {
+				allmeshes.push(...minimeshes.byMaterial);
+			}
 		}
 
 		let rootx = chunk.tilerect.x * tiledimensions;
@@ -1216,7 +1224,7 @@ export async function renderMapSquare(cache: ThreejsSceneCache, parsedsquare: Re
 
 		if (allmeshes.length != 0) {
 			let materials = await Promise.all(allmeshes.map(q => q.material ?? cache.getMaterial(q.materialId, q.hasVertexAlpha, q.minimapVariant)));
-			chunkroot.add(...allmeshes.map((q, i) => meshgroupsToThree(grid, q, rootx, rootz, materials[i], locRenders)));
+			chunkroot.add(...allmeshes.flatMap((q, i) => meshgroupToThreeInstanced(grid, q, rootx, rootz, materials[i], locRenders)));
 		}
 
 		let floors = (await Promise.all(floordatas.map(f => floorToThree(cache, f)))).filter(q => q) as any;
@@ -1259,113 +1267,222 @@ export async function renderMapSquare(cache: ThreejsSceneCache, parsedsquare: Re
 		}
 	});
 
-	return { chunkx, chunkz, grid, chunk, sky, modeldata, chunkroot, chunkSize, locRenders };
+	return { chunkx, chunkz, grid, chunk, sky, modeldata, chunkroot, chunkSize, locRenders, minimapatlas };
 }
 
-type SimpleTexturePackerAlloc = { u: number, v: number, usize: number, vsize: number, x: number, y: number, repeatWidth: number, repeatHeight: number, totalpixels: number, img: CanvasImage }
-
-class SimpleTexturePacker {
-	padsize = 32;//was still bleeding at 16
+type FloorAtlasAlloc = { u: number, v: number, usize: number, vsize: number, x: number, y: number, repeat: number, repeatWidth: number, repeatHeight: number, avgcolor: number[] }
+type FloorAtlasPlacement = { id: number, img: ImageData, alloc: FloorAtlasAlloc };
+type SkylineSegment = { x: number, y: number, width: number };
+
+/**
+ * Floor texture atlas using skyline packing, the pixels are written straight into the typed array
+ * of a DataTexture so no canvas is needed. Entries are never moved once placed, so the uvs baked
+ * into older floor meshes stay valid while later chunks append their textures to the same atlas.
+ */
+class FloorTextureAtlas {
+	static readonly sharedSize = 2048;
 	width: number;
 	height: number;
-	allocs: SimpleTexturePackerAlloc[] = [];
-	map = new Map<number, SimpleTexturePackerAlloc>()
-	allocx = 0;
-	allocy = 0;
-	allocLineHeight = 0;
-	result: HTMLCanvasElement | null = null;
-	resultSource: THREE.Texture | null = null;
+	map = new Map<number, FloorAtlasAlloc>();
+	//includes entries that were replaced by a larger repeat in map
+	allocs: FloorAtlasAlloc[] = [];
+	pixels: Uint8Array | null = null;
+	//sorted by x and spans the full width, y is the lowest free row above the segment
+	private skyline: SkylineSegment[];
+	private texture: THREE.DataTexture | null = null;
+	private dirty = false;
+
 	constructor(width: number, height: number) {
 		this.width = width;
 		this.height = height;
+		this.skyline = [{ x: 0, y: 0, width }];
+	}
+
+	//each mip level doubles the footprint of a texel, so pad up to the level where the texture
+	//is 4px wide and align allocations to the same power of two so mip texels don't straddle the edge
+	static padSize(img: ImageData) {
+		let size = Math.min(img.width, img.height);
+		return Math.max(4, Math.min(32, 1 << Math.max(0, Math.floor(Math.log2(size)) - 2)));
+	}
+
+	/**
+	 * Adds all textures that aren't in the atlas yet, either all of them fit or the atlas is left untouched
+	 */
+	addTextures(textures: [number, { img: ImageData, repeat: number }][]) {
+		let missing = textures.filter(([id, q]) => (this.map.get(id)?.repeat ?? 0) < q.repeat);
+		if (missing.length == 0) { return true; }
+		//tallest first works best for skyline packing
+		missing.sort((a, b) => b[1].img.height * b[1].repeat - a[1].img.height * a[1].repeat);
+		let skyline = this.skyline.map(q => ({ ...q }));
+		let placed: FloorAtlasPlacement[] = [];
+		for (let [id, { img, repeat }] of missing) {
+			let pad = FloorTextureAtlas.padSize(img);
+			let repeatWidth = Math.floor(img.width * repeat);
+			let repeatHeight = Math.floor(img.height * repeat);
+			let pos = this.findPosition(skyline, repeatWidth + 2 * pad, repeatHeight + 2 * pad, pad);
+			if (!pos) { return false; }
+			placed.push({
+				id,
+				img,
+				alloc: {
+					u: (pos.x + pad) / this.width,
+					v: (pos.y + pad) / this.height,
+					usize: img.width / this.width,
+					vsize: img.height / this.height,
+					x: pos.x + pad,
+					y: pos.y + pad,
+					repeat,
+					repeatWidth,
+					repeatHeight,
+					avgcolor: averageColor(img)
+				}
+			});
+		}
+		this.skyline = skyline;
+		this.pixels ??= new Uint8Array(this.width * this.height * 4);
+		for (let { id, img, alloc } of placed) {
+			this.blit(img, alloc);
+			this.allocs.push(alloc);
+			//chunks that used a smaller repeat of this texture keep pointing at the old entry
+			this.map.set(id, alloc);
+		}
+		this.dirty = true;
+		return true;
 	}
 
-	addTexture(id: number, img: CanvasImage, repeat: number) {
-		if (this.result != null) {
-			this.result = null;
-			console.log("adding textures to atlas after creation of texture");
-		}
-		let repeatWidth = Math.floor(img.width * repeat);
-		let repeatHeight = Math.floor(img.height * repeat);
-		let sizex = repeatWidth + 2 * this.padsize;
-		let sizey = repeatHeight + 2 * this.padsize;
-		if (this.allocx + sizex > this.width) {
-			this.allocx = 0;
-			this.allocy += this.allocLineHeight;
-			this.allocLineHeight = 0;
-		}
-		this.allocLineHeight = Math.max(this.allocLineHeight, sizey);
-		if (this.allocy + this.allocLineHeight > this.height) {
-			return false;
-		}
-		let alloc: SimpleTexturePackerAlloc = {
-			u: (this.allocx + this.padsize) / this.width,
-			v: (this.allocy + this.padsize) / this.height,
-			usize: img.width / this.width,
-			vsize: img.height / this.height,
-			x: this.allocx + this.padsize,
-			y: this.allocy + this.padsize,
-			repeatWidth: repeatWidth,
-			repeatHeight: repeatHeight,
-			totalpixels: (this.padsize + repeatWidth + this.padsize) * (this.padsize + repeatHeight + this.padsize),
-			img
-		};
-		this.allocs.push(alloc);
-		this.allocx += sizex;
-		this.map.set(id, alloc);
-		return true;
+	//bottom-left heuristic, finds the lowest position and reserves it in the skyline
+	private findPosition(skyline: SkylineSegment[], width: number, height: number, align: number) {
+		let bestx = -1;
+		let besty = Infinity;
+		for (let seg of skyline) {
+			let x = Math.ceil(seg.x / align) * align;
+			if (x + width > this.width) { break; }
+			let y = 0;
+			for (let other of skyline) {
+				if (other.x >= x + width) { break; }
+				if (other.x + other.width > x) { y = Math.max(y, other.y); }
+			}
+			y = Math.ceil(y / align) * align;
+			if (y + height <= this.height && y < besty) {
+				bestx = x;
+				besty = y;
+			}
+		}
+		if (bestx == -1) { return null; }
+
+		//replace the covered part of the skyline with the top of the new rect
+		let x1 = bestx + width;
+		let newsegs: SkylineSegment[] = [];
+		for (let seg of skyline) {
+			let segend = seg.x + seg.width;
+			if (segend <= bestx || seg.x >= x1) {
+				newsegs.push(seg);
+				continue;
+			}
+			if (seg.x < bestx) { newsegs.push({ x: seg.x, y: seg.y, width: bestx - seg.x }); }
+			if (seg.x <= bestx) { newsegs.push({ x: bestx, y: besty + height, width }); }
+			if (segend > x1) { newsegs.push({ x: x1, y: seg.y, width: segend - x1 }); }
+		}
+		//merge neighbours at the same height to keep the skyline short
+		skyline.length = 0;
+		for (let seg of newsegs) {
+			let prev = skyline[skyline.length - 1];
+			if (prev && prev.y == seg.y) {
+				prev.width += seg.width;
+			} else {
+				skyline.push(seg);
+			}
+		}
+		return { x: bestx, y: besty };
+	}
+
+	//copies the repeated texture including a wrapped border of padsize around it
+	private blit(img: ImageData, alloc: FloorAtlasAlloc) {
+		let pixels = this.pixels!;
+		let pad = FloorTextureAtlas.padSize(img);
+		let src = img.data;
+		for (let y = -pad; y < alloc.repeatHeight + pad; y++) {
+			let srcrow = posmod(y, img.height) * img.width;
+			let dstrow = (alloc.y + y) * this.width + alloc.x;
+			let xend = alloc.repeatWidth + pad;
+			for (let x = -pad; x < xend;) {
+				let srcx = posmod(x, img.width);
+				let len = Math.min(xend - x, img.width - srcx);
+				pixels.set(src.subarray((srcrow + srcx) * 4, (srcrow + srcx + len) * 4), (dstrow + x) * 4);
+				x += len;
+			}
+		}
+	}
+
+	//used to bake textures into vertex colors, uv is in atlas units
+	averageColorAt(u: number, v: number) {
+		let x = u * this.width;
+		let y = v * this.height;
+		for (let alloc of this.allocs) {
+			if (x >= alloc.x && x <= alloc.x + alloc.repeatWidth && y >= alloc.y && y <= alloc.y + alloc.repeatHeight) {
+				return alloc.avgcolor;
+			}
+		}
+		return null;
 	}
-	convertToThreeTexture() {
-		return this.resultSource ??= (() => {
-			let map = new THREE.CanvasTexture(this.convert());
-			map.flipY = false;//FALFALSEFLASEFALSE WHY IS THIS ON BY DEFAULT
+
+	//the same texture object is handed out to every chunk, it is reuploaded only if textures were added since
+	getTexture() {
+		if (!this.texture) {
+			this.pixels ??= new Uint8Array(this.width * this.height * 4);
+			let map = new THREE.DataTexture(this.pixels, this.width, this.height, THREE.RGBAFormat);
+			map.flipY = false;
 			map.magFilter = THREE.LinearFilter;
 			map.minFilter = THREE.LinearMipMapNearestFilter;
 			map.generateMipmaps = true;
 			map.colorSpace = THREE.SRGBColorSpace;
-			return map;
-		})();
+			this.texture = map;
+			this.dirty = true;
+		}
+		if (this.dirty) {
+			this.texture.needsUpdate = true;
+			this.dirty = false;
+		}
+		return this.texture;
 	}
-	convert() {
-		if (this.result) { return this.result; }
-		let cnv = document.createElement("canvas");
-		cnv.width = this.width;
-		cnv.height = this.height;
-		let ctx = cnv.getContext("2d", { willReadFrequently: true })!;
+}
 
-		let drawSubimg = (src: CanvasImage, destx: number, desty: number, srcx = 0, srcy = 0, width = src.width, height = src.height) => {
-			ctx.drawImage(src, srcx, srcy, width, height, destx, desty, width, height);
-		}
+function averageColor(img: ImageData) {
+	let r = 0, g = 0, b = 0;
+	let pixels = img.width * img.height;
+	for (let i = 0; i < pixels * 4; i += 4) {
+		r += img.data[i + 0];
+		g += img.data[i + 1];
+		b += img.data[i + 2];
+	}
+	return [r / pixels, g / pixels, b / pixels];
+}
 
-		// let usedpixels = this.allocs.reduce((a, v) => a + v.totalpixels, 0);
-		// let texpixels = this.width * this.height;
-		// console.log("floor texatlas imgs", this.allocs.length, `size: ${this.width}x${this.height}`, "size (kb)", +(texpixels / 1024).toFixed(0), "used (kb)", +(usedpixels / 1024).toFixed(0), "%", +(usedpixels / texpixels * 100).toFixed(0));
-		for (let alloc of this.allocs) {
-			let xx1 = -this.padsize;
-			let xx2 = alloc.repeatWidth + this.padsize
-			let yy1 = -this.padsize;
-			let yy2 = alloc.repeatHeight + this.padsize;
-
-			for (let y = yy1; y < yy2; y = nexty) {
-				var nexty = Math.min(yy2, Math.ceil((y + 1) / alloc.img.height) * alloc.img.height);
-				for (let x = xx1; x < xx2; x = nextx) {
-					var nextx = Math.min(xx2, Math.ceil((x + 1) / alloc.img.width) * alloc.img.width);
-
-					drawSubimg(alloc.img,
-						alloc.x + x,
-						alloc.y + y,
-						posmod(x, alloc.img.width),
-						posmod(y, alloc.img.height),
-						nextx - x,
-						nexty - y
-					);
+//neighbouring chunks mostly use the same floor textures, so they share an atlas per scene
+const sharedFloorAtlases = new WeakMap<ThreejsSceneCache, FloorTextureAtlas>();
 
-				}
-			}
-		}
-		this.result = cnv;
-		return cnv;
+function getFloorAtlas(scene: ThreejsSceneCache, textures: [number, { img: ImageData, repeat: number }][]) {
+	let shared = sharedFloorAtlases.get(scene);
+	if (shared?.addTextures(textures)) {
+		return shared;
+	}
+	//start a new shared atlas, chunks that use the old one keep their own reference to it
+	let fresh = new FloorTextureAtlas(FloorTextureAtlas.sharedSize, FloorTextureAtlas.sharedSize);
+	if (fresh.addTextures(textures)) {
+		sharedFloorAtlases.set(scene, fresh);
+		return fresh;
+	}
+	//too large to share, give this chunk its own atlas
+	let sizelist: [number, number][] = [
+		[2048, 4096],
+		[4096, 4096]
+	];
+	let atlas!: FloorTextureAtlas;
+	for (let size of sizelist) {
+		atlas = new FloorTextureAtlas(size[0], size[1]);
+		if (atlas.addTextures(textures)) { break; }
 	}
+	return atlas;
 }
 
 export type PlacedMeshBase<T> = {
@@ -1385,7 +1502,9 @@ export type PlacedModel = {
 	hasVertexAlpha: boolean,
 	minimapVariant: boolean,
 	overlayIndex: number,
-	groupid: string
+	groupid: string,
+	//models have different materials which are packed in this atlas
+	atlas?: MinimapLocAtlas
 }
 
 type MapsquareLocation = {
@@ -2009,7 +2128,7 @@ function mapsquareCollisionToThree(grid: TileGrid, chunk: ChunkData, level: numb
 	return model;
 }
 
-export async function generateLocationMeshgroups(scene: ThreejsSceneCache, locbases: WorldLocation[], minimap = false) {
+export async function generateLocationMeshgroups(scene: ThreejsSceneCache, locbases: WorldLocation[], minimap = false, lod = 0) {
 	let loadedmodels = new Map<number, ModelData>();
 
 	let matmeshes: Map<string, Map<number, PlacedModel>> = new Map();
@@ -2045,6 +2164,9 @@ export async function generateLocationMeshgroups(scene: ThreejsSceneCache, locba
 			let model = loadedmodels.get(modelinst.model)!;
 			for (let rawmesh of model.meshes) {
 				let modified = modifyMesh(rawmesh, obj.mods);
+				if (lod > 0) {
+					modified = { ...modified, indices: simplifiedMeshIndices(modified, lod) };
+				}
 				let matkey = materialCacheKey(modified.materialId, modified.hasVertexAlpha, minimap);
 				let group = matmeshes.get(obj.extras.modelgroup);
 				if (!group) {
@@ -2082,11 +2204,89 @@ export async function generateLocationMeshgroups(scene: ThreejsSceneCache, locba
 	return { byMaterial, byLogical };
 }
 
+/**
+ * Merges the minimap loc groups of a chunk into one group per alpha mode, with all their textures
+ * packed into a shared atlas. Groups that can't use the atlas are returned as is.
+ */
+async function minimapAtlasMeshgroups(scene: ThreejsSceneCache, groups: PlacedModel[]) {
+	if (scene.textureType == "none") { return groups; }
+	let matids = new Set(groups.map(q => q.materialId));
+	let textures = await Promise.all([...matids].map(async matid => {
+		let matmeta = scene.engine.getMaterialData(matid);
+		//untextured materials keep their own material to match the original minimap exactly
+		if (typeof matmeta.textures.diffuse == "undefined") { return null; }
+		let img = await (await scene.getTextureFile("diffuse", matmeta.textures.diffuse, matmeta.stripDiffuseAlpha)).toImageData();
+		return { matid, matmeta, img };
+	}));
+	let atlas: MinimapLocAtlas | null = null;
+	for (let tex of textures) {
+		if (!tex) { continue; }
+		atlas ??= new MinimapLocAtlas();
+		//materials that don't fit keep their own material since they get no atlas entry
+		if (!atlas.addMaterial(tex.matid, tex.matmeta, tex.img)) {
+			console.warn(`minimap loc material ${tex.matid} doesn't fit in atlas, using its own material`);
+		}
+	}
+	//nothing to share, don't allocate an empty atlas texture
+	if (!atlas || atlas.materialCount == 0) { return groups; }
+	if (!atlas.build()) {
+		console.warn("minimap loc textures don't fit in atlas, falling back to materials");
+		return groups;
+	}
+
+	let batches = new Map<string, PlacedModel>();
+	let res: PlacedModel[] = [];
+	for (let group of groups) {
+		let entry = atlas.entries.get(group.materialId);
+		if (!entry) {
+			res.push(group);
+			continue;
+		}
+		let { alphamode, alphacutoff } = entry.matmeta;
+		let key = `${group.groupid}-${group.hasVertexAlpha}-${alphamode}-${alphacutoff}`;
+		let batch = getOrInsert(batches, key, () => ({
+			...group,
+			models: [],
+			material: { mat: atlas!.getMaterial(alphamode, alphacutoff), matmeta: { ...defaultMaterial(), alphamode, alphacutoff } },
+			atlas: atlas!
+		}));
+		batch.models.push(...group.models);
+	}
+	res.push(...batches.values());
+	return res;
+}
+
+/**
+ * Mesh consisting of multiple loc models that can be hidden individually. Hiding only flips a bit,
+ * the index buffer is compacted lazily right before the next render. Compaction starts at the first
+ * section that changed since the last one and only that tail of the index buffer is uploaded.
+ */
 class RSBatchMesh extends THREE.Mesh {
 	renderSections: ThreeJsRenderSection[] = [];
+	//one bit per section
+	private hiddenMask = new Uint32Array(0);
+	//copy of the index buffer in its original layout, only allocated once something gets hidden
+	private sourceIndices: THREE.TypedArray | null = null;
+	//offset of each section in the compacted index buffer as of the last compaction
+	private drawOffsets = new Int32Array(0);
+	private firstDirtySection = -1;
+
 	constructor(geo?: THREE.BufferGeometry, mat?: THREE.Material | THREE.Material[]) {
 		super(geo, mat);
 	}
+	addSection(startindex: number, endindex: number, startvertex: number, endvertex: number) {
+		let section: ThreeJsRenderSection = {
+			mesh: this,
+			sectionindex: this.renderSections.length,
+			startindex,
+			endindex,
+			startvertex,
+			endvertex,
+			hidden: false
+		};
+		this.renderSections.push(section);
+		return section;
+	}
 	cloneSection(section: ThreeJsRenderSection) {
 		let geo = new THREE.BufferGeometry();
 		for (let attrname in this.geometry.attributes) {
@@ -2094,61 +2294,201 @@ class RSBatchMesh extends THREE.Mesh {
 			let cloned = new BufferAttribute(attr.array.slice(section.startvertex * attr.itemSize, section.endvertex * attr.itemSize), attr.itemSize, attr.normalized);
 			geo.setAttribute(attrname, cloned);
 		}
-		let indexarr = this.geometry.index!.array.slice(section.startindex, section.endindex);
+		let indexarr = (this.sourceIndices ?? this.geometry.index!.array).slice(section.startindex, section.endindex);
 		for (let i = 0; i < indexarr.length; i++) { indexarr[i] -= section.startvertex; }
 		geo.setIndex(new THREE.BufferAttribute(indexarr, 1));
 		let clone = new RSBatchMesh(geo, this.material);
-		let newsection: ThreeJsRenderSection = {
-			mesh: clone,
+		return clone.addSection(0, section.endindex - section.startindex, 0, section.endvertex - section.startvertex);
+	}
+	setSectionHide(section: ThreeJsRenderSection, hide: boolean) {
+		if (section.hidden == hide) { return; }
+		if (!this.geometry.index) { throw new Error("unexpected"); }
+		section.hidden = hide;
+		let nsections = this.renderSections.length;
+		if (!this.sourceIndices) {
+			this.sourceIndices = this.geometry.index.array.slice();
+			this.hiddenMask = new Uint32Array((nsections + 31) >> 5);
+			this.drawOffsets = new Int32Array(nsections);
+			for (let i = 0; i < nsections; i++) { this.drawOffsets[i] = this.renderSections[i].startindex; }
+		}
+		let i = section.sectionindex;
+		if (hide) {
+			this.hiddenMask[i >> 5] |= 1 << (i & 31);
+		} else {
+			this.hiddenMask[i >> 5] &= ~(1 << (i & 31));
+		}
+		if (this.firstDirtySection == -1 || i < this.firstDirtySection) {
+			this.firstDirtySection = i;
+		}
+	}
+	/**
+	 * Writes the visible sections back to back into the index buffer, called automatically before
+	 * rendering. Sections before the first changed one are already in place and are skipped.
+	 */
+	updateSections() {
+		if (this.firstDirtySection == -1) { return; }
+		let index = this.geometry.index!;
+		let src = this.sourceIndices!;
+		let dst = index.array;
+		let sections = this.renderSections;
+		let writestart = this.drawOffsets[this.firstDirtySection];
+		let out = writestart;
+		//consecutive visible sections are copied as one run
+		let runstart = -1;
+		let runend = -1;
+		for (let i = this.firstDirtySection; i < sections.length; i++) {
+			let section = sections[i];
+			this.drawOffsets[i] = out + (runend - runstart);
+			if (this.hiddenMask[i >> 5] & (1 << (i & 31))) { continue; }
+			if (section.startindex != runend) {
+				if (runend > runstart) { dst.set(src.subarray(runstart, runend), out); }
+				out += runend - runstart;
+				runstart = section.startindex;
+				this.drawOffsets[i] = out;
+			}
+			runend = section.endindex;
+		}
+		if (runend > runstart) { dst.set(src.subarray(runstart, runend), out); }
+		out += runend - runstart;
+		this.firstDirtySection = -1;
+
+		this.geometry.setDrawRange(0, out);
+		if (out > writestart) {
+			index.addUpdateRange(writestart, out - writestart);
+			index.needsUpdate = true;
+		}
+	}
+	onBeforeRender() {
+		this.updateSections();
+	}
+}
+
+/**
+ * Placements of one loc mesh sharing a single geometry, uses the same section api as RSBatchMesh.
+ * Hidden instances get a zero matrix, which only uploads the 16 floats of that instance.
+ */
+class RSInstancedMesh extends THREE.InstancedMesh {
+	renderSections: ThreeJsRenderSection[] = [];
+	//placement matrices, kept to restore hidden instances
+	private matrices: Float32Array;
+
+	constructor(geo: THREE.BufferGeometry, mat: THREE.Material | THREE.Material[], count: number) {
+		super(geo, mat, count);
+		this.matrices = new Float32Array(count * 16);
+	}
+	addInstance(matrix: THREE.Matrix4) {
+		let index = this.renderSections.length;
+		this.setMatrixAt(index, matrix);
+		matrix.toArray(this.matrices, index * 16);
+		let section: ThreeJsRenderSection = {
+			mesh: this,
+			sectionindex: index,
 			startindex: 0,
-			endindex: section.endindex - section.startindex,
+			endindex: this.geometry.index!.count,
 			startvertex: 0,
-			endvertex: section.endvertex - section.startvertex,
+			endvertex: this.geometry.attributes.position.count,
 			hidden: false
 		};
-		clone.renderSections.push(newsection);
-		return newsection;
+		this.renderSections.push(section);
+		return section;
+	}
+	cloneSection(section: ThreeJsRenderSection) {
+		//share the vertex data, but the clone needs its own index buffer since RSBatchMesh edits it
+		let geo = new THREE.BufferGeometry();
+		for (let attrname in this.geometry.attributes) {
+			geo.setAttribute(attrname, this.geometry.attributes[attrname]);
+		}
+		geo.setIndex(new THREE.BufferAttribute(this.geometry.index!.array.slice(), 1));
+		let clone = new RSBatchMesh(geo, this.material);
+		clone.matrixAutoUpdate = false;
+		clone.matrix.fromArray(this.matrices, section.sectionindex * 16);
+		clone.matrixWorldNeedsUpdate = true;
+		return clone.addSection(0, section.endindex, 0, section.endvertex);
 	}
 	setSectionHide(section: ThreeJsRenderSection, hide: boolean) {
 		if (section.hidden == hide) { return; }
 		section.hidden = hide;
-		let drawend = this.geometry.drawRange.count;
-		if (this.geometry.drawRange.start != 0) { throw new Error("unexpected"); }
-		if (!this.geometry.index) { throw new Error("unexpected"); }
-		if (!isFinite(drawend)) { drawend = this.geometry.index.count }
-
-		let len = section.endindex - section.startindex;
-		let newoffset = (hide ? drawend - len : drawend);
-
+		let offset = section.sectionindex * 16;
+		let arr = this.instanceMatrix.array as Float32Array;
 		if (hide) {
-			let tmp = this.geometry.index.array.slice(section.startindex, section.endindex);
-			this.geometry.index.array.copyWithin(section.startindex, section.endindex, drawend);
-			this.geometry.index.array.set(tmp, newoffset);
+			arr.fill(0, offset, offset + 16);
 		} else {
-			let tmp = this.geometry.index.array.slice(section.startindex, section.endindex);
-			this.geometry.index.array.copyWithin(drawend + len, drawend, section.startindex);
-			this.geometry.index.array.set(tmp, newoffset);
+			arr.set(this.matrices.subarray(offset, offset + 16), offset);
 		}
-
-		let front = (hide ? section.startindex : newoffset);
-		let back = (hide ? drawend : section.endindex);
-		let changediff = (hide ? -len : len);
-		for (let i = 0; i < this.renderSections.length; i++) {
-			let other = this.renderSections[i];
-			if (other == section) { continue; }
-			if (other.startindex < front || other.startindex >= back) { continue; }
-			other.startindex += changediff;
-			other.endindex += changediff;
-		}
-		section.startindex = newoffset;
-		section.endindex = newoffset + len;
-
-		this.geometry.setDrawRange(0, drawend + changediff);
-		this.geometry.index.needsUpdate = true;
+		this.instanceMatrix.addUpdateRange(offset, 16);
+		this.instanceMatrix.needsUpdate = true;
 	}
 }
 
-export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx: number, rootz: number, material: ParsedMaterial, locrenders: Map<WorldLocation, ThreeJsRenderSection[]>) {
+/**
+ * Gives repeated models their own InstancedMesh and bakes all other placements of the group into one
+ * merged mesh. Placements that follow the floor or are mirrored can't share geometry and are always baked.
+ */
+export function meshgroupToThreeInstanced(grid: TileGrid, meshgroup: PlacedModel, rootx: number, rootz: number, material: ParsedMaterial, locrenders: Map<WorldLocation, ThreeJsRenderSection[]>) {
+	//minimap groups are drawn by the soft renderer as well, which only knows plain meshes
+	if (meshgroup.minimapVariant || meshgroup.atlas) {
+		return [meshgroupsToThree(grid, meshgroup, rootx, rootz, material, locrenders)];
+	}
+	//indices identify the model mesh and lod, color is only cloned when recolored
+	let buckets = new Map<BufferAttribute, Map<BufferAttribute, PlacedMesh[]>>();
+	let baked: PlacedMesh[] = [];
+	for (let m of meshgroup.models) {
+		if (m.extras.modeltype != "location" || m.morph.placementMode != "simple" || getMorphMatrix(m.morph, 0, 0).determinant() < 0) {
+			baked.push(m);
+			continue;
+		}
+		let bycolor = getOrInsert(buckets, m.model.indices, () => new Map());
+		getOrInsert(bycolor, m.model.attributes.color ?? m.model.attributes.pos, () => []).push(m);
+	}
+	const minInstances = 4;
+	let res: THREE.Mesh[] = [];
+	for (let bycolor of buckets.values()) {
+		for (let models of bycolor.values()) {
+			if (models.length < minInstances) {
+				baked.push(...models);
+				continue;
+			}
+			let template = meshgroupsToThree(grid, { ...meshgroup, models: [models[0]] }, rootx, rootz, material, new Map(), true);
+			let instanced = new RSInstancedMesh(template.geometry, template.material, models.length);
+			let matrix = new THREE.Matrix4();
+			for (let i = 0; i < models.length; i++) {
+				let morph = models[i].morph;
+				//same transform as transformVertexPositions for simple placements
+				let centery = getTileHeight(grid, morph.originx / tiledimensions, morph.originz / tiledimensions, morph.level);
+				matrix.makeTranslation(0, centery, 0).multiply(getMorphMatrix(morph, rootx, rootz));
+				let section = instanced.addInstance(matrix);
+				let extras = models[i].extras;
+				if (extras.modeltype == "location") {
+					getOrInsert(locrenders, extras.locationInstance, () => []).push(section);
+				}
+			}
+			let clickable: ModelExtras = {
+				modeltype: "locationgroup",
+				modelgroup: meshgroup.groupid,
+				isclickable: true,
+				subranges: [],
+				searchPeers: false,
+				subobjects: models.map(q => q.extras)
+			};
+			instanced.userData = clickable;
+			instanced.renderOrder = meshgroup.overlayIndex;
+			instanced.matrixAutoUpdate = false;
+			instanced.updateMatrix();
+			instanced.computeBoundingSphere();
+			instanced.name = "instanced locs";
+			res.push(instanced);
+		}
+	}
+	//keep the original order so sections stay grouped per placement
+	let bakedset = new Set(baked);
+	baked = meshgroup.models.filter(q => bakedset.has(q));
+	if (baked.length != 0) {
+		res.push(meshgroupsToThree(grid, { ...meshgroup, models: baked }, rootx, rootz, material, locrenders));
+	}
+	return res;
+}
+
+export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx: number, rootz: number, material: ParsedMaterial, locrenders: Map<WorldLocation, ThreeJsRenderSection[]>, untransformed = false) {
 	let totalverts = meshgroup.models.reduce((a, v) => a + v.model.vertexend - v.model.vertexstart, 0);
 	let totalindices = meshgroup.models.reduce((a, v) => a + v.model.indices.count, 0);
 	let vertalphas = meshgroup.models.reduce((a, v) => a + +v.model.hasVertexAlpha, 0);
@@ -2174,20 +2514,13 @@ export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx:
 	let indexcounts: number[] = [];
 	for (let m of meshgroup.models) {
 		let mesh = m.model;
-		let matrix = getMorphMatrix(m.morph, rootx, rootz);
+		//untransformed meshes are used as instance template, the transform is applied per instance
+		let matrix = (untransformed ? new THREE.Matrix4() : getMorphMatrix(m.morph, rootx, rootz));
 		let vertexcount = mesh.vertexend - mesh.vertexstart;
 		let indexcount = mesh.indices.count;
 		indexcounts.push(indexindex);
 
-		let section: ThreeJsRenderSection = {
-			mesh: mergedmesh,
-			startindex: indexindex,
-			endindex: indexindex + indexcount,
-			startvertex: vertindex,
-			endvertex: vertindex + vertexcount,
-			hidden: false
-		};
-		mergedmesh.renderSections.push(section);
+		let section = mergedmesh.addSection(indexindex, indexindex + indexcount, vertindex, vertindex + vertexcount);
 		if (m.extras.modeltype == "location") {
 			let v = getOrInsert(locrenders, m.extras.locationInstance, () => []);
 			v.push(section);
@@ -2216,7 +2549,14 @@ export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx:
 		}
 
 		//position
-		transformVertexPositions(mesh.attributes.pos, m.morph, grid, m.maxy - m.miny, rootx, rootz, pos, vertindex, mesh.vertexstart, mesh.vertexend);
+		if (untransformed) {
+			let oldpos = mesh.attributes.pos;
+			for (let i = 0; i < vertexcount; i++) {
+				pos.setXYZ(vertindex + i, oldpos.getX(mesh.vertexstart + i), oldpos.getY(mesh.vertexstart + i), oldpos.getZ(mesh.vertexstart + i));
+			}
+		} else {
+			transformVertexPositions(mesh.attributes.pos, m.morph, grid, m.maxy - m.miny, rootx, rootz, pos, vertindex, mesh.vertexstart, mesh.vertexend);
+		}
 
 		//normals
 		{
@@ -2227,7 +2567,7 @@ export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx:
 				let [newbuf, newsuboffset, newstride] = getAttributeBackingStore(normals);
 				let oldoffset = mesh.vertexstart * oldstride + oldsuboffset;
 				let newoffset = vertindex * newstride + newsuboffset;
-				let rotation = new THREE.Matrix4().makeRotationFromQuaternion(m.morph.rotation)
+				let rotation = new THREE.Matrix4().makeRotationFromQuaternion(untransformed ? new THREE.Quaternion() : m.morph.rotation)
 				for (let i = 0; i < vertexcount; i++) {
 					let ii = newoffset + i * newstride;
 					let jj = oldoffset + i * oldstride;
@@ -2299,7 +2639,22 @@ export function meshgroupsToThree(grid: TileGrid, meshgroup: PlacedModel, rootx:
 		indexindex += indexcount;
 	}
 
-	applyMaterial(mergedmesh, material, meshgroup.minimapVariant);
+	if (meshgroup.atlas) {
+		//each model can have a different material, store its atlas slot per vertex
+		let slots = new BufferAttribute(new Uint8Array(totalverts * 2), 2);
+		for (let i = 0; i < meshgroup.models.length; i++) {
+			let section = mergedmesh.renderSections[i];
+			let entry = meshgroup.atlas.entries.get(meshgroup.models[i].model.materialId)!;
+			for (let vert = section.startvertex; vert < section.endvertex; vert++) {
+				slots.setXY(vert, entry.slotx, entry.sloty);
+			}
+			applyMaterialColorRange(col, section.startvertex, section.endvertex, entry.matmeta, meshgroup.minimapVariant);
+		}
+		mergedgeo.setAttribute("materialslot", slots);
+		mergedmesh.material = material.mat;
+	} else {
+		applyMaterial(mergedmesh, material, meshgroup.minimapVariant);
+	}
 
 	let clickable: ModelExtras = {
 		modeltype: "locationgroup",
@@ -2483,6 +2838,7 @@ function mapsquarePathMesh(grid: TileGrid, chunk: ChunkData, level: number): Flo
 		vertexstride: vertexstride,
 		//TODO i'm not actually using these, can get rid of it again
 		indices: new Uint32Array(indexslice),
+		indexed: false,
 		nvertices: vertexindex,
 		atlas: null,
 
@@ -2503,7 +2859,7 @@ function mapsquarePathMesh(grid: TileGrid, chunk: ChunkData, level: number): Flo
 }
 
 //TODO just turn this monster into a class
-function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: SimpleTexturePacker, keeptileinfo = false, mode: "default" | "wireframe" | "minimap" | "worldmap" = "default", drawWater = false) {
+function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: FloorTextureAtlas, keeptileinfo = false, mode: "default" | "wireframe" | "minimap" | "worldmap" = "default", drawWater = false) {
 	const showhidden = mode == "wireframe";
 	const worldmap = mode == "worldmap";
 	const isMinimap = mode == "minimap";
@@ -2610,7 +2966,7 @@ function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: S
 
 			if (i < polyprops.length) {
 				const subprop = polyprops[i];
-				let texdata: SimpleTexturePackerAlloc | undefined = undefined;
+				let texdata: FloorAtlasAlloc | undefined = undefined;
 				let whitemix = 0;
 				if (subprop && subprop.material != -1) {
 					let mat = grid.engine.getMaterialData(subprop.material);
@@ -2618,7 +2974,7 @@ function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: S
 					whitemix = mat.baseColorFraction;
 
 					if (mat.textures.diffuse) {
-						texdata = atlas.map.get(mat.textures.diffuse)!;
+						texdata = atlas.map.get(mat.textures.diffuse);
 					}
 				}
 				if (texdata) {
@@ -2813,6 +3169,8 @@ function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: S
 		vertexstride: vertexstride,
 		//TODO i'm not actually using these, can get rid of it again
 		indices: new Uint32Array(indexslice),
+		//only lod floors actually share vertices
+		indexed: false,
 		nvertices: vertexindex,
 		atlas: (mode != "worldmap" ? atlas : null),
 
@@ -2835,6 +3193,92 @@ function mapsquareMesh(grid: TileGrid, chunk: ChunkData, level: number, atlas: S
 
 type FloorMeshData = typeof mapsquareMesh extends (...args: any[]) => infer Q ? Q : never;
 
+/**
+ * Reduced detail floor for distant chunks. Textures aren't resolved at that distance anyway, so their
+ * average color is baked into the vertex colors. This lets neighbouring tiles weld into one surface
+ * which is then simplified and compacted into an indexed mesh. Each lod level targets a quarter of the triangles.
+ */
+function simplifyFloorMesh(floor: FloorMeshData, lod: number): FloorMeshData {
+	if (floor.nvertices == 0) { return floor; }
+	const stride = floor.vertexstride;
+	let bytes = floor.color.src as Uint8Array;
+	let ushorts = floor._RA_FLOORTEX_UV0.src as Uint16Array;
+	let floats = floor.pos.src as Float32Array;
+	let colorkeys = new Int32Array(floor.nvertices);
+	for (let i = 0; i < floor.nvertices; i++) {
+		let colpointer = i * stride + floor.color.offset;
+		let weightpointer = i * stride + floor._RA_FLOORTEX_WEIGHTS.offset;
+		let usescolorpointer = i * stride + floor._RA_FLOORTEX_USESCOLOR.offset;
+		let r = bytes[colpointer + 0];
+		let g = bytes[colpointer + 1];
+		let b = bytes[colpointer + 2];
+		let totalweight = 0;
+		let texr = 0, texg = 0, texb = 0;
+		for (let tex = 0; tex < 3; tex++) {
+			let weight = bytes[weightpointer + tex] / 255;
+			bytes[weightpointer + tex] = 0;
+			if (weight == 0 || !floor.atlas) { continue; }
+			let uvpointer = i * stride / 2 + floor._RA_FLOORTEX_UV0.offset + 2 * tex;
+			let avg = floor.atlas.averageColorAt(ushorts[uvpointer + 0] / 0x10000, ushorts[uvpointer + 1] / 0x10000);
+			if (!avg) { continue; }
+			//same mix as the floor shader, texture multiplied with vertex color depending on usescolor
+			let usescolor = bytes[usescolorpointer + tex] / 255;
+			texr += weight * avg[0] * (1 - usescolor + usescolor * r / 255);
+			texg += weight * avg[1] * (1 - usescolor + usescolor * g / 255);
+			texb += weight * avg[2] * (1 - usescolor + usescolor * b / 255);
+			totalweight += weight;
+		}
+		totalweight = Math.min(1, totalweight);
+		r = Math.round(texr + (1 - totalweight) * r);
+		g = Math.round(texg + (1 - totalweight) * g);
+		b = Math.round(texb + (1 - totalweight) * b);
+		bytes[colpointer + 0] = r;
+		bytes[colpointer + 1] = g;
+		bytes[colpointer + 2] = b;
+		colorkeys[i] = (r << 16) | (g << 8) | b;
+	}
+
+	let indices = simplifyMesh(floats, floor.pos.offset, stride / 4, floor.indices, {
+		targetIndexCount: Math.floor(floor.indices.length / (1 << (2 * lod)) / 3) * 3,
+		maxError: tiledimensions / 8 * (1 << lod),
+		weldKeys: colorkeys
+	});
+
+	//only keep the vertices that are still referenced
+	let vertexmap = new Int32Array(floor.nvertices).fill(-1);
+	let nvertices = 0;
+	for (let i = 0; i < indices.length; i++) {
+		let vert = indices[i];
+		if (vertexmap[vert] == -1) { vertexmap[vert] = nvertices++; }
+		indices[i] = vertexmap[vert];
+	}
+	let vertexbuffer = new Uint8Array(nvertices * stride);
+	for (let i = 0; i < floor.nvertices; i++) {
+		if (vertexmap[i] == -1) { continue; }
+		vertexbuffer.set(bytes.subarray(i * stride, (i + 1) * stride), vertexmap[i] * stride);
+	}
+	let vertexfloat = new Float32Array(vertexbuffer.buffer);
+	let vertexushort = new Uint16Array(vertexbuffer.buffer);
+
+	return {
+		...floor,
+		//tile info doesn't map to index ranges anymore
+		tileinfos: [],
+		indices,
+		indexed: true,
+		nvertices,
+		pos: { ...floor.pos, src: vertexfloat },
+		normal: { ...floor.normal, src: vertexfloat },
+		color: { ...floor.color, src: vertexbuffer },
+		_RA_FLOORTEX_UV0: { ...floor._RA_FLOORTEX_UV0, src: vertexushort },
+		_RA_FLOORTEX_UV1: { ...floor._RA_FLOORTEX_UV1, src: vertexushort },
+		_RA_FLOORTEX_UV2: { ...floor._RA_FLOORTEX_UV2, src: vertexushort },
+		_RA_FLOORTEX_WEIGHTS: { ...floor._RA_FLOORTEX_WEIGHTS, src: vertexbuffer },
+		_RA_FLOORTEX_USESCOLOR: { ...floor._RA_FLOORTEX_USESCOLOR, src: vertexbuffer },
+		extra: { ...floor.extra, subobjects: [], subranges: [] }
+	};
+}
+
 function floorToThree(scene: ThreejsSceneCache, floor: FloorMeshData) {
 	if (floor.nvertices == 0) { return undefined; }
 	let makeAttribute = (attr: FloorMeshData["pos"]) => {
@@ -2843,8 +3287,10 @@ function floorToThree(scene: ThreejsSceneCache, floor: FloorMeshData) {
 		return new THREE.InterleavedBufferAttribute(buf, attr.vecsize, attr.offset, attr.normalized);
 	}
 	let geo = new THREE.BufferGeometry();
-	//not actually used, remove this
-	// geo.index = new THREE.BufferAttribute(floor.indices, 1);
+	//only lod floors share vertices, the full detail floors are plain triangle lists
+	if (floor.indexed) {
+		geo.setIndex(new THREE.BufferAttribute(floor.indices, 1));
+	}
 	geo.setAttribute("position", makeAttribute(floor.pos));
 	geo.setAttribute("color", makeAttribute(floor.color));
 	geo.setAttribute("normal", makeAttribute(floor.normal));
@@ -2862,7 +3308,7 @@ function floorToThree(scene: ThreejsSceneCache, floor: FloorMeshData) {
 		mat.wireframe = true;
 	}
 	if (floor.atlas) {
-		let map = floor.atlas.convertToThreeTexture();
+		let map = floor.atlas.getTexture();
 		if (floor.mode == "minimap") {
 			if (floor.iswater) {
 				mat = minimapWaterMaterial(map) as any;
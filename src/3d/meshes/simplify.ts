@@ -0,0 +1,277 @@
+import { BufferAttribute } from "three";
+import { ModelMeshData } from "../modeldata";
+import { getAttributeBackingStore } from "./meshutils";
+
+//plane quadric stored as the upper triangle of the 4x4 matrix plus the summed triangle area
+const quadricSize = 11;
+
+export type SimplifyOptions = {
+    //stop once the index count drops below this
+    targetIndexCount: number,
+    //max distance in model units that a collapsed vertex may move away from the original surface
+    maxError: number,
+    //vertices only merge with vertices that have the same key, vertices at the same position
+    //with different keys form a seam and are never collapsed. Defaults to the vertex index, which
+    //locks every vertex of meshes that don't share vertices between faces, see meshWeldKeys
+    weldKeys?: ArrayLike<number>
+}
+
+function addPlaneQuadric(quadrics: Float64Array, vertex: number, nx: number, ny: number, nz: number, d: number, area: number) {
+    let i = vertex * quadricSize;
+    quadrics[i + 0] += area * nx * nx;
+    quadrics[i + 1] += area * nx * ny;
+    quadrics[i + 2] += area * nx * nz;
+    quadrics[i + 3] += area * nx * d;
+    quadrics[i + 4] += area * ny * ny;
+    quadrics[i + 5] += area * ny * nz;
+    quadrics[i + 6] += area * ny * d;
+    quadrics[i + 7] += area * nz * nz;
+    quadrics[i + 8] += area * nz * d;
+    quadrics[i + 9] += area * d * d;
+    quadrics[i + 10] += area;
+}
+
+//squared distance error of moving both a and b to position (x,y,z)
+function quadricError(q: Float64Array, a: number, b: number, x: number, y: number, z: number) {
+    let i = a * quadricSize;
+    let j = b * quadricSize;
+    let err = (q[i + 0] + q[j + 0]) * x * x + 2 * (q[i + 1] + q[j + 1]) * x * y + 2 * (q[i + 2] + q[j + 2]) * x * z + 2 * (q[i + 3] + q[j + 3]) * x
+        + (q[i + 4] + q[j + 4]) * y * y + 2 * (q[i + 5] + q[j + 5]) * y * z + 2 * (q[i + 6] + q[j + 6]) * y
+        + (q[i + 7] + q[j + 7]) * z * z + 2 * (q[i + 8] + q[j + 8]) * z
+        + (q[i + 9] + q[j + 9]);
+    let area = q[i + 10] + q[j + 10];
+    return (area > 0 ? Math.abs(err) / area : 0);
+}
+
+/**
+ * Quadric edge collapse simplification. Vertices are never moved or created, edges are collapsed onto
+ * one of their existing endpoints, so the returned indices point into the same vertex buffer and all
+ * other attributes stay valid. Open borders and attribute seams are kept in place to avoid cracks.
+ * Collapses are done in passes ordered by cost where each vertex can only be touched once per pass.
+ */
+export function simplifyMesh(positions: ArrayLike<number>, posoffset: number, posstride: number, indices: ArrayLike<number>, opts: SimplifyOptions) {
+    let vertexcount = 0;
+    for (let i = 0; i < indices.length; i++) { vertexcount = Math.max(vertexcount, indices[i] + 1); }
+
+    //weld vertices with the same position and key, seams are positions shared by multiple welded vertices
+    let weld = new Int32Array(vertexcount).fill(-1);
+    let poscount = new Map<string, number>();
+    let weldmap = new Map<string, number>();
+    let welded: number[] = [];
+    for (let i = 0; i < indices.length; i++) {
+        let v = indices[i];
+        if (weld[v] != -1) { continue; }
+        let p = v * posstride + posoffset;
+        let poskey = `${positions[p]},${positions[p + 1]},${positions[p + 2]}`;
+        let key = `${poskey},${opts.weldKeys ? opts.weldKeys[v] : v}`;
+        let id = weldmap.get(key);
+        if (id == undefined) {
+            id = welded.length;
+            welded.push(v);
+            weldmap.set(key, id);
+            poscount.set(poskey, (poscount.get(poskey) ?? 0) + 1);
+        }
+        weld[v] = id;
+    }
+    let nverts = welded.length;
+    let locked = new Uint8Array(nverts);
+    let px = new Float64Array(nverts);
+    let py = new Float64Array(nverts);
+    let pz = new Float64Array(nverts);
+    for (let i = 0; i < nverts; i++) {
+        let p = welded[i] * posstride + posoffset;
+        px[i] = positions[p];
+        py[i] = positions[p + 1];
+        pz[i] = positions[p + 2];
+        if (poscount.get(`${px[i]},${py[i]},${pz[i]}`)! > 1) { locked[i] = 1; }
+    }
+
+    let tris: number[] = [];
+    for (let i = 0; i + 2 < indices.length; i += 3) {
+        let a = weld[indices[i]], b = weld[indices[i + 1]], c = weld[indices[i + 2]];
+        if (a == b || b == c || c == a) { continue; }
+        tris.push(a, b, c);
+    }
+
+    //border edges are only used by one triangle
+    let edgeuses = new Map<number, number>();
+    let edgekey = (a: number, b: number) => (a < b ? a * nverts + b : b * nverts + a);
+    for (let i = 0; i < tris.length; i += 3) {
+        for (let e = 0; e < 3; e++) {
+            let key = edgekey(tris[i + e], tris[i + (e + 1) % 3]);
+            edgeuses.set(key, (edgeuses.get(key) ?? 0) + 1);
+        }
+    }
+    for (let [key, uses] of edgeuses) {
+        if (uses == 1) {
+            locked[Math.floor(key / nverts)] = 1;
+            locked[key % nverts] = 1;
+        }
+    }
+
+    let quadrics = new Float64Array(nverts * quadricSize);
+    for (let i = 0; i < tris.length; i += 3) {
+        let a = tris[i], b = tris[i + 1], c = tris[i + 2];
+        let ux = px[b] - px[a], uy = py[b] - py[a], uz = pz[b] - pz[a];
+        let vx = px[c] - px[a], vy = py[c] - py[a], vz = pz[c] - pz[a];
+        let nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+        let len = Math.hypot(nx, ny, nz);
+        if (len == 0) { continue; }
+        nx /= len; ny /= len; nz /= len;
+        let d = -(nx * px[a] + ny * py[a] + nz * pz[a]);
+        let area = len / 2;
+        addPlaneQuadric(quadrics, a, nx, ny, nz, d, area);
+        addPlaneQuadric(quadrics, b, nx, ny, nz, d, area);
+        addPlaneQuadric(quadrics, c, nx, ny, nz, d, area);
+    }
+
+    let maxerrorsq = opts.maxError * opts.maxError;
+    let remap = new Int32Array(nverts);
+    let touched = new Uint8Array(nverts);
+    let targettris = Math.floor(opts.targetIndexCount / 3);
+    while (tris.length / 3 > targettris) {
+        //vertex to triangle adjacency
+        let adjoffsets = new Int32Array(nverts + 1);
+        for (let i = 0; i < tris.length; i++) { adjoffsets[tris[i] + 1]++; }
+        for (let i = 0; i < nverts; i++) { adjoffsets[i + 1] += adjoffsets[i]; }
+        let adjfill = adjoffsets.slice(0, nverts);
+        let adjtris = new Int32Array(tris.length);
+        for (let i = 0; i < tris.length; i++) { adjtris[adjfill[tris[i]]++] = (i / 3) | 0; }
+
+        let candidates: { from: number, to: number, cost: number }[] = [];
+        for (let i = 0; i < tris.length; i += 3) {
+            for (let e = 0; e < 3; e++) {
+                let a = tris[i + e], b = tris[i + (e + 1) % 3];
+                if (!locked[a]) { candidates.push({ from: a, to: b, cost: quadricError(quadrics, a, b, px[b], py[b], pz[b]) }); }
+                if (!locked[b]) { candidates.push({ from: b, to: a, cost: quadricError(quadrics, a, b, px[a], py[a], pz[a]) }); }
+            }
+        }
+        candidates.sort((a, b) => a.cost - b.cost);
+
+        for (let i = 0; i < nverts; i++) { remap[i] = i; }
+        touched.fill(0);
+        let tricount = tris.length / 3;
+        let collapses = 0;
+        for (let cand of candidates) {
+            if (tricount <= targettris || cand.cost > maxerrorsq) { break; }
+            let { from, to } = cand;
+            if (touched[from] || touched[to]) { continue; }
+            //reject if any triangle around the collapsed vertex flips over
+            let flips = false;
+            let removed = 0;
+            for (let j = adjoffsets[from]; j < adjoffsets[from + 1]; j++) {
+                let t = adjtris[j] * 3;
+                let a = tris[t], b = tris[t + 1], c = tris[t + 2];
+                if (a == to || b == to || c == to) { removed++; continue; }
+                let ux = px[b] - px[a], uy = py[b] - py[a], uz = pz[b] - pz[a];
+                let vx = px[c] - px[a], vy = py[c] - py[a], vz = pz[c] - pz[a];
+                let nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+                if (a == from) { a = to; } else if (b == from) { b = to; } else { c = to; }
+                ux = px[b] - px[a]; uy = py[b] - py[a]; uz = pz[b] - pz[a];
+                vx = px[c] - px[a]; vy = py[c] - py[a]; vz = pz[c] - pz[a];
+                let mx = uy * vz - uz * vy, my = uz * vx - ux * vz, mz = ux * vy - uy * vx;
+                if (nx * mx + ny * my + nz * mz <= 0) { flips = true; break; }
+            }
+            if (flips) { continue; }
+
+            remap[from] = to;
+            let qf = from * quadricSize, qt = to * quadricSize;
+            for (let k = 0; k < quadricSize; k++) { quadrics[qt + k] += quadrics[qf + k]; }
+            for (let j = adjoffsets[from]; j < adjoffsets[from + 1]; j++) {
+                let t = adjtris[j] * 3;
+                touched[tris[t]] = 1;
+                touched[tris[t + 1]] = 1;
+                touched[tris[t + 2]] = 1;
+            }
+            tricount -= removed;
+            collapses++;
+        }
+        if (collapses == 0) { break; }
+
+        let newtris: number[] = [];
+        for (let i = 0; i < tris.length; i += 3) {
+            let a = remap[tris[i]], b = remap[tris[i + 1]], c = remap[tris[i + 2]];
+            if (a == b || b == c || c == a) { continue; }
+            newtris.push(a, b, c);
+        }
+        tris = newtris;
+    }
+
+    let result = new Uint32Array(tris.length);
+    for (let i = 0; i < tris.length; i++) { result[i] = welded[tris[i]]; }
+    return result;
+}
+
+/**
+ * Weld keys for simplifyMesh that give vertices the same key when all attributes other than the position
+ * match. Most models store separate vertices per face, so welding on position and attributes is what
+ * connects the faces, while real uv, normal and color seams stay in place.
+ */
+export function meshWeldKeys(mesh: ModelMeshData) {
+    let attrs: BufferAttribute[] = [];
+    for (let [name, attr] of Object.entries(mesh.attributes)) {
+        if (name != "pos" && attr) { attrs.push(attr); }
+    }
+    let count = mesh.attributes.pos.count;
+    let keys = new Int32Array(count);
+    let keymap = new Map<string, number>();
+    for (let v = 0; v < count; v++) {
+        let key = "";
+        for (let attr of attrs) {
+            for (let c = 0; c < attr.itemSize; c++) { key += attr.getComponent(v, c) + ","; }
+        }
+        let id = keymap.get(key);
+        if (id == undefined) {
+            id = keymap.size;
+            keymap.set(key, id);
+        }
+        keys[v] = id;
+    }
+    return keys;
+}
+
+//generated lods are shared between all placements of the same model, keyed by the last cache lod
+//they continue from. Recolored copies share the entry, their seams are at the same vertices
+const simplifiedLods = new WeakMap<BufferAttribute, { lods: BufferAttribute[], weldkeys: Int32Array }>();
+
+/**
+ * Returns the indices of a model mesh `level` steps coarser than its current indices. The lods that come
+ * with the model in the cache are used first, past the last one each level is simplified to target half
+ * the triangles of the previous one. Used for distant map chunks.
+ */
+export function simplifiedMeshIndices(mesh: ModelMeshData, level: number) {
+    if (level <= 0) { return mesh.indices; }
+    let cachelods = mesh.indexLODs;
+    let start = cachelods.indexOf(mesh.indices);
+    if (start == -1) {
+        cachelods = [mesh.indices];
+        start = 0;
+    }
+    let target = start + level;
+    if (target < cachelods.length) { return cachelods[target]; }
+
+    let base = cachelods[cachelods.length - 1];
+    let entry = simplifiedLods.get(base);
+    if (!entry) {
+        entry = { lods: [base], weldkeys: meshWeldKeys(mesh) };
+        simplifiedLods.set(base, entry);
+    }
+    let lods = entry.lods;
+    let generatedlevel = target - (cachelods.length - 1);
+    let [posbuf, posoffset, posstride] = getAttributeBackingStore(mesh.attributes.pos);
+    let positions = posbuf as unknown as ArrayLike<number>;
+    //errors are in model units, a tile is 512 wide
+    const baseError = 16;
+    while (lods.length <= generatedlevel) {
+        let prev = lods[lods.length - 1];
+        let previndices = prev.array as ArrayLike<number>;
+        let simplified = simplifyMesh(positions, posoffset, posstride, previndices, {
+            targetIndexCount: Math.floor(previndices.length / 2 / 3) * 3,
+            maxError: baseError * (1 << lods.length),
+            weldKeys: entry.weldkeys
+        });
+        let arr = (previndices instanceof Uint32Array ? simplified : new Uint16Array(simplified));
+        lods.push(new BufferAttribute(arr, 1));
+    }
+    return lods[generatedlevel];
+}
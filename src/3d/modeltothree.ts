@@ -609,7 +609,7 @@ export class ThreejsSceneCache {
 					return new ParsedTexture(file, stripAlpha, true);
 				}
 			}
-		}, obj => obj.filesize * 2);
+		}, obj => obj.filesize * 2, "textures");
 	}
 
 	getModelData(id: number) {
@@ -633,7 +633,7 @@ export class ThreejsSceneCache {
 			} else {
 				throw new Error("unexpected");
 			}
-		}, obj => obj.meshes.reduce((a, m) => m.indices.count, 0) * 30);
+		}, obj => obj.meshes.reduce((a, m) => m.indices.count, 0) * 30, "models");
 	}
 
 	getMaterial(matid: number, hasVertexAlpha: boolean, minimapVariant: boolean) {
@@ -642,7 +642,7 @@ export class ThreejsSceneCache {
 		return this.engine.fetchCachedObject(this.threejsMaterialCache, matcacheid, async () => {
 			let material = this.engine.getMaterialData(matid);
 			return convertMaterialToThree(this, material, hasVertexAlpha, minimapVariant);
-		}, mat => 256 * 256 * 4 * 2);
+		}, mat => 256 * 256 * 4 * 2, "materials");
 	}
 }
 
@@ -696,6 +696,26 @@ export function applyMaterial(mesh: Mesh, parsedmat: ParsedMaterial, minimapVari
 	}
 }
 
+/**
+ * In-place version of the base color blending of applyMaterial for a range of vertices, used when
+ * meshes with different materials are batched together using a texture atlas
+ */
+export function applyMaterialColorRange(col: BufferAttribute, startvertex: number, endvertex: number, matmeta: MaterialData, minimapVariant: boolean) {
+	if (matmeta.baseColorFraction == 0) { return; }
+	let basecolor = (minimapVariant && matmeta.baseColorFraction == 1 ? [0.5, 0.5, 0.5] : matmeta.baseColor);
+	let oldfrac = 1 - matmeta.baseColorFraction;
+	let newrcomp = matmeta.baseColorFraction * basecolor[0] * 255;
+	let newgcomp = matmeta.baseColorFraction * basecolor[1] * 255;
+	let newbcomp = matmeta.baseColorFraction * basecolor[2] * 255;
+	let [buf, offset, stride] = getAttributeBackingStore(col);
+	for (let i = startvertex; i < endvertex; i++) {
+		let ii = offset + stride * i;
+		buf[ii + 0] = clamp(buf[ii + 0] * oldfrac + newrcomp);
+		buf[ii + 1] = clamp(buf[ii + 1] * oldfrac + newgcomp);
+		buf[ii + 2] = clamp(buf[ii + 2] * oldfrac + newbcomp);
+	}
+}
+
 /**
  * When merging player npc models the client incorrectly merge vertices which
  * have the same position+color+material, but with different bone ids. The second
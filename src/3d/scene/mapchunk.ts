@@ -120,9 +120,12 @@ export class RSMapChunk extends TypedEmitter<{ loaded: RSMapChunkData, changed:
             this.globalname = "";
         }
         //only clear vertex memory for now, materials might be reused and are up to the scenecache
-        this.chunkdata.then(q => q.chunkroot.traverse(obj => {
-            if (obj instanceof Mesh) { obj.geometry.dispose(); }
-        }));
+        this.chunkdata.then(q => {
+            q.chunkroot.traverse(obj => {
+                if (obj instanceof Mesh) { obj.geometry.dispose(); }
+            });
+            q.minimapatlas?.dispose();
+        });
         this.renderscene?.removeSceneElement(this);
         this.renderscene = null;
     }
@@ -3,10 +3,14 @@ import * as path from "path";
 import * as opcode_reader from "./parser/opcode_reader";
 import * as commentjson from "comment-json";
 import { maprenderConfigSchema } from "./parser/jsonschemas";
+import { compiledParserModule } from "./parser/parsercompiler";
 
 async function buildFileTypes() {
 	let basedir = path.resolve("./src/opcodes");
 	let outdir = path.resolve("./generated");
+	let parserdir = path.resolve(outdir, "parsers");
+	fs.mkdirSync(parserdir, { recursive: true });
+	let compiledfiles: string[] = [];
 
 	//generate config file metas
 	let files = fs.readdirSync(basedir);
@@ -25,7 +29,12 @@ async function buildFileTypes() {
 			"// run `npm run filetypes` to rebuild\n\n";
 		typesfile += "export type " + objname + " = ";
 		try {
-			typesfile += opcode_reader.buildParser(null, opcodes as any, typedef as any).getTypescriptType("") + ";\n";
+			let parser = opcode_reader.buildParser(null, opcodes as any, typedef as any);
+			let typescript = parser.getTypescriptType("");
+			let parsermodule = compiledParserModule(parser, path.relative(parserdir, srcfile));
+			typesfile += typescript + ";\n";
+			fs.writeFileSync(path.resolve(parserdir, objname + ".ts"), parsermodule);
+			compiledfiles.push(objname);
 		} catch (e: any) {
 			//console.error(e);
 			typesfile += "any;\n";
@@ -37,6 +46,17 @@ async function buildFileTypes() {
 		fs.writeFileSync(outfile, typesfile);
 	}
 
+	//only the hash matching modules are used at runtime, see FileParser.getCompiled
+	let indexfile =
+		"// GENERATED DO NOT EDIT\n" +
+		"// run `npm run filetypes` to rebuild\n\n" +
+		"import type { CompiledParserModule } from \"../../src/parser/parsercompiler\";\n" +
+		compiledfiles.map(name => `import * as ${name} from "./${name}";\n`).join("") +
+		"\nexport const compiledParsers: CompiledParserModule[] = [\n" +
+		compiledfiles.map(name => `\t${name},\n`).join("") +
+		"];\n";
+	fs.writeFileSync(path.resolve(parserdir, "index.ts"), indexfile);
+
 	//other one off files
 	fs.writeFileSync(path.resolve(outdir, "maprenderconfig.schema.json"), JSON.stringify(maprenderConfigSchema, undefined, "\t"));
 }
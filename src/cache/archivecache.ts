@@ -0,0 +1,113 @@
+import * as fs from "fs/promises";
+import { CacheIndex, SubFile } from ".";
+import { AbstractSQLite, AbstractSQLiteNode, AbstractSQLiteStatement, AbstractSQLiteWorker } from "../libs/sqlite3wrap";
+
+const cachefile = "archivecache.sqlite3";
+
+//fileid, offset, size, hasname, namehash
+const tableStride = 5;
+
+type ArchiveRow = { subfiles: Uint8Array, data: Uint8Array };
+
+/**
+ * Persistent store of decompressed and unpacked archives, keyed by (major, minor, crc) so entries
+ * are shared between cache builds as long as the group didn't change. Subfiles are returned as
+ * slices of one payload buffer so a hit costs a single blob read and no copies. Groups without a
+ * crc (legacy caches and some generated indices report 0) can't be told apart and are never stored.
+ */
+export class DecodedArchiveCache {
+    ready: Promise<void>;
+    isready: boolean;
+    //opening the database failed, behave as an always empty cache
+    failed = false;
+    database!: AbstractSQLite;
+    getstatement!: AbstractSQLiteStatement<[number, number, number], ArchiveRow>;
+    setstatement!: AbstractSQLiteStatement<[number, number, number, Uint8Array, Uint8Array], {}>;
+
+    hits = 0;
+    misses = 0;
+
+    static tryCreate(filename = cachefile) {
+        try {
+            return new DecodedArchiveCache(filename);
+        } catch {
+            return null;
+        }
+    }
+
+    constructor(filename: string) {
+        this.isready = false;
+        this.ready = (async () => {
+            if (!!fs.constants) {
+                // nodejs
+                this.database = await AbstractSQLiteNode.create(filename, { create: true, write: true });
+            } else {
+                // web
+                this.database = await AbstractSQLiteWorker.create(filename);
+            }
+            //many short lived processes share this file, wal lets readers continue while one of them writes
+            await this.database.exec(`PRAGMA journal_mode=WAL;`);
+            await this.database.exec(`CREATE TABLE IF NOT EXISTS archives (major INT, minor INT, crc UNSIGNED INT, subfiles BLOB, data BLOB);`);
+            await this.database.exec(`CREATE UNIQUE INDEX IF NOT EXISTS mainindex ON archives(major,minor,crc)`);
+
+            this.getstatement = await this.database.prepare<[number, number, number], ArchiveRow>(`SELECT subfiles, data FROM archives WHERE major=? AND minor=? AND crc=?`);
+            this.setstatement = await this.database.prepare<[number, number, number, Uint8Array, Uint8Array], {}>(`INSERT OR IGNORE INTO archives(major,minor,crc,subfiles,data) VALUES (?,?,?,?,?)`);
+
+            this.isready = true;
+        })().catch(e => {
+            console.warn("decoded archive cache unavailable", e);
+            this.failed = true;
+        });
+    }
+
+    async getArchive(index: CacheIndex): Promise<SubFile[] | null> {
+        if (index.crc == 0) { return null; }
+        if (!this.isready) {
+            await this.ready;
+            if (this.failed) { return null; }
+        }
+        let rows = await this.getstatement.run(index.major, index.minor, index.crc);
+        if (rows.length == 0) {
+            this.misses++;
+            return null;
+        }
+        this.hits++;
+        let row = rows[0];
+        // Buffer doesn't survive the trip from worker
+        let data = (row.data instanceof Buffer ? row.data : Buffer.from(row.data.buffer, row.data.byteOffset, row.data.byteLength));
+        let table = new Int32Array(row.subfiles.slice().buffer);
+        let files: SubFile[] = [];
+        let dataoffset = 0;
+        for (let i = 0; i < table.length; i += tableStride) {
+            let size = table[i + 2];
+            files.push({
+                fileid: table[i + 0],
+                offset: table[i + 1],
+                size,
+                buffer: data.subarray(dataoffset, dataoffset + size),
+                namehash: (table[i + 3] ? table[i + 4] : null)
+            });
+            dataoffset += size;
+        }
+        return files;
+    }
+
+    async addArchive(index: CacheIndex, files: SubFile[]) {
+        if (index.crc == 0) { return; }
+        if (!this.isready) {
+            await this.ready;
+            if (this.failed) { return; }
+        }
+        let table = new Int32Array(files.length * tableStride);
+        for (let i = 0; i < files.length; i++) {
+            let file = files[i];
+            table[i * tableStride + 0] = file.fileid;
+            table[i * tableStride + 1] = file.offset;
+            table[i * tableStride + 2] = file.buffer.byteLength;
+            table[i * tableStride + 3] = (file.namehash == null ? 0 : 1);
+            table[i * tableStride + 4] = file.namehash ?? 0;
+        }
+        let data = Buffer.concat(files.map(q => q.buffer));
+        await this.setstatement.run(index.major, index.minor, index.crc, new Uint8Array(table.buffer), data);
+    }
+}
@@ -1,14 +1,64 @@
 import { simplexteadecrypt } from "../libs/xtea";
+import { WorkerPool } from "../libs/workerpool";
+import { Worker as NodeWorker } from "worker_threads";
+import type { DecompressPacket } from "./decompressworker";
 
 let compressiontimes = {
 	bzip2: 0,
 	lzma: 0,
 	zlib: 0,
 	zlibsqlite: 0,
+	//time spent waiting on worker decompression, includes queueing
+	worker: 0
 };
 
 globalThis.compressiontimes = compressiontimes;
 
+//smaller files are faster to decompress in place than to send to a worker
+const asyncDecompressThreshold = 16 * 1024;
+
+let decompressPool: WorkerPool<DecompressPacket> | null | undefined = undefined;
+function getDecompressPool() {
+	if (decompressPool === undefined) {
+		decompressPool = null;
+		try {
+			if (typeof process != "undefined" && process.versions?.node) {
+				decompressPool = new WorkerPool(() => new NodeWorker(new URL("./decompressworker.ts", import.meta.url)));
+			} else if (typeof Worker != "undefined") {
+				decompressPool = new WorkerPool(() => new Worker(new URL("./decompressworker.ts", import.meta.url)));
+			}
+		} catch (e) {
+			console.log("can't start decompression workers, decompressing on main thread", e);
+		}
+	}
+	return decompressPool;
+}
+
+/**
+ * Stops the decompression workers, a new pool is started if decompressAsync is used again
+ */
+export function closeDecompressPool() {
+	decompressPool?.close();
+	decompressPool = undefined;
+}
+
+/**
+ * Same as decompress, but large files are decompressed in a pool of worker threads so cache
+ * sources can decompress many groups in parallel
+ */
+export async function decompressAsync(input: Buffer, key?: Uint32Array) {
+	let pool = (input.byteLength >= asyncDecompressThreshold && input.readUInt8(0) != 0 ? getDecompressPool() : null);
+	if (!pool) {
+		return decompress(input, key);
+	}
+	let t = performance.now();
+	//copy only the bytes of this group, input is often a slice of a much larger buffer that callers still use
+	let copy = new Uint8Array(input);
+	let res = await pool.call<Uint8Array>({ input: copy, key }, [copy.buffer]);
+	compressiontimes.worker += performance.now() - t;
+	return Buffer.from(res.buffer, res.byteOffset, res.byteLength);
+}
+
 //decompress data as it comes from the server
 export function decompress(input: Buffer, key?: Uint32Array) {
 	switch (input.readUInt8(0x0)) {
@@ -43,6 +93,29 @@ export function decompress(input: Buffer, key?: Uint32Array) {
 	}
 }
 
+/**
+ * All available decoders per compression type, all take the full container as input. Used to
+ * compare implementations, decompress uses the one listed first (lzma falls back to js if the
+ * native module can't be loaded)
+ */
+export const compressionImplementations: Record<number, Record<string, (input: Buffer, key?: Uint32Array) => Buffer>> = {
+	1: {
+		wasmstream: input => _bz2_stream(input),
+		wasm: input => _bz2(input),
+		js: input => _bz2_old(input)
+	},
+	2: {
+		zlib: (input, key) => _zlib(input, key)
+	},
+	3: {
+		native: input => _lzma(input, "native"),
+		js: input => _lzma(input, "js")
+	},
+	0x5a: {
+		zlib: input => _zlibSqlite(input)
+	}
+};
+
 //compress data to use in sqlite BLOBs
 export function compressSqlite(input: Buffer, compression: "zlib") {
 	switch (compression) {
@@ -101,7 +174,6 @@ var _bz2 = function (input: Buffer) {
 
 
 function _bz2_stream(container: Buffer) {
-	var bzip2 = require("../libs/bzip2wasm") as typeof import("../libs/bzip2wasm");
 	if (!(container instanceof Uint8Array)) {
 		throw new TypeError("container must be Uint8Array");
 	}
@@ -117,52 +189,62 @@ function _bz2_stream(container: Buffer) {
 		throw new Error("legacy payload truncated");
 	}
 
+	return bz2StreamDecode(container.subarray(payloadStart, payloadEnd), uncompressedLen);
+}
+
+/**
+ * Runs the headerless bzip2 payload through the streaming wasm decoder, the missing header is pushed
+ * separately so the input never has to be copied. Output is written directly into the result if
+ * the size is known, otherwise the chunks are concatenated at the end.
+ */
+function bz2StreamDecode(payload: Uint8Array, uncompressedLen = -1) {
+	var bzip2 = require("../libs/bzip2wasm") as typeof import("../libs/bzip2wasm");
 	const inputChunkSize = 64 * 1024;
 	const outputChunkSize = 64 * 1024;
 	const blockSizeChar = 8 + 0x30; // the lib expects a number between 1-9 here (+0x30)
 
 	const stream = bzip2.createBzip2Stream({ outputChunkSize });
-	const out = Buffer.alloc(uncompressedLen);
+	const chunks: Uint8Array[] = [];
+	let out = (uncompressedLen == -1 ? null : Buffer.alloc(uncompressedLen));
 	let outOffset = 0;
 
 	const onOutput = (chunk: Uint8Array) => {
 		const end = outOffset + chunk.length;
-		if (end > out.length) {
+		if (!out) {
+			//the chunk is a view into wasm memory and gets overwritten by the next one
+			chunks.push(chunk.slice());
+		} else if (end > out.length) {
 			throw new Error("decompressed output exceeded expected length");
+		} else {
+			out.set(chunk, outOffset);
 		}
-		out.set(chunk, outOffset);
 		outOffset = end;
 	};
 
 	try {
 		stream.pushTo(new Uint8Array([0x42, 0x5a, 0x68, blockSizeChar]), onOutput);
-		for (let offset = payloadStart; offset < payloadEnd; offset += inputChunkSize) {
-			const end = Math.min(offset + inputChunkSize, payloadEnd);
-			stream.pushTo(container.subarray(offset, end), onOutput);
+		for (let offset = 0; offset < payload.length; offset += inputChunkSize) {
+			stream.pushTo(payload.subarray(offset, Math.min(offset + inputChunkSize, payload.length)), onOutput);
 		}
 		stream.finishTo(onOutput);
 	} finally {
 		stream.close();
 	}
 
+	if (!out) {
+		return Buffer.concat(chunks, outOffset);
+	}
 	if (outOffset !== out.length) {
 		throw new Error(`legacy header length mismatch (expected ${out.length}, got ${outOffset})`);
 	}
-
 	return out;
 }
 
 export function legacybz2(input: Buffer) {
-	var bzip2 = require("../libs/bzip2wasm") as typeof import("../libs/bzip2wasm");
-	var processed = Buffer.alloc(input.byteLength + 0x4);
-	input.copy(processed, 0x4);
-
-	// Add the header
-	processed.writeUInt16BE(0x425A, 0x0); // Magic Number
-	processed.writeUInt8(0x68, 0x2); // Version
-	// processed.writeUInt8(Math.ceil(uncompressed / (1024 * 102.4)) + 0x30, 0x3); // Block size in 100kB because why the hell not
-	processed.writeUInt8(8 + 0x30, 0x3); // the lib expects a number between 1-9 here (+0x30)
-	return Buffer.from(bzip2.bzip2decompress(processed));
+	let t = performance.now();
+	let output = bz2StreamDecode(input);
+	compressiontimes.bzip2 += performance.now() - t;
+	return output;
 }
 
 /**
@@ -195,7 +277,7 @@ let nativelzmaAttempted = false;
 /**
  * @param {Buffer} input The input buffer straight from the server
  */
-var _lzma = function (input: Buffer) {
+var _lzma = function (input: Buffer, impl: "auto" | "native" | "js" = "auto") {
 	var compressed = input.readUInt32BE(0x1);
 	var uncompressed = input.readUInt32BE(0x5);
 	var processed = Buffer.alloc(compressed + 8);
@@ -204,7 +286,7 @@ var _lzma = function (input: Buffer) {
 	processed.writeUInt32LE(0, 0x5 + 0x4);
 	input.copy(processed, 0xD, 0xE);
 
-	if (!nativelzmaAttempted && !nativelzma) {
+	if (impl != "js" && !nativelzmaAttempted && !nativelzma) {
 		nativelzmaAttempted = true;
 		try {
 			nativelzma = __non_webpack_require__("lzma-native").LZMA();
@@ -212,7 +294,10 @@ var _lzma = function (input: Buffer) {
 			console.log("can't load native lzma, falling back to naive js implementation");
 		}
 	}
-	if (nativelzma) {
+	if (impl == "native" && !nativelzma) {
+		throw new Error("native lzma not available");
+	}
+	if (impl != "js" && nativelzma) {
 		return nativelzma.decompress(processed) as Buffer;
 	} else {
 		//need to do this weird import directly because of webpack
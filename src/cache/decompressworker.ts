@@ -0,0 +1,13 @@
+import { serveWorkerPool } from "../libs/workerpool";
+import { decompress } from "./compression";
+
+export type DecompressPacket = {
+	input: Uint8Array,
+	key?: Uint32Array
+};
+
+serveWorkerPool<DecompressPacket>(packet => {
+	// Buffer doesn't survive the trip to the worker
+	let input = Buffer.from(packet.input.buffer, packet.input.byteOffset, packet.input.byteLength);
+	return decompress(input, packet.key);
+});
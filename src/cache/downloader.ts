@@ -1,5 +1,5 @@
 import { DirectCacheFileSource } from "./index";
-import { decompress } from "./compression";
+import { decompressAsync } from "./compression";
 import * as net from "net";
 import fetch from "node-fetch";
 import { crc32 } from "../libs/crc32util";
@@ -41,13 +41,19 @@ type PendingFile = {
 	major: number,
 	minor: number,
 	totalBytes: number,
-	result: Buffer[],
+	//allocated once the header with the file size arrived, blocks are copied straight into it
+	result: Buffer | null,
 	currentBytes: number,
-	pendingsocket: net.Socket | null,
+	promise: Promise<Buffer>,
 	done: (data: Buffer) => void,
 	err: (err: any) => void
 }
 
+//major is 1 byte and minor 31 bits, fits exactly in a double
+function pendingKey(major: number, minor: number) {
+	return major * 0x80000000 + minor;
+}
+
 export type ParsedClientconfig = ReturnType<typeof parseClientConfig>;
 
 export function parseClientConfig(cnf: ClientConfig) {
@@ -94,18 +100,27 @@ function trackDataUsage(len: number) {
 }
 
 class DownloadSocket {
-	pending: PendingFile[] = [];
+	//requests written to the socket, the server interleaves blocks of different files
+	pending = new Map<number, PendingFile>();
+	//requests waiting for room in the in-flight window
+	queued: PendingFile[] = [];
+	maxinflight: number;
 	ready = new CallbackPromise();
 	socket: net.Socket;
 	config: ParsedClientconfig;
+	connected = false;
+	closed = false;
 
 	packetPending: Buffer[] = [];
 	packetPendingError: any = null;
 	packetCallback: (() => void) | null = null;
+	headerbuffer = Buffer.alloc(1 + 4);
 
-	constructor(config: ParsedClientconfig) {
+	constructor(config: ParsedClientconfig, maxinflight: number) {
 		this.config = config;
+		this.maxinflight = maxinflight;
 		this.socket = new net.Socket();
+		this.socket.setNoDelay(true);
 		this.socket.on("connect", () => {
 			console.log("downloader connected " + this.socket.remoteAddress);
 		});
@@ -125,6 +140,10 @@ class DownloadSocket {
 		});
 	}
 
+	get load() {
+		return this.pending.size + this.queued.length;
+	}
+
 	async connect() {
 		this.socket.connect(this.config.port, this.config.endpoint);
 
@@ -138,7 +157,7 @@ class DownloadSocket {
 		}));
 
 		//0=success,6=outdated,48=badkey
-		let res1 = await this.getChunk(1);
+		let res1 = await this.readInto(Buffer.alloc(1), 0, 1);
 		if (res1.readUint8(0) != 0) { throw new Error("unexpected handshake response"); }
 
 		let tribyte = 5;
@@ -147,119 +166,183 @@ class DownloadSocket {
 	}
 
 	async run() {
-		await this.connect();
-		this.ready.done();
-		while (true) {
-			let bytesread = 0;
-			try { var chunk = await this.getChunk(1 + 4); }
-			catch (e) { return; }
-			bytesread += 1 + 4;
-			let major = chunk.readUint8(0);
-			let minor = chunk.readUint32BE(1) & 0x7fffffff;//first bit is a flag
-
-			let req = this.pending.find(q => q.major == major && q.minor == minor);
-			if (!req) { throw new Error("Received file which wasn't requested"); }
-
-			//first packet
-			if (req.totalBytes == -1) {
-				let header = await this.getChunk(1 + 4);
+		try {
+			await this.connect();
+			this.connected = true;
+			this.ready.done();
+			this.flushQueue();
+			while (true) {
+				let bytesread = 0;
+				let chunk = await this.readInto(this.headerbuffer, 0, 1 + 4);
 				bytesread += 1 + 4;
-				let compression = header.readUint8(0);
-				let compressedSize = header.readUint32BE(1);
-				req.totalBytes = header.byteLength + (compression == 0 ? 0 : 4) + compressedSize;
-				req.result.push(header);
-				req.currentBytes += header.byteLength;
-			}
-			let bytesleft = req.totalBytes - req.currentBytes;
-			let payloadsize = Math.min(maxblocksize - bytesread, bytesleft)
-			let datachunk = await this.getChunk(payloadsize);
-			req.result.push(datachunk);
-			req.currentBytes += datachunk.byteLength;
-			if (req.currentBytes == req.totalBytes) {
-				this.pending.splice(this.pending.indexOf(req), 1);
-				req.done(Buffer.concat(req.result));
+				let major = chunk.readUint8(0);
+				let minor = chunk.readUint32BE(1) & 0x7fffffff;//first bit is a flag
+
+				let key = pendingKey(major, minor);
+				let req = this.pending.get(key);
+				if (!req) { throw new Error("Received file which wasn't requested"); }
+
+				//first packet
+				if (!req.result) {
+					let header = await this.readInto(this.headerbuffer, 0, 1 + 4);
+					bytesread += 1 + 4;
+					let compression = header.readUint8(0);
+					let compressedSize = header.readUint32BE(1);
+					req.totalBytes = header.byteLength + (compression == 0 ? 0 : 4) + compressedSize;
+					req.result = Buffer.allocUnsafe(req.totalBytes);
+					header.copy(req.result, 0);
+					req.currentBytes += header.byteLength;
+				}
+				let bytesleft = req.totalBytes - req.currentBytes;
+				let payloadsize = Math.min(maxblocksize - bytesread, bytesleft)
+				await this.readInto(req.result, req.currentBytes, payloadsize);
+				req.currentBytes += payloadsize;
+				if (req.currentBytes == req.totalBytes) {
+					this.pending.delete(key);
+					req.done(req.result);
+					this.flushQueue();
+				}
 			}
+		} catch (e) {
+			this.fail(e);
 		}
 	}
 
-	writeRequest(major: number, minor: number) {
-		return new Promise<Buffer>((done, err) => {
+	fail(err: any) {
+		this.closed = true;
+		for (let pend of this.pending.values()) { pend.err(err); }
+		for (let pend of this.queued) { pend.err(err); }
+		this.pending.clear();
+		this.queued = [];
+		if (!this.connected) { this.ready.err(err); }
+		this.socket.destroy();
+	}
+
+	flushQueue() {
+		if (!this.connected || this.closed) { return; }
+		let count = 0;
+		while (count < this.queued.length && this.pending.size < this.maxinflight) {
+			let req = this.queued[count++];
+			this.pending.set(pendingKey(req.major, req.minor), req);
 			this.socket.write(filereq1.write({
-				mode: (major == 255 && minor == 255 ? 0x21 : 0x1),
+				mode: (req.major == 255 && req.minor == 255 ? 0x21 : 0x1),
 				version: this.config.serverVersionMajor,
-				major,
-				minor,
+				major: req.major,
+				minor: req.minor,
 				short2: this.config.unknownshort2
 			}));
-			this.pending.push({
-				major, minor,
-				totalBytes: -1,
-				pendingsocket: this.socket,
-				result: [],
-				currentBytes: 0,
-				done, err
-			})
+		}
+		if (count != 0) { this.queued.splice(0, count); }
+	}
+
+	writeRequest(major: number, minor: number) {
+		if (this.closed) { return Promise.reject(new Error("connection closed")); }
+		//identical requests are answered once by the server, so share the result
+		let existing = this.pending.get(pendingKey(major, minor)) ?? this.queued.find(q => q.major == major && q.minor == minor);
+		if (existing) { return existing.promise; }
+		let done!: PendingFile["done"];
+		let err!: PendingFile["err"];
+		let promise = new Promise<Buffer>((resolve, reject) => { done = resolve; err = reject; });
+		this.queued.push({
+			major, minor,
+			totalBytes: -1,
+			result: null,
+			currentBytes: 0,
+			promise, done, err
 		});
+		this.flushQueue();
+		return promise;
 	}
 
-	async getChunk(bytes: number) {
-		let res = Buffer.alloc(bytes);
+	//copies the next bytes of the stream into target, the only copy a received block goes through
+	async readInto(target: Buffer, offset: number, bytes: number) {
 		let index = 0;
 		while (index < bytes) {
-			//might be able to use socket.pause and socket.resume here instead
 			if (this.packetPending.length == 0 && !this.packetPendingError) {
 				await new Promise<void>(done => this.packetCallback = done);
 			}
 			if (this.packetPending.length == 0 && this.packetPendingError) {
-				for (let pend of this.pending) { pend.err(this.packetPendingError); }
 				throw this.packetPendingError;
 			}
 
 			let chunk = this.packetPending[0];
 			let len = Math.min(chunk.byteLength, bytes - index);
-			chunk.copy(res, index, 0, len);
+			chunk.copy(target, offset + index, 0, len);
 			index += len;
 			if (len == chunk.byteLength) {
 				this.packetPending.shift();
 			} else {
-				this.packetPending[0] = chunk.slice(len);
+				this.packetPending[0] = chunk.subarray(len);
 			}
 		}
-		return res;
+		return target;
 	}
 }
 
 
 export class CacheDownloader extends DirectCacheFileSource {
 	configPromise: Promise<ParsedClientconfig>;
-	socket: DownloadSocket | null = null;
-	socketPromise: Promise<DownloadSocket> | null = null;
+	sockets: (Promise<DownloadSocket> | null)[];
+	//sockets of the slots above that finished their handshake, read synchronously when picking a socket
+	private connected: (DownloadSocket | null)[];
+	maxinflight: number;
 	timestamp = new Date();
 
-	constructor() {
+	//the config can be passed to connect to a different server, like a local stand-in for testing
+	constructor(socketcount = 4, maxinflight = 32, config?: ParsedClientconfig) {
 		super(true);
-		this.configPromise = downloadServerConfig().then(parseClientConfig);
+		this.configPromise = (config ? Promise.resolve(config) : downloadServerConfig().then(parseClientConfig));
+		this.sockets = new Array(Math.max(1, socketcount)).fill(null);
+		this.connected = new Array(this.sockets.length).fill(null);
+		this.maxinflight = maxinflight;
 	}
 
 	getCacheMeta() {
 		return { name: "live", descr: "Download live data from jagex server", timestamp: this.timestamp };
 	}
 
-	async getSocket(): Promise<DownloadSocket> {
-		if (!this.socketPromise) {
-			this.socketPromise = (async () => {
-				let config = await this.configPromise;
-				let sock = new DownloadSocket(config);
-				sock.run().catch().finally(() => {
-					this.socket = null;
-					this.socketPromise = null;
-				});
-				await sock.ready;
-				this.socket = sock;
-				return this.socket;
-			})();
+	private openSocket(index: number) {
+		let prom = (async () => {
+			let config = await this.configPromise;
+			let sock = new DownloadSocket(config, this.maxinflight);
+			sock.run().finally(() => {
+				if (this.sockets[index] == prom) {
+					this.sockets[index] = null;
+					this.connected[index] = null;
+				}
+			});
+			await sock.ready;
+			if (this.sockets[index] == prom) { this.connected[index] = sock; }
+			return sock;
+		})();
+		this.sockets[index] = prom;
+		return prom;
+	}
+
+	//spreads requests over the connections, new connections are only opened once the others are busy.
+	//this doesn't await anything, so concurrent callers can't pick the same free slot
+	getSocket(): Promise<DownloadSocket> {
+		let best: DownloadSocket | null = null;
+		let connecting: Promise<DownloadSocket> | null = null;
+		let freeslot = -1;
+		for (let i = 0; i < this.sockets.length; i++) {
+			let prom = this.sockets[i];
+			if (!prom) {
+				if (freeslot == -1) { freeslot = i; }
+				continue;
+			}
+			let sock = this.connected[i];
+			if (!sock) {
+				connecting ??= prom;
+			} else if (!sock.closed && (!best || sock.load < best.load)) {
+				best = sock;
+			}
 		}
-		return this.socketPromise;
+		if (best && best.load < this.maxinflight) { return Promise.resolve(best); }
+		//requests queue up on a connecting socket until its handshake is done
+		if (connecting && !best) { return connecting; }
+		if (freeslot != -1) { return this.openSocket(freeslot); }
+		return (best ? Promise.resolve(best) : connecting!);
 	}
 
 	async getFile(major: number, minor: number, crc?: number | undefined): Promise<Buffer> {
@@ -273,12 +356,12 @@ export class CacheDownloader extends DirectCacheFileSource {
 			if (!res.ok) { throw new Error(`http cache request failed with code ${res.status}`); }
 			let data = await res.arrayBuffer();
 			trackDataUsage(data.byteLength);
-			return decompress(Buffer.from(data));
+			return decompressAsync(Buffer.from(data));
 		}
 
-		let socket = this.socket ?? await this.getSocket();
 		for (let attempt = 0; attempt < 10; attempt++) {
 			try {
+				let socket = await this.getSocket();
 				var file = await socket.writeRequest(major, minor);
 			} catch (e) {
 				if (attempt >= 5) {
@@ -297,12 +380,14 @@ export class CacheDownloader extends DirectCacheFileSource {
 				}
 			}
 			// console.log("downloaded", major, minor, crc);
-			return decompress(file);
+			return decompressAsync(file);
 		}
 		throw new Error("Failed to download matching crc after 10 attemps");
 	}
 
 	close() {
-		this.socket?.socket.end();
+		for (let prom of this.sockets) {
+			prom?.then(sock => sock.socket.end(), () => { });
+		}
 	}
 }
\ No newline at end of file
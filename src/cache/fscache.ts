@@ -1,14 +1,88 @@
 import * as fs from "fs/promises";
 import { AbstractSQLite, AbstractSQLiteNode, AbstractSQLiteStatement, AbstractSQLiteWorker } from "../libs/sqlite3wrap";
+import { crc32 } from "../libs/crc32util";
+import { compressSqlite, decompress } from "./compression";
 
 const cachefile = "fscache.sqlite3";
 
+//writes are committed in batches, one transaction per insert is what makes sqlite slow
+const writeBatchSize = 256;
+const writeBatchDelay = 200;
+
+//content defined chunk sizes, the average is about min + 4kb
+const chunkMinSize = 1024;
+const chunkMaxSize = 32 * 1024;
+const chunkCutBits = 12;
+
+//chunks fetched per query when rebuilding a group, each query is a message round trip to the sqlite worker on web
+const chunkReadBatch = 256;
+
+//random value per byte for the gear rolling hash, fixed seed since chunk boundaries have to be stable between runs
+const gearTable = (() => {
+    let table = new Uint32Array(256);
+    let state = 0x9e3779b9;
+    for (let i = 0; i < 256; i++) {
+        state ^= state << 13;
+        state ^= state >>> 17;
+        state ^= state << 5;
+        table[i] = state >>> 0;
+    }
+    return table;
+})();
+
+/**
+ * Splits data at positions that only depend on the bytes right before them (gear hash), so an edit
+ * only changes the chunks around it and the rest of a group still matches chunks of older builds.
+ * Returns the end offset of each chunk
+ */
+export function contentDefinedChunks(data: Uint8Array) {
+    let ends: number[] = [];
+    let start = 0;
+    while (start < data.length) {
+        let end = Math.min(data.length, start + chunkMaxSize);
+        let cut = end;
+        let hash = 0;
+        for (let i = start + chunkMinSize; i < end; i++) {
+            hash = ((hash << 1) + gearTable[data[i]]) | 0;
+            //the top bits depend on the last 32 bytes
+            if ((hash >>> (32 - chunkCutBits)) == 0) {
+                cut = i + 1;
+                break;
+            }
+        }
+        ends.push(cut);
+        start = cut;
+    }
+    return ends;
+}
+
+//53 bit chunk id made of the crc and a second hash, still checked by the crc of the whole rebuilt group
+export function chunkHash(data: Uint8Array) {
+    let fnv = 0x811c9dc5;
+    for (let i = 0; i < data.length; i++) {
+        fnv = Math.imul(fnv ^ data[i], 0x01000193);
+    }
+    return crc32(data) * 0x200000 + ((fnv >>> 0) & 0x1fffff);
+}
+
 export class FileSourceFsCache {
     ready: Promise<void>;
     isready: boolean;
     database!: AbstractSQLite;
     getstatement!: AbstractSQLiteStatement<[number, number, number], { major: number, minor: number, crc: number, file: Uint8Array }>;
     setstatement!: AbstractSQLiteStatement<[number, number, number, Uint8Array], {}>;
+    getchunkedstatement!: AbstractSQLiteStatement<[number, number, number], { datacrc: number, size: number, chunks: Uint8Array }>;
+    setchunkedstatement!: AbstractSQLiteStatement<[number, number, number, number, number, Uint8Array], {}>;
+    getchunksstatement!: AbstractSQLiteStatement<number[], { hash: number, data: Uint8Array }>;
+    setchunkstatement!: AbstractSQLiteStatement<[number, Uint8Array], {}>;
+
+    //files that are queued but not yet written, reads check these first
+    private pendingFiles = new Map<string, Buffer>();
+    private pendingDecoded = new Map<string, Buffer>();
+    //done runs once the batch of the write is committed or rolled back
+    private writeQueue: { write: () => Promise<unknown>, done: () => void }[] = [];
+    private flushTimer: ReturnType<typeof setTimeout> | null = null;
+    private flushing: Promise<void> = Promise.resolve();
 
     static tryCreate() {
         try {
@@ -30,23 +104,85 @@ export class FileSourceFsCache {
             }
             await this.database.exec(`CREATE TABLE IF NOT EXISTS groupcache (major INT, minor INT, crc UNSIGNED INT, file BLOB);`);
             await this.database.exec(`CREATE UNIQUE INDEX IF NOT EXISTS mainindex ON groupcache(major,minor,crc)`);
+            //decompressed groups stored as a list of chunks, each unique chunk is stored once for all builds
+            await this.database.exec(`CREATE TABLE IF NOT EXISTS chunkedgroups (major INT, minor INT, crc UNSIGNED INT, datacrc UNSIGNED INT, size INT, chunks BLOB);`);
+            await this.database.exec(`CREATE UNIQUE INDEX IF NOT EXISTS chunkedindex ON chunkedgroups(major,minor,crc)`);
+            await this.database.exec(`CREATE TABLE IF NOT EXISTS chunks (hash INTEGER PRIMARY KEY, data BLOB);`);
 
             this.getstatement = await this.database.prepare<[number, number, number], { major: number, minor: number, crc: number, file: Uint8Array }>(`SELECT major, minor, crc, file FROM groupcache WHERE major=? AND minor=? AND crc=?`);
-            this.setstatement = await this.database.prepare<[number, number, number, Uint8Array], {}>(`INSERT INTO groupcache(major,minor,crc,file) VALUES (?,?,?,?)`);
+            this.setstatement = await this.database.prepare<[number, number, number, Uint8Array], {}>(`INSERT OR IGNORE INTO groupcache(major,minor,crc,file) VALUES (?,?,?,?)`);
+            this.getchunkedstatement = await this.database.prepare<[number, number, number], { datacrc: number, size: number, chunks: Uint8Array }>(`SELECT datacrc, size, chunks FROM chunkedgroups WHERE major=? AND minor=? AND crc=?`);
+            this.setchunkedstatement = await this.database.prepare<[number, number, number, number, number, Uint8Array], {}>(`INSERT OR REPLACE INTO chunkedgroups(major,minor,crc,datacrc,size,chunks) VALUES (?,?,?,?,?,?)`);
+            this.getchunksstatement = await this.database.prepare<number[], { hash: number, data: Uint8Array }>(`SELECT hash, data FROM chunks WHERE hash IN (${new Array(chunkReadBatch).fill("?").join(",")})`);
+            this.setchunkstatement = await this.database.prepare<[number, Uint8Array], {}>(`INSERT OR IGNORE INTO chunks(hash,data) VALUES (?,?)`);
 
             this.isready = true;
         })()
     }
 
-    async addFile(major: number, minor: number, crc: number, file: Uint8Array) {
-        if (!this.isready) {
-            await this.ready;
+    private queueWrite(write: () => Promise<unknown>, done: () => void) {
+        this.writeQueue.push({ write, done });
+        if (this.writeQueue.length >= writeBatchSize) {
+            this.flush();
+        } else if (!this.flushTimer) {
+            this.flushTimer = setTimeout(() => this.flush(), writeBatchDelay);
         }
-        console.log("saving", major, minor, crc, "len", file.length);
-        await this.setstatement.run(major, minor, crc, file);
+    }
+
+    /**
+     * Commits all queued writes in one transaction, resolves once they are written. Never rejects, a failed
+     * batch is logged and dropped so the chain keeps going and the timer and queueWrite can ignore the result
+     */
+    flush() {
+        if (this.flushTimer) {
+            clearTimeout(this.flushTimer);
+            this.flushTimer = null;
+        }
+        let jobs = this.writeQueue;
+        this.writeQueue = [];
+        if (jobs.length != 0) {
+            this.flushing = this.flushing.then(async () => {
+                try {
+                    if (!this.isready) {
+                        await this.ready;
+                    }
+                    await this.database.exec("BEGIN");
+                    try {
+                        for (let job of jobs) {
+                            await job.write();
+                        }
+                        await this.database.exec("COMMIT");
+                    } catch (e) {
+                        await this.database.exec("ROLLBACK").catch(() => { });
+                        throw e;
+                    }
+                } catch (e) {
+                    console.log("failed to write fs cache batch", e);
+                } finally {
+                    //also for failed batches, those files are loaded again next time
+                    for (let job of jobs) {
+                        job.done();
+                    }
+                }
+            });
+        }
+        return this.flushing;
+    }
+
+    addFile(major: number, minor: number, crc: number, file: Buffer) {
+        let key = `${major}.${minor}.${crc}`;
+        this.pendingFiles.set(key, file);
+        this.queueWrite(
+            () => this.setstatement.run(major, minor, crc, file),
+            () => { if (this.pendingFiles.get(key) == file) { this.pendingFiles.delete(key); } }
+        );
     }
 
     async getFile(major: number, minor: number, crc: number): Promise<Buffer | null> {
+        let pending = this.pendingFiles.get(`${major}.${minor}.${crc}`);
+        if (pending) {
+            return pending;
+        }
         if (!this.isready) {
             await this.ready;
         }
@@ -67,4 +203,73 @@ export class FileSourceFsCache {
         }
         return null;
     }
+
+    /**
+     * Stores a decompressed group, crc is the crc of the group as stored in the cache and is only used as key
+     */
+    addDecodedFile(major: number, minor: number, crc: number, data: Buffer) {
+        let key = `${major}.${minor}.${crc}`;
+        this.pendingDecoded.set(key, data);
+        this.queueWrite(async () => {
+            let ends = contentDefinedChunks(data);
+            let hashes = new Float64Array(ends.length);
+            let start = 0;
+            for (let i = 0; i < ends.length; i++) {
+                let chunk = data.subarray(start, ends[i]);
+                hashes[i] = chunkHash(chunk);
+                await this.setchunkstatement.run(hashes[i], compressSqlite(chunk, "zlib"));
+                start = ends[i];
+            }
+            await this.setchunkedstatement.run(major, minor, crc, crc32(data), data.byteLength, new Uint8Array(hashes.buffer));
+        }, () => { if (this.pendingDecoded.get(key) == data) { this.pendingDecoded.delete(key); } });
+    }
+
+    /**
+     * Rebuilds a group stored with addDecodedFile, returns null if it isn't stored or if the rebuilt
+     * group doesn't match its original crc
+     */
+    async getDecodedFile(major: number, minor: number, crc: number): Promise<Buffer | null> {
+        let pending = this.pendingDecoded.get(`${major}.${minor}.${crc}`);
+        if (pending) {
+            return pending;
+        }
+        if (!this.isready) {
+            await this.ready;
+        }
+        let [group] = await this.getchunkedstatement.run(major, minor, crc);
+        if (!group) {
+            return null;
+        }
+        //copy since the blob isn't guaranteed to be aligned
+        let hashes = new Float64Array(new Uint8Array(group.chunks).buffer);
+        //fetch all unique chunks in a few queries, the fixed size statement is padded by repeating a hash
+        let unique = [...new Set(hashes)];
+        let chunks = new Map<number, Uint8Array>();
+        for (let i = 0; i < unique.length; i += chunkReadBatch) {
+            let args = unique.slice(i, i + chunkReadBatch);
+            while (args.length < chunkReadBatch) { args.push(args[0]); }
+            for (let row of await this.getchunksstatement.run(...args)) {
+                chunks.set(row.hash, row.data);
+            }
+        }
+        let result = Buffer.alloc(group.size);
+        let offset = 0;
+        for (let hash of hashes) {
+            let chunk = chunks.get(hash);
+            if (!chunk) {
+                return null;
+            }
+            let data = decompress(Buffer.from(chunk.buffer, chunk.byteOffset, chunk.byteLength));
+            if (offset + data.byteLength > result.byteLength) {
+                return null;
+            }
+            data.copy(result, offset);
+            offset += data.byteLength;
+        }
+        if (offset != result.byteLength || crc32(result) != group.datacrc) {
+            console.log(`chunked fs cache file ${major}.${minor} is corrupt`);
+            return null;
+        }
+        return result;
+    }
 }
@@ -28,6 +28,17 @@ export type CacheIndex = {
 
 export type CacheIndexFile = CacheIndex[];
 
+//result of CacheFileSource.streamArchives, files is empty if the archive failed to load or decode
+export type StreamedArchive<T> = {
+	index: CacheIndex,
+	files: SubFile[],
+	decoded: T | undefined,
+	error: Error | null
+}
+
+//called as soon as an archive is loaded, so out of order. position is the index into the streamed list
+export type ArchiveDecoder<T> = (index: CacheIndex, files: SubFile[], position: number) => T | Promise<T>;
+
 export type XteaTable = Map<number, Uint32Array>;
 
 export function packSqliteBufferArchive(buffers: Buffer[]) {
@@ -375,6 +386,16 @@ export abstract class CacheFileSource {
 	getFileArchive(index: CacheIndex): Promise<SubFile[]> {
 		throw new Error("not implemented");
 	}
+	//the file as stored in the source, before decompression
+	getFileRaw(major: number, minor: number, crc?: number): Promise<Buffer> {
+		throw new Error("raw files are not available for this cache source");
+	}
+	//sources that can read many rows at once override this
+	getFiles(major: number, minors: number[], crcs?: number[]): Promise<Buffer[]> {
+		return Promise.all(minors.map((minor, i) => this.getFile(major, minor, crcs?.[i])));
+	}
+	//hint that these files are about to be requested, sources may start loading them in bulk
+	prefetchFiles(major: number, minors: number[]) { }
 	getCacheIndex(major: number): Promise<CacheIndexFile> {
 		throw new Error("not implemented");
 	}
@@ -411,6 +432,56 @@ export abstract class CacheFileSource {
 		return this.getFileArchive(index);
 	}
 
+	/**
+	 * Streams all archives of a major in index order, see streamArchiveList
+	 */
+	async *streamArchives<T = undefined>(major: number, filter?: (index: CacheIndex) => boolean, decode?: ArchiveDecoder<T>, readahead = 16) {
+		let indexfile = await this.getCacheIndex(major);
+		let indices = indexfile.filter(q => q && (!filter || filter(q)));
+		yield* this.streamArchiveList(indices, decode, readahead);
+	}
+
+	/**
+	 * Yields archives in the given order while the next `readahead` archives are already being loaded,
+	 * decompressed (on the worker pool for large groups) and passed through `decode`. The window is only
+	 * refilled when the consumer asks for the next archive, so a slow consumer holds at most `readahead`
+	 * archives in memory. Errors are returned per archive instead of ending the stream.
+	 */
+	async *streamArchiveList<T = undefined>(indices: CacheIndex[], decode?: ArchiveDecoder<T>, readahead = 16): AsyncGenerator<StreamedArchive<T>> {
+		let load = async (index: CacheIndex, position: number): Promise<StreamedArchive<T>> => {
+			try {
+				let files = await this.getFileArchive(index);
+				let decoded = (decode ? await decode(index, files, position) : undefined);
+				return { index, files, decoded, error: null };
+			} catch (e) {
+				return { index, files: [], decoded: undefined, error: e as Error };
+			}
+		}
+		//hint the window after the one being loaded so bulk sources can read it in one go
+		let prefetch = (start: number) => {
+			let window = indices.slice(start, start + readahead);
+			for (let i = 0; i < window.length;) {
+				let major = window[i].major;
+				let minors: number[] = [];
+				for (; i < window.length && window[i].major == major; i++) { minors.push(window[i].minor); }
+				this.prefetchFiles(major, minors);
+			}
+		}
+		let pending: Promise<StreamedArchive<T>>[] = [];
+		let next = 0;
+		while (next < indices.length || pending.length != 0) {
+			while (next < indices.length && pending.length < readahead) {
+				if (next % readahead == 0) {
+					if (next == 0) { prefetch(0); }
+					prefetch(next + readahead);
+				}
+				pending.push(load(indices[next], next));
+				next++;
+			}
+			yield await pending.shift()!;
+		}
+	}
+
 	async getFileById(major: number, fileid: number) {
 		let holderindex = fileIdToArchiveminor(major, fileid, this.getBuildNr());
 		let files = await this.getArchiveById(holderindex.major, holderindex.minor);
@@ -1,23 +1,103 @@
 import { CacheFileSource, CacheIndex, SubFile } from ".";
 import { cacheMajors } from "../constants";
+import { DecodedArchiveCache } from "./archivecache";
 
 export type CachedObject<T> = {
     size: number,
     lastuse: number,
-    usecount: number,
     owner: Map<number, CachedObject<T>>,
     id: number,
     promise: Promise<T> | null,
-    data: T | null
+    data: T | null,
+    group: CacheGroup,
+    //entries move to the protected segment once they are used a second time
+    isprotected: boolean,
+    prev: CachedObject<any> | null,
+    next: CachedObject<any> | null
 }
+
+export type CacheStats = {
+    hits: number,
+    misses: number,
+    evictions: number,
+    size: number,
+    groups: Record<string, { size: number, count: number, quota: number }>
+}
+
+//intrusive doubly linked list, head is most recently used
+class CacheList {
+    head: CachedObject<any> | null = null;
+    tail: CachedObject<any> | null = null;
+    size = 0;
+    count = 0;
+
+    unshift(obj: CachedObject<any>) {
+        obj.prev = null;
+        obj.next = this.head;
+        if (this.head) { this.head.prev = obj; }
+        this.head = obj;
+        this.tail ??= obj;
+        this.size += obj.size;
+        this.count++;
+    }
+
+    remove(obj: CachedObject<any>) {
+        if (obj.prev) { obj.prev.next = obj.next; } else { this.head = obj.next; }
+        if (obj.next) { obj.next.prev = obj.prev; } else { this.tail = obj.prev; }
+        obj.prev = null;
+        obj.next = null;
+        this.size -= obj.size;
+        this.count--;
+    }
+}
+
+//segmented lru, new entries go to probation and get evicted first unless they are used again
+class CacheGroup {
+    name: string;
+    quota: number;
+    probation = new CacheList();
+    protected = new CacheList();
+
+    constructor(name: string, quota: number) {
+        this.name = name;
+        this.quota = quota;
+    }
+
+    get size() {
+        return this.probation.size + this.protected.size;
+    }
+
+    list(obj: CachedObject<any>) {
+        return (obj.isprotected ? this.protected : this.probation);
+    }
+
+    victim() {
+        return this.probation.tail ?? this.protected.tail;
+    }
+}
+
 export class CachingFileSource extends CacheFileSource {
     private archieveCache = new Map<number, CachedObject<SubFile[]>>();
-    private cachedObjects: CachedObject<any>[] = [];
+    private cacheGroups = new Map<string, CacheGroup>();
     private cacheFetchCounter = 0;
-    private cacheAddCounter = 0;
+    private cacheTotalSize = 0;
+    private cacheHits = 0;
+    private cacheMisses = 0;
+    private cacheEvictions = 0;
     maxcachesize = 200e6;
+    //fraction of the protected segment in each group
+    protectedfraction = 0.8;
+    //max fraction of maxcachesize per group, so large models and textures can't push out all config
+    cachequotas: Record<string, number> = {
+        models: 0.35,
+        textures: 0.35,
+        materials: 0.15,
+        [`major-${cacheMajors.mapsquares}`]: 0.3
+    };
 
     rawsource: CacheFileSource;
+    //persistent tier below the memory cache, keeps decoded archives between processes
+    diskcache: DecodedArchiveCache | null = null;
 
     constructor(base: CacheFileSource) {
         super();
@@ -25,35 +105,64 @@ export class CachingFileSource extends CacheFileSource {
         // make them share caches/config
         this.decodeArgs = base.decodeArgs;
         this.nameFiles = base.nameFiles;
+        // opt in with RSMV_ARCHIVECACHE=1 or a file name
+        let diskcachearg = (typeof process != "undefined" ? process.env?.RSMV_ARCHIVECACHE : undefined);
+        if (diskcachearg) {
+            this.diskcache = DecodedArchiveCache.tryCreate(diskcachearg == "1" ? undefined : diskcachearg);
+        }
     }
 
-    fetchCachedObject<T>(map: Map<number, CachedObject<T>>, id: number, create: () => Promise<T>, getSize: (obj: T) => number) {
+    private getCacheGroup(name: string) {
+        let group = this.cacheGroups.get(name);
+        if (!group) {
+            group = new CacheGroup(name, (this.cachequotas[name] ?? 1) * this.maxcachesize);
+            this.cacheGroups.set(name, group);
+        }
+        return group;
+    }
+
+    fetchCachedObject<T>(map: Map<number, CachedObject<T>>, id: number, create: () => Promise<T>, getSize: (obj: T) => number, groupname = "default") {
         let bucket = map.get(id);
         if (!bucket) {
+            this.cacheMisses++;
             let data = create();
-            bucket = {
+            let group = this.getCacheGroup(groupname);
+            let newbucket: CachedObject<T> = {
                 promise: data,
                 data: null,
                 owner: map,
                 id: id,
                 lastuse: 0,
                 size: 0,
-                usecount: 0
+                group,
+                isprotected: false,
+                prev: null,
+                next: null
             }
+            bucket = newbucket;
             data.then(obj => {
-                bucket!.size = getSize(obj);
                 //delete the promise since otherwise v8 leaks the internal callback list
                 //not sure why (chromium 110.0.5481.179, electron 23.1.3)
-                bucket!.promise = null;
-                bucket!.data = obj;
+                newbucket.promise = null;
+                newbucket.data = obj;
+                //size is only known now, skip if it was evicted while loading
+                if (map.get(id) == newbucket) {
+                    let list = group.list(newbucket);
+                    newbucket.size = getSize(obj);
+                    list.size += newbucket.size;
+                    this.cacheTotalSize += newbucket.size;
+                    this.evictCachedObjects(group);
+                }
+            }, () => {
+                //don't keep failed loads around, they can be retried
+                if (map.get(id) == newbucket) { this.removeCachedObject(newbucket); }
             });
-            this.cachedObjects.push(bucket);
+            group.probation.unshift(bucket);
             map.set(id, bucket);
-            if (++this.cacheAddCounter % 100 == 0) {
-                this.sweepCachedObjects();
-            }
+        } else {
+            this.cacheHits++;
+            this.touchCachedObject(bucket);
         }
-        bucket.usecount++;
         bucket.lastuse = this.cacheFetchCounter++;
 
         if (bucket.data) {
@@ -65,32 +174,61 @@ export class CachingFileSource extends CacheFileSource {
         }
     }
 
-    sweepCachedObjects() {
-        let score = (bucket: CachedObject<any>) => {
-            //less is better
-            return (
-                //up to 100 penalty for not being used recently
-                Math.min(100, this.cacheFetchCounter - bucket.lastuse)
-                //up to 100 score for being used often
-                + Math.max(-100, -bucket.usecount * 10)
-            )
+    private touchCachedObject(bucket: CachedObject<any>) {
+        let group = bucket.group;
+        group.list(bucket).remove(bucket);
+        bucket.isprotected = true;
+        group.protected.unshift(bucket);
+        //demote the least recently used protected entries back to probation
+        while (group.protected.size > group.quota * this.protectedfraction && group.protected.tail != bucket) {
+            let demoted = group.protected.tail!;
+            group.protected.remove(demoted);
+            demoted.isprotected = false;
+            group.probation.unshift(demoted);
         }
-        this.cachedObjects.sort((a, b) => score(a) - score(b));
-        let newlength = this.cachedObjects.length;
-        let totalsize = 0;
-        for (let i = 0; i < this.cachedObjects.length; i++) {
-            let bucket = this.cachedObjects[i];
-            totalsize += bucket.size;
-            if (totalsize > this.maxcachesize) {
-                newlength = Math.min(newlength, i);
-                bucket.owner.delete(bucket.id);
-            } else {
-                bucket.usecount = 0;
+    }
+
+    private removeCachedObject(bucket: CachedObject<any>) {
+        bucket.group.list(bucket).remove(bucket);
+        bucket.owner.delete(bucket.id);
+        this.cacheTotalSize -= bucket.size;
+    }
+
+    private evictCachedObjects(group: CacheGroup) {
+        //group over its quota, evict from the group itself
+        while (group.size > group.quota) {
+            let victim = group.victim();
+            if (!victim) { break; }
+            this.removeCachedObject(victim);
+            this.cacheEvictions++;
+        }
+        //over the total size, evict the least recently used victim of all groups
+        while (this.cacheTotalSize > this.maxcachesize) {
+            let victim: CachedObject<any> | null = null;
+            for (let other of this.cacheGroups.values()) {
+                let candidate = other.victim();
+                if (candidate && (!victim || candidate.lastuse < victim.lastuse)) {
+                    victim = candidate;
+                }
             }
+            if (!victim) { break; }
+            this.removeCachedObject(victim);
+            this.cacheEvictions++;
         }
-        // console.log("scenecache sweep completed, removed", this.cachedObjects.length - newlength, "of", this.cachedObjects.length, "objects");
-        // console.log("old totalsize", totalsize);
-        this.cachedObjects.length = newlength;
+    }
+
+    getCacheStats(): CacheStats {
+        let groups: CacheStats["groups"] = {};
+        for (let group of this.cacheGroups.values()) {
+            groups[group.name] = { size: group.size, count: group.probation.count + group.protected.count, quota: group.quota };
+        }
+        return {
+            hits: this.cacheHits,
+            misses: this.cacheMisses,
+            evictions: this.cacheEvictions,
+            size: this.cacheTotalSize,
+            groups
+        };
     }
 
     getCacheIndex(major: number) {
@@ -99,15 +237,38 @@ export class CachingFileSource extends CacheFileSource {
     getFile(major: number, minor: number, crc?: number | undefined) {
         return this.rawsource.getFile(major, minor, crc);
     }
+    getFileRaw(major: number, minor: number, crc?: number | undefined) {
+        return this.rawsource.getFileRaw(major, minor, crc);
+    }
+    getFiles(major: number, minors: number[], crcs?: number[]) {
+        return this.rawsource.getFiles(major, minors, crcs);
+    }
+    prefetchFiles(major: number, minors: number[]) {
+        //archives are likely served by the disk tier, don't read rows that would never be consumed
+        if (this.diskcache) { return; }
+        this.rawsource.prefetchFiles(major, minors);
+    }
+    private async getDiskCachedArchive(index: CacheIndex) {
+        let cached = await this.diskcache!.getArchive(index).catch(e => {
+            console.warn("decoded archive cache read failed", e);
+            return null;
+        });
+        if (cached) { return cached; }
+        let files = await this.rawsource.getFileArchive(index);
+        this.diskcache!.addArchive(index, files).catch(e => console.warn("decoded archive cache write failed", e));
+        return files;
+    }
+
     getFileArchive(index: CacheIndex) {
-        let get = () => this.rawsource.getFileArchive(index);
+        //several sources report crc 0 for every group, those would collide between builds in the disk tier
+        let get = () => (this.diskcache && index.crc != 0 ? this.getDiskCachedArchive(index) : this.rawsource.getFileArchive(index));
 
         //don't attempt to cache large files that have their own cache
         if (index.major == cacheMajors.models || index.major == cacheMajors.texturesBmp || index.major == cacheMajors.texturesDds || index.major == cacheMajors.texturesPng) {
             return get();
         } else {
             let cachekey = (index.major << 23) | index.minor;//23bit so it still fits in a 31bit smi
-            return this.fetchCachedObject(this.archieveCache, cachekey, get, obj => obj.reduce((a, v) => a + v.size, 0));
+            return this.fetchCachedObject(this.archieveCache, cachekey, get, obj => obj.reduce((a, v) => a + v.size, 0), `major-${index.major}`);
         }
     }
     getBuildNr() {
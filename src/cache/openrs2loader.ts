@@ -1,12 +1,75 @@
 import * as cache from "./index";
-import { decompress, legacyGzip } from "./compression";
+import { decompressAsync, legacyGzip } from "./compression";
 import { cacheMajors, lastLegacyBuildnr, latestBuildNumber } from "../constants";
 import fetch from "node-fetch";
 import { FileSourceFsCache } from "./fscache";
+import { delay, TaskLimiter, trickleTasks } from "../utils";
 
-const endpoint = `https://archive.openrs2.org`;
+var endpoint = `https://archive.openrs2.org`;
 var downloadedBytes = 0;
 
+//shared by all openrs2 sources since they all hit the same server
+const downloadConfig = {
+	retries: 4,
+	//doubles after every failed attempt
+	retryDelay: 500
+};
+const downloadLimiter = new TaskLimiter(8);
+//concurrent requests for the same url share one download
+const pendingDownloads = new Map<string, Promise<Buffer>>();
+
+export type Openrs2DownloadOpts = { endpoint?: string, concurrency?: number, retries?: number, retryDelay?: number };
+
+/**
+ * Changes how groups are downloaded, the endpoint can point at a local stand-in of the openrs2 api.
+ * Returns the previous settings so they can be restored
+ */
+export function configureOpenrs2(opts: Openrs2DownloadOpts) {
+	let prev: Openrs2DownloadOpts = { endpoint, concurrency: downloadLimiter.max, retries: downloadConfig.retries, retryDelay: downloadConfig.retryDelay };
+	if (opts.endpoint != undefined && opts.endpoint != endpoint) {
+		endpoint = opts.endpoint;
+		cachelist = null;
+	}
+	if (opts.concurrency != undefined) { downloadLimiter.max = opts.concurrency; }
+	if (opts.retries != undefined) { downloadConfig.retries = opts.retries; }
+	if (opts.retryDelay != undefined) { downloadConfig.retryDelay = opts.retryDelay; }
+	return prev;
+}
+
+//retries network errors and server side errors, other http errors fail right away
+export function downloadWithRetry(url: string) {
+	let prom = pendingDownloads.get(url);
+	if (!prom) {
+		prom = (async () => {
+			for (let attempt = 0; ; attempt++) {
+				let err: Error;
+				let retryable = true;
+				try {
+					//the body is read inside the limiter since the connection is in use until then
+					let res = await downloadLimiter.run(async () => {
+						let req = await fetch(url);
+						if (!req.ok) {
+							//drain the error body, otherwise the connection isn't released
+							await req.arrayBuffer().catch(() => { });
+							return { status: req.status, buf: null };
+						}
+						return { status: req.status, buf: await req.arrayBuffer() };
+					});
+					if (res.buf) { return Buffer.from(res.buf); }
+					retryable = res.status == 429 || res.status >= 500;
+					err = new Error(`http code: ${res.status}`);
+				} catch (e) {
+					err = e as Error;
+				}
+				if (!retryable || attempt >= downloadConfig.retries) { throw err; }
+				await delay(downloadConfig.retryDelay * 2 ** attempt);
+			}
+		})().finally(() => pendingDownloads.delete(url));
+		pendingDownloads.set(url, prom);
+	}
+	return prom;
+}
+
 export type Openrs2CacheMeta = {
 	id: number,
 	scope: string
@@ -114,6 +177,7 @@ export class Openrs2CacheSource extends cache.DirectCacheFileSource {
 	xteaKeysLoaded = false;
 	xteakeysPromise: Promise<void> | null = null;
 	fscache: FileSourceFsCache | null;
+	private pendingFiles = new Map<string, Promise<Buffer>>();
 
 	static async fromId(cacheid: number) {
 		let caches = await loadOpenrsCachelist();
@@ -179,19 +243,21 @@ export class Openrs2CacheSource extends cache.DirectCacheFileSource {
 			let index = await this.getIndexEntryById(major, minor);
 			url = `${endpoint}/caches/runescape/archives/${major}/groups/${minor}/versions/${index.version}/checksums/${index.crc | 0}.dat`;
 		}
-		const req = await fetch(url);
-		if (!req.ok) { throw new Error(`failed to download cache file ${major}.${minor} from openrs2 ${this.meta.id}, http code: ${req.status}`); }
-		const buf = await req.arrayBuffer();
-		let res = Buffer.from(buf);
+		let res: Buffer;
+		try {
+			res = await downloadWithRetry(url);
+		} catch (e) {
+			throw new Error(`failed to download cache file ${major}.${minor} from openrs2 ${this.meta.id}, ${(e as Error).message}`);
+		}
 		//at least make sure we are aware if we're ddossing someone....
-		if (Math.floor(downloadedBytes / 10_000_000) != Math.floor((downloadedBytes + buf.byteLength) / 10_000_000)) {
+		if (Math.floor(downloadedBytes / 10_000_000) != Math.floor((downloadedBytes + res.byteLength) / 10_000_000)) {
 			console.info(`loaded ${(downloadedBytes + res.byteLength) / 1000_000 | 0} mb from openrs2`);
 		}
 		downloadedBytes += res.byteLength;
 		return res;
 	}
 
-	async getFile(major: number, minor: number, crc?: number) {
+	async getFileRaw(major: number, minor: number, crc?: number) {
 		let cachedfile: Buffer | null = null
 		if (this.fscache && typeof crc != "undefined" && crc != 0) {//TODO fix places that use a magic 0 crc
 			cachedfile = await this.fscache.getFile(major, minor, crc);
@@ -202,14 +268,75 @@ export class Openrs2CacheSource extends cache.DirectCacheFileSource {
 		if (this.fscache && !cachedfile && typeof crc != "undefined" && crc != 0) {
 			this.fscache.addFile(major, minor, crc, rawfile);
 		}
+		return rawfile;
+	}
+
+	//requests for the same group share one load, this includes prefetches
+	getFile(major: number, minor: number, crc?: number) {
+		let key = `${major}.${minor}.${crc ?? ""}`;
+		let prom = this.pendingFiles.get(key);
+		if (!prom) {
+			prom = this.loadFile(major, minor, crc).finally(() => this.pendingFiles.delete(key));
+			this.pendingFiles.set(key, prom);
+		}
+		return prom;
+	}
+
+	//starts loading groups into the fs cache, only useful if there is an fs cache to keep them in
+	prefetchFiles(major: number, minors: number[]) {
+		if (!this.fscache || this.buildnr <= lastLegacyBuildnr) { return; }
+		this.getCacheIndex(major).then(index => {
+			for (let minor of minors) {
+				let entry = index[minor];
+				if (entry) { this.getFile(major, minor, entry.crc).catch(() => { }); }
+			}
+		}).catch(() => { });
+	}
+
+	/**
+	 * Downloads every group of the given majors into the fs cache, for bulk jobs that will touch most
+	 * of the cache anyway. Failed groups are counted and skipped
+	 */
+	async prefetchMajors(majors: number[], onprogress?: (done: number, total: number) => void) {
+		if (!this.fscache) { throw new Error("prefetching requires the fs cache"); }
+		let indices = await Promise.all(majors.map(major => this.getCacheIndex(major)));
+		let entries = indices.flatMap(index => index.filter(q => q));
+		let done = 0;
+		let failed = 0;
+		let source = this;
+		//keep a few more groups than connections in flight so decompression overlaps with downloads
+		await trickleTasks("", downloadLimiter.max * 2, function* () {
+			for (let entry of entries) {
+				yield source.getFile(entry.major, entry.minor, entry.crc)
+					.catch(() => { failed++; })
+					.finally(() => onprogress?.(++done, entries.length));
+			}
+		});
+		await this.fscache.flush();
+		return { total: entries.length, failed };
+	}
+
+	private async loadFile(major: number, minor: number, crc?: number) {
+		//decompressed groups are stored as deduplicated chunks, older fs caches may still have the raw group
+		let cachable = !!this.fscache && typeof crc != "undefined" && crc != 0;
+		if (cachable) {
+			let decoded = await this.fscache!.getDecodedFile(major, minor, crc!);
+			if (decoded) { return decoded; }
+		}
+		let rawfile = (cachable ? await this.fscache!.getFile(major, minor, crc!) : null) ?? await this.downloadFile(major, minor);
+		let file: Buffer;
 		if (this.buildnr <= lastLegacyBuildnr) {
 			if (major == 0) {
-				return rawfile;
+				file = rawfile;
 			} else {
-				return legacyGzip(rawfile);
+				file = legacyGzip(rawfile);
 			}
 		} else {
-			return decompress(rawfile, this.getXteaKey(major, minor));
+			file = await decompressAsync(rawfile, this.getXteaKey(major, minor));
+		}
+		if (cachable) {
+			this.fscache!.addDecodedFile(major, minor, crc!, file);
 		}
+		return file;
 	}
 }
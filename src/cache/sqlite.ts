@@ -1,5 +1,5 @@
 import * as cache from "./index";
-import { compressSqlite, decompress } from "./compression";
+import { compressSqlite, decompressAsync } from "./compression";
 import { cacheMajors } from "../constants";
 import { CacheIndex } from "./index";
 import * as path from "path";
@@ -8,13 +8,22 @@ import * as fs from "fs";
 import type * as sqlite3 from "sqlite3";
 
 
+type CacheRow = { KEY: number, DATA: Buffer, CRC: number };
+
+//number of keys bound to the batched select, missing slots are padded with -1
+const readBatchSize = 128;
+//read ahead rows that are never consumed are dropped oldest first beyond this many
+const maxReadahead = readBatchSize * 4;
+
 type CacheTable = {
 	db: sqlite3.Database | null,
 	indices: Promise<cache.CacheIndexFile>,
 	readFile: (minor: number) => Promise<{ DATA: Buffer, CRC: number }>,
+	readFiles: (minors: number[], onrow: (row: CacheRow) => void) => Promise<void>,
 	readIndexFile: () => Promise<{ DATA: Buffer, CRC: number }>,
 	updateFile: (minor: number, data: Buffer) => Promise<void>,
-	updateIndexFile: (data: Buffer) => Promise<void>
+	updateIndexFile: (data: Buffer) => Promise<void>,
+	finalize: () => void
 }
 
 export class GameCacheLoader extends cache.CacheFileSource {
@@ -22,6 +31,9 @@ export class GameCacheLoader extends cache.CacheFileSource {
 	writable: boolean;
 	opentables = new Map<number, CacheTable>();
 	timestamp = new Date();
+	//raw rows that were read ahead in bulk, consumed by the first read. Insertion ordered so the
+	//oldest rows are evicted first when consumers stop early or the hinted window overshoots
+	readahead = new Map<number, Promise<Buffer | undefined>>();
 
 	constructor(cachedir?: string, writable?: boolean) {
 		super();
@@ -68,13 +80,16 @@ export class GameCacheLoader extends cache.CacheFileSource {
 			let db: CacheTable["db"] = null;
 			let indices: CacheTable["indices"];
 			let readFile: CacheTable["readFile"];
+			let readFiles: CacheTable["readFiles"];
 			let updateFile: CacheTable["updateFile"];
 			let readIndexFile: CacheTable["readIndexFile"];
 			let updateIndexFile: CacheTable["updateIndexFile"];
+			let finalize: CacheTable["finalize"] = () => { };
 
 			if (major == cacheMajors.index) {
 				indices = this.generateRootIndex();
 				readFile = (minor) => this.openTable(minor).readIndexFile();
+				readFiles = () => { throw new Error("root index can not be read in batches"); }
 				readIndexFile = () => { throw new Error("root index file not accesible for sqlite cache"); }
 				updateFile = (minor, data) => {
 					let table = this.openTable(minor);
@@ -96,6 +111,38 @@ export class GameCacheLoader extends cache.CacheFileSource {
 						})
 					})
 				}
+				//statements are prepared once per table, sqlite3 queues calls on the same statement
+				let singlestatement: sqlite3.Statement | null = null;
+				let batchstatement: sqlite3.Statement | null = null;
+				let stmtget = async (args: any[]) => {
+					await ready;
+					singlestatement ??= db!.prepare(`SELECT DATA,CRC FROM cache WHERE KEY=?`);
+					return new Promise<any>((resolve, reject) => {
+						singlestatement!.get(args, (err, row) => {
+							if (err) { reject(err); }
+							else { resolve(row); }
+						});
+					});
+				}
+				let stmteach = async (minors: number[], onrow: (row: CacheRow) => void) => {
+					await ready;
+					batchstatement ??= db!.prepare(`SELECT KEY,DATA,CRC FROM cache WHERE KEY IN (${new Array(readBatchSize).fill("?").join(",")})`);
+					for (let i = 0; i < minors.length; i += readBatchSize) {
+						let args = minors.slice(i, i + readBatchSize);
+						while (args.length < readBatchSize) { args.push(-1); }
+						await new Promise<void>((resolve, reject) => {
+							//row errors are passed to the row callback, report the first one once the batch is done
+							let rowerr: Error | null = null;
+							batchstatement!.each(args, (err, row) => {
+								if (err) { rowerr ??= err; }
+								else if (!rowerr) { onrow(row); }
+							}, (err) => {
+								if (err || rowerr) { reject(err ?? rowerr); }
+								else { resolve(); }
+							});
+						});
+					}
+				}
 				let dbrun = async (query: string, args: any[]) => {
 					await ready;
 					return new Promise<any>((resolve, reject) => {
@@ -105,34 +152,102 @@ export class GameCacheLoader extends cache.CacheFileSource {
 						})
 					})
 				}
-				readFile = (minor) => dbget(`SELECT DATA,CRC FROM cache WHERE KEY=?`, [minor]);
+				readFile = (minor) => stmtget([minor]);
+				readFiles = stmteach;
+				//sqlite refuses to close the db while statements are still open
+				finalize = () => {
+					singlestatement?.finalize();
+					batchstatement?.finalize();
+				}
 				readIndexFile = () => dbget(`SELECT DATA FROM cache_index`, []);
 				updateFile = (minor, data) => dbrun(`UPDATE cache SET DATA=? WHERE KEY=?`, [data, minor]);
 				updateIndexFile = (data) => dbrun(`UPDATE cache_index SET DATA=?`, [data]);
 				indices = readIndexFile().then(async row => {
-					let file = decompress(Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength));
+					let file = await decompressAsync(Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength));
 					return cache.indexBufferToObject(major, file, this);
 				});
 			}
-			this.opentables.set(major, { db, readFile, updateFile, readIndexFile, updateIndexFile, indices });
+			this.opentables.set(major, { db, readFile, readFiles, updateFile, readIndexFile, updateIndexFile, indices, finalize });
 		}
 		return this.opentables.get(major)!;
 	}
 
-	async getFile(major: number, minor: number, crc?: number) {
-		if (major == cacheMajors.index) { return this.getIndexFile(minor); }
+	private takeReadahead(major: number, minor: number) {
+		let readaheadkey = (major << 23) | minor;
+		let ahead = this.readahead.get(readaheadkey);
+		if (ahead) { this.readahead.delete(readaheadkey); }
+		return ahead;
+	}
+
+	async getFileRaw(major: number, minor: number, crc?: number) {
+		let ahead = this.takeReadahead(major, minor);
+		if (ahead) {
+			let file = await ahead;
+			if (file) { return file; }
+		}
 		let { readFile: getFile } = this.openTable(major);
 		let row = await getFile(minor);
 		if (typeof crc == "number" && row.CRC != crc) {
 			//TODO this is always off by either 1 or 2
 			// console.log(`crc from cache (${row.CRC}) did not match requested crc (${crc}) for ${major}.${minor}`);
 		}
-		let file = Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength);
+		return Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength);
+	}
+
+	async getFile(major: number, minor: number, crc?: number) {
+		if (major == cacheMajors.index) { return this.getIndexFile(minor); }
+		let file = await this.getFileRaw(major, minor, crc);
 		// console.log("size",file.byteLength);
-		let res = decompress(file);
+		let res = await decompressAsync(file);
 		return res;
 	}
 
+	async getFiles(major: number, minors: number[], crcs?: number[]) {
+		if (major == cacheMajors.index) { return super.getFiles(major, minors, crcs); }
+		//rows that were already read ahead are used as is, the rest are read in one batch
+		let decoded = new Map<number, Promise<Buffer>>();
+		let crcmap = new Map(crcs ? minors.map((minor, i) => [minor, crcs[i]]) : []);
+		let remaining: number[] = [];
+		for (let minor of minors) {
+			let ahead = this.takeReadahead(major, minor);
+			if (ahead) {
+				decoded.set(minor, ahead.then(file => (file ? decompressAsync(file) : this.getFile(major, minor, crcmap.get(minor)))));
+			} else {
+				remaining.push(minor);
+			}
+		}
+		//start decompressing rows while the rest of them are still streaming in
+		if (remaining.length != 0) {
+			await this.openTable(major).readFiles(remaining, row => {
+				decoded.set(row.KEY, decompressAsync(Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength)));
+			});
+		}
+		return Promise.all(minors.map(minor => {
+			let file = decoded.get(minor);
+			if (!file) { throw new Error(`file ${major}.${minor} not found in sqlite cache`); }
+			return file;
+		}));
+	}
+
+	prefetchFiles(major: number, minors: number[]) {
+		if (major == cacheMajors.index) { return; }
+		let pending = minors.filter(minor => !this.readahead.has((major << 23) | minor));
+		let table = this.openTable(major);
+		for (let i = 0; i < pending.length; i += readBatchSize) {
+			let batch = pending.slice(i, i + readBatchSize);
+			let rows = new Map<number, Buffer>();
+			let done = table.readFiles(batch, row => rows.set(row.KEY, Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength)));
+			for (let minor of batch) {
+				//failed or missing rows fall back to a normal read
+				this.readahead.set((major << 23) | minor, done.then(() => rows.get(minor), () => undefined));
+			}
+		}
+		for (let key of this.readahead.keys()) {
+			if (this.readahead.size <= maxReadahead) { break; }
+			this.readahead.delete(key);
+		}
+	}
+
 	async getFileArchive(index: cache.CacheIndex) {
 		let arch = await this.getFile(index.major, index.minor, index.crc);
 		let res = cache.unpackSqliteBufferArchive(arch, index.subindices, index.subnames);
@@ -157,11 +272,13 @@ export class GameCacheLoader extends cache.CacheFileSource {
 	async getIndexFile(major: number) {
 		let row = await this.openTable(major).readIndexFile();
 		let file = Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength);
-		return decompress(file);
+		return decompressAsync(file);
 	}
 
 	close() {
+		this.readahead.clear();
 		for (let table of this.opentables.values()) {
+			table.finalize();
 			table.db?.close();
 		}
 	}
@@ -1,6 +1,6 @@
 import { cacheMajors } from "../constants";
 import { AbstractSQLiteStatement, AbstractSQLiteWorker } from "../libs/sqlite3wrap";
-import { decompress } from "./compression";
+import { decompressAsync } from "./compression";
 import * as cache from "./index";
 
 
@@ -91,7 +91,7 @@ export class WasmGameCacheLoader extends cache.CacheFileSource {
 		let table = index.table ?? await index.tableready;
 		let [row] = await table.getfile.run(minor);
 		let res = Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength);
-		return decompress(res);
+		return decompressAsync(res);
 	}
 
 	async getFileArchive(index: cache.CacheIndex) {
@@ -112,7 +112,7 @@ export class WasmGameCacheLoader extends cache.CacheFileSource {
 	async getIndexFile(major: number) {
 		let [row] = await this.prepareTable(major).tableready.then(q => q.getindex.run());
 		let res = Buffer.from(row.DATA.buffer, row.DATA.byteOffset, row.DATA.byteLength);
-		return decompress(res);
+		return decompressAsync(res);
 	}
 
 	close() {
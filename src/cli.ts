@@ -2,6 +2,7 @@ import * as cmdts from "cmd-ts";
 import { CliApiContext, cliApi } from "./clicommands";
 import { cliArguments } from "./cliparser";
 import { CLIScriptFS, CLIScriptOutput } from "./scriptrunner";
+import { closeDecompressPool } from "./cache/compression";
 
 let ctx: CliApiContext = {
     getFs(fsname: string) { return new CLIScriptFS(fsname); },
@@ -10,4 +11,5 @@ let ctx: CliApiContext = {
 
 let api = cliApi(ctx);
 
-cmdts.run(api.subcommands, cliArguments());
\ No newline at end of file
+//stop the decompression workers once the command is done
+cmdts.run(api.subcommands, cliArguments()).finally(closeDecompressPool);
\ No newline at end of file
@@ -20,6 +20,13 @@ import { extractClientModuleCode, IsolatedCS2Module } from "./clientscript/types
 import { diffFileDependencyHash } from "./scripts/dependencydiff";
 import { EngineCache } from "./3d/modeltothree";
 import { cacheFileJsonModes } from "./parser/jsondecoders";
+import { benchCompression } from "./scripts/benchcompression";
+import { benchDependencies } from "./scripts/benchdependencies";
+import { benchDedupe } from "./scripts/benchdedupe";
+import { testDownloaders } from "./scripts/testdownloaders";
+import { prefetchOpenrs2 } from "./scripts/prefetchopenrs2";
+import { configureOpenrs2, Openrs2CacheSource } from "./cache/openrs2loader";
+import { stringToMapArea } from "./utils";
 
 
 export type CliApiContext = {
@@ -336,6 +343,88 @@ export function cliApi(ctx: CliApiContext) {
 		}
 	});
 
+	const benchcompression = command({
+		name: "benchcompression",
+		args: {
+			...filesource,
+			...saveArg("bench"),
+			majors: option({ long: "majors", short: "m", type: cmdts.string, defaultValue: () => "2,8,47" }),
+			maxfiles: option({ long: "maxfiles", short: "n", type: cmdts.number, defaultValue: () => 200 })
+		},
+		async handler(args) {
+			let output = ctx.getConsole();
+			let source = await args.source();
+			let majors = args.majors.split(",").map(q => +q);
+			if (majors.some(q => isNaN(q))) { throw new Error("invalid majors"); }
+			await output.run(benchCompression, args.save, source, majors, args.maxfiles);
+		}
+	});
+
+	const benchdedupe = command({
+		name: "benchdedupe",
+		args: {
+			...saveArg("bench"),
+			builds: option({ long: "builds", short: "b", type: cmdts.number, defaultValue: () => 20 }),
+			skip: option({ long: "skip", short: "s", type: cmdts.number, defaultValue: () => 0 }),
+			majors: option({ long: "majors", short: "m", type: cmdts.string, defaultValue: () => "2,16,18,19,47" }),
+			maxfiles: option({ long: "maxfiles", short: "n", type: cmdts.number, defaultValue: () => 500 })
+		},
+		async handler(args) {
+			let output = ctx.getConsole();
+			let majors = args.majors.split(",").map(q => +q);
+			if (majors.some(q => isNaN(q))) { throw new Error("invalid majors"); }
+			await output.run(benchDedupe, args.save, args.builds, args.skip, majors, args.maxfiles);
+		}
+	});
+
+	const benchdeps = command({
+		name: "benchdeps",
+		args: {
+			...filesource,
+			...saveArg("bench"),
+			area: option({ long: "area", short: "a", type: cmdts.optional(cmdts.string) })
+		},
+		async handler(args) {
+			let output = ctx.getConsole();
+			let engine = await EngineCache.create(await args.source());
+			let area = (args.area ? stringToMapArea(args.area) : undefined);
+			if (area === null) { throw new Error("invalid area"); }
+			await output.run(benchDependencies, args.save, engine, area);
+			engine.close();
+		}
+	});
+
+	const prefetch = command({
+		name: "prefetch",
+		args: {
+			...filesource,
+			majors: option({ long: "majors", short: "m", defaultValue: () => "", description: "Comma separated majors, defaults to all" }),
+			concurrency: option({ long: "concurrency", short: "c", type: cmdts.optional(cmdts.number), description: "Max parallel openrs2 downloads" }),
+			retries: option({ long: "retries", short: "r", type: cmdts.optional(cmdts.number) }),
+			endpoint: option({ long: "endpoint", short: "e", type: cmdts.optional(cmdts.string), description: "Alternative openrs2 api url" })
+		},
+		async handler(args) {
+			let output = ctx.getConsole();
+			let majors = (args.majors ? args.majors.split(",").map(q => +q) : []);
+			if (majors.some(q => isNaN(q))) { throw new Error("invalid majors"); }
+			//has to be configured before the source loads the cache list
+			configureOpenrs2({ endpoint: args.endpoint, concurrency: args.concurrency, retries: args.retries });
+			let source = await args.source();
+			if (!(source instanceof Openrs2CacheSource)) { throw new Error("prefetch only works with openrs2 sources"); }
+			await output.run(prefetchOpenrs2, source, majors);
+			source.close();
+		}
+	});
+
+	const testdownloaders = command({
+		name: "testdownloaders",
+		args: {},
+		async handler(args) {
+			let output = ctx.getConsole();
+			await output.run(testDownloaders);
+		}
+	});
+
 	let subcommands = cmdts.subcommands({
 		name: "",
 		cmds: {
@@ -353,7 +442,12 @@ export function cliApi(ctx: CliApiContext) {
 			cluecoords,
 			sequencegroups,
 			gameinterfaces,
-			clientscriptmodule
+			clientscriptmodule,
+			benchcompression,
+			benchdedupe,
+			benchdeps,
+			prefetch,
+			testdownloaders
 		}
 	});
 
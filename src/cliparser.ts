@@ -21,7 +21,7 @@ function cacheSourceFromString(str: string) {
 	return async (opts: CacheOpts) => {
 		switch (mode) {
 			case "live":
-				return new CacheDownloader();
+				return new CacheDownloader(arg ? +arg : undefined);
 			case "auto":
 				let fs = new CLIScriptFS(arg);
 				return selectFsCache(fs, opts);
@@ -56,7 +56,7 @@ function cacheSourceFromString(str: string) {
 export const ReadCacheSource: cmdts.Type<string, (opts?: { writable?: boolean }) => Promise<CacheFileSource>> = {
 	async from(str) { return cacheSourceFromString(str); },
 	defaultValue: () => cacheSourceFromString("cache"),
-	description: "Where to get game files from, can be 'live', 'cache[:rscachedir]', openrs2[:ors2cacheid] or openrs2last[:skipcount]"
+	description: "Where to get game files from, can be 'live[:socketcount]', 'cache[:rscachedir]', openrs2[:ors2cacheid] or openrs2last[:skipcount]"
 };
 
 const FileRangeArgument: cmdts.Type<string, FileRange[]> = {
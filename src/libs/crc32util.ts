@@ -43,6 +43,44 @@ export function crc32(buf: Uint8Array | Uint8ClampedArray, crc = 0, rangeStart =
 	return (crc ^ 0xffffffff) >>> 0;
 }
 
+//multiplies two polynomials modulo POLY, bit reflected like the table
+export function crc32multmod(a: number, b: number) {
+	let m = 0x80000000;
+	let p = 0;
+	while (true) {
+		if (a & m) {
+			p ^= b;
+			if ((a & (m - 1)) == 0) { break; }
+		}
+		m >>>= 1;
+		b = (b & 1 ? (b >>> 1) ^ POLY : b >>> 1);
+	}
+	return p >>> 0;
+}
+
+//x^(2^n) mod POLY
+const crc32_x2n = new Uint32Array(32);
+crc32_x2n[0] = 1 << 30;
+for (let n = 1; n < 32; n++) { crc32_x2n[n] = crc32multmod(crc32_x2n[n - 1], crc32_x2n[n - 1]); }
+
+/**
+ * The operator that advances a crc over len zero bytes, crc32combine with it is the same as
+ * continuing a crc over a buffer of that length. Same approach as zlib crc32_combine
+ */
+export function crc32shift(len: number) {
+	let p = 0x80000000;
+	for (let k = 3; len != 0; k++) {
+		if (len % 2 == 1) { p = crc32multmod(crc32_x2n[k & 31], p); }
+		len = Math.floor(len / 2);
+	}
+	return p;
+}
+
+//crc of A+B given crc(A), crc(B) and the shift operator for the length of B
+export function crc32combine(crca: number, crcb: number, shiftb: number) {
+	return (crc32multmod(shiftb, crca) ^ crcb) >>> 0;
+}
+
 const staticintbuf = Buffer.alloc(4);
 export function crc32addInt(int: number, crc: number) {
 	staticintbuf.writeUInt32BE(int >>> 0);
@@ -0,0 +1,152 @@
+//works with both web workers and node worker_threads
+export type WorkerLike = {
+	postMessage(message: any, transfer?: any[]): void,
+	terminate(): any,
+	//node only, idle workers shouldn't keep the process alive
+	ref?(): void,
+	unref?(): void
+}
+
+type WorkerResponse = { id: number, data?: any, error?: string };
+
+/**
+ * Pool of identical workers using the same { id, packet } => { id, data | error } protocol as
+ * the sqlite worker. Jobs are handed to the worker with the least pending jobs unless a specific
+ * worker is requested, which is useful when workers keep state like uploaded textures.
+ * A worker that crashes or exits fails its pending jobs and is replaced by a new one.
+ */
+export class WorkerPool<PACKET> {
+	private workers: { worker: WorkerLike, pending: number }[] = [];
+	private callbacks = new Map<number, { resolve: (v: any) => void, reject: (e: Error) => void, worker: number }>();
+	private msgidcounter = 1;
+	private factory: () => WorkerLike;
+	private closed = false;
+
+	constructor(factory: () => WorkerLike, size = workerThreadCount()) {
+		this.factory = factory;
+		for (let i = 0; i < size; i++) {
+			this.workers.push({ worker: this.startWorker(i), pending: 0 });
+		}
+	}
+
+	private startWorker(index: number) {
+		let worker = this.factory();
+		let onmessage = (msg: WorkerResponse) => {
+			let handler = this.callbacks.get(msg.id);
+			if (!handler) { return; }
+			this.callbacks.delete(msg.id);
+			let entry = this.workers[handler.worker];
+			entry.pending--;
+			if (entry.pending == 0) { entry.worker.unref?.(); }
+			if (msg.error != undefined) {
+				handler.reject(new Error(msg.error));
+			} else {
+				handler.resolve(msg.data);
+			}
+		}
+		let onfailed = (reason: string) => this.workerFailed(index, worker, reason);
+		if (typeof (worker as any).on == "function") {
+			(worker as any).on("message", onmessage);
+			(worker as any).on("error", (e: Error) => onfailed(e.message));
+			(worker as any).on("exit", (code: number) => onfailed(`exit code ${code}`));
+		} else {
+			(worker as any).onmessage = (e: MessageEvent) => onmessage(e.data);
+			(worker as any).onerror = (e: ErrorEvent) => onfailed(e.message);
+		}
+		worker.unref?.();
+		return worker;
+	}
+
+	//rejects the jobs of a crashed worker, otherwise they would never settle
+	private workerFailed(index: number, worker: WorkerLike, reason: string) {
+		let entry = this.workers[index];
+		//already replaced, node emits both error and exit for the same crash
+		if (this.closed || !entry || entry.worker != worker) { return; }
+		for (let [id, handler] of this.callbacks) {
+			if (handler.worker != index) { continue; }
+			this.callbacks.delete(id);
+			handler.reject(new Error(`worker crashed: ${reason}`));
+		}
+		worker.terminate();
+		entry.pending = 0;
+		entry.worker = this.startWorker(index);
+	}
+
+	get size() {
+		return this.workers.length;
+	}
+
+	call<T>(packet: PACKET, transfer: any[] = [], workerindex = -1) {
+		if (workerindex == -1) {
+			workerindex = 0;
+			for (let i = 1; i < this.workers.length; i++) {
+				if (this.workers[i].pending < this.workers[workerindex].pending) { workerindex = i; }
+			}
+		}
+		let entry = this.workers[workerindex];
+		let id = this.msgidcounter++;
+		let prom = new Promise<T>((resolve, reject) => this.callbacks.set(id, { resolve, reject, worker: workerindex }));
+		if (entry.pending++ == 0) { entry.worker.ref?.(); }
+		entry.worker.postMessage({ id, packet }, transfer);
+		return prom;
+	}
+
+	close() {
+		this.closed = true;
+		for (let entry of this.workers) {
+			entry.worker.terminate();
+		}
+		for (let handler of this.callbacks.values()) {
+			handler.reject(new Error("worker pool closed"));
+		}
+		this.callbacks.clear();
+		this.workers = [];
+	}
+}
+
+export function workerThreadCount() {
+	let cores = (typeof navigator != "undefined" ? navigator.hardwareConcurrency : require("os").cpus().length);
+	//leave one core for the main thread
+	return Math.max(1, (cores ?? 2) - 1);
+}
+
+/**
+ * Collects buffers that can be transferred instead of copied, only views that own their entire
+ * buffer qualify since node Buffers are often slices of a shared pool
+ */
+export function collectTransferables(data: any, transfer: ArrayBuffer[] = []) {
+	if (ArrayBuffer.isView(data)) {
+		if (data.byteOffset == 0 && data.byteLength == data.buffer.byteLength && data.buffer instanceof ArrayBuffer && !transfer.includes(data.buffer)) {
+			transfer.push(data.buffer);
+		}
+	} else if (Array.isArray(data)) {
+		data.forEach(q => collectTransferables(q, transfer));
+	} else if (data && typeof data == "object" && Object.getPrototypeOf(data) == Object.prototype) {
+		Object.values(data).forEach(q => collectTransferables(q, transfer));
+	}
+	return transfer;
+}
+
+/**
+ * Worker side of WorkerPool, call this once from the worker entry file
+ */
+export function serveWorkerPool<PACKET>(handler: (packet: PACKET) => any) {
+	let port: { postMessage(message: any, transfer?: any[]): void };
+	let respond = async (msg: { id: number, packet: PACKET }) => {
+		try {
+			let data = await handler(msg.packet);
+			port.postMessage({ id: msg.id, data }, collectTransferables(data));
+		} catch (e) {
+			port.postMessage({ id: msg.id, error: e.message ?? String(e) });
+		}
+	}
+	if (typeof self != "undefined" && typeof (self as any).postMessage == "function") {
+		port = self as any;
+		//use a listener since some libs (lzma) install their own onmessage when loaded in a worker
+		self.addEventListener("message", (e: MessageEvent) => respond(e.data));
+	} else {
+		let parentport = require("worker_threads").parentPort;
+		port = parentport;
+		parentport.on("message", respond);
+	}
+}
@@ -281,6 +281,8 @@ export const examplemapconfig = `
 	"noyflip": false,
 	//set to true to keep output chunks aligned with in-game chunks. Incurs performance penalty as more neighbouring chunks have to be loaded
 	"nochunkoffset": false,
+	//"webgl" or "software", the software backend renders minimap layers on the cpu without needing a gpu
+	"renderbackend": "webgl",
 	//list of layers to render
 	"layers": [
 		{
@@ -326,6 +328,7 @@ export const examplemapconfig = `
 			"level": 0,
 			"pxpersquare": 16,
 			"hidelocs": false, //can be turned on to emulate partially loaded minimap
+			"locatlas": false, //batches all locs in a chunk into one draw call using a shared texture atlas, slightly different texture filtering
 			"mipmode": "avg", //results in every pixel of a mip image being exactly the mean of 4 zoomed pixels without any other filtering steps, required for minimap localization
 			"dxdy": 0,
 			"dzdy": 0
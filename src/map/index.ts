@@ -16,6 +16,7 @@ import { MipScheduler } from "./mipper";
 import { crc32addInt } from "../libs/crc32util";
 import { ChunkrenderContext, ImgNameInfoZoom, MaprenderSquare, MaprenderSquareLoaded, rendermodes, RenderResult, RenderTask } from "./layers";
 import { VariantGroup, VariantInfo, VariantResolver } from "./varianttracker";
+import { SoftwareMapRenderer } from "./softrender";
 
 type RenderedMapVersionMeta = {
 	buildnr: number,
@@ -46,6 +47,7 @@ export type Mapconfig = {
 	noyflip: boolean | undefined,
 	nochunkoffset: boolean | undefined,
 	skipsymlinks: boolean | undefined,
+	renderbackend?: "webgl" | "software"
 }
 
 export type LayerConfig = {
@@ -62,6 +64,9 @@ export type LayerConfig = {
 	dxdy: number,
 	dzdy: number,
 	hidelocs?: boolean,
+	locatlas?: boolean,
+	//render from simplified meshes, meant for layers that only render low zoom levels
+	lod?: number,
 	overlaywalls?: boolean,
 	overlayicons?: boolean
 } | {
@@ -252,19 +257,24 @@ export async function runMapRender(output: ScriptOutput, filesource: CacheFileSo
 		var deps = await engine.getDependencyGraph();
 		globalThis.onWatchdogProgress?.();
 		await deps.preloadChunkDependencies({ area: deparea });
+		deps.computeSubtreeHashes();
 		globalThis.onWatchdogProgress?.();
 	} catch (e) {
 		console.error(e);
 		progress.updateProp("deps", "errored dependency graph");
 		return cleanup;
 	}
-	progress.updateProp("deps", `completed, ${deps.dependencyMap.size} nodes`);
+	progress.updateProp("deps", `completed, ${deps.nodeCount} nodes`);
 	// progress.updateProp("version", new Date(deps.maxVersion * 1000).toUTCString());
 
 
 	let opts: ParsemapOpts = { mask };
 	if (config.config.layers.some(q => q.mode == "minimap")) { opts.minimap = true; }
+	if (config.config.layers.some(q => q.mode == "minimap" && q.locatlas)) { opts.minimapatlas = true; }
 	if (config.config.layers.some(q => q.mode == "collision")) { opts.collision = true; }
+	//chunks are shared between layers, so simplified meshes can only be used if every 3d layer allows it
+	let layerlods = config.config.layers.flatMap(q => (q.mode == "3d" || q.mode == "minimap" ? [q.lod ?? 0] : []));
+	if (layerlods.length != 0 && layerlods.every(q => q > 0)) { opts.lod = Math.min(...layerlods); }
 	opts = RSMapChunk.defaultopts(opts);
 	let getRenderer = () => {
 		let cnv = document.createElement("canvas");
@@ -280,7 +290,12 @@ export async function runMapRender(output: ScriptOutput, filesource: CacheFileSo
 }
 
 export class MapRenderer {
-	renderer: ThreeJsRenderer;
+	//null if every layer that renders 3d is handled by the software renderer
+	renderer: ThreeJsRenderer | null = null;
+	//replaces the gl renderer for minimap layers if set
+	softrenderer: SoftwareMapRenderer | null = null;
+	//the software renderer already uses all cores, renderers recreated after errors reuse it
+	private static sharedSoftRenderer: SoftwareMapRenderer | null = null;
 	engine: EngineCache;
 	config: MapRender;
 	scenecache: ThreejsSceneCache | null = null;
@@ -296,6 +311,29 @@ export class MapRenderer {
 		this.opts = opts;
 		this.deps = deps;
 		this.config = config;
+		if (config.config.renderbackend == "software") {
+			this.softrenderer = (MapRenderer.sharedSoftRenderer ??= new SoftwareMapRenderer());
+		}
+		//don't create a gl context if all 3d layers are minimaps rendered in software
+		if (!this.softrenderer || config.config.layers.some(q => q.mode == "3d" || q.mode == "interactions")) {
+			this.initGlRenderer(cnv);
+		}
+	}
+
+	/**
+	 * Closes the worker pool of the software renderer that is shared between all map renderers
+	 */
+	static disposeSharedRenderers() {
+		MapRenderer.sharedSoftRenderer?.close();
+		MapRenderer.sharedSoftRenderer = null;
+	}
+
+	getGlRenderer() {
+		if (!this.renderer) { throw new Error("this map config renders without webgl"); }
+		return this.renderer;
+	}
+
+	private initGlRenderer(cnv: HTMLCanvasElement) {
 		this.renderer = new ThreeJsRenderer(cnv, { alpha: false });
 		//TODO turn opaquebackground back on for map renders
 		this.renderer.addSceneElement({ getSceneElements() { return { options: { autoFrames: "never", hideFog: true } }; } });
@@ -374,7 +412,9 @@ export class MapRenderer {
 			}
 		}
 		await Promise.all(load.map(q => q.loadprom));
-		load.forEach(q => q.model?.addToScene(this.renderer));
+		if (this.renderer) {
+			load.forEach(q => q.model?.addToScene(this.renderer!));
+		}
 		let obsolete = this.squares.filter(square => !load.includes(square));
 		if (obsolete.length >= this.maxunused) {
 			obsolete.sort((a, b) => b.id - a.id);
@@ -494,6 +534,7 @@ export async function downloadMap(output: ScriptOutput, getRenderer: () => MapRe
 	await trickleTasks("", 10, render);
 	await mipper.run(true);
 	await varianttracker.finishChunk(true);
+	MapRenderer.disposeSharedRenderers();
 	configjson.errorcount = errs.length;
 	configjson.running = false;
 	await config.saveFile("meta.json", Buffer.from(JSON.stringify(configjson, undefined, "\t")));
@@ -502,19 +543,18 @@ export async function downloadMap(output: ScriptOutput, getRenderer: () => MapRe
 
 export class SimpleHasher {
 	depstracker: DependencyGraph;
-	subhashes: { x: number, z: number, hash: number }[] = [];
+	subhashes = new Map<number, number>();
 	constructor(deps: DependencyGraph) {
 		this.depstracker = deps;
 	}
 	getsubhash(x: number, z: number) {
-		let h = this.subhashes.find(q => q.x == x && q.z == z);
-		if (!h) {
-			let hash = this.depstracker.hashDependencies(this.depstracker.makeDeptName("mapsquare", packMapsquare(x, z)));
-			this.subhashes.push({ x, z, hash });
-			return hash;
-		} else {
-			return h.hash;
+		let squareindex = packMapsquare(x, z);
+		let hash = this.subhashes.get(squareindex);
+		if (hash == undefined) {
+			hash = this.depstracker.hashDependencies(this.depstracker.makeDeptName("mapsquare", squareindex));
+			this.subhashes.set(squareindex, hash);
 		}
+		return hash;
 	}
 	recthash(rect: MapRect) {
 		let hash = 0;
@@ -677,7 +717,7 @@ export function renderMapsquare(engine: EngineCache, config: MapRender, depstrac
 				miptasks.push(() => {
 					let nameinfo = task.nameinfo as ImgNameInfoZoom;
 					if (nameinfo.zoom == null) { throw new Error("only zoomed tasks can be mipped"); }
-					mipper.addTask(task.layer, nameinfo, stored);
+					mipper.addTask(task.layer, nameinfo, stored, res?.pixels ?? null);
 				});
 			}
 		}
@@ -118,7 +118,9 @@ export const rendermode3d: RenderMode<"3d" | "minimap"> = function ({ engine, co
                         }
 
                         // the actual render
-                        let img = await renderer.renderer.takeMapPicture(cam, tiles * pxpersquare, tiles * pxpersquare, layer.mode == "minimap");
+                        let img = (layer.mode == "minimap" && renderer.softrenderer
+                            ? await renderer.softrenderer.takeMapPicture(cam, tiles * pxpersquare, tiles * pxpersquare, chunks.map(q => q.model.rootnode))
+                            : await renderer.getGlRenderer().takeMapPicture(cam, tiles * pxpersquare, tiles * pxpersquare, layer.mode == "minimap"));
 
                         if (overlayimg) {
                             let mergecnv = document.createElement("canvas");
@@ -135,11 +137,13 @@ export const rendermode3d: RenderMode<"3d" | "minimap"> = function ({ engine, co
                                 0, 0, img.width, img.height
                             );
                             return {
-                                file: canvasToImageFile(mergecnv, format.ext as any, 0.9)
+                                file: canvasToImageFile(mergecnv, format.ext as any, 0.9),
+                                pixels: ctx.getImageData(0, 0, img.width, img.height)
                             };
                         } else {
                             return {
-                                file: pixelsToImageFile(img, format.ext as any, 0.9)
+                                file: pixelsToImageFile(img, format.ext as any, 0.9),
+                                pixels: img
                             };
                         }
                     }
@@ -183,7 +187,7 @@ export const rendermodeInteractions: RenderMode<"interactions"> = function ({ co
                 let baseheight = getTileHeight(loaded.grid, locdata.x, locdata.z, locdata.plane);
                 let ypos = baseheight / tiledimensions + center[1];
                 let cam = mapImageCamera(locdata.x + center[0] + ypos * layer.dxdy - ntiles / 2, locdata.z + center[2] + ypos * layer.dzdy - ntiles / 2, ntiles, layer.dxdy, layer.dzdy);
-                let img = await renderer.renderer.takeMapPicture(cam, ntiles * layer.pxpersquare, ntiles * layer.pxpersquare, false, group);
+                let img = await renderer.getGlRenderer().takeMapPicture(cam, ntiles * layer.pxpersquare, ntiles * layer.pxpersquare, false, group);
                 group.removeFromParent();
 
                 model.map(q => q.mesh.setSectionHide(q, false));
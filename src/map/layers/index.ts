@@ -38,6 +38,8 @@ export type MaprenderSquareLoaded = MaprenderSquare & {
 
 export type RenderResult = {
     file?: Promise<Buffer>,
+    //decoded pixels of file, lets the mip pyramid skip reading it back
+    pixels?: ImageData,
     symlink?: VariantInfo,
     exacthash?: number
 }
@@ -1,21 +1,36 @@
 import { LayerConfig } from ".";
-import { canvasToImageFile, fileToImageData, makeImageData } from "../imgutils";
+import { fileToImageData, makeImageData, pixelsToImageFile } from "../imgutils";
 import { crc32addInt } from "../libs/crc32util";
+import { WorkerPool } from "../libs/workerpool";
 import { getOrInsert } from "../utils";
 import { MapRender, SymlinkCommand } from "./backends";
 import { getModeOutputInfo, ImgNameInfoZoom } from "./layers";
 import { ProgressUI } from "./progressui";
 import { VariantInfo, VariantResolver } from "./varianttracker";
+import type { MipEncodePacket } from "./mipworker";
+
+//decoded tiles kept around for the next zoom level, older tiles are dropped and read from disk instead
+const maxPyramidBytes = 256 * 1024 * 1024;
 
 type MipFile = {
 	sourceinfo: ImgNameInfoZoom,
-	filevariant: VariantInfo | null
+	filevariant: VariantInfo | null,
+	//decoded pixels if this tile was rendered or mipped during this run
+	pixels: ImageData | null
 };
 type MipCommand = {
 	layer: LayerConfig,
 	imgname: ImgNameInfoZoom,
 	files: (MipFile | null)[]
 };
+type MipTask = {
+	name: string,
+	hash: number,
+	exacthash: number,
+	args: MipCommand,
+	pixels: ImageData | null,
+	run: () => Promise<void>
+};
 
 export class MipScheduler {
 	render: MapRender;
@@ -24,13 +39,16 @@ export class MipScheduler {
 	incompletes = new Map<string, MipCommand>();
 	minzoom: number;
 	running: Promise<void> | null = null;
+	//in memory part of the pyramid in insertion order, so the oldest tiles get evicted first
+	pixelfiles = new Set<MipFile>();
+	pixelbytes = 0;
 	constructor(render: MapRender, varianttracker: VariantResolver, progress: ProgressUI) {
 		this.render = render;
 		this.varianttracker = varianttracker;
 		this.progress = progress;
 		this.minzoom = Math.floor(Math.log2(render.config.tileimgsize / (Math.max(render.config.mapsizex, render.config.mapsizez) * 64)));
 	}
-	addTask(layer: LayerConfig, src: ImgNameInfoZoom, filevariant: VariantInfo | null) {
+	addTask(layer: LayerConfig, src: ImgNameInfoZoom, filevariant: VariantInfo | null, pixels: ImageData | null = null) {
 		if (src.zoom - 1 < this.minzoom) { return; }
 		let format = getModeOutputInfo(this.render, layer, src.zoom - 1).ext;
 		let newname = this.render.makeFileName(layer.name, src.zoom - 1, Math.floor(src.x / 2), Math.floor(src.y / 2), format);
@@ -48,10 +66,44 @@ export class MipScheduler {
 		let isbot = (src.y % 2) != 0;
 		if (this.render.config.noyflip) { isbot = !isbot; }
 		let subindex = (isright ? 1 : 0) + (isbot ? 2 : 0);
-		incomp.files[subindex] = {
+		let old = incomp.files[subindex];
+		if (old) { this.releasePixels(old); }
+		let file: MipFile = {
 			sourceinfo: src,
 			filevariant: filevariant,
+			pixels: null
 		};
+		incomp.files[subindex] = file;
+		if (pixels && filevariant && pixels.width == this.render.config.tileimgsize && pixels.height == this.render.config.tileimgsize) {
+			this.keepPixels(file, pixels);
+		}
+	}
+	private keepPixels(file: MipFile, pixels: ImageData) {
+		file.pixels = pixels;
+		this.pixelfiles.add(file);
+		this.pixelbytes += pixels.data.byteLength;
+		for (let oldest of this.pixelfiles) {
+			if (this.pixelbytes <= maxPyramidBytes) { break; }
+			this.releasePixels(oldest);
+		}
+	}
+	private releasePixels(file: MipFile) {
+		if (!file.pixels) { return; }
+		this.pixelbytes -= file.pixels.data.byteLength;
+		this.pixelfiles.delete(file);
+		file.pixels = null;
+	}
+	//finished mips wait in their task until the whole group is done, they count against the cap so they
+	//push older tiles out of memory. Returns false if they don't fit at all, the pixels are dropped then
+	private reservePixels(pixels: ImageData) {
+		let size = pixels.data.byteLength;
+		for (let oldest of this.pixelfiles) {
+			if (this.pixelbytes + size <= maxPyramidBytes) { break; }
+			this.releasePixels(oldest);
+		}
+		if (this.pixelbytes + size > maxPyramidBytes) { return false; }
+		this.pixelbytes += size;
+		return true;
 	}
 	async run(includeIncomplete = false) {
 		// wait for any previous run to finish before starting a new one
@@ -64,7 +116,7 @@ export class MipScheduler {
 		const maxgroup = 200;
 		let completed = 0;
 		let skipped = 0;
-		let tasks: { name: string, hash: number, exacthash: number, args: MipCommand, run: () => Promise<void> }[] = [];
+		let tasks: MipTask[] = [];
 		let processTasks = async () => {
 			// dedupe using varianttracker
 			let candidatesprom = tasks.map(q => {
@@ -110,11 +162,17 @@ export class MipScheduler {
 				savemetaqueue.push(resolver.addFile(task.args.imgname.x, task.args.imgname.y, variant));
 
 				callbacks.push(() => {
-					this.addTask(task.args.layer, task.args.imgname, variant);
+					//the reservation moves over to the pyramid in addTask
+					if (task.pixels) { this.pixelbytes -= task.pixels.data.byteLength; }
+					this.addTask(task.args.layer, task.args.imgname, variant, task.pixels);
 				});
 			}
 			proms.push(this.render.symlinkBatch(symlinks));
 			await Promise.all(proms);
+			// the children are not needed anymore once their parent exists
+			for (let task of tasks) {
+				task.args.files.forEach(q => q && this.releasePixels(q));
+			}
 			await Promise.all(savemetaqueue);
 			callbacks.forEach(q => q());
 			tasks = [];
@@ -150,17 +208,20 @@ export class MipScheduler {
 					exacthash = crc32addInt(file?.filevariant?.exacthash ?? 0, exacthash);
 				}
 
-				tasks.push({
+				let task: MipTask = {
 					name: out,
 					hash: hash,
 					exacthash: exacthash,
 					args: args,
+					pixels: null,
 					run: async () => {
 						let imgformat = getModeOutputInfo(this.render, args.layer, args.imgname.zoom).ext;
-						let buf = await mipCanvas(this.render, args.files, imgformat as any, 0.9, args.layer.mipmode == "avg");
-						await this.render.saveFile(out, buf);
+						let pixels = await mipTile(this.render, args.files, args.layer.mipmode == "avg");
+						await this.render.saveFile(out, await encodeMip(pixels, imgformat as any, 0.9));
+						if (this.reservePixels(pixels)) { task.pixels = pixels; }
 					}
-				})
+				};
+				tasks.push(task);
 				this.incompletes.delete(out);
 				if (tasks.length >= maxgroup) {
 					await processTasks();
@@ -173,54 +234,102 @@ export class MipScheduler {
 	}
 }
 
-function avgFilterMipImage(img: ImageData) {
-	if (img.width % 2 != 0 || img.height % 2 != 0) { throw new Error("can only use avg mip filter on textures with multiple of 2 size"); }
-	let mipped = makeImageData(null, img.width / 2, img.height / 2);
-	const stridex = 4;
-	const stridey = img.width * 4;
-	for (let y = 0; y < mipped.height; y++) {
-		for (let x = 0; x < mipped.width; x++) {
-			let i = (x * 2) * stridex + (y * 2) * stridey;
-			//2 bias to round using floor later
-			let r = 2 + img.data[i + 0] + img.data[i + stridex + 0] + img.data[i + stridey + 0] + img.data[i + stridex + stridey + 0];
-			let g = 2 + img.data[i + 1] + img.data[i + stridex + 1] + img.data[i + stridey + 1] + img.data[i + stridex + stridey + 1];
-			let b = 2 + img.data[i + 2] + img.data[i + stridex + 2] + img.data[i + stridey + 2] + img.data[i + stridex + stridey + 2];
-			let a = 2 + img.data[i + 3] + img.data[i + stridex + 3] + img.data[i + stridey + 3] + img.data[i + stridex + stridey + 3];
-			let iout = x * 4 + y * mipped.width * 4;
-			mipped.data[iout + 0] = r / 4;
-			mipped.data[iout + 1] = g / 4;
-			mipped.data[iout + 2] = b / 4;
-			mipped.data[iout + 3] = a / 4;
+let encodePool: WorkerPool<MipEncodePacket> | null | undefined = undefined;
+function getEncodePool() {
+	if (encodePool === undefined) {
+		encodePool = null;
+		try {
+			// node encodes using sharp, which already runs off the main thread
+			if (typeof OffscreenCanvas != "undefined" && typeof Worker != "undefined") {
+				encodePool = new WorkerPool(() => new Worker(new URL("./mipworker.ts", import.meta.url)));
+			}
+		} catch (e) {
+			console.log("can't start mip encoding workers, encoding on main thread", e);
+		}
+	}
+	return encodePool;
+}
+
+async function encodeMip(pixels: ImageData, format: "png" | "webp", quality: number) {
+	let pool = getEncodePool();
+	if (!pool) {
+		return pixelsToImageFile(pixels, format, quality);
+	}
+	// pixels are copied, they stay in the pyramid for the next zoom level
+	let res = await pool.call<Uint8Array>({ pixels: pixels.data, width: pixels.width, height: pixels.height, format, quality });
+	return Buffer.from(res.buffer, res.byteOffset, res.byteLength);
+}
+
+/**
+ * 2x2 box filter of src into dst at position dstx,dsty. Works on whole rgba pixels by keeping two
+ * channels in each half of a 32bit int, the 8 bits of headroom per channel fit the sum of 4 pixels.
+ * Output is byte identical to storing (sum+2)/4 in a Uint8ClampedArray, which rounds half to even
+ */
+export function downsampleInto(src: ImageData, dst: ImageData, dstx: number, dsty: number) {
+	if (src.width % 2 != 0 || src.height % 2 != 0) { throw new Error("can only use avg mip filter on textures with multiple of 2 size"); }
+	let srcdata = src.data;
+	// decoders can hand out views into a shared buffer at any offset
+	if (srcdata.byteOffset % 4 != 0) { srcdata = srcdata.slice(); }
+	let srcwords = new Uint32Array(srcdata.buffer, srcdata.byteOffset, srcdata.byteLength / 4);
+	let dstwords = new Uint32Array(dst.data.buffer, dst.data.byteOffset, dst.data.byteLength / 4);
+	let width = Math.min(src.width / 2, dst.width - dstx);
+	let height = Math.min(src.height / 2, dst.height - dsty);
+	for (let y = 0; y < height; y++) {
+		let i = y * 2 * src.width;
+		let j = i + src.width;
+		let o = (dsty + y) * dst.width + dstx;
+		for (let x = 0; x < width; x++) {
+			let a = srcwords[i], b = srcwords[i + 1], c = srcwords[j], d = srcwords[j + 1];
+			let lo = (a & 0x00ff00ff) + (b & 0x00ff00ff) + (c & 0x00ff00ff) + (d & 0x00ff00ff);
+			let hi = ((a >>> 8) & 0x00ff00ff) + ((b >>> 8) & 0x00ff00ff) + ((c >>> 8) & 0x00ff00ff) + ((d >>> 8) & 0x00ff00ff);
+			dstwords[o++] = roundQuarterSums(lo) | (roundQuarterSums(hi) << 8);
+			i += 2;
+			j += 2;
 		}
 	}
-	return mipped;
 }
 
-async function mipCanvas(render: MapRender, files: (MipFile | null)[], format: "png" | "webp", quality: number, avgfilter: boolean) {
-	let cnv = document.createElement("canvas");
-	cnv.width = render.config.tileimgsize;
-	cnv.height = render.config.tileimgsize;
-	let ctx = cnv.getContext("2d", { willReadFrequently: true })!;
-	const subtilesize = render.config.tileimgsize / 2;
+//rounds the two channel sums in the low 10 bits of each 16 bit half to (sum+2)/4 with ties to even. That is
+//sum/4+1, minus one when the sum is a multiple of 4 and sum/4 is even, clamped to 255
+function roundQuarterSums(sums: number) {
+	let quarter = (sums >>> 2) & 0x00ff00ff;
+	let tie = ~(sums | (sums >>> 1)) & 0x00010001;
+	let even = ~(sums >>> 2) & 0x00010001;
+	let res = quarter + 0x00010001 - (tie & even);
+	return res - ((res >>> 8) & 0x00010001);
+}
+
+async function mipTile(render: MapRender, files: (MipFile | null)[], avgfilter: boolean) {
+	const tilesize = render.config.tileimgsize;
+	const subtilesize = tilesize / 2;
+	// grab the in memory tiles right away since they can be evicted while we wait for disk reads
+	let sources: (ImageData | null)[] = files.map(f => f?.pixels ?? null);
+	let cnv: HTMLCanvasElement | null = null;
+	let ctx: CanvasRenderingContext2D | null = null;
 	await Promise.all(files.map(async (f, i) => {
 		// file is missing (probably outside of map bounds)
 		if (!f) { return null; }
 		// file is known to be empty
 		if (!f.filevariant) { return null; }
+		// tile is still in memory, box filtered below
+		let inmemory = sources[i];
+		if (inmemory && avgfilter) { return null; }
 
-		let filename = render.makeFileName(f.filevariant.savedLayerName, f.sourceinfo.zoom, f.sourceinfo.x, f.sourceinfo.y, f.sourceinfo.ext);
-		let res = await render.getFileResponse(filename, f.filevariant.savedLayerVersion);
-		let mimetype = res.headers.get("content-type");
-
-		let outx = (i % 2) * subtilesize;
-		let outy = Math.floor(i / 2) * subtilesize;
-		if (avgfilter) {
-			let file = await res.arrayBuffer();
-			let data = await fileToImageData(new Uint8Array(file), mimetype as any, false);
-			let scaled = avgFilterMipImage(data);
-			ctx.putImageData(scaled, outx, outy);
+		let img: HTMLImageElement | VideoFrame | ImageBitmap;
+		if (inmemory) {
+			// draw in memory tiles through the canvas as well, so all quadrants get the same filter
+			sources[i] = null;
+			img = await createImageBitmap(inmemory);
 		} else {
-			let img: HTMLImageElement | VideoFrame;
+			let filename = render.makeFileName(f.filevariant.savedLayerName, f.sourceinfo.zoom, f.sourceinfo.x, f.sourceinfo.y, f.sourceinfo.ext);
+			let res = await render.getFileResponse(filename, f.filevariant.savedLayerVersion);
+			let mimetype = res.headers.get("content-type");
+
+			if (avgfilter) {
+				let file = await res.arrayBuffer();
+				sources[i] = await fileToImageData(new Uint8Array(file), mimetype as any, false);
+				return null;
+			}
 			if (!res.ok) {
 				throw new Error(`image not found ${filename} version ${f.filevariant?.savedLayerVersion}`);
 			}
@@ -231,16 +340,29 @@ async function mipCanvas(render: MapRender, files: (MipFile | null)[], format: "
 				img = (await decoder.decode()).image;
 			} else {
 				let blobsrc = URL.createObjectURL(await res.blob());
-				img = new Image(subtilesize, subtilesize);
-				img.src = blobsrc;
+				let htmlimg = new Image(subtilesize, subtilesize);
+				htmlimg.src = blobsrc;
 				try {
-					await img.decode();
+					await htmlimg.decode();
 				} finally {
 					URL.revokeObjectURL(blobsrc);
 				}
+				img = htmlimg;
 			}
-			ctx.drawImage(img, outx, outy, subtilesize, subtilesize);
 		}
+		if (!cnv) {
+			cnv = document.createElement("canvas");
+			cnv.width = tilesize;
+			cnv.height = tilesize;
+			ctx = cnv.getContext("2d", { willReadFrequently: true })!;
+		}
+		ctx!.drawImage(img, (i % 2) * subtilesize, Math.floor(i / 2) * subtilesize, subtilesize, subtilesize);
+		if (img instanceof ImageBitmap) { img.close(); }
 	}));
-	return canvasToImageFile(cnv, format, quality);
-}
\ No newline at end of file
+	// only set for the avg filter, quadrants don't overlap so the box filtered tiles can be written straight over the canvas result
+	let pixels = (ctx ? (ctx as CanvasRenderingContext2D).getImageData(0, 0, tilesize, tilesize) : makeImageData(null, tilesize, tilesize));
+	sources.forEach((src, i) => {
+		if (src) { downsampleInto(src, pixels, (i % 2) * subtilesize, Math.floor(i / 2) * subtilesize); }
+	});
+	return pixels;
+}
@@ -0,0 +1,17 @@
+import { serveWorkerPool } from "../libs/workerpool";
+
+export type MipEncodePacket = {
+	pixels: Uint8ClampedArray<ArrayBuffer>,
+	width: number,
+	height: number,
+	format: "png" | "webp",
+	quality: number
+};
+
+serveWorkerPool<MipEncodePacket>(async packet => {
+	let cnv = new OffscreenCanvas(packet.width, packet.height);
+	let ctx = cnv.getContext("2d")!;
+	ctx.putImageData(new ImageData(packet.pixels, packet.width, packet.height), 0, 0);
+	let blob = await cnv.convertToBlob({ type: `image/${packet.format}`, quality: packet.quality });
+	return new Uint8Array(await blob.arrayBuffer());
+});
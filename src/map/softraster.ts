@@ -0,0 +1,236 @@
+//CPU rasterizer for orthographic map renders, has no dependencies so it can run in a worker
+
+//layout of one triangle in the float buffers that are passed to the rasterizer
+export const softTri = {
+	pos: 0,//x,y,z for 3 vertices, x,y in pixels and z in ndc
+	col: 9,//linear rgba for 3 vertices, lighting is already applied
+	uv: 21,//3 uv sets for 3 vertices, vertex major
+	weight: 39,//3 texture weights for 3 vertices
+	texture: 48,//texture id or -1
+	rect: 49,//x,y,width,height,wrapping of the texture region in pixels
+	alphatest: 54,//discard if alpha <= this
+	flags: 55,
+	stride: 56
+}
+
+export const softTriFlags = {
+	//emulates vVertexAlbedo.q==0 discard of the loc shader
+	discardZeroVertexAlpha: 1,
+	//floors blend 3 textures with the vertex color using the weights
+	multiTexture: 2
+}
+
+//same bits as the wrapping meta in the rs shaders, mirrored if neither is set
+export const softWrapFlags = {
+	clampU: 1,
+	clampV: 2,
+	repeatU: 4,
+	repeatV: 8
+}
+
+export type SoftTextureLevel = { width: number, height: number, data: Uint16Array };
+export type SoftTexture = { width: number, height: number, levels: SoftTextureLevel[] };
+
+let srgbToLinearLut: Uint16Array | null = null;
+
+/**
+ * Converts srgb pixels to 16 bit linear and generates box filtered mip levels
+ */
+export function createSoftTexture(width: number, height: number, data: Uint8Array | Uint8ClampedArray): SoftTexture {
+	if (!srgbToLinearLut) {
+		srgbToLinearLut = new Uint16Array(256);
+		for (let i = 0; i < 256; i++) {
+			let c = i / 255;
+			let lin = (c <= 0.04045 ? c / 12.92 : Math.pow((c + 0.055) / 1.055, 2.4));
+			srgbToLinearLut[i] = Math.round(lin * 65535);
+		}
+	}
+	let base = new Uint16Array(width * height * 4);
+	for (let i = 0; i < base.length; i += 4) {
+		base[i + 0] = srgbToLinearLut[data[i + 0]];
+		base[i + 1] = srgbToLinearLut[data[i + 1]];
+		base[i + 2] = srgbToLinearLut[data[i + 2]];
+		//alpha is stored linear
+		base[i + 3] = data[i + 3] * 257;
+	}
+	let levels: SoftTextureLevel[] = [{ width, height, data: base }];
+	let prev = levels[0];
+	while (prev.width > 1 || prev.height > 1) {
+		let w = Math.max(1, prev.width >> 1);
+		let h = Math.max(1, prev.height >> 1);
+		let level = new Uint16Array(w * h * 4);
+		for (let y = 0; y < h; y++) {
+			let y0 = Math.min(y * 2, prev.height - 1);
+			let y1 = Math.min(y * 2 + 1, prev.height - 1);
+			for (let x = 0; x < w; x++) {
+				let x0 = Math.min(x * 2, prev.width - 1);
+				let x1 = Math.min(x * 2 + 1, prev.width - 1);
+				let a = (y0 * prev.width + x0) * 4, b = (y0 * prev.width + x1) * 4;
+				let c = (y1 * prev.width + x0) * 4, d = (y1 * prev.width + x1) * 4;
+				let o = (y * w + x) * 4;
+				for (let ch = 0; ch < 4; ch++) {
+					level[o + ch] = (prev.data[a + ch] + prev.data[b + ch] + prev.data[c + ch] + prev.data[d + ch] + 2) >> 2;
+				}
+			}
+		}
+		prev = { width: w, height: h, data: level };
+		levels.push(prev);
+	}
+	return { width, height, levels };
+}
+
+function wrapIndex(i: number, size: number, clamp: boolean, repeat: boolean) {
+	if (clamp) { return (i < 0 ? 0 : i >= size ? size - 1 : i); }
+	if (repeat) { return ((i % size) + size) % size; }
+	let m = ((i % (2 * size)) + 2 * size) % (2 * size);
+	return (m < size ? m : 2 * size - 1 - m);
+}
+
+//bilinear sample inside a texture region, result in linear 0-1 space
+function sampleTexture(tex: SoftTexture, level: number, tris: Float32Array, o: number, u: number, v: number, out: Float32Array) {
+	let lvl = tex.levels[Math.min(level, tex.levels.length - 1)];
+	let scale = lvl.width / tex.width;
+	let rx = Math.floor(tris[o + softTri.rect + 0] * scale);
+	let ry = Math.floor(tris[o + softTri.rect + 1] * scale);
+	let rw = Math.max(1, Math.floor(tris[o + softTri.rect + 2] * scale));
+	let rh = Math.max(1, Math.floor(tris[o + softTri.rect + 3] * scale));
+	let wrap = tris[o + softTri.rect + 4];
+	let clampu = (wrap & softWrapFlags.clampU) != 0, clampv = (wrap & softWrapFlags.clampV) != 0;
+	let repeatu = (wrap & softWrapFlags.repeatU) != 0, repeatv = (wrap & softWrapFlags.repeatV) != 0;
+
+	let fx = u * rw - 0.5;
+	let fy = v * rh - 0.5;
+	let ix = Math.floor(fx);
+	let iy = Math.floor(fy);
+	let ax = fx - ix;
+	let ay = fy - iy;
+	let x0 = rx + wrapIndex(ix, rw, clampu, repeatu);
+	let x1 = rx + wrapIndex(ix + 1, rw, clampu, repeatu);
+	let y0 = ry + wrapIndex(iy, rh, clampv, repeatv);
+	let y1 = ry + wrapIndex(iy + 1, rh, clampv, repeatv);
+	let data = lvl.data;
+	let i00 = (y0 * lvl.width + x0) * 4, i10 = (y0 * lvl.width + x1) * 4;
+	let i01 = (y1 * lvl.width + x0) * 4, i11 = (y1 * lvl.width + x1) * 4;
+	let w00 = (1 - ax) * (1 - ay), w10 = ax * (1 - ay), w01 = (1 - ax) * ay, w11 = ax * ay;
+	for (let ch = 0; ch < 4; ch++) {
+		out[ch] = (data[i00 + ch] * w00 + data[i10 + ch] * w10 + data[i01 + ch] * w01 + data[i11 + ch] * w11) / 65535;
+	}
+}
+
+/**
+ * Rasterizes all triangles that overlap rows y0 to y1 of the image. Uses a depth buffer with a
+ * less-than test and writes the colors with the LinearToSRGBRunescape (sqrt) output transform
+ * of the minimap shaders.
+ */
+export function rasterizeBand(tris: Float32Array, width: number, y0: number, y1: number, textures: Map<number, SoftTexture>) {
+	let rows = y1 - y0;
+	let color = new Uint8ClampedArray(width * rows * 4);
+	for (let i = 3; i < color.length; i += 4) { color[i] = 255; }
+	let depth = new Float32Array(width * rows).fill(Infinity);
+	let sample = new Float32Array(4);
+	let lods = [0, 0, 0];
+
+	for (let o = 0; o < tris.length; o += softTri.stride) {
+		let xa = tris[o + 0], ya = tris[o + 1], za = tris[o + 2];
+		let xb = tris[o + 3], yb = tris[o + 4], zb = tris[o + 5];
+		let xc = tris[o + 6], yc = tris[o + 7], zc = tris[o + 8];
+		let area = (xb - xa) * (yc - ya) - (xc - xa) * (yb - ya);
+		if (area == 0) { continue; }
+		let invarea = 1 / area;
+
+		let minx = Math.max(0, Math.floor(Math.min(xa, xb, xc)));
+		let maxx = Math.min(width - 1, Math.ceil(Math.max(xa, xb, xc)));
+		let miny = Math.max(y0, Math.floor(Math.min(ya, yb, yc)));
+		let maxy = Math.min(y1 - 1, Math.ceil(Math.max(ya, yb, yc)));
+		if (minx > maxx || miny > maxy) { continue; }
+
+		let flags = tris[o + softTri.flags];
+		let alphatest = tris[o + softTri.alphatest];
+		let multitex = (flags & softTriFlags.multiTexture) != 0;
+		let discardzeroalpha = (flags & softTriFlags.discardZeroVertexAlpha) != 0;
+		let texid = tris[o + softTri.texture];
+		let tex = (texid == -1 ? undefined : textures.get(texid));
+		let uvsets = (multitex ? 3 : 1);
+
+		//uv derivatives are constant over the triangle in an orthographic projection, use them to pick a mip level
+		if (tex) {
+			let texw = tris[o + softTri.rect + 2];
+			let texh = tris[o + softTri.rect + 3];
+			for (let s = 0; s < uvsets; s++) {
+				let ua = tris[o + softTri.uv + s * 2], va = tris[o + softTri.uv + s * 2 + 1];
+				let ub = tris[o + softTri.uv + 6 + s * 2], vb = tris[o + softTri.uv + 6 + s * 2 + 1];
+				let uc = tris[o + softTri.uv + 12 + s * 2], vc = tris[o + softTri.uv + 12 + s * 2 + 1];
+				let dudx = ((ub - ua) * (yc - ya) - (uc - ua) * (yb - ya)) * invarea * texw;
+				let dvdx = ((vb - va) * (yc - ya) - (vc - va) * (yb - ya)) * invarea * texh;
+				let dudy = ((uc - ua) * (xb - xa) - (ub - ua) * (xc - xa)) * invarea * texw;
+				let dvdy = ((vc - va) * (xb - xa) - (vb - va) * (xc - xa)) * invarea * texh;
+				let rho = Math.max(Math.hypot(dudx, dvdx), Math.hypot(dudy, dvdy));
+				lods[s] = (rho <= 1 ? 0 : Math.round(Math.log2(rho)));
+			}
+		}
+
+		for (let py = miny; py <= maxy; py++) {
+			let cy = py + 0.5;
+			let rowoffset = (py - y0) * width;
+			for (let px = minx; px <= maxx; px++) {
+				let cx = px + 0.5;
+				let wa = ((xb - cx) * (yc - cy) - (xc - cx) * (yb - cy)) * invarea;
+				let wb = ((xc - cx) * (ya - cy) - (xa - cx) * (yc - cy)) * invarea;
+				let wc = 1 - wa - wb;
+				if (wa < 0 || wb < 0 || wc < 0) { continue; }
+				let z = wa * za + wb * zb + wc * zc;
+				if (z < -1 || z > 1) { continue; }
+				let index = rowoffset + px;
+				if (z >= depth[index]) { continue; }
+
+				let c = o + softTri.col;
+				let r = wa * tris[c + 0] + wb * tris[c + 4] + wc * tris[c + 8];
+				let g = wa * tris[c + 1] + wb * tris[c + 5] + wc * tris[c + 9];
+				let b = wa * tris[c + 2] + wb * tris[c + 6] + wc * tris[c + 10];
+				let a = wa * tris[c + 3] + wb * tris[c + 7] + wc * tris[c + 11];
+				if (discardzeroalpha && a == 0) { continue; }
+
+				if (tex) {
+					let tr = 0, tg = 0, tb = 0, ta = 0, wsum = 0;
+					for (let s = 0; s < uvsets; s++) {
+						let weight = 1;
+						if (multitex) {
+							let w = o + softTri.weight + s;
+							weight = wa * tris[w] + wb * tris[w + 3] + wc * tris[w + 6];
+							if (weight <= 0) { continue; }
+						}
+						let uv = o + softTri.uv + s * 2;
+						let u = wa * tris[uv] + wb * tris[uv + 6] + wc * tris[uv + 12];
+						let v = wa * tris[uv + 1] + wb * tris[uv + 7] + wc * tris[uv + 13];
+						sampleTexture(tex, lods[s], tris, o, u, v, sample);
+						tr += sample[0] * weight;
+						tg += sample[1] * weight;
+						tb += sample[2] * weight;
+						ta += sample[3] * weight;
+						wsum += weight;
+					}
+					if (multitex) {
+						//untextured part of the weight uses the vertex color
+						let rest = Math.max(0, 1 - wsum);
+						r *= tr + rest;
+						g *= tg + rest;
+						b *= tb + rest;
+					} else {
+						r *= tr;
+						g *= tg;
+						b *= tb;
+						a *= ta;
+					}
+				}
+				if (a <= alphatest) { continue; }
+
+				depth[index] = z;
+				let ci = index * 4;
+				color[ci + 0] = Math.sqrt(r < 0 ? 0 : r > 1 ? 1 : r) * 255 + 0.5;
+				color[ci + 1] = Math.sqrt(g < 0 ? 0 : g > 1 ? 1 : g) * 255 + 0.5;
+				color[ci + 2] = Math.sqrt(b < 0 ? 0 : b > 1 ? 1 : b) * 255 + 0.5;
+			}
+		}
+	}
+	return color;
+}
@@ -0,0 +1,34 @@
+import { serveWorkerPool } from "../libs/workerpool";
+import { SoftTexture, createSoftTexture, rasterizeBand } from "./softraster";
+
+export type SoftRasterPacket = {
+	type: "texture",
+	id: number,
+	width: number,
+	height: number,
+	data: Uint8Array | Uint8ClampedArray
+} | {
+	type: "cleartextures"
+} | {
+	type: "render",
+	tris: Float32Array,
+	width: number,
+	y0: number,
+	y1: number
+};
+
+//textures stay uploaded between renders since the same materials are used by most chunks
+let textures = new Map<number, SoftTexture>();
+
+serveWorkerPool<SoftRasterPacket>(packet => {
+	switch (packet.type) {
+		case "texture":
+			textures.set(packet.id, createSoftTexture(packet.width, packet.height, packet.data));
+			return true;
+		case "cleartextures":
+			textures.clear();
+			return true;
+		case "render":
+			return rasterizeBand(packet.tris, packet.width, packet.y0, packet.y1, textures);
+	}
+});
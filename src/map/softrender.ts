@@ -0,0 +1,378 @@
+import { BackSide, BufferAttribute, Camera, DoubleSide, InstancedMesh, InterleavedBufferAttribute, Material, Matrix3, Matrix4, Mesh, Object3D, ShaderMaterial, Texture, Vector3 } from "three";
+import { WorkerPool } from "../libs/workerpool";
+import { Worker as NodeWorker } from "worker_threads";
+import { makeImageData } from "../imgutils";
+import { MinimapLocAtlas } from "../rs3shaders";
+import { softTri, softTriFlags, softWrapFlags } from "./softraster";
+import type { SoftRasterPacket } from "./softrasterworker";
+
+type AnyAttribute = BufferAttribute | InterleavedBufferAttribute;
+type MaterialKind = "loc" | "floor" | "water" | "plain";
+
+type SoftTextureRef = { id: number, version: number, bytes: number };
+
+//textures are kept in worker memory until the uploaded (16bit + mips) size exceeds this
+const workerTextureBudget = 256 * 1024 * 1024;
+
+function materialKind(mat: Material): MaterialKind {
+	let key = mat.customProgramCacheKey();
+	if (key.startsWith("minimap-loc")) { return "loc"; }
+	if (key.startsWith("minimap-floor")) { return "floor"; }
+	if (key.startsWith("minimap-water")) { return "water"; }
+	return "plain";
+}
+
+//reads the texture pixels in rgba top row first order, null if the texture has no readable source
+function readTexturePixels(tex: Texture) {
+	let img = tex.image as any;
+	if (!img || !img.width || !img.height) { return null; }
+	let width: number = img.width;
+	let height: number = img.height;
+	let data: Uint8Array | Uint8ClampedArray;
+	if (img.data) {
+		if (!(img.data instanceof Uint8Array) && !(img.data instanceof Uint8ClampedArray)) { return null; }
+		if (img.data.length < width * height * 4) { return null; }
+		data = img.data.slice(0, width * height * 4);
+	} else {
+		let cnv: HTMLCanvasElement = img;
+		if (typeof img.getContext != "function") {
+			cnv = document.createElement("canvas");
+			cnv.width = width;
+			cnv.height = height;
+			cnv.getContext("2d")!.drawImage(img, 0, 0);
+		}
+		let ctx = cnv.getContext("2d", { willReadFrequently: true });
+		if (!ctx) { return null; }
+		data = ctx.getImageData(0, 0, width, height).data;
+	}
+	//the gpu upload flips these, uv 0 is the bottom row
+	if (tex.flipY) {
+		let stride = width * 4;
+		let flipped = new Uint8Array(data.length);
+		for (let y = 0; y < height; y++) {
+			flipped.set(data.subarray(y * stride, (y + 1) * stride), (height - 1 - y) * stride);
+		}
+		data = flipped;
+	}
+	return { width, height, data };
+}
+
+/**
+ * Renders map chunks on the cpu using a pool of web workers or node worker threads. Meant for headless
+ * map renders where no (or a slow software) gl context is available. The minimap shaders are approximated
+ * using gouraud shaded vertex lighting, the output uses the same linear color convention as
+ * ThreeJsRenderer.takeMapPicture with linearcolor enabled.
+ */
+export class SoftwareMapRenderer {
+	private pool: WorkerPool<SoftRasterPacket>;
+	private texturerefs = new WeakMap<Texture, SoftTextureRef>();
+	private workertextures: { ids: Set<number>, bytes: number }[] = [];
+	private textureidcounter = 1;
+
+	private tris = new Float32Array(softTri.stride * 1024);
+	private tricount = 0;
+
+	constructor(threads?: number) {
+		//headless node renders use worker_threads, the worker serves both kinds of parent
+		if (typeof process != "undefined" && process.versions?.node) {
+			this.pool = new WorkerPool(() => new NodeWorker(new URL("./softrasterworker.ts", import.meta.url)), threads);
+		} else {
+			this.pool = new WorkerPool(() => new Worker(new URL("./softrasterworker.ts", import.meta.url)), threads);
+		}
+		for (let i = 0; i < this.pool.size; i++) {
+			this.workertextures.push({ ids: new Set(), bytes: 0 });
+		}
+	}
+
+	async takeMapPicture(cam: Camera, width: number, height: number, roots: Object3D[]) {
+		this.tricount = 0;
+		let textures = new Map<number, Texture>();
+		let viewproj = new Matrix4().multiplyMatrices(cam.projectionMatrix, cam.matrixWorldInverse);
+		for (let root of roots) {
+			root.updateWorldMatrix(true, true);
+			root.traverseVisible(node => {
+				if (!(node instanceof Mesh) || !node.layers.test(cam.layers)) { return; }
+				this.addMesh(node, viewproj, width, height, textures);
+			});
+		}
+
+		//bin the triangles into horizontal bands, each band is rendered by one worker
+		let nbands = Math.max(1, Math.min(this.pool.size * 2, Math.ceil(height / 16)));
+		let bandheight = Math.ceil(height / nbands);
+		nbands = Math.ceil(height / bandheight);
+		let bandcounts = new Uint32Array(nbands);
+		let triranges = new Int32Array(this.tricount * 2);
+		for (let i = 0; i < this.tricount; i++) {
+			let o = i * softTri.stride;
+			let miny = Math.min(this.tris[o + 1], this.tris[o + 4], this.tris[o + 7]);
+			let maxy = Math.max(this.tris[o + 1], this.tris[o + 4], this.tris[o + 7]);
+			let first = Math.max(0, Math.floor(miny / bandheight));
+			let last = Math.min(nbands - 1, Math.floor(Math.ceil(maxy) / bandheight));
+			triranges[i * 2 + 0] = first;
+			triranges[i * 2 + 1] = last;
+			for (let band = first; band <= last; band++) { bandcounts[band]++; }
+		}
+		let bands = [...bandcounts].map((count, i) => ({
+			y0: i * bandheight,
+			y1: Math.min(height, (i + 1) * bandheight),
+			tris: new Float32Array(count * softTri.stride),
+			fill: 0,
+			textures: new Set<number>(),
+			worker: i % this.pool.size
+		}));
+		for (let i = 0; i < this.tricount; i++) {
+			let o = i * softTri.stride;
+			let texid = this.tris[o + softTri.texture];
+			for (let band = triranges[i * 2 + 0]; band <= triranges[i * 2 + 1]; band++) {
+				let target = bands[band];
+				target.tris.set(this.tris.subarray(o, o + softTri.stride), target.fill);
+				target.fill += softTri.stride;
+				if (texid != -1) { target.textures.add(texid); }
+			}
+		}
+
+		let renders: Promise<Uint8ClampedArray>[] = [];
+		for (let band of bands) {
+			this.uploadTextures(band.worker, band.textures, textures);
+			let packet: SoftRasterPacket = { type: "render", tris: band.tris, width, y0: band.y0, y1: band.y1 };
+			renders.push(this.pool.call<Uint8ClampedArray>(packet, [band.tris.buffer], band.worker));
+		}
+		let img = makeImageData(null, width, height);
+		let results = await Promise.all(renders);
+		for (let i = 0; i < bands.length; i++) {
+			img.data.set(results[i], bands[i].y0 * width * 4);
+		}
+		return img;
+	}
+
+	private uploadTextures(worker: number, ids: Set<number>, textures: Map<number, Texture>) {
+		let uploaded = this.workertextures[worker];
+		let missing = [...ids].filter(q => !uploaded.ids.has(q));
+		if (missing.length == 0) { return; }
+		let newbytes = missing.reduce((a, id) => a + this.texturerefs.get(textures.get(id)!)!.bytes, 0);
+		if (uploaded.bytes + newbytes > workerTextureBudget) {
+			this.pool.call({ type: "cleartextures" }, [], worker);
+			uploaded.ids.clear();
+			uploaded.bytes = 0;
+			missing = [...ids];
+		}
+		for (let id of missing) {
+			let tex = textures.get(id)!;
+			let pixels = readTexturePixels(tex);
+			//the worker renders triangles with unknown textures untextured
+			if (!pixels) { continue; }
+			//messages to one worker arrive in order so there is no need to wait for the upload
+			this.pool.call({ type: "texture", id, ...pixels }, [pixels.data.buffer], worker);
+			uploaded.ids.add(id);
+			uploaded.bytes += this.texturerefs.get(tex)!.bytes;
+		}
+	}
+
+	private getTextureId(tex: Texture | null | undefined, textures: Map<number, Texture>) {
+		if (!tex) { return -1; }
+		let ref = this.texturerefs.get(tex);
+		if (!ref || ref.version != tex.version) {
+			let img = tex.image as any;
+			let readable = img && img.width && img.height && (img.data ? img.data instanceof Uint8Array || img.data instanceof Uint8ClampedArray : true);
+			if (!readable) { return -1; }
+			//16 bit linear channels plus 1/3 for the mip chain
+			ref = { id: this.textureidcounter++, version: tex.version, bytes: Math.ceil(img.width * img.height * 8 * 4 / 3) };
+			this.texturerefs.set(tex, ref);
+		}
+		textures.set(ref.id, tex);
+		return ref.id;
+	}
+
+	private allocTriangle() {
+		if ((this.tricount + 1) * softTri.stride > this.tris.length) {
+			let newtris = new Float32Array(this.tris.length * 2);
+			newtris.set(this.tris);
+			this.tris = newtris;
+		}
+		return (this.tricount++) * softTri.stride;
+	}
+
+	private addMesh(mesh: Mesh, viewproj: Matrix4, width: number, height: number, textures: Map<number, Texture>) {
+		if (Array.isArray(mesh.material)) { return; }
+		let mat = mesh.material;
+		if (!mat.visible) { return; }
+		//batched loc meshes compact their hidden sections right before rendering
+		(mesh as { updateSections?(): void }).updateSections?.();
+		let geo = mesh.geometry;
+		let pos = geo.getAttribute("position") as AnyAttribute | undefined;
+		if (!pos) { return; }
+		let kind = materialKind(mat);
+		let uniforms = (mat as ShaderMaterial).uniforms;
+		let color = geo.getAttribute("color") as AnyAttribute | undefined;
+		let normal = geo.getAttribute("normal") as AnyAttribute | undefined;
+
+		//per material settings
+		let texture: Texture | null = (kind == "plain" ? (mat as any).map : uniforms.uTextureAtlas?.value) ?? null;
+		let texid = this.getTextureId(texture, textures);
+		let flags = 0;
+		let alphatest = -1;
+		let wrapping = 0;
+		let uvnames = ["uv"];
+		if (kind == "loc") {
+			flags |= softTriFlags.discardZeroVertexAlpha;
+			alphatest = uniforms.uAlphaTestThreshold?.value[0] ?? -1;
+		} else if (kind == "floor" || kind == "water") {
+			flags |= softTriFlags.multiTexture;
+			//floor uvs point directly into the chunk atlas
+			wrapping = softWrapFlags.clampU | softWrapFlags.clampV;
+			uvnames = ["texcoord_0", "texcoord_1", "texcoord_2"];
+		} else if (mat.alphaTest > 0) {
+			alphatest = mat.alphaTest;
+		}
+		let uvs = uvnames.map(q => geo.getAttribute(q) as AnyAttribute | undefined);
+		let weights = geo.getAttribute("color_1") as AnyAttribute | undefined;
+
+		//atlas mode locs store their texture region in the settings texture, indexed per vertex
+		let slots = geo.getAttribute("materialslot") as AnyAttribute | undefined;
+		let settings: Uint8Array | null = (slots && uniforms?.uTextureAtlasSettings?.value?.image?.data) || null;
+
+		//precompute lighting and screen positions per vertex
+		let lit = (kind == "loc" || kind == "floor");
+		let ambient = (lit ? uniforms.uAmbientColour.value as number[] : [1, 1, 1]);
+		let suncolor = (lit ? uniforms.uSunColour.value as number[] : [0, 0, 0]);
+		let sundir = (lit ? new Vector3().fromArray(uniforms.uInvSunDirection.value).normalize() : new Vector3());
+		let basecolor = (kind == "plain" && (mat as any).color ? (mat as any).color : null);
+		let mvp = new Matrix4();
+		let normalmatrix = new Matrix3();
+		let nverts = pos.count;
+		let screen = new Float32Array(nverts * 3);
+		let colors = new Float32Array(nverts * 4);
+		let v = new Vector3();
+
+		let index = geo.index;
+		let totalcount = (index ? index.count : pos.count);
+		let start = Math.max(0, geo.drawRange.start);
+		let end = Math.min(totalcount, start + geo.drawRange.count);
+		let matcullfront = mat.side == BackSide;
+		let matcullback = mat.side != BackSide && mat.side != DoubleSide;
+		let texw = (texture?.image?.width ?? 1);
+		let texh = (texture?.image?.height ?? 1);
+
+		//instanced locs are expanded into a copy of the geometry per visible instance
+		let instancecount = (mesh instanceof InstancedMesh ? mesh.count : 1);
+		let instancematrix = new Matrix4();
+		let worldmatrix = new Matrix4();
+		for (let instance = 0; instance < instancecount; instance++) {
+			if (mesh instanceof InstancedMesh) {
+				mesh.getMatrixAt(instance, instancematrix);
+				//hidden instances have a zero matrix
+				if (instancematrix.determinant() == 0) { continue; }
+				worldmatrix.multiplyMatrices(mesh.matrixWorld, instancematrix);
+			} else {
+				worldmatrix.copy(mesh.matrixWorld);
+			}
+			mvp.multiplyMatrices(viewproj, worldmatrix);
+			normalmatrix.getNormalMatrix(worldmatrix);
+			for (let i = 0; i < nverts; i++) {
+				v.fromBufferAttribute(pos, i).applyMatrix4(mvp);
+				screen[i * 3 + 0] = (v.x + 1) / 2 * width;
+				screen[i * 3 + 1] = (1 - v.y) / 2 * height;
+				screen[i * 3 + 2] = v.z;
+
+				let r = 1, g = 1, b = 1, a = 1;
+				if (color && (mat.vertexColors || kind != "plain")) {
+					//the rs shaders square the srgb input colors
+					r = color.getX(i) ** 2;
+					g = color.getY(i) ** 2;
+					b = color.getZ(i) ** 2;
+					a = (color.itemSize >= 4 ? color.getW(i) : 1);
+				}
+				if (basecolor) {
+					r *= basecolor.r;
+					g *= basecolor.g;
+					b *= basecolor.b;
+				}
+				let ndotl = 0;
+				if (lit && normal) {
+					v.fromBufferAttribute(normal, i).applyMatrix3(normalmatrix).normalize();
+					ndotl = Math.max(0, v.dot(sundir));
+				}
+				colors[i * 4 + 0] = r * (ambient[0] + suncolor[0] * ndotl);
+				colors[i * 4 + 1] = g * (ambient[1] + suncolor[1] * ndotl);
+				colors[i * 4 + 2] = b * (ambient[2] + suncolor[2] * ndotl);
+				colors[i * 4 + 3] = a;
+			}
+
+			let cullfront = matcullfront;
+			let cullback = matcullback;
+			if (worldmatrix.determinant() < 0) {
+				[cullfront, cullback] = [cullback, cullfront];
+			}
+			let verts = [0, 0, 0];
+			for (let i = start; i + 2 < end; i += 3) {
+				for (let j = 0; j < 3; j++) {
+					verts[j] = (index ? index.getX(i + j) : i + j);
+				}
+				let [ia, ib, ic] = verts;
+				let xa = screen[ia * 3], ya = screen[ia * 3 + 1];
+				let xb = screen[ib * 3], yb = screen[ib * 3 + 1];
+				let xc = screen[ic * 3], yc = screen[ic * 3 + 1];
+				//y is flipped compared to ndc, so counter clockwise (front) faces have negative area here
+				let area = (xb - xa) * (yc - ya) - (xc - xa) * (yb - ya);
+				if (area == 0) { continue; }
+				if (area < 0 ? cullfront : cullback) { continue; }
+				if (Math.max(xa, xb, xc) < 0 || Math.min(xa, xb, xc) > width) { continue; }
+				if (Math.max(ya, yb, yc) < 0 || Math.min(ya, yb, yc) > height) { continue; }
+
+				let o = this.allocTriangle();
+				let tris = this.tris;
+				for (let j = 0; j < 3; j++) {
+					let vert = verts[j];
+					tris[o + softTri.pos + j * 3 + 0] = screen[vert * 3 + 0];
+					tris[o + softTri.pos + j * 3 + 1] = screen[vert * 3 + 1];
+					tris[o + softTri.pos + j * 3 + 2] = screen[vert * 3 + 2];
+					tris[o + softTri.col + j * 4 + 0] = colors[vert * 4 + 0];
+					tris[o + softTri.col + j * 4 + 1] = colors[vert * 4 + 1];
+					tris[o + softTri.col + j * 4 + 2] = colors[vert * 4 + 2];
+					tris[o + softTri.col + j * 4 + 3] = colors[vert * 4 + 3];
+					for (let s = 0; s < 3; s++) {
+						let uv = uvs[s];
+						tris[o + softTri.uv + j * 6 + s * 2 + 0] = (uv ? uv.getX(vert) : 0);
+						tris[o + softTri.uv + j * 6 + s * 2 + 1] = (uv ? uv.getY(vert) : 0);
+					}
+					tris[o + softTri.weight + j * 3 + 0] = (weights ? weights.getX(vert) : 0);
+					tris[o + softTri.weight + j * 3 + 1] = (weights ? weights.getY(vert) : 0);
+					tris[o + softTri.weight + j * 3 + 2] = (weights ? weights.getZ(vert) : 0);
+				}
+				tris[o + softTri.texture] = texid;
+				if (settings && slots) {
+					this.writeAtlasRect(settings, slots.getX(ia), slots.getY(ia), o);
+				} else {
+					tris[o + softTri.rect + 0] = 0;
+					tris[o + softTri.rect + 1] = 0;
+					tris[o + softTri.rect + 2] = texw;
+					tris[o + softTri.rect + 3] = texh;
+					tris[o + softTri.rect + 4] = wrapping;
+				}
+				tris[o + softTri.alphatest] = alphatest;
+				tris[o + softTri.flags] = flags;
+			}
+		}
+	}
+
+	//decodes the texture region of a material from the atlas settings texture
+	private writeAtlasRect(settings: Uint8Array, slotx: number, sloty: number, o: number) {
+		const res = MinimapLocAtlas.settingsResolution;
+		let basex = slotx * MinimapLocAtlas.settingsPixelsX;
+		let basey = sloty * MinimapLocAtlas.settingsPixelsY;
+		let pixel = (dx: number, dy: number) => ((basey + dy) * res + basex + dx) * 4;
+		let meta = pixel(0, 0);
+		let size = pixel(2, 0);
+		let highbits = settings[pixel(1, 2) + 3];
+		let slotsize = MinimapLocAtlas.slotsize;
+		this.tris[o + softTri.rect + 0] = (settings[meta + 0] | ((highbits & 1) << 8)) * slotsize;
+		this.tris[o + softTri.rect + 1] = (settings[meta + 1] | ((highbits & 2) << 7)) * slotsize;
+		this.tris[o + softTri.rect + 2] = settings[size + 0] * slotsize;
+		this.tris[o + softTri.rect + 3] = settings[size + 1] * slotsize;
+		this.tris[o + softTri.rect + 4] = settings[size + 3];
+	}
+
+	close() {
+		this.pool.close();
+	}
+}
@@ -4,6 +4,8 @@ import commentJson from "comment-json";
 import type { CacheFileSource, CacheIndex, SubFile } from "../cache";
 import { cacheConfigPages, cacheMajors, cacheMapFiles, internalNameFiles } from "../constants";
 import { anyFileIndex, blacklistIndex, CacheFileId, chunkedIndex, DecodeLookup, indexfileIndex, LogicalIndex, noArchiveIndex, oldWorldmapIndex, rootindexfileIndex, singleMinorIndex, standardIndex, worldmapIndex } from "./filelookup";
+import { LinkedParser, linkCompiledParser } from "./parsercompiler";
+import { compiledParsers } from "../../generated/parsers";
 
 const typedef = commentJson.parse(require("../opcodes/typedef.jsonc")) as any;
 
@@ -11,6 +13,7 @@ const typedef = commentJson.parse(require("../opcodes/typedef.jsonc")) as any;
 //then copy what we need out of it
 //the buffer is reused so it saves a ton of buffer allocs
 const scratchbuf = Buffer.alloc(2 * 1024 * 1024);
+const scratchview = opcode_reader.bufferView(scratchbuf);
 
 let bytesleftoverwarncount = 0;
 
@@ -18,6 +21,8 @@ export class FileParser<T> {
 	parser: opcode_reader.ChunkParser;
 	originalSource: string;
 	totaltime = 0;
+	//generated code from `npm run filetypes`, null if the definition changed since then
+	private compiled: LinkedParser | null | undefined = undefined;
 
 	static fromJson<T>(jsonObject: string) {
 		let opcodeobj = commentJson.parse(jsonObject, undefined, true) as any
@@ -29,9 +34,18 @@ export class FileParser<T> {
 		this.originalSource = originalSource ?? JSON.stringify(opcodeobj, undefined, "\t");
 	}
 
+	getCompiled() {
+		if (this.compiled === undefined) {
+			this.compiled = linkCompiledParser(this.parser, compiledParsers);
+		}
+		return this.compiled;
+	}
+
 	readInternal(state: opcode_reader.DecodeState) {
 		let t = performance.now();
-		let res = this.parser.read(state);
+		//the interpreted parser is needed to collect debug data
+		let compiled = (opcode_reader.isDebugging() ? null : this.getCompiled());
+		let res = (compiled ? compiled.read(state) : this.parser.read(state));
 		this.totaltime += performance.now() - t;
 		if (state.scan != state.endoffset) {
 			bytesleftoverwarncount++;
@@ -51,10 +65,11 @@ export class FileParser<T> {
 		return res;
 	}
 
-	read(buffer: Buffer, source: CacheFileSource, args?: Record<string, any>) {
-		let state: opcode_reader.DecodeState = {
+	decodeState(buffer: Buffer, source: CacheFileSource, args?: Record<string, any>): opcode_reader.DecodeState {
+		return {
 			isWrite: false,
 			buffer,
+			view: opcode_reader.bufferView(buffer),
 			stack: [],
 			hiddenstack: [],
 			scan: 0,
@@ -64,15 +79,46 @@ export class FileParser<T> {
 				...args
 			}
 		};
-		return this.readInternal(state) as T;
+	}
+
+	read(buffer: Buffer, source: CacheFileSource, args?: Record<string, any>) {
+		return this.readInternal(this.decodeState(buffer, source, args)) as T;
+	}
+
+	/**
+	 * Decodes and encodes the file with the generated parser and checks that it matches the interpreted
+	 * parser, returns a description of the first difference or null if both are the same
+	 */
+	compareCompiled(buffer: Buffer, source: CacheFileSource, interpreted: unknown, args?: Record<string, any>) {
+		let compiled = this.getCompiled();
+		if (!compiled) { return null; }
+		let res = compiled.read(this.decodeState(buffer, source, args));
+		if (JSON.stringify(res) != JSON.stringify(interpreted)) {
+			return "compiled parser decoded a different value";
+		}
+		let expected: Buffer | null = null;
+		try {
+			expected = this.writeWith(this.parser, interpreted, args);
+		} catch {
+			//not all file types can be written
+		}
+		if (expected && !expected.equals(this.writeWith(compiled, res, args))) {
+			return "compiled parser encoded different bytes";
+		}
+		return null;
 	}
 
 	write(obj: T, args?: Record<string, any>) {
+		return this.writeWith(this.getCompiled() ?? this.parser, obj, args);
+	}
+
+	private writeWith(parser: Pick<opcode_reader.ChunkParser, "write">, obj: unknown, args?: Record<string, any>) {
 		let state: opcode_reader.EncodeState = {
 			isWrite: true,
 			stack: [],
 			hiddenstack: [],
 			buffer: scratchbuf,
+			view: scratchview,
 			scan: 0,
 			endoffset: scratchbuf.byteLength,
 			args: {
@@ -80,7 +126,7 @@ export class FileParser<T> {
 				...args
 			}
 		};
-		this.parser.write(state, obj);
+		parser.write(state, obj);
 		if (state.scan > state.endoffset) { throw new Error("tried to write file larger than scratchbuffer size"); }
 		//append footer data to end of normal data
 		state.buffer.copyWithin(state.scan, state.endoffset, scratchbuf.byteLength);
@@ -92,41 +138,57 @@ export class FileParser<T> {
 	}
 }
 
-// not an async generator since that would incur async overhead for each file
+// runs of consecutive files in the same archive
+export function groupFilesByArchive(allfiles: CacheFileId[]) {
+	let groups: { index: CacheIndex, files: CacheFileId[] }[] = [];
+	for (let fileid of allfiles) {
+		let last = groups.at(-1);
+		if (last && last.index == fileid.index) {
+			last.files.push(fileid);
+		} else {
+			groups.push({ index: fileid.index, files: [fileid] });
+		}
+	}
+	return groups;
+}
+
+// archives are decoded as soon as they are loaded by the source, while later archives are still in flight
+// the callback is still called in file order
 export async function iterateJsonFiles<T>(source: CacheFileSource, mode: JsonBasedFile<T>, allfiles: CacheFileId[],
 	callback: (obj: T, fileid: CacheFileId, logicalid: LogicalIndex) => void | Promise<void>,
 	errorcallback?: (err: Error, fileid: CacheFileId, logicalid: LogicalIndex) => void
 ) {
 	let namelist = (typeof mode.lookup.internalNamefile == "number" ? await source.getInternalNameList(mode.lookup.internalNamefile) : null);
-	let lastarchive: null | { index: CacheIndex, subfiles: SubFile[] } = null;
-	for (let fileid of allfiles) {
-		let arch: SubFile[];
-		if (lastarchive && lastarchive.index == fileid.index) {
-			arch = lastarchive.subfiles;
-		} else {
-			arch = await source.getFileArchive(fileid.index);
-			lastarchive = { index: fileid.index, subfiles: arch };
-		}
+	let groups = groupFilesByArchive(allfiles);
+	let decodeArchive = (group: typeof groups[number], arch: SubFile[]) => group.files.map(fileid => {
 		let file = arch[fileid.subindex];
 		let logicalid = mode.lookup.fileToLogical(source, fileid.index.major, fileid.index.minor, file.fileid);
-		let res: T | null = null;
 		try {
-			res = mode.parser.read(file.buffer, source);
+			let res = mode.parser.read(file.buffer, source);
 			(res as any).$fileid = (logicalid.length == 1 ? logicalid[0] : logicalid);
 			let filename = namelist?.get(logicalid[0]);
 			if (filename) {
 				(res as any).$filename = filename;
 			}
+			return { fileid, logicalid, res, err: null };
 		} catch (err) {
-			if (errorcallback) {
-				errorcallback(err as Error, fileid, logicalid);
-			} else {
-				throw err;
-			}
+			return { fileid, logicalid, res: null, err: err as Error };
 		}
-		if (res) {
-			let cbresult = callback(res, fileid, logicalid);
-			if (cbresult instanceof Promise) { await cbresult; }
+	});
+	let stream = source.streamArchiveList(groups.map(q => q.index), (index, arch, position) => decodeArchive(groups[position], arch));
+	for await (let { decoded, error } of stream) {
+		if (error) { throw error; }
+		for (let { fileid, logicalid, res, err } of decoded!) {
+			if (err) {
+				if (errorcallback) {
+					errorcallback(err, fileid, logicalid);
+				} else {
+					throw err;
+				}
+			} else if (res) {
+				let cbresult = callback(res, fileid, logicalid);
+				if (cbresult instanceof Promise) { await cbresult; }
+			}
 		}
 	}
 }
@@ -202,6 +202,12 @@ export const maprenderConfigSchema: JSONSchema6 = {
             default: false,
             description: "Stops outputting symlinks and relies on the map viewer reading variant files to construct redirects. Also outputs separate small variant files."
         },
+        renderbackend: {
+            type: "string",
+            enum: ["webgl", "software"],
+            default: "webgl",
+            description: "Renderer used for minimap layers. The software renderer rasterizes on the cpu using worker threads and doesn't need a gpu, at the cost of approximated lighting."
+        },
         layers: {
             items: {
                 properties: {
@@ -221,6 +227,8 @@ export const maprenderConfigSchema: JSONSchema6 = {
                         dxdy: number,
                         dzdy: number,
                         hidelocs: boolean,
+                        locatlas: boolean,
+                        lod: number,
                         overlaywalls: boolean,
                         overlayicons: boolean
                     },
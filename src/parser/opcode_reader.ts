@@ -1,6 +1,7 @@
 import { lastLegacyBuildnr } from "../constants";
 import type * as jsonschema from "json-schema";
 import { ClientScriptDeobLoader } from "../clientscript";
+import { ParserCompiler, propAccess } from "./parsercompiler";
 
 export type TypeDef = { [name: string]: unknown };
 
@@ -27,6 +28,10 @@ var debugdata: null | {
 	}[]
 } = null;
 
+export function isDebugging() {
+	return debugdata != null;
+}
+
 export function getDebug(trigger: boolean) {
 	let ret = debugdata;
 	debugdata = trigger ? { rootstate: null, opcodes: [] } : null;
@@ -40,12 +45,18 @@ type SharedEncoderState = {
 	scan: number,
 	endoffset: number,
 	buffer: Buffer,
+	//view over the same bytes as buffer, the accessors are much cheaper than the Buffer read methods
+	view: DataView,
 	args: Record<string, unknown>
 }
 
 export type DecodeState = SharedEncoderState & { isWrite: false };
 export type EncodeState = SharedEncoderState & { isWrite: true };
 
+export function bufferView(buffer: Uint8Array) {
+	return new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength);
+}
+
 export type ResolvedReference = {
 	stackdepth: number,
 	resolve(v: unknown, oldvalue: number): number
@@ -56,7 +67,10 @@ export type ChunkParser = {
 	write(state: EncodeState, v: unknown): void,
 	getTypescriptType(indent: string): string,
 	getJsonSchema(): jsonschema.JSONSchema6Definition,
-	readConst?(state: SharedEncoderState): any
+	readConst?(state: SharedEncoderState): any,
+	//emit specialized code for the parser compiler, parsers without these are called through their interpreted version
+	compileRead?(ctx: ParserCompiler): string,
+	compileWrite?(ctx: ParserCompiler, value: string): void
 }
 
 type ChunkParentCallback = (prop: string, childresolve: ResolvedReference) => ResolvedReference;
@@ -153,6 +167,62 @@ function opcodesParser(chunkdef: {}, parent: ChunkParentCallback, typedef: TypeD
 			state.stack.pop();
 			state.hiddenstack.pop();
 		},
+		compileRead(ctx) {
+			let res = ctx.tmp("obj");
+			let hidden = ctx.tmp("hidden");
+			ctx.line(`let ${res} = {};`);
+			ctx.line(`let ${hidden} = { $opcode: 0 };`);
+			ctx.line(`state.stack.push(${res});`);
+			ctx.line(`state.hiddenstack.push(${hidden});`);
+			ctx.block("while (true)", () => {
+				ctx.block("if (state.scan == state.endoffset)", () => {
+					if (!hasexplicitnull) {
+						ctx.line(`console.log("ended reading opcode struct at end of file without 0x00 opcode");`);
+					}
+					ctx.line("break;");
+				});
+				let opt = ctx.read(opcodetype);
+				ctx.line(`${hidden}.$opcode = ${opt};`);
+				if (!hasexplicitnull) { ctx.line(`if (${opt} == 0) { break; }`); }
+				ctx.block(`switch (${opt})`, () => {
+					for (let [op, parser] of map) {
+						ctx.block(`case ${op}:`, () => {
+							let value = ctx.read(parser.parser);
+							ctx.line(`${propAccess(res, parser.key)} = ${value};`);
+							ctx.line("break;");
+						});
+					}
+					ctx.line(`default: throw new Error("unknown chunk 0x" + ${opt}.toString(16).toUpperCase());`);
+				});
+			});
+			ctx.line("state.stack.pop();");
+			ctx.line("state.hiddenstack.pop();");
+			return res;
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (typeof ${value} != "object" || !${value}) { throw new Error("oject expected"); }`);
+			ctx.line(`state.stack.push(${value});`);
+			ctx.line("state.hiddenstack.push({});");
+			let key = ctx.tmp("key");
+			ctx.block(`for (let ${key} in ${value})`, () => {
+				ctx.line(`if (${key}.startsWith("$")) { continue; }`);
+				ctx.block(`switch (${key})`, () => {
+					for (let [name, opt] of Object.entries(opts)) {
+						ctx.block(`case ${JSON.stringify(name)}:`, () => {
+							ctx.write(opcodetype, `${opt.op}`);
+							ctx.write(opt.parser, `${value}[${key}]`);
+							ctx.line("break;");
+						});
+					}
+					ctx.line(`default: throw new Error("unknown property " + ${key});`);
+				});
+			});
+			if (!hasexplicitnull) {
+				ctx.write(opcodetype, "0");
+			}
+			ctx.line("state.stack.pop();");
+			ctx.line("state.hiddenstack.pop();");
+		},
 		getTypescriptType(indent) {
 			let r = "{\n";
 			let newindent = indent + "\t";
@@ -246,6 +316,16 @@ function tupleParserFactory(istyped: boolean) {
 					prop.write(state, value[i]);
 				}
 			},
+			compileRead(ctx) {
+				let values = props.map(prop => ctx.read(prop));
+				let res = ctx.tmp("arr");
+				ctx.line(`let ${res} = [${values.join(", ")}];`);
+				return res;
+			},
+			compileWrite(ctx, value) {
+				ctx.line(`if (!Array.isArray(${value})) { throw new Error("array expected"); }`);
+				props.forEach((prop, i) => ctx.write(prop, `${value}[${i}]`));
+			},
 			getTypescriptType(indent) {
 				let r = "[\n";
 				let newindent = indent + "\t";
@@ -315,6 +395,12 @@ function refgetter(refparent: ChunkParentCallback | null, propname: string, reso
 			if (state.isWrite && !hidden) { throw new Error(`can update ref values in write mode when they are hidden (prefixed with $) in ${propname}`); }
 			let stack = (hidden ? state.hiddenstack : state.stack);
 			stack[stack.length - depth][propname] = newvalue;
+		},
+		compile(ctx: ParserCompiler) {
+			let stack = (hidden ? "state.hiddenstack" : "state.stack");
+			let v = ctx.tmp("ref");
+			ctx.line(`let ${v} = ${propAccess(`${stack}[${stack}.length - ${depth}]`, propname)};`);
+			return v;
 		}
 	}
 }
@@ -370,6 +456,52 @@ function structParser(args: unknown[], parent: ChunkParentCallback, typedef: Typ
 			state.stack.pop();
 			state.hiddenstack.pop();
 		},
+		compileRead(ctx) {
+			let res = ctx.tmp("obj");
+			let hidden = ctx.tmp("hidden");
+			ctx.line(`let ${res} = {};`);
+			ctx.line(`let ${hidden} = {};`);
+			ctx.line(`state.stack.push(${res});`);
+			ctx.line(`state.hiddenstack.push(${hidden});`);
+			for (let key of keys) {
+				let v = ctx.read(props[key]);
+				ctx.line(`if (${v} !== undefined) { ${propAccess(key[0] == "$" ? hidden : res, key)} = ${v}; }`);
+			}
+			ctx.line("state.stack.pop();");
+			ctx.line("state.hiddenstack.pop();");
+			return res;
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (typeof ${value} != "object" || !${value}) { throw new Error("object expected"); }`);
+			let hidden = ctx.tmp("hidden");
+			ctx.line(`let ${hidden} = {};`);
+			ctx.line(`state.stack.push(${value});`);
+			ctx.line(`state.hiddenstack.push(${hidden});`);
+			for (let key of keys) {
+				let prop: ChunkParser = props[key];
+				let v = ctx.tmp("w");
+				ctx.line(`let ${v} = ${propAccess(value, key)};`);
+				if (key.startsWith("$")) {
+					if (prop.readConst != undefined) {
+						ctx.line(`${v} = ${ctx.external(prop)}.readConst(state);`);
+					} else {
+						let refarray = refs[key];
+						if (!refarray) {
+							ctx.line(`throw new Error("cannot write hidden values if they are not constant or not referenced");`);
+						} else {
+							ctx.line(`${v} ??= 0;`);
+							for (let ref of refarray) {
+								ctx.line(`${v} = ${ctx.external(ref)}.resolve(${value}, ${v});`);
+							}
+						}
+					}
+					ctx.line(`${propAccess(hidden, key)} = ${v};`);
+				}
+				ctx.write(prop, v);
+			}
+			ctx.line("state.stack.pop();");
+			ctx.line("state.hiddenstack.pop();");
+		},
 		getTypescriptType(indent) {
 			let r = "{\n";
 			let newindent = indent + "\t";
@@ -441,6 +573,19 @@ function optParser(args: unknown[], parent: ChunkParentCallback, typedef: TypeDe
 				return type.write(state, value);
 			}
 		},
+		compileRead(ctx) {
+			let matchindex = condchecker.compileMatch(ctx);
+			let res = ctx.tmp();
+			ctx.line(`let ${res} = null;`);
+			ctx.block(`if (${matchindex} != -1)`, () => {
+				let value = ctx.read(type);
+				ctx.line(`${res} = ${value};`);
+			});
+			return res;
+		},
+		compileWrite(ctx, value) {
+			ctx.block(`if (${value} != null)`, () => ctx.write(type, value));
+		},
 		getTypescriptType(indent) {
 			return type.getTypescriptType(indent) + " | null";
 		},
@@ -688,8 +833,22 @@ function bufferParserValue(value: unknown, type: typeof BufferTypes[keyof typeof
 }
 
 function flipBufferEndianness(bytes: Uint8Array, bytesPerElement: number) {
+	let count = bytes.byteLength / bytesPerElement;
 	if (bytesPerElement == 1) {
 		//noop
+	} else if (bytesPerElement == 2 && bytes.byteOffset % 2 == 0) {
+		//swap whole words at once when aligned
+		let words = new Uint16Array(bytes.buffer, bytes.byteOffset, count);
+		for (let i = 0; i < count; i++) {
+			let v = words[i];
+			words[i] = (v >>> 8) | (v << 8);
+		}
+	} else if (bytesPerElement == 4 && bytes.byteOffset % 4 == 0) {
+		let words = new Uint32Array(bytes.buffer, bytes.byteOffset, count);
+		for (let i = 0; i < count; i++) {
+			let v = words[i];
+			words[i] = (v >>> 24) | ((v >>> 8) & 0xff00) | ((v << 8) & 0xff0000) | (v << 24);
+		}
 	} else if (bytesPerElement == 2) {
 		for (let i = 0; i < bytes.length; i += 2) {
 			let a = bytes[i];
@@ -711,23 +870,41 @@ function flipBufferEndianness(bytes: Uint8Array, bytesPerElement: number) {
 	}
 }
 
+/**
+ * Reads count elements as typed array. Little endian data at an aligned offset is returned as a view
+ * into the file buffer without copying, so the result shares memory with the (possibly cached) file
+ * and should be copied before modifying it. Unaligned and big endian data is copied.
+ */
+function readTypedArray(state: DecodeState, type: typeof BufferTypes[keyof typeof BufferTypes], count: number) {
+	let bytelen = count * type.constr.BYTES_PER_ELEMENT;
+	if (state.scan + bytelen > state.endoffset) { throw new Error("trying to read outside buffer bounds"); }
+	let offset = state.buffer.byteOffset + state.scan;
+	let res: ArrayBufferView;
+	if (type.constr == BufferTypes.buffer.constr) {
+		res = state.buffer.subarray(state.scan, state.scan + bytelen);
+	} else if (!type.bigEndian && offset % type.constr.BYTES_PER_ELEMENT == 0) {
+		res = new type.constr(state.buffer.buffer, offset, count);
+	} else {
+		let backing = new ArrayBuffer(bytelen);
+		let bytes = new Uint8Array(backing);
+		bytes.set(state.buffer.subarray(state.scan, state.scan + bytelen));
+		if (type.bigEndian) {
+			flipBufferEndianness(bytes, type.constr.BYTES_PER_ELEMENT);
+		}
+		res = new type.constr(backing);
+	}
+	state.scan += bytelen;
+	return res;
+}
+
 function bufferParser(args: unknown[], parent: ChunkParentCallback, typedef: TypeDef) {
 	let r: ChunkParser = {
 		read(state) {
 			let len = lengthtype.read(state);
-			let bytelen = len * vectorLength * type.constr.BYTES_PER_ELEMENT;
-			let backing = new ArrayBuffer(bytelen);
-			if (state.scan + bytelen > state.endoffset) { throw new Error("trying to read outside buffer bounds"); }
-			let bytes = Buffer.from(backing);
-			bytes.set(state.buffer.subarray(state.scan, state.scan + bytelen));
-			state.scan += bytelen;
-			if (type.bigEndian) {
-				flipBufferEndianness(bytes, type.constr.BYTES_PER_ELEMENT);
-			}
-			let array = (scalartype == "buffer" ? bytes : new type.constr(backing));
+			let array = readTypedArray(state, type, len * vectorLength) as InstanceType<typeof type.constr>;
 			if (scalartype == "hex") {
 				Object.defineProperty(array, "toJSON", {
-					value: () => bytes.toString("hex"),
+					value: () => Buffer.from(array.buffer, array.byteOffset, array.byteLength).toString("hex"),
 					enumerable: false
 				});
 			} else if (state.args.keepBufferJson === true) {
@@ -813,6 +990,36 @@ function arrayParser(args: unknown[], parent: ChunkParentCallback, typedef: Type
 			state.hiddenstack.pop();
 			state.stack.pop();
 		},
+		compileRead(ctx) {
+			let len = ctx.read(lengthtype);
+			let hidden = ctx.tmp("hidden");
+			let res = ctx.tmp("arr");
+			let i = ctx.tmp("i");
+			ctx.line(`let ${hidden} = { $index: 0, $length: ${len} };`);
+			ctx.line(`state.hiddenstack.push(${hidden});`);
+			ctx.line("state.stack.push({});");
+			ctx.line(`let ${res} = [];`);
+			ctx.block(`for (let ${i} = 0; ${i} < ${len}; ${i}++)`, () => {
+				ctx.line(`${hidden}.$index = ${i};`);
+				let value = ctx.read(subtype);
+				ctx.line(`${res}.push(${value});`);
+			});
+			ctx.line("state.hiddenstack.pop();");
+			ctx.line("state.stack.pop();");
+			return res;
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (!Array.isArray(${value})) { throw new Error("array expected"); }`);
+			ctx.write(lengthtype, `${value}.length`);
+			ctx.line("state.stack.push({});");
+			ctx.line(`state.hiddenstack.push({ $index: 0, $length: ${value}.length });`);
+			let i = ctx.tmp("i");
+			ctx.block(`for (let ${i} = 0; ${i} < ${value}.length; ${i}++)`, () => {
+				ctx.write(subtype, `${value}[${i}]`);
+			});
+			ctx.line("state.hiddenstack.pop();");
+			ctx.line("state.stack.pop();");
+		},
 		getTypescriptType(indent) {
 			return `${subtype.getTypescriptType(indent)}[]`;
 		},
@@ -946,6 +1153,12 @@ function literalValueParser(constvalue: unknown) {
 			if (value != constvalue) throw new Error(`expected constant ${constvalue} was not present during write`);
 			//this is a nop, the existence of this field implies its value
 		},
+		compileRead(ctx) {
+			return JSON.stringify(constvalue);
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (${value} != ${JSON.stringify(constvalue)}) { throw new Error(${JSON.stringify(`expected constant ${constvalue} was not present during write`)}); }`);
+		},
 		getTypescriptType() {
 			return JSON.stringify(constvalue);
 		},
@@ -973,6 +1186,21 @@ function referenceValueParser(args: unknown[], parent: ChunkParentCallback, type
 		write(state, value) {
 			//noop, the referenced value does the writing and will get its value from this prop through refgetter
 		},
+		compileRead(ctx) {
+			let value = ref.compile(ctx);
+			if (indexgetter) {
+				let index = indexgetter.compile(ctx);
+				ctx.line(`${value} = ${value}[${index}];`);
+			}
+			if (minbit != -1) {
+				ctx.line(`${value} = (${value} >> ${minbit}) & ${~((~0) << bitlength)};`);
+			}
+			ctx.line(`${value} = ${value} + ${offset};`);
+			return value;
+		},
+		compileWrite(ctx, value) {
+			//noop
+		},
 		getTypescriptType() {
 			return "number";
 		},
@@ -1097,19 +1325,13 @@ function stringParser(prebytes: number[]): ChunkParser {
 		read(state) {
 			let terminator = (getClientVersion(state.args) <= lastLegacyBuildnr ? 0xA : 0);
 			for (let i = 0; i < prebytes.length; i++, state.scan++) {
-				if (state.buffer.readUInt8(state.scan) != prebytes[i]) {
+				if (state.view.getUint8(state.scan) != prebytes[i]) {
 					throw new Error("failed to match string header bytes");
 				}
 			}
-			let end = state.scan;
-			while (true) {
-				if (end == state.endoffset) {
-					throw new Error("reading string without null termination");
-				}
-				if (state.buffer.readUInt8(end) == terminator) {
-					break;
-				}
-				end++;
+			let end = state.buffer.indexOf(terminator, state.scan);
+			if (end == -1 || end >= state.endoffset) {
+				throw new Error("reading string without null termination");
 			}
 			let outputstr = state.buffer.toString(encoding, state.scan, end);
 			state.scan = end + 1;
@@ -1246,8 +1468,32 @@ function conditionParser(parent: ChunkParentCallback, optionstrings: string[], w
 		return -1;
 	}
 
+	let compileMatch = (ctx: ParserCompiler) => {
+		let vars = varmap.map(q => q.parser.compile(ctx));
+		let res = ctx.tmp("match");
+		ctx.line(`let ${res} = -1;`);
+		for (let optindex = 0; optindex < options.length; optindex++) {
+			let conds = options[optindex].map(cond => {
+				let value = vars[cond.varindex];
+				switch (cond.op) {
+					case "=": return `${value} == ${cond.value}`;
+					case "!=": return `${value} != ${cond.value}`;
+					case "<": return `${value} < ${cond.value}`;
+					case "<=": return `${value} <= ${cond.value}`;
+					case ">": return `${value} > ${cond.value}`;
+					case ">=": return `${value} >= ${cond.value}`;
+					case "&": return `(${value} & ${cond.value}) != 0`;
+					case "!&": return `(${value} & ${cond.value}) == 0`;
+					case "&=": return `(${value} & ${cond.value}) == ${cond.value}`;
+					default: throw new Error("unknown op" + cond.op);
+				}
+			});
+			ctx.line(`${optindex == 0 ? "if" : "else if"} (${conds.join(" && ") || "true"}) { ${res} = ${optindex}; }`);
+		}
+		return res;
+	}
 
-	return { match };
+	return { match, compileMatch };
 }
 
 
@@ -1255,9 +1501,9 @@ const hardcodes: Record<string, (args: unknown[], parent: ChunkParentCallback, t
 	playeritem: function () {
 		return {
 			read(state) {
-				let byte0 = state.buffer.readUInt8(state.scan++);
+				let byte0 = state.view.getUint8(state.scan++);
 				if (byte0 == 0) { return 0; }
-				let byte1 = state.buffer.readUInt8(state.scan++);
+				let byte1 = state.view.getUint8(state.scan++);
 				if (byte1 == 0xff && byte0 == 0xff) { return -1; }
 				return (byte0 << 8) | byte1;
 			},
@@ -1350,6 +1596,47 @@ const hardcodes: Record<string, (args: unknown[], parent: ChunkParentCallback, t
 				state.stack.pop();
 				state.hiddenstack.pop();
 			},
+			compileRead(ctx) {
+				let opcodeprop = ctx.tmp("hidden");
+				ctx.line(`let ${opcodeprop} = { $opcode: 0 };`);
+				ctx.line("state.stack.push({});");
+				ctx.line(`state.hiddenstack.push(${opcodeprop});`);
+				let value = (opvalueparser ? ctx.read(opvalueparser) : "0");
+				ctx.line(`${opcodeprop}.$opcode = ${value};`);
+				let opindex = conditionparser.compileMatch(ctx);
+				ctx.line(`if (${opindex} == -1) { throw new Error("no opcode matched"); }`);
+				let res = ctx.tmp();
+				ctx.line(`let ${res};`);
+				optionvalues.forEach((opt, i) => {
+					ctx.block(`${i == 0 ? "if" : "else if"} (${opindex} == ${i})`, () => {
+						let optvalue = ctx.read(opt);
+						ctx.line(`${res} = ${optvalue};`);
+					});
+				});
+				ctx.line("state.stack.pop();");
+				ctx.line("state.hiddenstack.pop();");
+				return res;
+			},
+			compileWrite(ctx, value) {
+				let opcodeprop = ctx.tmp("hidden");
+				ctx.line(`let ${opcodeprop} = { $opcode: 0 };`);
+				ctx.line("state.stack.push({});");
+				ctx.line(`state.hiddenstack.push(${opcodeprop});`);
+				if (opvalueparser) {
+					if (!opvalueparser.readConst) {
+						ctx.line(`throw new Error("non-const or non-reference match value not implemented in write mode");`);
+					} else {
+						ctx.line(`${opcodeprop}.$opcode = ${ctx.external(opvalueparser)}.readConst(state);`);
+					}
+				}
+				let opindex = conditionparser.compileMatch(ctx);
+				ctx.line(`if (${opindex} == -1) { throw new Error("no opcode matched"); }`);
+				optionvalues.forEach((opt, i) => {
+					ctx.block(`${i == 0 ? "if" : "else if"} (${opindex} == ${i})`, () => ctx.write(opt, value));
+				});
+				ctx.line("state.stack.pop();");
+				ctx.line("state.hiddenstack.pop();");
+			},
 			getTypescriptType(indent) {
 				return "(" + optionvalues.map(opt => opt.getTypescriptType(indent + "\t")).join("|") + ")";
 			},
@@ -1425,11 +1712,11 @@ const hardcodes: Record<string, (args: unknown[], parent: ChunkParentCallback, t
 		// TODO i remember this existing in skeletal anims as well, merge implementations
 		return {
 			read(state) {
-				let byte0 = state.buffer.readUint8(state.scan++);
+				let byte0 = state.view.getUint8(state.scan++);
 				if ((byte0 & 0x80) == 0) {
 					return byte0;
 				}
-				let byte1 = state.buffer.readUint8(state.scan++);
+				let byte1 = state.view.getUint8(state.scan++);
 				return (byte1 << 7) | (byte0 & 0x7f);
 			},
 			write(state, v) {
@@ -1455,12 +1742,12 @@ const hardcodes: Record<string, (args: unknown[], parent: ChunkParentCallback, t
 			read(state) {
 				let sum = 0;
 				while (true) {
-					let byte0 = state.buffer.readUint8(state.scan++);
+					let byte0 = state.view.getUint8(state.scan++);
 					let v: number;
 					if ((byte0 & 0x80) == 0) {
 						v = byte0;
 					} else {
-						let byte1 = state.buffer.readUint8(state.scan++);
+						let byte1 = state.view.getUint8(state.scan++);
 						v = ((byte0 & 0x7f) << 8) | byte1;
 					}
 					sum += v;
@@ -1502,15 +1789,15 @@ const hardcodes: Record<string, (args: unknown[], parent: ChunkParentCallback, t
 					height: null as number | null
 				}
 				while (true) {
-					let op = state.buffer.readUint8(state.scan++);
+					let op = state.view.getUint8(state.scan++);
 					if (op == 0) { break; }
 					if (op == 1) {
-						res.height = state.buffer.readUint8(state.scan++);
+						res.height = state.view.getUint8(state.scan++);
 						break;
 					}
 					if (op >= 2 && op <= 49) {
 						res.shape = op - 2;
-						res.overlay = state.buffer.readUint8(state.scan);
+						res.overlay = state.view.getUint8(state.scan);
 						state.scan += 1;
 					}
 					if (op >= 50 && op <= 81) {
@@ -1581,64 +1868,64 @@ function getClientVersion(args: Record<string, unknown>) {
 
 const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s: EncodeState, v: number) => void, min: number, max: number }> = {
 	ubyte: {
-		read(s) { let r = s.buffer.readUInt8(s.scan); s.scan += 1; return r; },
+		read(s) { let r = s.view.getUint8(s.scan); s.scan += 1; return r; },
 		write(s, v) { s.buffer.writeUInt8(v, s.scan); s.scan += 1; },
 		min: 0, max: 255
 	},
 	byte: {
-		read(s) { let r = s.buffer.readInt8(s.scan); s.scan += 1; return r; },
+		read(s) { let r = s.view.getInt8(s.scan); s.scan += 1; return r; },
 		write(s, v) { s.buffer.writeInt8(v, s.scan); s.scan += 1; },
 		min: -128, max: 127
 	},
 	ushort: {
-		read(s) { let r = s.buffer.readUInt16BE(s.scan); s.scan += 2; return r; },
+		read(s) { let r = s.view.getUint16(s.scan); s.scan += 2; return r; },
 		write(s, v) { s.buffer.writeUInt16BE(v, s.scan); s.scan += 2; },
 		min: 0, max: 2 ** 16 - 1
 	},
 	short: {
-		read(s) { let r = s.buffer.readInt16BE(s.scan); s.scan += 2; return r; },
+		read(s) { let r = s.view.getInt16(s.scan); s.scan += 2; return r; },
 		write(s, v) { s.buffer.writeInt16BE(v, s.scan); s.scan += 2; },
 		min: -(2 ** 15), max: 2 ** 15 - 1
 	},
 	uint: {
-		read(s) { let r = s.buffer.readUInt32BE(s.scan); s.scan += 4; return r; },
+		read(s) { let r = s.view.getUint32(s.scan); s.scan += 4; return r; },
 		write(s, v) { s.buffer.writeUInt32BE(v, s.scan); s.scan += 4; },
 		min: 0, max: 2 ** 32 - 1
 	},
 	int: {
-		read(s) { let r = s.buffer.readInt32BE(s.scan); s.scan += 4; return r; },
+		read(s) { let r = s.view.getInt32(s.scan); s.scan += 4; return r; },
 		write(s, v) { s.buffer.writeInt32BE(v, s.scan); s.scan += 4; },
 		min: -(2 ** 31), max: 2 ** 31 - 1
 	},
 
 	uint_le: {
-		read(s) { let r = s.buffer.readUInt32LE(s.scan); s.scan += 4; return r; },
+		read(s) { let r = s.view.getUint32(s.scan, true); s.scan += 4; return r; },
 		write(s, v) { s.buffer.writeUint32LE(v, s.scan); s.scan += 4; },
 		min: 0, max: 2 ** 32 - 1
 	},
 	ushort_le: {
-		read(s) { let r = s.buffer.readUInt16LE(s.scan); s.scan += 2; return r; },
+		read(s) { let r = s.view.getUint16(s.scan, true); s.scan += 2; return r; },
 		write(s, v) { s.buffer.writeUint16LE(v, s.scan); s.scan += 2; },
 		min: 0, max: 2 ** 16 - 1
 	},
 	utribyte: {
-		read(s) { let r = s.buffer.readUIntBE(s.scan, 3); s.scan += 3; return r; },
+		read(s) { let r = (s.view.getUint16(s.scan) << 8) | s.view.getUint8(s.scan + 2); s.scan += 3; return r; },
 		write(s, v) { s.buffer.writeUintBE(v, s.scan, 3); s.scan += 3; },
 		min: 0, max: 2 ** 24 - 1
 	},
 	float: {
-		read(s) { let r = s.buffer.readFloatBE(s.scan); s.scan += 4; return r; },
+		read(s) { let r = s.view.getFloat32(s.scan); s.scan += 4; return r; },
 		write(s, v) { s.buffer.writeFloatBE(v, s.scan); s.scan += 4; },
 		min: Number.MIN_VALUE, max: Number.MAX_VALUE
 	},
 
 	varushort: {
 		read(s) {
-			let firstByte = s.buffer.readUInt8(s.scan++);
+			let firstByte = s.view.getUint8(s.scan++);
 			if ((firstByte & 0x80) == 0) {
 				return firstByte;
 			}
-			let secondByte = s.buffer.readUInt8(s.scan++);
+			let secondByte = s.view.getUint8(s.scan++);
 			return ((firstByte & 0x7f) << 8) | secondByte;
 		},
 		write(s, v) {
@@ -1654,12 +1941,12 @@ const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s:
 	},
 	varshort: {
 		read(s) {
-			let firstByte = s.buffer.readUInt8(s.scan++);
+			let firstByte = s.view.getUint8(s.scan++);
 			if ((firstByte & 0x80) == 0) {
 				//sign extend from 7nth bit (>> fills using 32th bit)
 				return (firstByte << (32 - 7)) >> (32 - 7);
 			}
-			let secondByte = s.buffer.readUInt8(s.scan++);
+			let secondByte = s.view.getUint8(s.scan++);
 			return ((((firstByte & 0x7f) << 8) | secondByte) << (32 - 15)) >> (32 - 15);
 		},
 		write(s, v) {
@@ -1675,12 +1962,12 @@ const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s:
 	},
 	varuint: {
 		read(s) {
-			let firstWord = s.buffer.readUInt16BE(s.scan);
+			let firstWord = s.view.getUint16(s.scan);
 			s.scan += 2;
 			if ((firstWord & 0x8000) == 0) {
 				return firstWord;
 			} else {
-				let secondWord = s.buffer.readUInt16BE(s.scan);
+				let secondWord = s.view.getUint16(s.scan);
 				s.scan += 2;
 				return ((firstWord & 0x7fff) << 16) | secondWord;
 			}
@@ -1699,14 +1986,14 @@ const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s:
 	},
 	varnullint: {
 		read(s) {
-			let firstWord = s.buffer.readUInt16BE(s.scan);
+			let firstWord = s.view.getUint16(s.scan);
 			s.scan += 2;
 			if (firstWord == 0x7fff) {
 				return -1;
 			} else if ((firstWord & 0x8000) == 0) {
 				return firstWord;
 			} else {
-				let secondWord = s.buffer.readUInt16BE(s.scan);
+				let secondWord = s.view.getUint16(s.scan);
 				s.scan += 2;
 				return ((firstWord & 0x7fff) << 16) | secondWord;
 			}
@@ -1728,13 +2015,13 @@ const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s:
 	},
 	varint: {
 		read(s) {
-			let firstWord = s.buffer.readUInt16BE(s.scan);
+			let firstWord = s.view.getUint16(s.scan);
 			s.scan += 2;
 			if ((firstWord & 0x8000) == 0) {
 				//sign extend from 7nth bit (>> fills using 32th bit)
 				return (firstWord << (32 - 15)) >> (32 - 15);
 			}
-			let secondWord = s.buffer.readUInt16BE(s.scan);
+			let secondWord = s.view.getUint16(s.scan);
 			s.scan += 2;
 			return ((((firstWord & 0x7fff) << 16) | secondWord) << (32 - 31)) >> (32 - 31);
 		},
@@ -1752,6 +2039,36 @@ const numberTypes: Record<string, { read: (s: DecodeState) => number, write: (s:
 	}
 }
 
+//DataView getter, Buffer writer and size of the fixed size number types, used to inline them in compiled parsers
+const fixedNumberAccessors: Record<string, { get: string, set: string, size: number, littleEndian: boolean }> = {
+	ubyte: { get: "getUint8", set: "writeUInt8", size: 1, littleEndian: false },
+	byte: { get: "getInt8", set: "writeInt8", size: 1, littleEndian: false },
+	ushort: { get: "getUint16", set: "writeUInt16BE", size: 2, littleEndian: false },
+	short: { get: "getInt16", set: "writeInt16BE", size: 2, littleEndian: false },
+	uint: { get: "getUint32", set: "writeUInt32BE", size: 4, littleEndian: false },
+	int: { get: "getInt32", set: "writeInt32BE", size: 4, littleEndian: false },
+	uint_le: { get: "getUint32", set: "writeUint32LE", size: 4, littleEndian: true },
+	ushort_le: { get: "getUint16", set: "writeUint16LE", size: 2, littleEndian: true },
+	float: { get: "getFloat32", set: "writeFloatBE", size: 4, littleEndian: false }
+}
+
+function compiledNumberType(e: typeof numberTypes[string], accessor: typeof fixedNumberAccessors[string] | undefined): Pick<ChunkParser, "compileRead" | "compileWrite"> {
+	if (!accessor) { return {}; }
+	return {
+		compileRead(ctx) {
+			let v = ctx.tmp();
+			ctx.line(`let ${v} = state.view.${accessor.get}(state.scan${accessor.littleEndian ? ", true" : ""});`);
+			ctx.line(`state.scan += ${accessor.size};`);
+			return v;
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (typeof ${value} != "number" || ${value} > ${e.max} || ${value} < ${e.min}) { throw new Error(); }`);
+			ctx.line(`state.buffer.${accessor.set}(${value}, state.scan);`);
+			ctx.line(`state.scan += ${accessor.size};`);
+		}
+	};
+}
+
 const parserPrimitives: Record<string, ChunkParser> = {
 	...Object.fromEntries(Object.entries(numberTypes).map<[string, ChunkParser]>(([k, e]) => [k, {
 		read: e.read,
@@ -1759,6 +2076,7 @@ const parserPrimitives: Record<string, ChunkParser> = {
 			if (typeof v != "number" || v > e.max || v < e.min) { throw new Error(); }
 			e.write(s, v);
 		},
+		...compiledNumberType(e, fixedNumberAccessors[k]),
 		getJsonSchema() {
 			return { type: "number", maximum: e.max, minimum: e.min };
 		},
@@ -1768,7 +2086,7 @@ const parserPrimitives: Record<string, ChunkParser> = {
 	}])),
 	bool: {
 		read(s) {
-			let r = s.buffer.readUInt8(s.scan++);
+			let r = s.view.getUint8(s.scan++);
 			if (r != 0 && r != 1) { throw new Error("1 or 0 expected boolean value"); }
 			return r != 0;
 		},
@@ -1776,6 +2094,16 @@ const parserPrimitives: Record<string, ChunkParser> = {
 			if (typeof v != "boolean") { throw new Error("boolean expected"); }
 			s.buffer.writeUInt8(+v, s.scan++);
 		},
+		compileRead(ctx) {
+			let v = ctx.tmp();
+			ctx.line(`let ${v} = state.view.getUint8(state.scan++);`);
+			ctx.line(`if (${v} != 0 && ${v} != 1) { throw new Error("1 or 0 expected boolean value"); }`);
+			return `(${v} != 0)`;
+		},
+		compileWrite(ctx, value) {
+			ctx.line(`if (typeof ${value} != "boolean") { throw new Error("boolean expected"); }`);
+			ctx.line(`state.buffer.writeUInt8(+${value}, state.scan++);`);
+		},
 		getJsonSchema() {
 			return { type: "boolean" };
 		},
@@ -0,0 +1,129 @@
+import type { ChunkParser, DecodeState, EncodeState } from "./opcode_reader";
+import { crc32 } from "../libs/crc32util";
+
+//exports of a generated parser module
+export type CompiledParserModule = {
+	//crc of the generated source, used to check that a generated module matches the current opcode definition
+	hash: number,
+	read(state: DecodeState, ext: unknown[]): any,
+	write(state: EncodeState, ext: unknown[], value: unknown): void
+}
+
+export type LinkedParser = {
+	read(state: DecodeState): any,
+	write(state: EncodeState, value: unknown): void
+}
+
+/**
+ * Emits straight-line javascript for a parser tree. Parsers that implement compileRead/compileWrite
+ * inline their code, all others are called through their interpreted version which is passed in
+ * as external. The compiled code maintains the same state.stack and state.hiddenstack frames as
+ * the interpreted parsers so references from and into external parsers keep working.
+ */
+export class ParserCompiler {
+	private lines: string[] = [];
+	private indent = "\t";
+	private varcounter = 0;
+	externals: unknown[] = [];
+
+	tmp(name = "v") {
+		return `${name}${this.varcounter++}`;
+	}
+
+	line(code: string) {
+		this.lines.push(this.indent + code);
+	}
+
+	block(head: string, body: () => void, tail = "}") {
+		this.line(`${head} {`);
+		let oldindent = this.indent;
+		this.indent += "\t";
+		body();
+		this.indent = oldindent;
+		this.line(tail);
+	}
+
+	//reference to an object that is passed to the compiled function at runtime
+	external(obj: unknown) {
+		let index = this.externals.indexOf(obj);
+		if (index == -1) {
+			index = this.externals.length;
+			this.externals.push(obj);
+		}
+		return `ext[${index}]`;
+	}
+
+	//emits the code to read a value and returns an expression that is safe to evaluate later
+	read(parser: ChunkParser) {
+		if (parser.compileRead) {
+			return parser.compileRead(this);
+		}
+		let v = this.tmp();
+		this.line(`let ${v} = ${this.external(parser)}.read(state);`);
+		return v;
+	}
+
+	write(parser: ChunkParser, value: string) {
+		//evaluate the value expression only once
+		if (!value.match(/^[\w$]+$/)) {
+			let v = this.tmp("w");
+			this.line(`let ${v} = ${value};`);
+			value = v;
+		}
+		if (parser.compileWrite) {
+			parser.compileWrite(this, value);
+		} else {
+			this.line(`${this.external(parser)}.write(state, ${value});`);
+		}
+	}
+
+	takeBody() {
+		let body = this.lines.join("\n");
+		this.lines = [];
+		return body;
+	}
+}
+
+export function propAccess(obj: string, prop: string) {
+	return (prop.match(/^[a-zA-Z_$][\w$]*$/) ? `${obj}.${prop}` : `${obj}[${JSON.stringify(prop)}]`);
+}
+
+export function compileParser(parser: ChunkParser) {
+	let ctx = new ParserCompiler();
+	let res = ctx.read(parser);
+	ctx.line(`return ${res};`);
+	let readbody = ctx.takeBody();
+	ctx.write(parser, "value");
+	let writebody = ctx.takeBody();
+	let source = `function read(state, ext) {\n${readbody}\n}\n\nfunction write(state, ext, value) {\n${writebody}\n}\n`;
+	let hash = crc32(Buffer.from(source, "utf8"));
+	return { source, hash, externals: ctx.externals };
+}
+
+/**
+ * Source of a generated module, the functions are plain javascript so the file is excluded from type checking
+ */
+export function compiledParserModule(parser: ChunkParser, sourcefile: string) {
+	let compiled = compileParser(parser);
+	return "// GENERATED DO NOT EDIT\n" +
+		"// This source data is located at '" + sourcefile + "'\n" +
+		"// run `npm run filetypes` to rebuild\n" +
+		"// @ts-nocheck\n\n" +
+		`export const hash = 0x${compiled.hash.toString(16).padStart(8, "0")};\n\n` +
+		compiled.source.replace(/^function /gm, "export function ");
+}
+
+/**
+ * Wraps a generated module around the interpreted parser it was compiled from. Returns null if the
+ * module was generated from a different definition, in which case the interpreted parser should be used.
+ */
+export function linkCompiledParser(parser: ChunkParser, generated: CompiledParserModule[]): LinkedParser | null {
+	let compiled = compileParser(parser);
+	const mod = generated.find(q => q.hash == compiled.hash);
+	if (!mod) { return null; }
+	let ext = compiled.externals;
+	return {
+		read: (state) => mod.read(state, ext),
+		write: (state, value) => mod.write(state, ext, value)
+	};
+}
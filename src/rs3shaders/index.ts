@@ -1,4 +1,4 @@
-import { SRGBColorSpace, ShaderMaterial, Texture } from "three";
+import { DataTexture, LinearFilter, NearestFilter, RGBAFormat, SRGBColorSpace, ShaderMaterial, Texture } from "three";
 import { MaterialData } from "../3d/materials/jmat";
 
 let inputreplace: InputReplacer = {
@@ -28,6 +28,15 @@ let inputreplace: InputReplacer = {
     gl_FragColor: ""
 };
 
+//per vertex material slot when rendering multiple materials with one shared atlas
+let inputreplaceatlas: InputReplacer = {
+    ...inputreplace,
+    aMaterialSettingsSlotXY_TilePositionXZ: [
+        "attribute vec2 materialslot;",
+        "#define aMaterialSettingsSlotXY_TilePositionXZ vec4(materialslot,0.0,0.0)"
+    ]
+};
+
 let definereplace: InputReplacer = {
     UNIFORM_BUFFER_BEGIN: "#define UNIFORM_BUFFER_BEGIN(name)",
     UNIFORM_BUFFER_END: "#define UNIFORM_BUFFER_END",
@@ -42,79 +51,194 @@ let definereplaceloc: InputReplacer = {
     // SRGB_TEXTURES: ""
 }
 
-export function minimapLocMaterial(texture: Texture, alphamode: MaterialData["alphamode"], alphathreshold: number) {
-    let mat = new ShaderMaterial();
-    mat.uniforms = {
-        uAlphaTestThreshold: { value: [-1] },
-        uAmbientColour: { value: [0.6059895753860474, 0.5648590922355652, 0.5127604007720947] },
-        uAtlasMeta: { value: [512, 16, 0.0001220703125, 4] },
-        uCameraPosition: { value: [1638400, 17248, 1671168] },
-        uDummy: { value: [1] },
-        uFade: { value: [0] },
-        uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
-        uInscatteringAmount: { value: [1, 0, 0] },
-        uInvSunDirection: { value: [-0.5391638875007629, 0.6469966173171997, -0.5391638875007629] },
-        uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1630208, 0, 1654784, 1] },
-        uOutscatteringAmount: { value: [1638400, 17248, 1671168] },
-        uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
-        uScatteringParameters: { value: [0, -1, 5.960465188081798e-8, 0] },
-        uScatteringTintColour: { value: [0, 5.960465188081798e-8, 1] },
-        uSunColour: { value: [0.8666666746139526, 0.8078431487083435, 0.7333333492279053] },
-        uTextureAnimationTime: { value: [459.7019958496094] },
-        uTextureAtlas: { value: [5] },
-        uTextureAtlasSettings: { value: [6] },
-        uTint: { value: [0, 0, 0, 0] },
-        uVertexScale: { value: [1] },
-        uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1638400, 1671168, -17248.099609375, 1] },
-        uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25, -25.5, 0.03770458698272705, 1] },
-        uViewportLookupScale: { value: [1638400, 17248, 1671168, 0] },
-        uViewportOffsetScale: { value: [1, 0, 0, 0] },
-        uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
-    };
+export type MinimapShaderKind = "loc" | "floor" | "water";
 
-    mat.vertexColors = true;
+type ShaderVariant = {
+    vertexShader: string,
+    fragmentShader: string,
+    programkey: string
+}
+
+//preprocessed shader sources keyed by kind and define toggles, the patching below is
+//expensive on these multi-thousand line sources so we only do it once per variant.
+//handing out the same string instances also lets threejs reuse a single gl program
+const shaderVariants = new Map<string, ShaderVariant>();
+
+//uniforms that are identical for every material, these are shared between materials
+//and should not be mutated
+const locUniforms = {
+    uAmbientColour: { value: [0.6059895753860474, 0.5648590922355652, 0.5127604007720947] },
+    uAtlasMeta: { value: [512, 16, 0.0001220703125, 4] },
+    uCameraPosition: { value: [1638400, 17248, 1671168] },
+    uDummy: { value: [1] },
+    uFade: { value: [0] },
+    uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
+    uInscatteringAmount: { value: [1, 0, 0] },
+    uInvSunDirection: { value: [-0.5391638875007629, 0.6469966173171997, 0.5391638875007629] },//z flipped
+    uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1630208, 0, 1654784, 1] },
+    uOutscatteringAmount: { value: [1638400, 17248, 1671168] },
+    uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
+    uScatteringParameters: { value: [0, -1, 5.960465188081798e-8, 0] },
+    uScatteringTintColour: { value: [0, 5.960465188081798e-8, 1] },
+    uSunColour: { value: [0.8666666746139526, 0.8078431487083435, 0.7333333492279053] },
+    uTextureAnimationTime: { value: [459.7019958496094] },
+    uTextureAtlasSettings: { value: [6] },
+    uTint: { value: [0, 0, 0, 0] },
+    uVertexScale: { value: [1] },
+    uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1638400, 1671168, -17248.099609375, 1] },
+    uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25, -25.5, 0.03770458698272705, 1] },
+    uViewportLookupScale: { value: [1638400, 17248, 1671168, 0] },
+    uViewportOffsetScale: { value: [1, 0, 0, 0] },
+    uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
+};
+
+const floorUniforms = {
+    uAmbientColour: { value: [0.6059895753860474, 0.5648590922355652, 0.5127604007720947] },
+    uAtlasMeta: { value: [512, 16, 0.0001220703125, 4] },
+    uCameraPosition: { value: [1638400, 17632, 1769472] },
+    uDummy: { value: [1] },
+    uFade: { value: [0] },
+    uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
+    uGridSize: { value: [512] },
+    uInscatteringAmount: { value: [1, 0, 0] },
+    uInvSunDirection: { value: [-0.5391638875007629, 0.6469966173171997, 0.5391638875007629] },//z flipped
+    uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1622015, 100, 1753087, 1] },
+    uOutscatteringAmount: { value: [1638400, 17632, 1769472] },
+    uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
+    uScatteringParameters: { value: [0, -1, 5.960465188081798e-8, 0] },
+    uScatteringTintColour: { value: [0, 5.960465188081798e-8, 1] },
+    uSunColour: { value: [0.8666666746139526, 0.8078431487083435, 0.7333333492279053] },
+    uTextureAtlasSettings: { value: [6] },
+    uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1638400, 1769472, -17632.10546875, 1] },
+    uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25, -27, 0.06151437759399414, 1] },
+    uViewportLookupScale: { value: [1638400, 17632, 1769472, 0] },
+    uViewportOffsetScale: { value: [1, 0, 0, 0] },
+    uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
+};
+
+const waterUniforms = {
+    uAmbientColour: { value: [1, 0, 0] },
+    uCameraPosition: { value: [1671168, 17344, 1638400] },
+    uDummy: { value: [0] },
+    uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
+    uInvSunDirection: { value: [1671168, 17344, -1638400] },//z flipped
+    uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1654783, 100, 1622015, 1] },
+    uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
+    uSunColour: { value: [0, 5.960465188081798e-8, 1] },
+    uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1671168, 1638400, -17344.09765625, 1] },
+    uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25.5, -25, 0.04365682601928711, 1] },
+    uViewportLookupScale: { value: [1671168, 17344, 1638400, 1.0947093356943706e+27] },
+    uViewportOffsetScale: { value: [1, 0, 0, 0] },
+    uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
+};
+
+const fixedTextureSettings = "void getTextureSettings(vec2 s, out TextureSettings settings){\n"
+    + "settings.textureMeta1 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] first texture, albedo x*uAtlasMeta.y*uAtlasMeta.z
+    + "settings.textureMeta2 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] second texture normals??
+    + "settings.uvAnim = vec2(0.0,0.0);\n"
+    + "settings.wrapping = 0.0;\n"
+    + "settings.specular = 0.0;\n"
+    + "settings.normalScale = 0.0;\n"
+    + "}\n"
+    + "void getTextureSettingsOld(";
+
+/**
+ * Returns the preprocessed vertex and fragment shader for a minimap material, defines
+ * can be toggled on or off compared to the original source. Atlas settings reads per material
+ * texture settings from a settings texture instead of using a single fixed texture
+ */
+export function getMinimapShader(kind: MinimapShaderKind, defines: Record<string, boolean> = {}, atlassettings = false) {
+    let programkey = `minimap-${kind}${atlassettings ? "-atlas" : ""}`;
+    for (let name of Object.keys(defines).sort()) {
+        programkey += `,${defines[name] ? "+" : "-"}${name}`;
+    }
+    let variant = shaderVariants.get(programkey);
+    if (!variant) {
+        let { vert, frag } = buildMinimapShader(kind, atlassettings);
+        vert = toggleDefines(vert, defines);
+        frag = toggleDefines(frag, defines);
+        variant = {
+            vertexShader: stripDuplicateIncludes(vert),
+            fragmentShader: stripDuplicateIncludes(frag),
+            programkey
+        };
+        shaderVariants.set(programkey, variant);
+    }
+    return variant;
+}
+
+function buildMinimapShader(kind: MinimapShaderKind, atlassettings: boolean) {
+    let vert: string;
+    let frag: string;
+    let defines = (kind == "loc" ? definereplaceloc : definereplace);
+    let inputs = (atlassettings ? inputreplaceatlas : inputreplace);
+    if (kind == "loc") {
+        vert = require("./minimap-loc-vert.glsl.c");
+        frag = require("./minimap-loc-frag.glsl.c");
+    } else if (kind == "floor") {
+        vert = require("./minimap-floor-vert.glsl.c");
+        frag = require("./minimap-floor-frag.glsl.c");
+    } else {
+        vert = require("./minimap-water-vert.glsl.c");
+        frag = require("./minimap-water-frag.glsl.c");
+    }
 
-    let vert: string = require("./minimap-loc-vert.glsl.c");
     vert = fixShader(vert);
-    vert = replaceUniforms(vert, inputreplace);
-    vert = replaceDefines(vert, definereplaceloc);
+    vert = replaceUniforms(vert, inputs);
+    vert = replaceDefines(vert, defines);
 
-    let frag: string = require("./minimap-loc-frag.glsl.c");
     frag = fixShader(frag);
-    frag = replaceUniforms(frag, inputreplace);
-    frag = replaceDefines(frag, definereplaceloc);
+    frag = replaceUniforms(frag, inputs);
+    frag = replaceDefines(frag, defines);
     frag = frag.replace(/#undef gl_FragColor/, "// $&");
-    frag = frag.replace(/void getTextureSettings\(/,
-        "void getTextureSettings(vec2 s, out TextureSettings settings){\n"
-        + "settings.textureMeta1 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] first texture, albedo x*uAtlasMeta.y*uAtlasMeta.z
-        + "settings.textureMeta2 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] second texture normals??
-        + "settings.uvAnim = vec2(0.0,0.0);\n"
-        + "settings.wrapping = 0.0;\n"
-        + "settings.specular = 0.0;\n"
-        + "settings.normalScale = 0.0;\n"
-        + "}\n"
-        + "void getTextureSettingsOld("
-    );
-
-    frag = frag.replace(/(?<!void )getTexel\(\w+,/gm, () => `getTexel(vTextureUV,`);
-
-    frag = wrapMain(frag, `
-        void main(){
-            super();
-            //pre-multiply alpha
-            // gl_FragColor.rgb *= gl_FragColor.a;
-            // gl_FragColor.rgb = vec3( gl_FragColor.a);
-            gl_FragColor.a=1.0;
-            
-        }
-    `);
+    if (!atlassettings) {
+        //single texture per material, ignore the settings texture
+        frag = frag.replace(/void getTextureSettings\(/, fixedTextureSettings);
+    }
+
+    if (kind == "loc") {
+        frag = frag.replace(/(?<!void )getTexel\(\w+,/gm, () => `getTexel(vTextureUV,`);
+
+        frag = wrapMain(frag, `
+            void main(){
+                super();
+                //pre-multiply alpha
+                // gl_FragColor.rgb *= gl_FragColor.a;
+                // gl_FragColor.rgb = vec3( gl_FragColor.a);
+                gl_FragColor.a=1.0;
+                
+            }
+        `);
+    } else {
+        //inject floor uv from mesh instead of derived from world position
+        let gettexelcount = 0;
+        frag = injectheader(frag, "in highp vec2 v_texcoord_0;\nin highp vec2 v_texcoord_1;\nin highp vec2 v_texcoord_2;");
+        vert = injectheader(vert, "in highp vec2 texcoord_0;\nin highp vec2 texcoord_1;\nin highp vec2 texcoord_2;");
+        vert = injectheader(vert, "out highp vec2 v_texcoord_0;\nout highp vec2 v_texcoord_1;\nout highp vec2 v_texcoord_2;");
+        vert = injectmain(vert, "v_texcoord_0=texcoord_0;\nv_texcoord_1=texcoord_1;\nv_texcoord_2=texcoord_2;\n");
+        frag = frag.replace(/(?<!void )getTexel\(\w+,/gm, () => `getTexel(v_texcoord_${gettexelcount++ % 3},`);
+    }
+    return { vert, frag };
+}
 
-    mat.vertexShader = vert;
-    mat.fragmentShader = frag;
+function applyShaderVariant(mat: ShaderMaterial, variant: ShaderVariant) {
+    mat.vertexShader = variant.vertexShader;
+    mat.fragmentShader = variant.fragmentShader;
+    mat.customProgramCacheKey = () => variant.programkey;
+}
 
-    mat.uniforms.uTextureAtlas = { value: texture };
-    mat.uniforms.uInvSunDirection.value[2] *= -1;//z flip
-    mat.uniforms.uAlphaTestThreshold = { value: [alphathreshold] };
+export function minimapLocMaterial(texture: Texture, alphamode: MaterialData["alphamode"], alphathreshold: number) {
+    let mat = new ShaderMaterial();
+    mat.uniforms = {
+        ...locUniforms,
+        uAlphaTestThreshold: { value: [alphathreshold] },
+        uTextureAtlas: { value: texture }
+    };
+    mat.vertexColors = true;
+
+    //alpha mode only affects blending state, alpha testing stays enabled in all variants
+    //since models use vertex alpha 0 to hide faces
+    applyShaderVariant(mat, getMinimapShader("loc"));
 
     mat.uniformsNeedUpdate = true;
     if (alphamode == "blend") {
@@ -130,136 +254,219 @@ export function minimapLocMaterial(texture: Texture, alphamode: MaterialData["al
 export function minimapFloorMaterial(texture: Texture) {
     let mat = new ShaderMaterial();
     mat.uniforms = {
-        uAmbientColour: { value: [0.6059895753860474, 0.5648590922355652, 0.5127604007720947] },
-        uAtlasMeta: { value: [512, 16, 0.0001220703125, 4] },
-        uCameraPosition: { value: [1638400, 17632, 1769472] },
-        uDummy: { value: [1] },
-        uFade: { value: [0] },
-        uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
-        uGridSize: { value: [512] },
-        uInscatteringAmount: { value: [1, 0, 0] },
-        uInvSunDirection: { value: [-0.5391638875007629, 0.6469966173171997, -0.5391638875007629] },
-        uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1622015, 100, 1753087, 1] },
-        uOutscatteringAmount: { value: [1638400, 17632, 1769472] },
-        uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
-        uScatteringParameters: { value: [0, -1, 5.960465188081798e-8, 0] },
-        uScatteringTintColour: { value: [0, 5.960465188081798e-8, 1] },
-        uSunColour: { value: [0.8666666746139526, 0.8078431487083435, 0.7333333492279053] },
-        uTextureAtlas: { value: [5] },
-        uTextureAtlasSettings: { value: [6] },
-        uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1638400, 1769472, -17632.10546875, 1] },
-        uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25, -27, 0.06151437759399414, 1] },
-        uViewportLookupScale: { value: [1638400, 17632, 1769472, 0] },
-        uViewportOffsetScale: { value: [1, 0, 0, 0] },
-        uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
+        ...floorUniforms,
+        uTextureAtlas: { value: texture }
     };
-
-
-
     mat.vertexColors = true;
 
-    let vert: string = require("./minimap-floor-vert.glsl.c");
-    vert = fixShader(vert);
-    vert = replaceUniforms(vert, inputreplace);
-    vert = replaceDefines(vert, definereplace);
-
-    let frag: string = require("./minimap-floor-frag.glsl.c");
-    frag = fixShader(frag);
-    frag = replaceUniforms(frag, inputreplace);
-    frag = replaceDefines(frag, definereplace);
-    frag = frag.replace(/#undef gl_FragColor/, "// $&");
-    frag = frag.replace(/void getTextureSettings\(/,
-        "void getTextureSettings(vec2 s, out TextureSettings settings){\n"
-        + "settings.textureMeta1 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] first texture, albedo x*uAtlasMeta.y*uAtlasMeta.z
-        + "settings.textureMeta2 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] second texture normals??
-        + "settings.uvAnim = vec2(0.0,0.0);\n"
-        + "settings.wrapping = 0.0;\n"
-        + "settings.specular = 0.0;\n"
-        + "settings.normalScale = 0.0;\n"
-        + "}\n"
-        + "void getTextureSettingsOld("
-    );
-
-    //inject floor uv from mesh instead of derived from world position
-    let gettexelcount = 0;
-    frag = injectheader(frag, "in highp vec2 v_texcoord_0;\nin highp vec2 v_texcoord_1;\nin highp vec2 v_texcoord_2;");
-    vert = injectheader(vert, "in highp vec2 texcoord_0;\nin highp vec2 texcoord_1;\nin highp vec2 texcoord_2;");
-    vert = injectheader(vert, "out highp vec2 v_texcoord_0;\nout highp vec2 v_texcoord_1;\nout highp vec2 v_texcoord_2;");
-    vert = injectmain(vert, "v_texcoord_0=texcoord_0;\nv_texcoord_1=texcoord_1;\nv_texcoord_2=texcoord_2;\n");
-    frag = frag.replace(/(?<!void )getTexel\(\w+,/gm, () => `getTexel(v_texcoord_${gettexelcount++ % 3},`);
-
-    mat.vertexShader = vert;
-    mat.fragmentShader = frag;
-
-    mat.uniforms.uTextureAtlas = { value: texture };
-    mat.uniforms.uInvSunDirection.value[2] *= -1;//z flip
+    applyShaderVariant(mat, getMinimapShader("floor"));
 
     mat.uniformsNeedUpdate = true;
 
     return mat;
 }
+
 export function minimapWaterMaterial(texture: Texture) {
     let mat = new ShaderMaterial();
-    mat.customProgramCacheKey = () => "water";
     mat.uniforms = {
-        uAmbientColour: { value: [1, 0, 0] },
-        uCameraPosition: { value: [1671168, 17344, 1638400] },
-        uDummy: { value: [0] },
-        uFullScreenLookupScale: { value: [0, 5.960465188081798e-8, 1, 0] },
-        uInvSunDirection: { value: [1671168, 17344, 1638400] },
-        uModelMatrix: { value: [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1654783, 100, 1622015, 1] },
-        uProjectionMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -0.0000152587890625, 0, 0, 0, 0, -0.00006200397183420137, 0, 0, 0, -1.0317461490631104, 1] },
-        uSunColour: { value: [0, 5.960465188081798e-8, 1] },
-        uViewMatrix: { value: [1, 0, 0, 0, 0, 5.960465188081798e-8, 1, 0, 0, -1, 5.960465188081798e-8, 0, -1671168, 1638400, -17344.09765625, 1] },
-        uViewProjMatrix: { value: [0.0000152587890625, 0, 0, 0, 0, -9.094948101931455e-13, -0.00006200397183420137, 0, 0, 0.0000152587890625, -3.695725149521767e-12, 0, -25.5, -25, 0.04365682601928711, 1] },
-        uViewportLookupScale: { value: [1671168, 17344, 1638400, 1.0947093356943706e+27] },
-        uViewportOffsetScale: { value: [1, 0, 0, 0] },
-        uZBufferParams: { value: [16777248, 32256, -32768, -512.0009765625] }
-    }
-
+        ...waterUniforms,
+        uTextureAtlas: { value: texture }
+    };
     mat.vertexColors = true;
 
-    let vert: string = require("./minimap-water-vert.glsl.c");
-    vert = fixShader(vert);
-    vert = replaceUniforms(vert, inputreplace);
-    vert = replaceDefines(vert, definereplace);
-
-    let frag: string = require("./minimap-water-frag.glsl.c");
-    frag = fixShader(frag);
-    frag = replaceUniforms(frag, inputreplace);
-    frag = replaceDefines(frag, definereplace);
-    frag = frag.replace(/#undef gl_FragColor/, "// $&");
-    frag = frag.replace(/void getTextureSettings\(/,
-        "void getTextureSettings(vec2 s, out TextureSettings settings){\n"
-        + "settings.textureMeta1 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] first texture, albedo x*uAtlasMeta.y*uAtlasMeta.z
-        + "settings.textureMeta2 = vec3(0.0,0.0,8196.0);\n"// [x,y,size] second texture normals??
-        + "settings.uvAnim = vec2(0.0,0.0);\n"
-        + "settings.wrapping = 0.0;\n"
-        + "settings.specular = 0.0;\n"
-        + "settings.normalScale = 0.0;\n"
-        + "}\n"
-        + "void getTextureSettingsOld("
-    );
-
-    //inject floor uv from mesh instead of derived from world position
-    let gettexelcount = 0;
-    frag = injectheader(frag, "in highp vec2 v_texcoord_0;\nin highp vec2 v_texcoord_1;\nin highp vec2 v_texcoord_2;");
-    vert = injectheader(vert, "in highp vec2 texcoord_0;\nin highp vec2 texcoord_1;\nin highp vec2 texcoord_2;");
-    vert = injectheader(vert, "out highp vec2 v_texcoord_0;\nout highp vec2 v_texcoord_1;\nout highp vec2 v_texcoord_2;");
-    vert = injectmain(vert, "v_texcoord_0=texcoord_0;\nv_texcoord_1=texcoord_1;\nv_texcoord_2=texcoord_2;\n");
-    frag = frag.replace(/(?<!void )getTexel\(\w+,/gm, () => `getTexel(v_texcoord_${gettexelcount++ % 3},`);
-
-    mat.vertexShader = vert;
-    mat.fragmentShader = frag;
-
-    mat.uniforms.uTextureAtlas = { value: texture };
-    mat.uniforms.uInvSunDirection.value[2] *= -1;//z flip
+    applyShaderVariant(mat, getMinimapShader("water"));
 
     mat.uniformsNeedUpdate = true;
 
     return mat;
 }
 
+export type MinimapAtlasEntry = {
+    //material slot in the settings texture
+    slotx: number,
+    sloty: number,
+    //position and size in the atlas, in units of MinimapLocAtlas.slotsize
+    atlasx: number,
+    atlasy: number,
+    atlassize: number,
+    matmeta: MaterialData
+}
+
+/**
+ * Packs the diffuse textures of multiple loc materials into a single texture and writes the
+ * per-material meta into a settings texture using the same layout the rs shader reads. This
+ * allows all locs in a chunk to share one program, texture and draw call per alpha mode.
+ */
+export class MinimapLocAtlas {
+    //atlas positions are stored in multiples of this
+    static readonly slotsize = 16;
+    //matches the MATERIAL_SETTINGS_* defines in the shader
+    static readonly settingsPixelsX = 3;
+    static readonly settingsPixelsY = 4;
+    static readonly settingsSlotsX = 42;
+    static readonly settingsSlotsY = 32;
+    static readonly settingsResolution = 128;
+    //positions are 9 bit and sizes 8 bit in slot units
+    static readonly maxAtlasSlots = 512;
+    static readonly maxTextureSlots = 255;
+
+    entries = new Map<number, MinimapAtlasEntry>();
+    atlasPixelSize = 0;
+    texture: DataTexture | null = null;
+    settings: DataTexture | null = null;
+    private pending = new Map<number, { matmeta: MaterialData, img: ImageData }>();
+    private materials = new Map<string, ShaderMaterial>();
+
+    get materialCount() {
+        return this.pending.size + this.entries.size;
+    }
+
+    addMaterial(matid: number, matmeta: MaterialData, img: ImageData) {
+        if (this.texture) { throw new Error("atlas is already built"); }
+        if (this.pending.size >= MinimapLocAtlas.settingsSlotsX * MinimapLocAtlas.settingsSlotsY) { return false; }
+        if (Math.ceil(Math.max(img.width, img.height) / MinimapLocAtlas.slotsize) > MinimapLocAtlas.maxTextureSlots) { return false; }
+        this.pending.set(matid, { matmeta, img });
+        return true;
+    }
+
+    /**
+     * Packs all added textures, returns false if they don't fit in the largest possible atlas
+     */
+    build() {
+        let items = [...this.pending].map(([matid, { matmeta, img }]) => ({
+            matid,
+            matmeta,
+            img,
+            size: Math.ceil(Math.max(img.width, img.height) / MinimapLocAtlas.slotsize)
+        }));
+        items.sort((a, b) => b.size - a.size);
+
+        //shelf pack, all textures are square so this is near optimal when sorted by size
+        let positions: { x: number, y: number }[] = [];
+        let atlasslots = 0;
+        for (let width = 32; width <= MinimapLocAtlas.maxAtlasSlots; width *= 2) {
+            positions = [];
+            let x = 0, y = 0, shelfheight = 0;
+            for (let item of items) {
+                if (x + item.size > width) {
+                    y += shelfheight;
+                    x = 0;
+                    shelfheight = 0;
+                }
+                positions.push({ x, y });
+                x += item.size;
+                shelfheight = Math.max(shelfheight, item.size);
+            }
+            if (y + shelfheight <= width) {
+                atlasslots = width;
+                break;
+            }
+        }
+        if (atlasslots == 0) { return false; }
+
+        const slotsize = MinimapLocAtlas.slotsize;
+        const settingsres = MinimapLocAtlas.settingsResolution;
+        this.atlasPixelSize = atlasslots * slotsize;
+        let pixels = new Uint8Array(this.atlasPixelSize * this.atlasPixelSize * 4);
+        let settings = new Uint8Array(settingsres * settingsres * 4);
+        for (let i = 0; i < items.length; i++) {
+            let item = items[i];
+            let pos = positions[i];
+            let entry: MinimapAtlasEntry = {
+                slotx: i % MinimapLocAtlas.settingsSlotsX,
+                sloty: Math.floor(i / MinimapLocAtlas.settingsSlotsX),
+                atlasx: pos.x,
+                atlasy: pos.y,
+                atlassize: item.size,
+                matmeta: item.matmeta
+            };
+            this.entries.set(item.matid, entry);
+
+            //nearest neighbour resample to the square slot size, most textures already match exactly
+            let img = item.img;
+            let dstsize = item.size * slotsize;
+            for (let y = 0; y < dstsize; y++) {
+                let srcy = Math.floor(y * img.height / dstsize);
+                let dstoffset = ((pos.y * slotsize + y) * this.atlasPixelSize + pos.x * slotsize) * 4;
+                for (let x = 0; x < dstsize; x++) {
+                    let srcoffset = (srcy * img.width + Math.floor(x * img.width / dstsize)) * 4;
+                    pixels[dstoffset++] = img.data[srcoffset + 0];
+                    pixels[dstoffset++] = img.data[srcoffset + 1];
+                    pixels[dstoffset++] = img.data[srcoffset + 2];
+                    pixels[dstoffset++] = img.data[srcoffset + 3];
+                }
+            }
+
+            let writepixel = (dx: number, dy: number, r: number, g: number, b: number, a: number) => {
+                let px = entry.slotx * MinimapLocAtlas.settingsPixelsX + dx;
+                let py = entry.sloty * MinimapLocAtlas.settingsPixelsY + dy;
+                let offset = (py * settingsres + px) * 4;
+                settings[offset + 0] = r;
+                settings[offset + 1] = g;
+                settings[offset + 2] = b;
+                settings[offset + 3] = a;
+            }
+            //bit 0,1 clamp u,v bit 2,3 repeat u,v, mirrored if neither
+            let wrapping = (item.matmeta.texmodes == "clamp" ? 1 : item.matmeta.texmodes == "repeat" ? 4 : 0)
+                | (item.matmeta.texmodet == "clamp" ? 2 : item.matmeta.texmodet == "repeat" ? 8 : 0);
+            //9th bits of the positions of both textures
+            let highbits = (pos.x >> 8) | ((pos.y >> 8) << 1) | ((pos.x >> 8) << 2) | ((pos.y >> 8) << 3);
+            //albedo and secondary texture position, there are no normal maps here so both point at albedo
+            writepixel(0, 0, pos.x & 0xff, pos.y & 0xff, pos.x & 0xff, pos.y & 0xff);
+            writepixel(2, 0, item.size, item.size, 0, wrapping);
+            //uv animation, stored as offset from 0x7fff
+            writepixel(0, 1, 0x7f, 0xff, 0x7f, 0xff);
+            writepixel(1, 2, 0, 0, 0, highbits);
+        }
+        this.pending.clear();
+
+        this.texture = new DataTexture(pixels, this.atlasPixelSize, this.atlasPixelSize, RGBAFormat);
+        this.texture.colorSpace = SRGBColorSpace;
+        this.texture.magFilter = LinearFilter;
+        //mips would bleed between textures, wrapping is done in the shader
+        this.texture.minFilter = LinearFilter;
+        this.texture.generateMipmaps = false;
+        this.texture.needsUpdate = true;
+
+        this.settings = new DataTexture(settings, settingsres, settingsres, RGBAFormat);
+        this.settings.magFilter = NearestFilter;
+        this.settings.minFilter = NearestFilter;
+        this.settings.generateMipmaps = false;
+        this.settings.needsUpdate = true;
+        return true;
+    }
+
+    getMaterial(alphamode: MaterialData["alphamode"], alphathreshold: number) {
+        if (!this.texture || !this.settings) { throw new Error("atlas not built"); }
+        let key = `${alphamode}-${alphathreshold}`;
+        let mat = this.materials.get(key);
+        if (!mat) {
+            mat = new ShaderMaterial();
+            mat.uniforms = {
+                ...locUniforms,
+                uAtlasMeta: { value: [this.atlasPixelSize / MinimapLocAtlas.slotsize, MinimapLocAtlas.slotsize, 1 / this.atlasPixelSize, 4] },
+                uAlphaTestThreshold: { value: [alphathreshold] },
+                uTextureAtlas: { value: this.texture },
+                uTextureAtlasSettings: { value: this.settings }
+            };
+            mat.vertexColors = true;
+            applyShaderVariant(mat, getMinimapShader("loc", {}, true));
+            mat.uniformsNeedUpdate = true;
+            if (alphamode == "blend") {
+                mat.transparent = true;
+            }
+            this.materials.set(key, mat);
+        }
+        return mat;
+    }
+
+    dispose() {
+        this.texture?.dispose();
+        this.settings?.dispose();
+        this.materials.forEach(q => q.dispose());
+    }
+}
+
 type InputReplacer = Record<string, string | string[] | (() => string | string[])>;
 
 function injectmain(source: string, injected: string) {
@@ -304,6 +511,65 @@ function wrapMain(source: string, newmain: string) {
     return source;
 }
 
+function toggleDefines(source: string, defines: Record<string, boolean>) {
+    for (let [name, enabled] of Object.entries(defines)) {
+        let regex = new RegExp(`^#define ${name}$`, "m");
+        if (!enabled) {
+            source = source.replace(regex, "// $&");
+        } else if (!regex.test(source)) {
+            source = injectheader(source, `#define ${name}`);
+        }
+    }
+    return source;
+}
+
+/**
+ * The shaders are dumped after the rs preprocessor ran, so every shared chunk (MATH_UTILS,
+ * CONVERSION_UTILS, PACK_UTILS etc) is pasted inline each time it was included. The repeats
+ * are dead code behind their include guard but still have to be parsed by the driver, so
+ * strip them here.
+ */
+function stripDuplicateIncludes(source: string) {
+    let lines = source.split("\n");
+    let seenguards = new Set<string>();
+    let output: string[] = [];
+    //true for every open #if block that is an include guard
+    let blocks: boolean[] = [];
+    let skipdepth = -1;
+    for (let i = 0; i < lines.length; i++) {
+        let line = lines[i].trim();
+        let isif = line.startsWith("#if");
+        let isendif = line.startsWith("#endif");
+        if (skipdepth != -1) {
+            if (isif) { blocks.push(false); }
+            if (isendif) {
+                blocks.pop();
+                if (blocks.length == skipdepth) { skipdepth = -1; }
+            }
+            continue;
+        }
+        let guard = line.match(/^#ifndef (\w+)$/);
+        if (guard && lines[i + 1]?.trim() == `#define ${guard[1]}`) {
+            if (seenguards.has(guard[1])) {
+                skipdepth = blocks.length;
+                blocks.push(true);
+                continue;
+            }
+            //only trust the guard if we know for sure the first copy is always compiled
+            if (blocks.every(q => q)) {
+                seenguards.add(guard[1]);
+            }
+            blocks.push(true);
+        } else if (isif) {
+            blocks.push(false);
+        } else if (isendif) {
+            blocks.pop();
+        }
+        output.push(lines[i]);
+    }
+    return output.join("\n");
+}
+
 function fixShader(source: string) {
     let header = [
         // `#version 300 es`,//highest version we can choose in webgl2
@@ -0,0 +1,87 @@
+import { cacheMajors, lastLegacyBuildnr } from "../constants";
+import { ScriptFS, ScriptOutput } from "../scriptrunner";
+import { CacheFileSource } from "../cache";
+import { compressionImplementations, legacyGzip } from "../cache/compression";
+import { crc32 } from "../libs/crc32util";
+import prettyJson from "json-stringify-pretty-compact";
+
+//groups of legacy builds are plain gzip files, keyed by the first byte of the gzip magic
+const legacyImplementations: typeof compressionImplementations = {
+	0x1f: {
+		gunzip: input => legacyGzip(input)
+	}
+};
+
+type BenchResult = { compression: number, impl: string, files: number, inbytes: number, outbytes: number, ms: number, mbps: number, error?: string };
+
+/**
+ * Times every available decompression implementation on raw groups of the given majors,
+ * the first implementation of each compression type is used as reference for the output, which
+ * is compared using the size and crc of every decompressed file
+ */
+export async function benchCompression(output: ScriptOutput, outdir: ScriptFS, source: CacheFileSource, majors: number[], maxfiles: number) {
+	let legacy = source.getBuildNr() <= lastLegacyBuildnr;
+	let implementations = (legacy ? legacyImplementations : compressionImplementations);
+	let samples = new Map<number, { raw: Buffer, key: Uint32Array | undefined }[]>();
+	for (let major of majors) {
+		if (legacy && major == 0) {
+			output.log("skipping major 0, it isn't compressed in legacy builds");
+			continue;
+		}
+		let index = await source.getCacheIndex(major);
+		let count = 0;
+		for (let entry of index) {
+			if (!entry) { continue; }
+			if (count++ >= maxfiles) { break; }
+			let raw = await source.getFileRaw(entry.major, entry.minor, entry.crc);
+			let list = samples.get(raw[0]);
+			if (!list) { samples.set(raw[0], list = []); }
+			//encrypted groups (mostly old mapsquares) need their xtea key
+			list.push({ raw, key: source.getXteaKey(entry.major, entry.minor) });
+		}
+		output.log(`loaded ${count} raw files from ${Object.entries(cacheMajors).find(q => q[1] == major)?.[0] ?? major}`);
+	}
+
+	let results: BenchResult[] = [];
+	for (let [compression, files] of samples) {
+		let impls = implementations[compression];
+		if (!impls) {
+			output.log(`no implementations for compression type ${compression}, skipped ${files.length} files`);
+			continue;
+		}
+		let inbytes = files.reduce((a, v) => a + v.raw.byteLength, 0);
+		let reference: { size: number, crc: number }[] | null = null;
+		for (let [impl, decode] of Object.entries(impls)) {
+			let checks: { size: number, crc: number }[] = [];
+			let outbytes = 0;
+			let error: string | undefined = undefined;
+			let ms = 0;
+			try {
+				for (let file of files) {
+					let t0 = performance.now();
+					let res = decode(file.raw, file.key);
+					ms += performance.now() - t0;
+					//checksum outside of the timed section
+					checks.push({ size: res.byteLength, crc: crc32(res) });
+					outbytes += res.byteLength;
+				}
+			} catch (e) {
+				error = e.message ?? String(e);
+			}
+			if (!error) {
+				if (!reference) {
+					reference = checks;
+				} else {
+					let mismatch = checks.findIndex((q, i) => q.size != reference![i].size || q.crc != reference![i].crc);
+					if (mismatch != -1) {
+						error = `output of file ${mismatch} differs from reference implementation`;
+					}
+				}
+			}
+			let mbps = (error ? 0 : +(outbytes / 1e3 / ms).toFixed(2));
+			results.push({ compression, impl, files: files.length, inbytes, outbytes, ms: Math.round(ms), mbps, error });
+			output.log(`compression ${compression} ${impl}: ${error ?? `${files.length} files, ${mbps}MB/s`}`);
+		}
+	}
+	await outdir.writeFile("benchcompression.json", prettyJson(results));
+}
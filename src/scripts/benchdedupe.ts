@@ -0,0 +1,110 @@
+import * as fs from "fs/promises";
+import * as os from "os";
+import * as path from "path";
+import { cacheMajors } from "../constants";
+import { ScriptFS, ScriptOutput } from "../scriptrunner";
+import { Openrs2CacheSource, openrs2GetEffectiveBuildnr, validOpenrs2Caches } from "../cache/openrs2loader";
+import { chunkHash, contentDefinedChunks, FileSourceFsCache } from "../cache/fscache";
+import { compressSqlite } from "../cache/compression";
+import prettyJson from "json-stringify-pretty-compact";
+
+type BuildResult = {
+	build: number,
+	openrs2id: number,
+	groups: number,
+	//decompressed bytes of this build
+	bytes: number,
+	//bytes a groupcache keyed by major/minor/crc adds for this build
+	newgroupbytes: number,
+	//bytes the chunk store adds for this build, before and after compressing the chunks
+	newchunkbytes: number,
+	newchunkcompressed: number,
+	chunkms: number,
+	//time to rebuild all groups of this build from the chunk store
+	rebuildms: number
+};
+
+/**
+ * Compares storing whole groups per crc with the content defined chunk store of the fs cache over
+ * a range of consecutive openrs2 builds, and measures how fast groups are rebuilt from the chunk store.
+ * The openrs2 sources use a fresh fs cache in the temp dir instead of the real one, otherwise reruns
+ * would only measure cache hits and fill the real cache with bench data.
+ */
+export async function benchDedupe(output: ScriptOutput, outdir: ScriptFS, buildcount: number, skip: number, majors: number[], maxfiles: number) {
+	let caches = (await validOpenrs2Caches()).slice(skip, skip + buildcount).reverse();
+	let benchfile = path.resolve(os.tmpdir(), "rsmv-benchdedupe.sqlite3");
+	await fs.rm(benchfile, { force: true });
+	let benchcache = new FileSourceFsCache(benchfile);
+	await benchcache.ready;
+	let knowngroups = new Set<string>();
+	let knownchunks = new Set<number>();
+	let results: BuildResult[] = [];
+	for (let meta of caches) {
+		if (output.state != "running") { break; }
+		let source = new Openrs2CacheSource(meta);
+		source.fscache = benchcache;
+		let res: BuildResult = { build: openrs2GetEffectiveBuildnr(meta), openrs2id: meta.id, groups: 0, bytes: 0, newgroupbytes: 0, newchunkbytes: 0, newchunkcompressed: 0, chunkms: 0, rebuildms: 0 };
+		let loaded: { major: number, minor: number, crc: number }[] = [];
+		for (let major of majors) {
+			let index = await source.getCacheIndex(major).catch(() => null);
+			if (!index) { continue; }
+			let count = 0;
+			for (let entry of index) {
+				if (!entry) { continue; }
+				if (count++ >= maxfiles) { break; }
+				let file = await source.getFile(entry.major, entry.minor, entry.crc);
+				loaded.push(entry);
+				res.groups++;
+				res.bytes += file.byteLength;
+				let groupkey = `${entry.major}.${entry.minor}.${entry.crc}`;
+				if (!knowngroups.has(groupkey)) {
+					knowngroups.add(groupkey);
+					res.newgroupbytes += file.byteLength;
+				}
+				let t = performance.now();
+				let start = 0;
+				for (let end of contentDefinedChunks(file)) {
+					let chunk = file.subarray(start, end);
+					let hash = chunkHash(chunk);
+					if (!knownchunks.has(hash)) {
+						knownchunks.add(hash);
+						res.newchunkbytes += chunk.byteLength;
+						res.newchunkcompressed += compressSqlite(chunk, "zlib").byteLength;
+					}
+					start = end;
+				}
+				res.chunkms += performance.now() - t;
+			}
+		}
+		res.chunkms = Math.round(res.chunkms);
+
+		//write everything first so the rebuild reads from sqlite instead of the pending writes
+		await benchcache.flush();
+		let t = performance.now();
+		for (let entry of loaded) {
+			let file = await benchcache.getDecodedFile(entry.major, entry.minor, entry.crc);
+			if (!file) { throw new Error(`group ${entry.major}.${entry.minor} could not be rebuilt from the chunk store`); }
+		}
+		res.rebuildms = Math.round(performance.now() - t);
+
+		results.push(res);
+		output.log(`build ${res.build}: ${res.groups} groups, ${(res.bytes / 1e6).toFixed(1)}mb, new groups ${(res.newgroupbytes / 1e6).toFixed(1)}mb, new chunks ${(res.newchunkbytes / 1e6).toFixed(1)}mb (${(res.newchunkcompressed / 1e6).toFixed(1)}mb compressed), chunking ${(res.bytes / 1e3 / Math.max(1, res.chunkms)).toFixed(0)}MB/s, rebuild ${(res.bytes / 1e3 / Math.max(1, res.rebuildms)).toFixed(0)}MB/s`);
+		source.close();
+	}
+	await benchcache.database.close();
+	await fs.rm(benchfile, { force: true });
+
+	let total = (key: keyof BuildResult) => results.reduce((a, v) => a + v[key], 0);
+	let summary = {
+		builds: results.length,
+		majors: majors.map(q => Object.entries(cacheMajors).find(w => w[1] == q)?.[0] ?? q),
+		bytes: total("bytes"),
+		groupstore: total("newgroupbytes"),
+		chunkstore: total("newchunkbytes"),
+		chunkstorecompressed: total("newchunkcompressed"),
+		chunkmbps: +(total("bytes") / 1e3 / Math.max(1, total("chunkms"))).toFixed(2),
+		rebuildmbps: +(total("bytes") / 1e3 / Math.max(1, total("rebuildms"))).toFixed(2)
+	};
+	output.log(`groups ${(summary.groupstore / 1e6).toFixed(1)}mb, chunks ${(summary.chunkstore / 1e6).toFixed(1)}mb, over ${summary.builds} builds`);
+	await outdir.writeFile("benchdedupe.json", prettyJson({ summary, results }));
+}
@@ -0,0 +1,52 @@
+import { ScriptFS, ScriptOutput } from "../scriptrunner";
+import { EngineCache } from "../3d/modeltothree";
+import { DependencyGraph } from "./dependencies";
+import { MapRect } from "../3d/mapsquare";
+import { packMapsquare } from "../utils";
+import prettyJson from "json-stringify-pretty-compact";
+
+function heapUsed() {
+	globalThis.gc?.();
+	return process.memoryUsage().heapUsed;
+}
+
+/**
+ * Measures build time and heap growth of the dependency graph including a full preloadChunkDependencies,
+ * run node with --expose-gc for stable memory numbers
+ */
+export async function benchDependencies(output: ScriptOutput, outdir: ScriptFS, engine: EngineCache, area: MapRect | undefined) {
+	if (!globalThis.gc) { output.log("gc not exposed, memory numbers include garbage"); }
+	let heapstart = heapUsed();
+
+	let t0 = performance.now();
+	let deps = await DependencyGraph.create(engine);
+	let createms = performance.now() - t0;
+	let createnodes = deps.nodeCount;
+	let createedges = deps.edgeCount;
+	let heapcreate = heapUsed();
+
+	let t1 = performance.now();
+	await deps.preloadChunkDependencies({ area });
+	let preloadms = performance.now() - t1;
+	let heappreload = heapUsed();
+
+	let rect = area ?? { x: 0, z: 0, xsize: 100, zsize: 200 };
+	let t2 = performance.now();
+	let hashed = 0;
+	for (let z = rect.z; z < rect.z + rect.zsize; z++) {
+		for (let x = rect.x; x < rect.x + rect.xsize; x++) {
+			if (!deps.hasEntry("mapsquare", packMapsquare(x, z))) { continue; }
+			deps.hashDependencies(deps.makeDeptName("mapsquare", packMapsquare(x, z)));
+			hashed++;
+		}
+	}
+	let hashms = performance.now() - t2;
+
+	let res = {
+		create: { ms: Math.round(createms), nodes: createnodes, edges: createedges, heapmb: +((heapcreate - heapstart) / 1e6).toFixed(1) },
+		preload: { ms: Math.round(preloadms), nodes: deps.nodeCount, edges: deps.edgeCount, heapmb: +((heappreload - heapstart) / 1e6).toFixed(1) },
+		hash: { ms: Math.round(hashms), mapsquares: hashed }
+	};
+	output.log(prettyJson(res));
+	await outdir.writeFile("benchdependencies.json", prettyJson(res));
+}
@@ -6,9 +6,10 @@ import { ScriptFS, ScriptOutput } from "../scriptrunner";
 import { ParsedTexture } from "../3d/materials/textures";
 import { parseSprite } from "../3d/materials/sprite";
 import { pixelsToImageFile } from "../imgutils";
-import { FileRange } from "../utils";
+import { FileRange, TaskLimiter } from "../utils";
 import { UiRenderContext, renderRsInterfaceHTML } from "./renderrsinterface";
 import { parseMusic } from "./musictrack";
+import { crc32 } from "../libs/crc32util";
 
 
 type FileAction = {
@@ -83,6 +84,11 @@ function defaultAction(major: number) {
 
 type CacheEditType = "add" | "delete" | "edit";
 
+//archive pairs that are loaded at the same time over all majors of a diff
+const diffFetchConcurrency = 16;
+//majors that are diffed at the same time by diffCaches
+const diffMajorConcurrency = 4;
+
 class Loadable {
 	source: CacheFileSource;
 	major: number;
@@ -138,7 +144,28 @@ export class FileEdit {
 	}
 }
 
-export async function compareCacheMajors(output: ScriptOutput, sourcea: CacheFileSource | null | undefined, sourceb: CacheFileSource | null | undefined, major: number, minorstart = 0, minorend = 1 << 30) {
+/**
+ * Compares the index tables of both caches, only the minors returned here have to be loaded
+ */
+export function changedIndexEntries(indexa: CacheIndexFile, indexb: CacheIndexFile, minorstart: number, minorend: number) {
+	let changed: number[] = [];
+	for (let i = minorstart; i < minorend; i++) {
+		let metaa = indexa[i], metab = indexb[i];
+		if (!metaa && !metab) { continue; }
+		if (!metaa || !metab || metaa.version != metab.version || metaa.crc != metab.crc) {
+			changed.push(i);
+		}
+	}
+	return changed;
+}
+
+/**
+ * Yields the edits of each changed minor in minor order. Minors that need a subfile compare are
+ * loaded ahead of the consumer, up to `readahead` per major and limiter.max across all majors.
+ * `failed` is set if the minor couldn't be loaded, its edits are empty then.
+ */
+export async function* streamCacheMajorDiff(output: ScriptOutput, sourcea: CacheFileSource | null | undefined, sourceb: CacheFileSource | null | undefined, major: number,
+	minorstart = 0, minorend = 1 << 30, limiter = new TaskLimiter(diffFetchConcurrency), readahead = 32) {
 	//sources can be empty, allow diffing to nothing
 	let indexa: CacheIndexFile = [];
 	let indexb: CacheIndexFile = [];
@@ -155,73 +182,166 @@ export async function compareCacheMajors(output: ScriptOutput, sourcea: CacheFil
 
 	let len = Math.max(indexa.length, indexb.length);
 
-	let changes: FileEdit[] = [];
 	let actionarg = majormap[major] ?? defaultAction(major);
-	// if (typeof actionarg == "function") {
-	// 	output.log(`checking major ${major}, different settings per minor`);
-	// } else {
-	// 	output.log(`checking major ${major} ${actionarg.name} subfiles:${actionarg.comparesubfiles}`);
-	// }
 
 	minorstart = Math.max(0, minorstart);
 	minorend = Math.min(len, minorend);
-	for (let i = minorstart; i < minorend; i++) {
-		if (output.state != "running") { break; }
-
-		var action = (typeof actionarg == "function" ? actionarg(major, i) ?? defaultAction(major) : actionarg);
 
+	let diffMinor = async (i: number): Promise<{ edits: FileEdit[], failed: boolean }> => {
+		let changes: FileEdit[] = [];
+		let action = (typeof actionarg == "function" ? actionarg(major, i) ?? defaultAction(major) : actionarg);
 		let metaa = indexa[i], metab = indexb[i];
-		if (metaa || metab) {
-			if (!metaa || !metab || metaa.version != metab.version) {
-				if (action.comparesubfiles) {
-					try {
-						var archa = (metaa && sourcea ? await sourcea.getFileArchive(metaa) : []);
-						var archb = (metab && sourceb ? await sourceb.getFileArchive(metab) : []);
-					} catch (e) {
-						output.log((e as Error).message);
-						continue;
-					}
-					for (let a = 0, b = 0; ;) {
-						let filea = archa[a], fileb = archb[b];
-						if (filea && (!fileb || filea.fileid < fileb.fileid)) {
-							a++;
-							changes.push(new FileEdit(action, "delete", metaa.major, metaa.minor, filea.fileid, filea.buffer, null));
-						} else if (fileb && (!filea || fileb.fileid < filea.fileid)) {
-							b++;
-							changes.push(new FileEdit(action, "add", metab.major, metab.minor, fileb.fileid, null, fileb.buffer));
-						} else if (filea && fileb && filea.fileid == fileb.fileid) {
-							if (Buffer.compare(filea.buffer, fileb.buffer) != 0) {
-								changes.push(new FileEdit(action, "edit", metaa.major, metaa.minor, filea.fileid, filea.buffer, fileb.buffer));
-							}
-							a++;
-							b++;
-						} else if (!filea && !fileb) {
-							break;
-						} else {
-							output.log(filea, fileb);
-							throw new Error("shouldnt happen");
-						}
+		if (action.comparesubfiles) {
+			try {
+				var [archa, archb] = await limiter.run(() => Promise.all([
+					(metaa && sourcea ? sourcea.getFileArchive(metaa) : []),
+					(metab && sourceb ? sourceb.getFileArchive(metab) : [])
+				]));
+			} catch (e) {
+				output.log((e as Error).message);
+				return { edits: changes, failed: true };
+			}
+			for (let a = 0, b = 0; ;) {
+				let filea = archa[a], fileb = archb[b];
+				if (filea && (!fileb || filea.fileid < fileb.fileid)) {
+					a++;
+					changes.push(new FileEdit(action, "delete", metaa.major, metaa.minor, filea.fileid, filea.buffer, null));
+				} else if (fileb && (!filea || fileb.fileid < filea.fileid)) {
+					b++;
+					changes.push(new FileEdit(action, "add", metab.major, metab.minor, fileb.fileid, null, fileb.buffer));
+				} else if (filea && fileb && filea.fileid == fileb.fileid) {
+					if (Buffer.compare(filea.buffer, fileb.buffer) != 0) {
+						changes.push(new FileEdit(action, "edit", metaa.major, metaa.minor, filea.fileid, filea.buffer, fileb.buffer));
 					}
+					a++;
+					b++;
+				} else if (!filea && !fileb) {
+					break;
 				} else {
-					if (!metaa) {
-						let file = (!sourceb ? null : new Loadable(sourceb, metab.major, metab.minor, metab.crc));
-						changes.push(new FileEdit(action, "add", metab.major, metab.minor, -1, null, file));
-					} else if (!metab) {
-						let file = (!sourcea ? null : new Loadable(sourcea, metaa.major, metaa.minor, metaa.crc));
-						changes.push(new FileEdit(action, "delete", metaa.major, metaa.minor, -1, file, null));
-					} else {
-						let before = (!sourcea ? null : new Loadable(sourcea, metaa.major, metaa.minor, metaa.crc));
-						let after = (!sourceb ? null : new Loadable(sourceb, metab.major, metab.minor, metab.crc));
-						changes.push(new FileEdit(action, "add", metaa.major, metaa.minor, -1, before, after));
-					}
+					output.log(filea, fileb);
+					throw new Error("shouldnt happen");
 				}
 			}
+		} else {
+			if (!metaa) {
+				let file = (!sourceb ? null : new Loadable(sourceb, metab.major, metab.minor, metab.crc));
+				changes.push(new FileEdit(action, "add", metab.major, metab.minor, -1, null, file));
+			} else if (!metab) {
+				let file = (!sourcea ? null : new Loadable(sourcea, metaa.major, metaa.minor, metaa.crc));
+				changes.push(new FileEdit(action, "delete", metaa.major, metaa.minor, -1, file, null));
+			} else {
+				let before = (!sourcea ? null : new Loadable(sourcea, metaa.major, metaa.minor, metaa.crc));
+				let after = (!sourceb ? null : new Loadable(sourceb, metab.major, metab.minor, metab.crc));
+				changes.push(new FileEdit(action, "add", metaa.major, metaa.minor, -1, before, after));
+			}
+		}
+		return { edits: changes, failed: false };
+	}
+
+	let changed = changedIndexEntries(indexa, indexb, minorstart, minorend);
+	let pending: Promise<{ edits: FileEdit[], failed: boolean }>[] = [];
+	let next = 0;
+	while (next < changed.length || pending.length != 0) {
+		if (output.state != "running") { break; }
+		while (next < changed.length && pending.length < readahead) {
+			let prom = diffMinor(changed[next++]);
+			//prevent unhandled rejections if the consumer stops early
+			prom.catch(() => { });
+			pending.push(prom);
 		}
+		let minor = changed[next - pending.length];
+		yield { minor, ...await pending.shift()! };
+	}
+}
+
+export async function compareCacheMajors(output: ScriptOutput, sourcea: CacheFileSource | null | undefined, sourceb: CacheFileSource | null | undefined, major: number, minorstart = 0, minorend = 1 << 30) {
+	let changes: FileEdit[] = [];
+	for await (let { edits } of streamCacheMajorDiff(output, sourcea, sourceb, major, minorstart, minorend)) {
+		changes.push(...edits);
 	}
 	return changes;
 }
 
-export async function diffCaches(output: ScriptOutput, outdir: ScriptFS, sourcea: CacheFileSource, sourceb: CacheFileSource, ranges: FileRange[]) {
+async function writeChangeFiles(outdir: ScriptFS, change: FileEdit, sourcea: CacheFileSource, sourceb: CacheFileSource) {
+	let name = change.action.getFileName(change.major, change.minor, change.subfile);
+	let dir = `${change.action.name}`;
+
+	await outdir.mkDir(dir);
+	let before = await change.getBefore();
+	let after = await change.getAfter();
+	let addfile = async (ext: string, isafter: boolean, data: string | Buffer) => {
+		await outdir.writeFile(`${dir}/${name}-${isafter ? "after" : "before"}.${ext}`, data);
+	}
+	if (change.action.outputType == "json") {
+		if (before) {
+			await addfile("json", false, prettyJson(change.action.parser.read(before, sourcea)));
+		}
+		if (after) {
+			await addfile("json", true, prettyJson(change.action.parser.read(after, sourceb)));
+		}
+	} else if (change.action.outputType == "bin" || change.action.outputType == "rstex") {
+		if (before) {
+			await addfile(change.action.outputType, false, before);
+		}
+		if (after) {
+			await addfile(change.action.outputType, true, after);
+		}
+	} else if (change.action.outputType == "png") {
+		if (before) {
+			let tex = (change.major == cacheMajors.sprites ? parseSprite(before)[0].img : await new ParsedTexture(before, false, false).toImageData(0));
+			await addfile("png", false, await pixelsToImageFile(tex, "png", 1));
+		}
+		if (after) {
+			let tex = (change.major == cacheMajors.sprites ? parseSprite(after)[0].img : await new ParsedTexture(after, false, false).toImageData(0));
+			await addfile("png", true, await pixelsToImageFile(tex, "png", 1));
+		}
+	} else if (change.action.outputType == "html") {
+		//TODO make standardised way to deal with different decoder types
+		if (before) {
+			let iface = await renderRsInterfaceHTML(new UiRenderContext(sourcea), change.minor);
+			await addfile("html", false, iface);
+		}
+		if (after) {
+			let iface = await renderRsInterfaceHTML(new UiRenderContext(sourceb), change.minor);
+			await addfile("html", true, iface);
+		}
+	} else if (change.action.outputType == "ogg") { 
+		if (before) { 
+			let sound = await parseMusic(sourcea, change.major, change.minor, null, false);
+			await addfile("ogg", false, sound);
+		}
+		if (after) { 
+			let sound = await parseMusic(sourceb, change.major, change.minor, null, false);
+			await addfile("ogg", true, sound);
+		}
+	}
+}
+
+type DiffCheckpoint = {
+	version: 1,
+	//crcs of the root index of both caches and the diffed ranges, a checkpoint only applies to the same diff
+	cachea: number,
+	cacheb: number,
+	ranges: string,
+	//first minor of each major that hasn't been written yet, -1 once the major is done
+	majors: Record<number, number>
+}
+
+function rootIndexHash(root: CacheIndexFile) {
+	let values = new Uint32Array(root.length * 2);
+	root.forEach((q, i) => {
+		values[i * 2] = q?.crc ?? 0;
+		values[i * 2 + 1] = q?.version ?? 0;
+	});
+	return crc32(new Uint8Array(values.buffer));
+}
+
+/**
+ * Diffs all majors of two caches and writes the changed files to outdir as they are found. Several majors
+ * are diffed at once, progress is stored in a checkpoint file so an interrupted diff into the same
+ * directory continues where it stopped. The checkpoint is removed once the diff completes.
+ */
+export async function diffCaches(output: ScriptOutput, outdir: ScriptFS, sourcea: CacheFileSource, sourceb: CacheFileSource, ranges: FileRange[], checkpointfile = "diff-checkpoint.json") {
 	let majors: number[] = [];
 	let roota = await sourcea.getCacheIndex(cacheMajors.index);
 	let rootb = await sourceb.getCacheIndex(cacheMajors.index);
@@ -233,71 +353,75 @@ export async function diffCaches(output: ScriptOutput, outdir: ScriptFS, sourcea
 		if (roota[i] && rootb[i]) { majors.push(i); }
 	}
 
-	let changes: FileEdit[] = [];
+	let checkpoint: DiffCheckpoint = { version: 1, cachea: rootIndexHash(roota), cacheb: rootIndexHash(rootb), ranges: JSON.stringify(ranges), majors: {} };
+	try {
+		let prev: DiffCheckpoint = JSON.parse(await outdir.readFileText(checkpointfile));
+		if (prev.version == checkpoint.version && prev.cachea == checkpoint.cachea && prev.cacheb == checkpoint.cacheb && prev.ranges == checkpoint.ranges) {
+			checkpoint.majors = prev.majors;
+			output.log(`resuming diff from ${checkpointfile}`);
+		}
+	} catch (e) { }
+	//writes are chained so concurrent majors don't write the file at the same time
+	let lastsave = 0;
+	let savequeue = Promise.resolve();
+	let saveCheckpoint = (force: boolean) => {
+		if (!force && Date.now() - lastsave < 2000) { return; }
+		lastsave = Date.now();
+		let data = JSON.stringify(checkpoint);
+		savequeue = savequeue.then(() => outdir.writeFile(checkpointfile, data));
+	}
 
-	for (let major of majors) {
-		if (output.state != "running") { break; }
+	let changes: FileEdit[] = [];
+	//shared so the amount of archive pairs in flight is bounded over all majors
+	let limiter = new TaskLimiter(diffFetchConcurrency);
+	//set once any major fails to write, the other majors stop at their next minor
+	let failure = { failed: false, error: null as unknown };
+	let incomplete = false;
+	let diffMajor = async (major: number) => {
+		let progress = checkpoint.majors[major] ?? 0;
+		if (progress == -1) { return; }
 		let matchedrange = ranges.find(q => q.start[1] <= major && q.end[0] >= major);
-		let newchanges = await compareCacheMajors(output, sourcea, sourceb, major, matchedrange?.start[1], matchedrange?.end[1]);
-		changes.push(...newchanges);
-
-		for (let change of newchanges) {
-			let name = change.action.getFileName(change.major, change.minor, change.subfile);
-			let dir = `${change.action.name}`;
-
-			await outdir.mkDir(dir);
-			let before = await change.getBefore();
-			let after = await change.getAfter();
-			let addfile = async (ext: string, isafter: boolean, data: string | Buffer) => {
-				await outdir.writeFile(`${dir}/${name}-${isafter ? "after" : "before"}.${ext}`, data);
+		let minorstart = Math.max(matchedrange?.start[1] ?? 0, progress);
+		//the checkpoint stays before the first minor that failed to load so a rerun retries it
+		let stalled = false;
+		for await (let { minor, edits, failed } of streamCacheMajorDiff(output, sourcea, sourceb, major, minorstart, matchedrange?.end[1], limiter)) {
+			if (failure.failed) { return; }
+			changes.push(...edits);
+			for (let change of edits) {
+				await writeChangeFiles(outdir, change, sourcea, sourceb);
 			}
-			if (change.action.outputType == "json") {
-				if (before) {
-					await addfile("json", false, prettyJson(change.action.parser.read(before, sourcea)));
-				}
-				if (after) {
-					await addfile("json", true, prettyJson(change.action.parser.read(after, sourceb)));
-				}
-			} else if (change.action.outputType == "bin" || change.action.outputType == "rstex") {
-				if (before) {
-					await addfile(change.action.outputType, false, before);
-				}
-				if (after) {
-					await addfile(change.action.outputType, true, after);
-				}
-			} else if (change.action.outputType == "png") {
-				if (before) {
-					let tex = (change.major == cacheMajors.sprites ? parseSprite(before)[0].img : await new ParsedTexture(before, false, false).toImageData(0));
-					await addfile("png", false, await pixelsToImageFile(tex, "png", 1));
-				}
-				if (after) {
-					let tex = (change.major == cacheMajors.sprites ? parseSprite(after)[0].img : await new ParsedTexture(after, false, false).toImageData(0));
-					await addfile("png", true, await pixelsToImageFile(tex, "png", 1));
-				}
-			} else if (change.action.outputType == "html") {
-				//TODO make standardised way to deal with different decoder types
-				if (before) {
-					let iface = await renderRsInterfaceHTML(new UiRenderContext(sourcea), change.minor);
-					await addfile("html", false, iface);
-				}
-				if (after) {
-					let iface = await renderRsInterfaceHTML(new UiRenderContext(sourceb), change.minor);
-					await addfile("html", true, iface);
-				}
-			} else if (change.action.outputType == "ogg") { 
-				if (before) { 
-					let sound = await parseMusic(sourcea, change.major, change.minor, null, false);
-					await addfile("ogg", false, sound);
-				}
-				if (after) { 
-					let sound = await parseMusic(sourceb, change.major, change.minor, null, false);
-					await addfile("ogg", true, sound);
-				}
+			if (failed) { stalled = true; }
+			if (!stalled) {
+				checkpoint.majors[major] = minor + 1;
+				saveCheckpoint(false);
 			}
 		}
+		if (stalled) {
+			output.log(`major ${major} has minors that failed to load, rerun the diff to retry them`);
+			incomplete = true;
+		} else if (output.state == "running") {
+			checkpoint.majors[major] = -1;
+			saveCheckpoint(true);
+		}
 	}
 
+	let queue = majors.slice();
+	await Promise.all(Array.from({ length: diffMajorConcurrency }, async () => {
+		while (queue.length != 0 && output.state == "running" && !failure.failed) {
+			await diffMajor(queue.shift()!).catch(e => {
+				if (!failure.failed) { failure = { failed: true, error: e }; }
+			});
+		}
+	}));
+	saveCheckpoint(true);
+	await savequeue;
+	if (failure.failed) { throw failure.error; }
+	if (output.state == "running" && !incomplete) {
+		await outdir.unlink(checkpointfile).catch(() => { });
+	}
+
+	//majors finish out of order, the sort is stable so minors stay in order
+	changes.sort((a, b) => a.major - b.major);
 	output.log("done", changes.length, "total changes");
 	return changes;
 }
-
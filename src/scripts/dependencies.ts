@@ -2,16 +2,20 @@
 // import { run, command, number, option, string, boolean, Type, flag, oneOf } from "cmd-ts";
 import { cacheConfigPages, cacheMajors, cacheMapFiles, lastLegacyBuildnr } from "../constants";
 import { parse } from "../parser/jsondecoders";
-import { archiveToFileId, mappedFileIds, oldConfigMaps } from "../cache";
+import { archiveToFileId, CacheFileSource, CacheIndex, getCacheVersionFingerprint, mappedFileIds, oldConfigMaps } from "../cache";
 import { ChunkData, defaultMorphId, getMapsquareData, MapRect } from "../3d/mapsquare";
 import { convertMaterial } from "../3d/materials/jmat";
-import { crc32, crc32addInt } from "../libs/crc32util";
+import { crc32, crc32addInt, crc32combine, crc32multmod, crc32shift } from "../libs/crc32util";
 import { arrayEnum, trickleTasksTwoStep, trickleTasks, packMapsquare } from "../utils";
 import { EngineCache } from "../3d/modeltothree";
 import { legacyMajors, legacyGroups } from "../cache/legacycache";
 import { mapsquare_overlays } from "../../generated/mapsquare_overlays";
 import { mapsquare_underlays } from "../../generated/mapsquare_underlays";
 import { locs } from "../../generated/locs";
+import { DependencySnapshot, dependencySnapshotFile, readDependencySnapshot, writeDependencySnapshot } from "./dependencysnapshot";
+import { collectTransferables, WorkerPool } from "../libs/workerpool";
+import type { DependencyWorkerPacket } from "./dependencyworker";
+import { Worker as NodeWorker } from "worker_threads";
 
 export const depClasses = arrayEnum(["material", "model", "item", "loc", "mapsquare", "sequence", "skeleton", "frameset", "animgroup", "npc", "framebase", "texture", "enum", "overlay", "underlay"]);
 const depidmap = Object.fromEntries(depClasses.map((q, i) => [q, i]));
@@ -24,7 +28,7 @@ export type DepMeta = {
 	treehash: number
 }
 
-type DepArgs = { area?: MapRect } | undefined;
+type DepArgs = { area?: MapRect, skipSquare?: (squareindex: number) => boolean } | undefined;
 type DepCallback = (holdertype: DepTypes, holderId: number, deptType: DepTypes, depId: number) => void;
 type HashCallback = (depType: DepTypes, depId: number, hash: number, version: number) => void;
 type DepCollector = (cache: EngineCache, addDep: DepCallback, addHash: HashCallback, args: DepArgs) => Promise<void>;
@@ -43,27 +47,205 @@ async function* iterateConfigFiles(cache: EngineCache, major: number) {
 		let arch = await cache.getArchiveById(cacheMajors.config, oldConfigMaps[major]);
 		yield* arch.map(q => ({ id: q.fileid, file: q.buffer }));
 	} else {
-		let locindices = await cache.getCacheIndex(major);
 		let stride = mappedFileIds[major];
-		for (let index of locindices) {
-			if (!index) { continue; }
-			let arch = await cache.getFileArchive(index);
+		for await (let { index, files: arch, error } of cache.streamArchives(major)) {
+			if (error) { throw error; }
 			yield* arch.map(q => ({ id: index.minor * stride + q.fileid, file: q.buffer }));
 		}
 	}
 }
 
+//shards of files that are decoded on the worker pool, the archives themselves are still read on the main thread
+export type DepShardKind = "locs" | "items" | "npcs" | "materials" | "mapsquares";
+export type DependencyWorkerResult = {
+	//packed holder and dependency key pairs, in the order the collector added them
+	deps: Float64Array,
+	//packed key and hash pairs
+	hashes: Float64Array
+}
+
+//about the amount of config data a worker decodes in ~50ms
+const shardBytes = 512 * 1024;
+
+/**
+ * Shard jobs that are still running on the pool. Failures are caught as soon as the job is added so an
+ * early worker error can't become an unhandled rejection before finish is awaited, the first error is
+ * rethrown by the next add or by finish
+ */
+class DepShardJobs {
+	private jobs: Promise<void>[] = [];
+	private failed = false;
+	private error: unknown = null;
+	add(job: Promise<void>) {
+		this.throwIfFailed();
+		this.jobs.push(job.catch(e => {
+			if (!this.failed) {
+				this.failed = true;
+				this.error = e;
+			}
+		}));
+	}
+	private throwIfFailed() {
+		if (this.failed) { throw this.error; }
+	}
+	async finish() {
+		await Promise.all(this.jobs);
+		this.throwIfFailed();
+	}
+}
+
+class DepShardBatch {
+	kind: DepShardKind;
+	ids: number[] = [];
+	hashes: number[] = [];
+	versions: number[] = [];
+	files: (Uint8Array | null)[] = [];
+	bytes = 0;
+	constructor(kind: DepShardKind) {
+		this.kind = kind;
+	}
+	add(id: number, hash: number, version: number, files: (Uint8Array | null)[]) {
+		this.ids.push(id);
+		this.hashes.push(hash);
+		this.versions.push(version);
+		for (let file of files) {
+			this.files.push(file);
+			this.bytes += file?.byteLength ?? 0;
+		}
+	}
+	//concatenates all files into one buffer so the packet can be transferred instead of cloned
+	toPacket(buildnr: number): DependencyWorkerPacket {
+		let files = new Uint8Array(this.bytes);
+		let fileoffsets = new Int32Array(this.files.length + 1);
+		let offset = 0;
+		for (let i = 0; i < this.files.length; i++) {
+			fileoffsets[i] = offset;
+			let file = this.files[i];
+			if (file) {
+				files.set(file, offset);
+				offset += file.byteLength;
+			}
+		}
+		fileoffsets[this.files.length] = offset;
+		return {
+			kind: this.kind,
+			buildnr,
+			ids: new Int32Array(this.ids),
+			hashes: new Int32Array(this.hashes),
+			versions: new Int32Array(this.versions),
+			fileoffsets,
+			files
+		};
+	}
+}
+
+let dependencyPool: WorkerPool<DependencyWorkerPacket> | null | undefined = undefined;
+function getDependencyPool() {
+	if (dependencyPool === undefined) {
+		dependencyPool = null;
+		try {
+			if (typeof process != "undefined" && process.versions?.node) {
+				dependencyPool = new WorkerPool(() => new NodeWorker(new URL("./dependencyworker.ts", import.meta.url)));
+			} else if (typeof Worker != "undefined") {
+				dependencyPool = new WorkerPool(() => new Worker(new URL("./dependencyworker.ts", import.meta.url)));
+			}
+		} catch (e) {
+			console.log("can't start dependency workers, collecting on main thread", e);
+		}
+	}
+	return dependencyPool;
+}
+
+/**
+ * Worker side of a shard, uses the same per file collectors as the main thread and returns the
+ * edges as typed arrays
+ */
+export function collectDependencyShard(packet: DependencyWorkerPacket, source: CacheFileSource): DependencyWorkerResult {
+	let deps: number[] = [];
+	let hashes: number[] = [];
+	let addDep: DepCallback = (holdertype, holderId, deptType, depId) => deps.push(packDepKey(holdertype, holderId), packDepKey(deptType, depId));
+	let addHash: HashCallback = (depType, depId, hash) => hashes.push(packDepKey(depType, depId), hash);
+	let getFile = (index: number) => {
+		let start = packet.fileoffsets[index];
+		return Buffer.from(packet.files.buffer, packet.files.byteOffset + start, packet.fileoffsets[index + 1] - start);
+	}
+	for (let i = 0; i < packet.ids.length; i++) {
+		if (packet.kind == "mapsquares") {
+			let tiles = parse.mapsquareTiles.read(getFile(i * 2), source).tiles;
+			let locsfile = getFile(i * 2 + 1);
+			let rawlocs = (locsfile.byteLength == 0 ? [] : parse.mapsquareLocations.read(locsfile, source).locations);
+			squareDeps(packet.ids[i], packet.hashes[i], packet.versions[i], rawlocs, tiles, addDep, addHash);
+		} else {
+			configFileDeps(packet.kind, packet.ids[i], getFile(i), source, addDep, addHash);
+		}
+	}
+	return { deps: new Float64Array(deps), hashes: new Float64Array(hashes) };
+}
+
+function mergeDependencyShard(res: DependencyWorkerResult, addDep: DepCallback, addHash: HashCallback) {
+	for (let i = 0; i < res.deps.length; i += 2) {
+		let holder = unpackDepKey(res.deps[i]);
+		let dep = unpackDepKey(res.deps[i + 1]);
+		addDep(holder.type, holder.id, dep.type, dep.id);
+	}
+	for (let i = 0; i < res.hashes.length; i += 2) {
+		let node = unpackDepKey(res.hashes[i]);
+		addHash(node.type, node.id, res.hashes[i + 1], 0);
+	}
+}
+
+function configFileDeps(kind: DepShardKind, id: number, file: Buffer, source: CacheFileSource, addDep: DepCallback, addHash: HashCallback) {
+	switch (kind) {
+		case "locs": return locFileDeps(id, file, source, addDep, addHash);
+		case "items": return itemFileDeps(id, file, source, addDep, addHash);
+		case "npcs": return npcFileDeps(id, file, source, addDep, addHash);
+		case "materials": return materialFileDeps(id, file, source, addDep, addHash);
+		default: throw new Error(`can't collect ${kind} as config files`);
+	}
+}
+
+/**
+ * Runs the per file collector over all files on the worker pool. Edges of a holder always come from
+ * a single file so merging shards in completion order keeps the child order of every node
+ */
+async function shardedFileDeps(cache: EngineCache, kind: DepShardKind, files: AsyncIterable<{ id: number, file: Buffer }> | Iterable<{ id: number, file: Buffer }>, addDep: DepCallback, addHash: HashCallback) {
+	let pool = getDependencyPool();
+	if (!pool) {
+		for await (let { id, file } of files) {
+			configFileDeps(kind, id, file, cache, addDep, addHash);
+		}
+		return;
+	}
+	let jobs = new DepShardJobs();
+	let batch = new DepShardBatch(kind);
+	let flush = () => {
+		let packet = batch.toPacket(cache.getBuildNr());
+		batch = new DepShardBatch(kind);
+		jobs.add(pool!.call<DependencyWorkerResult>(packet, collectTransferables(packet)).then(res => mergeDependencyShard(res, addDep, addHash)));
+	}
+	for await (let { id, file } of files) {
+		batch.add(id, 0, 0, [file]);
+		if (batch.bytes >= shardBytes) { flush(); }
+	}
+	if (batch.ids.length != 0) { flush(); }
+	await jobs.finish();
+}
+
 function chunkDeps(data: ChunkData, addDep: DepCallback, addHash: HashCallback) {
 	let squareindex = packMapsquare(data.mapsquarex, data.mapsquarez);
-	addHash("mapsquare", squareindex, data.chunkfilehash, data.chunkfileversion);
-	for (let loc of data.rawlocs) {
+	squareDeps(squareindex, data.chunkfilehash, data.chunkfileversion, data.rawlocs, data.tiles, addDep, addHash);
+}
+
+function squareDeps(squareindex: number, filehash: number, fileversion: number, rawlocs: { id: number }[], tiles: { overlay?: number | null, underlay?: number | null }[], addDep: DepCallback, addHash: HashCallback) {
+	addHash("mapsquare", squareindex, filehash, fileversion);
+	for (let loc of rawlocs) {
 		addDep("loc", loc.id, "mapsquare", squareindex);
 	}
 
 	//batch these before adding for performance
 	let overlays = new Set<number>();
 	let underlays = new Set<number>();
-	for (let tile of data.tiles) {
+	for (let tile of tiles) {
 		if (tile.overlay != null) { overlays.add(tile.overlay); }
 		if (tile.underlay != null) { underlays.add(tile.underlay); }
 	}
@@ -72,11 +254,49 @@ function chunkDeps(data: ChunkData, addDep: DepCallback, addHash: HashCallback)
 	underlays.forEach(id => addDep("underlay", id, "mapsquare", squareindex));
 }
 
+//from this build on each square is one group with the tiles and locs as subfiles, which can be sent to workers
+const shardedMapsquareBuild = 759;
+
 const mapsquareDeps2: DepCollector = async (cache, addDep, addHash, args) => {
+	let pool = (cache.getBuildNr() >= shardedMapsquareBuild ? getDependencyPool() : null);
+	if (pool) {
+		let rect = args?.area ?? { x: 0, z: 0, xsize: 100, zsize: 200 };
+		let mapindex = await cache.getCacheIndex(cacheMajors.mapsquares);
+		let entries: CacheIndex[] = [];
+		for (let z = rect.z; z < rect.z + rect.zsize; z++) {
+			for (let x = rect.x; x < rect.x + rect.xsize; x++) {
+				let squareindex = packMapsquare(x, z);
+				if (args?.skipSquare?.(squareindex)) { continue; }
+				if (mapindex[squareindex]) { entries.push(mapindex[squareindex]); }
+			}
+		}
+		let jobs = new DepShardJobs();
+		let batch = new DepShardBatch("mapsquares");
+		let flush = () => {
+			let packet = batch.toPacket(cache.getBuildNr());
+			batch = new DepShardBatch("mapsquares");
+			jobs.add(pool!.call<DependencyWorkerResult>(packet, collectTransferables(packet)).then(res => mergeDependencyShard(res, addDep, addHash)));
+		}
+		await trickleTasksTwoStep(20, function* () {
+			for (let entry of entries) {
+				yield cache.getFileArchive(entry).then(arch => ({ entry, arch }));
+			}
+		}, ({ entry, arch }) => {
+			let tileindex = entry.subindices.indexOf(cacheMapFiles.squares);
+			if (tileindex == -1) { return; }
+			let locsindex = entry.subindices.indexOf(cacheMapFiles.locations);
+			batch.add(entry.minor, entry.crc, entry.version, [arch[tileindex].buffer, (locsindex == -1 ? null : arch[locsindex].buffer)]);
+			if (batch.bytes >= shardBytes) { flush(); }
+		});
+		if (batch.ids.length != 0) { flush(); }
+		await jobs.finish();
+		return;
+	}
 	await trickleTasksTwoStep(20, function* () {
 		let rect = args?.area ?? { x: 0, z: 0, xsize: 100, zsize: 200 };
 		for (let z = rect.z; z < rect.z + rect.zsize; z++) {
 			for (let x = rect.x; x < rect.x + rect.xsize; x++) {
+				if (args?.skipSquare?.(packMapsquare(x, z))) { continue; }
 				yield getMapsquareData(cache, x, z);;
 			}
 		}
@@ -130,10 +350,8 @@ const sequenceDeps: DepCollector = async (cache, addDep, addHash) => {
 	if (cache.getBuildNr() <= 484) {//unknown exact buildnr
 		return;
 	}
-	let seqindices = await cache.getCacheIndex(cacheMajors.sequences);
-	for (let index of seqindices) {
-		if (!index) { continue; }
-		let arch = await cache.getFileArchive(index);
+	for await (let { index, files: arch, error } of cache.streamArchives(cacheMajors.sequences)) {
+		if (error) { throw error; }
 		for (let file of arch) {
 			let id = archiveToFileId(index.major, index.minor, file.fileid);
 			addHash("sequence", id, crc32(file.buffer), index.version);
@@ -186,38 +404,40 @@ const locationDeps: DepCollector = async (cache, addDep, addHash) => {
 			}
 		}
 	} else {
-		for await (let { id, file } of iterateConfigFiles(cache, cacheMajors.locs)) {
-			let loc = parse.loc.read(file, cache);
-			// addHash("loc", id, crc32(file), 0);
-			addHash("loc", id, locationMetaHash(loc), 0);
-			if (loc.animation) {
-				addDep("sequence", loc.animation, "loc", id);
-			}
-			if (loc.animVariations && loc.animVariations.length >= 1) {
-				addDep("sequence", loc.animVariations[0].animid, "loc", id);
-			}
-			if (loc.models) {
-				for (let group of loc.models) {
-					for (let model of group.values) {
-						addDep("model", model, "loc", id);
-					}
-				}
-			}
-			if (loc.models_05) {
-				for (let group of loc.models_05.models) {
-					for (let model of group.values) {
-						addDep("model", model, "loc", id);
-					}
-				}
+		await shardedFileDeps(cache, "locs", iterateConfigFiles(cache, cacheMajors.locs), addDep, addHash);
+	}
+}
+
+function locFileDeps(id: number, file: Buffer, source: CacheFileSource, addDep: DepCallback, addHash: HashCallback) {
+	let loc = parse.loc.read(file, source);
+	// addHash("loc", id, crc32(file), 0);
+	addHash("loc", id, locationMetaHash(loc), 0);
+	if (loc.animation) {
+		addDep("sequence", loc.animation, "loc", id);
+	}
+	if (loc.animVariations && loc.animVariations.length >= 1) {
+		addDep("sequence", loc.animVariations[0].animid, "loc", id);
+	}
+	if (loc.models) {
+		for (let group of loc.models) {
+			for (let model of group.values) {
+				addDep("model", model, "loc", id);
 			}
-			if (loc.morphs_1 || loc.morphs_2) {
-				let morphid = defaultMorphId(loc);
-				if (morphid != -1) {
-					addDep("loc", morphid, "loc", id);
-				}
+		}
+	}
+	if (loc.models_05) {
+		for (let group of loc.models_05.models) {
+			for (let model of group.values) {
+				addDep("model", model, "loc", id);
 			}
 		}
 	}
+	if (loc.morphs_1 || loc.morphs_2) {
+		let morphid = defaultMorphId(loc);
+		if (morphid != -1) {
+			addDep("loc", morphid, "loc", id);
+		}
+	}
 }
 
 const itemDeps: DepCollector = async (cache, addDep, addHash) => {
@@ -227,22 +447,24 @@ const itemDeps: DepCollector = async (cache, addDep, addHash) => {
 			addHash("item", id, hash, 0);
 		}
 	} else {
-		for await (let { id, file } of iterateConfigFiles(cache, cacheMajors.items)) {
-			addHash("item", id, crc32(file), 0);
-			let item = parse.item.read(file, cache);
-			let models: number[] = ([] as (number | undefined | null)[]).concat(
-				item.baseModel,
-				item.maleModels_0?.id, item.maleModels_1, item.maleModels_2,
-				item.femaleModels_0?.id, item.femaleModels_1, item.femaleModels_2,
-				item.maleHeads_0, item.maleHeads_1, item.femaleHeads_0, item.femaleHeads_1
-			).filter(q => typeof q == "number") as any;
-			for (let model of models) {
-				addDep("model", model, "item", id);
-			}
-			if (item.noteTemplate) {
-				addDep("item", item.noteTemplate, "item", id);
-			}
-		}
+		await shardedFileDeps(cache, "items", iterateConfigFiles(cache, cacheMajors.items), addDep, addHash);
+	}
+}
+
+function itemFileDeps(id: number, file: Buffer, source: CacheFileSource, addDep: DepCallback, addHash: HashCallback) {
+	addHash("item", id, crc32(file), 0);
+	let item = parse.item.read(file, source);
+	let models: number[] = ([] as (number | undefined | null)[]).concat(
+		item.baseModel,
+		item.maleModels_0?.id, item.maleModels_1, item.maleModels_2,
+		item.femaleModels_0?.id, item.femaleModels_1, item.femaleModels_2,
+		item.maleHeads_0, item.maleHeads_1, item.femaleHeads_0, item.femaleHeads_1
+	).filter(q => typeof q == "number") as any;
+	for (let model of models) {
+		addDep("model", model, "item", id);
+	}
+	if (item.noteTemplate) {
+		addDep("item", item.noteTemplate, "item", id);
 	}
 }
 const animgroupDeps: DepCollector = async (cache, addDep, addHash) => {
@@ -258,10 +480,8 @@ const animgroupDeps: DepCollector = async (cache, addDep, addHash) => {
 	}
 }
 const materialDeps: DepCollector = async (cache, addDep, addHash) => {
-	let indices = await cache.getCacheIndex(cacheMajors.materials);
-	for (let index of indices) {
-		if (!index) { continue; }
-		let arch = await cache.getFileArchive(index);
+	for await (let { index, files: arch, error } of cache.streamArchives(cacheMajors.materials)) {
+		if (error) { throw error; }
 
 		for (let file of arch) {
 			addHash("material", file.fileid, crc32(file.buffer), index.version);
@@ -294,15 +514,16 @@ const materialAndTextureDeps: DepCollector = async (cache, addDep, addHash) => {
 		//unknown how this works...
 	} else {
 		let arch = await cache.getArchiveById(cacheMajors.materials, 0);
+		await shardedFileDeps(cache, "materials", arch.map(q => ({ id: q.fileid, file: q.buffer })), addDep, addHash);
+	}
+}
 
-		for (let file of arch) {
-			addHash("material", file.fileid, crc32(file.buffer), 0);
-			let mat = convertMaterial(file.buffer, file.fileid, cache);
-			for (let tex of Object.values(mat.textures)) {
-				if (typeof tex == "number") {
-					addDep("texture", tex, "material", file.fileid)
-				}
-			}
+function materialFileDeps(id: number, file: Buffer, source: CacheFileSource, addDep: DepCallback, addHash: HashCallback) {
+	addHash("material", id, crc32(file), 0);
+	let mat = convertMaterial(file, id, source);
+	for (let tex of Object.values(mat.textures)) {
+		if (typeof tex == "number") {
+			addDep("texture", tex, "material", id)
 		}
 	}
 }
@@ -314,22 +535,24 @@ const npcDeps: DepCollector = async (cache, addDep, addHash) => {
 			addHash("npc", id, hash, 0);
 		}
 	} else {
-		for await (let { id, file } of iterateConfigFiles(cache, cacheMajors.npcs)) {
-			addHash("npc", id, crc32(file), 0);
-			let npc = parse.npc.read(file, cache);
-			if (npc.animation_group) {
-				addDep("animgroup", npc.animation_group, "npc", id);
-			}
-			if (npc.models) {
-				for (let model of npc.models) {
-					addDep("model", model, "npc", id);
-				}
-			}
-			if (npc.headModels) {
-				for (let model of npc.headModels) {
-					addDep("model", model, "npc", id);
-				}
-			}
+		await shardedFileDeps(cache, "npcs", iterateConfigFiles(cache, cacheMajors.npcs), addDep, addHash);
+	}
+}
+
+function npcFileDeps(id: number, file: Buffer, source: CacheFileSource, addDep: DepCallback, addHash: HashCallback) {
+	addHash("npc", id, crc32(file), 0);
+	let npc = parse.npc.read(file, source);
+	if (npc.animation_group) {
+		addDep("animgroup", npc.animation_group, "npc", id);
+	}
+	if (npc.models) {
+		for (let model of npc.models) {
+			addDep("model", model, "npc", id);
+		}
+	}
+	if (npc.headModels) {
+		for (let model of npc.headModels) {
+			addDep("model", model, "npc", id);
 		}
 	}
 }
@@ -345,11 +568,9 @@ const skeletonDeps: DepCollector = async (cache, addDep, addHash) => {
 }
 
 const framesetDeps: DepCollector = async (cache, addDep, addHash) => {
-	let framesetindices = await cache.getCacheIndex(cacheMajors.frames);
-	for (let index of framesetindices) {
-		if (!index) { continue; }
+	for await (let { index, files: arch, error } of cache.streamArchives(cacheMajors.frames)) {
+		if (error) { throw error; }
 		addHash("frameset", index.minor, index.crc, index.version);
-		let arch = await cache.getFileArchive(index);
 		if (arch.length != 0) {
 			let frame0 = parse.frames.read(arch[0].buffer, cache);
 			addDep("framebase", frame0.framemap_id, "frameset", index.minor);
@@ -376,10 +597,182 @@ const modelDeps: DepCollector = async (cache, addDep, addHash, opts) => {
 }
 
 
+//node types each collector owns as holder or hash, and the majors it reads, used to find out which
+//parts of a snapshot are still valid. mapsquares are checked per square using their crc
+type CollectorSource = { key: string, owns: DepTypes[], majors: number[] };
+const collectorSources = new Map<DepCollector, CollectorSource>([
+	[locationDeps, { key: "locs", owns: ["loc"], majors: [cacheMajors.locs] }],
+	[itemDeps, { key: "items", owns: ["item"], majors: [cacheMajors.items] }],
+	[animgroupDeps, { key: "animgroups", owns: ["animgroup"], majors: [cacheMajors.config] }],
+	[materialAndTextureDeps, { key: "materials", owns: ["material"], majors: [cacheMajors.materials] }],
+	[npcDeps, { key: "npcs", owns: ["npc"], majors: [cacheMajors.npcs] }],
+	[mapOverlayDeps, { key: "overlays", owns: ["overlay"], majors: [cacheMajors.config] }],
+	[mapUnderlayDeps, { key: "underlays", owns: ["underlay"], majors: [cacheMajors.config] }]
+]);
+
+//mapsquares are stored as one group per square from this build on
+const incrementalSnapshotBuild = 759;
+
+async function collectorSourceCrc(cache: EngineCache, source: CollectorSource) {
+	let crc = 0;
+	for (let major of source.majors) {
+		let index = await cache.getCacheIndex(major);
+		for (let entry of index) {
+			if (!entry) { continue; }
+			crc = crc32addInt(entry.minor, crc);
+			crc = crc32addInt(entry.crc, crc);
+			crc = crc32addInt(entry.version, crc);
+		}
+	}
+	return crc;
+}
+
+//(type, id) pairs are packed into one number, stays a small int for ids below 2^26
+export type DepKey = number;
+const depTypeStride = 16;
+
+export function packDepKey(type: DepTypes, id: number): DepKey {
+	return id * depTypeStride + depidmap[type];
+}
+export function unpackDepKey(key: DepKey) {
+	let id = Math.floor(key / depTypeStride);
+	return { type: depClasses[key - id * depTypeStride], id };
+}
+export function depKeyName(key: DepKey) {
+	let { type, id } = unpackDepKey(key);
+	return `${type}-${id}`;
+}
+function toDepKey(dep: DepKey | string) {
+	if (typeof dep == "number") { return dep; }
+	let [type, id] = dep.split("-");
+	if (depidmap[type] == undefined) { throw new Error(`unknown dependency type ${type}`); }
+	return packDepKey(type as DepTypes, +id);
+}
+
+//append-only adjacency lists, the edges of a node form a linked list in insertion order
+class AdjacencyBuilder {
+	head = new Int32Array(1024).fill(-1);
+	tail = new Int32Array(1024).fill(-1);
+	next = new Int32Array(4096);
+	target = new Int32Array(4096);
+	edgecount = 0;
+
+	ensureNodes(count: number) {
+		if (count <= this.head.length) { return; }
+		let size = Math.max(count, this.head.length * 2);
+		let head = new Int32Array(size).fill(-1);
+		let tail = new Int32Array(size).fill(-1);
+		head.set(this.head);
+		tail.set(this.tail);
+		this.head = head;
+		this.tail = tail;
+	}
+
+	add(from: number, to: number) {
+		if (this.edgecount == this.next.length) {
+			let next = new Int32Array(this.next.length * 2);
+			let target = new Int32Array(this.next.length * 2);
+			next.set(this.next);
+			target.set(this.target);
+			this.next = next;
+			this.target = target;
+		}
+		let edge = this.edgecount++;
+		this.target[edge] = to;
+		this.next[edge] = -1;
+		if (this.tail[from] == -1) { this.head[from] = edge; }
+		else { this.next[this.tail[from]] = edge; }
+		this.tail[from] = edge;
+	}
+
+	//flattens the lists into compressed sparse rows, edges of node n are targets[offsets[n]..offsets[n+1]]
+	toCsr(nodecount: number) {
+		let offsets = new Int32Array(nodecount + 1);
+		let targets = new Int32Array(this.edgecount);
+		let index = 0;
+		for (let node = 0; node < nodecount; node++) {
+			offsets[node] = index;
+			for (let edge = this.head[node]; edge != -1; edge = this.next[edge]) {
+				targets[index++] = this.target[edge];
+			}
+		}
+		offsets[nodecount] = index;
+		return { offsets, targets };
+	}
+}
+
+//open addressing set of (from, to) node pairs, replaces the indexOf dedupe of edge lists
+class EdgeSet {
+	slots = new Int32Array(2 * 4096);
+	count = 0;
+
+	private static hash(from: number, to: number) {
+		return (Math.imul(from, 0x9e3779b1) ^ Math.imul(to + 1, 0x85ebca6b)) >>> 0;
+	}
+
+	//returns false if the edge was already present
+	add(from: number, to: number) {
+		if ((this.count + 1) * 4 > this.slots.length) { this.grow(); }
+		let mask = (this.slots.length >> 1) - 1;
+		let slot = EdgeSet.hash(from, to) & mask;
+		while (true) {
+			let stored = this.slots[slot * 2];
+			//from is stored +1 so 0 marks an empty slot
+			if (stored == 0) {
+				this.slots[slot * 2] = from + 1;
+				this.slots[slot * 2 + 1] = to;
+				this.count++;
+				return true;
+			}
+			if (stored == from + 1 && this.slots[slot * 2 + 1] == to) { return false; }
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	private grow() {
+		let old = this.slots;
+		this.slots = new Int32Array(old.length * 2);
+		this.count = 0;
+		for (let i = 0; i < old.length; i += 2) {
+			if (old[i] != 0) { this.add(old[i] - 1, old[i + 1]); }
+		}
+	}
+}
+
+type CsrGraph = { offsets: Int32Array, targets: Int32Array };
+
+//every node adds its type, id and hash as 3 ints to the crc
+const nodeOwnShift = crc32shift(3 * 4);
+const merkleDirty = 0;
+const merkleComputing = 1;
+const merkleValid = 2;
+//depends on a cycle, set by the eager pass so later walks don't retry it. Cycles can't be removed by
+//adding edges or hashes, so these never have to be invalidated
+const merkleCyclic = 3;
+
 export class DependencyGraph {
-	dependentsMap = new Map<string, string[]>();
-	dependencyMap = new Map<string, string[]>();
-	hashes = new Map<string, number>();
+	//dense node index per packed key, all other node data is stored in columns by node index
+	private nodeIndex = new Map<DepKey, number>();
+	private nodeKeys: DepKey[] = [];
+	private nodeHashes = new Int32Array(1024);
+	private nodeHasHash = new Uint8Array(1024);
+	//merkle layer, crc of the full ordered subtree walk of each node starting from 0 and the crc shift
+	//operator for its length, lets hashDependencies continue any crc without walking the subtree
+	private subtreeCrcs = new Int32Array(1024);
+	private subtreeShifts = new Int32Array(1024);
+	private merkleState = new Uint8Array(1024);
+	//node -> the nodes it depends on, and the reverse
+	private dependencies = new AdjacencyBuilder();
+	private dependents = new AdjacencyBuilder();
+	private edges = new EdgeSet();
+	//query side representation, rebuilt in bulk when edges were added since the last query
+	private csr: CsrGraph | null = null;
+	//persisted copy of the graph, null if snapshots aren't enabled
+	private snapshotFile: string | null = null;
+	private snapshotFingerprint = 0;
+	private snapshotCollectors: Record<string, number> = {};
+	private snapshotDirty = false;
+	private snapshotWrite: Promise<void> | null = null;
 
 	cache: EngineCache;
 	decodeargs: DepArgs;
@@ -406,37 +799,269 @@ export class DependencyGraph {
 			// framesetDeps,
 		];
 
-		for (let run of runs) {
-			await res.runDependencyGroup(run, args);
+		let fresh = new Set<DepCollector>();
+		res.snapshotFile = dependencySnapshotFile(cache.getCacheMeta().name);
+		if (res.snapshotFile) {
+			res.snapshotFingerprint = await getCacheVersionFingerprint(cache);
+			let snapshot = await readDependencySnapshot(res.snapshotFile);
+			fresh = await res.restoreSnapshot(snapshot, runs);
 		}
+
+		//collectors own distinct holder types so they can run at the same time, their decoding
+		//is spread over the worker pool while io stays here
+		await Promise.all(runs.map(async run => {
+			if (fresh.has(run)) {
+				console.log(`using snapshot for ${run.name}`);
+				return;
+			}
+			await res.runDependencyGroup(run, args);
+			let source = collectorSources.get(run);
+			if (source && res.snapshotFile) {
+				res.snapshotCollectors[source.key] = await collectorSourceCrc(cache, source);
+			}
+		}));
+		res.saveSnapshot();
 		return res;
 	}
 
-	preloadChunkDependencies(args?: DepArgs) {
-		return this.runDependencyGroup(mapsquareDeps2, args);
+	async preloadChunkDependencies(args?: DepArgs) {
+		//squares that are already in the graph, either from the snapshot or an earlier preload
+		let skipSquare = (squareindex: number) => this.hasEntry("mapsquare", squareindex);
+		await this.runDependencyGroup(mapsquareDeps2, { ...args, skipSquare });
+		this.saveSnapshot();
+	}
+
+	/**
+	 * Loads the parts of a previous snapshot that are still valid. An identical cache version restores
+	 * everything, otherwise collectors whose majors changed and mapsquares with a different crc are left
+	 * out so only those are scanned again. Returns the collectors that don't need to run.
+	 */
+	private async restoreSnapshot(snapshot: DependencySnapshot | null, runs: DepCollector[]) {
+		let fresh = new Set<DepCollector>();
+		if (!snapshot || this.nodeCount != 0) { return fresh; }
+		let buildnr = this.cache.getBuildNr();
+		let exact = snapshot.buildnr == buildnr && snapshot.fingerprint == this.snapshotFingerprint;
+		let incremental = buildnr >= incrementalSnapshotBuild && snapshot.buildnr >= incrementalSnapshotBuild;
+		if (!exact && !incremental) { return fresh; }
+
+		let staletypes = new Set<DepTypes>();
+		for (let run of runs) {
+			let source = collectorSources.get(run);
+			if (!source) { continue; }
+			let crc = snapshot.collectors[source.key];
+			let valid = crc != undefined && (exact || crc == await collectorSourceCrc(this.cache, source));
+			if (valid) {
+				fresh.add(run);
+				this.snapshotCollectors[source.key] = crc;
+			} else {
+				source.owns.forEach(q => staletypes.add(q));
+			}
+		}
+		let mapindex = (exact ? null : await this.cache.getCacheIndex(cacheMajors.mapsquares));
+		let keepnode = new Uint8Array(snapshot.nodeKeys.length);
+		for (let node = 0; node < snapshot.nodeKeys.length; node++) {
+			let { type, id } = unpackDepKey(snapshot.nodeKeys[node]);
+			if (type == "mapsquare") {
+				//the hash of a mapsquare node is the crc of its group
+				keepnode[node] = +(exact || (snapshot.nodeHasHash[node] != 0 && mapindex![id]?.crc == (snapshot.nodeHashes[node] >>> 0)));
+			} else {
+				keepnode[node] = +!staletypes.has(type);
+			}
+		}
+
+		//node indices stay the same as in the snapshot since the graph is empty
+		for (let node = 0; node < snapshot.nodeKeys.length; node++) {
+			this.getNode(snapshot.nodeKeys[node]);
+			if (keepnode[node] && snapshot.nodeHasHash[node]) {
+				this.nodeHashes[node] = snapshot.nodeHashes[node];
+				this.nodeHasHash[node] = 1;
+			}
+		}
+		for (let node = 0; node < snapshot.nodeKeys.length; node++) {
+			if (!keepnode[node]) { continue; }
+			for (let i = snapshot.offsets[node]; i < snapshot.offsets[node + 1]; i++) {
+				let child = snapshot.targets[i];
+				if (this.edges.add(node, child)) {
+					this.dependencies.add(node, child);
+					this.dependents.add(child, node);
+				}
+			}
+		}
+		//nothing changed if the entire snapshot is still valid
+		this.snapshotDirty = !exact;
+		console.log(`restored dependency snapshot, ${exact ? "exact match" : `${fresh.size} collectors still valid`}`);
+		return fresh;
+	}
+
+	private saveSnapshot() {
+		if (!this.snapshotFile || !this.snapshotDirty) { return; }
+		this.snapshotDirty = false;
+		let file = this.snapshotFile;
+		let csr = this.getCsr();
+		let snapshot: DependencySnapshot = {
+			buildnr: this.cache.getBuildNr(),
+			fingerprint: this.snapshotFingerprint,
+			nodeKeys: new Float64Array(this.nodeKeys),
+			nodeHashes: this.nodeHashes.slice(0, this.nodeCount),
+			nodeHasHash: this.nodeHasHash.slice(0, this.nodeCount),
+			offsets: csr.offsets,
+			targets: csr.targets,
+			collectors: { ...this.snapshotCollectors }
+		};
+		//chain writes so an older graph never overwrites a newer one
+		this.snapshotWrite = (this.snapshotWrite ?? Promise.resolve())
+			.then(() => writeDependencySnapshot(file, snapshot))
+			.catch(e => console.warn("failed to write dependency snapshot", e));
+	}
+
+	get nodeCount() {
+		return this.nodeKeys.length;
+	}
+	get edgeCount() {
+		return this.edges.count;
+	}
+
+	private getNode(key: DepKey) {
+		let node = this.nodeIndex.get(key);
+		if (node == undefined) {
+			node = this.nodeKeys.length;
+			this.nodeKeys.push(key);
+			this.nodeIndex.set(key, node);
+			if (node == this.nodeHashes.length) {
+				let grow = <T extends Int32Array | Uint8Array>(arr: T) => {
+					let res = new (arr.constructor as any)(node! * 2) as T;
+					res.set(arr);
+					return res;
+				}
+				this.nodeHashes = grow(this.nodeHashes);
+				this.nodeHasHash = grow(this.nodeHasHash);
+				this.subtreeCrcs = grow(this.subtreeCrcs);
+				this.subtreeShifts = grow(this.subtreeShifts);
+				this.merkleState = grow(this.merkleState);
+			}
+			this.dependencies.ensureNodes(node + 1);
+			this.dependents.ensureNodes(node + 1);
+		}
+		return node;
+	}
+
+	private getCsr() {
+		if (!this.csr || this.csr.targets.length != this.dependencies.edgecount || this.csr.offsets.length != this.nodeKeys.length + 1) {
+			this.csr = this.dependencies.toCsr(this.nodeKeys.length);
+		}
+		return this.csr;
 	}
 
 	addDep(holdertype: DepTypes, holderId: number, deptType: DepTypes, depId: number) {
-		let holder = `${holdertype}-${holderId}`;
-		let newdep = `${deptType}-${depId}`;
-		//add dependency
-		let dependencies = this.dependencyMap.get(newdep);
-		if (!dependencies) {
-			dependencies = [];
-			this.dependencyMap.set(newdep, dependencies);
-		}
-		if (dependencies.indexOf(holder) == -1) { dependencies.push(holder); }
-		//add dependent
-		let deps = this.dependentsMap.get(holder);
-		if (!deps) {
-			deps = [];
-			this.dependentsMap.set(holder, deps);
-		}
-		if (deps.indexOf(newdep) == -1) { deps.push(newdep); }
+		let holder = this.getNode(packDepKey(holdertype, holderId));
+		let newdep = this.getNode(packDepKey(deptType, depId));
+		if (this.edges.add(newdep, holder)) {
+			this.dependencies.add(newdep, holder);
+			this.dependents.add(holder, newdep);
+			this.invalidateMerkle(newdep);
+			this.snapshotDirty = true;
+		}
 	}
 	addHash(deptType: DepTypes, depId: number, hash: number, version: number) {
-		let depname = `${deptType}-${depId}`;
-		this.hashes.set(depname, hash);
+		let node = this.getNode(packDepKey(deptType, depId));
+		if (this.nodeHasHash[node] && this.nodeHashes[node] == (hash | 0)) { return; }
+		this.nodeHashes[node] = hash;
+		this.nodeHasHash[node] = 1;
+		this.invalidateMerkle(node);
+		this.snapshotDirty = true;
+	}
+
+	//a valid node always has valid children, so the walk up can stop at nodes that are already dirty
+	//uses an explicit stack since dependency chains can be deeper than the js call stack
+	private invalidateMerkle(node: number) {
+		if (this.merkleState[node] != merkleValid) { return; }
+		this.merkleState[node] = merkleDirty;
+		let parents = this.dependents;
+		let stack = [node];
+		while (stack.length != 0) {
+			let child = stack.pop()!;
+			for (let edge = parents.head[child]; edge != -1; edge = parents.next[edge]) {
+				let parent = parents.target[edge];
+				if (this.merkleState[parent] != merkleValid) { continue; }
+				this.merkleState[parent] = merkleDirty;
+				stack.push(parent);
+			}
+		}
+	}
+
+	//starts the crc of a node with its own key and hash, children are combined into it as they complete
+	private startMerkle(node: number) {
+		this.merkleState[node] = merkleComputing;
+		let { type, id } = unpackDepKey(this.nodeKeys[node]);
+		let crc = crc32addInt(depidmap[type], 0);
+		crc = crc32addInt(id, crc);
+		crc = crc32addInt(this.nodeHashes[node], crc);
+		this.subtreeCrcs[node] = crc;
+		this.subtreeShifts[node] = nodeOwnShift;
+	}
+
+	//depth first post order walk with an explicit stack, the nodes on the stack are the current path
+	//and hold their partial crc until all their children are valid
+	private computeMerkle(root: number, csr: CsrGraph, markcycles = false) {
+		let rootstate = this.merkleState[root];
+		if (rootstate == merkleValid) { return; }
+		if (rootstate == merkleCyclic) { throw new Error(`dependency cycle below ${depKeyName(this.nodeKeys[root])}`); }
+		let path = [root];
+		let childindex = [csr.offsets[root]];
+		this.startMerkle(root);
+		try {
+			while (path.length != 0) {
+				let depth = path.length - 1;
+				let node = path[depth];
+				let i = childindex[depth];
+				if (i == csr.offsets[node + 1]) {
+					this.merkleState[node] = merkleValid;
+					path.pop();
+					childindex.pop();
+					continue;
+				}
+				let child = csr.targets[i];
+				let state = this.merkleState[child];
+				if (state == merkleComputing || state == merkleCyclic) { throw new Error(`dependency cycle at ${depKeyName(this.nodeKeys[child])}`); }
+				if (state == merkleDirty) {
+					//visit the child first, this edge is combined once we get back here
+					this.startMerkle(child);
+					path.push(child);
+					childindex.push(csr.offsets[child]);
+					continue;
+				}
+				let childshift = this.subtreeShifts[child] >>> 0;
+				this.subtreeCrcs[node] = crc32combine(this.subtreeCrcs[node] >>> 0, this.subtreeCrcs[child] >>> 0, childshift);
+				this.subtreeShifts[node] = crc32multmod(childshift, this.subtreeShifts[node] >>> 0);
+				childindex[depth] = i + 1;
+			}
+		} catch (e) {
+			//the nodes on the path are left half computed, reset them so later queries don't see a false cycle,
+			//or remember that they all depend on the cycle
+			for (let node of path) { this.merkleState[node] = (markcycles ? merkleCyclic : merkleDirty); }
+			throw e;
+		}
+	}
+
+	//brings the merkle layer up to date in one pass, otherwise it is computed lazily per query. Nodes that
+	//depend on a cycle are skipped, hashing them still throws like it does without this pass
+	computeSubtreeHashes() {
+		let csr = this.getCsr();
+		let cyclic = 0;
+		for (let node = 0; node < this.nodeKeys.length; node++) {
+			if (this.merkleState[node] == merkleCyclic) { continue; }
+			try {
+				this.computeMerkle(node, csr, true);
+			} catch (e) {
+				if (cyclic++ == 0) { console.warn((e as Error).message); }
+			}
+		}
+		if (cyclic != 0) { console.warn(`${cyclic} dependency graph walks ran into a cycle`); }
+	}
+
+	//order stable hash of the entire subtree, equal to the treehash of debugDependencyTree
+	getSubtreeHash(depname: DepKey | string) {
+		return this.hashDependencies(depname, 0);
 	}
 
 	async runDependencyGroup(run: DepCollector, args) {
@@ -444,7 +1069,7 @@ export class DependencyGraph {
 			console.log(`starting ${run.name}`);
 			let t = Date.now();
 			await run(this.cache, this.addDep.bind(this), this.addHash.bind(this), args);
-			console.log(`finished ${run.name}, duration ${((Date.now() - t) / 1000).toFixed(1)}`);
+			console.log(`finished ${run.name}, duration ${((Date.now() - t) / 1000).toFixed(1)}, ${this.nodeCount} nodes, ${this.edgeCount} edges`);
 		} catch (e) {
 			debugger;
 			throw e;
@@ -452,63 +1077,70 @@ export class DependencyGraph {
 	}
 
 	makeDeptName(deptType: DepTypes, id: number) {
-		return `${deptType}-${id}`;
-	}
-
-	cascadeDependencies(depname: string,) {
-		let inner = (depname: string, list: string[], hashes: number[]) => {
-			let hash = this.hashes.get(depname) ?? 0;
-			let hashtext = `${depname}-${hash}`;
-			if (!list.includes(hashtext)) {
-				list.push(hashtext);
-				hashes.push(hash);
-				let deps = this.dependencyMap.get(depname);
-				if (deps) {
-					for (let dep of deps) {
-						inner(dep, list, hashes);
-					}
+		return packDepKey(deptType, id);
+	}
+
+	cascadeDependencies(depname: DepKey | string) {
+		let csr = this.getCsr();
+		let visited = new Set<number>();
+		let ids: string[] = [];
+		let hashes: number[] = [];
+		let inner = (key: DepKey) => {
+			let node = this.nodeIndex.get(key);
+			let hash = (node == undefined ? 0 : this.nodeHashes[node]);
+			ids.push(`${depKeyName(key)}-${hash}`);
+			hashes.push(hash);
+			if (node == undefined) { return; }
+			for (let i = csr.offsets[node]; i < csr.offsets[node + 1]; i++) {
+				let child = csr.targets[i];
+				if (!visited.has(child)) {
+					visited.add(child);
+					inner(this.nodeKeys[child]);
 				}
 			}
 		}
-		let ids: string[] = [];
-		let hashes: number[] = [];
-		inner(depname, ids, hashes);
+		let root = toDepKey(depname);
+		let rootnode = this.nodeIndex.get(root);
+		if (rootnode != undefined) { visited.add(rootnode); }
+		inner(root);
 		return { ids, hashes };
 	}
 
-	debugDependencyTree(depname: string) {
-		let inner = (depname: string, previouscrc: number) => {
-			let hash = this.hashes.get(depname) ?? 0;
-			let [type, id] = depname.split("-");
+	debugDependencyTree(depname: DepKey | string) {
+		let csr = this.getCsr();
+		let inner = (key: DepKey, previouscrc: number) => {
+			let node = this.nodeIndex.get(key);
+			let hash = (node == undefined ? 0 : this.nodeHashes[node]);
+			let { type, id } = unpackDepKey(key);
 			let crc = previouscrc;
 			crc = crc32addInt(depidmap[type], crc);
-			crc = crc32addInt(+id, crc);
-			crc = crc32addInt(+hash, crc);
-			let deps = this.dependencyMap.get(depname);
-			if (deps) {
-				for (let dep of deps) {
-					[crc] = inner(dep, crc);
-				}
+			crc = crc32addInt(id, crc);
+			crc = crc32addInt(hash, crc);
+			let start = (node == undefined ? 0 : csr.offsets[node]);
+			let end = (node == undefined ? 0 : csr.offsets[node + 1]);
+			for (let i = start; i < end; i++) {
+				[crc] = inner(this.nodeKeys[csr.targets[i]], crc);
 			}
 
-			let sub = visited.get(depname);
+			let name = depKeyName(key);
+			let sub = visited.get(name);
 			if (!sub) {
 				sub = {
-					key: depname,
+					key: name,
 					ownhash: hash,
 					children: [],
 					treehash: 0,
 				};
-				visited.set(depname, sub);
+				visited.set(name, sub);
 
 				let isolatedcrc = 0;
 				isolatedcrc = crc32addInt(depidmap[type], isolatedcrc);
-				isolatedcrc = crc32addInt(+id, isolatedcrc);
-				isolatedcrc = crc32addInt(+hash, isolatedcrc);
+				isolatedcrc = crc32addInt(id, isolatedcrc);
+				isolatedcrc = crc32addInt(hash, isolatedcrc);
 
-				for (let dep of deps ?? []) {
+				for (let i = start; i < end; i++) {
 					let child: DepMeta;
-					[isolatedcrc, child] = inner(dep, isolatedcrc);
+					[isolatedcrc, child] = inner(this.nodeKeys[csr.targets[i]], isolatedcrc);
 					sub.children.push(child);
 				}
 				sub.treehash = isolatedcrc;
@@ -518,31 +1150,30 @@ export class DependencyGraph {
 		}
 
 		let visited = new Map<string, DepMeta>();
-		let res = inner(depname, 0);
+		let res = inner(toDepKey(depname), 0);
 		return {
 			visited,
 			root: res[1]
 		}
 	}
 
-	hashDependencies(depname: string, previouscrc = 0) {
-		let hash = this.hashes.get(depname) ?? 0;
-		let [type, id] = depname.split("-");
-		let crc = previouscrc;
-		crc = crc32addInt(depidmap[type], crc);
-		crc = crc32addInt(+id, crc);
-		crc = crc32addInt(+hash, crc);
-		let deps = this.dependencyMap.get(depname);
-		if (deps) {
-			for (let dep of deps) {
-				crc = this.hashDependencies(dep, crc);
-			}
+	//same result as continuing previouscrc over every node of the subtree walk, but uses the merkle layer
+	hashDependencies(depname: DepKey | string, previouscrc = 0) {
+		let key = toDepKey(depname);
+		let node = this.nodeIndex.get(key);
+		if (node == undefined) {
+			let { type, id } = unpackDepKey(key);
+			let crc = crc32addInt(depidmap[type], previouscrc);
+			crc = crc32addInt(id, crc);
+			return crc32addInt(0, crc);
 		}
-		return crc;
+		this.computeMerkle(node, this.getCsr());
+		return crc32combine(previouscrc, this.subtreeCrcs[node] >>> 0, this.subtreeShifts[node] >>> 0);
 	}
 
 	hasEntry(deptType: DepTypes, depId: number) {
-		return this.hashes.has(this.makeDeptName(deptType, depId));
+		let node = this.nodeIndex.get(packDepKey(deptType, depId));
+		return node != undefined && this.nodeHasHash[node] != 0;
 	}
 
 	insertMapChunk(data: ChunkData) {
@@ -552,4 +1183,3 @@ export class DependencyGraph {
 	}
 
 }
-
@@ -0,0 +1,107 @@
+import * as fs from "fs/promises";
+import * as path from "path";
+import { crc32 } from "../libs/crc32util";
+
+const snapshotMagic = 0x47445352;//"RSDG"
+//bump when collectors or the layout change so old snapshots are rebuilt
+export const snapshotFormatVersion = 1;
+const headerSize = 32;
+
+export type DependencySnapshot = {
+	buildnr: number,
+	fingerprint: number,
+	nodeKeys: Float64Array,
+	nodeHashes: Int32Array,
+	nodeHasHash: Uint8Array,
+	//csr adjacency of the dependencies direction
+	offsets: Int32Array,
+	targets: Int32Array,
+	//source crc per collector that was part of the snapshot
+	collectors: Record<string, number>
+}
+
+function align8(n: number) {
+	return (n + 7) & ~7;
+}
+
+//opt in with RSMV_DEPSNAPSHOT=1 or a directory, returns null in browsers
+export function dependencySnapshotFile(sourcename: string) {
+	let arg = (typeof process != "undefined" ? process.env?.RSMV_DEPSNAPSHOT : undefined);
+	if (!arg || !fs.writeFile) { return null; }
+	let dir = (arg == "1" ? "cache" : arg);
+	//one file per cache source so a new version of the same source can be diffed against it
+	let id = crc32(Buffer.from(sourcename, "utf8")).toString(16);
+	return path.resolve(dir, `depgraph-${id}.bin`);
+}
+
+/**
+ * Every section is 8 byte aligned so the arrays can be used as views over the file buffer
+ * without parsing, the collector table is stored as json after the arrays
+ */
+export function encodeDependencySnapshot(snap: DependencySnapshot) {
+	let nodecount = snap.nodeKeys.length;
+	let edgecount = snap.targets.length;
+	let json = Buffer.from(JSON.stringify({ collectors: snap.collectors }), "utf8");
+	let sections = [
+		new Uint8Array(snap.nodeKeys.buffer, snap.nodeKeys.byteOffset, snap.nodeKeys.byteLength),
+		new Uint8Array(snap.nodeHashes.buffer, snap.nodeHashes.byteOffset, snap.nodeHashes.byteLength),
+		snap.nodeHasHash,
+		new Uint8Array(snap.offsets.buffer, snap.offsets.byteOffset, snap.offsets.byteLength),
+		new Uint8Array(snap.targets.buffer, snap.targets.byteOffset, snap.targets.byteLength),
+		json
+	];
+	let size = headerSize + sections.reduce((a, v) => a + align8(v.byteLength), 0);
+	let buf = Buffer.alloc(size);
+	buf.writeUInt32LE(snapshotMagic, 0);
+	buf.writeUInt32LE(snapshotFormatVersion, 4);
+	buf.writeUInt32LE(snap.buildnr, 8);
+	buf.writeUInt32LE(nodecount, 12);
+	buf.writeDoubleLE(snap.fingerprint, 16);
+	buf.writeUInt32LE(edgecount, 24);
+	buf.writeUInt32LE(json.byteLength, 28);
+	let offset = headerSize;
+	for (let section of sections) {
+		buf.set(section, offset);
+		offset += align8(section.byteLength);
+	}
+	return buf;
+}
+
+export function decodeDependencySnapshot(buf: Buffer): DependencySnapshot | null {
+	if (buf.byteLength < headerSize || buf.readUInt32LE(0) != snapshotMagic || buf.readUInt32LE(4) != snapshotFormatVersion) {
+		return null;
+	}
+	//typed array views need an aligned offset, only copies if node handed out a misaligned buffer
+	if (buf.byteOffset % 8 != 0) { buf = Buffer.from(buf); }
+	let buildnr = buf.readUInt32LE(8);
+	let nodecount = buf.readUInt32LE(12);
+	let fingerprint = buf.readDoubleLE(16);
+	let edgecount = buf.readUInt32LE(24);
+	let jsonlength = buf.readUInt32LE(28);
+	let offset = buf.byteOffset + headerSize;
+	let take = <T>(constr: { new(buf: ArrayBufferLike, offset: number, length: number): T, BYTES_PER_ELEMENT: number }, length: number) => {
+		let res = new constr(buf.buffer, offset, length);
+		offset += align8(length * constr.BYTES_PER_ELEMENT);
+		return res;
+	}
+	let nodeKeys = take(Float64Array, nodecount);
+	let nodeHashes = take(Int32Array, nodecount);
+	let nodeHasHash = take(Uint8Array, nodecount);
+	let offsets = take(Int32Array, nodecount + 1);
+	let targets = take(Int32Array, edgecount);
+	let json = JSON.parse(Buffer.from(buf.buffer, offset, jsonlength).toString("utf8"));
+	return { buildnr, fingerprint, nodeKeys, nodeHashes, nodeHasHash, offsets, targets, collectors: json.collectors };
+}
+
+export async function readDependencySnapshot(filename: string) {
+	let buf = await fs.readFile(filename).catch(() => null);
+	return (buf ? decodeDependencySnapshot(buf) : null);
+}
+
+export async function writeDependencySnapshot(filename: string, snap: DependencySnapshot) {
+	await fs.mkdir(path.dirname(filename), { recursive: true });
+	//write next to it and rename so a crash never leaves a half written snapshot
+	let tmpfile = `${filename}.tmp`;
+	await fs.writeFile(tmpfile, encodeDependencySnapshot(snap));
+	await fs.rename(tmpfile, filename);
+}
@@ -0,0 +1,37 @@
+import { serveWorkerPool } from "../libs/workerpool";
+import { CacheFileSource } from "../cache";
+import { collectDependencyShard, DepShardKind } from "./dependencies";
+
+export type DependencyWorkerPacket = {
+	kind: DepShardKind,
+	buildnr: number,
+	ids: Int32Array,
+	hashes: Int32Array,
+	versions: Int32Array,
+	//file i of the shard is files[fileoffsets[i]..fileoffsets[i+1]], mapsquares have a tiles and locs file per id
+	fileoffsets: Int32Array,
+	files: Uint8Array
+};
+
+//parsers only need the build number from the source
+class ShardSource extends CacheFileSource {
+	buildnr: number;
+	constructor(buildnr: number) {
+		super();
+		this.buildnr = buildnr;
+	}
+	getBuildNr() {
+		return this.buildnr;
+	}
+}
+
+let sources = new Map<number, ShardSource>();
+
+serveWorkerPool<DependencyWorkerPacket>(packet => {
+	let source = sources.get(packet.buildnr);
+	if (!source) {
+		source = new ShardSource(packet.buildnr);
+		sources.set(packet.buildnr, source);
+	}
+	return collectDependencyShard(packet, source);
+});
@@ -3,6 +3,7 @@ import { GameCacheLoader } from "../cache/sqlite";
 import { FileRange, getOrInsert } from "../utils";
 import { ScriptFS, ScriptOutput } from "../scriptrunner";
 import { cacheFileDecodeModes, DecodeMode, DecodeModeFactory } from "../parser/filetypes";
+import { groupFilesByArchive } from "../parser/jsondecoders";
 
 export async function extractCacheFiles(output: ScriptOutput, outdir: ScriptFS, source: CacheFileSource, args: { batched: boolean, batchlimit: number, mode: string, files: FileRange[], edit: boolean, skipread: boolean }, decoderflags: Record<string, string>) {
 	let modeconstr: DecodeModeFactory = cacheFileDecodeModes[args.mode];
@@ -23,7 +24,6 @@ export async function extractCacheFiles(output: ScriptOutput, outdir: ScriptFS,
 
 
 	if (!args.skipread) {
-		let lastarchive: null | { index: CacheIndex, subfiles: SubFile[], error: Error | null } = null;
 		let currentBatch: { name: string, startIndex: CacheIndex, arch: SubFile[], outputs: (string | Buffer)[], batchchunknr: number } | null = null;
 		let flushbatch = () => {
 			if (currentBatch) {
@@ -37,54 +37,48 @@ export async function extractCacheFiles(output: ScriptOutput, outdir: ScriptFS,
 				})();
 			}
 		}
-		for (let fileid of allfiles) {
+		//the next archives are loaded while the current one is being decoded and written
+		let groups = groupFilesByArchive(allfiles);
+		let groupindex = 0;
+		for await (let { files: arch, error } of source.streamArchiveList(groups.map(q => q.index))) {
 			if (output.state != "running") { break; }
-			let arch: SubFile[];
-			if (lastarchive && lastarchive.index == fileid.index) {
-				arch = lastarchive.subfiles;
-			} else {
-				let err: Error | null = null;
+			let group = groups[groupindex++];
+			for (let fileid of group.files) {
+				if (output.state != "running") { break; }
+				let file = arch[fileid.subindex];
+				if (!file) {
+					output.log(`skipped ${mode.fileToLogical(source, fileid.index.major, fileid.index.minor, fileid.subindex).join(".")} due to error: ${error}`);
+					continue;
+				}
+				let logicalid = mode.fileToLogical(source, fileid.index.major, fileid.index.minor, file.fileid);
+
 				try {
-					arch = await source.getFileArchive(fileid.index);
+					var res = mode.read(file.buffer, logicalid, source, decodectx);
+					if (res instanceof Promise) { res = await res; }
 				} catch (e) {
-					err = e;
-					arch = [];
+					output.log(`file ${logicalid.join(".")}: ${e}`);
+					continue;
 				}
-				lastarchive = { index: fileid.index, subfiles: arch, error: err };
-			}
-			let file = arch[fileid.subindex];
-			if (!file) {
-				output.log(`skipped ${mode.fileToLogical(source, fileid.index.major, fileid.index.minor, fileid.subindex).join(".")} due to error: ${lastarchive.error}`);
-				continue;
-			}
-			let logicalid = mode.fileToLogical(source, fileid.index.major, fileid.index.minor, file.fileid);
-
-			try {
-				var res = mode.read(file.buffer, logicalid, source, decodectx);
-				if (res instanceof Promise) { res = await res; }
-			} catch (e) {
-				output.log(`file ${logicalid.join(".")}: ${e}`);
-				continue;
-			}
-			if (batchSubfile || batchMaxFiles != -1) {
-				let maxedbatchsize = currentBatch && batchMaxFiles != -1 && currentBatch.outputs.length >= batchMaxFiles;
-				let newarch = currentBatch && currentBatch.arch != arch
-				if (!currentBatch || maxedbatchsize || (batchSubfile && newarch)) {
-					let nextbatchchunknr = (newarch || !maxedbatchsize || !currentBatch ? 0 : currentBatch.batchchunknr + 1);
-					let p = flushbatch();
-					if (p) { await p; }
-					currentBatch = {
-						name: "",
-						startIndex: fileid.index,
-						arch,
-						outputs: [],
-						batchchunknr: nextbatchchunknr
-					};
+				if (batchSubfile || batchMaxFiles != -1) {
+					let maxedbatchsize = currentBatch && batchMaxFiles != -1 && currentBatch.outputs.length >= batchMaxFiles;
+					let newarch = currentBatch && currentBatch.arch != arch
+					if (!currentBatch || maxedbatchsize || (batchSubfile && newarch)) {
+						let nextbatchchunknr = (newarch || !maxedbatchsize || !currentBatch ? 0 : currentBatch.batchchunknr + 1);
+						let p = flushbatch();
+						if (p) { await p; }
+						currentBatch = {
+							name: "",
+							startIndex: fileid.index,
+							arch,
+							outputs: [],
+							batchchunknr: nextbatchchunknr
+						};
+					}
+					currentBatch.outputs.push(res);
+				} else {
+					let filename = `${args.mode}${logicalid.length == 0 ? "" : "-" + logicalid.join("_")}.${mode.ext}`;
+					await outdir.writeFile(filename, res);
 				}
-				currentBatch.outputs.push(res);
-			} else {
-				let filename = `${args.mode}${logicalid.length == 0 ? "" : "-" + logicalid.join("_")}.${mode.ext}`;
-				await outdir.writeFile(filename, res);
 			}
 		}
 		flushbatch();
@@ -0,0 +1,23 @@
+import { Openrs2CacheSource } from "../cache/openrs2loader";
+import { cacheMajors } from "../constants";
+import { ScriptOutput } from "../scriptrunner";
+
+/**
+ * Downloads the given majors of an openrs2 cache into the fs cache ahead of a bulk job, all majors
+ * in the root index if none are given
+ */
+export async function prefetchOpenrs2(output: ScriptOutput, source: Openrs2CacheSource, majors: number[]) {
+	if (majors.length == 0) {
+		let rootindex = await source.getCacheIndex(cacheMajors.index);
+		majors = rootindex.filter(q => q).map(q => q.minor);
+	}
+	let t = Date.now();
+	let lastlog = 0;
+	let res = await source.prefetchMajors(majors, (done, total) => {
+		if (Date.now() - lastlog < 2000 && done != total) { return; }
+		lastlog = Date.now();
+		output.log(`prefetched ${done}/${total} groups`);
+	});
+	output.log(`prefetched ${res.total - res.failed}/${res.total} groups of majors ${majors.join(",")} in ${((Date.now() - t) / 1000).toFixed(1)}s, ${res.failed} failed`);
+	return res;
+}
@@ -1,4 +1,4 @@
-import { DecodeState, getDebug } from "../parser/opcode_reader";
+import { bufferView, DecodeState, getDebug } from "../parser/opcode_reader";
 import { CacheFileSource, CacheIndex, SubFile } from "../cache";
 import { ScriptFS, ScriptOutput } from "../scriptrunner";
 import { FileParser, JsonBasedFile } from "../parser/jsondecoders";
@@ -252,6 +252,7 @@ export function testDecodeFile(decoder: FileParser<any>, buffer: Buffer, source:
 	let state: DecodeState = {
 		isWrite: false,
 		buffer: buffer,
+		view: bufferView(buffer),
 		stack: [],
 		hiddenstack: [],
 		scan: 0,
@@ -268,6 +269,18 @@ export function testDecodeFile(decoder: FileParser<any>, buffer: Buffer, source:
 		error = e;
 	}
 	let debugdata = getDebug(false)!;
+	if (success) {
+		try {
+			let mismatch = decoder.compareCompiled(buffer, source, res, args);
+			if (mismatch) {
+				success = false;
+				error = new Error(mismatch);
+			}
+		} catch (e) {
+			success = false;
+			error = e;
+		}
+	}
 
 	let getDebugFile = function <T extends Outputmode>(outmode: T): T extends "hextext" | "original" ? Buffer : string {
 		let errorfile: string | Buffer = "";
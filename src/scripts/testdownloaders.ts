@@ -0,0 +1,221 @@
+import * as net from "net";
+import * as http from "http";
+import { ScriptOutput } from "../scriptrunner";
+import { CacheDownloader, ParsedClientconfig } from "../cache/downloader";
+import { configureOpenrs2, downloadWithRetry } from "../cache/openrs2loader";
+import { delay } from "../utils";
+
+//same block size as the real server, blocks include their 5 byte header
+const js5BlockSize = 102400;
+
+type StandinStats = { connections: number, maxconnections: number, requests: number };
+
+//content of a stand-in group, deterministic so the client side can check it without the server
+function standinFile(major: number, minor: number) {
+	let size = (minor * 7919) % 250_000 + 1;
+	let data = Buffer.alloc(size);
+	for (let i = 0; i < size; i++) { data[i] = (i * 31 + major * 17 + minor) & 0xff; }
+	return data;
+}
+
+/**
+ * Minimal js5 server, answers the handshakes and serves uncompressed stand-in groups. Blocks of
+ * different files are interleaved round robin like the real server does. If dropAfter is set every
+ * connection is closed after sending that many blocks to test reconnects.
+ */
+function startJs5Standin(dropAfter = 0) {
+	let stats: StandinStats = { connections: 0, maxconnections: 0, requests: 0 };
+	let server = net.createServer(socket => {
+		stats.connections++;
+		stats.maxconnections = Math.max(stats.maxconnections, stats.connections);
+		socket.on("close", () => stats.connections--);
+		socket.on("error", () => { });
+		let input = Buffer.alloc(0);
+		let state: "handshake1" | "handshake2" | "requests" = "handshake1";
+		let sending: { header: Buffer, file: Buffer, offset: number }[] = [];
+		let blockssent = 0;
+		let pumping = false;
+		let pump = () => {
+			if (pumping) { return; }
+			pumping = true;
+			setImmediate(() => {
+				pumping = false;
+				let req = sending.shift();
+				if (!req || socket.destroyed) { return; }
+				let first = req.offset == 0;
+				let payload = Math.min(js5BlockSize - (first ? 10 : 5), req.file.byteLength - req.offset);
+				let parts = [req.header];
+				if (first) {
+					let sizeheader = Buffer.alloc(5);
+					sizeheader.writeUInt8(0, 0);
+					sizeheader.writeUInt32BE(req.file.byteLength, 1);
+					parts.push(sizeheader);
+				}
+				parts.push(req.file.subarray(req.offset, req.offset + payload));
+				req.offset += payload;
+				socket.write(Buffer.concat(parts));
+				if (req.offset < req.file.byteLength) { sending.push(req); }
+				if (dropAfter != 0 && ++blockssent >= dropAfter) {
+					socket.destroy();
+					return;
+				}
+				if (sending.length != 0) { pump(); }
+			});
+		}
+		socket.on("data", data => {
+			input = Buffer.concat([input, data]);
+			while (true) {
+				if (state == "handshake1") {
+					//type, length, then length bytes of versions and key
+					if (input.byteLength < 2 || input.byteLength < 2 + input[1]) { break; }
+					input = input.subarray(2 + input[1]);
+					socket.write(Buffer.from([0]));
+					state = "handshake2";
+				} else if (state == "handshake2") {
+					if (input.byteLength < 20) { break; }
+					input = input.subarray(20);
+					state = "requests";
+				} else {
+					if (input.byteLength < 10) { break; }
+					let major = input.readUInt8(1);
+					let minor = input.readUInt32BE(2);
+					input = input.subarray(10);
+					stats.requests++;
+					let header = Buffer.alloc(5);
+					header.writeUInt8(major, 0);
+					header.writeUInt32BE(minor, 1);
+					sending.push({ header, file: standinFile(major, minor), offset: 0 });
+					pump();
+				}
+			}
+		});
+	});
+	let listening = new Promise<number>(done => server.listen(0, "127.0.0.1", () => done((server.address() as net.AddressInfo).port)));
+	return { server, stats, listening };
+}
+
+function standinConfig(port: number): ParsedClientconfig {
+	return { key: "0".repeat(32), serverVersionMajor: 900, serverVersionMinor: 1, endpoint: "127.0.0.1", port, unknownshort1: 0, unknownshort2: 0 };
+}
+
+async function testJs5Downloader(output: ScriptOutput) {
+	let failures: string[] = [];
+	let check = (ok: boolean, msg: string) => {
+		if (!ok) { failures.push(msg); }
+	};
+
+	//many concurrent callers, the client may never open more sockets than it has slots
+	{
+		let standin = startJs5Standin();
+		let port = await standin.listening;
+		let socketcount = 3;
+		let source = new CacheDownloader(socketcount, 8, standinConfig(port));
+		let minors = Array.from({ length: 200 }, (_, i) => i);
+		let files = await Promise.all(minors.map(minor => source.getFile(5, minor)));
+		files.forEach((file, minor) => check(file.equals(standinFile(5, minor)), `js5 file 5.${minor} content mismatch`));
+		check(standin.stats.maxconnections <= socketcount, `js5 opened ${standin.stats.maxconnections} connections with ${socketcount} slots`);
+		check(standin.stats.requests == minors.length, `js5 server got ${standin.stats.requests} requests for ${minors.length} files`);
+		source.close();
+		standin.server.close();
+	}
+
+	//dropped connections fail their requests, which are retried on a new socket. Slots are reopened
+	//while others are still connecting, which is where concurrent callers could race for a slot
+	{
+		let standin = startJs5Standin(15);
+		let port = await standin.listening;
+		let socketcount = 3;
+		let source = new CacheDownloader(socketcount, 4, standinConfig(port));
+		let minors = Array.from({ length: 60 }, (_, i) => i);
+		//requests stuck on orphaned sockets never finish, fail instead of hanging
+		let files = await Promise.race([
+			Promise.all(minors.map(minor => source.getFile(7, minor))),
+			delay(20_000).then(() => null)
+		]);
+		check(files != null, "js5 requests did not finish after reconnecting");
+		files?.forEach((file, minor) => check(file.equals(standinFile(7, minor)), `js5 file 7.${minor} content mismatch after reconnect`));
+		check(standin.stats.maxconnections <= socketcount, `js5 had ${standin.stats.maxconnections} connections open with ${socketcount} slots while reconnecting`);
+		source.close();
+		standin.server.close();
+	}
+
+	output.log(failures.length == 0 ? "js5 downloader: passed" : `js5 downloader: ${failures.length} failures\n${failures.join("\n")}`);
+	return failures.length;
+}
+
+/**
+ * Stand-in for the openrs2 file endpoint. /ok/<n> answers after a short delay, /fail<status>/<n> first
+ * answers with that status and then succeeds. Counts requests per path and the max in parallel
+ */
+function startOpenrs2Standin() {
+	let stats = { active: 0, maxactive: 0, hits: new Map<string, number>() };
+	let server = http.createServer((req, res) => {
+		let url = req.url ?? "";
+		let hits = (stats.hits.get(url) ?? 0) + 1;
+		stats.hits.set(url, hits);
+		stats.active++;
+		stats.maxactive = Math.max(stats.maxactive, stats.active);
+		let failstatus = url.match(/^\/fail(\d+)\//);
+		setTimeout(() => {
+			stats.active--;
+			if (failstatus && (hits == 1 || +failstatus[1] == 404)) {
+				res.writeHead(+failstatus[1]);
+				res.end("error body");
+			} else {
+				res.writeHead(200);
+				res.end(url);
+			}
+		}, 20);
+	});
+	let listening = new Promise<number>(done => server.listen(0, "127.0.0.1", () => done((server.address() as net.AddressInfo).port)));
+	return { server, stats, listening };
+}
+
+async function testOpenrs2Downloads(output: ScriptOutput) {
+	let failures: string[] = [];
+	let check = (ok: boolean, msg: string) => {
+		if (!ok) { failures.push(msg); }
+	};
+	let standin = startOpenrs2Standin();
+	let base = `http://127.0.0.1:${await standin.listening}`;
+	let prevconfig = configureOpenrs2({ concurrency: 3, retries: 2, retryDelay: 10 });
+	try {
+		//concurrent requests for one url share a single download
+		let same = await Promise.all(Array.from({ length: 10 }, () => downloadWithRetry(`${base}/ok/shared`)));
+		check(standin.stats.hits.get("/ok/shared") == 1, `openrs2 shared url was downloaded ${standin.stats.hits.get("/ok/shared")} times`);
+		check(same.every(q => q.toString() == "/ok/shared"), "openrs2 shared download content mismatch");
+
+		//never more downloads in flight than the configured concurrency
+		standin.stats.maxactive = 0;
+		let paths = Array.from({ length: 20 }, (_, i) => `/ok/${i}`);
+		let files = await Promise.all(paths.map(path => downloadWithRetry(base + path)));
+		check(files.every((file, i) => file.toString() == paths[i]), "openrs2 download content mismatch");
+		check(standin.stats.maxactive == 3, `openrs2 had ${standin.stats.maxactive} downloads in flight with a concurrency of 3`);
+
+		//rate limits and server errors are retried, other errors fail right away
+		for (let status of [429, 503]) {
+			let path = `/fail${status}/0`;
+			let file = await downloadWithRetry(base + path).catch(() => null);
+			check(file?.toString() == path, `openrs2 download did not recover from http ${status}`);
+			check(standin.stats.hits.get(path) == 2, `openrs2 requested ${path} ${standin.stats.hits.get(path)} times, expected one retry`);
+		}
+		let missing = await downloadWithRetry(`${base}/fail404/0`).then(() => true, () => false);
+		check(!missing, "openrs2 download of a missing file succeeded");
+		check(standin.stats.hits.get("/fail404/0") == 1, `openrs2 retried a 404 ${standin.stats.hits.get("/fail404/0")} times`);
+	} finally {
+		configureOpenrs2(prevconfig);
+		standin.server.close();
+	}
+	output.log(failures.length == 0 ? "openrs2 downloads: passed" : `openrs2 downloads: ${failures.length} failures\n${failures.join("\n")}`);
+	return failures.length;
+}
+
+/**
+ * Runs the cache downloaders against local stand-in servers, throws if any check failed
+ */
+export async function testDownloaders(output: ScriptOutput) {
+	let failures = 0;
+	failures += await testJs5Downloader(output);
+	failures += await testOpenrs2Downloads(output);
+	if (failures != 0) { throw new Error(`${failures} downloader checks failed`); }
+}
@@ -536,6 +536,30 @@ export class CallbackPromise<T = void> extends Promise<T> {
 	}
 }
 
+/**
+ * Runs at most `max` tasks at the same time, unlike trickleTasks the tasks can come from unrelated callers
+ */
+export class TaskLimiter {
+	max: number;
+	private active = 0;
+	private waiting: (() => void)[] = [];
+	constructor(max: number) {
+		this.max = max;
+	}
+	async run<T>(fn: () => Promise<T>) {
+		while (this.active >= this.max) {
+			await new Promise<void>(d => this.waiting.push(d));
+		}
+		this.active++;
+		try {
+			return await fn();
+		} finally {
+			this.active--;
+			this.waiting.shift()?.();
+		}
+	}
+}
+
 //runs at most [parallel] async tasks at the same time
 export function trickleTasks(name: string, parallel: number, tasks: Iterable<Promise<any>> | (() => Iterable<Promise<any>>)) {
 	let len = (Array.isArray(tasks) ? tasks.length : -1);
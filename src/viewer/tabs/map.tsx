@@ -26,7 +26,7 @@ type DiffMesh = {
 }
 
 type SceneMapState = {
-	chunkgroups: { chunkx: number, chunkz: number, models: Map<ThreejsSceneCache, RSMapChunk>, diffs: DiffMesh[] }[],
+	chunkgroups: { chunkx: number, chunkz: number, lod: number, models: Map<ThreejsSceneCache, RSMapChunk>, diffs: DiffMesh[] }[],
 	center: { x: number, z: number },
 	toggles: Record<string, boolean>,
 	selectionData: any,
@@ -42,6 +42,7 @@ export function SceneMapModel(p: LookupModeProps) {
 
 class SceneMapModelInner extends React.Component<LookupModeProps & { ctx: RenderableContext | null, partial: UIContext }, SceneMapState> {
 	selectCleanup: (() => void)[] = [];
+	lodTimer = 0;
 	constructor(p) {
 		super(p);
 		this.state = {
@@ -175,12 +176,51 @@ class SceneMapModelInner extends React.Component<LookupModeProps & { ctx: Render
 	componentDidMount() {
 		//TODO this is a leak if ctx changes while mounted
 		this.props.partial.renderer?.on("select", this.meshSelected);
+		this.props.partial.renderer?.on("camerachange", this.cameraChanged);
 	}
 
 	componentWillUnmount() {
 		this.clear();
+		clearTimeout(this.lodTimer);
 		//TODO this is a leak if ctx changes while mounted
 		this.props.partial.renderer?.off("select", this.meshSelected);
+		this.props.partial.renderer?.off("camerachange", this.cameraChanged);
+	}
+
+	//the ground position under the camera in map units
+	lodFocus(center: { x: number, z: number }) {
+		let cam = this.props.ctx?.renderer.getCurrent2dCamera();
+		if (!cam) { return center; }
+		//the scene is scaled by 1/512 with z flipped, and chunks are offset by the session center
+		return { x: center.x + cam.position.x * 512, z: center.z - cam.position.z * 512 };
+	}
+
+	//chunks far away from the camera get simplified meshes, keeps huge areas loadable
+	chunkLod(chunkx: number, chunkz: number, chunksize: number, focus: { x: number, z: number }) {
+		let dx = Math.abs((chunkx + 0.5) * chunksize * 512 - focus.x);
+		let dz = Math.abs((chunkz + 0.5) * chunksize * 512 - focus.z);
+		return Math.min(2, Math.floor(Math.max(dx, dz) / (chunksize * 512) / 4));
+	}
+
+	@boundMethod
+	cameraChanged() {
+		//controls fire for every frame of a drag, wait for the camera to settle
+		clearTimeout(this.lodTimer);
+		this.lodTimer = +setTimeout(this.refineLods, 500);
+	}
+
+	//reloads the chunks whose lod no longer matches their distance to the camera
+	@boundMethod
+	refineLods() {
+		let focus = this.lodFocus(this.state.center);
+		for (let group of this.state.chunkgroups) {
+			for (let cache of group.models.keys()) {
+				let chunksize = (cache.engine.classicData ? classicChunkSize : rs2ChunkSize);
+				if (this.chunkLod(group.chunkx, group.chunkz, chunksize, focus) != group.lod) {
+					this.loadChunk(group.chunkx, group.chunkz, cache);
+				}
+			}
+		}
 	}
 
 	@boundMethod
@@ -196,7 +236,12 @@ class SceneMapModelInner extends React.Component<LookupModeProps & { ctx: Render
 			const renderer = this.props.ctx?.renderer;
 			if (!sceneCache || !renderer) { return; }
 
-			let chunk = RSMapChunk.create(sceneCache, chunkx, chunkz, { skybox: true, map2d: this.state.extramodels, hashboxes: this.state.extramodels, minimap: this.state.extramodels });
+			let chunksize = (sceneCache.engine.classicData ? classicChunkSize : rs2ChunkSize);
+			let lod = 0;
+			if (prevstate.chunkgroups.length != 0) {
+				lod = this.chunkLod(chunkx, chunkz, chunksize, this.lodFocus(prevstate.center));
+			}
+			let chunk = RSMapChunk.create(sceneCache, chunkx, chunkz, { skybox: true, map2d: this.state.extramodels, hashboxes: this.state.extramodels, minimap: this.state.extramodels, lod });
 			chunk.on("changed", () => {
 				let toggles = this.state.toggles;
 				let changed = false;
@@ -224,7 +269,6 @@ class SceneMapModelInner extends React.Component<LookupModeProps & { ctx: Render
 			})
 			let center = prevstate.center;
 			if (prevstate.chunkgroups.length == 0) {
-				let chunksize = (sceneCache.engine.classicData ? classicChunkSize : rs2ChunkSize);
 				center = {
 					x: (chunkx + 0.5) * chunksize * 512,
 					z: (chunkz + 0.5) * chunksize * 512,
@@ -238,10 +282,13 @@ class SceneMapModelInner extends React.Component<LookupModeProps & { ctx: Render
 			let newstate: Partial<SceneMapState> = {};
 			newstate.center = center;
 			if (!group) {
-				group = { chunkx, chunkz, models: new Map(), diffs: [] };
+				group = { chunkx, chunkz, lod, models: new Map(), diffs: [] };
 				newstate.chunkgroups = [...prevstate.chunkgroups, group];
 			}
+			//replaces the chunk when it is reloaded at a different lod
+			group.models.get(sceneCache)?.cleanup();
 			group.models.set(sceneCache, chunk);
+			group.lod = lod;
 			return newstate as any;//react typings fail?
 		});
 	}
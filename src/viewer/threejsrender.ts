@@ -28,7 +28,9 @@ function compatCancelAnimationFrame(id: number) {
 }
 
 export type ThreeJsRendererEvents = {
-	select: null | { obj: Mesh, meshdata: Extract<ModelExtras, ClickableMesh<any>>, match: unknown, vertexgroups: { start: number, end: number, mesh: THREE.Mesh }[] }
+	select: null | { obj: Mesh, meshdata: Extract<ModelExtras, ClickableMesh<any>>, match: unknown, vertexgroups: { start: number, end: number, mesh: THREE.Mesh }[] },
+	//the user moved the camera with the controls
+	camerachange: null
 }
 
 export interface ThreeJsSceneElementSource {
@@ -105,7 +107,7 @@ export class ThreeJsRenderer extends TypedEmitter<ThreeJsRendererEvents> {
 		this.standardControls = new OrbitControls(this.camera, canvas);
 		this.standardControls.target.set(0, 5, 0);
 		this.standardControls.update();
-		this.standardControls.addEventListener("change", this.forceFrame);
+		this.standardControls.addEventListener("change", this.controlsChanged);
 
 		this.topdowncam = new SkewOrthographicCamera(10, 0, 0);
 		this.topdowncam.position.copy(this.camera.position);
@@ -114,7 +116,7 @@ export class ThreeJsRenderer extends TypedEmitter<ThreeJsRendererEvents> {
 		this.orthoControls.target.set(0, 5, 0);
 		this.orthoControls.screenSpacePanning = false;
 		this.orthoControls.update();
-		this.orthoControls.addEventListener("change", this.forceFrame);
+		this.orthoControls.addEventListener("change", this.controlsChanged);
 
 		const scene = new THREE.Scene();
 		this.scene = scene;
@@ -441,6 +443,12 @@ export class ThreeJsRenderer extends TypedEmitter<ThreeJsRendererEvents> {
 		render.cubeCamera.update(this.renderer, this.scene);
 	}
 
+	@boundMethod
+	controlsChanged() {
+		this.emit("camerachange", null);
+		this.forceFrame();
+	}
+
 	@boundMethod
 	forceFrame() {
 		if (!this.queuedFrameId && this.autoFrameMode != "never") {
@@ -617,6 +625,14 @@ export class ThreeJsRenderer extends TypedEmitter<ThreeJsRendererEvents> {
 
 			if (!(obj instanceof THREE.Mesh) || !meshdata.isclickable) { continue; }
 
+			//instanced locs share their geometry, the instance itself identifies the object
+			if (isct.instanceId != undefined) {
+				let match = meshdata.subobjects[isct.instanceId];
+				if (!match) { continue; }
+				this.emit("select", { obj, meshdata, match, vertexgroups: [] });
+				return;
+			}
+
 			//find out what we clicked
 			let match: unknown = undefined;
 			let endindex: number = obj.geometry.index?.count ?? obj.geometry.attributes.position.count;
@@ -78,6 +78,7 @@ module.exports = (env) => {
 				crypto: false,
 				sharp: false,
 				net: false,
+				worker_threads: false,
 				sqlite3: false,
 				process: require.resolve('process/browser'),
 				"electron/renderer": false